@@ -0,0 +1,65 @@
+/**
+ * @file "FreeRTOSConfig.h"
+ * @brief FreeRTOS configuration of the AP_RTOS build
+ * @date 2024
+ *
+ * Only used with AP_RTOS=1 in project.mk, which links the MSDK FreeRTOS
+ * library. See ap_rtos.h for the tasks.
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include "max78000.h"
+
+/******************************** MACRO DEFINITIONS ********************************/
+// Core clock, the tick comes from SysTick
+#define configCPU_CLOCK_HZ ((uint32_t)SystemCoreClock)
+#define configTICK_RATE_HZ ((portTickType)1000)
+#define configUSE_PREEMPTION 1
+#define configUSE_TIME_SLICING 0
+#define configUSE_IDLE_HOOK 0
+#define configUSE_TICK_HOOK 0
+#define configUSE_16_BIT_TICKS 0
+#define configIDLE_SHOULD_YIELD 1
+
+// Host, link and idle tasks, see ap_rtos.h
+#define configMAX_PRIORITIES 5
+#define configMINIMAL_STACK_SIZE ((unsigned short)128)
+#define configTOTAL_HEAP_SIZE ((size_t)(26 * 1024))
+#define configMAX_TASK_NAME_LEN 8
+
+#define configUSE_MUTEXES 1
+#define configUSE_RECURSIVE_MUTEXES 1
+#define configUSE_TASK_NOTIFICATIONS 1
+#define configUSE_CO_ROUTINES 0
+#define configUSE_TIMERS 0
+#define configCHECK_FOR_STACK_OVERFLOW 0
+#define configUSE_MALLOC_FAILED_HOOK 0
+
+#define INCLUDE_vTaskDelay 1
+#define INCLUDE_vTaskDelete 1
+#define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
+#define INCLUDE_vTaskSuspend 1
+// Host task high-water mark in stack profiling builds (make stack)
+#ifdef STACK_PROFILE
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
+#endif
+
+// Interrupt priorities. The I2C interrupts notify the link task, so they
+// run at configMAX_SYSCALL_INTERRUPT_PRIORITY (see ap_rtos_start)
+#define configPRIO_BITS __NVIC_PRIO_BITS
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY ((1 << configPRIO_BITS) - 1)
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY 1
+#define configKERNEL_INTERRUPT_PRIORITY \
+    (configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+#define configMAX_SYSCALL_INTERRUPT_PRIORITY \
+    (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+
+// Kernel handlers take the place of the startup file's weak ones
+#define vPortSVCHandler SVC_Handler
+#define xPortPendSVHandler PendSV_Handler
+#define xPortSysTickHandler SysTick_Handler
+
+#endif
@@ -2,52 +2,24 @@
 #define AP_MESSAGING_H
 
 /*
-  Define our messaging struct and routines to send/receive the struct over I2C.
-  Depends on our crypto and TRNG utilities in crypto_util / general_util.h
-  Also utilizes the I2C send/receive functions defined by board_link.h
+  AP end of the messaging engine in msg_core.h. Sends and receives msg_t
+  frames to and from a component address through board_link.h.
 */
 
-#include <stdint.h>
-#include <string.h>
-#include <stdlib.h>
-#include "crypto_util.h"
-#include "general_util.h"
+#include "msg_core.h"
+#include "lat_hist.h"
+#ifdef MSG_FORMAT_NEGOTIATE
+#include "msg_schema.h"
+#endif
 
 // Return values -- match success / failure values from reference design
-#define AP_SUCCESS 0
-#define AP_FAILURE -1
-
-#define MAX_CONTENTS_LEN 198
-#define HASH_LEN 32
-#define IV_LEN 16
-// Amount of struct, starting from byte 0, that is encrypted
-// This means we encrypt from rng_chal up through byte 17 of hash
-#define ENC_LEN 224
-
-/* 
-   The total size of this struct must be exactly 255 bytes to fit into one
-   I2C message. Use the pragma pack compiler directive so that the compiler 
-   does not insert padding between fields, which would mess up serialization
-*/
-#pragma pack(push,1)
-typedef struct msg_t {
-    // RNG challenge / response values for cryptographic handshake
-    uint32_t rng_chal;
-    uint32_t rng_resp;
-    // Reusing this field from reference design for simplicity
-    uint8_t opcode;
-    // contents are unencrypted when set by user, encrypted when sent to I2C
-    uint8_t contents[MAX_CONTENTS_LEN];
-    // Hash of rng_chal through contents, partially encrypted
-    uint8_t hash[HASH_LEN];
-    // IV used for encryption, always in plaintext
-    uint8_t iv[IV_LEN];
-} msg_t;
-#pragma pack(pop)
-
+#define AP_SUCCESS MSG_SUCCESS
+#define AP_FAILURE MSG_FAILURE
+// Returned by ap_try_recv while the component has not replied yet
+#define AP_PENDING 1
 
 // Serialize and send the global transmit msg_t over I2C to the specified address
-// User must fill in opcode and contents before calling. This function will handle
+// User must fill in opcode, len and contents before calling. This function will handle
 // encryption, RNG challenge management, and hashing
 int ap_transmit(uint8_t address);
 
@@ -58,8 +30,137 @@ int ap_transmit(uint8_t address);
 // value is not checked (need to be able to initiate a chain somehow).  
 int ap_poll_recv(uint8_t address, int first);
 
-// Zero out the global transmit, receive msg_t structs to get confidential data out of 
-// device memory. Certainly not strictly necessary, but can't hurt.
-void reset_msg();
+// Non-blocking version of ap_poll_recv. Returns AP_PENDING if the component
+// has not replied yet, otherwise the same result ap_poll_recv would.
+int ap_try_recv(uint8_t address, int first);
+
+// Open and check a frame of len bytes from address that was already read into
+// receive, e.g. by a queued link receive. Same result as ap_poll_recv.
+int ap_accept(uint8_t address, int len, int first);
+
+#ifdef LAT_HIST
+// Link operations the AP keeps a latency histogram of, see lat_hist.h
+typedef enum {
+    LAT_LINK_ISSUE_CMD,
+    LAT_LINK_TRANSMIT,
+    LAT_LINK_POLL_RECV,
+    LAT_LINK_CNT
+} lat_link_t;
+
+// Filled in by issue_cmd, ap_transmit and ap_poll_recv, printed by "stats"
+extern lat_hist_t ap_link_hists[LAT_LINK_CNT];
+#endif
+
+#ifdef ENROLL_RESUME
+// Resumption tickets of enrolled components, kept by application_processor.c
+// in its flash record. A ticket is the hash of the certificate a component
+// presented and the ECDH secret run with it, so a component that still
+// presents the same certificate is enrolled again without any P-256 work.
+// ap_resume_find copies the secret of the ticket for cert_hash and returns
+// AP_SUCCESS if there is one. ap_resume_save stores a new ticket, it needs
+// the device key selected.
+int ap_resume_find(const uint8_t *cert_hash, uint8_t *secret);
+void ap_resume_save(const uint8_t *cert_hash, const uint8_t *secret);
+#endif
+
+#ifdef BOOT_BROADCAST
+// Tag releasing the component at address from the boot exchange whose last
+// message was just received from it, MSG_RELEASE_TAG_LEN bytes into tag. See
+// msg_release_tag, the tags of all components go out in one broadcast_release
+int ap_release_tag(uint8_t address, uint8_t *tag);
+#endif
+
+#ifdef ADDR_ASSIGN
+// First of the dense range of bus addresses components are assigned with
+// ADDR_ASSIGN=1, the provisioned ones take ADDR_ASSIGN_BASE and up
+#ifndef ADDR_ASSIGN_BASE
+#define ADDR_ASSIGN_BASE 0x60
+#endif
+
+// Move each of the count components with IDs ids to the bus address in addrs,
+// in one general call write of authenticated entries (see msg_assign_tag)
+// numbered seq, which must be above that of every assignment before.
+// Components keep their keys and MACs on the address their ID maps to, which
+// ap_home_addr gives for the assigned one from then on
+int ap_addr_assign(uint32_t seq, const uint32_t *ids, const uint8_t *addrs, int count);
+
+// Address the ID of the component assigned address maps to, address itself
+// if the last ap_addr_assign did not assign it
+uint8_t ap_home_addr(uint8_t address);
+#else
+#define ap_home_addr(address) (address)
+#endif
+
+#ifdef SCAN_LIGHT
+// Light scan of the component at address with nonce, see msg_core.h. Sets
+// *component_id and returns AP_SUCCESS if the reply authenticates
+int ap_scan(uint8_t address, const uint8_t nonce[MSG_SCAN_NONCE_LEN], uint32_t *component_id);
+#endif
+
+#ifdef MSG_FORMAT_NEGOTIATE
+// Frames to the component at address go in the legacy framing until
+// ap_wire_format_learn, SCAN and VALIDATE start with this
+void ap_wire_format_reset(uint8_t address);
+
+// Frames to the component at address go in this image's framing from now on
+// if its ID reply id says it speaks it, see MSG_FORMAT_NEGOTIATE in msg_core.h
+void ap_wire_format_learn(uint8_t address, const msg_id_t *id);
+#else
+#define ap_wire_format_reset(address) ((void)0)
+#define ap_wire_format_learn(address, id) ((void)0)
+#endif
+
+#ifdef LINK_ASYNC
+// Same as ap_transmit, but the frame is only queued on the link (see
+// send_frame_async). Check link_send_status before waiting on the reply.
+int ap_transmit_async(uint8_t address);
+#endif
+
+#ifdef MSG_CHANNEL
+// Open a post-boot channel from the conversation that just finished, call right
+// after the component's final boot message has been received
+void msg_channel_open(msg_channel_t *channel);
+
+// Send the global transmit msg_t as a single channel frame. User must fill in
+// opcode, len and contents before calling.
+int ap_channel_transmit(msg_channel_t *channel, uint8_t address);
+
+// Receive a single channel frame into the global receive msg_t. Returns success
+// only if it authenticates under the channel key and its sequence number is new.
+int ap_channel_poll_recv(msg_channel_t *channel, uint8_t address);
+
+// Non-blocking version of ap_channel_poll_recv. Returns AP_PENDING if the
+// component has no frame waiting, otherwise the same result ap_channel_poll_recv would.
+int ap_channel_try_recv(msg_channel_t *channel, uint8_t address);
+#endif
+
+#ifdef MSG_STREAM
+// Open a stream to the component at address in the given MSG_STREAM_AP_* direction.
+// Uses channel if it is open, otherwise sets up a channel just for the stream.
+int ap_stream_open(msg_stream_t *stream, msg_channel_t *channel, uint8_t address, int direction);
+
+// Queue len bytes on a stream opened with MSG_STREAM_AP_WRITES. Full chunks go
+// out right away, the rest waits for more data or ap_stream_close.
+int ap_stream_write(msg_stream_t *stream, uint8_t address, const uint8_t *buf, int len);
+
+// Read up to len bytes from a stream opened with MSG_STREAM_AP_READS. Returns the
+// number of bytes read, 0 once the whole stream has been read, failure on error.
+int ap_stream_read(msg_stream_t *stream, uint8_t address, uint8_t *buf, int len);
+
+// Flush a written stream with a FIN and wait until the component has accepted all
+// of it. Wipes the stream state in every case.
+// Errors abort a stream, close it and open a new one to start over.
+int ap_stream_close(msg_stream_t *stream, uint8_t address);
+#endif
+
+#ifdef MSG_JUMBO
+// Send len bytes, up to MSG_JUMBO_MAX_LEN, to the component at address as one
+// jumbo frame on channel
+int ap_jumbo_send(msg_channel_t *channel, uint8_t address, const uint8_t *buf, int len);
+
+// Wait for a jumbo frame on channel from the component at address. Returns the
+// number of bytes read into buf, or AP_FAILURE
+int ap_jumbo_recv(msg_channel_t *channel, uint8_t address, uint8_t *buf, int maxlen);
+#endif
 
 #endif 
@@ -0,0 +1,77 @@
+/**
+ * @file "ap_rtos.h"
+ * @brief Optional FreeRTOS task model of the AP
+ * @date 2024
+ *
+ * With AP_RTOS=1 in project.mk the command loop runs as the host task, and
+ * a link task of higher priority owns the asynchronous link queue (see
+ * LINK_ASYNC in board_link.h). The link task is woken by every completed
+ * I2C transaction and once a tick, so bus I/O preempts host parsing and
+ * crypto instead of waiting for them.
+ */
+
+#ifndef __AP_RTOS__
+#define __AP_RTOS__
+
+#ifdef AP_RTOS
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************** MACRO DEFINITIONS ********************************/
+// Task priorities above the idle task
+#define AP_RTOS_HOST_PRIORITY 1
+#define AP_RTOS_LINK_PRIORITY 3
+// Task stacks in words. The host task runs every command handler
+#ifndef AP_RTOS_HOST_STACK
+#define AP_RTOS_HOST_STACK 4096
+#endif
+#define AP_RTOS_LINK_STACK 512
+
+/******************************** FUNCTION PROTOTYPES ********************************/
+/**
+ * @brief Start the tasks and the scheduler
+ * 
+ * @param host_main: void (*)(void), command loop the host task runs
+ * 
+ * Does not return
+*/
+void ap_rtos_start(void (*host_main)(void));
+
+/**
+ * @brief Take the link queue lock, recursive
+ * 
+ * Does nothing until the scheduler runs
+*/
+void ap_rtos_link_lock(void);
+
+/**
+ * @brief Release the link queue lock
+*/
+void ap_rtos_link_unlock(void);
+
+/**
+ * @brief Wake the link task from an I2C completion interrupt
+*/
+void ap_rtos_link_kick_from_isr(void);
+
+/**
+ * @brief Wait a tick for the link task to move the queue on
+ * 
+ * @return bool: false if the caller has to run the queue itself, before
+ * the scheduler starts or from the link task
+*/
+bool ap_rtos_link_wait(void);
+
+#ifdef STACK_PROFILE
+/**
+ * @brief Host task stack never touched since it started, see stack_profile.h
+ * 
+ * @return uint32_t: bytes
+*/
+uint32_t ap_rtos_host_stack_unused(void);
+#endif
+
+#endif
+
+#endif
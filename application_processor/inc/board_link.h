@@ -16,12 +16,131 @@
 
 #include "simple_i2c_controller.h"
 
+#ifdef BOARD_LINK_READY_GPIO
+#include "gpio.h"
+#endif
+
+#ifdef LINK_SPI
+#include "simple_spi_controller.h"
+#endif
+
 /******************************** MACRO DEFINITIONS ********************************/
 // Last byte of the component ID is the I2C address
 #define COMPONENT_ADDR_MASK 0x000000FF             
 #define SUCCESS_RETURN 0
 #define ERROR_RETURN -1
 
+// Polling policy for poll_and_receive_packet. The first check waits roughly
+// as long as a component needs for its crypto, then the delay doubles up to
+// POLL_MAX_DELAY_US. POLL_TIMEOUT_US of waiting gives up, 0 waits forever.
+#ifndef POLL_INITIAL_DELAY_US
+#define POLL_INITIAL_DELAY_US 500
+#endif
+#ifndef POLL_MAX_DELAY_US
+#define POLL_MAX_DELAY_US 10000
+#endif
+#ifndef POLL_TIMEOUT_US
+#define POLL_TIMEOUT_US 5000000
+#endif
+// Granularity used while watching the ready line
+#define POLL_READY_SLICE_US 20
+
+// Link health per address. Every failed exchange with a component is a
+// strike and any success clears them. After LINK_DEAD_STRIKES strikes in a
+// row the component only gets LINK_DEAD_TIMEOUT_US to answer a poll, so a
+// dead one costs milliseconds instead of POLL_TIMEOUT_US every time.
+#ifndef LINK_DEAD_STRIKES
+#define LINK_DEAD_STRIKES 2
+#endif
+#ifndef LINK_DEAD_TIMEOUT_US
+#define LINK_DEAD_TIMEOUT_US 50000
+#endif
+
+// Optional shared "data ready" line (BOARD_LINK_READY_GPIO=1 in project.mk on
+// the AP and every component). Components pull it low while they hold an
+// unread packet, so the AP only touches the bus once something is ready.
+#ifndef READY_GPIO_PORT
+#define READY_GPIO_PORT MXC_GPIO1
+#endif
+#ifndef READY_GPIO_PIN
+#define READY_GPIO_PIN MXC_GPIO_PIN_6
+#endif
+
+// Optional asynchronous link (LINK_ASYNC=1 in project.mk). A send or receive
+// is queued as a link_op_t and moved on by link_run, which starts each I2C
+// transaction with MXC_I2C_MasterTransactionAsync and returns without
+// waiting for it. Operations on different buses run side by side, those on
+// one bus take turns and those to one address run in queue order.
+#ifdef LINK_ASYNC
+// Result of an operation that has not finished yet
+#define LINK_OP_PENDING 1
+// Operations send_frame_async can have in flight
+#ifndef LINK_ASYNC_SLOTS
+#define LINK_ASYNC_SLOTS 4
+#endif
+// Scheduler period of link_wait
+#define LINK_ASYNC_SLICE_US 20
+#endif
+
+/******************************** TYPE DEFINITIONS ********************************/
+// One bounded piece of background work, run while polling a component.
+// Returns nonzero while there is more to do.
+typedef int (*board_link_idle_t)(void);
+
+// Link backend, what send_frame, poll_and_receive_packet, try_receive_packet
+// and poll_receive_free run for a component. Every address uses link_i2c
+// until board_link_set_backend moves it, the messaging and crypto layers
+// above never see which. Probes, enrollment, negotiation and the boot
+// release always go over I2C
+typedef struct link_backend_t {
+    int (*send)(i2c_addr_t address, uint8_t len, uint8_t* frame);
+    int (*recv)(i2c_addr_t address, uint8_t* packet);
+    int (*try_recv)(i2c_addr_t address, uint8_t* packet);
+    int (*wait_free)(i2c_addr_t address);
+} link_backend_t;
+
+#ifdef LINK_ASYNC
+typedef struct link_op_t link_op_t;
+
+// Called from link_run once an operation has finished, op->result holds
+// what the blocking call would have returned
+typedef void (*link_callback_t)(link_op_t* op);
+
+struct link_op_t {
+    i2c_addr_t address;
+    // Packet length, for a receive set once it is known
+    uint8_t len;
+    // Frame as for send_frame, or packet buffer of a receive
+    uint8_t* buf;
+    link_callback_t callback;
+    void* ctx;
+    // LINK_OP_PENDING until the operation finishes
+    int result;
+
+    // Scheduler state, set up by link_submit_send / link_submit_recv
+    uint8_t step;
+    uint8_t tries;
+    volatile uint8_t xfer;
+    volatile int xfer_result;
+    uint32_t waited;
+    uint32_t due;
+    uint32_t delay;
+    // Register values and the CRC, with I2C_FRAME_HEADROOM in front
+    uint8_t small[I2C_FRAME_HEADROOM + 2];
+    uint8_t crc[I2C_FRAME_HEADROOM + 4];
+    link_op_t* next;
+};
+#endif
+
+/******************************** EXTERN DEFINITIONS ********************************/
+// The register protocol of simple_i2c_controller.h
+extern const link_backend_t link_i2c;
+#ifdef LINK_SPI
+// The exchanges of simple_spi_controller.h, for components with a chip
+// select. A failed exchange moves the component back to link_i2c for good
+extern const link_backend_t link_spi;
+#endif
+
 /******************************** FUNCTION PROTOTYPES ********************************/
 /**
  * @brief Initialize the board link connection
@@ -30,6 +149,139 @@
 */
 void board_link_init(void);
 
+/**
+ * @brief Set the background work polls run while waiting on a component
+ * 
+ * @param idle: board_link_idle_t, one piece of it is run per poll delay,
+ *     NULL for none
+*/
+void board_link_set_idle(board_link_idle_t idle);
+
+/**
+ * @brief Assign a component to one of the I2C buses
+ * 
+ * @param component_id: uint32_t, ID of the component
+ * @param bus: uint8_t, I2C controller index the component is wired to
+ * 
+ * Components without a bus are found by probing every bus in use
+*/
+void board_link_set_bus(uint32_t component_id, uint8_t bus);
+
+/**
+ * @brief Choose the backend frames to a component go over
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param backend: const link_backend_t*, backend, NULL for link_i2c
+*/
+void board_link_set_backend(i2c_addr_t address, const link_backend_t* backend);
+
+#ifdef LINK_SPI
+/**
+ * @brief Give a component its SPI chip select
+ * 
+ * @param component_id: uint32_t, ID of the component
+ * @param pin: uint8_t, chip select pin, see SPI_CS_PORT
+ * 
+ * The component stays on I2C until board_link_spi_start
+*/
+void board_link_set_spi(uint32_t component_id, uint8_t pin);
+
+/**
+ * @brief Move every component with a chip select to link_spi
+*/
+void board_link_spi_start(void);
+#endif
+
+#ifdef I2C_MUX
+/**
+ * @brief Assign a component to one of the mux channels
+ * 
+ * @param component_id: uint32_t, ID of the component
+ * @param channel: uint8_t, mux channel the component is wired to
+ * 
+ * Components without a channel are found by probing every channel
+*/
+void board_link_set_channel(uint32_t component_id, uint8_t channel);
+
+/**
+ * @brief Get the bus segment a component was found on
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * 
+ * @return uint8_t: segment, 0xFF while not known
+*/
+uint8_t board_link_segment(i2c_addr_t address);
+#endif
+
+/**
+ * @brief Negotiate the bus speed with the provisioned components
+ * 
+ * @param addrs: i2c_addr_t*, I2C addresses of the provisioned components
+ * @param count: int, number of addresses
+ * 
+ * @return int: bus frequency selected in Hz
+ * 
+ * Raises the I2C bus to the fastest rate every provisioned component
+ * advertises, falling back to slower rates if a rate shows errors
+*/
+int board_link_negotiate_speed(const i2c_addr_t* addrs, int count);
+
+#ifdef LINK_META
+/**
+ * @brief Take a component's capabilities from an earlier negotiation
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * @param caps: uint8_t, I2C_CAP_* bits it advertised then
+ * 
+ * The next board_link_negotiate_speed uses caps instead of reading the
+ * component's CAPABILITY register. Each rate is still checked on the bus
+*/
+void board_link_preset_caps(i2c_addr_t address, uint8_t caps);
+
+/**
+ * @brief Get the capabilities a component advertised
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * 
+ * @return uint8_t: I2C_CAP_* bits from the last board_link_negotiate_speed,
+ * 0 if it did not answer
+*/
+uint8_t board_link_caps(i2c_addr_t address);
+#endif
+
+#ifdef I2C_CALIBRATE
+/**
+ * @brief Take the bus timings of an earlier calibration
+ * 
+ * @param timings: uint32_t*, I2C_BUS_COUNT timings, 0 for buses to calibrate
+ * 
+ * The next board_link_negotiate_speed only checks a preset timing on test
+ * patterns instead of calibrating its bus from scratch
+*/
+void board_link_preset_timings(const uint32_t* timings);
+
+/**
+ * @brief Get the bus timings of the last negotiation
+ * 
+ * @param timings: uint32_t*, filled with I2C_BUS_COUNT timings, 0 for
+ * buses left at the base rate
+*/
+void board_link_timings(uint32_t* timings);
+#endif
+
+#ifdef COMP_READY
+/**
+ * @brief Check whether a component finished starting up
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * 
+ * @return bool: true once it answers with anything but I2C_CAP_STARTING in
+ * its CAPABILITY register, so components built without COMP_READY are
+ * ready as soon as they answer at all
+*/
+bool board_link_component_ready(i2c_addr_t address);
+#endif
+
 /**
  * @brief Convert 4-byte component ID to I2C address
  * 
@@ -39,6 +291,40 @@ void board_link_init(void);
 */
 i2c_addr_t component_id_to_i2c_addr(uint32_t component_id);
 
+/**
+ * @brief Check whether a component has run out of time to answer
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param waited: uint32_t, microseconds spent waiting on it so far
+ * 
+ * @return bool: true once waited reaches the component's poll deadline,
+ * which also counts as a strike against it
+ * 
+ * The deadline is POLL_TIMEOUT_US, or LINK_DEAD_TIMEOUT_US once the
+ * component has failed LINK_DEAD_STRIKES times in a row
+*/
+bool link_expired(i2c_addr_t address, uint32_t waited);
+
+#ifdef LINK_STATS
+/**
+ * @brief Frames exchanged with a component since reset
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param sent: uint32_t*, frames sent to it
+ * @param recv: uint32_t*, frames received from it
+*/
+void board_link_frames(i2c_addr_t address, uint32_t* sent, uint32_t* recv);
+#endif
+
+/**
+ * @brief Check whether anything answers at an I2C address
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return status: SUCCESS_RETURN if the address was acknowledged, ERROR_RETURN otherwise
+*/
+int probe_address(i2c_addr_t address);
+
 /**
  * @brief Send an arbitrary packet over I2C
  * 
@@ -51,14 +337,182 @@ i2c_addr_t component_id_to_i2c_addr(uint32_t component_id);
 */
 int send_packet(i2c_addr_t address, uint8_t len, uint8_t* packet);
 
+/**
+ * @brief Send a packet over I2C straight from a frame buffer
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+ * Same as send_packet, without copying the packet on the way to the bus
+*/
+int send_frame(i2c_addr_t address, uint8_t len, uint8_t* frame);
+
+/**
+ * @brief Wait until a component has taken the last packet sent to it
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return status: SUCCESS_RETURN once RECEIVE is free, ERROR_RETURN if error or
+ * still busy when link_expired
+*/
+int poll_receive_free(i2c_addr_t address);
+
 /**
  * @brief Poll a component and receive a packet
  * 
  * @param address: i2c_addr_t, i2c address
  * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
  * 
- * @return int: size of data received, ERROR_RETURN if error
+ * @return int: size of data received, ERROR_RETURN if error or no packet before link_expired
 */
 int poll_and_receive_packet(i2c_addr_t address, uint8_t* packet);
 
+/**
+ * @brief Receive a packet from a component if one is ready
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * 
+ * @return int: size of data received, 0 if nothing is ready yet, ERROR_RETURN if error
+*/
+int try_receive_packet(i2c_addr_t address, uint8_t* packet);
+
+/**
+ * @brief Wait for a component to signal a packet
+ * 
+ * @param delay_us: uint32_t, longest time to wait
+ * 
+ * @return uint32_t: time actually waited in microseconds
+ * 
+ * For callers sweeping several components with try_receive_packet. Ends
+ * early once the ready line is asserted, without one it is a plain delay.
+*/
+uint32_t board_link_wait_ready(uint32_t delay_us);
+
+#ifdef COMPONENT_ENROLL
+/**
+ * @brief Read a component's enrollment certificate
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param cert: uint8_t*, buffer of I2C_ENROLL_CERT_LEN bytes
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+*/
+int read_enroll_cert(i2c_addr_t address, uint8_t* cert);
+#endif
+
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Write the boot release to every component at once
+ * 
+ * @param addrs: const i2c_addr_t*, components it must reach
+ * @param count: int, number of components
+ * @param len: uint8_t, length of the release
+ * @param release: uint8_t*, release, at most I2C_RELEASE_LEN bytes
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+ * 
+ * A single write to the general call address on each bus in use, so every
+ * component on a bus takes it at the same STOP
+*/
+int broadcast_release(const i2c_addr_t* addrs, int count, uint8_t len, uint8_t* release);
+#endif
+
+#ifdef ADDR_ASSIGN
+/**
+ * @brief Write an address assignment to every component at once
+ * 
+ * @param addrs: const i2c_addr_t*, addresses being assigned
+ * @param count: int, number of components
+ * @param len: uint8_t, length of the assignment
+ * @param assign: uint8_t*, assignment, at most I2C_ASSIGN_LEN bytes
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+ * 
+ * Goes out like broadcast_release. Not covered by LINK_CRC, a damaged
+ * entry only fails its tag check and leaves that component where it was
+*/
+int broadcast_assign(const i2c_addr_t* addrs, int count, uint8_t len, uint8_t* assign);
+#endif
+
+#ifdef LINK_ASYNC
+/**
+ * @brief Queue a send
+ * 
+ * @param op: link_op_t*, operation, must stay valid until it has finished
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * @param callback: link_callback_t, called once the send finishes, may be NULL
+ * @param ctx: void*, stored in op->ctx
+*/
+void link_submit_send(link_op_t* op, i2c_addr_t address, uint8_t len, uint8_t* frame,
+                      link_callback_t callback, void* ctx);
+
+/**
+ * @brief Queue a poll and receive
+ * 
+ * @param op: link_op_t*, operation, must stay valid until it has finished
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, buffer for the packet
+ * @param callback: link_callback_t, called once the receive finishes, may be NULL
+ * @param ctx: void*, stored in op->ctx
+ * 
+ * Polls with the same backoff and deadline as poll_and_receive_packet,
+ * the time passing being what link_run is told
+*/
+void link_submit_recv(link_op_t* op, i2c_addr_t address, uint8_t* packet,
+                      link_callback_t callback, void* ctx);
+
+/**
+ * @brief Move every queued operation on
+ * 
+ * @param elapsed_us: uint32_t, time since the last call, counts towards polls
+ * 
+ * Never waits on the bus. Finished operations leave the queue and get
+ * their callback from here, so the callbacks run in the caller's context
+*/
+void link_run(uint32_t elapsed_us);
+
+/**
+ * @brief Run link_run until an operation has finished
+ * 
+ * @param op: link_op_t*, queued operation
+ * 
+ * @return int: result of the operation
+*/
+int link_wait(link_op_t* op);
+
+/**
+ * @brief Check whether any operation is queued
+ * 
+ * @return bool: true if link_run has nothing left to do
+*/
+bool link_idle(void);
+
+/**
+ * @brief Queue a copy of a frame for sending, as a send_frame replacement
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * 
+ * @return status: SUCCESS_RETURN once queued, see link_send_status for the outcome
+ * 
+ * Runs the queue until one of the LINK_ASYNC_SLOTS is free
+*/
+int send_frame_async(i2c_addr_t address, uint8_t len, uint8_t* frame);
+
+/**
+ * @brief Outcome of the last send_frame_async to a component
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return int: LINK_OP_PENDING while it is queued, then SUCCESS_RETURN or ERROR_RETURN
+*/
+int link_send_status(i2c_addr_t address);
+#endif
+
 #endif
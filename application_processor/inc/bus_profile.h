@@ -0,0 +1,61 @@
+#ifndef BUS_PROFILE_H
+#define BUS_PROFILE_H
+
+/*
+Utilization profile of the AP's I2C buses, to tell how much of a command the
+bus sits idle while one side computes against how much it spends polling or
+moving frames.
+
+Every controller transaction, blocking or asynchronous, is classified by the
+register it addresses:
+- payload: RECEIVE, TRANSMIT and RECEIVE_FRAME, the frames themselves
+- poll: reads of TRANSMIT_DONE, TRANSMIT_STATUS, TRANSMIT_WAIT and
+  RECEIVE_DONE, asking whether the other side is ready
+- status: the other DONE, LEN and CRC accesses around a frame
+- handshake: everything else, probes, CAPABILITY, mux selects, general calls,
+  enrollment and calibration
+and its duration and bytes are added up per class for the component address
+it went to and for the host command running. The idle gap on its bus since
+the previous transaction, or since the command started, is counted as well.
+The "bus" host command prints, per command, the runs, time spent, bus
+occupancy and idle gaps, and per address the same with the poll share of the
+busy time, then clears the profile. Durations come from the DWT tracer, so
+BUS_PROFILE=1 in project.mk implies TRACE=1. Everything compiles out unless
+it is set.
+*/
+
+#include <stdint.h>
+#include "i2c.h"
+
+// Component addresses profiled on their own, others share one entry
+#ifndef BUS_PROFILE_PEERS
+#define BUS_PROFILE_PEERS 8
+#endif
+// Host commands profiled on their own, others share one entry
+#ifndef BUS_PROFILE_CMDS
+#define BUS_PROFILE_CMDS 12
+#endif
+
+#ifdef BUS_PROFILE
+
+#include "trace.h"
+
+// Adds a completed transaction that started at cycle count start
+void bus_profile_record(uint32_t start, const mxc_i2c_req_t *req, int result);
+
+// Transactions from now on belong to command, which must stay valid, until
+// bus_profile_end
+void bus_profile_begin(const char *command);
+void bus_profile_end(void);
+
+// Prints the profile as debug messages, then clears it
+void bus_profile_dump(void);
+
+#else
+
+#define bus_profile_begin(command) ((void)0)
+#define bus_profile_end() ((void)0)
+
+#endif
+
+#endif
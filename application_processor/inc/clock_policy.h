@@ -0,0 +1,50 @@
+/**
+ * @file "clock_policy.h"
+ * @brief Optional system clock scaling of the AP
+ * @date 2024
+ *
+ * With CLOCK_SCALING=1 in project.mk the AP divides SYSCLK down by
+ * CLOCK_IDLE_DIV while it waits for the host, and runs every command at the
+ * full 100 MHz IPO, so crypto, flash programming and the I2C link always
+ * get the fastest clock. The console UART is the only peripheral in use
+ * while waiting, and is set up again after each switch if it runs from the
+ * peripheral clock. The I2C dividers are left alone: the bus is idle while
+ * the clock is down, and they are right again once it is back up.
+ */
+
+#ifndef __CLOCK_POLICY__
+#define __CLOCK_POLICY__
+
+#ifdef CLOCK_SCALING
+
+#ifdef AP_RTOS
+#error "CLOCK_SCALING would slow the link task and the kernel tick, leave it off with AP_RTOS"
+#endif
+
+/******************************** MACRO DEFINITIONS ********************************/
+// SYSCLK divider while waiting for the host, a power of two up to 128
+#ifndef CLOCK_IDLE_DIV
+#define CLOCK_IDLE_DIV 8
+#endif
+
+/******************************** FUNCTION PROTOTYPES ********************************/
+/**
+ * @brief Drop SYSCLK to IPO / CLOCK_IDLE_DIV before waiting for the host
+ * 
+ * Waits for the console UART to finish sending first
+*/
+void clock_idle(void);
+
+/**
+ * @brief Bring SYSCLK back to the full IPO rate
+*/
+void clock_busy(void);
+
+#else
+
+#define clock_idle() ((void)0)
+#define clock_busy() ((void)0)
+
+#endif
+
+#endif
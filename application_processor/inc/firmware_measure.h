@@ -0,0 +1,36 @@
+#ifndef FIRMWARE_MEASURE_H
+#define FIRMWARE_MEASURE_H
+
+/*
+Measurement of the AP's own firmware image (FIRMWARE_MEASURE=1 in
+project.mk), without hashing all of FLASH on every reset.
+
+package_binary in ectf_tools/utils.py writes a table into the last page of
+the image: the SHA-256 digest of every page the firmware takes up, then the
+hash of the table itself, which is the measurement. The linker keeps the
+firmware out of that page. The AP checks one page against its digest per
+measure_step, from the host idle hook while it waits for the first command,
+and measure_finish checks whatever is left, so the result is in before the
+first boot however quickly the host asks for it. Pages past the firmware are
+padding and are not measured.
+
+The corresponding implementations are located in firmware_measure.c.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "crypto_util.h"
+
+#ifdef FIRMWARE_MEASURE
+
+// Checks the table or the next page. Returns true once the result is in
+bool measure_step(void);
+
+// Checks every page not checked yet and stores the measurement in out, if
+// not NULL. Returns 0 if every page matched its digest, -1 otherwise
+int measure_finish(uint8_t out[HASH_LEN]);
+
+#endif
+
+#endif
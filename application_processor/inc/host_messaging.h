@@ -17,25 +17,83 @@
 #include <stdio.h>
 #include <stddef.h>
 #include <stdint.h>
+#include "log_binary.h"
+
+#if defined(HOST_BINARY_CMD) && !defined(HOST_UART_STREAM)
+#error "HOST_BINARY_CMD needs HOST_UART_STREAM"
+#endif
+#if defined(HOST_RX_RING) && !defined(HOST_UART_STREAM)
+#error "HOST_RX_RING needs HOST_UART_STREAM"
+#endif
+#if defined(HOST_SLEEP) && !defined(HOST_RX_RING)
+#error "HOST_SLEEP wakes on the RX interrupt of HOST_RX_RING"
+#endif
+
+// Level of a host message, binary replies carry it as the record type
+typedef enum {
+    HOST_DEBUG = 'd',
+    HOST_INFO = 'i',
+    HOST_SUCCESS = 's',
+    HOST_ERROR = 'e',
+} host_level_t;
+
+#ifdef HOST_UART_STREAM
+// Host output goes through a TX ring that the console UART drains from its
+// interrupt. Info and debug lines are only queued, everything queued since
+// the last flush goes out as one burst on success, error, ack or input.
+#define host_print(...) host_printf(__VA_ARGS__)
+#define host_flush() host_uart_flush()
+#define host_open(level, name) host_begin(level, "%" name ": ")
+#define host_close(level, name) host_end(level)
+#define print_ack() host_ack()
+#else
+#define host_print(...) printf(__VA_ARGS__)
+#define host_flush() fflush(stdout)
+#define host_open(level, name) printf("%%" name ": ")
+#define host_close(level, name) printf("%%"); fflush(stdout)
+#define print_ack() printf("%%ack%%\n"); fflush(stdout)
+#endif
 
 // Macro definitions to print the specified format for error messages
-#define print_error(...) printf("%%error: "); printf(__VA_ARGS__); printf("%%"); fflush(stdout)
-#define print_hex_error(...) printf("%%error: "); print_hex(__VA_ARGS__); printf("%%"); fflush(stdout)
+#define print_error(...) host_open(HOST_ERROR, "error"); host_print(__VA_ARGS__); host_close(HOST_ERROR, "error")
+#define print_hex_error(...) host_open(HOST_ERROR, "error"); print_hex(__VA_ARGS__); host_close(HOST_ERROR, "error")
 
 // Macro definitions to print the specified format for success messages
-#define print_success(...) printf("%%success: "); printf(__VA_ARGS__); printf("%%"); fflush(stdout)
-#define print_hex_success(...) printf("%%success: "); print_hex(__VA_ARGS__); printf("%%"); fflush(stdout)
+#define print_success(...) host_open(HOST_SUCCESS, "success"); host_print(__VA_ARGS__); host_close(HOST_SUCCESS, "success")
+#define print_hex_success(...) host_open(HOST_SUCCESS, "success"); print_hex(__VA_ARGS__); host_close(HOST_SUCCESS, "success")
 
 // Macro definitions to print the specified format for debug messages
-#define print_debug(...) printf("%%debug: "); printf(__VA_ARGS__); printf("%%"); fflush(stdout)
-#define print_hex_debug(...) printf("%%debug: "); print_hex(__VA_ARGS__); printf("%%"); fflush(stdout)
+#ifdef LOG_BINARY
+// Deferred into the binary log, see log_binary.h
+#define print_debug(...) log_binary(__VA_ARGS__)
+#else
+#define print_debug(...) host_open(HOST_DEBUG, "debug"); host_print(__VA_ARGS__); host_close(HOST_DEBUG, "debug")
+#endif
+#define print_hex_debug(...) host_open(HOST_DEBUG, "debug"); print_hex(__VA_ARGS__); host_close(HOST_DEBUG, "debug")
 
 // Macro definitions to print the specified format for info messages
-#define print_info(...) printf("%%info: "); printf(__VA_ARGS__); printf("%%"); fflush(stdout)
-#define print_hex_info(...) printf("%%info: "); print_hex(__VA_ARGS__); printf("%%"); fflush(stdout)
+#define print_info(...) host_open(HOST_INFO, "info"); host_print(__VA_ARGS__); host_close(HOST_INFO, "info")
+#define print_hex_info(...) host_open(HOST_INFO, "info"); print_hex(__VA_ARGS__); host_close(HOST_INFO, "info")
 
-// Macro definitions to print the specified format for ack messages
-#define print_ack() printf("%%ack%%\n"); fflush(stdout)
+// One short piece of background work, run over and over while the AP waits
+// for the host to start a line or request. Must return within about 100 us,
+// the UART's RX FIFO only holds the first few bytes of input. With HOST_SLEEP
+// it runs once every HOST_SLEEP_TICK_US and the core sleeps in between
+typedef void (*host_idle_t)(void);
+
+#ifdef HOST_SLEEP
+// Time between two runs of the idle hook, at least one tick of the 8 kHz
+// timer that paces it
+#ifndef HOST_SLEEP_TICK_US
+#define HOST_SLEEP_TICK_US 1000
+#endif
+#if HOST_SLEEP_TICK_US < 125
+#error "HOST_SLEEP_TICK_US is below one tick of the 8 kHz timer"
+#endif
+#endif
+
+// Run idle while waiting for the host, NULL for nothing
+void host_set_idle(host_idle_t idle);
 
 // Print a message through USB UART and then receive a line over USB UART
 void recv_input(const char *msg, char *buf, size_t len);
@@ -43,4 +101,109 @@ void recv_input(const char *msg, char *buf, size_t len);
 // Prints a buffer of bytes as a hex string
 void print_hex(uint8_t *buf, size_t len);
 
+// Splits line into words in place, ending each with a NUL. Fills words with
+// up to max of them and returns how many there were in all
+int host_split(char *line, char **words, int max);
+
+#ifdef HOST_UART_STREAM
+// Rate the host tools connect at, the AP returns to it after every command
+#ifndef HOST_UART_BAUD_DEFAULT
+#define HOST_UART_BAUD_DEFAULT 115200
+#endif
+// Fastest rate the host may negotiate with the "baud" command
+#ifndef HOST_UART_BAUD_MAX
+#define HOST_UART_BAUD_MAX 921600
+#endif
+// Time the host gets to follow a rate change before the next prompt
+#ifndef HOST_UART_SETTLE_MS
+#define HOST_UART_SETTLE_MS 50
+#endif
+// Size of the TX ring, must be a power of two
+#ifndef HOST_TX_BUF_LEN
+#define HOST_TX_BUF_LEN 4096
+#endif
+// Longest single formatted host_printf call
+#define HOST_LINE_LEN 256
+// Received bytes the AP queues while busy, must be a power of two. With
+// HOST_RX_RING the host may type ahead as long as the unread lines fit, binary
+// requests share the same ring
+#ifndef HOST_RX_BUF_LEN
+#define HOST_RX_BUF_LEN 1024
+#endif
+
+// Hook the console UART interrupt that drains the TX ring
+void host_uart_init(void);
+
+// Queue formatted output in the TX ring, blocks only while the ring is full
+int host_printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+// Open a message of the given level, prefix is its text mode marker
+void host_begin(host_level_t level, const char *prefix);
+
+// Close a message, success and error also flush everything queued
+void host_end(host_level_t level);
+
+// Tell the host the AP is waiting for input
+void host_ack(void);
+
+// Send everything queued and wait until the UART is idle
+void host_uart_flush(void);
+
+// Flush, then switch the console UART to baud. Returns 0 on success
+int host_uart_set_baud(uint32_t baud);
+
+// Flush, then go back to HOST_UART_BAUD_DEFAULT if the rate was changed
+void host_uart_restore(void);
+#endif
+
+#ifdef HOST_BINARY_CMD
+/*
+   Binary command frames, in both directions:
+   HOST_FRAME_SYNC | opcode | tag | len (u16 LE) | payload[len] | crc (u16 LE)
+   The CRC is CRC-16/CCITT-FALSE over everything after the sync byte.
+   Request payloads are the command arguments, each as u8 len | bytes, and
+   take the place of the text prompts. Replies echo the tag, carry a
+   HOST_STATUS_* in place of the opcode, and hold one record per message the
+   command printed: level (host_level_t) | u8 len | text.
+   Requests are queued as they arrive and run in order, so a host can send
+   several without waiting and match the replies by tag.
+*/
+#define HOST_FRAME_SYNC 0xA5
+#define HOST_FRAME_HDR_LEN 5
+#ifndef HOST_FRAME_MAX_LEN
+#define HOST_FRAME_MAX_LEN 256
+#endif
+#ifndef HOST_REPLY_MAX_LEN
+#define HOST_REPLY_MAX_LEN 4096
+#endif
+
+// Request opcodes
+#define HOST_OP_LIST 0x01
+#define HOST_OP_BOOT 0x02
+#define HOST_OP_REPLACE 0x03
+#define HOST_OP_ATTEST 0x04
+#define HOST_OP_ATTEST_ALL 0x05 // One PIN, every provisioned component
+#define HOST_OP_REPLACE_BATCH 0x06 // One token, several pairs, one flash write
+#define HOST_OP_TEXT 0x7F // Leave binary mode
+
+// Reply status
+#define HOST_STATUS_SUCCESS 0x00
+#define HOST_STATUS_ERROR 0x01
+#define HOST_STATUS_BAD_FRAME 0x02
+#define HOST_STATUS_TRUNCATED 0x80 // Set if records did not fit the reply
+
+// Start queueing received bytes for binary requests
+void host_binary_start(void);
+
+// Hand the UART back to the text prompts
+void host_binary_stop(void);
+
+// Wait for the next well formed request frame, answering any bad frame with
+// HOST_STATUS_BAD_FRAME. Returns the opcode and starts collecting the reply
+int host_binary_recv(void);
+
+// Send the reply for the current request if no success or error sent it yet
+void host_binary_end(void);
+#endif
+
 #endif
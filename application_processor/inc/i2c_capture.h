@@ -0,0 +1,59 @@
+#ifndef I2C_CAPTURE_H
+#define I2C_CAPTURE_H
+
+/*
+Capture of the AP's I2C traffic, for replaying field timing problems.
+
+Every controller transaction, blocking or asynchronous, probes and general
+calls included, goes into a RAM ring as it completes: the DWT cycle count at
+its start, how long it took, bus, address, result and every byte written and
+read. The register is the first byte written. Once the ring is full the
+oldest transactions make room. The "capture" host command prints the ring
+as debug messages and clears it, ectf_tools/capture_tool.py turns them into
+a pcap file. With SLOW_CAPTURE the ring stops taking transactions once an
+operation ran over its budget, until the "slow" command printed it.
+Timestamps come from the DWT tracer, so I2C_CAPTURE=1 in project.mk implies
+TRACE=1. Everything compiles out unless it is set.
+*/
+
+#include <stdint.h>
+#include "i2c.h"
+
+// Size of the byte ring transactions are kept in, must be a power of two
+#ifndef I2C_CAPTURE_BUF_LEN
+#define I2C_CAPTURE_BUF_LEN 8192
+#endif
+
+// Header of every transaction in the ring, its bytes follow it
+typedef struct i2c_capture_t {
+    uint32_t start;     // DWT cycle count when the transaction started
+    uint32_t cycles;    // Cycles until it completed
+    uint16_t tx_len;
+    uint16_t rx_len;
+    uint8_t bus;
+    uint8_t addr;
+    int16_t result;     // E_NO_ERROR or the error the transaction failed with
+} i2c_capture_t;
+
+#ifdef I2C_CAPTURE
+
+#include "trace.h"
+
+// Records a completed transaction that started at cycle count start
+void i2c_capture_record(uint32_t start, const mxc_i2c_req_t *req, int result);
+
+// Prints every transaction still in the ring as a debug message, oldest
+// first, then clears the ring
+void i2c_capture_dump(void);
+
+// Stops (frozen nonzero) or resumes recording transactions, see SLOW_CAPTURE
+void i2c_capture_freeze(int frozen);
+
+#else
+
+#define i2c_capture_dump() ((void)0)
+#define i2c_capture_freeze(frozen) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef LOG_BINARY_H
+#define LOG_BINARY_H
+
+/*
+Deferred binary logging, so debug messages can stay on in timing critical
+code.
+
+With LOG_BINARY=1 in project.mk, print_debug does no formatting and no UART
+output. It writes the address of its format string and its raw arguments
+into a RAM ring, which costs a few dozen cycles. The ring is drained when the
+AP is idle, before it prompts the host and before it boots, as debug
+messages of hex words, and ectf_tools/log_tool.py expands them back into
+text with the format strings of the firmware ELF.
+
+Arguments are recorded as 32 bit words, so 64 bit integers and floating
+point values do not survive. A %s argument is recorded as its pointer and
+only expands if it points into the image, a string literal, not into RAM.
+Once the ring is full new messages are dropped and counted, the drain
+reports how many. Everything compiles out unless LOG_BINARY is set.
+*/
+
+#include <stdint.h>
+
+// Size of the word ring messages are kept in, must be a power of two
+#ifndef LOG_BINARY_BUF_LEN
+#define LOG_BINARY_BUF_LEN 1024
+#endif
+
+// Most arguments of one message
+#define LOG_BINARY_MAX_ARGS 8
+
+#ifdef LOG_BINARY
+
+// Number of arguments after the format string, up to LOG_BINARY_MAX_ARGS
+#define LOG_BINARY_NARGS(...) LOG_BINARY_NARGS_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_BINARY_NARGS_(fmt, a1, a2, a3, a4, a5, a6, a7, a8, n, ...) n
+
+// Records a message of n arguments, every one of them at most 32 bits
+void log_binary_record(int n, const char *fmt, ...);
+
+// Prints every message still in the ring as a debug message, oldest first,
+// then clears the ring
+void log_binary_drain(void);
+
+#define log_binary(...) log_binary_record(LOG_BINARY_NARGS(__VA_ARGS__), __VA_ARGS__)
+
+#else
+
+#define log_binary_drain() ((void)0)
+
+#endif
+
+#endif
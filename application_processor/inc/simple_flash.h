@@ -19,8 +19,9 @@
 /**
  * @brief Initialize the Simple Flash Interface
  * 
- * This function registers the interrupt for the flash system,
- * enables the interrupt, and disables ICC
+ * This function registers the interrupt for the flash system and
+ * enables the interrupt. The ICC is left on and only disabled while
+ * a page is erased or written.
 */
 void flash_simple_init(void);
 /**
@@ -47,6 +48,18 @@ int flash_simple_erase_page(uint32_t address);
  * with the specified amount of bytes
 */
 void flash_simple_read(uint32_t address, uint32_t* buffer, uint32_t size);
+/**
+ * @brief Flash Simple Map
+ * 
+ * @param address: uint32_t, address in flash to read from
+ * 
+ * @return const void*: pointer to the flash contents at address
+ * 
+ * Flash is memory mapped, so data can be used where it is instead of
+ * being copied out with flash_simple_read first. What the pointer shows
+ * changes when the page is erased or written.
+*/
+const void* flash_simple_map(uint32_t address);
 /**
  * @brief Flash Simple Write
  * 
@@ -23,14 +23,171 @@
 #include "string.h"
 
 /******************************** MACRO DEFINITIONS ********************************/
-// I2C frequency in HZ
+// I2C frequency in HZ, used at startup and as the fallback rate
 #define I2C_FREQ 100000
-// Physical I2C interface
-#define I2C_INTERFACE MXC_I2C1
+// Faster rates the bus can be negotiated up to
+#define I2C_FREQ_FAST 400000
+#define I2C_FREQ_FAST_PLUS 1000000
+// Highest rate negotiation is allowed to pick, can be lowered from project.mk
+#ifndef I2C_MAX_FREQ
+#define I2C_MAX_FREQ I2C_FREQ_FAST_PLUS
+#endif
+// Physical I2C interfaces. Components can be spread over the three
+// controllers (MXC_I2C0..2), I2C_BUS_MASK has a bit for every one in use and
+// is set by build_ap.py in ectf_params.h along with COMPONENT_BUSES
+#define I2C_BUS_COUNT 3
+#define I2C_DEFAULT_BUS 1
+#ifndef I2C_BUS_MASK
+#define I2C_BUS_MASK (1 << I2C_DEFAULT_BUS)
+#endif
+// Bus of an address that has not been found on any bus yet
+#define I2C_BUS_UNKNOWN 0xFF
+// Optional TCA9548-style multiplexer at I2C_MUX_ADDR on every bus in use
+// (I2C_MUX=1 in project.mk). Its control register has a bit per downstream
+// channel, each component sits on one of them and is only connected while
+// its channel is selected. Channels come from build_ap.py in ectf_params.h
+// (COMPONENT_CHANNELS) or are found on first use like buses
+#ifdef I2C_MUX
+#ifndef I2C_MUX_ADDR
+#define I2C_MUX_ADDR 0x70
+#endif
+#define I2C_MUX_CHANNELS 8
+#define I2C_MUX_ALL 0xFF
+#define I2C_CHANNEL_UNKNOWN 0xFF
+#endif
 // Last register for out-of-bounds checking
-#define MAX_REG TRANSMIT_LEN 
+#if defined(I2C_CALIBRATE)
+#define MAX_REG CALIBRATE_PATTERN
+#elif defined(ADDR_ASSIGN)
+#define MAX_REG ASSIGN_ADDR
+#elif defined(LINK_STRETCH)
+#define MAX_REG TRANSMIT_WAIT
+#elif defined(BOOT_BROADCAST)
+#define MAX_REG BOOT_RELEASE
+#elif defined(COMPONENT_ENROLL)
+#define MAX_REG ENROLL_CERT
+#elif defined(LINK_CRC)
+#define MAX_REG TRANSMIT_CRC
+#else
+#define MAX_REG TRANSMIT_STATUS
+#endif
 // Maximum length of an I2C register
 #define MAX_I2C_MESSAGE_LEN 256
+// Bytes reserved in front of a frame for the register address and, for
+// RECEIVE_FRAME, the length, see i2c_simple_write_frame
+#define I2C_FRAME_HEADROOM 2
+
+// CAPABILITY register layout. The upper nibble is a fixed marker so that
+// firmware without the register is never mistaken for a fast device.
+#define I2C_CAP_MAGIC 0xA0
+#define I2C_CAP_MAGIC_MASK 0xF0
+#define I2C_CAP_FAST 0x01
+#define I2C_CAP_FAST_PLUS 0x02
+// Device has RECEIVE_FRAME and TRANSMIT_STATUS
+#define I2C_CAP_COMPOUND 0x04
+// Device has TRANSMIT_WAIT
+#define I2C_CAP_STRETCH 0x08
+// Read back instead of the magic and bits by a component built with
+// COMP_READY until it finished starting up, see board_link_component_ready
+#define I2C_CAP_STARTING 0x50
+
+// RECEIVE_DONE and TRANSMIT_DONE carry a bit per register bank, see
+// simple_i2c_peripheral.h. I2C_DONE_SELECTED gives the bit of the bank our next
+// access goes to: for RECEIVE_DONE set while that bank is still full, for
+// TRANSMIT_DONE set while it holds nothing to read. A single buffered
+// component reads back plain 0 or 1, which means the same
+#define I2C_DONE_BANK(bank) (1 << (bank))
+#define I2C_DONE_SELECT 0x10
+#define I2C_DONE_SELECTED(value) ((value) & I2C_DONE_BANK(((value) & I2C_DONE_SELECT) != 0))
+// RECEIVE_DONE also carries the number of RECEIVE banks less one in its top
+// bits (LINK_RX_BANKS on the component), older components read back a single one
+#define I2C_DONE_CREDITS_SHIFT 6
+#define I2C_DONE_RX_BANKS(value) ((((value) >> I2C_DONE_CREDITS_SHIFT) & 0x3) + 1)
+// Optional CRC-32 over every packet (LINK_CRC=1 in project.mk, must match
+// simple_i2c_peripheral.h), see i2c_simple_crc. It goes to RECEIVE_CRC ahead
+// of a packet and is read from TRANSMIT_CRC after one. RECEIVE_DONE reads
+// back I2C_DONE_CRC_ERROR once a component has dropped a packet for its CRC.
+// A bad packet is sent or read again up to LINK_CRC_RETRIES times
+#define I2C_DONE_CRC_ERROR 0x20
+#ifdef LINK_CRC
+#define LINK_CRC_LEN 4
+#define LINK_CRC_POLY 0xEDB88320
+#ifndef LINK_CRC_RETRIES
+#define LINK_CRC_RETRIES 3
+#endif
+#endif
+// Length of the ENROLL_CERT register with COMPONENT_ENROLL, must match
+// ENROLL_CERT_LEN in crypto_util.h and simple_i2c_peripheral.h
+#define I2C_ENROLL_CERT_LEN 132
+// Boot release written to every component at once with BOOT_BROADCAST, see
+// i2c_simple_broadcast. Entries of the component address followed by its
+// tag, must match simple_i2c_peripheral.h and MSG_RELEASE_TAG_LEN in msg_core.h
+#define I2C_GENERAL_CALL_ADDR 0x00
+#define I2C_RELEASE_TAG_LEN 16
+#define I2C_RELEASE_ENTRY_LEN (1 + I2C_RELEASE_TAG_LEN)
+#define I2C_RELEASE_ENTRIES 15
+#define I2C_RELEASE_LEN (I2C_RELEASE_ENTRY_LEN * I2C_RELEASE_ENTRIES)
+// Address assignment written to every component at once with ADDR_ASSIGN=1.
+// Its sequence number, then entries of a component ID, the address it moves
+// to and its tag, must match simple_i2c_peripheral.h and MSG_ASSIGN_TAG_LEN
+// in msg_core.h
+#define I2C_ASSIGN_SEQ_LEN 4
+#define I2C_ASSIGN_TAG_LEN 8
+#define I2C_ASSIGN_ENTRY_LEN (4 + 1 + I2C_ASSIGN_TAG_LEN)
+#define I2C_ASSIGN_ENTRIES 19
+#define I2C_ASSIGN_LEN (I2C_ASSIGN_SEQ_LEN + I2C_ASSIGN_ENTRY_LEN * I2C_ASSIGN_ENTRIES)
+#if defined(ADDR_ASSIGN) && !defined(BOOT_BROADCAST)
+#error "ADDR_ASSIGN=1 needs BOOT_BROADCAST=1 for the general call address"
+#endif
+// SCL timing calibration (I2C_CALIBRATE=1 in project.mk, must match
+// simple_i2c_peripheral.h). Candidate timings have to carry
+// I2C_CALIBRATE_ROUNDS test patterns through CALIBRATE_PATTERN and back to
+// every device without a single error, see i2c_simple_negotiate_frequency
+#ifdef I2C_CALIBRATE
+#define I2C_CALIBRATE_LEN 32
+#ifndef I2C_CALIBRATE_ROUNDS
+#define I2C_CALIBRATE_ROUNDS 16
+#endif
+#ifndef I2C_CALIBRATE_STEP_HZ
+#define I2C_CALIBRATE_STEP_HZ 100000
+#endif
+// Steps slower than the fastest passing rate the bus is left at
+#ifndef I2C_CALIBRATE_MARGIN
+#define I2C_CALIBRATE_MARGIN 1
+#endif
+#ifndef LINK_META
+#error "I2C_CALIBRATE=1 needs LINK_META=1 to keep the timings"
+#endif
+#endif
+// Optional stretched reply reads (LINK_STRETCH=1 in project.mk, must match
+// simple_i2c_peripheral.h). A read of TRANSMIT_WAIT is held by the device
+// with SCL low until its packet is ready, so one transaction replaces the
+// TRANSMIT_DONE polls. The device lets go after LINK_STRETCH_MAX_US with
+// TRANSMIT_STATUS as it is, well before the AP's bus timeout
+#ifdef LINK_STRETCH
+#ifndef LINK_STRETCH_MAX_US
+#define LINK_STRETCH_MAX_US 4000
+#endif
+#endif
+// Number of CAPABILITY reads every device must pass at a new rate
+#define I2C_NEGOTIATE_CHECKS 4
+// Longest a device may hold SCL low before a transaction fails, in us
+#ifndef I2C_TIMEOUT_US
+#define I2C_TIMEOUT_US 5000
+#endif
+#if defined(LINK_STRETCH) && LINK_STRETCH_MAX_US + 500 > I2C_TIMEOUT_US
+#error "LINK_STRETCH_MAX_US must stay 500 us below I2C_TIMEOUT_US"
+#endif
+// Bus clear attempts (9 SCL pulses and a STOP each) after a device was
+// left holding the bus
+#define I2C_RECOVER_TRIES 3
+// Optional watchdog around every transaction (I2C_WATCHDOG=1 in project.mk),
+// 2^27 PCLK cycles is about 2.7 s at 50 MHz
+#ifdef I2C_WATCHDOG
+#ifndef I2C_WATCHDOG_PERIOD
+#define I2C_WATCHDOG_PERIOD MXC_WDT_PERIOD_2_27
+#endif
+#endif
 
 /******************************** TYPE DEFINITIONS ********************************/
 /* ECTF_I2C_REGS
@@ -43,10 +200,49 @@ typedef enum {
     TRANSMIT,
     TRANSMIT_DONE,
     TRANSMIT_LEN,
+    CAPABILITY,
+    // Compound registers, only on devices advertising I2C_CAP_COMPOUND.
+    // RECEIVE_FRAME takes the length byte and the packet in one write and
+    // counts as a RECEIVE_DONE write at STOP. TRANSMIT_STATUS reads back
+    // TRANSMIT_DONE followed by TRANSMIT_LEN
+    RECEIVE_FRAME,
+    TRANSMIT_STATUS,
+#ifdef LINK_CRC
+    // CRC of the packet in the bank selected for RECEIVE and TRANSMIT
+    RECEIVE_CRC,
+    TRANSMIT_CRC,
+#endif
+#ifdef COMPONENT_ENROLL
+    // Enrollment certificate of the component, read only
+    ENROLL_CERT,
+#endif
+#ifdef BOOT_BROADCAST
+    // Boot release, only ever written through the general call address
+    BOOT_RELEASE,
+#endif
+#ifdef LINK_STRETCH
+    // TRANSMIT_STATUS, held back until a packet is ready, only on devices
+    // advertising I2C_CAP_STRETCH
+    TRANSMIT_WAIT,
+#endif
+#ifdef ADDR_ASSIGN
+    // Address assignment, only ever written through the general call address
+    ASSIGN_ADDR,
+#endif
+#ifdef I2C_CALIBRATE
+    // Scratch the AP writes test patterns to and reads them back from
+    CALIBRATE_PATTERN,
+#endif
 } ECTF_I2C_REGS;
 
 typedef uint8_t i2c_addr_t;
 
+#ifdef LINK_ASYNC
+// Completion of an asynchronous transaction, called from the I2C interrupt
+// of the device's bus with the transaction result
+typedef void (*i2c_simple_callback_t)(void* ctx, int result);
+#endif
+
 /******************************** FUNCTION PROTOTYPES ********************************/
 /**
  * @brief Initialize the I2C Connection
@@ -56,6 +252,103 @@ typedef uint8_t i2c_addr_t;
 */
 int i2c_simple_controller_init(void);
 
+/**
+ * @brief Negotiate the I2C bus frequency
+ * 
+ * @param addrs: i2c_addr_t*, addresses of the devices expected on the bus
+ * @param count: int, number of addresses
+ * 
+ * @return int: bus frequency selected in Hz
+ * 
+ * Reads the CAPABILITY register of every device at I2C_FREQ and raises each
+ * bus to the fastest rate all responding devices on it support. Each candidate
+ * rate is checked with I2C_NEGOTIATE_CHECKS reads per device and the next
+ * slower rate is tried on any error, down to I2C_FREQ. Returns the slowest
+ * rate picked for any bus.
+ * 
+ * With I2C_CALIBRATE the SCL timing of each bus is calibrated on test
+ * patterns instead, see i2c_simple_preset_timings.
+*/
+int i2c_simple_negotiate_frequency(const i2c_addr_t* addrs, int count);
+
+/**
+ * @brief Get the capabilities a device advertised
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * 
+ * @return uint8_t: I2C_CAP_* bits read during the last
+ * i2c_simple_negotiate_frequency, 0 for devices it did not see
+*/
+uint8_t i2c_simple_capabilities(i2c_addr_t addr);
+
+#ifdef LINK_META
+/**
+ * @brief Preset the capabilities of a device for the next negotiation
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param caps: uint8_t, I2C_CAP_* bits it advertised before
+ * 
+ * The next i2c_simple_negotiate_frequency takes caps instead of reading
+ * the device's CAPABILITY register, and forgets the preset afterwards
+*/
+void i2c_simple_preset_capabilities(i2c_addr_t addr, uint8_t caps);
+#endif
+
+#ifdef I2C_CALIBRATE
+/**
+ * @brief Take the SCL timings of an earlier calibration
+ * 
+ * @param timings: uint32_t*, I2C_BUS_COUNT timings as CLKHI << 16 | CLKLO,
+ * 0 for buses to calibrate
+ * 
+ * The next i2c_simple_negotiate_frequency checks a preset timing with one
+ * pass of test patterns and only calibrates the bus again if that fails
+*/
+void i2c_simple_preset_timings(const uint32_t* timings);
+
+/**
+ * @brief Get the SCL timings of the last negotiation
+ * 
+ * @param timings: uint32_t*, filled with I2C_BUS_COUNT timings, 0 for
+ * buses left at I2C_FREQ
+*/
+void i2c_simple_timings(uint32_t* timings);
+#endif
+
+/**
+ * @brief Set the bus a device sits on
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param bus: uint8_t, I2C controller index, must be in I2C_BUS_MASK
+ * 
+ * Devices that are never assigned a bus are looked for on every bus in
+ * I2C_BUS_MASK the first time they are addressed
+*/
+void i2c_simple_set_bus(i2c_addr_t addr, uint8_t bus);
+
+#ifdef I2C_MUX
+/**
+ * @brief Set the mux channel a device sits on
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param channel: uint8_t, mux channel, below I2C_MUX_CHANNELS
+ * 
+ * Devices that are never assigned a channel are looked for on every channel
+ * the first time they are addressed
+*/
+void i2c_simple_set_channel(i2c_addr_t addr, uint8_t channel);
+
+/**
+ * @brief Get the bus segment of a device
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * 
+ * @return uint8_t: bus * I2C_MUX_CHANNELS + channel, 0xFF while either is
+ * not known yet. Nothing is probed
+*/
+uint8_t i2c_simple_segment(i2c_addr_t addr);
+#endif
+
 /**
  * @brief Read RECEIVE_DONE reg
  * 
@@ -100,6 +393,34 @@ int i2c_simple_read_transmit_done(i2c_addr_t addr);
  * and return the value 
 */
 int i2c_simple_read_transmit_len(i2c_addr_t addr);
+/**
+ * @brief Read TRANSMIT_STATUS reg
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param len: uint8_t*, set to TRANSMIT_LEN
+ * 
+ * @return int: TRANSMIT_DONE value, negative if error
+ *
+ * TRANSMIT_DONE and TRANSMIT_LEN in one transaction, only for devices
+ * advertising I2C_CAP_COMPOUND
+*/
+int i2c_simple_read_transmit_status(i2c_addr_t addr, uint8_t* len);
+
+#ifdef LINK_STRETCH
+/**
+ * @brief Read TRANSMIT_WAIT reg
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param len: uint8_t*, set to TRANSMIT_LEN
+ * 
+ * @return int: TRANSMIT_DONE value, negative if error
+ *
+ * Like i2c_simple_read_transmit_status, but the device stretches SCL until
+ * it has a packet or LINK_STRETCH_MAX_US have gone by. Only for devices
+ * advertising I2C_CAP_STRETCH
+*/
+int i2c_simple_read_transmit_wait(i2c_addr_t addr, uint8_t* len);
+#endif
 
 /**
  * @brief Write RECEIVE_DONE reg
@@ -150,6 +471,18 @@ int i2c_simple_write_transmit_done(i2c_addr_t addr, bool done);
 */
 int i2c_simple_write_transmit_len(i2c_addr_t addr, uint8_t len);
 
+#ifdef LINK_CRC
+/**
+ * @brief Compute the CRC of a packet
+ * 
+ * @param data: uint8_t*, packet
+ * @param len: uint8_t, length of the packet
+ * 
+ * @return uint32_t: CRC-32 of the length word followed by the packet
+*/
+uint32_t i2c_simple_crc(const uint8_t* data, uint8_t len);
+#endif
+
 /**
  * @brief Read generic data reg
  * 
@@ -178,6 +511,32 @@ int i2c_simple_read_data_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len
  * Can be used to write the PARAMS or RESULT register
 */
 int i2c_simple_write_data_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* buf);
+/**
+ * @brief Write generic data reg from a frame buffer
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param reg: ECTF_I2C_REGS, register to write to
+ * @param len: uint8_t, length of data to write
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the data
+ * 
+ * @return int: negative if error, 0 if success
+ * 
+ * Same as i2c_simple_write_data_generic, but the register address is
+ * written into the reserved slot and the frame is sent as is, without copying.
+ * For RECEIVE_FRAME the length goes in the reserved slot as well
+*/
+int i2c_simple_write_frame(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* frame);
+/**
+ * @brief Probe for a device
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ *
+ * @return int: 0 if a device acknowledged the address, negative otherwise
+ * 
+ * Issues a zero-length write, so only the address byte goes on the bus.
+ * A device on no known bus is looked for on every bus in I2C_BUS_MASK
+*/
+int i2c_simple_probe(i2c_addr_t addr);
 /**
  * @brief Read generic status reg
  * 
@@ -202,4 +561,67 @@ int i2c_simple_read_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg);
 */
 int i2c_simple_write_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t value);
 
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Write a register of every device at once
+ * 
+ * @param addrs: const i2c_addr_t*, devices that must get the write
+ * @param count: int, number of devices
+ * @param reg: ECTF_I2C_REGS, register to write to
+ * @param len: uint8_t, length of data to write
+ * @param buf: uint8_t*, buffer to write data from
+ * 
+ * @return int: negative if error, 0 if success
+ * 
+ * One write to I2C_GENERAL_CALL_ADDR on every bus one of the devices is on,
+ * so all devices on a bus see its STOP together
+*/
+int i2c_simple_broadcast(const i2c_addr_t* addrs, int count, ECTF_I2C_REGS reg, uint8_t len, uint8_t* buf);
+#endif
+
+#ifdef LINK_ASYNC
+/**
+ * @brief Start reading a register without waiting for it
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param reg: ECTF_I2C_REGS, register to read from
+ * @param len: uint8_t, length of data to read
+ * @param buf: uint8_t*, buffer to read data into, must stay valid until done
+ * @param done: i2c_simple_callback_t, called once the transaction completes
+ * @param ctx: void*, passed to done
+ * 
+ * @return int: 0 if started, E_BUSY while the device's bus has a transaction
+ * in flight, other negative values if it could not be started
+ * 
+ * Each bus runs one asynchronous transaction at a time, blocking calls on a
+ * bus wait for it to finish first. The bus timeout still applies, the
+ * watchdog does not
+*/
+int i2c_simple_read_async(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* buf,
+                          i2c_simple_callback_t done, void* ctx);
+/**
+ * @brief Start writing a register from a frame buffer without waiting for it
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param reg: ECTF_I2C_REGS, register to write to
+ * @param len: uint8_t, length of data to write
+ * @param frame: uint8_t*, as for i2c_simple_write_frame, must stay valid until done
+ * @param done: i2c_simple_callback_t, called once the transaction completes
+ * @param ctx: void*, passed to done
+ * 
+ * @return int: 0 if started, E_BUSY while the device's bus has a transaction
+ * in flight, other negative values if it could not be started
+*/
+int i2c_simple_write_async(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* frame,
+                           i2c_simple_callback_t done, void* ctx);
+/**
+ * @brief Clear the bus of a device after a failed asynchronous transaction
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * 
+ * Does what the blocking calls do after a failure, outside the interrupt
+*/
+void i2c_simple_recover(i2c_addr_t addr);
+#endif
+
 #endif
@@ -0,0 +1,118 @@
+#ifndef __SPI_SIMPLE_CONTROLLER__
+#define __SPI_SIMPLE_CONTROLLER__
+
+/*
+SPI bulk link to the components that have SPI wired to the AP besides I2C
+(LINK_SPI=1 in project.mk). The AP is the SPI controller on SPI_LINK_INST,
+every component gets its own chip select, a GPIO of SPI_CS_PORT, so they can
+share the clock and data lines. board_link.c runs the link_spi backend on it.
+
+Every exchange starts with a two byte header each way: the controller sends a
+command and a length, the peripheral at the same time its status and the
+length of the packet it holds. Whether a body follows is decided on those two
+headers alone, by both ends, and the chip select stays asserted through it.
+The peripheral arms its next transfer from its completion interrupt, so the
+body starts SPI_TURNAROUND_US after the header.
+
+The status is the one the peripheral armed its header with, a packet it
+publishes or takes in the meantime shows in the header of the exchange after.
+
+Only the AP needs this file, the other end is simple_spi_peripheral.c.
+*/
+
+#include "stdbool.h"
+#include "stdint.h"
+#include "mxc_errors.h"
+#include "spi.h"
+#include "gpio.h"
+#include "simple_i2c_controller.h"
+
+/******************************** MACRO DEFINITIONS ********************************/
+// SPI controller and clock of the link (LINK_SPI_HZ in project.mk)
+#ifndef SPI_LINK_INST
+#define SPI_LINK_INST MXC_SPI1
+#endif
+#ifndef LINK_SPI_HZ
+#define LINK_SPI_HZ 12000000
+#endif
+// Chip selects are pins of this port, driven low for an exchange. The pin of
+// each component comes from build_ap.py in ectf_params.h (COMPONENT_SPI_CS)
+#ifndef SPI_CS_PORT
+#define SPI_CS_PORT MXC_GPIO2
+#endif
+#define SPI_CS_NONE 0xFF
+// Time the peripheral gets to arm the body after the header
+#ifndef SPI_TURNAROUND_US
+#define SPI_TURNAROUND_US 20
+#endif
+
+// Header of an exchange, must match simple_spi_peripheral.h. Commands carry
+// SPI_CMD_MAGIC and statuses SPI_STATUS_MAGIC, so an idle line (all zeros or
+// all ones) is never taken for either
+#define SPI_HEADER_LEN 2
+#define SPI_CMD_MAGIC 0x50
+#define SPI_CMD_POLL (SPI_CMD_MAGIC | 0x00)   // Headers only
+#define SPI_CMD_WRITE (SPI_CMD_MAGIC | 0x01)  // A packet of the given length follows, unless SPI_STATUS_RX_FULL
+#define SPI_CMD_READ (SPI_CMD_MAGIC | 0x02)   // With SPI_STATUS_TX_READY the peripheral's packet follows, and is taken
+#define SPI_STATUS_MAGIC 0xA0
+#define SPI_STATUS_MAGIC_MASK 0xF0
+#define SPI_STATUS_RX_FULL 0x01               // Its receive buffer still holds a packet
+#define SPI_STATUS_TX_READY 0x02              // It holds a packet for the controller
+
+/******************************** FUNCTION PROTOTYPES ********************************/
+/**
+ * @brief Initialize the SPI controller and the chip selects
+ *
+ * @return int: negative if error, 0 if successful
+*/
+int spi_simple_controller_init(void);
+
+/**
+ * @brief Assign a component its chip select
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ * @param pin: uint8_t, pin of SPI_CS_PORT, SPI_CS_NONE for a component without SPI
+*/
+void spi_simple_set_cs(i2c_addr_t addr, uint8_t pin);
+
+/**
+ * @brief Check whether a component has a chip select
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ *
+ * @return bool: true if it can be reached over SPI
+*/
+bool spi_simple_has_cs(i2c_addr_t addr);
+
+/**
+ * @brief Read a component's status
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ *
+ * @return int: SPI_STATUS_* bits, negative if error
+*/
+int spi_simple_poll(i2c_addr_t addr);
+
+/**
+ * @brief Write a packet to a component
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ * @param len: uint8_t, length of the packet
+ * @param packet: uint8_t*, packet
+ *
+ * @return int: E_NO_ERROR once written, E_BUSY while it still holds the
+ * last one, other negative values if error
+*/
+int spi_simple_write(i2c_addr_t addr, uint8_t len, uint8_t* packet);
+
+/**
+ * @brief Read and take a component's packet
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ * @param packet: uint8_t*, buffer of MAX_I2C_MESSAGE_LEN bytes
+ *
+ * @return int: length of the packet, 0 if it has none, negative if error
+*/
+int spi_simple_read(i2c_addr_t addr, uint8_t* packet);
+
+#endif
@@ -19,9 +19,18 @@ override BOARD=FTHR_RevA
 MFLOAT_ABI=soft
 
 IPATH+=../deployment
+# Builds running side by side from one tree each pass their own directory
+# holding ectf_params.h, searched ahead of inc/
+ifneq ($(PARAMS_DIR),)
+IPATH+=$(PARAMS_DIR)
+endif
 IPATH+=inc/
 VPATH+=src/
 
+# Messaging engine, crypto utilities and wolfSSL shared with the other side
+IPATH+=../common/inc/
+VPATH+=../common/src/
+
 # ****************** eCTF Bootloader *******************
 # DO NOT REMOVE
 LINKERFILE=firmware.ld
@@ -31,7 +40,7 @@ ENTRY=firmware_startup
 # ****************** eCTF Crypto Example *******************
 # Uncomment the commented lines below and comment the disable
 # lines to enable the eCTF Crypto Example.
-# WolfSSL must be included in this directory as wolfssl/
+# WolfSSL must be included in ../common as wolfssl/
 # WolfSSL can be downloaded from: https://www.wolfssl.com/download/
 
 # Disable Crypto Example
@@ -39,3 +48,1125 @@ CRYPTO_EXAMPLE=1
 
 # Enable Crypto Example
 #CRYPTO_EXAMPLE=1
+
+# ****************** MAX78000 AES Offload *******************
+# Uncomment to run AES-CBC on the on-chip AES engine through the
+# wolfCrypt crypto callback interface. The engine is self tested at
+# boot and the firmware falls back to software AES if it fails.
+# SHA-256 always stays in software, the MAX78000 has no hash engine.
+#MAX78000_HW_CRYPTO=1
+
+ifeq ($(MAX78000_HW_CRYPTO), 1)
+WOLFCRYPT_CFLAGS += -DWOLF_CRYPTO_CB
+WOLFCRYPT_CFLAGS += -DWOLFSSL_MAX78000_AES
+SRCS += ../common/wolfssl/wolfcrypt/src/port/maxim/max78000.c
+endif
+
+# ****************** Constant-Time AES *******************
+# Uncomment to run software AES-CBC and the single block decrypt on the
+# table-free bitsliced AES in common/src/aes_ct.c instead of wolfCrypt's
+# T-tables. Every block then takes the same time whatever the key and data,
+# including with the instruction cache off. The AES engine still takes
+# precedence when MAX78000_HW_CRYPTO is on; AES-GCM stays in wolfCrypt.
+#AES_CT=1
+
+ifeq ($(AES_CT), 1)
+PROJ_CFLAGS += -DAES_CT
+endif
+
+# ****************** Interleaved CBC Decryption *******************
+# Uncomment to run software AES-CBC decryption through the two-block kernel
+# in common/src/aes_tt.c instead of wc_AesCbcDecrypt. It uses wolfCrypt's
+# round keys and T-table layout but runs two blocks through every round
+# together, from a table it builds in SRAM at crypto_init (1.25 KB). Not
+# constant-time, exclusive with AES_CT. The AES engine still takes
+# precedence when MAX78000_HW_CRYPTO is on.
+#AES_TT=1
+
+ifeq ($(AES_TT), 1)
+PROJ_CFLAGS += -DAES_TT
+endif
+
+# ****************** Precomputed Key Tables *******************
+# Uncomment to load the device key's AES round keys, HMAC midstates and
+# CMAC subkeys from tables the deployment generates into global_secrets.h
+# (deployment/gen_key_tables.py), so nothing is expanded at boot. The AES
+# tables are checked against a known answer and the key is expanded as
+# usual if they do not fit, or if the AES engine is in use.
+#PRECOMPUTED_KEYS=1
+
+ifeq ($(PRECOMPUTED_KEYS), 1)
+PROJ_CFLAGS += -DPRECOMPUTED_KEYS
+endif
+
+# ****************** SRAM Fast Code *******************
+# Uncomment to run the hot paths from zero wait state SRAM: functions
+# marked FASTCODE (the component's I2C ISR, the single block decrypt and
+# the AES_CT rounds) and wolfCrypt's AES block, AES-CBC and SHA-256
+# transforms. They are copied from flash at startup with .data and take
+# that much SRAM. MSDK driver code such as MXC_I2C_AsyncHandler stays in
+# flash. Has no effect on wolfCrypt with LTO=1.
+#SRAM_FASTCODE=1
+
+ifeq ($(SRAM_FASTCODE), 1)
+WOLFCRYPT_CFLAGS += -DSRAM_FASTCODE
+endif
+
+# ****************** Hot/Cold Code *******************
+# Uncomment to group the functions marked HOT in hotcold.h (frame seal and
+# open, hash, MAC and AES calls, the board link's send and receive) at the
+# start of .text, and those marked COLD (init, flash reprovisioning, the
+# attempt lockout and the post boot loop) right after them, so the hot loops
+# share instruction cache lines and flash prefetches.
+#HOT_COLD=1
+
+ifeq ($(HOT_COLD), 1)
+PROJ_CFLAGS += -DHOT_COLD
+endif
+
+# ****************** Thumb-2 SHA-256 *******************
+# Uncomment to run wolfCrypt's SHA-256 compression function on the
+# Cortex-M4 assembly in common/src/sha256_thumb2.S, which keeps the state
+# in registers and folds every rotation into the barrel shifter. Speeds up
+# the flash integrity check and every frame hash. Goes to SRAM along with
+# the other transforms with SRAM_FASTCODE.
+#SHA256_THUMB2=1
+
+ifeq ($(SHA256_THUMB2), 1)
+WOLFCRYPT_CFLAGS += -DWOLFSSL_SHA256_THUMB2
+SRCS += ../common/src/sha256_thumb2.S
+ifeq ($(SRAM_FASTCODE), 1)
+PROJ_AFLAGS += -DSRAM_FASTCODE
+endif
+endif
+
+# ****************** AEAD Message Framing *******************
+# Uncomment one to frame msg_t with an AEAD instead of SHA-256 + AES-CBC:
+# AES-GCM (12 byte nonce, 16 byte tag) or Ascon-128 (16 byte nonce, 16
+# byte tag) from common/src/ascon.c. Ascon needs no tables or GHASH
+# multiplications and costs a few permutations per frame, the cheapest
+# framing for chatty post-boot traffic. This changes the wire format, so it
+# must be set the same way for the AP and every component.
+#MSG_AEAD=1
+#MSG_AEAD=ASCON
+
+ifeq ($(MSG_AEAD), 1)
+PROJ_CFLAGS += -DMSG_AEAD
+WOLFCRYPT_CFLAGS += -DHAVE_AESGCM
+endif
+ifeq ($(MSG_AEAD), ASCON)
+PROJ_CFLAGS += -DMSG_AEAD_ASCON
+endif
+
+# ****************** GHASH Tables *******************
+# Uncomment one to run MSG_AEAD=1's multiplications in GF(2^128) from a
+# table made from the hash key instead of bit by bit. The table is built
+# when a key is loaded (crypto_init, a channel open, a component key slot)
+# and never on the per-frame path. wolfCrypt keeps it in every AES context,
+# three per loaded key, so 4BIT costs 1.5 KB of SRAM per key and 8BIT, the
+# faster of the two, 12 KB per key. Does not change the wire format.
+#GCM_GHASH=4BIT
+#GCM_GHASH=8BIT
+
+ifeq ($(GCM_GHASH), 4BIT)
+WOLFCRYPT_CFLAGS += -DGCM_TABLE_4BIT
+endif
+ifeq ($(GCM_GHASH), 8BIT)
+WOLFCRYPT_CFLAGS += -DGCM_TABLE
+endif
+
+# ****************** Keyed Frame MAC *******************
+# Uncomment one to protect SHA-256 + AES-CBC frames with a keyed MAC
+# instead of the unkeyed SHA-256. HMAC-SHA256 runs from midstates
+# precomputed per key; AES-CMAC (16 byte tag, 16 more bytes of contents)
+# uses a key schedule expanded once and takes SHA-256 off the per-frame
+# path. This changes the wire format, so it must be set the same way for
+# the AP and every component. Not available with MSG_AEAD.
+#MSG_MAC=HMAC
+#MSG_MAC=CMAC
+
+ifeq ($(MSG_MAC), HMAC)
+PROJ_CFLAGS += -DMSG_MAC_HMAC
+endif
+ifeq ($(MSG_MAC), CMAC)
+PROJ_CFLAGS += -DMSG_MAC_CMAC
+WOLFCRYPT_CFLAGS += -DWOLFSSL_CMAC
+endif
+
+# ****************** CTR Frame Encryption *******************
+# Uncomment to encrypt MSG_MAC frames with AES-CTR instead of AES-CBC.
+# Frames are encrypted exactly as long as they are, check included, and
+# the keystream of the next frame is made ahead of time so sealing is a
+# single XOR. Needs MSG_MAC, not available with MSG_AEAD or
+# STREAM_DECRYPT. This changes the wire format, so it must be set the
+# same way for the AP and every component.
+#MSG_CTR=1
+
+ifeq ($(MSG_CTR), 1)
+PROJ_CFLAGS += -DMSG_CTR
+WOLFCRYPT_CFLAGS += -DWOLFSSL_AES_COUNTER
+endif
+
+# ****************** RISC-V Keystream *******************
+# Uncomment to make the MSG_CTR keystreams on the RISC-V core instead of
+# the M4: a small program of its own (common/riscv) runs the AES counter
+# blocks out of the top 16 KB of SRAM, which the M4 then goes without, and
+# ctr_pool_fill only collects them, so the AES runs alongside host commands, the link and post-boot code.
+# The framing, the MAC, the receive side and channel or component keys stay
+# on the M4. Needs MSG_CTR=1, AES_CT=1 and a RISC-V toolchain (RV_CROSS in
+# ../common/riscv_keystream.mk).
+#RISCV_KEYSTREAM=1
+
+ifeq ($(RISCV_KEYSTREAM), 1)
+PROJ_CFLAGS += -DRISCV_KEYSTREAM
+PROJ_LDFLAGS += -Wl,--defsym=__rv_sram_len=0x4000
+endif
+
+# ****************** Counter Nonces *******************
+# Uncomment to count every frame's challenge and IV / nonce up from values
+# drawn once per boot instead of drawing them from the RNG per frame. AEAD
+# nonces are the boot value plus a frame counter. CBC IVs are that block
+# encrypted under the frame key, which keeps them unpredictable. MSG_CTR
+# keeps its pooled IVs and only counts challenges. Does not change the wire
+# format and need not match between the AP and the components.
+#MSG_NONCE_COUNTER=1
+
+ifeq ($(MSG_NONCE_COUNTER), 1)
+PROJ_CFLAGS += -DMSG_NONCE_COUNTER
+endif
+
+# ****************** Replay Filter *******************
+# Uncomment to drop a received frame whose IV / nonce matches one of the
+# last MSG_REPLAY_WINDOW frames that opened, before it is decrypted or
+# checked. A flood of replayed frames then costs a few compares each
+# instead of the full crypto. The IV / nonce is in the clear at the end of
+# every frame and cannot be changed without failing the check. With
+# STREAM_DECRYPT the receive ISR has already decrypted most of the frame,
+# so only the check is saved. Does not change the wire format.
+# MSG_REPLAY_WINDOW (up to 255) costs its IV / nonce length in RAM per frame.
+#MSG_REPLAY_FILTER=1
+MSG_REPLAY_WINDOW=16
+
+ifeq ($(MSG_REPLAY_FILTER), 1)
+PROJ_CFLAGS += -DMSG_REPLAY_FILTER -DMSG_REPLAY_WINDOW=$(MSG_REPLAY_WINDOW)
+endif
+
+# ****************** Wire Format Negotiation *******************
+# Uncomment to speak the original SHA-256 + AES-CBC framing besides the one
+# MSG_AEAD or MSG_MAC selects, so a deployment can move to the faster
+# framing one device at a time. SCAN and VALIDATE start in the original
+# framing, the component's ID reply says which framings it speaks and the
+# AP uses the faster one with it from then on. Components answer in
+# whichever framing the AP's frame came in. Contents are sized for the
+# original framing's longer trailer. Needs MSG_AEAD or MSG_MAC, not
+# available with MSG_CTR.
+#MSG_FORMAT_NEGOTIATE=1
+
+ifeq ($(MSG_FORMAT_NEGOTIATE), 1)
+PROJ_CFLAGS += -DMSG_FORMAT_NEGOTIATE
+endif
+
+# ****************** Component Keys *******************
+# Uncomment to run every frame to or from a component under its own key,
+# HKDF-SHA256 of the device key and its I2C address, instead of the shared
+# device key. Post-boot channel keys are derived from the component key.
+# The AP keeps the expanded keys of the last COMPONENT_KEY_SLOTS components
+# it talked to. Must be set the same way for the AP and every component.
+#COMPONENT_KEYS=1
+
+ifeq ($(COMPONENT_KEYS), 1)
+PROJ_CFLAGS += -DCOMPONENT_KEYS -DCOMPONENT_KEY_SLOTS=4
+WOLFCRYPT_CFLAGS += -DHAVE_HKDF
+endif
+
+# ****************** Component Enrollment *******************
+# Uncomment (with COMPONENT_KEYS) to derive every component key from the
+# P-256 ECDH of the AP's and the component's key pairs instead of the
+# device key. Components present a certificate signed by the deployment
+# (deployment/gen_enroll_keys.py), which the AP reads and checks the
+# first time it talks to one after boot. Keep COMPONENT_KEY_SLOTS at the
+# number of components, a component whose slot was reused is enrolled
+# again. P-256 runs on the Cortex-M assembly in wolfCrypt's sp_cortexm.c.
+# Must be set the same way for the AP and every component.
+#COMPONENT_ENROLL=1
+
+ifeq ($(COMPONENT_ENROLL), 1)
+PROJ_CFLAGS += -DCOMPONENT_ENROLL
+WOLFCRYPT_CFLAGS += -DHAVE_ECC -DWOLFSSL_SP_ARM_CORTEX_M_ASM
+endif
+
+# ****************** Enrollment Resumption *******************
+# Uncomment (with COMPONENT_ENROLL) to keep a resumption ticket for every
+# enrolled component in the flash record: the hash of its certificate and
+# the ECDH secret. After the first boot a component is enrolled again by
+# reading its certificate, with no signature check or ECDH. Tickets are
+# replaced round robin, keep ENROLL_RESUME_SLOTS (8 by default) at least at
+# the number of components. Components need not set it the same way.
+#ENROLL_RESUME=1
+
+ifeq ($(ENROLL_RESUME), 1)
+PROJ_CFLAGS += -DENROLL_RESUME
+endif
+
+# ****************** I2C DMA Transfers *******************
+# Uncomment to service the I2C FIFOs with DMA instead of per-byte
+# interrupts. Falls back to the interrupt driven path at runtime if
+# no DMA channel can be acquired.
+#I2C_USE_DMA=1
+
+ifeq ($(I2C_USE_DMA), 1)
+PROJ_CFLAGS += -DI2C_USE_DMA
+endif
+
+# ****************** DMA Copies *******************
+# Uncomment to move buffers of DMA_COPY_MIN bytes or more with a memory to
+# memory DMA channel instead of the CPU (common/src/dma_copy.c): frames in
+# and out of the component's register banks and the bulk copies of jumbo
+# frames. The wipe of the jumbo buffer runs on in the background while the
+# caller goes on. Falls back to the CPU at runtime if no DMA channel can be
+# acquired.
+#DMA_COPY=1
+DMA_COPY_MIN=128
+
+ifeq ($(DMA_COPY), 1)
+PROJ_CFLAGS += -DDMA_COPY -DDMA_COPY_MIN=$(DMA_COPY_MIN)
+endif
+
+# ****************** I2C Ready Line *******************
+# Uncomment to use a shared open-drain "data ready" GPIO between the
+# components and the AP (P1.6 by default, see board_link.h). Must be
+# set the same way for the AP and every component.
+#BOARD_LINK_READY_GPIO=1
+
+ifeq ($(BOARD_LINK_READY_GPIO), 1)
+PROJ_CFLAGS += -DBOARD_LINK_READY_GPIO
+endif
+
+# ****************** I2C Link CRC *******************
+# Uncomment to protect every packet on the bus with a CRC-32 from the
+# MAX78000 CRC block. Corrupted packets are refused at the link, before any
+# crypto runs, and sent or read again up to LINK_CRC_RETRIES times (see
+# simple_i2c_controller.h). Must be set the same way for the AP and every
+# component.
+#LINK_CRC=1
+
+ifeq ($(LINK_CRC), 1)
+PROJ_CFLAGS += -DLINK_CRC
+endif
+
+# ****************** I2C Clock Stretched Replies *******************
+# Uncomment to read replies with one TRANSMIT_WAIT read, which the
+# component answers only once its reply is ready, stretching SCL for up to
+# LINK_STRETCH_MAX_US in between, instead of polling TRANSMIT_DONE. Saves
+# the poll transactions of every exchange and gets the reply across as soon
+# as it is published. Components that do not advertise it are still polled.
+# Must be set the same way for the AP and every component.
+#LINK_STRETCH=1
+LINK_STRETCH_MAX_US=4000
+
+ifeq ($(LINK_STRETCH), 1)
+PROJ_CFLAGS += -DLINK_STRETCH
+PROJ_CFLAGS += -DLINK_STRETCH_MAX_US=$(LINK_STRETCH_MAX_US)
+endif
+
+# ****************** I2C Watchdog *******************
+# Uncomment to arm the watchdog while each I2C transaction runs, so a
+# controller wedged by a misbehaving component resets the AP after about
+# 2.7 s instead of hanging until a power cycle. Pairs well with
+# WARM_BOOT_CACHE. Transactions are bounded by I2C_TIMEOUT_US and polls by
+# the per-component deadlines in board_link.h either way.
+#I2C_WATCHDOG=1
+
+ifeq ($(I2C_WATCHDOG), 1)
+PROJ_CFLAGS += -DI2C_WATCHDOG
+endif
+
+# ****************** I2C Multiplexer *******************
+# Uncomment when every bus in use reaches its components through a
+# TCA9548-style multiplexer at I2C_MUX_ADDR, so each channel is a separate,
+# shorter segment. Components are found on their channel on first use, or
+# build_ap.py --component-channels assigns them. The mux is only written when
+# the next transaction needs another channel, and the pipelined validate,
+# boot and attest sweeps poll the components segment by segment. Addresses
+# stay unique across channels: the mux address is reserved and components
+# still map to the low byte of their ID. Only the AP needs it.
+#I2C_MUX=1
+I2C_MUX_ADDR=0x70
+
+ifeq ($(I2C_MUX), 1)
+PROJ_CFLAGS += -DI2C_MUX -DI2C_MUX_ADDR=$(I2C_MUX_ADDR)
+endif
+
+# ****************** SPI Bulk Link *******************
+# Uncomment to move the post-boot traffic of components that also have SPI
+# wired to the AP onto SPI1 at LINK_SPI_HZ, each on its own chip select from
+# build_ap.py --component-spi-cs (pins of P2 by default, see
+# simple_spi_controller.h). List, attest, replace and boot stay on I2C, the
+# components move over once boot succeeds. A failed SPI exchange puts that
+# component back on I2C. Components wired for it need LINK_SPI=1 as well.
+#LINK_SPI=1
+LINK_SPI_HZ=12000000
+
+ifeq ($(LINK_SPI), 1)
+PROJ_CFLAGS += -DLINK_SPI -DLINK_SPI_HZ=$(LINK_SPI_HZ)
+endif
+
+# ****************** Asynchronous Link *******************
+# Uncomment to queue the pipelined validate and boot frames on the link
+# instead of waiting for each to go out. Transactions are started with
+# MXC_I2C_MasterTransactionAsync and moved on between polls, so the AP seals
+# the next frame while the last one is on the bus, and components on
+# different buses are written at the same time. The queue API is in
+# board_link.h (link_submit_send, link_submit_recv, link_run). The
+# watchdog of I2C_WATCHDOG does not cover queued transactions.
+#LINK_ASYNC=1
+
+ifeq ($(LINK_ASYNC), 1)
+PROJ_CFLAGS += -DLINK_ASYNC
+endif
+
+# ****************** Adaptive Pipeline *******************
+# Uncomment to let the AP tune the pipelined boot while it runs. The number
+# of validate exchanges in flight and the pause between polling sweeps
+# follow the link: LINK_CRC resends or refused frames since the last sweep
+# halve the depth and double the pause, every reply allows one more exchange
+# in flight and halves the pause, and a sweep that finds nothing waits
+# longer, up to PIPE_ADAPT_PAUSE_MAX_US. The depth carries over to the next
+# boot attempt. Needs LINK_STATS=1 for the error counters.
+#PIPE_ADAPT=1
+PIPE_ADAPT_PAUSE_MAX_US=400
+
+ifeq ($(PIPE_ADAPT), 1)
+PROJ_CFLAGS += -DPIPE_ADAPT -DPIPE_ADAPT_PAUSE_MAX_US=$(PIPE_ADAPT_PAUSE_MAX_US)
+endif
+
+# ****************** RTOS Task Model *******************
+# Uncomment to run the AP on FreeRTOS (the MSDK LIB_FREERTOS library, set up
+# in inc/FreeRTOSConfig.h). The command loop becomes the host task, and a
+# link task of higher priority runs the asynchronous link queue, woken by
+# every completed I2C transaction. Bus I/O then preempts host parsing and
+# crypto rather than waiting for them. Implies LINK_ASYNC=1.
+#AP_RTOS=1
+
+ifeq ($(AP_RTOS), 1)
+LIB_FREERTOS = 1
+PROJ_CFLAGS += -DAP_RTOS
+ifneq ($(LINK_ASYNC), 1)
+PROJ_CFLAGS += -DLINK_ASYNC
+endif
+endif
+
+# ****************** Light Scan *******************
+# Uncomment to list components with a short nonce packet, which the
+# component answers with its ID and a 16 byte HMAC-SHA256 under the device
+# key, instead of a full SCAN exchange. Neither side draws an IV or runs
+# AES for a list. Must be set the same way for the AP and every component.
+#SCAN_LIGHT=1
+
+ifeq ($(SCAN_LIGHT), 1)
+PROJ_CFLAGS += -DSCAN_LIGHT
+endif
+
+# ****************** Resumable Validation *******************
+# Uncomment to keep components that validated during a failed boot attempt
+# waiting for the next attempt, which then only validates the components
+# that failed and sends the others their boot frame straight away, still
+# answering their latest challenge. The AP reuses a validation for at most
+# VALIDATE_RESUME_MAX_AGE attempts and forgets them on list, attest and
+# replace. Must be set the same way for the AP and every component.
+#VALIDATE_RESUME=1
+
+ifeq ($(VALIDATE_RESUME), 1)
+PROJ_CFLAGS += -DVALIDATE_RESUME
+endif
+
+# ****************** Two Round Trip Boot *******************
+# Uncomment to validate and boot a component in two exchanges instead of
+# three. The component's answer to VALIDATE already carries its ID, and the
+# AP's proof travels in the BOOT frame, which the component only acts on if
+# it answers the challenge of that answer. Must be set the same way for the
+# AP and every component.
+#BOOT_TWO_TRIP=1
+
+ifeq ($(BOOT_TWO_TRIP), 1)
+PROJ_CFLAGS += -DBOOT_TWO_TRIP
+endif
+
+# ****************** One Round Trip Attest *******************
+# Uncomment to attest in one exchange. The AP's ATTEST frame answers the
+# challenge of the component's last frame, saved when the previous attest
+# of that component ended, and the component answers it with the data right
+# away, bound to the AP's new challenge. If the component has sent another
+# frame since, it asks for the AP's proof as before. Must be set the same
+# way for the AP and every component.
+#ATTEST_ONE_TRIP=1
+
+ifeq ($(ATTEST_ONE_TRIP), 1)
+PROJ_CFLAGS += -DATTEST_ONE_TRIP
+endif
+
+# ****************** Idle Pre-validation *******************
+# Uncomment to validate the provisioned components while the AP waits for
+# the host, one exchange at a time, and keep each validation as a
+# VALIDATE_RESUME hold for PREVALIDATE_MS. A boot then only sends the BOOT
+# frames. Holds are refreshed half way and dropped by list, attest and
+# replace like any other. Needs VALIDATE_RESUME and HOST_RX_RING, not
+# available with PRESENCE_MONITOR or CLOCK_SCALING. Keep PREVALIDATE_MS
+# below the components' COMP_SESSION_TIMEOUT_MS if that is set.
+#PREVALIDATE=1
+PREVALIDATE_MS=2000
+
+ifeq ($(PREVALIDATE), 1)
+PROJ_CFLAGS += -DPREVALIDATE -DPREVALIDATE_MS=$(PREVALIDATE_MS)
+endif
+
+# ****************** Broadcast Boot Release *******************
+# Uncomment to have components hold their boot after the boot message until
+# the AP has every boot message, then release them all with one write to the
+# I2C general call address carrying a tag per component, so they all boot
+# at the same STOP or none of them does. A component gives up after
+# COMP_SESSION_TIMEOUT_MS or on the AP's next frame. Must be set the same
+# way for the AP and every component.
+#BOOT_BROADCAST=1
+
+ifeq ($(BOOT_BROADCAST), 1)
+PROJ_CFLAGS += -DBOOT_BROADCAST
+endif
+
+# ****************** Boot Groups *******************
+# Uncomment to boot the components level by level, following the boot plan
+# build_ap.py --component-boot-levels stores with the provisioning data.
+# Every component of a level gets its boot command at once and the next
+# level only once all of them have answered, so components come up after
+# the ones they depend on and boot takes a round trip per level instead of
+# one per component. With BOOT_BROADCAST every component is still asked
+# first and the releases go level by level. Without a plan every component
+# is at level 0. Replacements take over the level of the component they
+# replace.
+#BOOT_GROUPS=1
+
+ifeq ($(BOOT_GROUPS), 1)
+PROJ_CFLAGS += -DBOOT_GROUPS
+endif
+
+# ****************** Firmware Measurement *******************
+# Uncomment to have the AP measure its own firmware image. build_ap.py
+# writes the SHA-256 digest of every page of the image into its last page,
+# which the firmware is kept out of, and the AP checks one page per idle
+# call while it waits for the host. Whatever is left is checked before the
+# first boot, which fails if a page does not match, and the measure command
+# prints the measurement, the hash of the digest table.
+#FIRMWARE_MEASURE=1
+
+ifeq ($(FIRMWARE_MEASURE), 1)
+PROJ_CFLAGS += -DFIRMWARE_MEASURE
+PROJ_LDFLAGS += -Wl,--defsym=__measure_len=0x2000
+endif
+
+# ****************** Dynamic I2C Addresses *******************
+# Uncomment to have the AP move every provisioned component from the address
+# its ID maps to onto a dense range, with one general call write of an entry
+# per component: its ID, the new address and a tag under the device key. The
+# write is numbered, and a component refuses any numbered at or below the
+# last one it took, so an old assignment cannot be replayed.
+# Entries go by the whole ID, so components whose IDs map to the same
+# address can both be provisioned. The slots are kept in the flash record
+# and a replacement takes over the slot of the component it replaces. Keys
+# and MACs stay bound to the address the ID maps to. Needs BOOT_BROADCAST=1
+# and must be set the same way for the AP and every component.
+# ADDR_ASSIGN_BASE picks the first address of the range, list only sweeps
+# that range and ignores SCAN_ADDR_FIRST and SCAN_ADDR_LIMIT.
+#ADDR_ASSIGN=1
+ADDR_ASSIGN_BASE=0x60
+
+ifeq ($(ADDR_ASSIGN), 1)
+PROJ_CFLAGS += -DADDR_ASSIGN
+PROJ_CFLAGS += -DADDR_ASSIGN_BASE=$(ADDR_ASSIGN_BASE)
+endif
+
+# ****************** Post-Boot Channel *******************
+# Uncomment to open a secure channel with every component at boot. Post-boot
+# secure_send / secure_receive then use one frame under a derived channel
+# key with a sequence number for replay protection, instead of the three
+# frame handshake. Must be set the same way for the AP and every component.
+#POST_BOOT_SESSION=1
+
+ifeq ($(POST_BOOT_SESSION), 1)
+PROJ_CFLAGS += -DPOST_BOOT_SESSION
+endif
+
+# ****************** Message Streams *******************
+# Uncomment to build the post-boot stream API for bulk transfers. Streams
+# fragment any amount of data into channel frames and keep up to
+# MSG_STREAM_WINDOW frames in flight per acknowledgement. Must be set the
+# same way for the AP and every component.
+#MSG_STREAM=1
+
+ifeq ($(MSG_STREAM), 1)
+PROJ_CFLAGS += -DMSG_STREAM
+endif
+
+# ****************** Stream Compression *******************
+# Uncomment to let the AP open a stream with MSG_STREAM_COMPRESS, whose data
+# is then compressed in blocks of MSG_STREAM_LZ_BLOCK bytes with a small
+# window LZ77 (msg_lz.h) before it is sealed. Logs and config blobs shrink
+# several times, so bulk transfers take that much less bus time. Costs
+# MSG_STREAM_LZ_BLOCK bytes in every msg_stream_t. Only for data that is
+# neither secret nor attacker influenced, as compressed lengths leak what
+# the data has in common. Needs MSG_STREAM=1. Must be set the same way for
+# the AP and every component.
+#MSG_STREAM_LZ=1
+MSG_STREAM_LZ_BLOCK=1024
+
+ifeq ($(MSG_STREAM_LZ), 1)
+PROJ_CFLAGS += -DMSG_STREAM_LZ -DMSG_STREAM_LZ_BLOCK=$(MSG_STREAM_LZ_BLOCK)
+endif
+
+# ****************** Component Relay *******************
+# Uncomment to let components send each other data through the AP:
+# secure_send_to and secure_receive_from on the components, secure_relay
+# forwarding frames from one post-boot channel to another on the AP. Needs
+# POST_BOOT_SESSION=1. Must be set the same way for the AP and every component.
+#MSG_RELAY=1
+
+ifeq ($(MSG_RELAY), 1)
+PROJ_CFLAGS += -DMSG_RELAY
+endif
+
+# ****************** Publish / Subscribe *******************
+# Uncomment to let components publish data on topics without the AP asking:
+# secure_publish queues frames in a small outbox on the component, which
+# hands them to both TRANSMIT banks as they free up. pubsub_poll on the AP
+# drains every component in turn, a few frames each, and calls the callbacks
+# registered with pubsub_subscribe, so one slow component holds up no other.
+# Needs POST_BOOT_SESSION=1, works best with BOARD_LINK_READY_GPIO=1. Must be
+# set the same way for the AP and every component.
+#MSG_PUBSUB=1
+
+ifeq ($(MSG_PUBSUB), 1)
+PROJ_CFLAGS += -DMSG_PUBSUB
+endif
+
+# ****************** Link Scheduler *******************
+# Uncomment to give the AP's post-boot traffic two priority classes:
+# sched_send_control queues short control messages, sched_send_bulk starts a
+# stream, and sched_run sends every queued control message before each bulk
+# chunk. Components take control messages with secure_receive, or through
+# stream->control while reading a stream. Needs POST_BOOT_SESSION=1 and
+# MSG_STREAM=1. Must be set the same way for the AP and every component.
+#MSG_SCHED=1
+
+ifeq ($(MSG_SCHED), 1)
+PROJ_CFLAGS += -DMSG_SCHED
+endif
+
+# ****************** Jumbo Frames *******************
+# Uncomment to add secure_send_jumbo / secure_receive_jumbo, which carry up
+# to MSG_JUMBO_MAX_LEN bytes (2048 by default) as one frame with a single
+# IV and check, sent as consecutive packets through the receive banks.
+# Needs POST_BOOT_SESSION=1, not available with STREAM_DECRYPT. Must be set
+# the same way for the AP and every component.
+#MSG_JUMBO=1
+
+ifeq ($(MSG_JUMBO), 1)
+PROJ_CFLAGS += -DMSG_JUMBO
+endif
+
+# ****************** Heartbeats *******************
+# Uncomment to add heartbeat_poll for the post-boot main loop. Every frame a
+# component sends on its post-boot channel counts as a heartbeat, only one
+# silent for HEARTBEAT_INTERVAL_MS gets a HEARTBEAT frame, which it answers
+# from its next secure_receive. One that does not within
+# HEARTBEAT_TIMEOUT_MS goes to the callback set with heartbeat_watch. Needs
+# POST_BOOT_SESSION=1. Must be set the same way for the AP and every component.
+#MSG_HEARTBEAT=1
+HEARTBEAT_INTERVAL_MS=1000
+HEARTBEAT_TIMEOUT_MS=50
+
+ifeq ($(MSG_HEARTBEAT), 1)
+PROJ_CFLAGS += -DMSG_HEARTBEAT
+PROJ_CFLAGS += -DHEARTBEAT_INTERVAL_MS=$(HEARTBEAT_INTERVAL_MS) -DHEARTBEAT_TIMEOUT_MS=$(HEARTBEAT_TIMEOUT_MS)
+endif
+
+# ****************** Time Sync *******************
+# Uncomment to add time_sync(address, rounds) for post-boot code. It runs a
+# few PING/PONG exchanges with a component over its post-boot channel and
+# sends it the clock offset of the fastest one, after which time_sync_now
+# gives the AP's microsecond clock on both sides (see time_sync.h). Uses
+# TMR3. Needs POST_BOOT_SESSION=1. Must be set the same way for the AP and
+# every component.
+#MSG_TIMESYNC=1
+TIME_SYNC_TIMEOUT_MS=50
+
+ifeq ($(MSG_TIMESYNC), 1)
+PROJ_CFLAGS += -DMSG_TIMESYNC -DTIME_SYNC_TIMEOUT_MS=$(TIME_SYNC_TIMEOUT_MS)
+endif
+
+# ****************** Post-Boot Protothreads *******************
+# Uncomment to write post-boot code as stackless coroutines (pt.h). Each
+# conversation is a PT_THREAD that waits with PT_SECURE_RECEIVE instead of
+# blocking in secure_receive, and pt_run interleaves any number of them on
+# the one stack, sleeping on the ready line while all of them wait and
+# moving LINK_ASYNC transactions on meanwhile. Only the AP's post-boot code
+# uses it.
+#POST_BOOT_PT=1
+
+ifeq ($(POST_BOOT_PT), 1)
+PROJ_CFLAGS += -DPOST_BOOT_PT
+endif
+
+# ****************** Buffer Pool *******************
+# Uncomment to add msg_pool_alloc / msg_pool_free for post-boot code: fixed
+# blocks for whole frames and for secure_send / secure_receive payloads,
+# taken from a NOLOAD linker section and usable from interrupts (see
+# msg_pool.h). Only this side's post-boot code uses it.
+#MSG_POOL=1
+MSG_POOL_FRAMES=4
+MSG_POOL_PAYLOADS=8
+
+ifeq ($(MSG_POOL), 1)
+PROJ_CFLAGS += -DMSG_POOL
+PROJ_CFLAGS += -DMSG_POOL_FRAMES=$(MSG_POOL_FRAMES) -DMSG_POOL_PAYLOADS=$(MSG_POOL_PAYLOADS)
+endif
+
+# ****************** Warm Boot Cache *******************
+# Uncomment to keep the verified flash state in a retained SRAM section,
+# protected by an HMAC under the device key. Warm resets (watchdog, soft
+# reset) then skip decrypting and verifying the flash log in init().
+#WARM_BOOT_CACHE=1
+
+ifeq ($(WARM_BOOT_CACHE), 1)
+PROJ_CFLAGS += -DWARM_BOOT_CACHE
+endif
+
+# ****************** Attempt Lockout *******************
+# Uncomment to count failed PIN and token checks in the encrypted flash
+# record, written before every check so a reset does not clear it. Each
+# failure in a row doubles the wait before the next check, from
+# ATTEMPT_LOCKOUT_BASE_US up to ATTEMPT_LOCKOUT_MAX_US. The random pause
+# before every check then drops from 0.5-1.5 s to 20-60 ms. Changes the
+# record layout, so a device switching either way starts over from the
+# provisioned components.
+#ATTEMPT_LOCKOUT=1
+ATTEMPT_LOCKOUT_BASE_US=4000000
+ATTEMPT_LOCKOUT_MAX_US=300000000
+
+ifeq ($(ATTEMPT_LOCKOUT), 1)
+PROJ_CFLAGS += -DATTEMPT_LOCKOUT
+PROJ_CFLAGS += -DATTEMPT_LOCKOUT_BASE_US=$(ATTEMPT_LOCKOUT_BASE_US) -DATTEMPT_LOCKOUT_MAX_US=$(ATTEMPT_LOCKOUT_MAX_US)
+endif
+
+# ****************** Bus Topology Cache *******************
+# Uncomment to keep the addresses that answered the last list in the
+# encrypted flash record. The next list probes and scans them before it
+# sweeps the other addresses, and only writes a record when the set
+# changes. Changes the record layout, so a device switching either way
+# starts over from the provisioned components.
+#TOPOLOGY_CACHE=1
+# Addresses list sweeps, reserved ones (I2C_BLACKLIST in ectf_params.h)
+# are always skipped
+SCAN_ADDR_FIRST=0x08
+SCAN_ADDR_LIMIT=0x78
+
+ifeq ($(TOPOLOGY_CACHE), 1)
+PROJ_CFLAGS += -DTOPOLOGY_CACHE
+endif
+PROJ_CFLAGS += -DSCAN_ADDR_FIRST=$(SCAN_ADDR_FIRST) -DSCAN_ADDR_LIMIT=$(SCAN_ADDR_LIMIT)
+
+# ****************** Link Metadata *******************
+# Uncomment to keep what each boot attempt learns about the link to every
+# provisioned component in the encrypted flash record: the capabilities it
+# advertised, its fastest reply and whether it answered. Startup takes the
+# bus speed of components that answered their last boot at their known
+# capabilities instead of reading them again, boot sends to the slowest
+# components first and only polls a component once its usual reply time
+# has passed. The record is only written when a component's status or
+# capabilities change or its reply time moves by more than a quarter.
+# Changes the record layout, so a device switching either way starts over
+# from the provisioned components.
+#LINK_META=1
+
+ifeq ($(LINK_META), 1)
+PROJ_CFLAGS += -DLINK_META
+endif
+
+# ****************** I2C Timing Calibration *******************
+# Uncomment to calibrate the SCL timing of each bus on test patterns written
+# to and read back from every component, instead of only trying the fixed
+# 1 MHz and 400 kHz rates. Rates are swept down from the fastest one the
+# components advertise in I2C_CALIBRATE_STEP_HZ steps, each with three duty
+# cycles, and the first one that carries I2C_CALIBRATE_ROUNDS patterns
+# without an error is backed off by I2C_CALIBRATE_MARGIN steps. The result
+# is kept with the link metadata and only checked again on later startups.
+# Needs LINK_META=1. Must be set the same way for the AP and every component.
+#I2C_CALIBRATE=1
+I2C_CALIBRATE_ROUNDS=16
+I2C_CALIBRATE_STEP_HZ=100000
+I2C_CALIBRATE_MARGIN=1
+
+ifeq ($(I2C_CALIBRATE), 1)
+PROJ_CFLAGS += -DI2C_CALIBRATE
+PROJ_CFLAGS += -DI2C_CALIBRATE_ROUNDS=$(I2C_CALIBRATE_ROUNDS)
+PROJ_CFLAGS += -DI2C_CALIBRATE_STEP_HZ=$(I2C_CALIBRATE_STEP_HZ)
+PROJ_CFLAGS += -DI2C_CALIBRATE_MARGIN=$(I2C_CALIBRATE_MARGIN)
+endif
+
+# ****************** Attestation Cache *******************
+# Uncomment to keep the attestation data of the last ATTEST_CACHE_SLOTS
+# attested components in RAM, encrypted under the device key. Repeat attests
+# still check the PIN but skip the bus exchange. Replace clears the cache.
+#ATTEST_CACHE=1
+
+ifeq ($(ATTEST_CACHE), 1)
+PROJ_CFLAGS += -DATTEST_CACHE
+endif
+
+# ****************** Frame Length *******************
+# Longest frame on the bus, header, contents and check included, up to 255.
+# Contents get what the framing leaves, so shorter frames mean shorter bus
+# transactions and more frames for the same data. The build fails if the
+# largest message body does not fit, below 127 bytes with the default
+# SHA-256 framing. Must be set the same way for the AP and every component.
+MSG_FRAME_LEN=255
+
+ifneq ($(MSG_FRAME_LEN), 255)
+PROJ_CFLAGS += -DMSG_FRAME_LEN=$(MSG_FRAME_LEN)
+endif
+
+# ****************** Attestation Field Length *******************
+# Longest LOC, DATE and CUST attestation field sent, up to 255 characters.
+# Data longer than one frame holds goes over several frames. Must be set
+# the same way for the AP and every component.
+ATTEST_FIELD_MAX_LEN=64
+
+ifneq ($(ATTEST_FIELD_MAX_LEN), 64)
+PROJ_CFLAGS += -DATTEST_FIELD_MAX_LEN=$(ATTEST_FIELD_MAX_LEN)
+endif
+
+# ****************** Sealed Attestation Data *******************
+# Uncomment to have build_comp.py seal the attestation data under the
+# deployment key into the component's ectf_params.h. The component sends the
+# sealed blob from flash as it is and only the AP opens it, so the plain
+# fields stay out of the component image. Needs the deployment built first.
+# Not available with KEY_ROTATION. Must be set the same way for the AP and
+# every component.
+#ATTEST_SEALED=1
+
+ifeq ($(ATTEST_SEALED), 1)
+PROJ_CFLAGS += -DATTEST_SEALED
+endif
+
+# ****************** Host UART Streaming *******************
+# Uncomment to queue host output in an interrupt driven UART TX ring that is
+# flushed in bursts, and to accept the "baud" command the host tools use to
+# raise the UART rate (up to HOST_UART_BAUD_MAX) for a single command.
+#HOST_UART_STREAM=1
+
+ifeq ($(HOST_UART_STREAM), 1)
+PROJ_CFLAGS += -DHOST_UART_STREAM
+endif
+
+# ****************** Small printf *******************
+# Uncomment to replace newlib's printf with the small formatter in
+# common/src/tiny_printf.c, which knows only the conversions the firmware
+# uses and allocates nothing. Smaller code, and formatting time that only
+# depends on the output length.
+#TINY_PRINTF=1
+
+ifeq ($(TINY_PRINTF), 1)
+PROJ_CFLAGS += -DTINY_PRINTF
+# Keep gcc from turning printf calls into puts and putchar
+PROJ_CFLAGS += -fno-builtin-printf
+endif
+
+# ****************** Host Binary Commands *******************
+# Uncomment to accept the "binary" command, which switches the host
+# interface to CRC checked request frames carrying all arguments and
+# structured reply frames (see host_messaging.h). Needs HOST_UART_STREAM.
+#HOST_BINARY_CMD=1
+
+ifeq ($(HOST_BINARY_CMD), 1)
+PROJ_CFLAGS += -DHOST_BINARY_CMD
+endif
+
+# ****************** Host RX Ring *******************
+# Uncomment to queue every byte the host sends in an interrupt fed RX ring
+# (HOST_RX_BUF_LEN bytes) instead of reading lines through the MSDK console
+# driver, so the host can type ahead or pipeline commands while the AP is
+# busy with the bus. Needs HOST_UART_STREAM.
+#HOST_RX_RING=1
+
+ifeq ($(HOST_RX_RING), 1)
+PROJ_CFLAGS += -DHOST_RX_RING
+endif
+
+# ****************** Host Sleep *******************
+# Uncomment to put the core to sleep while the AP waits for the host, instead
+# of spinning on the UART. The console RX interrupt wakes it within a few
+# cycles, so the first byte of a command is served at once. Idle work such
+# as the PRESENCE_MONITOR probes runs once every HOST_SLEEP_TICK_US on a
+# low-power timer (TMR4), and the core sleeps in between. Pair with
+# DELAY_SLEEP for the security delays and CLOCK_SCALING for the clock.
+# Needs HOST_RX_RING, not available with PREVALIDATE.
+#HOST_SLEEP=1
+HOST_SLEEP_TICK_US=1000
+
+ifeq ($(HOST_SLEEP), 1)
+PROJ_CFLAGS += -DHOST_SLEEP -DHOST_SLEEP_TICK_US=$(HOST_SLEEP_TICK_US)
+endif
+
+# ****************** Random Pool *******************
+# Draw rng_gen() values from a wolfCrypt Hash_DRBG pool seeded from the
+# TRNG, which stays powered and reseeds the pool in the background from
+# interrupts. Every TRNG byte that goes into it passes the SP 800-90B
+# repetition count and adaptive proportion tests first, off the rng_gen
+# path. Comment out to read the TRNG directly on every call, untested.
+RNG_POOL=1
+
+ifeq ($(RNG_POOL), 1)
+PROJ_CFLAGS += -DRNG_POOL
+WOLFCRYPT_CFLAGS += -DWC_RNG_SEED_CB
+endif
+
+# ****************** Clock Scaling *******************
+# Uncomment to divide SYSCLK by CLOCK_IDLE_DIV while the AP waits for the
+# host, and run every command at the full 100 MHz IPO. Cuts the idle power
+# draw, commands keep their speed. Not available with AP_RTOS.
+#CLOCK_SCALING=1
+CLOCK_IDLE_DIV=8
+
+ifeq ($(CLOCK_SCALING), 1)
+PROJ_CFLAGS += -DCLOCK_SCALING -DCLOCK_IDLE_DIV=$(CLOCK_IDLE_DIV)
+endif
+
+# ****************** Sleeping Security Delays *******************
+# Uncomment to run the random PIN and token delays and the 4 s penalty
+# after a wrong one on a low-power timer (TMR5) instead of spinning. While
+# they run the AP tops up the RNG and CTR pools, and with AP_RTOS hands
+# the core to the other tasks. Delays end at the same time either way.
+#DELAY_SLEEP=1
+
+ifeq ($(DELAY_SLEEP), 1)
+PROJ_CFLAGS += -DDELAY_SLEEP
+endif
+
+# ****************** Hot Path Tracing *******************
+# Uncomment to timestamp the crypto, RNG, board link and flash hot paths
+# with the DWT cycle counter. The AP dumps the trace on the "trace" host
+# command; the component dumps it over UART after every AP command.
+#TRACE=1
+
+ifeq ($(TRACE), 1)
+PROJ_CFLAGS += -DTRACE_ENABLE
+endif
+
+# ****************** Power Markers *******************
+# Uncomment to drive one GPIO per protocol phase high while the firmware is
+# in it: boot attempts, ap_transmit and ap_poll_recv, and the AES and hash calls. Record them on a power
+# analyzer's digital inputs and ectf_tools/power_tool.py reports the energy
+# of every phase from its CSV export. POWER_MARK_PIN0 to POWER_MARK_PIN0 + 3
+# of POWER_MARK_PORT (P2.3 to P2.6 by default) must be free on the board,
+# and none of them a LINK_SPI chip select.
+#POWER_MARKERS=1
+
+ifeq ($(POWER_MARKERS), 1)
+PROJ_CFLAGS += -DPOWER_MARKERS
+endif
+
+# ****************** Boot Profile *******************
+# Uncomment to print a debug line per component after every boot attempt:
+# validate and boot round trip times, empty polls and the AES and hash
+# cycles the AP spent on it. Runs on the DWT tracer, so implies TRACE=1.
+#BOOT_PROFILE=1
+
+ifeq ($(BOOT_PROFILE), 1)
+PROJ_CFLAGS += -DBOOT_PROFILE
+ifneq ($(TRACE), 1)
+PROJ_CFLAGS += -DTRACE_ENABLE
+endif
+endif
+
+# ****************** Runtime Statistics *******************
+# Uncomment to count frames per component, refused frames, challenge
+# mismatches, CRC retransmits, poll loops and flash erases, along with the
+# crypto, RNG and flash cycles. The "stats" host command prints them and
+# fetches every component's with the STATS command, so build the components
+# with it too. Runs on the DWT tracer, so implies TRACE=1.
+#LINK_STATS=1
+
+ifeq ($(LINK_STATS), 1)
+PROJ_CFLAGS += -DLINK_STATS
+ifneq ($(TRACE), 1)
+PROJ_CFLAGS += -DTRACE_ENABLE
+endif
+endif
+
+# ****************** Latency Histograms *******************
+# Uncomment to keep log2 bucket latency histograms, in microseconds, of every
+# host command and of issue_cmd, ap_transmit and ap_poll_recv. The "stats"
+# host command prints their counts, median and 99th percentile, and those of
+# every component's opcodes it fetches with the HIST command, so build the
+# components with it too. Every histogram is a fixed array of counts.
+# Needs LINK_STATS=1.
+#LAT_HIST=1
+
+ifeq ($(LAT_HIST), 1)
+PROJ_CFLAGS += -DLAT_HIST
+endif
+
+# ****************** I2C Capture *******************
+# Uncomment to record every I2C transaction the AP makes, with its start
+# cycle, duration, result and all bytes, into an I2C_CAPTURE_BUF_LEN byte
+# RAM ring (8 KB by default) that drops the oldest transactions once full.
+# The "capture" host command dumps and clears it, ectf_tools/capture_tool.py
+# saves the dump as a pcap file and summarizes it. Runs on the DWT tracer,
+# so implies TRACE=1.
+#I2C_CAPTURE=1
+
+ifeq ($(I2C_CAPTURE), 1)
+PROJ_CFLAGS += -DI2C_CAPTURE
+ifneq ($(TRACE), 1)
+PROJ_CFLAGS += -DTRACE_ENABLE
+endif
+endif
+
+# ****************** Bus Profile *******************
+# Uncomment to classify every I2C transaction the AP makes as payload, poll,
+# status or handshake and add up its time and bytes, and the idle gap on its
+# bus before it, per component address and per host command. The "bus" host
+# command prints busy time, bus occupancy, poll share and idle gaps of each
+# and clears them. Runs on the DWT tracer, so implies TRACE=1.
+#BUS_PROFILE=1
+
+ifeq ($(BUS_PROFILE), 1)
+PROJ_CFLAGS += -DBUS_PROFILE
+ifneq ($(TRACE), 1)
+PROJ_CFLAGS += -DTRACE_ENABLE
+endif
+endif
+
+# ****************** Slow Operation Capture *******************
+# Uncomment to freeze the trace ring, and the I2C capture ring with
+# I2C_CAPTURE=1, as soon as a boot, an attest or a list runs longer than its
+# budget below, so they keep what led up to the end of that slow run. The
+# "slow" host command prints which operation it was, how long it took and
+# both rings, then lets them record again. Only the first slow operation
+# since the last "slow" command is kept. Runs on the DWT tracer, so implies
+# TRACE=1.
+#SLOW_CAPTURE=1
+SLOW_BOOT_MS=1500
+SLOW_ATTEST_MS=500
+SLOW_SCAN_MS=1500
+
+ifeq ($(SLOW_CAPTURE), 1)
+PROJ_CFLAGS += -DSLOW_CAPTURE -DSLOW_BOOT_MS=$(SLOW_BOOT_MS) -DSLOW_ATTEST_MS=$(SLOW_ATTEST_MS) -DSLOW_SCAN_MS=$(SLOW_SCAN_MS)
+ifneq ($(TRACE), 1)
+PROJ_CFLAGS += -DTRACE_ENABLE
+endif
+endif
+
+# ****************** Binary Debug Log *******************
+# Uncomment to defer print_debug: messages go into a LOG_BINARY_BUF_LEN word
+# RAM ring as their format string address and raw arguments, unformatted,
+# and are printed as hex when the AP waits for the host or boots.
+# ectf_tools/log_tool.py expands them with the format strings of the ELF.
+# Cheap enough to leave on in timing critical code (see log_binary.h).
+#LOG_BINARY=1
+
+ifeq ($(LOG_BINARY), 1)
+PROJ_CFLAGS += -DLOG_BINARY
+endif
+
+# ****************** Static Crypto Heap *******************
+# Uncomment to build wolfCrypt without malloc. Every allocation it makes
+# (the DRBG state, AES-GCM scratch) then comes from fixed size pools in
+# a CRYPTO_HEAP_SIZE byte arena that firmware.ld keeps in its own SRAM
+# section, so crypto latency never depends on the general heap.
+#CRYPTO_STATIC_MEMORY=1
+CRYPTO_HEAP_SIZE=4096
+
+ifeq ($(CRYPTO_STATIC_MEMORY), 1)
+PROJ_CFLAGS += -DCRYPTO_STATIC_MEMORY
+PROJ_CFLAGS += -DCRYPTO_HEAP_SIZE=$(CRYPTO_HEAP_SIZE)
+WOLFCRYPT_CFLAGS += -DCRYPTO_STATIC_MEMORY
+endif
+
+# ****************** Link Time Optimization *******************
+# Uncomment to build and link with LTO, which lets gcc inline across
+# the messaging, crypto and wolfCrypt objects and drop more dead code.
+# Leave off when stepping through the firmware in a debugger.
+#LTO=1
+
+ifeq ($(LTO), 1)
+PROJ_CFLAGS += -flto
+PROJ_LDFLAGS += -flto
+endif
+
+# ****************** Lazy Startup *******************
+# Uncomment to send the first prompt before the startup work that can wait:
+# writing the record of a re-provisioned (first boot or corrupted) flash and
+# raising the bus speed, which probes every provisioned component. The first
+# command, whichever it is, does both before it runs.
+#LAZY_STARTUP=1
+
+ifeq ($(LAZY_STARTUP), 1)
+PROJ_CFLAGS += -DLAZY_STARTUP
+endif
+
+# ****************** Component Ready *******************
+# Uncomment to wait for the components to finish starting up before the
+# first exchange with them, at startup, after a replace and before a boot,
+# instead of failing a boot sent too early. A component built with
+# COMP_READY=1 reads back I2C_CAP_STARTING in its CAPABILITY register until
+# its main loop is about to take commands, one built without it is ready as
+# soon as it answers. All are polled together with the usual backoff, for at
+# most COMP_READY_TIMEOUT_MS, so power-on to boot takes only as long as the
+# slowest component. Components seen ready are not polled again until a boot
+# fails.
+#COMP_READY=1
+COMP_READY_TIMEOUT_MS=1000
+
+ifeq ($(COMP_READY), 1)
+PROJ_CFLAGS += -DCOMP_READY -DCOMP_READY_TIMEOUT_MS=$(COMP_READY_TIMEOUT_MS)
+endif
+
+# ****************** Flash Erase Ahead *******************
+# Uncomment to erase the flash page the record log moves to next between
+# commands, right after a response went out, instead of inside the flash
+# store that finds the current page full. A replace or a re-provisioning
+# startup then only writes its record and never waits out a page erase.
+# Pages that read blank, as on a fresh device, are not erased at all.
+#FLASH_ERASE_AHEAD=1
+
+ifeq ($(FLASH_ERASE_AHEAD), 1)
+PROJ_CFLAGS += -DFLASH_ERASE_AHEAD
+endif
+
+# ****************** Presence Monitor *******************
+# Uncomment to probe one provisioned component address every
+# PRESENCE_PROBE_MS while the AP waits for the host, and keep a bitmap of
+# the ones that stopped answering. Boot and attest fail at once on a
+# component still missing instead of timing out on it. The "delta" command
+# reports the provisioned components that went missing or came back since
+# the last list or delta, which list_tool.py --watch polls. Not available
+# with CLOCK_SCALING.
+#PRESENCE_MONITOR=1
+PRESENCE_PROBE_MS=20
+
+ifeq ($(PRESENCE_MONITOR), 1)
+PROJ_CFLAGS += -DPRESENCE_MONITOR -DPRESENCE_PROBE_MS=$(PRESENCE_PROBE_MS)
+endif
+
+# ****************** Key Rotation *******************
+# Uncomment to keep the device key in two flash pages instead of only in the
+# image, and add the "rotate" host command. It draws a new key and hands it
+# to every provisioned component over the secure channel, and only switches
+# the AP over once all of them have confirmed it. A component replaced
+# afterwards runs under the deployment key until the next rotate. Not
+# available with COMPONENT_KEYS. Must be set the same way for the AP and
+# every component.
+#KEY_ROTATION=1
+
+ifeq ($(KEY_ROTATION), 1)
+PROJ_CFLAGS += -DKEY_ROTATION
+endif
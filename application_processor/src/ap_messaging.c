@@ -1,73 +1,442 @@
 #include "ap_messaging.h"
 #include "board_link.h"
 #include "host_messaging.h"
+#include "link_stats.h"
+#include "hotcold.h"
+#include "power_mark.h"
+#ifdef COMPONENT_ENROLL
+#include "ectf_params.h"
+#endif
 
-msg_t transmit, receive;
-uint32_t prev_chal;
+// Frames go to the component at the given I2C address, send_frame puts the
+// register byte in the headroom so frames reach the bus without a copy
+static const msg_transport_t ap_link = {
+    .send = send_frame,
+    .recv = poll_and_receive_packet,
+    .wait_free = poll_receive_free,
+    .decrypt = NULL,
+    .release = NULL,
+    .headroom = I2C_FRAME_HEADROOM,
+    .role = MSG_ROLE_AP,
+};
+
+#ifdef LAT_HIST
+lat_hist_t ap_link_hists[LAT_LINK_CNT];
+#endif
+
+#ifdef COMPONENT_KEYS
+// Component the last frame went to or came from, a channel opened right after
+// the exchange is derived from its key
+static uint8_t key_peer;
+#endif
+
+#ifdef COMPONENT_ENROLL
+// AP key pair half and deployment key from ectf_params.h, see crypto_util.h
+static const uint8_t enroll_priv[ENROLL_PRIV_LEN] = ENROLL_PRIV;
+static const uint8_t enroll_ca_pub[ENROLL_PUB_LEN] = ENROLL_CA_PUB;
+
+typedef char enroll_cert_fits_t[(I2C_ENROLL_CERT_LEN == ENROLL_CERT_LEN) ? 1 : -1];
+
+// Reads the certificate of the component at address, checks it was issued for
+// that address and loads the key of our ECDH with it. Runs once per component
+// and boot as long as COMPONENT_KEY_SLOTS holds them all. With ENROLL_RESUME
+// a certificate that has a ticket skips the signature check and the ECDH
+static int ap_enroll(uint8_t address)
+{
+    uint8_t cert[ENROLL_CERT_LEN];
+    uint32_t component_id;
+
+    if (read_enroll_cert(address, cert) != SUCCESS_RETURN) {
+        return AP_FAILURE;
+    }
+    memcpy(&component_id, cert, sizeof(component_id));
+    // Certificates are issued for the address the ID maps to
+    address = ap_home_addr(address);
+    if (component_id_to_i2c_addr(component_id) != address) {
+        return AP_FAILURE;
+    }
+#ifdef ENROLL_RESUME
+    uint8_t cert_hash[HASH_LEN];
+    uint8_t secret[ENROLL_SECRET_LEN];
+    int ret = AP_SUCCESS;
+
+    hash(cert, cert_hash, ENROLL_CERT_LEN);
+    if (ap_resume_find(cert_hash, secret) != AP_SUCCESS) {
+        if (crypto_enroll_verify(enroll_ca_pub, cert) != 0 ||
+            crypto_enroll_secret(enroll_priv, cert + sizeof(component_id), secret) != 0) {
+            ret = AP_FAILURE;
+        } else {
+            // Written under the device key, before the component key is selected
+            crypto_use_device_key();
+            ap_resume_save(cert_hash, secret);
+        }
+    }
+    if (ret == AP_SUCCESS && crypto_enroll_resume(address, secret) != 0) {
+        ret = AP_FAILURE;
+    }
+    memset(secret, 0, sizeof(secret));
+    return ret;
+#else
+    if (crypto_enroll_verify(enroll_ca_pub, cert) != 0 ||
+        crypto_enroll(address, enroll_priv, cert + sizeof(component_id)) != 0) {
+        return AP_FAILURE;
+    }
+    return AP_SUCCESS;
+#endif
+}
+#endif
+
+#ifdef MSG_FORMAT_NEGOTIATE
+// Home addresses of the components that speak this image's framing
+static uint32_t wire_fast[128 / 32];
+
+void ap_wire_format_reset(uint8_t address)
+{
+    uint8_t home = ap_home_addr(address) & 0x7F;
+    wire_fast[home / 32] &= ~(1u << (home % 32));
+}
+
+void ap_wire_format_learn(uint8_t address, const msg_id_t *id)
+{
+    uint8_t home = ap_home_addr(address) & 0x7F;
+    // Replies of components without negotiation end after the ID, and
+    // unused contents read as zero
+    if (id->wire_version >= 1 && (id->wire_formats & MSG_FORMAT_FAST)) {
+        wire_fast[home / 32] |= 1u << (home % 32);
+    }
+}
+
+// Frames from now on go in the framing the component at address speaks
+static void ap_format_enter(uint8_t address)
+{
+    uint8_t home = ap_home_addr(address) & 0x7F;
+    int fast = (wire_fast[home / 32] >> (home % 32)) & 1;
+    msg_use_format(fast ? MSG_FORMAT_FAST : MSG_FORMAT_LEGACY);
+}
+#else
+#define ap_format_enter(address) ((void)0)
+#endif
+
+// Frames to and from a component are under its own key with COMPONENT_KEYS,
+// the device key stays in use for everything else on the AP
+static int ap_key_enter(uint8_t address)
+{
+    ap_format_enter(address);
+#ifdef COMPONENT_KEYS
+    // ap_enroll maps it itself, it reads the certificate from the bus address
+    uint8_t home = ap_home_addr(address);
+    key_peer = home;
+    int ret = crypto_use_component_key(home);
+#ifdef COMPONENT_ENROLL
+    if (ret == CRYPTO_ENROLL_NEEDED) {
+        return ap_enroll(address);
+    }
+#endif
+    return ret == 0 ? AP_SUCCESS : AP_FAILURE;
+#else
+    (void)address;
+    return AP_SUCCESS;
+#endif
+}
+
+static void ap_key_leave(void)
+{
+#ifdef COMPONENT_KEYS
+    crypto_use_device_key();
+#endif
+}
 
 //this function will be called assuming the global transmit struct
-//has opcode and content set, everything else is handled here
-int ap_transmit(uint8_t address)
-{
-    // gen new challenge, and answer old challenge
-    transmit.rng_resp = receive.rng_chal + 1;
-    transmit.rng_chal = (uint32_t) (rng_gen()>>32);
-
-    prev_chal = transmit.rng_chal;
-
-    //gen iv
-    uint64_t randValue;
-    randValue = rng_gen();
-    memcpy(&transmit.iv[0], &randValue, sizeof(randValue));
-
-    randValue = rng_gen();
-    memcpy(&transmit.iv[8], &randValue, sizeof(randValue));
-
-    //gen hash
-    hash((uint8_t*)&transmit, transmit.hash, ENC_LEN - 17);
-
-    // Encrypt from rng_chal to contents
-    uint8_t encryptedData[ENC_LEN];
-    aes_encrypt((uint8_t*)&transmit, encryptedData, transmit.iv, ENC_LEN);
-    // Assuming you want to overwrite the original with encrypted data
-    memcpy((uint8_t*)&transmit, encryptedData, ENC_LEN);
-    
-    //send packet
-    int result = send_packet(address, sizeof(msg_t), (uint8_t*) &transmit);
+//has opcode, len and content set, everything else is handled here
+HOT int ap_transmit(uint8_t address)
+{
+    LAT_START(start);
+    if (ap_key_enter(address) != AP_SUCCESS) {
+        return AP_FAILURE;
+    }
+    POWER_ENTER(POWER_TRANSMIT);
+    int result = msg_transmit(&ap_link, address);
+    POWER_EXIT(POWER_TRANSMIT);
+    ap_key_leave();
+    LAT_ADD(&ap_link_hists[LAT_LINK_TRANSMIT], start);
+    return result;
+}
+
+#ifdef LINK_ASYNC
+// ap_link with sends queued instead of waited on
+static const msg_transport_t ap_link_async = {
+    .send = send_frame_async,
+    .recv = poll_and_receive_packet,
+    .wait_free = poll_receive_free,
+    .decrypt = NULL,
+    .release = NULL,
+    .headroom = I2C_FRAME_HEADROOM,
+    .role = MSG_ROLE_AP,
+};
+
+int ap_transmit_async(uint8_t address)
+{
+    if (ap_key_enter(address) != AP_SUCCESS) {
+        return AP_FAILURE;
+    }
+    int result = msg_transmit(&ap_link_async, address);
+    ap_key_leave();
+    return result;
+}
+#endif
+
+HOT int ap_poll_recv(uint8_t address, int first) {
+    LAT_START(start);
+    if (ap_key_enter(address) != AP_SUCCESS) {
+        return AP_FAILURE;
+    }
+    POWER_ENTER(POWER_RECV);
+    int result = msg_recv(&ap_link, address, first);
+    POWER_EXIT(POWER_RECV);
+    ap_key_leave();
+    LAT_ADD(&ap_link_hists[LAT_LINK_POLL_RECV], start);
+    return result;
+}
+
+HOT int ap_try_recv(uint8_t address, int first) {
+    int len = try_receive_packet(address, msg_rx_frame);
+    if (len == 0) {
+        return AP_PENDING;
+    }
+    return ap_accept(address, len, first);
+}
+
+HOT int ap_accept(uint8_t address, int len, int first) {
+    if (ap_key_enter(address) != AP_SUCCESS) {
+        memset(&receive, 0, sizeof(msg_t));
+        return AP_FAILURE;
+    }
+    int result = msg_accept(len, first);
+    ap_key_leave();
+    return result;
+}
+
+#ifdef BOOT_BROADCAST
+typedef char release_tag_fits_t[(I2C_RELEASE_TAG_LEN == MSG_RELEASE_TAG_LEN) ? 1 : -1];
+
+int ap_release_tag(uint8_t address, uint8_t *tag)
+{
+    if (ap_key_enter(address) != AP_SUCCESS) {
+        return AP_FAILURE;
+    }
+    int result = msg_release_tag(&ap_link, ap_home_addr(address), tag);
+    ap_key_leave();
     return result;
 }
+#endif
+
+#ifdef ADDR_ASSIGN
+typedef char assign_tag_fits_t[(I2C_ASSIGN_TAG_LEN == MSG_ASSIGN_TAG_LEN) ? 1 : -1];
+
+// Home address of every assigned bus address, 0 where none was assigned
+static uint8_t assign_home[128];
+
+int ap_addr_assign(uint32_t seq, const uint32_t *ids, const uint8_t *addrs, int count)
+{
+    uint8_t assign[I2C_ASSIGN_LEN];
+
+    if (count > I2C_ASSIGN_ENTRIES) {
+        return AP_FAILURE;
+    }
+    memset(assign_home, 0, sizeof(assign_home));
+    memcpy(assign, &seq, I2C_ASSIGN_SEQ_LEN);
+    for (int i = 0; i < count; i++) {
+        uint8_t *entry = &assign[I2C_ASSIGN_SEQ_LEN + i * I2C_ASSIGN_ENTRY_LEN];
+        memcpy(entry, &ids[i], sizeof(ids[i]));
+        entry[sizeof(ids[i])] = addrs[i];
+        if (msg_assign_tag(seq, ids[i], addrs[i], &entry[sizeof(ids[i]) + 1]) != MSG_SUCCESS) {
+            return AP_FAILURE;
+        }
+        assign_home[addrs[i] & 0x7F] = component_id_to_i2c_addr(ids[i]);
+    }
+    // Every component on the bus takes the one write. If nobody did, they
+    // all stay on their home addresses
+    if (broadcast_assign(addrs, count, I2C_ASSIGN_SEQ_LEN + count * I2C_ASSIGN_ENTRY_LEN, assign) != SUCCESS_RETURN) {
+        memset(assign_home, 0, sizeof(assign_home));
+        return AP_FAILURE;
+    }
+    return AP_SUCCESS;
+}
 
-int ap_poll_recv(uint8_t address, int first) {
-    //poll for incoming packet
-    int len = poll_and_receive_packet(address, (uint8_t*)&receive);
-    if (len != sizeof(msg_t)) {
+uint8_t ap_home_addr(uint8_t address)
+{
+    uint8_t home = assign_home[address & 0x7F];
+    return home ? home : address;
+}
+#endif
+
+#ifdef SCAN_LIGHT
+int ap_scan(uint8_t address, const uint8_t nonce[MSG_SCAN_NONCE_LEN], uint32_t *component_id)
+{
+    uint8_t frame[I2C_FRAME_HEADROOM + MSG_SCAN_REQ_LEN];
+    frame[I2C_FRAME_HEADROOM] = MSG_SCAN_TAG;
+    memcpy(&frame[I2C_FRAME_HEADROOM + 1], nonce, MSG_SCAN_NONCE_LEN);
+    if (send_frame(address, MSG_SCAN_REQ_LEN, frame) != SUCCESS_RETURN ||
+        poll_and_receive_packet(address, msg_rx_frame) != MSG_SCAN_REPLY_LEN) {
+        memset(msg_rx_frame, 0, MAX_MSG_LEN);
         return AP_FAILURE;
     }
 
-    //decrypt packet
-    uint8_t decryptedData[ENC_LEN];
-    aes_decrypt((uint8_t*)&receive, decryptedData, receive.iv, ENC_LEN);
-    memcpy((uint8_t*)&receive, decryptedData, ENC_LEN);
+    uint8_t mac[MSG_SCAN_MAC_LEN];
+    memcpy(component_id, msg_rx_frame, sizeof(uint32_t));
+    int result = msg_scan_mac(nonce, ap_home_addr(address), *component_id, mac);
+    if (result == AP_SUCCESS && secure_memcmp(mac, &msg_rx_frame[sizeof(uint32_t)], MSG_SCAN_MAC_LEN) != 0) {
+        STATS_INC(auth_failures);
+        result = AP_FAILURE;
+    }
+    memset(msg_rx_frame, 0, MSG_SCAN_REPLY_LEN);
+    return result;
+}
+#endif
 
-    // verify hash
-    uint8_t computedHash[HASH_LEN];
-    hash((uint8_t*)&receive, computedHash, ENC_LEN - 17); 
-    if (memcmp(receive.hash, computedHash, HASH_LEN) != 0) {
-        return AP_FAILURE; // Hash mismatch
+#ifdef MSG_CHANNEL
+void msg_channel_open(msg_channel_t *channel)
+{
+#ifdef COMPONENT_KEYS
+    if (ap_key_enter(key_peer) != AP_SUCCESS) {
+        memset(channel, 0, sizeof(msg_channel_t));
+        return;
     }
+#endif
+    msg_channel_derive(&ap_link, channel);
+    ap_key_leave();
+}
+
+int ap_channel_transmit(msg_channel_t *channel, uint8_t address)
+{
+    ap_format_enter(address);
+    return msg_channel_transmit(&ap_link, channel, address);
+}
 
-    // check challenge response
-    if (!first && (receive.rng_resp != (prev_chal + 1))) {
-        return AP_FAILURE; // Challenge-response mismatch
+#if defined(MSG_HEARTBEAT) || defined(MSG_TIMESYNC)
+// Whether receive holds an answer to a heartbeat or time sync frame
+static int ap_channel_service(void)
+{
+#ifdef MSG_HEARTBEAT
+    if (receive.opcode == MSG_OPCODE_HEARTBEAT) {
+        return 1;
+    }
+#endif
+#ifdef MSG_TIMESYNC
+    if (receive.opcode == MSG_OPCODE_TIMESYNC) {
+        return 1;
     }
+#endif
+    return 0;
+}
+#endif
 
-    // if all checks pass
+int ap_channel_poll_recv(msg_channel_t *channel, uint8_t address)
+{
+    ap_format_enter(address);
+#if defined(MSG_HEARTBEAT) || defined(MSG_TIMESYNC)
+    // A heartbeat or PONG answered after its wait gave up on it is no message
+    int result;
+    while ((result = msg_channel_recv(&ap_link, channel, address)) == AP_SUCCESS &&
+           ap_channel_service()) {
+    }
+    return result;
+#else
+    return msg_channel_recv(&ap_link, channel, address);
+#endif
+}
+
+int ap_channel_try_recv(msg_channel_t *channel, uint8_t address)
+{
+    int len = try_receive_packet(address, msg_rx_frame);
+    if (len == 0) {
+        return AP_PENDING;
+    }
+    ap_format_enter(address);
+    int result = msg_channel_accept(&ap_link, channel, len);
+#if defined(MSG_HEARTBEAT) || defined(MSG_TIMESYNC)
+    // These only advance rx_seq, which is what heartbeat_poll and time_sync
+    // look at, and stay in receive for time_sync to read
+    if (result == AP_SUCCESS && ap_channel_service()) {
+        return AP_PENDING;
+    }
+#endif
+    return result;
+}
+#endif
+
+#ifdef MSG_STREAM
+int ap_stream_open(msg_stream_t *stream, msg_channel_t *channel, uint8_t address, int direction)
+{
+    memset(stream, 0, sizeof(msg_stream_t));
+#ifdef MSG_STREAM_LZ
+    stream->compress = (direction & MSG_STREAM_COMPRESS) != 0;
+    direction &= ~MSG_STREAM_COMPRESS;
+#endif
+    stream->writer = (direction == MSG_STREAM_AP_WRITES);
+
+    transmit.opcode = MSG_OPCODE_STREAM_OPEN;
+    transmit.contents[0] = (uint8_t)stream->writer;
+#ifdef MSG_STREAM_LZ
+    if (stream->compress) {
+        transmit.contents[0] |= MSG_STREAM_COMPRESS;
+    }
+#endif
+    transmit.len = 1;
+
+    if (channel != NULL && channel->ready) {
+        stream->channel = channel;
+        ap_format_enter(address);
+        if (msg_stream_send(&ap_link, stream, address) != AP_SUCCESS ||
+            ap_channel_poll_recv(channel, address) != AP_SUCCESS) {
+            return AP_FAILURE;
+        }
+    }
+    else {
+        // The component answers our challenge, both challenges key the stream
+        memset(&receive, 0, sizeof(msg_t));
+        if (ap_transmit(address) != AP_SUCCESS || ap_poll_recv(address, 0) != AP_SUCCESS) {
+            return AP_FAILURE;
+        }
+        msg_channel_open(&stream->own);
+        stream->channel = &stream->own;
+    }
+
+    if (receive.opcode != MSG_OPCODE_STREAM_ACK) {
+        return AP_FAILURE;
+    }
     return AP_SUCCESS;
 }
 
-void reset_msg()
+int ap_stream_write(msg_stream_t *stream, uint8_t address, const uint8_t *buf, int len)
+{
+    ap_format_enter(address);
+    return msg_stream_write(&ap_link, stream, address, buf, len);
+}
+
+int ap_stream_read(msg_stream_t *stream, uint8_t address, uint8_t *buf, int len)
+{
+    ap_format_enter(address);
+    return msg_stream_read(&ap_link, stream, address, buf, len);
+}
+
+int ap_stream_close(msg_stream_t *stream, uint8_t address)
+{
+    ap_format_enter(address);
+    return msg_stream_close(&ap_link, stream, address);
+}
+#endif
+
+#ifdef MSG_JUMBO
+int ap_jumbo_send(msg_channel_t *channel, uint8_t address, const uint8_t *buf, int len)
+{
+    ap_format_enter(address);
+    return msg_jumbo_send(&ap_link, channel, address, buf, len);
+}
+
+int ap_jumbo_recv(msg_channel_t *channel, uint8_t address, uint8_t *buf, int maxlen)
 {
-    memset(&transmit, 0, sizeof(msg_t));
-    memset(&receive, 0, sizeof(msg_t));
-    prev_chal = 0;
+    ap_format_enter(address);
+    return msg_jumbo_recv(&ap_link, channel, address, buf, maxlen);
 }
+#endif
@@ -0,0 +1,148 @@
+/**
+ * @file "ap_rtos.c"
+ * @brief Optional FreeRTOS task model of the AP
+ * @date 2024
+ */
+
+#include "ap_rtos.h"
+
+#ifdef AP_RTOS
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "board_link.h"
+#include "irq_events.h"
+
+// Every interrupt may use the kernel's FromISR calls
+typedef char ap_rtos_irq_prio_t[(IRQ_PRIO_LINK >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY) ? 1 : -1];
+
+/******************************** GLOBAL DEFINITIONS ********************************/
+static TaskHandle_t host_task;
+static TaskHandle_t link_task;
+// Guards the link queue, the host task queues and the link task runs it
+static SemaphoreHandle_t link_mutex;
+static void (*host_entry)(void);
+
+/******************************** FUNCTION DEFINITIONS ********************************/
+/**
+ * @brief Check whether the scheduler has started
+ * 
+ * @return bool: true once tasks are running
+*/
+static bool ap_rtos_running(void) {
+    return xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+}
+
+/**
+ * @brief Host task, runs the command loop
+ * 
+ * @param arg: void*, unused
+*/
+static void ap_rtos_host(void* arg) {
+    (void)arg;
+    host_entry();
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Link task, moves the link queue on after every completed
+ * transaction and once a tick for the receives waiting out a poll delay
+ * 
+ * @param arg: void*, unused
+*/
+static void ap_rtos_link(void* arg) {
+    (void)arg;
+    TickType_t last = xTaskGetTickCount();
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, 1);
+        TickType_t now = xTaskGetTickCount();
+        link_run((now - last) * portTICK_PERIOD_MS * 1000);
+        last = now;
+    }
+}
+
+/**
+ * @brief Start the tasks and the scheduler
+ * 
+ * @param host_main: void (*)(void), command loop the host task runs
+*/
+void ap_rtos_start(void (*host_main)(void)) {
+    host_entry = host_main;
+    link_mutex = xSemaphoreCreateRecursiveMutex();
+
+    // The completion interrupts notify the link task, which the kernel only
+    // allows at or below configMAX_SYSCALL_INTERRUPT_PRIORITY
+    for (int bus = 0; bus < I2C_BUS_COUNT; bus++) {
+        if (I2C_BUS_MASK & (1 << bus)) {
+            NVIC_SetPriority(MXC_I2C_GET_IRQ(bus), IRQ_PRIO_LINK);
+        }
+    }
+
+    xTaskCreate(ap_rtos_link, "link", AP_RTOS_LINK_STACK, NULL, AP_RTOS_LINK_PRIORITY, &link_task);
+    xTaskCreate(ap_rtos_host, "host", AP_RTOS_HOST_STACK, NULL, AP_RTOS_HOST_PRIORITY, &host_task);
+    vTaskStartScheduler();
+
+    // Only reached if the tasks did not fit in configTOTAL_HEAP_SIZE
+    while (1) {}
+}
+
+/**
+ * @brief Take the link queue lock, recursive
+*/
+void ap_rtos_link_lock(void) {
+    if (ap_rtos_running()) {
+        xSemaphoreTakeRecursive(link_mutex, portMAX_DELAY);
+    }
+}
+
+/**
+ * @brief Release the link queue lock
+*/
+void ap_rtos_link_unlock(void) {
+    if (ap_rtos_running()) {
+        xSemaphoreGiveRecursive(link_mutex);
+    }
+}
+
+/**
+ * @brief Wake the link task from an I2C completion interrupt
+*/
+void ap_rtos_link_kick_from_isr(void) {
+    if (link_task == NULL) {
+        return;
+    }
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(link_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Wait a tick for the link task to move the queue on
+ * 
+ * @return bool: false if the caller has to run the queue itself
+*/
+bool ap_rtos_link_wait(void) {
+    if (!ap_rtos_running() || xTaskGetCurrentTaskHandle() == link_task) {
+        return false;
+    }
+    vTaskDelay(1);
+    return true;
+}
+
+#ifdef STACK_PROFILE
+/**
+ * @brief Host task stack never touched since it started
+ * 
+ * @return uint32_t: bytes, the kernel fills task stacks with a pattern too
+*/
+uint32_t ap_rtos_host_stack_unused(void) {
+    if (host_task == NULL) {
+        return AP_RTOS_HOST_STACK * sizeof(StackType_t);
+    }
+    return uxTaskGetStackHighWaterMark(host_task) * sizeof(StackType_t);
+}
+#endif
+
+#endif
@@ -27,8 +27,28 @@
 #include "board_link.h"
 #include "simple_flash.h"
 #include "host_messaging.h"
+#include "trace.h"
+#include "bench.h"
+#include "selftest.h"
+#include "ctcheck.h"
+#include "stack_profile.h"
+#include "link_stats.h"
+#include "i2c_capture.h"
+#include "bus_profile.h"
+#include "ap_rtos.h"
+#include "irq_events.h"
+#include "hotcold.h"
+#include "dma_copy.h"
+#include "rv_keystream.h"
+#include "key_store.h"
+#include "firmware_measure.h"
 
 #include "ap_messaging.h"
+#include "msg_schema.h"
+#include "time_sync.h"
+#include "msg_pool.h"
+#include "pt.h"
+#include "power_mark.h"
 
 #ifdef POST_BOOT
 #include "mxc_delay.h"
@@ -43,9 +63,160 @@
 
 /********************************* CONSTANTS **********************************/
 // Flash Macros
-#define FLASH_ADDR ((MXC_FLASH_MEM_BASE + MXC_FLASH_MEM_SIZE) - (2 * MXC_FLASH_PAGE_SIZE))
+// The top two pages of RESERVED, under ROM_BL_PAGE, A at FLASH_ADDR and B right after it
+#define FLASH_ADDR ((MXC_FLASH_MEM_BASE + MXC_FLASH_MEM_SIZE) - (3 * MXC_FLASH_PAGE_SIZE))
+#define FLASH_PAGE_ADDR(page) (FLASH_ADDR + (page) * MXC_FLASH_PAGE_SIZE)
+#ifdef KEY_ROTATION
+// The pages below them hold the device key, see key_store.h
+#define KEY_STORE_ADDR (FLASH_ADDR - KEY_STORE_PAGES * MXC_FLASH_PAGE_SIZE)
+#endif
 // Flash magic is in global_secrets
-#define FLASH_ENC_LEN 160   // (4 + 4 + 4*32) (flash_entry initial size) + 24 (extra padding, encrypts part of hash)
+
+// Most components we can be provisioned for, at most one per 7 bit I2C address
+#ifndef MAX_COMPONENTS
+#define MAX_COMPONENTS 128
+#endif
+#if COMPONENT_CNT > MAX_COMPONENTS
+#error "COMPONENT_CNT exceeds MAX_COMPONENTS"
+#endif
+#if defined(COMPONENT_CHANNELS) && !defined(I2C_MUX)
+#error "COMPONENT_CHANNELS from build_ap.py needs I2C_MUX=1 in project.mk"
+#endif
+#if defined(COMPONENT_SPI_CS) && !defined(LINK_SPI)
+#error "COMPONENT_SPI_CS from build_ap.py needs LINK_SPI=1 in project.mk"
+#endif
+#if defined(COMPONENT_BOOT_LEVELS) && !defined(BOOT_GROUPS)
+#error "COMPONENT_BOOT_LEVELS from build_ap.py needs BOOT_GROUPS=1 in project.mk"
+#endif
+#if defined(BOOT_GROUPS) && !defined(COMPONENT_BOOT_LEVELS)
+// Without a boot plan every component is at level 0
+#define COMPONENT_BOOT_LEVELS 0
+#endif
+#ifdef ADDR_ASSIGN
+// The bus, mux channel and chip select maps go by the address an ID maps to,
+// which components leave once assigned
+#if defined(COMPONENT_BUSES) || defined(I2C_MUX) || defined(COMPONENT_SPI_CS)
+#error "ADDR_ASSIGN=1 needs every component on the one I2C bus"
+#endif
+#if COMPONENT_CNT > I2C_ASSIGN_ENTRIES
+#error "COMPONENT_CNT exceeds the entries of one address assignment"
+#endif
+#endif
+
+// 7 bit I2C addresses components may use, the rest are reserved by the spec
+#define I2C_ADDR_FIRST 0x08
+#define I2C_ADDR_LIMIT 0x78
+// Addresses taken by other devices on the board, build_ap.py writes them to
+// ectf_params.h. 0x36 conflicts with separate device on MAX78000FTHR
+#ifndef I2C_BLACKLIST
+#define I2C_BLACKLIST 0x18, 0x28, 0x36
+#endif
+// Addresses list sweeps, project.mk can narrow them. With ADDR_ASSIGN only
+// the assigned range has components on it
+#ifdef ADDR_ASSIGN
+#undef SCAN_ADDR_FIRST
+#undef SCAN_ADDR_LIMIT
+#define SCAN_ADDR_FIRST ADDR_ASSIGN_BASE
+#define SCAN_ADDR_LIMIT (ADDR_ASSIGN_BASE + COMPONENT_CNT)
+#endif
+#ifndef SCAN_ADDR_FIRST
+#define SCAN_ADDR_FIRST I2C_ADDR_FIRST
+#endif
+#ifndef SCAN_ADDR_LIMIT
+#define SCAN_ADDR_LIMIT I2C_ADDR_LIMIT
+#endif
+
+#ifdef TOPOLOGY_CACHE
+// Bitmap of the addresses a component answered the last list from
+#define TOPOLOGY_WORDS ((I2C_ADDR_LIMIT + 31) / 32)
+#define TOPOLOGY_HAS(map, addr) (((map)[(addr) / 32] >> ((addr) % 32)) & 1)
+#define TOPOLOGY_LEN (TOPOLOGY_WORDS * sizeof(uint32_t))
+#else
+#define TOPOLOGY_LEN 0
+#endif
+
+#ifdef ENROLL_RESUME
+// Resumption tickets kept in the flash record, replaced round robin
+#ifndef ENROLL_RESUME_SLOTS
+#define ENROLL_RESUME_SLOTS 8
+#endif
+#define RESUME_LEN (4 + ENROLL_RESUME_SLOTS * sizeof(resume_ticket_t))
+#else
+#define RESUME_LEN 0
+#endif
+
+#ifdef ATTEMPT_LOCKOUT
+// Lockout before the next PIN or token check, doubled for every failed
+// attempt in a row since the last good one
+#ifndef ATTEMPT_LOCKOUT_BASE_US
+#define ATTEMPT_LOCKOUT_BASE_US 4000000
+#endif
+#ifndef ATTEMPT_LOCKOUT_MAX_US
+#define ATTEMPT_LOCKOUT_MAX_US 300000000
+#endif
+#define LOCKOUT_LEN 4
+// Failed attempts are rate limited by the lockout, the random pause before
+// a check only has to blur its timing
+#define CHECK_DELAY_MIN_US 20000
+#define CHECK_DELAY_MAX_US 60000
+#else
+#define LOCKOUT_LEN 0
+#define CHECK_DELAY_MIN_US 500000
+#define CHECK_DELAY_MAX_US 1500000
+#endif
+
+#ifdef ADDR_ASSIGN
+// Slot in the assigned range of every entry of component_ids, rounded up to
+// whole words. A replacement takes over the slot of the component it replaces
+#define ASSIGN_LEN (((COMPONENT_CNT + 3) / 4) * 4)
+#if ADDR_ASSIGN_BASE < I2C_ADDR_FIRST || ADDR_ASSIGN_BASE + COMPONENT_CNT > I2C_ADDR_LIMIT
+#error "ADDR_ASSIGN_BASE leaves no room for COMPONENT_CNT addresses"
+#endif
+#else
+#define ASSIGN_LEN 0
+#endif
+
+#ifdef LINK_META
+// One link_meta_t per entry of component_ids
+#define LINK_META_LEN (COMPONENT_CNT * 4)
+#else
+#define LINK_META_LEN 0
+#endif
+
+#ifdef I2C_CALIBRATE
+// One SCL timing per controller bus
+#define CALIBRATE_LEN (I2C_BUS_COUNT * 4)
+#else
+#define CALIBRATE_LEN 0
+#endif
+
+#ifdef BOOT_GROUPS
+// Boot level of every entry of component_ids, rounded up to whole words. A
+// replacement takes over the level of the component it replaces
+#define BOOT_LEVELS_LEN (((COMPONENT_CNT + 3) / 4) * 4)
+#else
+#define BOOT_LEVELS_LEN 0
+#endif
+
+/*
+   Each flash page is a log of records appended back to back:
+   iv | flash_magic | generation | component_cnt | [topology] | [resume] | [failed_attempts] |
+   [addr_slots] | [link_meta] | [bus_timings] | [boot_levels] | component_ids[component_cnt] |
+   pad | hash
+   The data is zero padded to a whole CBC block, so the hash starts on a
+   block boundary and everything after the iv is encrypted in whole blocks,
+   nothing is left in the clear. Records are whole 128 bit flash words, so no
+   word is written twice.
+*/
+// flash_magic, generation, component_cnt, topology, resume, failed_attempts, addr_slots,
+// link_meta, bus_timings, boot_levels
+#define FLASH_HEADER_LEN (12 + TOPOLOGY_LEN + RESUME_LEN + LOCKOUT_LEN + ASSIGN_LEN + LINK_META_LEN + \
+    CALIBRATE_LEN + BOOT_LEVELS_LEN)
+#define FLASH_DATA_LEN(cnt) (FLASH_HEADER_LEN + (cnt) * sizeof(uint32_t))
+#define FLASH_PAD_LEN(cnt) (((FLASH_DATA_LEN(cnt) + CBC_BLOCK_LEN - 1) / CBC_BLOCK_LEN) * CBC_BLOCK_LEN)
+#define FLASH_ENC_LEN(cnt) (FLASH_PAD_LEN(cnt) + HASH_LEN)
+#define FLASH_RECORD_LEN(cnt) (IV_LEN + FLASH_ENC_LEN(cnt))
+#define FLASH_RECORD_MAX_LEN FLASH_RECORD_LEN(MAX_COMPONENTS)
 
 // Library call return types
 #define SUCCESS_RETURN 0
@@ -57,45 +228,333 @@ extern msg_t receive;
 
 
 /******************************** TYPE DEFINITIONS ********************************/
-// Datatype for information stored in flash
+#ifdef ENROLL_RESUME
+// A component enrolled before, see ap_resume_find. Unused if all zero
+#pragma pack(push,1)
+typedef struct {
+    uint8_t cert_hash[HASH_LEN];
+    uint8_t secret[ENROLL_SECRET_LEN];
+} resume_ticket_t;
+#pragma pack(pop)
+#endif
+
+#ifdef LINK_META
+// What the boot attempts so far learned about the link to a component. Only
+// a change of status or caps, or of the turnaround by over a quarter, is
+// worth a flash record of its own, see link_meta_commit
+#pragma pack(push,1)
+typedef struct {
+    uint16_t turnaround_us; // Its fastest reply in a boot attempt, on the sweep clock
+    uint8_t caps;           // I2C_CAP_* bits it advertised, if status has LINK_META_CAPS
+    uint8_t status;         // LINK_META_* bits
+} link_meta_t;
+#pragma pack(pop)
+typedef char link_meta_len_t[(sizeof(link_meta_t) * COMPONENT_CNT == LINK_META_LEN) ? 1 : -1];
+
+// Answered every frame of the last boot attempt
+#define LINK_META_SEEN 0x01
+// Advertised caps at the last negotiation
+#define LINK_META_CAPS 0x02
+#endif
+
+// Datatype for information stored in flash, only the first component_cnt
+// component_ids are stored and they are kept sorted
 #pragma pack(push,1)
 typedef struct {
     uint32_t flash_magic;
+    // Bumped on every write, the newest record across both pages wins
+    uint32_t generation;
     uint32_t component_cnt;
-    uint32_t component_ids[32];
-    uint8_t  hash[HASH_LEN];
-    uint8_t  iv[IV_LEN];
+#ifdef TOPOLOGY_CACHE
+    // Addresses that answered the last list, see scan_components
+    uint32_t topology[TOPOLOGY_WORDS];
+#endif
+#ifdef ENROLL_RESUME
+    // Slot the next new ticket goes to
+    uint32_t resume_next;
+    resume_ticket_t resume[ENROLL_RESUME_SLOTS];
+#endif
+#ifdef ATTEMPT_LOCKOUT
+    // PIN and token checks started since the last one that passed
+    uint32_t failed_attempts;
+#endif
+#ifdef ADDR_ASSIGN
+    // Assigned address of each component, ADDR_ASSIGN_BASE + its slot
+    uint8_t addr_slots[ASSIGN_LEN];
+#endif
+#ifdef LINK_META
+    link_meta_t link_meta[COMPONENT_CNT];
+#endif
+#ifdef I2C_CALIBRATE
+    // SCL timing calibrated for each bus, 0 if it runs at I2C_FREQ
+    uint32_t bus_timings[I2C_BUS_COUNT];
+#endif
+#ifdef BOOT_GROUPS
+    // Level each component boots at, level 0 first, see boot_components
+    uint8_t boot_levels[BOOT_LEVELS_LEN];
+#endif
+    uint32_t component_ids[MAX_COMPONENTS];
 } flash_entry;
 #pragma pack(pop)
 
-// Datatype for commands sent to components
-typedef enum {
-    COMPONENT_CMD_NONE,
-    COMPONENT_CMD_SCAN,
-    COMPONENT_CMD_VALIDATE,
-    COMPONENT_CMD_BOOT,
-    COMPONENT_CMD_ATTEST
-} component_cmd_t;
+#ifdef WARM_BOOT_CACHE
+// Verified flash state kept in retained SRAM across warm resets. Only trusted
+// if mac, an HMAC under the device key over everything before it, verifies.
+#pragma pack(push,1)
+typedef struct {
+    uint32_t magic;
+    uint32_t page;
+    uint32_t offset;
+    uint32_t next;
+    uint8_t  iv[IV_LEN];
+    flash_entry entry;
+    uint8_t  mac[HASH_LEN];
+} warm_cache_t;
+#pragma pack(pop)
+#endif
+
+#ifdef ATTEST_CACHE
+// Attestation replies kept for repeat attests, replaced round robin
+#ifndef ATTEST_CACHE_SLOTS
+#define ATTEST_CACHE_SLOTS 8
+#endif
+// data holds the attestation data and its hash, encrypted under the device key
+#define ATTEST_CACHE_ENC_LEN (((ATTEST_DATA_LEN + HASH_LEN + 15) / 16) * 16)
+typedef struct {
+    uint32_t component_id;
+    uint32_t valid;
+    uint8_t  iv[IV_LEN];
+    uint8_t  data[ATTEST_CACHE_ENC_LEN];
+} attest_cache_t;
+#endif
+
+#ifdef BOOT_PROFILE
+// Timing of one component through the last boot attempt, in DWT cycles.
+// crypto_cycles only counts the AP's own AES and hash work for it
+typedef struct {
+    uint32_t validate_start;
+    uint32_t validate_cycles;   // First VALIDATE sent until its ID came back
+    uint32_t boot_start;
+    uint32_t boot_cycles;       // BOOT sent until its boot message came back
+    uint32_t polls;             // Polls that found no reply ready
+    uint32_t crypto_cycles;
+} boot_profile_t;
+
+#define PROFILE_START(i, phase) (boot_profile[i].phase##_start = trace_cycles())
+#define PROFILE_STOP(i, phase) \
+    (boot_profile[i].phase##_cycles = trace_cycles() - boot_profile[i].phase##_start)
+#else
+#define PROFILE_START(i, phase) ((void)0)
+#define PROFILE_STOP(i, phase) ((void)0)
+#endif
+
+#ifdef SLOW_CAPTURE
+#ifndef TRACE_ENABLE
+#error "SLOW_CAPTURE needs TRACE_ENABLE"
+#endif
+// Latency budgets, an operation running longer freezes the trace and
+// capture rings until the "slow" command prints them
+#ifndef SLOW_BOOT_MS
+#define SLOW_BOOT_MS 1500
+#endif
+#ifndef SLOW_ATTEST_MS
+#define SLOW_ATTEST_MS 500
+#endif
+#ifndef SLOW_SCAN_MS
+#define SLOW_SCAN_MS 1500
+#endif
+#define SLOW_START(var) uint32_t var = trace_cycles()
+#define SLOW_CHECK(op, var, budget_ms) slow_check((op), (var), (budget_ms))
+#else
+#define SLOW_START(var) ((void)0)
+#define SLOW_CHECK(op, var, budget_ms) ((void)0)
+#endif
+
+#ifdef VALIDATE_RESUME
+// Boot attempts a held component's validation stays good for
+#ifndef VALIDATE_RESUME_MAX_AGE
+#define VALIDATE_RESUME_MAX_AGE 4
+#endif
+// A component that validated in a boot attempt that failed elsewhere. It
+// waits for the next frame of the conversation in session, which the next
+// attempt sends it instead of validating it again
+typedef struct {
+    uint32_t component_id;
+    msg_session_t session;
+    uint8_t age;    // Boot attempts since it validated, 0 if unused
+#ifdef PREVALIDATE
+    uint32_t born;  // Cycle count when it validated, see PREVALIDATE_MS
+#endif
+} validate_hold_t;
+#endif
+
+#ifdef PREVALIDATE
+#ifndef VALIDATE_RESUME
+#error "PREVALIDATE keeps its validations as VALIDATE_RESUME holds"
+#endif
+#ifndef HOST_RX_RING
+#error "PREVALIDATE runs whole exchanges while idle, the host input needs HOST_RX_RING"
+#endif
+#if defined(PRESENCE_MONITOR) || defined(CLOCK_SCALING)
+#error "PREVALIDATE is not available with PRESENCE_MONITOR or CLOCK_SCALING"
+#endif
+#ifdef HOST_SLEEP
+#error "PREVALIDATE ages its holds by the cycle counter, which stops while HOST_SLEEP sleeps"
+#endif
+// How long a validation made while idle is good for. Keep it below the
+// components' COMP_SESSION_TIMEOUT_MS, they drop the exchange after that
+#ifndef PREVALIDATE_MS
+#define PREVALIDATE_MS 2000
+#endif
+#define PREVALIDATE_CYCLES(ms) ((ms) * (SystemCoreClock / 1000))
+#endif
 
 /********************************* GLOBAL VARIABLES **********************************/
 // Variable for information stored in flash memory
 flash_entry flash_status;
+// I2C address of every entry of flash_status.component_ids, see index_components
+i2c_addr_t component_addrs[MAX_COMPONENTS];
+// Entries whose address is reserved or shared with another entry, never contacted
+static bool component_addr_bad[MAX_COMPONENTS];
+// 1 + index in flash_status.component_ids of the component at each address, 0 if none
+static uint8_t addr_components[I2C_ADDR_LIMIT];
+#if defined(I2C_MUX) || defined(LINK_META)
+// Order the pipelined sweeps visit the entries in. Slowest first with
+// LINK_META, see link_meta_order, and segment by segment with I2C_MUX so
+// consecutive polls rarely switch the mux, see sweep_sort
+static uint8_t sweep_order[MAX_COMPONENTS];
+#define SWEEP_INDEX(k) sweep_order[k]
+#else
+#define SWEEP_INDEX(k) (k)
+#endif
+#ifdef LINK_META
+// flash_status.link_meta changed enough to be worth a record, see link_meta_commit
+static bool link_meta_changed;
+#endif
+
+// Flash page and offset of the newest record and its IV, and the offset the
+// next record goes to in that page (MXC_FLASH_PAGE_SIZE once it is full)
+static unsigned flash_page;
+static unsigned flash_offset;
+static unsigned flash_next;
+static uint8_t flash_iv[IV_LEN];
+#ifdef FLASH_ERASE_AHEAD
+// Page known to be erased since, -1 if none, see flash_prepare
+static int flash_erased_page = -1;
+#endif
+
+#ifdef KEY_ROTATION
+// Device key we run under and the key of a rotation in progress, as kept in flash
+static key_store_t key_store;
+static void rotate_resume();
+#endif
+
+#ifdef WARM_BOOT_CACHE
+// Left alone by the startup code, holds whatever was there before the reset
+static warm_cache_t warm_cache __attribute__((section(".retained")));
+#endif
+
+#ifdef ATTEST_CACHE
+static attest_cache_t attest_cache[ATTEST_CACHE_SLOTS];
+static unsigned attest_cache_next;
+#endif
+
+#ifdef BOOT_PROFILE
+// Indexed like flash_status.component_ids, filled in by validate and boot
+static boot_profile_t boot_profile[MAX_COMPONENTS];
+#endif
+
+#ifdef SLOW_CAPTURE
+// The first operation that ran over its budget since the last "slow"
+// command, NULL if none did, and how long it took
+static const char* slow_op;
+static uint32_t slow_us;
+static uint32_t slow_budget_ms;
+#endif
+
+#ifdef VALIDATE_RESUME
+// Indexed like flash_status.component_ids, only good within this power cycle
+static validate_hold_t validate_holds[MAX_COMPONENTS];
+
+#ifdef PREVALIDATE
+static void prevalidate_rearm();
+static void prevalidate_idle();
+#endif
+
+// Forget every held validation, call before anything else talks to the
+// components or when the provisioned set changes
+static void validate_holds_clear() {
+    memset(validate_holds, 0, sizeof(validate_holds));
+#ifdef PREVALIDATE
+    prevalidate_rearm();
+#endif
+}
+
+// Resume component i's held validation into *session. Returns false, and
+// drops the hold, unless it is recent enough to reuse
+static bool validate_hold_resume(unsigned i, msg_session_t *session) {
+    validate_hold_t *hold = &validate_holds[i];
+    if (hold->age == 0 || hold->age >= VALIDATE_RESUME_MAX_AGE ||
+#ifdef PREVALIDATE
+        DWT->CYCCNT - hold->born >= PREVALIDATE_CYCLES(PREVALIDATE_MS) ||
+#endif
+        hold->component_id != flash_status.component_ids[i]) {
+        memset(hold, 0, sizeof(validate_hold_t));
+        return false;
+    }
+    hold->age++;
+    *session = hold->session;
+    return true;
+}
+#endif
+
+#ifdef POST_BOOT_SESSION
+// Post-boot channels, indexed like flash_status.component_ids, opened during boot
+msg_channel_t comp_channels[MAX_COMPONENTS];
+
+// Find the open post-boot channel to the component at address, NULL if there is none
+static msg_channel_t* post_boot_channel(i2c_addr_t address) {
+    if (address >= I2C_ADDR_LIMIT || addr_components[address] == 0) {
+        return NULL;
+    }
+    unsigned i = addr_components[address] - 1;
+    return comp_channels[i].ready ? &comp_channels[i] : NULL;
+}
+#endif
 
 /******************************* POST BOOT FUNCTIONALITY *********************************/
 /**
- * @brief Secure Send 
+ * @brief Secure Send Vector
  * 
  * @param address: i2c_addr_t, I2C address of recipient
- * @param buffer: uint8_t*, pointer to data to be send
- * @param len: uint8_t, size of data to be sent 
+ * @param frags: const msg_record_t*, fragments of the data, sent one after another
+ * @param n: int, number of fragments
  * 
- * Securely send data over I2C. This function is utilized in POST_BOOT functionality.
- * This function must be implemented by your team to align with the security requirements.
-
+ * @return int: 0 if the message was sent, negative if error or the fragments
+ * add up to more than MSG_RECORD_MAX_LEN bytes
+ * 
+ * Like secure_send, but gathers the fragments straight into the frame, so a
+ * header and a payload kept apart need no staging buffer
 */
-int secure_send(uint8_t address, uint8_t* buffer, uint8_t len) {
+int secure_sendv(uint8_t address, const msg_record_t* frags, int n) {
+    // The receiver drops longer bodies, so do not start a handshake for one
+    if (msg_gather_len(frags, n) > MSG_RECORD_MAX_LEN) {
+        return ERROR_RETURN;
+    }
+
     reset_msg();
 
+#ifdef POST_BOOT_SESSION
+    // A single frame on the post-boot channel, no handshake
+    msg_channel_t* channel = post_boot_channel(address);
+    if (channel != NULL) {
+        if (msg_gather(frags, n) < 0) {
+            return ERROR_RETURN;
+        }
+        return ap_channel_transmit(channel, address);
+    }
+#endif
+
     // Initiate handshake
     int result = ap_transmit(address);
     if (result != SUCCESS_RETURN) {
@@ -109,488 +568,4172 @@ int secure_send(uint8_t address, uint8_t* buffer, uint8_t len) {
     }
 
     // If everything passes up to this point, actually send the message
-    // First byte of transmit.contents is len, then transmit.contents[1..] holds
-    // the actual message
-    transmit.contents[0] = len;
-    memcpy(&(transmit.contents[1]), buffer, len);
+    if (msg_gather(frags, n) < 0) {
+        return ERROR_RETURN;
+    }
 
     return ap_transmit(address);
 }
 
 /**
- * @brief Secure Receive
- * 
- * @param address: i2c_addr_t, I2C address of sender
- * @param buffer: uint8_t*, pointer to buffer to receive data to
+ * @brief Secure Send 
  * 
- * @return int: number of bytes received, negative if error
+ * @param address: i2c_addr_t, I2C address of recipient
+ * @param buffer: uint8_t*, pointer to data to be send
+ * @param len: uint8_t, size of data to be sent 
  * 
- * Securely receive data over I2C. This function is utilized in POST_BOOT functionality.
+ * Securely send data over I2C. This function is utilized in POST_BOOT functionality.
  * This function must be implemented by your team to align with the security requirements.
+
 */
-int secure_receive(i2c_addr_t address, uint8_t* buffer) {
-    reset_msg();
+int secure_send(uint8_t address, uint8_t* buffer, uint8_t len) {
+    msg_record_t frag = { buffer, len };
+    return secure_sendv(address, &frag, 1);
+}
 
-    // Receive first part, don't check rng challenge
-    int result = ap_poll_recv(address, 1);
-    if (result != SUCCESS_RETURN) {
-        return -1;
+// Returned by secure_receive_any and secure_receive_timeout when nothing came
+#define SECURE_RECV_TIMEOUT -2
+// Timeout of secure_receive_any that never gives up
+#define SECURE_WAIT_FOREVER UINT32_MAX
+
+// Address secure_receive_any tries first, moves on every call
+static unsigned receive_any_next;
+
+/**
+ * @brief Take the first frame of a secure_receive if it is waiting
+ * 
+ * @param address: i2c_addr_t, I2C address of sender
+ * 
+ * @return int: AP_SUCCESS if it came in, AP_PENDING if nothing is waiting,
+ * negative if error
+*/
+static int secure_receive_try(i2c_addr_t address) {
+    reset_msg();
+#ifdef POST_BOOT_SESSION
+    msg_channel_t* channel = post_boot_channel(address);
+    if (channel != NULL) {
+        return ap_channel_try_recv(channel, address);
     }
+#endif
+    // Don't check rng challenge on the first part
+    return ap_try_recv(address, 1);
+}
 
-    // Send second half of handshake
-    ap_transmit(address);
+/**
+ * @brief Finish a secure_receive whose first frame came in
+ * 
+ * @param address: i2c_addr_t, I2C address of sender
+ * @param data: const uint8_t**, set to the data inside the decrypted frame
+ * 
+ * @return int: number of bytes received, negative if error
+*/
+static int secure_receive_finish(i2c_addr_t address, const uint8_t** data) {
+    bool handshake = true;
+#ifdef POST_BOOT_SESSION
+    // A single frame on the post-boot channel, no handshake
+    handshake = (post_boot_channel(address) == NULL);
+#endif
+    if (handshake) {
+        // Send second half of handshake
+        ap_transmit(address);
 
-    // Receive last part of handshake, which includes the message
-    result = ap_poll_recv(address, 0);
-    if (result != SUCCESS_RETURN) {
-        return -1;
+        // Receive last part of handshake, which includes the message
+        if (ap_poll_recv(address, 0) != SUCCESS_RETURN) {
+            return -1;
+        }
     }
 
-    // Length is at first byte of contents
-    uint8_t len = receive.contents[0];
+    msg_post_boot_t* post = MSG_BODY(receive, msg_post_boot_t);
     // Cap length according to detailed specifications
-    if (len > 64) {
+    if (post->len > 64) {
         return -1;
     }
 
-    memcpy(buffer, &(receive.contents[1]), len);
-    return len;
+    *data = post->data;
+    return post->len;
 }
 
 /**
- * @brief Get Provisioned IDs
+ * @brief Secure Receive View
  * 
- * @param uint32_t* buffer
+ * @param address: i2c_addr_t, I2C address of sender
+ * @param data: const uint8_t**, set to the data inside the decrypted frame
  * 
- * @return int: number of ids
+ * @return int: number of bytes received, negative if error
  * 
- * Return the currently provisioned IDs and the number of provisioned IDs
- * for the current AP. This functionality is utilized in POST_BOOT functionality.
- * This function must be implemented by your team.
+ * Like secure_receive without the copy. The data stays valid until the next
+ * post-boot call or secure_receive_release, whichever comes first.
 */
-int get_provisioned_ids(uint32_t* buffer) {
-    memcpy(buffer, flash_status.component_ids, flash_status.component_cnt * sizeof(uint32_t));
-    return flash_status.component_cnt;
-}
-
-/********************************* UTILITIES **********************************/
-
-// Initialize the device
-// This must be called on startup to initialize the flash and i2c interfaces
-void init() {
-
-    // Enable global interrupts    
-    __enable_irq();
-
-    // Setup Flash
-    flash_simple_init();
-
-    // Pull info from flash
-    flash_simple_read(FLASH_ADDR, (uint32_t*)&flash_status, sizeof(flash_entry));
-
-    // Decrypt flash
-    uint8_t decryptedFlash[FLASH_ENC_LEN];
-    aes_decrypt((uint8_t*)&flash_status, decryptedFlash, flash_status.iv, FLASH_ENC_LEN);
-    memcpy((uint8_t*)&flash_status, decryptedFlash, FLASH_ENC_LEN);
-    
-    // Validate hash
-    uint8_t flashHash[HASH_LEN];
-    hash((uint8_t*)&flash_status, flashHash, FLASH_ENC_LEN - 24);
-    int hash_result = ERROR_RETURN;
-    if (!memcmp(flash_status.hash, flashHash, HASH_LEN)) {
-        hash_result = SUCCESS_RETURN;
-    }
-    
-    // Check magic value
-    int magic_result = ERROR_RETURN;
-    if (flash_status.flash_magic == FLASH_MAGIC) {
-        magic_result = SUCCESS_RETURN;
-    }
-
-    // If hash or magic check fails, rewrite flash with encrypted data & valid hash
-    // Invalid hash means either first boot or someone has messed with our flash memory
-
-    // Write Component IDs from flash if first boot e.g. flash unwritten
-    if (magic_result != SUCCESS_RETURN || hash_result != SUCCESS_RETURN) {
-        print_debug("Failed to verify flash integrity, resetting flash!\n");
-
-        flash_status.flash_magic = FLASH_MAGIC;
-        flash_status.component_cnt = COMPONENT_CNT;
-        uint32_t component_ids[COMPONENT_CNT] = {COMPONENT_IDS};
-        memcpy(flash_status.component_ids, component_ids, 
-            COMPONENT_CNT*sizeof(uint32_t));
-
-        // Construct hash
-        hash((uint8_t*)&flash_status, flash_status.hash, FLASH_ENC_LEN - 24);
-
-        // Generate an IV
-        uint64_t randValue;
-        randValue = rng_gen();
-        memcpy(&flash_status.iv[0], &randValue, sizeof(randValue));
-        randValue = rng_gen();
-        memcpy(&flash_status.iv[8], &randValue, sizeof(randValue));
-
-        // Create an encrypted copy of the flash data to write to flash
-        flash_entry encrypted_flash;
-        memcpy((uint8_t*)&encrypted_flash, (uint8_t*)&flash_status, sizeof(flash_entry));
-        aes_encrypt((uint8_t*)&flash_status, (uint8_t*)&encrypted_flash, flash_status.iv, FLASH_ENC_LEN);
-        
-        flash_simple_erase_page(FLASH_ADDR);
-        flash_simple_write(FLASH_ADDR, (uint32_t*)&encrypted_flash, sizeof(flash_entry));
-    }
-    
-    // Initialize board link interface
-    board_link_init();
-}
+int secure_receive_view(i2c_addr_t address, const uint8_t** data) {
+    reset_msg();
 
-// Send a command to a component and receive the result
-int issue_cmd(i2c_addr_t addr) {
-    // Send message
-    int result = ap_transmit(addr);
-    if (result != SUCCESS_RETURN) {
-        return ERROR_RETURN;
+    int result;
+#ifdef POST_BOOT_SESSION
+    msg_channel_t* channel = post_boot_channel(address);
+    if (channel != NULL) {
+        result = ap_channel_poll_recv(channel, address);
+    } else
+#endif
+    {
+        // Receive first part, don't check rng challenge
+        result = ap_poll_recv(address, 1);
     }
-    
-    // Receive message
-    result = ap_poll_recv(addr, 0);
     if (result != SUCCESS_RETURN) {
-        return ERROR_RETURN;
+        return -1;
     }
-
-    return SUCCESS_RETURN;
+    return secure_receive_finish(address, data);
 }
 
-/******************************** COMPONENT COMMS ********************************/
+/**
+ * @brief Secure Receive Release
+ * 
+ * Wipes the frame a secure_receive_view pointed into
+*/
+void secure_receive_release(void) {
+    reset_msg();
+}
 
-int scan_components() {
-    // Print out provisioned component IDs
-    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
-        print_info("P>0x%08x\n", flash_status.component_ids[i]);
+/**
+ * @brief Secure Receive
+ * 
+ * @param address: i2c_addr_t, I2C address of sender
+ * @param buffer: uint8_t*, pointer to buffer to receive data to
+ * 
+ * @return int: number of bytes received, negative if error
+ * 
+ * Securely receive data over I2C. This function is utilized in POST_BOOT functionality.
+ * This function must be implemented by your team to align with the security requirements.
+*/
+int secure_receive(i2c_addr_t address, uint8_t* buffer) {
+    const uint8_t* data;
+    int len = secure_receive_view(address, &data);
+    if (len < 0) {
+        return -1;
     }
 
-    // Buffers for board link communication
-
-    // Scan scan command to each i2c bus address 
-    for (i2c_addr_t addr = 0x8; addr < 0x78; addr++) {
-        // I2C Blacklist - 0x36 conflicts with separate device on MAX78000FTHR
-        if (addr == 0x18 || addr == 0x28 || addr == 0x36) {
-            continue;
-        }
-        
-        // Assume component is alive -- get its ID 
-        transmit.opcode = COMPONENT_CMD_SCAN;
-        
-        // Send out command and receive result
-        int result = issue_cmd(addr);
+    memcpy(buffer, data, len);
+    return len;
+}
 
-        // Success, device is present and we have communicated with it again
+/**
+ * @brief Secure Receive Any
+ * 
+ * @param addrs: const i2c_addr_t*, I2C addresses of the senders to wait on
+ * @param n: int, number of addresses
+ * @param buffer: uint8_t*, pointer to buffer to receive data to
+ * @param timeout_us: uint32_t, longest time to wait, 0 for a single sweep,
+ * SECURE_WAIT_FOREVER to never give up
+ * @param from: i2c_addr_t*, set to the sender, may be NULL
+ * 
+ * @return int: number of bytes received, SECURE_RECV_TIMEOUT if no sender
+ * had anything before the timeout, -1 if error
+ * 
+ * Receives from whichever sender is ready first. Every sweep costs one read
+ * per sender, starting one further along each call so none is starved, and
+ * between sweeps the wait ends as soon as the ready line is asserted. Only
+ * the first frame is waited on this way: without a post-boot channel the
+ * rest of the handshake with the sender that started it blocks as in
+ * secure_receive. An error ends the call with *from set to that sender.
+*/
+int secure_receive_any(const i2c_addr_t* addrs, int n, uint8_t* buffer, uint32_t timeout_us, i2c_addr_t* from) {
+    if (n <= 0) {
+        return -1;
+    }
+
+    uint32_t delay = POLL_READY_SLICE_US;
+    uint32_t waited = 0;
+    while (true) {
+        for (int k = 0; k < n; k++) {
+            int i = (receive_any_next + k) % n;
+            int result = secure_receive_try(addrs[i]);
+            if (result == AP_PENDING) {
+                continue;
+            }
+            receive_any_next = i + 1;
+            if (from != NULL) {
+                *from = addrs[i];
+            }
+            if (result != SUCCESS_RETURN) {
+                return -1;
+            }
+            const uint8_t* data;
+            int len = secure_receive_finish(addrs[i], &data);
+            if (len < 0) {
+                return -1;
+            }
+            memcpy(buffer, data, len);
+            return len;
+        }
+
+        if (timeout_us != SECURE_WAIT_FOREVER && waited >= timeout_us) {
+            return SECURE_RECV_TIMEOUT;
+        }
+        uint32_t slice = delay;
+        if (timeout_us != SECURE_WAIT_FOREVER && slice > timeout_us - waited) {
+            slice = timeout_us - waited;
+        }
+        // A ready line held by a component outside addrs ends every wait at
+        // once, count the sweep so the timeout still runs out
+        uint32_t w = board_link_wait_ready(slice);
+        waited += (w > 0) ? w : POLL_READY_SLICE_US;
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+}
+
+/**
+ * @brief Secure Receive Timeout
+ * 
+ * @param address: i2c_addr_t, I2C address of sender
+ * @param buffer: uint8_t*, pointer to buffer to receive data to
+ * @param timeout_us: uint32_t, longest time to wait, 0 to only check
+ * 
+ * @return int: number of bytes received, SECURE_RECV_TIMEOUT if nothing
+ * came before the timeout, -1 if error
+*/
+int secure_receive_timeout(i2c_addr_t address, uint8_t* buffer, uint32_t timeout_us) {
+    return secure_receive_any(&address, 1, buffer, timeout_us, NULL);
+}
+
+#ifdef POST_BOOT_PT
+// Waits in a protothread until a secure_receive from address is done, len
+// gets its result
+#define PT_SECURE_RECEIVE(pt, address, buffer, len) \
+    PT_WAIT_UNTIL(pt, ((len) = secure_receive_timeout((address), (buffer), 0)) != SECURE_RECV_TIMEOUT)
+
+/**
+ * @brief Run protothreads until every one of them has finished
+ * 
+ * @param tasks: pt_task_t*, threads with thread and ctx set, the rest is set up here
+ * @param n: int, number of threads
+ * 
+ * @return int: number of threads that ended with PT_EXIT
+ * 
+ * Calls each unfinished thread in turn. A sweep in which none of them got
+ * past a wait is followed by a backed off wait on the ready line, as in
+ * secure_receive_any, during which queued LINK_ASYNC transactions move on.
+*/
+int pt_run(pt_task_t* tasks, int n) {
+    int live = n;
+    int exited = 0;
+    for (int i = 0; i < n; i++) {
+        PT_INIT(&tasks[i].pt);
+        tasks[i].state = PT_WAITING;
+    }
+
+    uint32_t delay = POLL_READY_SLICE_US;
+    while (live > 0) {
+        bool progress = false;
+        for (int i = 0; i < n; i++) {
+            pt_task_t* task = &tasks[i];
+            if (task->state >= PT_EXITED) {
+                continue;
+            }
+            uint16_t lc = task->pt.lc;
+            task->state = task->thread(&task->pt, task->ctx);
+            if (task->state >= PT_EXITED) {
+                live--;
+                exited += (task->state == PT_EXITED);
+                progress = true;
+            } else if (task->state == PT_YIELDED || task->pt.lc != lc) {
+                progress = true;
+            }
+        }
+        if (progress) {
+            delay = POLL_READY_SLICE_US;
+            continue;
+        }
+
+        // Every thread waits on a component
+        uint32_t w = board_link_wait_ready(delay);
+#if defined(LINK_ASYNC) && !defined(AP_RTOS)
+        link_run((w > 0) ? w : delay);
+#else
+        (void)w;
+#endif
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+    return exited;
+}
+#endif
+
+/**
+ * @brief Secure Send Batch
+ * 
+ * @param address: i2c_addr_t, I2C address of recipient
+ * @param records: msg_record_t*, records to be sent, each at most MSG_RECORD_MAX_LEN bytes
+ * @param n: int, number of records
+ * 
+ * @return int: number of records sent, negative if error
+ * 
+ * Like secure_send, but packs as many records as fit into one frame so they
+ * share a single handshake. Send whatever is left over with another call.
+*/
+int secure_send_batch(uint8_t address, const msg_record_t* records, int n) {
+    reset_msg();
+
+#ifdef POST_BOOT_SESSION
+    // A single frame on the post-boot channel, no handshake
+    msg_channel_t* channel = post_boot_channel(address);
+    if (channel != NULL) {
+        int count = msg_pack_records(records, n);
+        if (count < 0 || ap_channel_transmit(channel, address) != SUCCESS_RETURN) {
+            return ERROR_RETURN;
+        }
+        return count;
+    }
+#endif
+
+    // Initiate handshake
+    if (ap_transmit(address) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+
+    // Receive next part of handshake
+    if (ap_poll_recv(address, 0) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+
+    int count = msg_pack_records(records, n);
+    if (count < 0) {
+        return ERROR_RETURN;
+    }
+
+    if (ap_transmit(address) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+    return count;
+}
+
+/**
+ * @brief Secure Receive Batch
+ * 
+ * @param address: i2c_addr_t, I2C address of sender
+ * @param records: msg_record_t*, records to receive into, each buf holds MSG_RECORD_MAX_LEN bytes
+ * @param n: int, number of records available
+ * 
+ * @return int: number of records received, negative if error
+ * 
+ * Receives a frame sent with secure_send_batch
+*/
+int secure_receive_batch(i2c_addr_t address, msg_record_t* records, int n) {
+    reset_msg();
+
+#ifdef POST_BOOT_SESSION
+    // A single frame on the post-boot channel, no handshake
+    msg_channel_t* channel = post_boot_channel(address);
+    if (channel != NULL) {
+        if (ap_channel_poll_recv(channel, address) != SUCCESS_RETURN) {
+            return ERROR_RETURN;
+        }
+        return msg_unpack_records(records, n);
+    }
+#endif
+
+    // Receive first part, don't check rng challenge
+    if (ap_poll_recv(address, 1) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+
+    // Send second half of handshake
+    ap_transmit(address);
+
+    // Receive last part of handshake, which includes the records
+    if (ap_poll_recv(address, 0) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+
+    return msg_unpack_records(records, n);
+}
+
+#ifdef MSG_STREAM
+/**
+ * @brief Secure Stream Open
+ * 
+ * @param stream: msg_stream_t*, stream state to set up
+ * @param address: i2c_addr_t, I2C address of the component
+ * @param direction: int, MSG_STREAM_AP_WRITES or MSG_STREAM_AP_READS, with
+ * MSG_STREAM_LZ ORed with MSG_STREAM_COMPRESS for compressed data
+ * 
+ * @return int: SUCCESS_RETURN if the component accepted the stream, negative if error
+ * 
+ * Opens a stream for bulk transfers, on the post-boot channel when there is
+ * one. Transfer with ap_stream_write / ap_stream_read, finish with ap_stream_close.
+ * Never compress secrets or anything an attacker chooses, see msg_core.h.
+*/
+int secure_stream_open(msg_stream_t* stream, i2c_addr_t address, int direction) {
+    reset_msg();
+
+    msg_channel_t* channel = NULL;
+#ifdef POST_BOOT_SESSION
+    channel = post_boot_channel(address);
+#endif
+    return ap_stream_open(stream, channel, address, direction);
+}
+#endif
+
+#ifdef MSG_JUMBO
+/**
+ * @brief Secure Send Jumbo
+ * 
+ * @param address: i2c_addr_t, I2C address of recipient
+ * @param buffer: const uint8_t*, pointer to data to be sent
+ * @param len: int, size of data to be sent, at most MSG_JUMBO_MAX_LEN
+ * 
+ * @return int: 0 if the message was sent, negative if error
+ * 
+ * Sends data larger than one frame holds as a single jumbo frame, one
+ * authentication over all of it. Needs the post-boot channel.
+*/
+int secure_send_jumbo(i2c_addr_t address, const uint8_t* buffer, int len) {
+    reset_msg();
+
+    msg_channel_t* channel = post_boot_channel(address);
+    if (channel == NULL) {
+        return ERROR_RETURN;
+    }
+    return ap_jumbo_send(channel, address, buffer, len);
+}
+
+/**
+ * @brief Secure Receive Jumbo
+ * 
+ * @param address: i2c_addr_t, I2C address of sender
+ * @param buffer: uint8_t*, pointer to buffer to receive data to
+ * @param maxlen: int, size of buffer
+ * 
+ * @return int: number of bytes received, negative if error
+ * 
+ * Receives a jumbo frame sent with the component's secure_send_jumbo. Needs
+ * the post-boot channel.
+*/
+int secure_receive_jumbo(i2c_addr_t address, uint8_t* buffer, int maxlen) {
+    reset_msg();
+
+    msg_channel_t* channel = post_boot_channel(address);
+    if (channel == NULL) {
+        return ERROR_RETURN;
+    }
+    return ap_jumbo_recv(channel, address, buffer, maxlen);
+}
+#endif
+
+#ifdef MSG_SCHED
+#ifndef MSG_STREAM
+#error "MSG_SCHED needs MSG_STREAM"
+#endif
+#ifndef MSG_SCHED_CONTROL_SLOTS
+#define MSG_SCHED_CONTROL_SLOTS 4
+#endif
+#ifndef MSG_SCHED_BULK_SLOTS
+#define MSG_SCHED_BULK_SLOTS 2
+#endif
+// Most data one control message carries
+#define MSG_SCHED_CONTROL_MAX_LEN (MAX_CONTENTS_LEN - 1)
+
+// Per-component accounting of the link scheduler. Waits are counted in frames
+// the scheduler sent between queueing a control message and sending it, which
+// is at most the control messages queued before it plus one bulk chunk and
+// the stream ACK that may follow it
+typedef struct sched_stats_t {
+    uint32_t control_sent;
+    uint32_t control_wait_max;
+    uint32_t bulk_bytes;
+    uint32_t failures;          // Messages and transfers dropped after a link error
+} sched_stats_t;
+
+// Indexed like flash_status.component_ids
+sched_stats_t sched_stats[MAX_COMPONENTS];
+
+static struct {
+    i2c_addr_t address;
+    uint8_t len;
+    uint8_t data[MSG_SCHED_CONTROL_MAX_LEN];
+    uint32_t queued_at;         // sched_frames when it was queued
+} control_queue[MSG_SCHED_CONTROL_SLOTS];
+static unsigned control_head;
+static unsigned control_cnt;
+
+static struct {
+    msg_stream_t stream;
+    i2c_addr_t address;
+    const uint8_t* buf;
+    int len;
+    int sent;
+    bool active;
+} bulk_jobs[MSG_SCHED_BULK_SLOTS];
+// Bulk transfer the next chunk comes from
+static unsigned bulk_next;
+// Frames the scheduler has sent
+static uint32_t sched_frames;
+
+/**
+ * @brief Sched Send Control
+ * 
+ * @param address: i2c_addr_t, I2C address of recipient
+ * @param buffer: uint8_t*, pointer to data to be sent
+ * @param len: uint8_t, size of data, at most MSG_SCHED_CONTROL_MAX_LEN
+ * 
+ * @return int: SUCCESS_RETURN if queued, negative if error or the queue is full
+ * 
+ * Queues a control message, sent by sched_run ahead of every bulk chunk still
+ * waiting. Components take it with secure_receive, or through the stream's
+ * control callback while reading a bulk transfer
+*/
+int sched_send_control(i2c_addr_t address, uint8_t* buffer, uint8_t len) {
+    if (control_cnt == MSG_SCHED_CONTROL_SLOTS || len > MSG_SCHED_CONTROL_MAX_LEN ||
+        post_boot_channel(address) == NULL) {
+        return ERROR_RETURN;
+    }
+    unsigned slot = (control_head + control_cnt) % MSG_SCHED_CONTROL_SLOTS;
+    control_queue[slot].address = address;
+    control_queue[slot].len = len;
+    memcpy(control_queue[slot].data, buffer, len);
+    control_queue[slot].queued_at = sched_frames;
+    control_cnt++;
+    return SUCCESS_RETURN;
+}
+
+/**
+ * @brief Sched Send Bulk
+ * 
+ * @param address: i2c_addr_t, I2C address of recipient
+ * @param buffer: const uint8_t*, data to be sent, must stay valid until the
+ *     transfer is done
+ * @param len: int, size of data
+ * 
+ * @return int: SUCCESS_RETURN once the component accepted the stream,
+ *     negative if error or MSG_SCHED_BULK_SLOTS transfers are running
+ * 
+ * Opens a stream to the component, sched_run then sends it one chunk at a
+ * time between control messages. The component reads it with
+ * secure_stream_accept and comp_stream_read
+*/
+int sched_send_bulk(i2c_addr_t address, const uint8_t* buffer, int len) {
+    for (int i = 0; i < MSG_SCHED_BULK_SLOTS; i++) {
+        if (bulk_jobs[i].active) {
+            continue;
+        }
+        if (post_boot_channel(address) == NULL || len < 0 ||
+            secure_stream_open(&bulk_jobs[i].stream, address, MSG_STREAM_AP_WRITES) != SUCCESS_RETURN) {
+            return ERROR_RETURN;
+        }
+        sched_frames++;
+        bulk_jobs[i].address = address;
+        bulk_jobs[i].buf = buffer;
+        bulk_jobs[i].len = len;
+        bulk_jobs[i].sent = 0;
+        bulk_jobs[i].active = true;
+        return SUCCESS_RETURN;
+    }
+    return ERROR_RETURN;
+}
+
+/**
+ * @brief Send every queued control message
+*/
+static void sched_drain_control() {
+    while (control_cnt > 0) {
+        unsigned slot = control_head;
+        i2c_addr_t address = control_queue[slot].address;
+        sched_stats_t* stats = &sched_stats[addr_components[address] - 1];
+        msg_channel_t* channel = post_boot_channel(address);
+
+        reset_msg();
+        msg_post_boot_t* post = MSG_BODY(transmit, msg_post_boot_t);
+        post->len = control_queue[slot].len;
+        memcpy(post->data, control_queue[slot].data, post->len);
+        transmit.opcode = MSG_OPCODE_CONTROL;
+        transmit.len = post->len + 1;
+        if (channel == NULL || ap_channel_transmit(channel, address) != SUCCESS_RETURN) {
+            stats->failures++;
+        } else {
+            uint32_t wait = sched_frames - control_queue[slot].queued_at;
+            if (wait > stats->control_wait_max) {
+                stats->control_wait_max = wait;
+            }
+            stats->control_sent++;
+        }
+        sched_frames++;
+
+        control_head = (control_head + 1) % MSG_SCHED_CONTROL_SLOTS;
+        control_cnt--;
+    }
+}
+
+/**
+ * @brief Sched Run
+ * 
+ * @return int: control messages and bulk transfers still waiting
+ * 
+ * Sends every queued control message, then the next chunk of one bulk
+ * transfer, taking the transfers in turn. Call it in a loop, control
+ * messages queued in between then wait for a single chunk at most. A
+ * transfer that fails is closed and counted in sched_stats
+*/
+int sched_run() {
+    sched_drain_control();
+
+    for (int k = 0; k < MSG_SCHED_BULK_SLOTS; k++) {
+        unsigned i = (bulk_next + k) % MSG_SCHED_BULK_SLOTS;
+        if (!bulk_jobs[i].active) {
+            continue;
+        }
+        bulk_next = (i + 1) % MSG_SCHED_BULK_SLOTS;
+
+        i2c_addr_t address = bulk_jobs[i].address;
+        sched_stats_t* stats = &sched_stats[addr_components[address] - 1];
+        int n = bulk_jobs[i].len - bulk_jobs[i].sent;
+        if (n > MSG_STREAM_CHUNK_LEN) {
+            n = MSG_STREAM_CHUNK_LEN;
+        }
+
+        int result = SUCCESS_RETURN;
+        reset_msg();
+        if (n > 0) {
+            result = ap_stream_write(&bulk_jobs[i].stream, address, &bulk_jobs[i].buf[bulk_jobs[i].sent], n);
+            bulk_jobs[i].sent += n;
+            stats->bulk_bytes += n;
+        }
+        // Everything sent goes out with the FIN, a failed chunk ends the transfer too
+        if (n == 0 || result != SUCCESS_RETURN) {
+            if (ap_stream_close(&bulk_jobs[i].stream, address) != SUCCESS_RETURN) {
+                result = ERROR_RETURN;
+            }
+            if (result != SUCCESS_RETURN) {
+                stats->failures++;
+            }
+            bulk_jobs[i].active = false;
+        }
+        sched_frames++;
+        break;
+    }
+
+    int waiting = control_cnt;
+    for (int i = 0; i < MSG_SCHED_BULK_SLOTS; i++) {
+        waiting += bulk_jobs[i].active;
+    }
+    return waiting;
+}
+#endif
+
+#ifdef MSG_RELAY
+// With the utilities below
+static int find_component(uint32_t component_id);
+
+/**
+ * @brief Secure Relay
+ * 
+ * @param address: i2c_addr_t, I2C address of the component sending
+ * @param frames: int, number of frames to forward
+ * 
+ * @return int: number of frames forwarded, negative if error
+ * 
+ * Forwards frames a component sends with secure_send_to to the components
+ * they are addressed to. Each frame is opened on the sender's post-boot
+ * channel, its routing header swapped for the sender's ID and sealed again
+ * on the receiver's, without the data leaving the frame buffers. Stops at
+ * the first frame that does not authenticate or names a component without
+ * an open channel.
+*/
+int secure_relay(i2c_addr_t address, int frames) {
+    msg_channel_t* from = post_boot_channel(address);
+    if (from == NULL) {
+        return ERROR_RETURN;
+    }
+    uint32_t from_id = flash_status.component_ids[addr_components[address] - 1];
+
+    int forwarded = 0;
+    while (forwarded < frames) {
+        reset_msg();
+        if (ap_channel_poll_recv(from, address) != SUCCESS_RETURN) {
+            return ERROR_RETURN;
+        }
+        msg_relay_t* relay = MSG_BODY(receive, msg_relay_t);
+        if (receive.opcode != MSG_OPCODE_RELAY || receive.len < 5 ||
+            relay->len > MSG_RELAY_MAX_LEN || receive.len != relay->len + 5) {
+            return ERROR_RETURN;
+        }
+        int peer = find_component(relay->peer);
+        if (peer < 0) {
+            return ERROR_RETURN;
+        }
+        i2c_addr_t to = component_addrs[peer];
+        msg_channel_t* channel = post_boot_channel(to);
+        if (channel == NULL || to == address ||
+            flash_status.component_ids[addr_components[to] - 1] != relay->peer) {
+            return ERROR_RETURN;
+        }
+
+        relay->peer = from_id;
+        transmit.opcode = MSG_OPCODE_RELAY;
+        transmit.len = receive.len;
+        memcpy(transmit.contents, receive.contents, receive.len);
+        if (ap_channel_transmit(channel, to) != SUCCESS_RETURN) {
+            return ERROR_RETURN;
+        }
+        forwarded++;
+    }
+    return forwarded;
+}
+#endif
+
+#ifdef MSG_PUBSUB
+#ifndef MSG_PUBSUB_TOPICS
+#define MSG_PUBSUB_TOPICS 8
+#endif
+
+// Called with every frame published on a subscribed topic
+typedef void (*pubsub_callback_t)(uint32_t component_id, uint8_t topic, const uint8_t* data, uint8_t len);
+
+static struct {
+    uint8_t topic;
+    pubsub_callback_t callback;
+} subscriptions[MSG_PUBSUB_TOPICS];
+static unsigned subscription_cnt;
+// Component pubsub_poll starts with, moves on every call
+static unsigned pubsub_next;
+
+/**
+ * @brief Pubsub Subscribe
+ * 
+ * @param topic: uint8_t, topic to subscribe to
+ * @param callback: pubsub_callback_t, called with every frame on topic
+ * 
+ * @return int: 0 if subscribed, negative if MSG_PUBSUB_TOPICS subscriptions exist
+ * 
+ * A topic may have several callbacks, they are called in the order they subscribed
+*/
+int pubsub_subscribe(uint8_t topic, pubsub_callback_t callback) {
+    if (subscription_cnt == MSG_PUBSUB_TOPICS || callback == NULL) {
+        return ERROR_RETURN;
+    }
+    subscriptions[subscription_cnt].topic = topic;
+    subscriptions[subscription_cnt].callback = callback;
+    subscription_cnt++;
+    return SUCCESS_RETURN;
+}
+
+/**
+ * @brief Pubsub Poll
+ * 
+ * @param burst: int, most frames taken from one component per call
+ * 
+ * @return int: number of frames delivered to subscribers
+ * 
+ * Takes the frames components queued with secure_publish, visiting every
+ * component with an open post-boot channel once, starting one further along
+ * each call. A component with nothing waiting costs a single read, so a slow
+ * one holds up no other. Frames that do not authenticate end that
+ * component's turn, frames other than publications are dropped.
+*/
+int pubsub_poll(int burst) {
+    int delivered = 0;
+    unsigned cnt = flash_status.component_cnt;
+    if (cnt == 0) {
+        return 0;
+    }
+
+    for (unsigned k = 0; k < cnt; k++) {
+        unsigned i = (pubsub_next + k) % cnt;
+        if (!comp_channels[i].ready) {
+            continue;
+        }
+        uint32_t component_id = flash_status.component_ids[i];
+        i2c_addr_t address = component_addrs[i];
+
+        for (int f = 0; f < burst; f++) {
+            reset_msg();
+            if (ap_channel_try_recv(&comp_channels[i], address) != SUCCESS_RETURN) {
+                break;
+            }
+            msg_publish_t* pub = MSG_BODY(receive, msg_publish_t);
+            if (receive.opcode != MSG_OPCODE_PUBLISH || receive.len < 2 ||
+                pub->len > MSG_PUBLISH_MAX_LEN || receive.len != pub->len + 2) {
+                continue;
+            }
+            for (unsigned s = 0; s < subscription_cnt; s++) {
+                if (subscriptions[s].topic == pub->topic) {
+                    subscriptions[s].callback(component_id, pub->topic, pub->data, pub->len);
+                }
+            }
+            delivered++;
+        }
+    }
+    pubsub_next = (pubsub_next + 1) % cnt;
+    return delivered;
+}
+#endif
+
+#ifdef MSG_HEARTBEAT
+// Silence after which a component gets a heartbeat
+#ifndef HEARTBEAT_INTERVAL_MS
+#define HEARTBEAT_INTERVAL_MS 1000
+#endif
+// Longest a component may take to answer one
+#ifndef HEARTBEAT_TIMEOUT_MS
+#define HEARTBEAT_TIMEOUT_MS 50
+#endif
+
+// Called once for every component that stops answering heartbeats
+typedef void (*heartbeat_callback_t)(uint32_t component_id);
+
+// Indexed like flash_status.component_ids: rx_seq of the post-boot channel
+// when it was last checked, time since it last moved, and whether the
+// component was reported dead
+static struct {
+    uint32_t rx_seq;
+    uint32_t silent_us;
+    bool dead;
+} heartbeats[MAX_COMPONENTS];
+static heartbeat_callback_t heartbeat_callback;
+
+/**
+ * @brief Heartbeat Watch
+ * 
+ * @param callback: heartbeat_callback_t, called with every component that
+ * stops answering, NULL for none
+*/
+void heartbeat_watch(heartbeat_callback_t callback) {
+    heartbeat_callback = callback;
+}
+
+/**
+ * @brief Heartbeat Probe
+ * 
+ * @param i: unsigned, index in flash_status.component_ids
+ * 
+ * @return bool: whether the component answered within HEARTBEAT_TIMEOUT_MS
+ * 
+ * Sends a heartbeat and waits for rx_seq to move. A frame other than the
+ * answer also shows the component is alive, but is dropped like in
+ * pubsub_poll.
+*/
+static bool heartbeat_probe(unsigned i) {
+    msg_channel_t* channel = &comp_channels[i];
+    i2c_addr_t address = component_addrs[i];
+    uint32_t rx_seq = channel->rx_seq;
+
+    reset_msg();
+    transmit.opcode = MSG_OPCODE_HEARTBEAT;
+    transmit.len = 0;
+    if (ap_channel_transmit(channel, address) != SUCCESS_RETURN) {
+        return false;
+    }
+
+    uint32_t delay = POLL_READY_SLICE_US;
+    uint32_t waited = 0;
+    while (true) {
+        int result = ap_channel_try_recv(channel, address);
+        if (channel->rx_seq != rx_seq) {
+            reset_msg();
+            return true;
+        }
+        if (result != AP_PENDING || waited >= HEARTBEAT_TIMEOUT_MS * 1000) {
+            return false;
+        }
+        uint32_t w = board_link_wait_ready(delay);
+        waited += (w > 0) ? w : POLL_READY_SLICE_US;
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+}
+
+/**
+ * @brief Heartbeat Poll
+ * 
+ * @param elapsed_us: uint32_t, time since the last call
+ * 
+ * @return int: number of components found dead by this call
+ * 
+ * Call it from the post-boot main loop. Any frame that came in on a
+ * component's post-boot channel since the last call counts as a heartbeat,
+ * so busy links cost nothing. A component silent for HEARTBEAT_INTERVAL_MS
+ * gets a heartbeat of its own, which it answers from its next channel
+ * receive, so a dead one is found within the interval, the gap between
+ * calls and HEARTBEAT_TIMEOUT_MS. It is reported to the callback once, and
+ * again only after it was heard from in between.
+*/
+int heartbeat_poll(uint32_t elapsed_us) {
+    int dead = 0;
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        if (!comp_channels[i].ready) {
+            continue;
+        }
+        if (comp_channels[i].rx_seq != heartbeats[i].rx_seq) {
+            heartbeats[i].rx_seq = comp_channels[i].rx_seq;
+            heartbeats[i].silent_us = 0;
+            heartbeats[i].dead = false;
+            continue;
+        }
+        if (heartbeats[i].dead) {
+            continue;
+        }
+        heartbeats[i].silent_us += elapsed_us;
+        if (heartbeats[i].silent_us < HEARTBEAT_INTERVAL_MS * 1000) {
+            continue;
+        }
+
+        if (heartbeat_probe(i)) {
+            heartbeats[i].rx_seq = comp_channels[i].rx_seq;
+            heartbeats[i].silent_us = 0;
+            continue;
+        }
+        heartbeats[i].dead = true;
+        dead++;
+        if (heartbeat_callback != NULL) {
+            heartbeat_callback(flash_status.component_ids[i]);
+        }
+    }
+    return dead;
+}
+#endif
+
+#ifdef MSG_TIMESYNC
+// Longest a component may take to answer one PING
+#ifndef TIME_SYNC_TIMEOUT_MS
+#define TIME_SYNC_TIMEOUT_MS 50
+#endif
+
+/**
+ * @brief Time Sync Round
+ * 
+ * @param channel: msg_channel_t*, post-boot channel to the component
+ * @param address: i2c_addr_t, I2C address of the component
+ * @param offset: int64_t*, set to how far the component's clock is ahead
+ * @param at: uint64_t*, set to the component time the PING came in
+ * 
+ * @return int64_t: round trip in us, negative if no PONG came back
+ * within TIME_SYNC_TIMEOUT_MS
+*/
+static int64_t time_sync_round(msg_channel_t* channel, i2c_addr_t address,
+                               int64_t* offset, uint64_t* at) {
+    msg_timesync_t sync = {.step = TIME_SYNC_PING, .a = 0, .b = 0};
+    uint32_t rx_seq = channel->rx_seq;
+
+    reset_msg();
+    transmit.opcode = MSG_OPCODE_TIMESYNC;
+    transmit.len = sizeof(sync);
+    memcpy(transmit.contents, &sync, sizeof(sync));
+    uint64_t t1 = time_local_us();
+    if (ap_channel_transmit(channel, address) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+
+    uint32_t delay = POLL_READY_SLICE_US;
+    uint32_t waited = 0;
+    while (true) {
+        int result = ap_channel_try_recv(channel, address);
+        if (channel->rx_seq != rx_seq) {
+            uint64_t t4 = time_local_us();
+            rx_seq = channel->rx_seq;
+            if (receive.opcode == MSG_OPCODE_TIMESYNC && receive.len == sizeof(sync)) {
+                memcpy(&sync, receive.contents, sizeof(sync));
+                reset_msg();
+                if (sync.step != TIME_SYNC_PONG) {
+                    return ERROR_RETURN;
+                }
+                uint64_t rtt;
+                *offset = time_sync_offset(t1, sync.a, sync.b, t4, &rtt);
+                *at = sync.a;
+                return (int64_t)rtt;
+            }
+            // Anything else is dropped like in pubsub_poll, the PONG may follow
+            reset_msg();
+            continue;
+        }
+        if (result != AP_PENDING || waited >= TIME_SYNC_TIMEOUT_MS * 1000) {
+            return ERROR_RETURN;
+        }
+        uint32_t w = board_link_wait_ready(delay);
+        waited += (w > 0) ? w : POLL_READY_SLICE_US;
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+}
+
+/**
+ * @brief Time Sync
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * @param rounds: int, PING exchanges to take the best of
+ * 
+ * @return int64_t: round trip of the best exchange in us, negative if the
+ * component has no post-boot channel or none of them came back
+ * 
+ * Runs the exchange in time_sync.h. The component's offset from the round
+ * with the shortest round trip goes back to it in a SET, after which its
+ * time_sync_now follows ours to about half that round trip. Call it again
+ * every so often, seconds apart or more, so the component also learns its
+ * drift.
+*/
+int64_t time_sync(i2c_addr_t address, int rounds) {
+    msg_channel_t* channel = post_boot_channel(address);
+    if (channel == NULL) {
+        return ERROR_RETURN;
+    }
+
+    int64_t best = -1;
+    int64_t best_offset = 0;
+    uint64_t best_at = 0;
+    for (int r = 0; r < rounds; r++) {
+        int64_t offset;
+        uint64_t at;
+        int64_t rtt = time_sync_round(channel, address, &offset, &at);
+        if (rtt >= 0 && (best < 0 || rtt < best)) {
+            best = rtt;
+            best_offset = offset;
+            best_at = at;
+        }
+    }
+    if (best < 0) {
+        return ERROR_RETURN;
+    }
+
+    msg_timesync_t sync = {.step = TIME_SYNC_SET, .a = (uint64_t)(-best_offset), .b = best_at};
+    reset_msg();
+    transmit.opcode = MSG_OPCODE_TIMESYNC;
+    transmit.len = sizeof(sync);
+    memcpy(transmit.contents, &sync, sizeof(sync));
+    if (ap_channel_transmit(channel, address) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+    return best;
+}
+#endif
+
+/**
+ * @brief Get Provisioned IDs
+ * 
+ * @param uint32_t* buffer
+ * 
+ * @return int: number of ids
+ * 
+ * Return the currently provisioned IDs and the number of provisioned IDs
+ * for the current AP. This functionality is utilized in POST_BOOT functionality.
+ * This function must be implemented by your team.
+*/
+int get_provisioned_ids(uint32_t* buffer) {
+    memcpy(buffer, flash_status.component_ids, flash_status.component_cnt * sizeof(uint32_t));
+    return flash_status.component_cnt;
+}
+
+/********************************* UTILITIES **********************************/
+
+// Sort flash_status.component_ids, so find_component can binary search them.
+// Assigned address slots, link metadata and boot levels move along with their IDs
+static void sort_components() {
+    for (unsigned i = 1; i < flash_status.component_cnt; i++) {
+        uint32_t id = flash_status.component_ids[i];
+#ifdef ADDR_ASSIGN
+        uint8_t slot = flash_status.addr_slots[i];
+#endif
+#ifdef LINK_META
+        link_meta_t meta = flash_status.link_meta[i];
+#endif
+#ifdef BOOT_GROUPS
+        uint8_t level = flash_status.boot_levels[i];
+#endif
+        unsigned j = i;
+        while (j > 0 && flash_status.component_ids[j - 1] > id) {
+            flash_status.component_ids[j] = flash_status.component_ids[j - 1];
+#ifdef ADDR_ASSIGN
+            flash_status.addr_slots[j] = flash_status.addr_slots[j - 1];
+#endif
+#ifdef LINK_META
+            flash_status.link_meta[j] = flash_status.link_meta[j - 1];
+#endif
+#ifdef BOOT_GROUPS
+            flash_status.boot_levels[j] = flash_status.boot_levels[j - 1];
+#endif
+            j--;
+        }
+        flash_status.component_ids[j] = id;
+#ifdef ADDR_ASSIGN
+        flash_status.addr_slots[j] = slot;
+#endif
+#ifdef LINK_META
+        flash_status.link_meta[j] = meta;
+#endif
+#ifdef BOOT_GROUPS
+        flash_status.boot_levels[j] = level;
+#endif
+    }
+}
+
+// Whether addr is outside the range components may use or taken by another
+// device on the board, must match i2c_address_is_blacklisted in ectf_tools
+static bool i2c_addr_reserved(i2c_addr_t addr) {
+    static const i2c_addr_t blacklist[] = {I2C_BLACKLIST};
+    if (addr < I2C_ADDR_FIRST || addr >= I2C_ADDR_LIMIT) {
+        return true;
+    }
+#ifdef I2C_MUX
+    if (addr == I2C_MUX_ADDR) {
+        return true;
+    }
+#endif
+    for (unsigned i = 0; i < sizeof(blacklist) / sizeof(blacklist[0]); i++) {
+        if (addr == blacklist[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef PRESENCE_MONITOR
+#ifdef CLOCK_SCALING
+#error "PRESENCE_MONITOR probes the bus while the AP idles, not available with CLOCK_SCALING"
+#endif
+// Time between two probes while waiting for the host
+#ifndef PRESENCE_PROBE_MS
+#define PRESENCE_PROBE_MS 20
+#endif
+#ifdef HOST_SLEEP
+// The idle hook runs once a tick, the core sleeps in between
+#define PRESENCE_STEP_US HOST_SLEEP_TICK_US
+#else
+// Longest the idle hook may spin, keeps the console's RX FIFO from overflowing
+#define PRESENCE_STEP_US 100
+#endif
+
+// Addresses whose last probe went unanswered, a clear bit is present or not
+// probed yet. Only ever a hint: an absent component is probed once more
+// before a command gives up on it
+static uint32_t presence_absent[(I2C_ADDR_LIMIT + 31) / 32];
+// Idle steps since the last probe, and the entry probed next
+static unsigned presence_steps;
+static unsigned presence_next;
+
+// Record the outcome of an address probe
+static void presence_note(i2c_addr_t addr, bool present) {
+    if (addr >= I2C_ADDR_LIMIT) {
+        return;
+    }
+    if (present) {
+        presence_absent[addr / 32] &= ~(1u << (addr % 32));
+    } else {
+        presence_absent[addr / 32] |= 1u << (addr % 32);
+    }
+}
+
+// Host idle hook: every PRESENCE_PROBE_MS probe the next provisioned address,
+// round robin, so the bitmap follows components being plugged in and out
+static void presence_idle() {
+    if (++presence_steps < PRESENCE_PROBE_MS * 1000 / PRESENCE_STEP_US) {
+#ifndef HOST_SLEEP
+        MXC_Delay(PRESENCE_STEP_US);
+#endif
+        return;
+    }
+    presence_steps = 0;
+    for (unsigned n = 0; n < flash_status.component_cnt; n++) {
+        unsigned i = presence_next++ % flash_status.component_cnt;
+        if (!component_addr_bad[i]) {
+            presence_note(component_addrs[i], probe_address(component_addrs[i]) == SUCCESS_RETURN);
+            return;
+        }
+    }
+}
+
+// Whether entry i can take part in a command. Only the components the
+// monitor saw missing are probed again, one NACK instead of a timed out
+// exchange for every one still gone
+static bool presence_confirm(unsigned i) {
+    i2c_addr_t addr = component_addrs[i];
+    if (addr >= I2C_ADDR_LIMIT || !(presence_absent[addr / 32] & (1u << (addr % 32)))) {
+        return true;
+    }
+    bool present = probe_address(addr) == SUCCESS_RETURN;
+    presence_note(addr, present);
+    if (!present) {
+        print_error("Component 0x%08x is not present\n", flash_status.component_ids[i]);
+    }
+    return present;
+}
+
+#define presence_clear() memset(presence_absent, 0, sizeof(presence_absent))
+
+// Provisioned components the host was last told are present, by ID so a
+// replaced component shows up as one removed and one added
+static uint32_t presence_reported[MAX_COMPONENTS];
+static unsigned presence_reported_cnt;
+
+static bool presence_was_reported(uint32_t id) {
+    for (unsigned j = 0; j < presence_reported_cnt; j++) {
+        if (presence_reported[j] == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Bring presence_reported up to date with the bitmap, printing the changes
+// as R> (gone) and A> (present again) if report is set. No bus traffic
+static void presence_delta(bool report) {
+    uint32_t present[MAX_COMPONENTS];
+    unsigned present_cnt = 0;
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        i2c_addr_t addr = component_addrs[i];
+        if (component_addr_bad[i] || addr >= I2C_ADDR_LIMIT ||
+            (presence_absent[addr / 32] & (1u << (addr % 32)))) {
+            continue;
+        }
+        present[present_cnt++] = flash_status.component_ids[i];
+    }
+    if (report) {
+        for (unsigned j = 0; j < presence_reported_cnt; j++) {
+            bool still = false;
+            for (unsigned k = 0; k < present_cnt && !still; k++) {
+                still = present[k] == presence_reported[j];
+            }
+            if (!still) {
+                print_info("R>0x%08x\n", presence_reported[j]);
+            }
+        }
+        for (unsigned k = 0; k < present_cnt; k++) {
+            if (!presence_was_reported(present[k])) {
+                print_info("A>0x%08x\n", present[k]);
+            }
+        }
+    }
+    memcpy(presence_reported, present, present_cnt * sizeof(present[0]));
+    presence_reported_cnt = present_cnt;
+}
+#else
+#define presence_note(addr, present) ((void)0)
+#define presence_confirm(i) true
+#define presence_clear() ((void)0)
+#define presence_delta(report) ((void)0)
+#endif
+
+#ifdef COMPONENT_TABLE_IDS
+// The provisioned components as build_ap.py emits them: sorted by ID, with
+// the I2C address of each, which it has checked are distinct and not reserved
+static const uint32_t provisioned_ids[COMPONENT_CNT] = {COMPONENT_TABLE_IDS};
+static const i2c_addr_t provisioned_addrs[COMPONENT_CNT] = {COMPONENT_TABLE_ADDRS};
+#endif
+
+// Rebuild component_addrs and addr_components, call whenever
+// flash_status.component_ids changes. Components on a reserved address, or
+// on one another component maps to as well, could never answer for
+// themselves and are marked in component_addr_bad.
+static void index_components() {
+    memset(addr_components, 0, sizeof(addr_components));
+    presence_clear();
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+#ifdef ADDR_ASSIGN
+        i2c_addr_t addr = ADDR_ASSIGN_BASE + flash_status.addr_slots[i];
+#else
+        i2c_addr_t addr = component_id_to_i2c_addr(flash_status.component_ids[i]);
+#endif
+        component_addrs[i] = addr;
+#if defined(I2C_MUX) || defined(LINK_META)
+        sweep_order[i] = i;
+#endif
+        component_addr_bad[i] = i2c_addr_reserved(addr);
+        if (component_addr_bad[i]) {
+            print_debug("Component 0x%08x maps to reserved I2C address 0x%02x\n",
+                        flash_status.component_ids[i], addr);
+        } else if (addr_components[addr] != 0) {
+            unsigned other = addr_components[addr] - 1;
+            print_debug("Components 0x%08x and 0x%08x share I2C address 0x%02x\n",
+                        flash_status.component_ids[other], flash_status.component_ids[i], addr);
+            component_addr_bad[other] = true;
+            component_addr_bad[i] = true;
+        } else {
+            addr_components[addr] = i + 1;
+        }
+    }
+}
+
+// index_components at startup. While the components are still the
+// provisioned ones their addresses come from the table the build checked.
+// The mux address is only known to project.mk, so I2C_MUX builds check
+static void index_startup() {
+#if defined(COMPONENT_TABLE_IDS) && !defined(I2C_MUX) && !defined(ADDR_ASSIGN)
+    if (flash_status.component_cnt == COMPONENT_CNT &&
+        memcmp(flash_status.component_ids, provisioned_ids, sizeof(provisioned_ids)) == 0) {
+        memset(addr_components, 0, sizeof(addr_components));
+        memset(component_addr_bad, 0, sizeof(component_addr_bad));
+        presence_clear();
+        memcpy(component_addrs, provisioned_addrs, sizeof(provisioned_addrs));
+        for (unsigned i = 0; i < COMPONENT_CNT; i++) {
+            addr_components[provisioned_addrs[i]] = i + 1;
+#ifdef LINK_META
+            sweep_order[i] = i;
+#endif
+        }
+        return;
+    }
+#endif
+    index_components();
+}
+
+#ifdef ADDR_ASSIGN
+static int flash_store();
+
+// Sequence number of the last assignment, 0 before the first since reset
+static uint32_t assign_seq;
+
+// Assign every provisioned component its address in component_addrs. Ones
+// that reset since answer on their home address again, so lists assign too.
+// Components only take an assignment numbered above the last one they took,
+// so the numbers go on from the flash record's generation, which is stored
+// again first whenever the low byte runs out. That keeps them rising across
+// resets of the AP, whose generation only ever grows
+static void addr_assign() {
+    if (assign_seq == 0 || (assign_seq & 0xFF) == 0xFF) {
+        if (flash_store() != SUCCESS_RETURN) {
+            print_debug("Cannot number the address assignment\n");
+            return;
+        }
+        assign_seq = flash_status.generation << 8;
+    }
+    assign_seq++;
+    if (ap_addr_assign(assign_seq, flash_status.component_ids, component_addrs,
+                       flash_status.component_cnt) != AP_SUCCESS) {
+        print_debug("No component took the address assignment\n");
+    }
+}
+#else
+#define addr_assign() ((void)0)
+#endif
+
+#ifdef COMP_READY
+// Longest wait for the components to finish starting up
+#ifndef COMP_READY_TIMEOUT_MS
+#define COMP_READY_TIMEOUT_MS 1000
+#endif
+
+// Indexed like flash_status.component_ids, set once a component said it is
+// ready, cleared after a failed boot in case one of them was reset
+static bool component_ready[MAX_COMPONENTS];
+
+// Wait until every provisioned component finished starting up, or
+// COMP_READY_TIMEOUT_MS went by. The ones not ready yet, still starting or
+// not answering at all, are polled together with the usual backoff, so the
+// wait ends as soon as the last of them is ready. Components that never get
+// there are left to fail whatever comes next, as without COMP_READY. home
+// polls the addresses their IDs map to, before addr_assign moved them
+static void components_wait_ready(bool home) {
+    uint32_t timeout_us = COMP_READY_TIMEOUT_MS * 1000;
+    uint32_t delay = POLL_READY_SLICE_US;
+    uint32_t waited = 0;
+    while (true) {
+        bool all = true;
+        for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+            if (component_ready[i] || component_addr_bad[i]) {
+                continue;
+            }
+            i2c_addr_t addr = home ? component_id_to_i2c_addr(flash_status.component_ids[i])
+                                   : component_addrs[i];
+            component_ready[i] = board_link_component_ready(addr);
+            all = all && component_ready[i];
+        }
+        if (all || waited >= timeout_us) {
+            return;
+        }
+        uint32_t slice = (delay > timeout_us - waited) ? timeout_us - waited : delay;
+        uint32_t w = board_link_wait_ready(slice);
+        waited += (w > 0) ? w : POLL_READY_SLICE_US;
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+}
+#else
+#define components_wait_ready(home) ((void)0)
+#endif
+
+#ifdef I2C_MUX
+// Sort sweep_order by the segment every entry was found on, components not
+// found yet last and the order within a segment kept. Call once the first
+// frame of an exchange went out, which locates every component not placed
+// before
+static void sweep_sort() {
+    for (unsigned i = 1; i < flash_status.component_cnt; i++) {
+        uint8_t entry = sweep_order[i];
+        uint8_t segment = board_link_segment(component_addrs[entry]);
+        unsigned j = i;
+        while (j > 0 && board_link_segment(component_addrs[sweep_order[j - 1]]) > segment) {
+            sweep_order[j] = sweep_order[j - 1];
+            j--;
+        }
+        sweep_order[j] = entry;
+    }
+}
+#else
+#define sweep_sort() ((void)0)
+#endif
+
+// Whether component_id would clash with a provisioned component other than
+// entry skip, or land on a reserved address
+static bool component_addr_clash(uint32_t component_id, unsigned skip) {
+    i2c_addr_t addr = component_id_to_i2c_addr(component_id);
+    if (i2c_addr_reserved(addr)) {
+        return true;
+    }
+#ifdef ADDR_ASSIGN
+    // Assignments go by the whole ID, a shared home address is no clash
+    (void)skip;
+#else
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        if (i != skip && component_id_to_i2c_addr(flash_status.component_ids[i]) == addr) {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+// Index of component_id in flash_status.component_ids, -1 if it is not provisioned
+static int find_component(uint32_t component_id) {
+    unsigned lo = 0;
+    unsigned hi = flash_status.component_cnt;
+    while (lo < hi) {
+        unsigned mid = lo + (hi - lo) / 2;
+        if (flash_status.component_ids[mid] < component_id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < flash_status.component_cnt && flash_status.component_ids[lo] == component_id) {
+        return lo;
+    }
+    return -1;
+}
+
+// Decrypt and check the record at address straight from flash into
+// flash_status. Everything up to the last whole block of the data goes to
+// flash_status directly, the padded block after it and the hash go through a
+// small buffer. Returns SUCCESS_RETURN if the hash and magic hold,
+// flash_status is garbage otherwise.
+static int flash_record_check(uint32_t address, unsigned cnt) {
+    const uint8_t *iv = flash_simple_map(address);
+    const uint8_t *enc = iv + IV_LEN;
+    uint8_t *status = (uint8_t*)&flash_status;
+    unsigned direct = (FLASH_DATA_LEN(cnt) / CBC_BLOCK_LEN) * CBC_BLOCK_LEN;
+    unsigned rest = FLASH_ENC_LEN(cnt) - direct;
+    uint8_t tail[CBC_BLOCK_LEN + HASH_LEN];
+    uint8_t flashHash[HASH_LEN];
+
+    memset(&flash_status, 0, sizeof(flash_entry));
+    if (direct) {
+        aes_decrypt((uint8_t*)enc, status, (uint8_t*)iv, direct);
+    }
+    aes_decrypt((uint8_t*)enc + direct, tail,
+                (uint8_t*)(direct ? enc + direct - CBC_BLOCK_LEN : iv), rest);
+    memcpy(status + direct, tail, FLASH_DATA_LEN(cnt) - direct);
+
+    hash(status, flashHash, FLASH_DATA_LEN(cnt));
+    int result = !secure_memcmp(tail + FLASH_PAD_LEN(cnt) - direct, flashHash, HASH_LEN) &&
+                 flash_status.flash_magic == FLASH_MAGIC && flash_status.component_cnt == cnt;
+    memset(tail, 0, sizeof(tail));
+    return result ? SUCCESS_RETURN : ERROR_RETURN;
+}
+
+// Load the newest valid record from the two flash pages into flash_status and
+// find where the next one goes. The pages are memory mapped, so walking them
+// only decrypts the first block of each record, which holds its generation
+// and length. Then the record with the highest generation is decrypted and
+// checked in full, and if that fails the next highest, so after a clean
+// shutdown a single record is. Records left half written by a power cut fail
+// the check and are skipped. Returns SUCCESS_RETURN if a record was found.
+static int flash_load() {
+    // Every record header of both pages, in log order
+    static struct {
+        uint32_t generation;
+        uint16_t offset;
+        uint8_t page;
+        uint8_t cnt;
+    } found[2 * (MXC_FLASH_PAGE_SIZE / FLASH_RECORD_LEN(0))];
+    unsigned found_cnt = 0;
+    uint32_t block[CBC_BLOCK_LEN / sizeof(uint32_t)];
+    flash_entry *head = (flash_entry*)block;
+    unsigned next[2] = {MXC_FLASH_PAGE_SIZE, MXC_FLASH_PAGE_SIZE};
+
+    for (unsigned page = 0; page < 2; page++) {
+        unsigned offset = 0;
+        while (offset + FLASH_RECORD_LEN(0) <= MXC_FLASH_PAGE_SIZE) {
+            const uint8_t *bytes = flash_simple_map(FLASH_PAGE_ADDR(page) + offset);
+
+            // The IV and first encrypted block tell whether anything has been
+            // appended here, and how long the record is
+            unsigned i = 0;
+            while (i < IV_LEN + CBC_BLOCK_LEN && bytes[i] == 0xFF) {
+                i++;
+            }
+            if (i == IV_LEN + CBC_BLOCK_LEN) {
+                next[page] = offset;
+                break;
+            }
+            aes_decrypt((uint8_t*)bytes + IV_LEN, (uint8_t*)block, (uint8_t*)bytes, CBC_BLOCK_LEN);
+            uint32_t cnt = head->component_cnt;
+            if (head->flash_magic != FLASH_MAGIC || cnt > MAX_COMPONENTS ||
+                offset + FLASH_RECORD_LEN(cnt) > MXC_FLASH_PAGE_SIZE) {
+                // Without a length the rest of the page cannot be walked, treat it as full
+                break;
+            }
+
+            found[found_cnt].generation = head->generation;
+            found[found_cnt].offset = offset;
+            found[found_cnt].page = page;
+            found[found_cnt].cnt = cnt;
+            found_cnt++;
+            offset += FLASH_RECORD_LEN(cnt);
+        }
+    }
+    memset(block, 0, sizeof(block));
+
+    while (found_cnt) {
+        // Generations are compared modulo 2^32 so they may wrap
+        unsigned best = 0;
+        for (unsigned i = 1; i < found_cnt; i++) {
+            if ((int32_t)(found[i].generation - found[best].generation) > 0) {
+                best = i;
+            }
+        }
+
+        uint32_t address = FLASH_PAGE_ADDR(found[best].page) + found[best].offset;
+        if (flash_record_check(address, found[best].cnt) == SUCCESS_RETURN) {
+            memcpy(flash_iv, flash_simple_map(address), IV_LEN);
+            flash_page = found[best].page;
+            flash_offset = found[best].offset;
+            flash_next = next[flash_page];
+            return SUCCESS_RETURN;
+        }
+        found[best] = found[--found_cnt];
+    }
+
+    memset(&flash_status, 0, sizeof(flash_entry));
+    flash_next = next[flash_page];
+    return ERROR_RETURN;
+}
+
+#ifdef WARM_BOOT_CACHE
+// Restore flash_status and the flash log position from the warm boot cache.
+// After a power-on reset SRAM holds noise, so the MAC fails and init() falls
+// back to the flash log. Returns SUCCESS_RETURN if the cache was used.
+static int warm_cache_load() {
+    uint8_t mac[HASH_LEN];
+    if (warm_cache.magic != FLASH_MAGIC ||
+        hmac((uint8_t*)&warm_cache, mac, sizeof(warm_cache_t) - HASH_LEN) != 0 ||
+        secure_memcmp(mac, warm_cache.mac, HASH_LEN) ||
+        warm_cache.page > 1 || warm_cache.offset >= MXC_FLASH_PAGE_SIZE ||
+        warm_cache.next > MXC_FLASH_PAGE_SIZE ||
+        warm_cache.entry.component_cnt > MAX_COMPONENTS) {
+        return ERROR_RETURN;
+    }
+
+    // The record must still be in flash, it is gone if the pages were erased or
+    // rewritten since. Its IV is stored in the clear, so no decrypt is needed.
+    if (memcmp(flash_simple_map(FLASH_PAGE_ADDR(warm_cache.page) + warm_cache.offset),
+               warm_cache.iv, IV_LEN)) {
+        return ERROR_RETURN;
+    }
+
+    memcpy((uint8_t*)&flash_status, (uint8_t*)&warm_cache.entry, sizeof(flash_entry));
+    memcpy(flash_iv, warm_cache.iv, IV_LEN);
+    flash_page = warm_cache.page;
+    flash_offset = warm_cache.offset;
+    flash_next = warm_cache.next;
+    return SUCCESS_RETURN;
+}
+
+// Mirror flash_status and the flash log position into the warm boot cache
+static void warm_cache_save() {
+    warm_cache.magic = FLASH_MAGIC;
+    warm_cache.page = flash_page;
+    warm_cache.offset = flash_offset;
+    warm_cache.next = flash_next;
+    memcpy(warm_cache.iv, flash_iv, IV_LEN);
+    memcpy((uint8_t*)&warm_cache.entry, (uint8_t*)&flash_status, sizeof(flash_entry));
+    if (hmac((uint8_t*)&warm_cache, warm_cache.mac, sizeof(warm_cache_t) - HASH_LEN) != 0) {
+        memset(&warm_cache, 0, sizeof(warm_cache_t));
+    }
+}
+#endif
+
+#ifdef FLASH_ERASE_AHEAD
+// Whether every word of a flash page reads erased
+static bool flash_page_blank(unsigned page) {
+    const uint32_t *words = flash_simple_map(FLASH_PAGE_ADDR(page));
+    for (unsigned i = 0; i < MXC_FLASH_PAGE_SIZE / sizeof(uint32_t); i++) {
+        if (words[i] != 0xFFFFFFFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Erase the page flash_store moves to once the current one is full, unless
+// it already is. The command loop calls this between commands, so the tens
+// of milliseconds the erase stalls the core for no longer fall into a
+// replace or into startup. The newest record is in the other page, so this
+// never costs a record the log still needs
+static void flash_prepare() {
+    unsigned spare = flash_page ^ 1;
+    if (flash_erased_page == (int)spare) {
+        return;
+    }
+    if (flash_page_blank(spare) || flash_simple_erase_page(FLASH_PAGE_ADDR(spare)) == SUCCESS_RETURN) {
+        flash_erased_page = spare;
+    }
+}
+#endif
+
+// Erase the page the flash log continues in. With FLASH_ERASE_AHEAD it
+// usually is already, or still is from the factory
+static int flash_erase(unsigned page) {
+#ifdef FLASH_ERASE_AHEAD
+    bool erased = (flash_erased_page == (int)page) || flash_page_blank(page);
+    flash_erased_page = -1;
+    if (erased) {
+        return SUCCESS_RETURN;
+    }
+#endif
+    return flash_simple_erase_page(FLASH_PAGE_ADDR(page));
+}
+
+// Append flash_status under the next generation and a fresh IV. Records go
+// into the page holding the newest one until it is full, then the other page
+// is erased and the log continues there. The newest record is never erased,
+// so a power cut at any point leaves a valid one behind.
+static int flash_store() {
+    static uint32_t record[FLASH_RECORD_MAX_LEN / sizeof(uint32_t)];
+    uint8_t *bytes = (uint8_t*)record;
+    unsigned cnt = flash_status.component_cnt;
+    unsigned len = FLASH_RECORD_LEN(cnt);
+
+    flash_status.generation++;
+    memset(record, 0, len);
+
+    // Generate an IV
+    uint64_t randValue;
+    randValue = rng_gen();
+    memcpy(&bytes[0], &randValue, sizeof(randValue));
+    randValue = rng_gen();
+    memcpy(&bytes[8], &randValue, sizeof(randValue));
+
+    // Construct hash after the zero pad, then encrypt the record in place
+    memcpy(bytes + IV_LEN, (uint8_t*)&flash_status, FLASH_DATA_LEN(cnt));
+    hash(bytes + IV_LEN, bytes + IV_LEN + FLASH_PAD_LEN(cnt), FLASH_DATA_LEN(cnt));
+    aes_encrypt(bytes + IV_LEN, bytes + IV_LEN, bytes, FLASH_ENC_LEN(cnt));
+
+    if (flash_next + len > MXC_FLASH_PAGE_SIZE) {
+        flash_page ^= 1;
+        flash_next = 0;
+        if (flash_erase(flash_page) != SUCCESS_RETURN) {
+            // Try again on the next store, the newest record is still in the other page
+            flash_page ^= 1;
+            flash_next = MXC_FLASH_PAGE_SIZE;
+            memset(record, 0, len);
+            return ERROR_RETURN;
+        }
+    }
+    int result = flash_simple_write(FLASH_PAGE_ADDR(flash_page) + flash_next, record, len);
+    // A failed write leaves a record that never validates, move past it either way
+    memcpy(flash_iv, bytes, IV_LEN);
+    flash_offset = flash_next;
+    flash_next += len;
+    memset(record, 0, len);
+#ifdef WARM_BOOT_CACHE
+    // Only cache what made it into flash
+    if (result == SUCCESS_RETURN) {
+        warm_cache_save();
+    } else {
+        memset(&warm_cache, 0, sizeof(warm_cache_t));
+    }
+#endif
+    return result;
+}
+
+#ifdef ENROLL_RESUME
+// Ticket of a component enrolled in an earlier boot, see ap_messaging.h. The
+// record they are in was checked when it was loaded, so this is a lookup
+int ap_resume_find(const uint8_t *cert_hash, uint8_t *secret) {
+    for (unsigned i = 0; i < ENROLL_RESUME_SLOTS; i++) {
+        resume_ticket_t *ticket = &flash_status.resume[i];
+        if (!secure_memcmp(ticket->cert_hash, cert_hash, HASH_LEN)) {
+            memcpy(secret, ticket->secret, ENROLL_SECRET_LEN);
+            return SUCCESS_RETURN;
+        }
+    }
+    return ERROR_RETURN;
+}
+
+// Keep a new ticket in the next slot and append the record. A failed store
+// only costs a full enrollment again next boot
+void ap_resume_save(const uint8_t *cert_hash, const uint8_t *secret) {
+    resume_ticket_t *ticket = &flash_status.resume[flash_status.resume_next % ENROLL_RESUME_SLOTS];
+    memcpy(ticket->cert_hash, cert_hash, HASH_LEN);
+    memcpy(ticket->secret, secret, ENROLL_SECRET_LEN);
+    flash_status.resume_next = (flash_status.resume_next + 1) % ENROLL_RESUME_SLOTS;
+    if (flash_store() != SUCCESS_RETURN) {
+        print_debug("Could not store resumption ticket\n");
+    }
+}
+#endif
+
+#ifdef DELAY_SLEEP
+// Background work of sleep_us, one bounded piece per call. Returns nonzero
+// while there is more to do
+static int ap_sleep_work(void) {
+#ifdef AP_RTOS
+    // Hand the core to the other tasks a tick at a time
+    if (ap_rtos_link_wait()) {
+        return 1;
+    }
+#endif
+#ifdef MSG_CTR
+    if (ctr_pool_fill()) {
+        return 1;
+    }
+#endif
+    return rng_pool_fill();
+}
+#endif
+
+#ifdef LAZY_STARTUP
+// A re-provisioned record that still has to be written, see startup_finish
+static bool startup_store;
+#endif
+
+// board_link_negotiate_speed with the provisioned components. With LINK_META
+// the ones that answered their last boot attempt are taken at the
+// capabilities they advertised before, and what every component advertised
+// this time goes into flash_status.link_meta. With I2C_CALIBRATE the bus
+// timings calibrated before are only checked again
+static int negotiate_speed() {
+#ifdef I2C_CALIBRATE
+    board_link_preset_timings(flash_status.bus_timings);
+#endif
+#ifdef LINK_META
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        link_meta_t *meta = &flash_status.link_meta[i];
+        if ((meta->status & (LINK_META_SEEN | LINK_META_CAPS)) == (LINK_META_SEEN | LINK_META_CAPS)) {
+            board_link_preset_caps(component_addrs[i], meta->caps);
+        }
+    }
+#endif
+    int freq = board_link_negotiate_speed(component_addrs, flash_status.component_cnt);
+#ifdef LINK_META
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        link_meta_t *meta = &flash_status.link_meta[i];
+        uint8_t caps = board_link_caps(component_addrs[i]);
+        uint8_t status = caps ? (meta->status | LINK_META_CAPS) : (meta->status & ~LINK_META_CAPS);
+        if (status != meta->status || caps != meta->caps) {
+            meta->caps = caps;
+            meta->status = status;
+            link_meta_changed = true;
+        }
+    }
+#endif
+#ifdef I2C_CALIBRATE
+    uint32_t timings[I2C_BUS_COUNT];
+    board_link_timings(timings);
+    if (memcmp(timings, flash_status.bus_timings, sizeof(timings)) != 0) {
+        memcpy(flash_status.bus_timings, timings, sizeof(timings));
+        link_meta_changed = true;
+    }
+#endif
+    return freq;
+}
+
+// The part of startup that can wait for the first command: writing a
+// re-provisioned record and raising the bus speed, which probes every
+// provisioned component. init() runs it unless LAZY_STARTUP=1, then the
+// first command does, so the prompt goes out without waiting on a page erase
+// or on components that are still booting themselves
+static void startup_finish() {
+#ifdef LAZY_STARTUP
+    static bool done;
+    if (done) {
+        return;
+    }
+    done = true;
+
+    if (startup_store) {
+        startup_store = false;
+        flash_store();
+    }
+#endif
+
+    // Components powered up with us may still be starting, and they have
+    // to be listening for the assignment
+    components_wait_ready(true);
+
+    // Move the components off their home addresses before talking to them
+    addr_assign();
+
+    // Raise the bus speed as far as every provisioned component allows
+    int freq = negotiate_speed();
+    print_debug("I2C bus running at %d Hz\n", freq);
+}
+
+#ifdef FIRMWARE_MEASURE
+// Check a page of the firmware image while waiting for the host, then hand
+// the idle time over to the other idle work
+static void measure_idle() {
+    if (!measure_step()) {
+        return;
+    }
+#if defined(PRESENCE_MONITOR)
+    host_set_idle(presence_idle);
+#elif defined(PREVALIDATE)
+    host_set_idle(prevalidate_idle);
+#else
+    host_set_idle(NULL);
+#endif
+}
+#endif
+
+// Initialize the device
+// This must be called on startup to initialize the flash and i2c interfaces
+// Start the flash log over with the provisioned component IDs, after a first
+// boot or someone messing with our flash memory
+COLD static void flash_reset() {
+    print_debug("Failed to verify flash integrity, resetting flash!\n");
+
+    memset(&flash_status, 0, sizeof(flash_entry));
+    flash_status.flash_magic = FLASH_MAGIC;
+    flash_status.component_cnt = COMPONENT_CNT;
+#ifdef ADDR_ASSIGN
+    // One slot each, kept by the component IDs from here on
+    for (unsigned i = 0; i < COMPONENT_CNT; i++) {
+        flash_status.addr_slots[i] = i;
+    }
+#endif
+#ifdef COMPONENT_TABLE_IDS
+    // Sorted by the build already
+    memcpy(flash_status.component_ids, provisioned_ids, sizeof(provisioned_ids));
+#else
+    uint32_t component_ids[COMPONENT_CNT] = {COMPONENT_IDS};
+    memcpy(flash_status.component_ids, component_ids, 
+        COMPONENT_CNT*sizeof(uint32_t));
+    sort_components();
+#endif
+#ifdef BOOT_GROUPS
+    // The plan lists the levels in COMPONENT_IDS order, the IDs are sorted by now
+    uint32_t plan_ids[COMPONENT_CNT] = {COMPONENT_IDS};
+    uint8_t plan_levels[COMPONENT_CNT] = {COMPONENT_BOOT_LEVELS};
+    for (unsigned i = 0; i < COMPONENT_CNT; i++) {
+        int index = find_component(plan_ids[i]);
+        if (index >= 0) {
+            flash_status.boot_levels[index] = plan_levels[i];
+        }
+    }
+#endif
+
+    // The pages may hold garbage from someone else, start over in page A
+    flash_page = 1;
+    flash_next = MXC_FLASH_PAGE_SIZE;
+#ifdef LAZY_STARTUP
+    // flash_status is already valid in RAM, a power cut before the write
+    // only means provisioning again next boot
+    startup_store = true;
+#else
+    flash_store();
+#endif
+}
+
+COLD void init() {
+
+    // Enable global interrupts    
+    __enable_irq();
+
+#ifdef HOST_UART_STREAM
+    // Send host output through the interrupt driven TX ring
+    host_uart_init();
+#endif
+
+    // Start the cycle counter for hot-path tracing (no-op unless TRACE=1)
+    trace_init();
+    power_mark_init();
+
+    // Power up the TRNG and seed the random pool before anything draws on it
+    rng_init();
+
+#ifdef KEY_ROTATION
+    // Run under the key of the last rotation, the deployment key if there was none
+    key_store_load(KEY_STORE_ADDR, &key_store);
+    crypto_rekey(key_store.key);
+#endif
+
+    // Expand the AES key schedules once for the lifetime of the device
+    crypto_init();
+
+    // Setup Flash
+    flash_simple_init();
+#ifdef KEY_ROTATION
+    rotate_resume();
+#endif
+
+#ifdef WARM_BOOT_CACHE
+    // A warm reset still has the verified flash state in retained SRAM
+    if (warm_cache_load() == SUCCESS_RETURN) {
+        print_debug("Flash state restored from warm boot cache\n");
+    } else
+#endif
+    // Pull the newest valid record from the flash log
+    // If none validates, append one with the provisioned component IDs
+    // No valid record means either first boot or someone has messed with our flash memory
+    if (flash_load() != SUCCESS_RETURN) {
+        flash_reset();
+    }
+#ifdef WARM_BOOT_CACHE
+    else {
+        warm_cache_save();
+    }
+#endif
+    index_startup();
+    
+#ifdef MSG_TIMESYNC
+    time_init();
+#endif
+
+    // Initialize board link interface
+    board_link_init();
+#ifdef DMA_COPY
+    // After the I2C driver's own channels
+    if (dma_copy_init() != 0) {
+        print_debug("No DMA channel for copies, using the CPU\n");
+    }
+#endif
+#ifdef RISCV_KEYSTREAM
+    rv_keystream_start();
+#endif
+#ifdef MSG_CTR
+    // Keystream for the next frame is made while polling components
+    board_link_set_idle(ctr_pool_fill);
+#endif
+#ifdef PRESENCE_MONITOR
+    // Provisioned components are probed while the AP waits for the host
+    host_set_idle(presence_idle);
+#endif
+#ifdef PREVALIDATE
+    // Provisioned components are validated while the AP waits for the host
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    prevalidate_rearm();
+    host_set_idle(prevalidate_idle);
+#endif
+#ifdef DELAY_SLEEP
+    // The security delays keep the pools topped up and, with AP_RTOS, the
+    // other tasks running
+    sleep_set_work(ap_sleep_work);
+#endif
+#ifdef FIRMWARE_MEASURE
+    // The firmware pages are checked first, then the other idle work runs
+    host_set_idle(measure_idle);
+#endif
+
+#ifdef COMPONENT_BUSES
+    // Components provisioned on other buses than the default one. Replacements
+    // are not in the map and get found on whichever bus they answer
+    uint32_t bus_ids[COMPONENT_CNT] = {COMPONENT_IDS};
+    uint8_t buses[COMPONENT_CNT] = {COMPONENT_BUSES};
+    for (unsigned i = 0; i < COMPONENT_CNT; i++) {
+        board_link_set_bus(bus_ids[i], buses[i]);
+    }
+#endif
+#ifdef COMPONENT_CHANNELS
+    // Mux channels of the provisioned components, replacements are found
+    // on whichever channel they answer
+    uint32_t chan_ids[COMPONENT_CNT] = {COMPONENT_IDS};
+    uint8_t channels[COMPONENT_CNT] = {COMPONENT_CHANNELS};
+    for (unsigned i = 0; i < COMPONENT_CNT; i++) {
+        board_link_set_channel(chan_ids[i], channels[i]);
+    }
+#endif
+#ifdef COMPONENT_SPI_CS
+    // Chip selects of the provisioned components wired for SPI, replacements
+    // stay on I2C
+    uint32_t spi_ids[COMPONENT_CNT] = {COMPONENT_IDS};
+    uint8_t spi_cs[COMPONENT_CNT] = {COMPONENT_SPI_CS};
+    for (unsigned i = 0; i < COMPONENT_CNT; i++) {
+        if (spi_cs[i] != SPI_CS_NONE) {
+            board_link_set_spi(spi_ids[i], spi_cs[i]);
+        }
+    }
+#endif
+
+#ifndef LAZY_STARTUP
+    startup_finish();
+#endif
+}
+
+// Send a command to a component and receive the result
+int issue_cmd(i2c_addr_t addr) {
+    LAT_START(start);
+    // Send message
+    int result = ap_transmit(addr);
+    if (result == SUCCESS_RETURN) {
+        // Receive message
+        result = ap_poll_recv(addr, 0);
+    }
+    LAT_ADD(&ap_link_hists[LAT_LINK_ISSUE_CMD], start);
+
+    return result == SUCCESS_RETURN ? SUCCESS_RETURN : ERROR_RETURN;
+}
+
+/******************************** COMPONENT COMMS ********************************/
+
+// Whether a component answered the last list from addr, see TOPOLOGY_CACHE
+static int topology_known(i2c_addr_t addr) {
+#ifdef TOPOLOGY_CACHE
+    return TOPOLOGY_HAS(flash_status.topology, addr);
+#else
+    (void)addr;
+    return 0;
+#endif
+}
+
+#ifdef SLOW_CAPTURE
+// Freeze the trace and capture rings if op, which started at cycle count
+// start, ran longer than budget_ms. The first slow operation is kept until
+// the "slow" command prints it
+static void slow_check(const char* op, uint32_t start, uint32_t budget_ms) {
+    uint32_t us = (trace_cycles() - start) / (SystemCoreClock / 1000000);
+    if (slow_op != NULL || us <= budget_ms * 1000) {
+        return;
+    }
+    trace_freeze(1);
+    i2c_capture_freeze(1);
+    slow_op = op;
+    slow_us = us;
+    slow_budget_ms = budget_ms;
+}
+#endif
+
+int scan_components() {
+    // Print out provisioned component IDs
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        print_info("P>0x%08x\n", flash_status.component_ids[i]);
+    }
+    SLOW_START(start);
+    addr_assign();
+
+    #ifdef VALIDATE_RESUME
+    // Held components take the scan as a new command and stop waiting
+    validate_holds_clear();
+#endif
+
+    i2c_addr_t found[I2C_ADDR_LIMIT];
+    unsigned found_cnt = 0;
+#ifdef TOPOLOGY_CACHE
+    uint32_t seen[TOPOLOGY_WORDS] = {0};
+#endif
+#ifdef SCAN_LIGHT
+    // One nonce for the whole list, every reply also covers its address
+    uint8_t nonce[MSG_SCAN_NONCE_LEN];
+    uint64_t randValue = rng_gen();
+    memcpy(nonce, &randValue, MSG_SCAN_NONCE_LEN);
+#endif
+
+    // With TOPOLOGY_CACHE the addresses that answered the last list go
+    // first, so on a stable system every component has replied before the
+    // sweep of the rest starts, which then only finds empty addresses
+    for (int known = 1; known >= 0; known--) {
+        unsigned first = found_cnt;
+
+        // Phase one: address-only probe of every bus address, so empty addresses
+        // cost a single NACK instead of a full encrypted exchange
+        for (i2c_addr_t addr = SCAN_ADDR_FIRST; addr < SCAN_ADDR_LIMIT; addr++) {
+            if (topology_known(addr) != known || i2c_addr_reserved(addr)) {
+                continue;
+            }
+            bool present = probe_address(addr) == SUCCESS_RETURN;
+            presence_note(addr, present);
+            if (present) {
+                found[found_cnt++] = addr;
+            }
+        }
+
+        // Phase two: scan command to each address that acknowledged
+        for (unsigned i = first; i < found_cnt; i++) {
+            // Assume component is alive -- get its ID 
+#ifdef SCAN_LIGHT
+            uint32_t component_id;
+            int result = ap_scan(found[i], nonce, &component_id);
+#else
+            transmit.opcode = COMPONENT_CMD_SCAN;
+            transmit.len = 0;
+            
+            // Send out command and receive result
+            ap_wire_format_reset(found[i]);
+            int result = issue_cmd(found[i]);
+            uint32_t component_id = MSG_BODY(receive, msg_id_t)->component_id;
+            if (result == SUCCESS_RETURN) {
+                ap_wire_format_learn(found[i], MSG_BODY(receive, msg_id_t));
+            }
+#endif
+
+            // Success, device is present and we have communicated with it again
+            if (result == SUCCESS_RETURN) {
+                print_info("F>0x%08x\n", component_id);
+#ifdef TOPOLOGY_CACHE
+                seen[found[i] / 32] |= 1u << (found[i] % 32);
+#endif
+            }
+        }
+    }
+
+#ifdef TOPOLOGY_CACHE
+    // Only a changed bus costs a flash record
+    if (memcmp(seen, flash_status.topology, sizeof(seen))) {
+        memcpy(flash_status.topology, seen, sizeof(seen));
+        flash_store();
+    }
+#endif
+    // The list is the baseline the delta command reports changes against
+    presence_delta(false);
+    SLOW_CHECK("list", start, SLOW_SCAN_MS);
+    print_success("List\n");
+    return SUCCESS_RETURN;
+}
+
+// Pause between round-robin sweeps of the pipelined exchanges, the shortest
+// one with PIPE_ADAPT. Counts towards each component's poll deadline (see
+// link_expired), after which it is failed on its own while the others carry on.
+#define PIPE_SWEEP_DELAY_US 50
+
+// With LINK_ASYNC the pipelined frames are only queued, and go out while
+// the AP seals the next one and polls the others
+#ifdef LINK_ASYNC
+#define pipe_transmit ap_transmit_async
+#else
+#define pipe_transmit ap_transmit
+#endif
+
+// pipe_transmit to component i, charging the crypto it takes to i's profile
+static int profiled_transmit(unsigned i, i2c_addr_t addr) {
+#ifdef BOOT_PROFILE
+    uint32_t crypto = trace_crypto_cycles();
+    int ret = pipe_transmit(addr);
+    boot_profile[i].crypto_cycles += trace_crypto_cycles() - crypto;
+    return ret;
+#else
+    (void)i;
+    return pipe_transmit(addr);
+#endif
+}
+
+// ap_try_recv from component i, charging the crypto and empty polls to i's profile
+static int profiled_try_recv(unsigned i, i2c_addr_t addr) {
+#ifdef LINK_ASYNC
+    // Our last frame may still be queued, or have failed on the way
+    int sent = link_send_status(addr);
+    if (sent != SUCCESS_RETURN) {
+        return (sent == LINK_OP_PENDING) ? AP_PENDING : ERROR_RETURN;
+    }
+#endif
+#ifdef BOOT_PROFILE
+    uint32_t crypto = trace_crypto_cycles();
+    int ret = ap_try_recv(addr, 0);
+    boot_profile[i].crypto_cycles += trace_crypto_cycles() - crypto;
+    if (ret == AP_PENDING) {
+        boot_profile[i].polls++;
+    }
+    return ret;
+#else
+    (void)i;
+    return ap_try_recv(addr, 0);
+#endif
+}
+
+#ifdef LINK_META
+// Sweep clock when the last frame to each entry went out, the fastest reply
+// it gave in this boot attempt, UINT32_MAX if none, and whether it answered
+// the boot frame. The sweep clock only counts the pauses between sweeps, so
+// it runs slow and polling on it is never late
+static uint32_t pipe_sent[MAX_COMPONENTS];
+static uint32_t pipe_fastest[MAX_COMPONENTS];
+static bool pipe_answered[MAX_COMPONENTS];
+
+#define PIPE_SENT(i, waited) (pipe_sent[i] = (waited))
+#define PIPE_ANSWERED(i) (pipe_answered[i] = true)
+
+// Whether entry i's reply may be ready, polling it earlier only costs a read
+static bool pipe_due(unsigned i, uint32_t waited) {
+    return waited - pipe_sent[i] >= flash_status.link_meta[i].turnaround_us * 3u / 4;
+}
+
+// Note a reply from entry i found at waited
+static void pipe_reply(unsigned i, uint32_t waited) {
+    if (waited - pipe_sent[i] < pipe_fastest[i]) {
+        pipe_fastest[i] = waited - pipe_sent[i];
+    }
+}
+
+// Start a boot attempt: order the entries by their last turnaround, slowest
+// first so its crypto overlaps with everyone else's traffic, and forget what
+// the last attempt saw
+static void link_meta_start() {
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        uint16_t turnaround = flash_status.link_meta[i].turnaround_us;
+        unsigned j = i;
+        while (j > 0 && flash_status.link_meta[sweep_order[j - 1]].turnaround_us < turnaround) {
+            sweep_order[j] = sweep_order[j - 1];
+            j--;
+        }
+        sweep_order[j] = i;
+        pipe_sent[i] = 0;
+        pipe_fastest[i] = UINT32_MAX;
+        pipe_answered[i] = false;
+    }
+}
+
+// Fold a boot attempt into flash_status.link_meta. The record is only stored
+// once something changed enough, smaller changes go along with the next one
+static void link_meta_commit() {
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        link_meta_t *meta = &flash_status.link_meta[i];
+        uint8_t status = meta->status | LINK_META_SEEN;
+        if (!pipe_answered[i]) {
+            // Read its capabilities again, it may be a different build now
+            status &= ~(LINK_META_SEEN | LINK_META_CAPS);
+        }
+        if (status != meta->status) {
+            meta->status = status;
+            link_meta_changed = true;
+        }
+
+        if (pipe_fastest[i] == UINT32_MAX) {
+            continue;
+        }
+        uint32_t turnaround = (pipe_fastest[i] > UINT16_MAX) ? UINT16_MAX : pipe_fastest[i];
+        uint32_t drift = meta->turnaround_us / 4;
+        if (turnaround + drift < meta->turnaround_us || turnaround > meta->turnaround_us + drift) {
+            meta->turnaround_us = turnaround;
+            link_meta_changed = true;
+        }
+    }
+    if (link_meta_changed && flash_store() == SUCCESS_RETURN) {
+        link_meta_changed = false;
+    }
+}
+#else
+#define PIPE_SENT(i, waited) ((void)0)
+#define PIPE_ANSWERED(i) ((void)0)
+#define pipe_due(i, waited) true
+#define pipe_reply(i, waited) ((void)0)
+#define link_meta_start() ((void)0)
+#define link_meta_commit() ((void)0)
+#endif
+
+#ifdef PIPE_ADAPT
+#ifndef LINK_STATS
+#error "PIPE_ADAPT watches the link error counters of LINK_STATS"
+#endif
+// Longest pause between two sweeps the controller backs off to
+#ifndef PIPE_ADAPT_PAUSE_MAX_US
+#define PIPE_ADAPT_PAUSE_MAX_US 400
+#endif
+
+// Validate exchanges allowed in flight at once, kept from one boot attempt
+// to the next, and the ones in flight now
+static unsigned adapt_depth;
+static unsigned adapt_inflight;
+// Pause after the current sweep, whether it found a reply, and the link
+// errors counted up to the last sweep
+static uint32_t adapt_pause;
+static bool adapt_replied;
+static uint32_t adapt_errors;
+
+#define ADAPT_SENT() (adapt_inflight++)
+#define ADAPT_DONE() (adapt_inflight--)
+#define ADAPT_REPLY() (adapt_replied = true)
+#define adapt_slot() (adapt_inflight < adapt_depth)
+
+// Start a pipelined phase at the depth the last one ended with, all of them
+// at first, and at the shortest pause
+static void adapt_start() {
+    if (adapt_depth == 0 || adapt_depth > flash_status.component_cnt) {
+        adapt_depth = flash_status.component_cnt;
+    }
+    adapt_inflight = 0;
+    adapt_pause = PIPE_SWEEP_DELAY_US;
+    adapt_replied = false;
+    adapt_errors = link_stats.retransmits + link_stats.auth_failures;
+}
+
+// End of a sweep, returns the pause before the next one. Resent or refused
+// frames mean the bus or the components are overrun: halve the depth and
+// double the pause. A reply earns one more exchange in flight and halves the
+// pause again, a sweep that found nothing stretches it, the polls it made
+// only took bus time from the transfers that were moving
+static uint32_t adapt_sweep() {
+    uint32_t errors = link_stats.retransmits + link_stats.auth_failures;
+    if (errors != adapt_errors) {
+        adapt_errors = errors;
+        adapt_depth = (adapt_depth > 1) ? adapt_depth / 2 : 1;
+        adapt_pause *= 2;
+    } else if (adapt_replied) {
+        if (adapt_depth < flash_status.component_cnt) {
+            adapt_depth++;
+        }
+        adapt_pause /= 2;
+    } else {
+        adapt_pause += PIPE_SWEEP_DELAY_US;
+    }
+    if (adapt_pause < PIPE_SWEEP_DELAY_US) {
+        adapt_pause = PIPE_SWEEP_DELAY_US;
+    } else if (adapt_pause > PIPE_ADAPT_PAUSE_MAX_US) {
+        adapt_pause = PIPE_ADAPT_PAUSE_MAX_US;
+    }
+    adapt_replied = false;
+    return adapt_pause;
+}
+#else
+#define ADAPT_SENT() ((void)0)
+#define ADAPT_DONE() ((void)0)
+#define ADAPT_REPLY() ((void)0)
+#define adapt_slot() true
+#define adapt_start() ((void)0)
+#define adapt_sweep() PIPE_SWEEP_DELAY_US
+#endif
+
+#ifdef PREVALIDATE
+// Cycle count of the last idle validation tried with each entry
+static uint32_t prevalidate_tried[MAX_COMPONENTS];
+static unsigned prevalidate_next;
+
+// Validate entry i and hold it, as validate_components would have
+static void prevalidate(unsigned i) {
+    i2c_addr_t addr = component_addrs[i];
+    validate_hold_t *hold = &validate_holds[i];
+    memset(hold, 0, sizeof(validate_hold_t));
+
+    // The last exchange of this idle spell may have been with the same
+    // entry, its challenge must not make this VALIDATE read as a BOOT
+    reset_msg();
+    transmit.opcode = COMPONENT_CMD_VALIDATE;
+    transmit.len = 0;
+    ap_wire_format_reset(addr);
+    if (issue_cmd(addr) != SUCCESS_RETURN) {
+        reset_msg();
+        return;
+    }
+#ifndef BOOT_TWO_TRIP
+    transmit.opcode = COMPONENT_CMD_VALIDATE;
+    transmit.len = 0;
+    if (issue_cmd(addr) != SUCCESS_RETURN) {
+        reset_msg();
+        return;
+    }
+#endif
+    msg_id_t *id = MSG_BODY(receive, msg_id_t);
+    if (id->component_id != flash_status.component_ids[i]) {
+        reset_msg();
+        return;
+    }
+    ap_wire_format_learn(addr, id);
+    hold->component_id = id->component_id;
+    hold->born = prevalidate_tried[i];
+    hold->age = 1;
+    msg_session_save(&hold->session);
+}
+
+// Host idle hook: validate the next entry whose hold is missing or half way
+// to PREVALIDATE_MS, so boot only has to send the BOOT frames. One exchange
+// at most per call, input meanwhile waits in HOST_RX_RING. An entry that
+// failed is tried again after PREVALIDATE_MS / 2
+static void prevalidate_idle() {
+    uint32_t now = DWT->CYCCNT;
+    for (unsigned n = 0; n < flash_status.component_cnt; n++) {
+        unsigned i = prevalidate_next++ % flash_status.component_cnt;
+        if (component_addr_bad[i] ||
+            now - prevalidate_tried[i] < PREVALIDATE_CYCLES(PREVALIDATE_MS / 2)) {
+            continue;
+        }
+        prevalidate_tried[i] = now;
+        prevalidate(i);
+        return;
+    }
+    MXC_Delay(100);
+}
+
+// Try every entry at the next idle, the holds were just dropped
+static void prevalidate_rearm() {
+    uint32_t stale = DWT->CYCCNT - PREVALIDATE_CYCLES(PREVALIDATE_MS);
+    for (unsigned i = 0; i < MAX_COMPONENTS; i++) {
+        prevalidate_tried[i] = stale;
+    }
+}
+#endif
+
+// Progress of one component through the pipelined validate exchange
+typedef enum {
+    PIPE_QUEUED,        // Waiting for PIPE_ADAPT to allow another exchange in flight
+    PIPE_WAIT_VALIDATE, // Sent VALIDATE, waiting for the component to prove itself
+    PIPE_WAIT_ID,       // Sent our proof, waiting for the component ID
+    PIPE_DONE,
+} pipe_stage_t;
+
+// Open the pipelined validate exchange with entry i
+static int pipe_validate_start(unsigned i, msg_session_t *session, uint32_t waited) {
+    i2c_addr_t addr = component_addrs[i];
+    transmit.opcode = COMPONENT_CMD_VALIDATE;
+    transmit.len = 0;
+
+    PROFILE_START(i, validate);
+    ap_wire_format_reset(addr);
+    if (profiled_transmit(i, addr) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+    msg_session_save(session);
+    PIPE_SENT(i, waited);
+    ADAPT_SENT();
+    return SUCCESS_RETURN;
+}
+
+int validate_components(msg_session_t *sessions, bool *validated) {
+    int validate_result = SUCCESS_RETURN;
+    unsigned pending = 0;
+    pipe_stage_t stage[flash_status.component_cnt];
+#ifdef BOOT_PROFILE
+    memset(boot_profile, 0, sizeof(boot_profile));
+#endif
+    link_meta_start();
+    adapt_start();
+
+    // Send VALIDATE to every component before waiting on any of them, so each
+    // component's crypto overlaps with the bus traffic of the others
+    for (unsigned k = 0; k < flash_status.component_cnt; k++) {
+        unsigned i = SWEEP_INDEX(k);
+        validated[i] = false;
+#ifdef VALIDATE_RESUME
+        // Still waiting from the last attempt, our boot frame picks it up
+        if (validate_hold_resume(i, &sessions[i])) {
+            validated[i] = true;
+            stage[i] = PIPE_DONE;
+            continue;
+        }
+#endif
+        // Reported by index_components, fails here instead of timing out
+        if (component_addr_bad[i]) {
+            print_error("Component ID: 0x%08x invalid\n", flash_status.component_ids[i]);
+            validate_result = ERROR_RETURN;
+            stage[i] = PIPE_DONE;
+            continue;
+        }
+
+        // Beyond the depth PIPE_ADAPT allows, opened once an exchange ends
+        if (!adapt_slot()) {
+            stage[i] = PIPE_QUEUED;
+            pending++;
+            continue;
+        }
+        if (pipe_validate_start(i, &sessions[i], 0) != SUCCESS_RETURN) {
+            print_error("Component ID: 0x%08x invalid\n", flash_status.component_ids[i]);
+            validate_result = ERROR_RETURN;
+            stage[i] = PIPE_DONE;
+            continue;
+        }
+        stage[i] = PIPE_WAIT_VALIDATE;
+        pending++;
+    }
+
+    // Collect replies round-robin in whatever order the components finish
+    sweep_sort();
+    uint32_t waited = 0;
+    while (pending) {
+        for (unsigned k = 0; k < flash_status.component_cnt; k++) {
+            unsigned i = SWEEP_INDEX(k);
+            if (stage[i] == PIPE_QUEUED) {
+                if (!adapt_slot()) {
+                    continue;
+                }
+                if (pipe_validate_start(i, &sessions[i], waited) == SUCCESS_RETURN) {
+                    stage[i] = PIPE_WAIT_VALIDATE;
+                    continue;
+                }
+                print_error("Component ID: 0x%08x invalid\n", flash_status.component_ids[i]);
+                validate_result = ERROR_RETURN;
+                stage[i] = PIPE_DONE;
+                pending--;
+                continue;
+            }
+            if (stage[i] == PIPE_DONE || !pipe_due(i, waited)) {
+                continue;
+            }
+            i2c_addr_t addr = component_addrs[i];
+            msg_session_load(&sessions[i]);
+
+            int ret = profiled_try_recv(i, addr);
+            if (ret == AP_PENDING && !link_expired(addr, waited)) {
+                continue;
+            }
+            if (ret == SUCCESS_RETURN) {
+                pipe_reply(i, waited);
+                ADAPT_REPLY();
+            }
+
+#ifdef BOOT_TWO_TRIP
+            // The component proved itself and sent its ID in one frame, our
+            // proof goes with the BOOT frame
+            if (ret == SUCCESS_RETURN && stage[i] == PIPE_WAIT_VALIDATE) {
+                stage[i] = PIPE_WAIT_ID;
+            }
+#endif
+            if (ret == SUCCESS_RETURN && stage[i] == PIPE_WAIT_VALIDATE) {
+                // If we get here, we believe the component is valid. Need to send it one more message so 
+                // it knows that we are valid
+                transmit.opcode = COMPONENT_CMD_VALIDATE;
+                transmit.len = 0;
+                if (profiled_transmit(i, addr) == SUCCESS_RETURN) {
+                    msg_session_save(&sessions[i]);
+                    PIPE_SENT(i, waited);
+                    stage[i] = PIPE_WAIT_ID;
+                    continue;
+                }
+            } else if (ret == SUCCESS_RETURN) {
+                // If we get here, the receive buffer should be holding the component id
+                uint32_t id = MSG_BODY(receive, msg_id_t)->component_id;
+                ap_wire_format_learn(addr, MSG_BODY(receive, msg_id_t));
+                // Save off this component's RNG challenge for boot
+                msg_session_save(&sessions[i]);
+                // Check that the result is correct
+                if (id == flash_status.component_ids[i]) {
+                    PROFILE_STOP(i, validate);
+                    validated[i] = true;
+                    stage[i] = PIPE_DONE;
+                    ADAPT_DONE();
+                    pending--;
+                    continue;
+                }
+            }
+
+            print_error("Component ID: 0x%08x invalid\n", flash_status.component_ids[i]);
+            validate_result = ERROR_RETURN;
+            stage[i] = PIPE_DONE;
+            ADAPT_DONE();
+            pending--;
+        }
+
+        uint32_t pause = adapt_sweep();
+        MXC_Delay(pause);
+        waited += pause;
+#if defined(LINK_ASYNC) && !defined(AP_RTOS)
+        link_run(pause);
+#endif
+    }
+
+    return validate_result;
+}
+
+#ifdef BOOT_GROUPS
+// Whether component i boots in group, -1 being every component
+#define BOOT_IN_GROUP(i, group) ((group) < 0 || flash_status.boot_levels[i] == (group))
+
+// Highest boot level of the provisioned components
+static int boot_last_level() {
+    int last = 0;
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        if (flash_status.boot_levels[i] > last) {
+            last = flash_status.boot_levels[i];
+        }
+    }
+    return last;
+}
+#else
+#define BOOT_IN_GROUP(i, group) true
+#endif
+
+int boot_components(msg_session_t *sessions, const bool *validated, int validate_result) {
+    int boot_result = validate_result;
+    // What the components are told, an abort or hold once a group failed
+    int result = validate_result;
+    unsigned pending = 0;
+    bool waiting[flash_status.component_cnt];
+#ifdef BOOT_BROADCAST
+    // Entry of every component for the release, in component order
+    uint8_t release[flash_status.component_cnt * I2C_RELEASE_ENTRY_LEN];
+#endif
+
+    // Without BOOT_GROUPS one group, -1, holds every component. With it the
+    // components boot level by level, each level all at once and only after
+    // every component of the levels before has answered, so boot takes as
+    // many round trips as the longest chain of dependencies. An abort or hold
+    // goes to everyone at once, and with BOOT_BROADCAST every component is
+    // asked first, so all or none boot, and only the releases go by level
+    int group = -1;
+    int last_group = -1;
+#if defined(BOOT_GROUPS) && !defined(BOOT_BROADCAST)
+    if (validate_result == SUCCESS_RETURN) {
+        group = 0;
+        last_group = boot_last_level();
+    }
+#endif
+
+    for (; group <= last_group; group++) {
+        // Here, the components are waiting for one more command from us that says "boot".
+        // Send it to all of them first, then collect the boot messages.
+        for (unsigned k = 0; k < flash_status.component_cnt; k++) {
+            unsigned i = SWEEP_INDEX(k);
+            waiting[i] = false;
+            if (!BOOT_IN_GROUP(i, group)) {
+                continue;
+            }
+            // Set the I2C address of the component
+            i2c_addr_t addr = component_addrs[i];
+            
+            // Resume this component's session so transmit replies with the
+            // right RNG response for it
+            msg_session_load(&sessions[i]);
+
+            // Set transmit contents to the validation result, so component knows
+            // whether it should finish booting or abort
+            msg_boot_t* boot_cmd = MSG_BODY(transmit, msg_boot_t);
+            if (result == SUCCESS_RETURN) {
+                boot_cmd->result = SUCCESS_RETURN;
+#ifdef VALIDATE_RESUME
+            } else if (validated != NULL && validated[i]) {
+                // Valid, but someone else failed: wait for the next attempt
+                boot_cmd->result = BOOT_RESULT_HOLD;
+#endif
+            } else {
+                boot_cmd->result = UINT32_MAX;
+            }
+            transmit.opcode = COMPONENT_CMD_BOOT;
+            transmit.len = sizeof(msg_boot_t);
+
+            PROFILE_START(i, boot);
+            if (profiled_transmit(i, addr) != SUCCESS_RETURN) {
+                print_error("Could not boot component 0x%08x\n", flash_status.component_ids[i]);
+                boot_result = ERROR_RETURN;
+                continue;
+            }
+            msg_session_save(&sessions[i]);
+            PIPE_SENT(i, 0);
+            waiting[i] = true;
+            pending++;
+        }
+
+        sweep_sort();
+        // Every BOOT frame is out already, PIPE_ADAPT only paces the polls
+        adapt_start();
+        uint32_t waited = 0;
+        while (pending) {
+            for (unsigned k = 0; k < flash_status.component_cnt; k++) {
+                unsigned i = SWEEP_INDEX(k);
+                if (!waiting[i] || !pipe_due(i, waited)) {
+                    continue;
+                }
+                i2c_addr_t addr = component_addrs[i];
+                msg_session_load(&sessions[i]);
+
+                int ret = profiled_try_recv(i, addr);
+                if (ret == AP_PENDING && !link_expired(addr, waited)) {
+                    continue;
+                }
+                waiting[i] = false;
+                pending--;
+
+                if (ret != SUCCESS_RETURN) {
+                    print_error("Could not boot component 0x%08x\n", flash_status.component_ids[i]);
+                    boot_result = ERROR_RETURN;
+#ifdef VALIDATE_RESUME
+                    memset(&validate_holds[i], 0, sizeof(validate_hold_t));
+#endif
+                    continue;
+                }
+
+                // Here, the component should have echoed our contents, and if successful
+                // in booting, followed them with its boot message
+                PROFILE_STOP(i, boot);
+                pipe_reply(i, waited);
+                PIPE_ANSWERED(i);
+                ADAPT_REPLY();
+                msg_boot_reply_t* reply = MSG_BODY(receive, msg_boot_reply_t);
+                uint32_t comp_boot = reply->result;
+#ifdef VALIDATE_RESUME
+                if (comp_boot == BOOT_RESULT_HOLD && result != SUCCESS_RETURN) {
+                    // Held, the next attempt goes on from this reply
+                    validate_hold_t *hold = &validate_holds[i];
+                    if (hold->age == 0) {
+                        hold->component_id = flash_status.component_ids[i];
+                        hold->age = 1;
+#ifdef PREVALIDATE
+                        hold->born = DWT->CYCCNT;
+#endif
+                    }
+                    msg_session_save(&hold->session);
+                    continue;
+                }
+                memset(&validate_holds[i], 0, sizeof(validate_hold_t));
+#endif
+                if (comp_boot == SUCCESS_RETURN) {
+                    // Print boot message from component
+                    print_info("0x%08x>%.64s\n", flash_status.component_ids[i], reply->message);
+#ifdef POST_BOOT_SESSION
+                    msg_channel_open(&comp_channels[i]);
+#endif
+#ifdef BOOT_BROADCAST
+                    // The component waits for this in the release
+                    if (ap_release_tag(addr, &release[i * I2C_RELEASE_ENTRY_LEN + 1]) != AP_SUCCESS) {
+                        boot_result = ERROR_RETURN;
+                    }
+                    release[i * I2C_RELEASE_ENTRY_LEN] = ap_home_addr(addr);
+#endif
+                } else {
+                    print_error("Could not boot component 0x%08x\n", flash_status.component_ids[i]);
+                    boot_result = ERROR_RETURN;
+                }
+            }
+
+            uint32_t pause = adapt_sweep();
+            MXC_Delay(pause);
+            waited += pause;
+#if defined(LINK_ASYNC) && !defined(AP_RTOS)
+            link_run(pause);
+#endif
+        }
+
+        // The levels after a failed one depend on it, they are not booted
+        result = boot_result;
+    }
+
+#ifdef BOOT_BROADCAST
+    // Every component is waiting on its release, so they all boot at once or
+    // none of them does. More components than one release holds take several
+    if (boot_result == SUCCESS_RETURN) {
+#ifdef BOOT_GROUPS
+        // Level by level, each release gathers the entries of one level
+        i2c_addr_t level_addrs[flash_status.component_cnt];
+        uint8_t level_release[flash_status.component_cnt * I2C_RELEASE_ENTRY_LEN];
+        for (int level = 0, last = boot_last_level(); level <= last && boot_result == SUCCESS_RETURN; level++) {
+            unsigned n = 0;
+            for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+                if (flash_status.boot_levels[i] == level) {
+                    level_addrs[n] = component_addrs[i];
+                    memcpy(&level_release[n * I2C_RELEASE_ENTRY_LEN], &release[i * I2C_RELEASE_ENTRY_LEN],
+                           I2C_RELEASE_ENTRY_LEN);
+                    n++;
+                }
+            }
+            for (unsigned i = 0; i < n; i += I2C_RELEASE_ENTRIES) {
+                unsigned count = n - i;
+                if (count > I2C_RELEASE_ENTRIES) {
+                    count = I2C_RELEASE_ENTRIES;
+                }
+                if (broadcast_release(&level_addrs[i], count, count * I2C_RELEASE_ENTRY_LEN,
+                                      &level_release[i * I2C_RELEASE_ENTRY_LEN]) != SUCCESS_RETURN) {
+                    print_error("Could not release components\n");
+                    boot_result = ERROR_RETURN;
+                    break;
+                }
+            }
+        }
+        memset(level_release, 0, sizeof(level_release));
+#else
+        for (unsigned i = 0; i < flash_status.component_cnt; i += I2C_RELEASE_ENTRIES) {
+            unsigned count = flash_status.component_cnt - i;
+            if (count > I2C_RELEASE_ENTRIES) {
+                count = I2C_RELEASE_ENTRIES;
+            }
+            if (broadcast_release(&component_addrs[i], count, count * I2C_RELEASE_ENTRY_LEN,
+                                  &release[i * I2C_RELEASE_ENTRY_LEN]) != SUCCESS_RETURN) {
+                print_error("Could not release components\n");
+                boot_result = ERROR_RETURN;
+                break;
+            }
+        }
+#endif
+    }
+    memset(release, 0, sizeof(release));
+#endif
+
+    return boot_result;
+}
+
+#ifdef ATTEST_CACHE
+// Copy the cached attestation data of component_id into out
+// Returns SUCCESS_RETURN on a hit that decrypts and verifies
+static int attest_cache_load(uint32_t component_id, uint8_t out[ATTEST_DATA_LEN]) {
+    for (unsigned i = 0; i < ATTEST_CACHE_SLOTS; i++) {
+        attest_cache_t *slot = &attest_cache[i];
+        if (!slot->valid || slot->component_id != component_id) {
+            continue;
+        }
+        uint8_t plain[ATTEST_CACHE_ENC_LEN];
+        uint8_t plain_hash[HASH_LEN];
+        aes_decrypt(slot->data, plain, slot->iv, ATTEST_CACHE_ENC_LEN);
+        hash(plain, plain_hash, ATTEST_DATA_LEN);
+        int result = ERROR_RETURN;
+        if (!secure_memcmp(plain_hash, plain + ATTEST_DATA_LEN, HASH_LEN)) {
+            memcpy(out, plain, ATTEST_DATA_LEN);
+            result = SUCCESS_RETURN;
+        } else {
+            slot->valid = 0;
+        }
+        memset(plain, 0, sizeof(plain));
+        return result;
+    }
+    return ERROR_RETURN;
+}
+
+// Encrypt the attestation data of component_id into the next cache slot
+static void attest_cache_save(uint32_t component_id, uint8_t data[ATTEST_DATA_LEN]) {
+    attest_cache_t *slot = &attest_cache[attest_cache_next];
+    attest_cache_next = (attest_cache_next + 1) % ATTEST_CACHE_SLOTS;
+
+    uint8_t plain[ATTEST_CACHE_ENC_LEN] = {0};
+    memcpy(plain, data, ATTEST_DATA_LEN);
+    hash(plain, plain + ATTEST_DATA_LEN, ATTEST_DATA_LEN);
+
+    uint64_t randValue;
+    randValue = rng_gen();
+    memcpy(&slot->iv[0], &randValue, sizeof(randValue));
+    randValue = rng_gen();
+    memcpy(&slot->iv[8], &randValue, sizeof(randValue));
+    aes_encrypt(plain, slot->data, slot->iv, ATTEST_CACHE_ENC_LEN);
+    slot->component_id = component_id;
+    slot->valid = 1;
+    memset(plain, 0, sizeof(plain));
+}
+
+// Drop every cached attestation, the provisioned set has changed
+static void attest_cache_clear() {
+    memset(attest_cache, 0, sizeof(attest_cache));
+}
+#endif
+
+// Append the attestation slice held in receive to the len bytes in out
+// Returns 1 if the component has more to send, 0 once out holds everything,
+// or ERROR_RETURN if the slice does not fit
+static int attest_append(uint8_t out[ATTEST_WIRE_LEN], unsigned *len) {
+    msg_attest_t* attest = MSG_BODY(receive, msg_attest_t);
+    if (receive.len < 1 || *len + receive.len - 1 > ATTEST_WIRE_LEN) {
+        return ERROR_RETURN;
+    }
+    memcpy(&out[*len], attest->data, receive.len - 1);
+    *len += receive.len - 1;
+    return attest->more ? 1 : 0;
+}
+
+#ifdef ATTEST_SEALED
+// Open the len bytes of sealed attestation data component_id sent, leaving
+// the plain data at the start of data and zeros after it
+static int attest_open(uint32_t component_id, uint8_t data[ATTEST_WIRE_LEN], unsigned len) {
+    int plain = msg_attest_open(component_id, data, len);
+    if (plain < 0 || plain > ATTEST_DATA_LEN) {
+        memset(data, 0, ATTEST_WIRE_LEN);
+        return ERROR_RETURN;
+    }
+    memset(&data[plain], 0, ATTEST_WIRE_LEN - plain);
+    return SUCCESS_RETURN;
+}
+#else
+#define attest_open(component_id, data, len) SUCCESS_RETURN
+#endif
+
+#ifdef ATTEST_ONE_TRIP
+// Challenge-response state the last attest of each provisioned component
+// ended on. The next attest answers the component's last challenge in its
+// first frame, which proves us to the component, so the data comes back in
+// the first reply unless the component has sent another frame since
+static msg_session_t attest_sessions[MAX_COMPONENTS];
+#endif
+
+// Run the attest exchange with provisioned component index and copy the
+// attestation data it sends into out
+static int fetch_attestation(unsigned index, uint8_t out[ATTEST_WIRE_LEN]) {
+    i2c_addr_t addr = component_addrs[index];
+#ifdef VALIDATE_RESUME
+    // A held component takes this as a new command and stops waiting
+    validate_holds_clear();
+#endif
+
+    // Initiate the handshake with the component, receive first response
+    transmit.opcode = COMPONENT_CMD_ATTEST;
+    transmit.len = 0;
+#ifdef ATTEST_ONE_TRIP
+    msg_session_load(&attest_sessions[index]);
+#endif
+
+    int ret = issue_cmd(addr);
+    if (ret != SUCCESS_RETURN) {
+        print_error("Failed to validate component\n");
+        return ERROR_RETURN;
+    }
+
+#ifdef ATTEST_ONE_TRIP
+    // Empty: our answer was stale, the component waits for our proof
+    if (receive.len == 0) {
+#endif
+    // If we get here, we believe the component is valid. Need to send it one more message so 
+    // it knows that we are valid
+    ret = issue_cmd(addr);
+    if (ret != SUCCESS_RETURN) {
+        print_error("Failed to retrieve attestation data\n");
+        return ERROR_RETURN;
+    }
+#ifdef ATTEST_ONE_TRIP
+    }
+#endif
+
+    // If we get here, our receive struct should hold the attestation data,
+    // ask for the rest as long as the component says there is more
+    memset(out, 0, ATTEST_WIRE_LEN);
+    unsigned len = 0;
+    while (1) {
+        ret = attest_append(out, &len);
+        if (ret == 0 && attest_open(flash_status.component_ids[index], out, len) != SUCCESS_RETURN) {
+            ret = ERROR_RETURN;
+        }
+        if (ret == ERROR_RETURN) {
+            print_error("Bad attestation data\n");
+            return ERROR_RETURN;
+        }
+        if (ret == 0) {
+#ifdef ATTEST_ONE_TRIP
+            msg_session_save(&attest_sessions[index]);
+#endif
+            return SUCCESS_RETURN;
+        }
+
+        transmit.opcode = COMPONENT_CMD_ATTEST;
+        transmit.len = 0;
+        if (issue_cmd(addr) != SUCCESS_RETURN) {
+            print_error("Failed to retrieve attestation data\n");
+            return ERROR_RETURN;
+        }
+    }
+}
+
+// Find field number index of the attestation data in data
+// Returns its length, or -1 if the data is malformed
+static int attest_field(const uint8_t data[ATTEST_DATA_LEN], unsigned index, const char** field) {
+    unsigned pos = 0;
+    for (unsigned i = 0; i <= index; i++) {
+        if (pos >= ATTEST_DATA_LEN || data[pos] > ATTEST_FIELD_MAX_LEN ||
+            pos + 1 + data[pos] > ATTEST_DATA_LEN) {
+            return -1;
+        }
+        *field = (const char*) &data[pos + 1];
+        if (i == index) {
+            return data[pos];
+        }
+        pos += 1 + data[pos];
+    }
+    return -1;
+}
+
+// Print the attestation data of component_id to serial and clear it
+static int print_attestation(uint32_t component_id, uint8_t data[ATTEST_DATA_LEN]) {
+    const char* attestation_loc;
+    const char* attestation_date;
+    const char* attestation_cust;
+    int loc_len = attest_field(data, 0, &attestation_loc);
+    int date_len = attest_field(data, 1, &attestation_date);
+    int cust_len = attest_field(data, 2, &attestation_cust);
+    if (loc_len < 0 || date_len < 0 || cust_len < 0) {
+        memset(data, 0, ATTEST_DATA_LEN);
+        print_error("Bad attestation data\n");
+        return ERROR_RETURN;
+    }
+
+    print_info("C>0x%08x\n", component_id);
+    print_info("LOC>%.*s\n", loc_len, attestation_loc);
+    print_info("DATE>%.*s\n", date_len, attestation_date);
+    print_info("CUST>%.*s\n", cust_len, attestation_cust);
+    memset(data, 0, ATTEST_DATA_LEN);
+    return SUCCESS_RETURN;
+}
+
+int attest_component(uint32_t component_id) {
+    // Check that this is a provisioned comonent
+    int index = find_component(component_id);
+    if (index < 0) {
+        print_error("Cannot attest non-provisioned component\n");
+        return ERROR_RETURN;
+    }
+    if (component_addr_bad[index]) {
+        print_error("Component 0x%08x has no I2C address of its own\n", component_id);
+        return ERROR_RETURN;
+    }
+    if (!presence_confirm(index)) {
+        return ERROR_RETURN;
+    }
+    
+    uint8_t attestation[ATTEST_WIRE_LEN];
+    SLOW_START(start);
+#ifdef ATTEST_CACHE
+    // Repeat attests are answered from the cache without any bus traffic
+    int result = attest_cache_load(component_id, attestation);
+    if (result != SUCCESS_RETURN) {
+        result = fetch_attestation(index, attestation);
         if (result == SUCCESS_RETURN) {
-            print_info("F>0x%08x\n", *((uint32_t*) receive.contents));
+            attest_cache_save(component_id, attestation);
+        }
+    }
+#else
+    int result = fetch_attestation(index, attestation);
+#endif
+    // A failed fetch that took long is the one worth looking at
+    SLOW_CHECK("attest", start, SLOW_ATTEST_MS);
+    if (result != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+
+    if (print_attestation(component_id, attestation) != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+    print_success("Attest\n");
+    return SUCCESS_RETURN;
+}
+
+// Progress of one component through the pipelined attest exchange
+typedef enum {
+    ATTEST_WAIT_CHAL,   // Sent ATTEST, waiting for the component to prove itself
+    ATTEST_WAIT_DATA,   // Sent our proof or asked for more, waiting for a slice
+    ATTEST_DONE,
+} attest_stage_t;
+
+int attest_all_components() {
+    int attest_result = SUCCESS_RETURN;
+    unsigned cnt = flash_status.component_cnt;
+    unsigned pending = 0;
+    attest_stage_t stage[cnt];
+    msg_session_t sessions[cnt];
+    uint8_t data[cnt][ATTEST_WIRE_LEN];
+    unsigned len[cnt];
+
+#ifdef VALIDATE_RESUME
+    // Held components take this as a new command and stop waiting
+    validate_holds_clear();
+#endif
+
+    // Send ATTEST to every component before waiting on any of them, like
+    // validate_components. Cached ones are printed right away.
+    for (unsigned k = 0; k < cnt; k++) {
+        unsigned i = SWEEP_INDEX(k);
+        stage[i] = ATTEST_DONE;
+        memset(data[i], 0, ATTEST_WIRE_LEN);
+        len[i] = 0;
+#ifdef ATTEST_CACHE
+        if (attest_cache_load(flash_status.component_ids[i], data[i]) == SUCCESS_RETURN) {
+            if (print_attestation(flash_status.component_ids[i], data[i]) != SUCCESS_RETURN) {
+                attest_result = ERROR_RETURN;
+            }
+            continue;
+        }
+#endif
+        transmit.opcode = COMPONENT_CMD_ATTEST;
+        transmit.len = 0;
+        if (component_addr_bad[i] || !presence_confirm(i) ||
+            profiled_transmit(i, component_addrs[i]) != SUCCESS_RETURN) {
+            print_error("Failed to attest component 0x%08x\n", flash_status.component_ids[i]);
+            attest_result = ERROR_RETURN;
+            continue;
+        }
+        msg_session_save(&sessions[i]);
+        stage[i] = ATTEST_WAIT_CHAL;
+        pending++;
+    }
+
+    // Collect replies round-robin and print each component as it finishes
+    sweep_sort();
+    uint32_t waited = 0;
+    while (pending) {
+        for (unsigned k = 0; k < cnt; k++) {
+            unsigned i = SWEEP_INDEX(k);
+            if (stage[i] == ATTEST_DONE) {
+                continue;
+            }
+            i2c_addr_t addr = component_addrs[i];
+            msg_session_load(&sessions[i]);
+
+            int ret = profiled_try_recv(i, addr);
+            if (ret == AP_PENDING && !link_expired(addr, waited)) {
+                continue;
+            }
+
+            // The component proved itself, or sent a slice
+            int more = 1;
+            if (ret == SUCCESS_RETURN && stage[i] == ATTEST_WAIT_DATA) {
+                more = attest_append(data[i], &len[i]);
+                if (more == 0 &&
+                    attest_open(flash_status.component_ids[i], data[i], len[i]) != SUCCESS_RETURN) {
+                    more = ERROR_RETURN;
+                }
+                if (more == 0) {
+                    // All there, the component is done with us
+#ifdef ATTEST_CACHE
+                    attest_cache_save(flash_status.component_ids[i], data[i]);
+#endif
+                    if (print_attestation(flash_status.component_ids[i], data[i]) != SUCCESS_RETURN) {
+                        attest_result = ERROR_RETURN;
+                    }
+                    stage[i] = ATTEST_DONE;
+                    pending--;
+                    continue;
+                }
+            }
+
+            if (ret == SUCCESS_RETURN && more == 1) {
+                // Prove ourselves, or ask for the next slice
+                transmit.opcode = COMPONENT_CMD_ATTEST;
+                transmit.len = 0;
+                if (profiled_transmit(i, addr) == SUCCESS_RETURN) {
+                    msg_session_save(&sessions[i]);
+                    stage[i] = ATTEST_WAIT_DATA;
+                    continue;
+                }
+            }
+
+            memset(data[i], 0, ATTEST_WIRE_LEN);
+            print_error("Failed to attest component 0x%08x\n", flash_status.component_ids[i]);
+            attest_result = ERROR_RETURN;
+            stage[i] = ATTEST_DONE;
+            pending--;
         }
+
+        MXC_Delay(PIPE_SWEEP_DELAY_US);
+        waited += PIPE_SWEEP_DELAY_US;
+#if defined(LINK_ASYNC) && !defined(AP_RTOS)
+        link_run(PIPE_SWEEP_DELAY_US);
+#endif
+    }
+
+    return attest_result;
+}
+
+/********************************* AP LOGIC ***********************************/
+
+// Boot sequence
+// YOUR DESIGN MUST NOT CHANGE THIS FUNCTION
+// Boot message is customized through the AP_BOOT_MSG macro
+COLD void boot() {
+    // POST BOOT FUNCTIONALITY
+    // DO NOT REMOVE IN YOUR DESIGN
+    #ifdef POST_BOOT
+        POST_BOOT
+    #else
+    // Everything after this point is modifiable in your design
+    // LED loop to show that boot occurred
+    while (1) {
+        LED_On(LED1);
+        MXC_Delay(500000);
+        LED_On(LED2);
+        MXC_Delay(500000);
+        LED_On(LED3);
+        MXC_Delay(500000);
+        LED_Off(LED1);
+        MXC_Delay(500000);
+        LED_Off(LED2);
+        MXC_Delay(500000);
+        LED_Off(LED3);
+        MXC_Delay(500000);
+    }
+    #endif
+}
+
+#ifdef ATTEMPT_LOCKOUT
+// Wait out the lockout earned by failures checks that failed in a row
+COLD static void attempt_lockout(uint32_t failures) {
+    uint64_t lockout = ATTEMPT_LOCKOUT_MAX_US;
+    if (failures <= 32) {
+        lockout = (uint64_t)ATTEMPT_LOCKOUT_BASE_US << (failures - 1);
+    }
+    if (lockout > ATTEMPT_LOCKOUT_MAX_US) {
+        lockout = ATTEMPT_LOCKOUT_MAX_US;
+    }
+    print_debug("Locked out for %lu ms\n", (unsigned long)(lockout / 1000));
+    sleep_us((uint32_t)lockout);
+}
+
+// Count a PIN or token check as failed in flash before it is made, then wait
+// out the lockout the failures before it have earned. Cutting power during
+// the wait or the check keeps the count, attempt_passed takes it back.
+// Returns ERROR_RETURN, failing the check, if the count cannot be stored
+static int attempt_begin() {
+    uint32_t failures = flash_status.failed_attempts;
+    if (flash_status.failed_attempts != UINT32_MAX) {
+        flash_status.failed_attempts++;
+    }
+    if (flash_store() != SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+    if (failures > 0) {
+        attempt_lockout(failures);
     }
-    print_success("List\n");
     return SUCCESS_RETURN;
 }
 
-int validate_components(uint32_t *challenges) {
-    int validate_result = SUCCESS_RETURN;
+// Clear the count after a check passed. Only the next record written keeps
+// it, so a reset before then costs one base lockout, but a good check
+// never waits on flash
+static void attempt_passed() {
+    flash_status.failed_attempts = 0;
+}
+#endif
+
+// Whether buf holds the correct PIN, compared in constant time
+static int pin_matches(const char *buf) {
+    char pin[7];
+    strncpy(pin, AP_PIN, 6);
+    pin[6] = '\0';
+    int match = (strlen(buf) == 6) && !secure_memcmp((const uint8_t*) buf, (uint8_t*) pin, 6);
+    memset(pin, 0, sizeof(pin));
+    return match;
+}
+
+// Compare the entered PIN to the correct PIN
+int validate_pin() {
+    char buf[50];
+    recv_input("Enter pin: ", buf, 50);
+
+#ifdef ATTEMPT_LOCKOUT
+    if (attempt_begin() != SUCCESS_RETURN) {
+        print_error("Cannot record attempt\n");
+        return ERROR_RETURN;
+    }
+#endif
+    // Right before the memcmp, pause for random time
+    // between CHECK_DELAY_MIN_US and CHECK_DELAY_MAX_US. Tries to avoid timing attacks
+    time_delay(CHECK_DELAY_MIN_US, CHECK_DELAY_MAX_US);
+    if (pin_matches(buf)) {
+#ifdef ATTEMPT_LOCKOUT
+        attempt_passed();
+#endif
+        print_debug("Pin Accepted!\n");
+        return SUCCESS_RETURN;
+    }
+    print_error("Invalid PIN!\n");
+    return ERROR_RETURN;
+}
+
+// Function to validate the replacement token
+int validate_token() {
+    char buf[50];
+    recv_input("Enter token: ", buf, 50);
+    char token[17];
+    strncpy(token, AP_TOKEN, 16);
+    token[16] = '\0';
+
+#ifdef ATTEMPT_LOCKOUT
+    if (attempt_begin() != SUCCESS_RETURN) {
+        print_error("Cannot record attempt\n");
+        return ERROR_RETURN;
+    }
+#endif
+    // Right before the memcmp, pause for random time
+    // between CHECK_DELAY_MIN_US and CHECK_DELAY_MAX_US. Tries to avoid timing attacks
+    time_delay(CHECK_DELAY_MIN_US, CHECK_DELAY_MAX_US);
+    if ((strlen(buf) == 16) && !secure_memcmp((uint8_t*) buf, (uint8_t*) token, 16)) {
+#ifdef ATTEMPT_LOCKOUT
+        attempt_passed();
+#endif
+        print_debug("Token Accepted!\n");
+        return SUCCESS_RETURN;
+    }
+    print_error("Invalid Token!\n");
+    return ERROR_RETURN;
+}
 
-    // Validate each component has the correct ID
+// Boot the components and board if the components validate
+#ifdef BOOT_PROFILE
+// Print the timing of every component through the last boot attempt.
+// Phases a component never finished print as 0
+static void boot_profile_print() {
+    uint32_t cycles_per_us = SystemCoreClock / 1000000;
     for (unsigned i = 0; i < flash_status.component_cnt; i++) {
-        // Initiate the handshake with the component, receive first response
-        i2c_addr_t addr = component_id_to_i2c_addr(flash_status.component_ids[i]);
-        transmit.opcode = COMPONENT_CMD_VALIDATE;
+        boot_profile_t *profile = &boot_profile[i];
+        print_debug("0x%08x validate %lu us, boot %lu us, %lu polls, %lu crypto cycles\n",
+            flash_status.component_ids[i],
+            (unsigned long) (profile->validate_cycles / cycles_per_us),
+            (unsigned long) (profile->boot_cycles / cycles_per_us),
+            (unsigned long) profile->polls,
+            (unsigned long) profile->crypto_cycles);
+    }
+}
+#endif
 
-        int ret = issue_cmd(addr);
-        if (ret != SUCCESS_RETURN) {
-            print_error("Component ID: 0x%08x invalid\n", flash_status.component_ids[i]);
-            validate_result = ERROR_RETURN;
+void attempt_boot() {
+    msg_session_t comp_sessions[flash_status.component_cnt];
+    bool validated[flash_status.component_cnt];
+    POWER_ENTER(POWER_BOOT);
+#ifdef PRESENCE_MONITOR
+    // Every component has to boot, fail before any exchange if one is gone
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        if (!presence_confirm(i)) {
+            POWER_EXIT(POWER_BOOT);
+            print_error("Boot Failed\n");
+            return;
+        }
+    }
+#endif
+#ifdef FIRMWARE_MEASURE
+    // Pages the idle time did not get to are checked now
+    if (measure_finish(NULL) != 0) {
+        POWER_EXIT(POWER_BOOT);
+        print_error("Boot Failed\n");
+        return;
+    }
+#endif
+    SLOW_START(start);
+    components_wait_ready(false);
+    int validate_result = validate_components(comp_sessions, validated);
+    int boot_result = boot_components(comp_sessions, validated, validate_result);
+    POWER_EXIT(POWER_BOOT);
+    SLOW_CHECK("boot", start, SLOW_BOOT_MS);
+#ifdef COMP_READY
+    if (boot_result != SUCCESS_RETURN) {
+        memset(component_ready, 0, sizeof(component_ready));
+    }
+#endif
+    // Before boot() takes over for good
+    link_meta_commit();
+#ifdef BOOT_PROFILE
+    boot_profile_print();
+#endif
+
+    if (boot_result != SUCCESS_RETURN) {
+        print_error("Boot Failed\n");
+        return;
+    }
+
+    // Debug builds only: nothing takes the trace or capture command once we boot
+    trace_dump();
+    i2c_capture_dump();
+    log_binary_drain();
+
+    // Print boot message
+    // This always needs to be printed when booting
+    print_info("AP>%s\n", AP_BOOT_MSG);
+    print_success("Boot\n");
+#ifdef HOST_UART_STREAM
+    host_uart_restore();
+#endif
+#if defined(PRESENCE_MONITOR) || defined(PREVALIDATE)
+    // The bus belongs to the post-boot code from here on
+    host_set_idle(NULL);
+#endif
+#ifdef LINK_SPI
+    // Post-boot traffic of the components wired for it goes over SPI
+    board_link_spi_start();
+#endif
+    // Boot
+    reset_msg();
+    boot();
+}
+
+// Swap component_id_out for component_id_in in flash_status, in RAM only
+// See replace_commit for making it stick
+static int replace_component(uint32_t component_id_in, uint32_t component_id_out) {
+    // Make sure the in component is not already provisioned
+    if (find_component(component_id_in) >= 0) {
+        print_error("Component 0x%08x is already provisioned!\n", component_id_in);
+        return ERROR_RETURN;
+    }
+
+    // Find the component to swap out
+    int index = find_component(component_id_out);
+    if (index < 0) {
+        // Component Out was not found
+        print_error("Component 0x%08x is not provisioned for the system\r\n",
+                component_id_out);
+        return ERROR_RETURN;
+    }
+
+    // Two components on one address could never both be reached
+    if (component_addr_clash(component_id_in, index)) {
+        print_error("Component 0x%08x has no I2C address of its own\n", component_id_in);
+        return ERROR_RETURN;
+    }
+    flash_status.component_ids[index] = component_id_in;
+#ifdef LINK_META
+    // Nothing is known about the link to the new one yet
+    memset(&flash_status.link_meta[index], 0, sizeof(link_meta_t));
+#endif
+    sort_components();
+
+    print_debug("Replaced 0x%08x with 0x%08x\n", component_id_out,
+            component_id_in);
+    return SUCCESS_RETURN;
+}
+
+// Apply the replacements made to flash_status and store them in flash
+static void replace_commit() {
+    index_components();
+#ifdef COMP_READY
+    // Indexes moved, and the new components may only just have powered up
+    memset(component_ready, 0, sizeof(component_ready));
+    components_wait_ready(true);
+#endif
+    // The new components still answer on their home addresses
+    addr_assign();
+#ifdef VALIDATE_RESUME
+    validate_holds_clear();
+#endif
+#ifdef ATTEST_CACHE
+    attest_cache_clear();
+#endif
+
+    // Append the updated component_ids to the flash log
+    flash_store();
+
+    // The new components may not support the current bus speed
+    negotiate_speed();
+}
+
+// Replace a component if the PIN is correct
+void attempt_replace() {
+    char buf[50];
+
+    if (validate_token()) {
+        // We are potentially being attacked -- pause 
+        // for 4 seconds, set LED to red during the pause
+        LED_Off(LED3);
+        sleep_us(4000000);
+        LED_On(LED3);
+        return;
+    }
+
+    uint32_t component_id_in = 0;
+    uint32_t component_id_out = 0;
+
+    recv_input("Component ID In: ", buf, 50);
+    sscanf(buf, "%x", &component_id_in);
+    recv_input("Component ID Out: ", buf, 50);
+    sscanf(buf, "%x", &component_id_out);
+
+    if (replace_component(component_id_in, component_id_out) != SUCCESS_RETURN) {
+        return;
+    }
+    replace_commit();
+    print_success("Replace\n");
+}
+
+// Replace several components under one token check and one flash write
+// Either every pair is applied or, if any of them is rejected, none is
+void attempt_replace_batch() {
+    char buf[50];
+
+    if (validate_token()) {
+        // We are potentially being attacked -- pause 
+        // for 4 seconds, set LED to red during the pause
+        LED_Off(LED3);
+        sleep_us(4000000);
+        LED_On(LED3);
+        return;
+    }
+
+    unsigned count = 0;
+    recv_input("Replacements: ", buf, 50);
+    sscanf(buf, "%u", &count);
+    if (count == 0 || count > flash_status.component_cnt) {
+        print_error("Cannot replace %u components\n", count);
+        return;
+    }
+
+    // Read every pair before checking any, so a rejected one does not
+    // leave the host's remaining answers queued for the next command
+    uint32_t component_ids_in[count];
+    uint32_t component_ids_out[count];
+    for (unsigned i = 0; i < count; i++) {
+        component_ids_in[i] = 0;
+        component_ids_out[i] = 0;
+        recv_input("Component ID In: ", buf, 50);
+        sscanf(buf, "%x", &component_ids_in[i]);
+        recv_input("Component ID Out: ", buf, 50);
+        sscanf(buf, "%x", &component_ids_out[i]);
+    }
+
+    uint32_t saved_ids[flash_status.component_cnt];
+    memcpy(saved_ids, flash_status.component_ids, sizeof(saved_ids));
+    for (unsigned i = 0; i < count; i++) {
+        if (replace_component(component_ids_in[i], component_ids_out[i]) != SUCCESS_RETURN) {
+            memcpy(flash_status.component_ids, saved_ids, sizeof(saved_ids));
+            print_error("Replace Failed\n");
+            return;
+        }
+    }
+    replace_commit();
+    print_success("Replace\n");
+}
+
+// Attest a component if the PIN is correct
+void attempt_attest() {
+    char buf[50];
+
+    if (validate_pin()) {
+        // We are potentially being attacked -- pause 
+        // for 4 seconds, set LED to red during the pause
+        LED_Off(LED3);
+        sleep_us(4000000);
+        LED_On(LED3);
+        return;
+    }
+    uint32_t component_id;
+    recv_input("Component ID: ", buf, 50);
+    sscanf(buf, "%x", &component_id);
+    attest_component(component_id);
+}
+
+// Attest every provisioned component if the PIN is correct
+void attempt_attest_all() {
+    if (validate_pin()) {
+        // We are potentially being attacked -- pause 
+        // for 4 seconds, set LED to red during the pause
+        LED_Off(LED3);
+        sleep_us(4000000);
+        LED_On(LED3);
+        return;
+    }
+    if (attest_all_components() != SUCCESS_RETURN) {
+        print_error("Attest Failed\n");
+        return;
+    }
+    print_success("Attest\n");
+}
+
+#ifdef FIRMWARE_MEASURE
+// Print the measurement of the firmware image, checking what is left of it
+void attempt_measure() {
+    uint8_t measurement[HASH_LEN];
+    if (measure_finish(measurement) != 0) {
+        print_error("Measure Failed\n");
+        return;
+    }
+    print_hex_info(measurement, HASH_LEN);
+    print_success("Measure\n");
+}
+#endif
+
+#ifdef LINK_STATS
+// Print one set of counters, average polls rounded down
+static void stats_print(uint32_t component_id, const link_stats_t *stats) {
+    unsigned long avg = stats->polls ? stats->poll_loops / stats->polls : 0;
+    print_debug("0x%08x sent %lu, received %lu, auth failures %lu, challenge mismatches %lu, "
+                "replays %lu, retransmits %lu\n", component_id,
+                (unsigned long) stats->frames_sent, (unsigned long) stats->frames_recv,
+                (unsigned long) stats->auth_failures, (unsigned long) stats->chal_mismatches,
+                (unsigned long) stats->replays, (unsigned long) stats->retransmits);
+    print_debug("0x%08x polls %lu, loops avg %lu max %lu, flash erases %lu, "
+                "cycles crypto %lu rng %lu flash %lu\n", component_id,
+                (unsigned long) stats->polls, avg, (unsigned long) stats->poll_loops_max,
+                (unsigned long) stats->flash_erases, (unsigned long) stats->crypto_cycles,
+                (unsigned long) stats->rng_cycles, (unsigned long) stats->flash_cycles);
+}
+
+#ifdef LAT_HIST
+static void command_hists_print(void);
+
+// Print one histogram unless it is empty: samples, median and 99th
+// percentile as bucket bounds in us, then every bucket count
+static void hist_print(uint32_t component_id, const char *name, const lat_hist_t *hist) {
+    uint32_t total = lat_hist_total(hist);
+    if (total == 0) {
+        return;
+    }
+    char counts[LAT_HIST_BUCKETS * 6 + 1];
+    int pos = 0;
+    for (int b = 0; b < LAT_HIST_BUCKETS; b++) {
+        char digits[5];
+        int n = 0;
+        unsigned count = hist->counts[b];
+        do {
+            digits[n++] = '0' + count % 10;
+            count /= 10;
+        } while (count);
+        counts[pos++] = ' ';
+        while (n) {
+            counts[pos++] = digits[--n];
+        }
+    }
+    counts[pos] = '\0';
+    print_debug("0x%08x %s n %lu p50 %lu p99 %lu us, buckets%s\n", component_id, name,
+                (unsigned long) total, (unsigned long) lat_hist_percentile(hist, 50),
+                (unsigned long) lat_hist_percentile(hist, 99), counts);
+}
+
+// Fetch and print the histogram of every opcode component i handled
+static void component_hists_print(unsigned i) {
+    static const char* const names[COMPONENT_CMD_COUNT] = {
+#define COMPONENT_CMD_NAME(name) #name,
+        COMPONENT_CMDS(COMPONENT_CMD_NAME)
+#undef COMPONENT_CMD_NAME
+    };
+    uint32_t component_id = flash_status.component_ids[i];
+    for (uint8_t opcode = COMPONENT_CMD_NONE + 1; opcode < COMPONENT_CMD_COUNT; opcode++) {
+        MSG_BODY(transmit, msg_hist_req_t)->opcode = opcode;
+        transmit.opcode = COMPONENT_CMD_HIST;
+        transmit.len = sizeof(msg_hist_req_t);
+        msg_hist_t* reply = MSG_BODY(receive, msg_hist_t);
+        if (issue_cmd(component_addrs[i]) != SUCCESS_RETURN ||
+            receive.len != sizeof(msg_hist_t) || reply->opcode != opcode) {
+            print_debug("0x%08x no histograms\n", component_id);
+            return;
+        }
+        lat_hist_t hist;
+        memcpy(&hist, &reply->hist, sizeof(hist));
+        hist_print(component_id, names[opcode], &hist);
+    }
+}
+#endif
+
+// Debug builds only: print the AP's counters, the frames exchanged with every
+// provisioned component and each component's own counters. The AP prints as
+// component ID 0, components that do not answer only get their frame counts.
+// With LAT_HIST the latency histograms of the AP's commands and link
+// operations and of every component's opcodes follow
+void attempt_stats() {
+    link_stats_t stats;
+    link_stats_snapshot(&stats);
+    stats_print(0, &stats);
+
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        uint32_t component_id = flash_status.component_ids[i];
+        uint32_t sent, recv;
+        board_link_frames(component_addrs[i], &sent, &recv);
+        print_debug("0x%08x frames from AP %lu, to AP %lu\n", component_id,
+                    (unsigned long) sent, (unsigned long) recv);
+        if (component_addr_bad[i]) {
             continue;
         }
 
-        // If we get here, we believe the component is valid. Need to send it one more message so 
-        // it knows that we are valid
-        ret = issue_cmd(addr);
-        if (ret != SUCCESS_RETURN) {
-            print_error("Component ID: 0x%08x invalid\n", flash_status.component_ids[i]);
-            validate_result = ERROR_RETURN;
+        transmit.opcode = COMPONENT_CMD_STATS;
+        transmit.len = 0;
+        if (issue_cmd(component_addrs[i]) != SUCCESS_RETURN ||
+            receive.len != sizeof(msg_stats_t)) {
+            print_debug("0x%08x no stats\n", component_id);
             continue;
         }
+        stats_print(component_id, MSG_BODY(receive, msg_stats_t));
+    }
+#ifdef LAT_HIST
+    command_hists_print();
+    hist_print(0, "issue_cmd", &ap_link_hists[LAT_LINK_ISSUE_CMD]);
+    hist_print(0, "ap_transmit", &ap_link_hists[LAT_LINK_TRANSMIT]);
+    hist_print(0, "ap_poll_recv", &ap_link_hists[LAT_LINK_POLL_RECV]);
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        if (!component_addr_bad[i]) {
+            component_hists_print(i);
+        }
+    }
+#endif
+    print_success("Stats\n");
+}
+#endif
 
-        // If we get here, the receive buffer should be holding the component id
-        uint32_t id = *((uint32_t*) receive.contents);
-        // Save off this component's RNG challenge
-        challenges[i] = receive.rng_chal;
-        // Check that the result is correct
-        if (id != flash_status.component_ids[i]) {
-            print_error("Component ID: 0x%08x invalid\n", flash_status.component_ids[i]);
-            validate_result = ERROR_RETURN;
+#ifdef KEY_ROTATION
+// Move component i to the key of the rotation in progress. It may still run
+// under our key, already under the new one if we lost its reply last time,
+// or under the deployment key if it was replaced since the last rotation,
+// so each is tried in turn. Leaves the session under whichever key was tried last
+static int rekey_component(unsigned i) {
+    static const uint8_t deploy_key[KEY_STORE_KEY_LEN] = KEY;
+    const uint8_t* keys[3] = {key_store.key, key_store.next, deploy_key};
+    unsigned key_cnt = (key_store.epoch == 0) ? 2 : 3;
+    uint8_t proof[HASH_LEN];
+    int result = ERROR_RETURN;
+
+    key_store_proof(key_store.next_epoch, key_store.next, proof);
+    for (unsigned k = 0; k < key_cnt && result != SUCCESS_RETURN; k++) {
+        if (crypto_rekey(keys[k]) != 0) {
+            break;
+        }
+        reset_msg();
+        msg_rekey_t* rekey = MSG_BODY(transmit, msg_rekey_t);
+        rekey->epoch = key_store.next_epoch;
+        memcpy(rekey->key, key_store.next, KEY_STORE_KEY_LEN);
+        transmit.opcode = COMPONENT_CMD_REKEY;
+        transmit.len = sizeof(msg_rekey_t);
+
+        msg_rekey_reply_t* reply = MSG_BODY(receive, msg_rekey_reply_t);
+        if (issue_cmd(component_addrs[i]) == SUCCESS_RETURN &&
+            receive.len == sizeof(msg_rekey_reply_t) && reply->epoch == key_store.next_epoch &&
+            !secure_memcmp(reply->proof, proof, HASH_LEN)) {
+            result = SUCCESS_RETURN;
         }
     }
+    reset_msg();
+    return result;
+}
+
+// Make the key of the rotation in progress the device key, in RAM even if the
+// record cannot be stored: the pending one still names it
+static int rotate_commit() {
+    key_store_t done = key_store;
+    done.epoch = key_store.next_epoch;
+    memcpy(done.key, key_store.next, KEY_STORE_KEY_LEN);
+    done.next_epoch = 0;
+    secure_zero(done.next, KEY_STORE_KEY_LEN);
+    int result = key_store_save(KEY_STORE_ADDR, &done) == 0 ? SUCCESS_RETURN : ERROR_RETURN;
+    key_store = done;
+    secure_zero(&done, sizeof(done));
+    return result;
+}
+
+// Finish a rotation a power cut interrupted after flash_status was stored
+// under the new key. Only attempt_rotate stores anything under it, once
+// every component confirmed it, so flash_status readable under it means
+// the rotation went through
+static void rotate_resume() {
+    if (key_store.next_epoch == 0) {
+        return;
+    }
+    if (crypto_rekey(key_store.next) == 0 && flash_load() == SUCCESS_RETURN) {
+        rotate_commit();
+        return;
+    }
+    crypto_rekey(key_store.key);
+}
+
+// Move every provisioned component and then the AP to a new device key if the
+// token is correct. The new key is stored before any component gets it, and
+// until every component confirmed it the AP stays on the old one, so a failed
+// rotation is finished by running it again
+void attempt_rotate() {
+    if (validate_token()) {
+        // We are potentially being attacked -- pause 
+        // for 4 seconds, set LED to red during the pause
+        LED_Off(LED3);
+        sleep_us(4000000);
+        LED_On(LED3);
+        return;
+    }
 
-    return validate_result;
-}
-
-int boot_components(uint32_t *challenges, int validate_result) {
-    int boot_result = validate_result;
+#ifdef VALIDATE_RESUME
+    // Held components take REKEY as a new command and stop waiting
+    validate_holds_clear();
+#endif
 
-    // Here, the components are waiting for one more command from us that says "boot"
-    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
-        // Set the I2C address of the component
-        i2c_addr_t addr = component_id_to_i2c_addr(flash_status.component_ids[i]);
-        
-        // Set RNG challenge of receive to saved challenge to trick transmit
-        // into replying with the right RNG response for this component
-        receive.rng_chal = challenges[i];
-
-        // Set transmit contents to current boot result, so component knows
-        // whether it should finish booting or abort
-        if (boot_result != SUCCESS_RETURN) {
-            *((uint32_t *) transmit.contents) = UINT32_MAX;
-        } else {
-            *((uint32_t *) transmit.contents) = SUCCESS_RETURN;
-        }
-        
-        // Send out command and receive result
-        int ret = issue_cmd(addr);
-        if (ret != SUCCESS_RETURN) {
-            print_error("Could not boot component 0x%08x\n", flash_status.component_ids[i]);
-            boot_result = ERROR_RETURN;
-            continue;
+    if (key_store.next_epoch == 0) {
+        key_store.next_epoch = key_store.epoch + 1;
+        for (unsigned i = 0; i < KEY_STORE_KEY_LEN; i += sizeof(uint64_t)) {
+            uint64_t randValue = rng_gen();
+            memcpy(&key_store.next[i], &randValue, sizeof(randValue));
         }
-
-        // Here, the component should have echoed our contents, and if successful
-        // in booting, the component's boot message should be at contents[4]
-        uint32_t comp_boot = *((uint32_t*) receive.contents);
-        if (comp_boot == SUCCESS_RETURN) {
-            // Print boot message from component
-            print_info("0x%08x>%.64s\n", flash_status.component_ids[i], &(receive.contents[4]));
-        } else {
-            print_error("Could not boot component 0x%08x\n", flash_status.component_ids[i]);
-            boot_result = ERROR_RETURN;
+        if (key_store_save(KEY_STORE_ADDR, &key_store) != SUCCESS_RETURN) {
+            key_store.next_epoch = 0;
+            secure_zero(key_store.next, KEY_STORE_KEY_LEN);
+            print_error("Cannot store the new key\n");
+            return;
         }
     }
 
-    return boot_result;
-}
-
-int attest_component(uint32_t component_id) {
-    // Check that this is a provisioned comonent
-    int provisioned = 0;
+    int result = SUCCESS_RETURN;
     for (unsigned i = 0; i < flash_status.component_cnt; i++) {
-        if (component_id == flash_status.component_ids[i]) {
-            provisioned = 1;
+        if (component_addr_bad[i] || rekey_component(i) != SUCCESS_RETURN) {
+            print_error("Failed to rotate the key of component 0x%08x\n", flash_status.component_ids[i]);
+            result = ERROR_RETURN;
+            break;
         }
     }
-    if (!provisioned) {
-        print_error("Cannot attest non-provisioned component\n");
-        return ERROR_RETURN;
+    if (result != SUCCESS_RETURN) {
+        crypto_rekey(key_store.key);
+        print_error("Rotate Failed\n");
+        return;
     }
-    
-    // Initiate the handshake with the component, receive first response
-    i2c_addr_t addr = component_id_to_i2c_addr(component_id);
-    transmit.opcode = COMPONENT_CMD_ATTEST;
 
-    int ret = issue_cmd(addr);
-    if (ret != SUCCESS_RETURN) {
-        print_error("Failed to validate component\n");
-        return ERROR_RETURN;
+    // Every component runs under the new key, so does the AP from now on.
+    // flash_status goes under it into a fresh page before the key store drops
+    // the old key, so a power cut in between leaves the pending record and a
+    // flash_status init finds under its new key, see rotate_resume
+    flash_next = MXC_FLASH_PAGE_SIZE;
+    if (crypto_rekey(key_store.next) != 0 || flash_store() != SUCCESS_RETURN) {
+        crypto_rekey(key_store.key);
+        print_error("Rotate Failed\n");
+        return;
+    }
+#ifdef ATTEST_CACHE
+    // Encrypted under the old key
+    attest_cache_clear();
+#endif
+    if (rotate_commit() != SUCCESS_RETURN) {
+        print_error("Rotate Failed\n");
+        return;
     }
+    print_success("Rotate\n");
+}
+#endif
 
-    // If we get here, we believe the component is valid. Need to send it one more message so 
-    // it knows that we are valid
-    ret = issue_cmd(addr);
-    if (ret != SUCCESS_RETURN) {
-        print_error("Failed to retrieve attestation data\n");
-        return ERROR_RETURN;
+#ifdef HOST_UART_STREAM
+// Switch the host UART to the rate in arg for the next command
+// The host follows once it sees the success message, a rejected rate leaves
+// both sides where they were
+void attempt_baud(const char *arg) {
+    unsigned long baud = 0;
+    sscanf(arg, "%lu", &baud);
+    if (baud < HOST_UART_BAUD_DEFAULT || baud > HOST_UART_BAUD_MAX) {
+        print_error("Unsupported baud rate %lu\n", baud);
+        return;
     }
+    print_success("Baud\n");
+    if (host_uart_set_baud(baud) != 0) {
+        print_error("Could not set baud rate %lu\n", baud);
+    }
+}
+#endif
 
-    // If we get here, our receive struct should hold the attestation data, so print it to serial
-    char attestation_loc[65];
-    char attestation_date[65];
-    char attestation_cust[65];
+#ifdef HOST_BINARY_CMD
+// Serve binary request frames, queued in arrival order, until the host asks
+// for text mode again
+// Each request runs the same handler as its text command, recv_input hands
+// out the frame arguments and the printed messages become the reply
+void attempt_binary() {
+    // Queue requests from here on, the host sends its first one as soon as
+    // it sees the success message
+    host_binary_start();
+    print_success("Binary\n");
+    while (1) {
+        reset_msg();
+        int opcode = host_binary_recv();
+        switch (opcode) {
+        case HOST_OP_LIST:
+            scan_components();
+            break;
+        case HOST_OP_BOOT:
+            attempt_boot();
+            break;
+        case HOST_OP_REPLACE:
+            attempt_replace();
+            break;
+        case HOST_OP_REPLACE_BATCH:
+            attempt_replace_batch();
+            break;
+        case HOST_OP_ATTEST:
+            attempt_attest();
+            break;
+        case HOST_OP_ATTEST_ALL:
+            attempt_attest_all();
+            break;
+        case HOST_OP_TEXT:
+            print_success("Text\n");
+            host_binary_end();
+            host_binary_stop();
+            return;
+        default:
+            print_error("Unrecognized opcode 0x%02x\n", opcode);
+            break;
+        }
+        host_binary_end();
+    }
+}
+#endif
 
-    memcpy(attestation_loc, &(receive.contents[0]), 64);
-    attestation_loc[64] = '\0';
+#ifdef BENCH_ENABLE
+// Scan every provisioned component once
+static void bench_scan() {
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        transmit.opcode = COMPONENT_CMD_SCAN;
+        transmit.len = 0;
+        issue_cmd(component_addrs[i]);
+    }
+}
 
-    memcpy(attestation_date, &(receive.contents[65]), 64);
-    attestation_date[64] = '\0';
+// Send every provisioned component one unsealed packet and wait for the reply
+// The component rejects it and answers with a sealed frame, so this is the raw
+// link plus the component's reply path
+static void bench_link() {
+    static uint8_t packet[MAX_MSG_LEN];
+    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
+        send_packet(component_addrs[i], sizeof(packet), packet);
+        poll_and_receive_packet(component_addrs[i], packet);
+    }
+}
 
-    memcpy(attestation_cust, &(receive.contents[130]), 64);
-    attestation_cust[64] = '\0';
+// Run the full validate and boot exchange, with the boot aborted at the last
+// step so the components stay in their command loop for the next iteration.
+// Every component reports the abort, boot_components prints it as an error
+static void bench_validate_boot() {
+    msg_session_t comp_sessions[flash_status.component_cnt];
+    bool validated[flash_status.component_cnt];
+    validate_components(comp_sessions, validated);
+    boot_components(comp_sessions, NULL, ERROR_RETURN);
+}
 
-    print_info("C>0x%08x\n", component_id);
-    print_info("LOC>%.64s\n", attestation_loc);
-    print_info("DATE>%.64s\n", attestation_date);
-    print_info("CUST>%.64s\n", attestation_cust);
-    print_success("Attest\n");
+// One line of the benchmark report
+static void bench_print(const char *text) {
+    print_info("%s\n", text);
+    host_flush();
+}
 
-    return SUCCESS_RETURN;
+// Benchmark firmware entry, reports every stage and then idles
+void bench_main() {
+    bench_init(bench_print);
+    print_info("Bench %u components, %lu Hz core clock\n", (unsigned) flash_status.component_cnt,
+               (unsigned long) SystemCoreClock);
+    bench_crypto();
+    BENCH_RUN("scan", flash_status.component_cnt * sizeof(msg_t), bench_scan());
+    BENCH_RUN("validate_boot", 0, bench_validate_boot());
+    BENCH_RUN("link", flash_status.component_cnt * 2 * sizeof(msg_t), bench_link());
+    print_success("Bench\n");
+    while (1) {}
 }
+#endif
 
-/********************************* AP LOGIC ***********************************/
+#ifdef SELFTEST_ENABLE
+// One line of the self test report
+static void selftest_print(int ok, const char *text) {
+    if (ok) {
+        print_info("%s\n", text);
+    } else {
+        print_error("%s\n", text);
+    }
+}
 
-// Boot sequence
-// YOUR DESIGN MUST NOT CHANGE THIS FUNCTION
-// Boot message is customized through the AP_BOOT_MSG macro
-void boot() {
-    // POST BOOT FUNCTIONALITY
-    // DO NOT REMOVE IN YOUR DESIGN
-    #ifdef POST_BOOT
-        POST_BOOT
-    #else
-    // Everything after this point is modifiable in your design
-    // LED loop to show that boot occurred
-    while (1) {
-        LED_On(LED1);
-        MXC_Delay(500000);
-        LED_On(LED2);
-        MXC_Delay(500000);
-        LED_On(LED3);
-        MXC_Delay(500000);
-        LED_Off(LED1);
-        MXC_Delay(500000);
-        LED_Off(LED2);
-        MXC_Delay(500000);
-        LED_Off(LED3);
-        MXC_Delay(500000);
+// Self test firmware entry, reports every test and then idles
+void selftest_main() {
+    int failed = selftest_run(selftest_print);
+    if (failed == 0) {
+        print_success("Selftest\n");
+    } else {
+        print_error("Selftest %d failed\n", failed);
     }
-    #endif
+    while (1) {}
 }
+#endif
 
-// Compare the entered PIN to the correct PIN
-int validate_pin() {
-    char buf[50];
-    recv_input("Enter pin: ", buf, 50);
-    char pin[7];
-    strncpy(pin, AP_PIN, 6);
-    pin[6] = '\0';
+#ifdef CTCHECK_ENABLE
+// Result of the PIN check under test, so it is not optimized away
+static volatile int ctcheck_pin_sink;
 
-    // Right before the memcmp, pause for random time
-    // between 0.5 - 1.5 seconds. Tries to avoid timing attacks
-    time_delay(500000, 1500000);
-    if ((strlen(buf) == 6) && !secure_memcmp((uint8_t*) buf, (uint8_t*) pin, 6)) {
-        print_debug("Pin Accepted!\n");
-        return SUCCESS_RETURN;
+// One line of the constant-time report
+static void ctcheck_print(int ok, const char *text) {
+    if (ok) {
+        print_info("%s\n", text);
+    } else {
+        print_error("%s\n", text);
     }
-    print_error("Invalid PIN!\n");
-    return ERROR_RETURN;
 }
 
-// Function to validate the replacement token
-int validate_token() {
-    char buf[50];
-    recv_input("Enter token: ", buf, 50);
-    char token[17];
-    strncpy(token, AP_TOKEN, 16);
-    token[16] = '\0';
-
-    // Right before the memcmp, pause for random time
-    // between 0.5 - 1.5 seconds. Tries to avoid timing attacks
-    time_delay(500000, 1500000);
-    if ((strlen(buf) == 16) && !secure_memcmp((uint8_t*) buf, (uint8_t*) token, 16)) {
-        print_debug("Token Accepted!\n");
-        return SUCCESS_RETURN;
+// The PIN check as validate_pin makes it. Inputs are mapped onto '0'..'?',
+// the same work for both classes, so they are never cut short by a NUL
+static void ctcheck_pin(const uint8_t *in) {
+    char buf[7];
+    for (int i = 0; i < 6; i++) {
+        buf[i] = '0' | (in[i] & 0x0f);
     }
-    print_error("Invalid Token!\n");
-    return ERROR_RETURN;
+    buf[6] = '\0';
+    ctcheck_pin_sink = pin_matches(buf);
 }
 
-// Boot the components and board if the components validate
-void attempt_boot() {
-    uint32_t comp_challenges[flash_status.component_cnt];
-    int validate_result = validate_components(comp_challenges);
-    int boot_result = boot_components(comp_challenges, validate_result);
+// Constant-time check firmware entry, reports every routine and then idles
+void ctcheck_main() {
+    int leaks = ctcheck_run(ctcheck_print);
+    leaks += ctcheck_test("pin_compare", ctcheck_pin, (const uint8_t*) AP_PIN, 6, ctcheck_print);
+    if (leaks == 0) {
+        print_success("Ctcheck\n");
+    } else {
+        print_error("Ctcheck %d leaking\n", leaks);
+    }
+    while (1) {}
+}
+#endif
 
-    if (boot_result != SUCCESS_RETURN) {
-        print_error("Boot Failed\n");
-        return;
+// Report what the interrupts posted, they do not print themselves
+static void report_irq_events(void) {
+    uint32_t count = irq_event_take(IRQ_EVENT_FLASH_AF);
+    if (count > 0) {
+        print_debug("Flash access failure (%lu)\n", (unsigned long) count);
+    }
+    count = irq_event_take(IRQ_EVENT_RNG_HEALTH);
+    if (count > 0) {
+        print_debug("TRNG health test failure (%lu)\n", (unsigned long) count);
     }
+    count = irq_event_take(IRQ_EVENT_RNG_RESEED);
+    if (count > 0) {
+        print_debug("DRBG reseed failure (%lu)\n", (unsigned long) count);
+    }
+    count = irq_event_take(IRQ_EVENT_HOST_RX_FULL);
+    if (count > 0) {
+        print_debug("Host input dropped (%lu)\n", (unsigned long) count);
+    }
+}
 
-    // Print boot message
-    // This always needs to be printed when booting
-    print_info("AP>%s\n", AP_BOOT_MSG);
-    print_success("Boot\n");
-    // Boot
-    reset_msg();
-    boot();
+// The list command, its result is already reported
+static void attempt_list(void) {
+    scan_components();
 }
 
-// Replace a component if the PIN is correct
-void attempt_replace() {
-    char buf[50];
+#ifdef PRESENCE_MONITOR
+// Provisioned components that went missing or came back since the last list
+// or delta, as the presence monitor saw them. Lets a host watch the system
+// without a full scan each time
+static void attempt_delta(void) {
+    presence_delta(true);
+    print_success("Delta\n");
+}
+#endif
 
-    if (validate_token()) {
-        // We are potentially being attacked -- pause 
-        // for 4 seconds, set LED to red during the pause
-        LED_Off(LED3);
-        MXC_Delay(4000000);
-        LED_On(LED3);
-        return;
-    }
+#ifdef TRACE_ENABLE
+// Debug builds only: dump the hot-path trace buffer
+static void attempt_trace(void) {
+    trace_dump();
+    print_success("Trace\n");
+}
+#endif
 
-    uint32_t component_id_in = 0;
-    uint32_t component_id_out = 0;
+#ifdef STACK_PROFILE
+// Profiling builds only: stack high-water mark and static RAM
+static void attempt_stack(void) {
+    stack_report();
+    print_success("Stack\n");
+}
+#endif
 
-    recv_input("Component ID In: ", buf, 50);
-    sscanf(buf, "%x", &component_id_in);
-    recv_input("Component ID Out: ", buf, 50);
-    sscanf(buf, "%x", &component_id_out);
+#ifdef I2C_CAPTURE
+// Debug builds only: dump and clear the I2C capture ring
+static void attempt_capture(void) {
+    i2c_capture_dump();
+    print_success("Capture\n");
+}
+#endif
 
-    // Make sure the in component is not already provisioned
-    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
-        if (flash_status.component_ids[i] == component_id_in) {
-            print_error("Component 0x%08x is already provisioned!\n", component_id_in);
-            return;
-        }
+#ifdef SLOW_CAPTURE
+// Debug builds only: print the trace and capture rings frozen by the first
+// operation that ran over its budget, then record again
+static void attempt_slow(void) {
+    if (slow_op == NULL) {
+        print_debug("No slow operation\n");
+    } else {
+        print_debug("Slow %s: %lu us, budget %lu ms\n", slow_op, (unsigned long) slow_us,
+                    (unsigned long) slow_budget_ms);
+        trace_dump();
+        i2c_capture_dump();
     }
+    slow_op = NULL;
+    trace_freeze(0);
+    i2c_capture_freeze(0);
+    print_success("Slow\n");
+}
+#endif
 
-    // Find the component to swap out
-    for (unsigned i = 0; i < flash_status.component_cnt; i++) {
-        if (flash_status.component_ids[i] == component_id_out) {
-            flash_status.component_ids[i] = component_id_in;
+#ifdef BUS_PROFILE
+// Debug builds only: print and clear the bus utilization profile
+static void attempt_bus(void) {
+    bus_profile_dump();
+    print_success("Bus\n");
+}
+#endif
+
+// A host command. run takes no argument, run_arg exactly one, the word
+// after the name
+typedef struct {
+    const char *name;
+    void (*run)(void);
+    void (*run_arg)(const char *arg);
+} command_t;
+
+static const command_t commands[] = {
+    {"list", attempt_list, NULL},
+    {"boot", attempt_boot, NULL},
+    {"replace", attempt_replace, NULL},
+    {"replace-batch", attempt_replace_batch, NULL},
+    {"attest", attempt_attest, NULL},
+    {"attest-all", attempt_attest_all, NULL},
+#ifdef FIRMWARE_MEASURE
+    {"measure", attempt_measure, NULL},
+#endif
+#ifdef PRESENCE_MONITOR
+    {"delta", attempt_delta, NULL},
+#endif
+#ifdef TRACE_ENABLE
+    {"trace", attempt_trace, NULL},
+#endif
+#ifdef STACK_PROFILE
+    {"stack", attempt_stack, NULL},
+#endif
+#ifdef LINK_STATS
+    {"stats", attempt_stats, NULL},
+#endif
+#ifdef KEY_ROTATION
+    {"rotate", attempt_rotate, NULL},
+#endif
+#ifdef I2C_CAPTURE
+    {"capture", attempt_capture, NULL},
+#endif
+#ifdef BUS_PROFILE
+    {"bus", attempt_bus, NULL},
+#endif
+#ifdef SLOW_CAPTURE
+    {"slow", attempt_slow, NULL},
+#endif
+#ifdef HOST_UART_STREAM
+    {"baud", NULL, attempt_baud},
+#endif
+#ifdef HOST_BINARY_CMD
+    {"binary", attempt_binary, NULL},
+#endif
+};
 
-            // Update flash hash, and encrypt before writing back to flash
-            // Construct hash
-            hash((uint8_t*)&flash_status, flash_status.hash, FLASH_ENC_LEN - 24);
+#define COMMAND_CNT (sizeof(commands) / sizeof(commands[0]))
 
-            // Create an encrypted copy of the flash data to write to flash
-            flash_entry encrypted_flash;
-            memcpy((uint8_t*)&encrypted_flash, (uint8_t*)&flash_status, sizeof(flash_entry));
-            aes_encrypt((uint8_t*)&flash_status, (uint8_t*)&encrypted_flash, flash_status.iv, FLASH_ENC_LEN);
+#ifdef LAT_HIST
+// Time each host command took, by its index in commands
+static lat_hist_t command_hists[COMMAND_CNT];
 
-            // write updated component_ids to flash
-            flash_simple_erase_page(FLASH_ADDR);
-            flash_simple_write(FLASH_ADDR, (uint32_t*)&encrypted_flash, sizeof(flash_entry));
+static void command_hists_print(void) {
+    for (size_t i = 0; i < COMMAND_CNT; i++) {
+        hist_print(0, commands[i].name, &command_hists[i]);
+    }
+}
+#endif
 
-            print_debug("Replaced 0x%08x with 0x%08x\n", component_id_out,
-                    component_id_in);
-            print_success("Replace\n");
-            return;
+// Parse a command line in place and run it
+static void run_command(char *line) {
+    char *words[2];
+    int count = host_split(line, words, 2);
+    if (count == 0) {
+        print_error("Unrecognized command ''\n");
+        return;
+    }
+    for (size_t i = 0; i < COMMAND_CNT; i++) {
+        const command_t *cmd = &commands[i];
+        if (strcmp(words[0], cmd->name)) {
+            continue;
+        }
+        LAT_START(start);
+        bus_profile_begin(cmd->name);
+        if (count != (cmd->run_arg != NULL ? 2 : 1)) {
+            print_error("Wrong arguments for '%s'\n", cmd->name);
+        } else if (cmd->run_arg != NULL) {
+            cmd->run_arg(words[1]);
+        } else {
+            cmd->run();
+        }
+        bus_profile_end();
+        LAT_ADD(&command_hists[i], start);
+#ifdef HOST_UART_STREAM
+        // A negotiated rate holds until the next command is done, every host
+        // tool connects at the default rate
+        if (cmd->run_arg != attempt_baud) {
+            host_uart_restore();
         }
+#endif
+        return;
     }
-
-    // Component Out was not found
-    print_error("Component 0x%08x is not provisioned for the system\r\n",
-            component_id_out);
+    print_error("Unrecognized command '%s'\n", words[0]);
+#ifdef HOST_UART_STREAM
+    host_uart_restore();
+#endif
 }
 
-// Attest a component if the PIN is correct
-void attempt_attest() {
-    char buf[50];
+// Handle commands forever
+static void command_loop(void) {
+    char buf[100];
+    while (1) {
+#ifdef FLASH_ERASE_AHEAD
+        // The last response is out and the host is reading it
+        flash_prepare();
+#endif
+        // Clear out any data that might still be in memory
+        reset_msg();
+        report_irq_events();
 
-    if (validate_pin()) {
-        // We are potentially being attacked -- pause 
-        // for 4 seconds, set LED to red during the pause
-        LED_Off(LED3);
-        MXC_Delay(4000000);
-        LED_On(LED3);
-        return;
+        // (safely) read the next message from serial
+        recv_input("Enter Command: ", buf, 100);
+#ifdef LAZY_STARTUP
+        // Only the first command pays for it
+        startup_finish();
+#endif
+
+        // Execute requested command
+        run_command(buf);
     }
-    uint32_t component_id;
-    recv_input("Component ID: ", buf, 50);
-    sscanf(buf, "%x", &component_id);
-    attest_component(component_id);
 }
 
 /*********************************** MAIN *************************************/
@@ -601,34 +4744,37 @@ int main() {
 
     print_info("Application Processor Started\n");
 
+#ifdef BENCH_ENABLE
+    // Benchmark images only run the benchmarks
+#ifdef LAZY_STARTUP
+    startup_finish();
+#endif
+    bench_main();
+#endif
+
+#ifdef SELFTEST_ENABLE
+    // Self test images only check the crypto
+    selftest_main();
+#endif
+
+#ifdef CTCHECK_ENABLE
+    // Constant-time check images only time the checks
+    ctcheck_main();
+#endif
+
     // Should be purple in normal operation
     // Turning off LED3 makes it red
     LED_On(LED1);
     LED_On(LED3);
 
-    // Handle commands forever
-    char buf[100];
-    while (1) {
-        // Clear out any data that might still be in memory
-        reset_msg();
-
-        // (safely) read the next message from serial
-        recv_input("Enter Command: ", buf, 100);
-
-        // Execute requested command
-        if (!strcmp(buf, "list")) {
-            scan_components();
-        } else if (!strcmp(buf, "boot")) {
-            attempt_boot();
-        } else if (!strcmp(buf, "replace")) {
-            attempt_replace();
-        } else if (!strcmp(buf, "attest")) {
-            attempt_attest();
-        } else {
-            print_error("Unrecognized command '%s'\n", buf);
-        }
-    }
+#ifdef AP_RTOS
+    // The command loop becomes the host task, next to the link task
+    ap_rtos_start(command_loop);
+#else
+    command_loop();
+#endif
 
     // Code never reaches here
     return 0;
 }
+
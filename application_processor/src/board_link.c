@@ -16,8 +16,225 @@
 #include "board_link.h"
 #include "mxc_delay.h"
 #include "host_messaging.h"
+#include "trace.h"
+#include "link_stats.h"
+#include "hotcold.h"
+
+/******************************** GLOBAL DEFINITIONS ********************************/
+// Consecutive failed exchanges per address, see LINK_DEAD_STRIKES
+static uint8_t link_strikes[128];
+// Packets each component can still take without a RECEIVE_DONE check, see
+// poll_receive_free. Never more than it has free banks
+static uint8_t rx_credits[128];
+
+#ifdef LINK_STATS
+// Frames sent to and received from each address, see board_link_frames
+static uint32_t link_frames_sent[128];
+static uint32_t link_frames_recv[128];
+#endif
+
+// Background work of poll delays, see board_link_set_idle
+static board_link_idle_t idle_work;
+
+// Backend of each address, NULL for link_i2c
+static const link_backend_t* link_backends[128];
 
 /******************************** FUNCTION DEFINITIONS ********************************/
+/**
+ * @brief Record the outcome of an exchange with a component
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param result: int, result of the exchange, negative if it failed
+ * 
+ * @return int: result, passed through
+*/
+static int link_record(i2c_addr_t address, int result) {
+    uint8_t* strikes = &link_strikes[address & 0x7F];
+    if (result >= SUCCESS_RETURN) {
+        *strikes = 0;
+    } else {
+        // Whatever the component holds now, check before sending again
+        rx_credits[address & 0x7F] = 0;
+        if (*strikes < UINT8_MAX) {
+            (*strikes)++;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Count a frame that made it to or from a component
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param sent: bool, true if it was sent, false if received
+*/
+static void link_count(i2c_addr_t address, bool sent) {
+#ifdef LINK_STATS
+    if (sent) {
+        link_frames_sent[address & 0x7F]++;
+        STATS_INC(frames_sent);
+    } else {
+        link_frames_recv[address & 0x7F]++;
+        STATS_INC(frames_recv);
+    }
+#else
+    (void)address;
+    (void)sent;
+#endif
+}
+
+/**
+ * @brief Use up a credit for a packet on its way to a component
+ * 
+ * @param address: i2c_addr_t, i2c address
+*/
+static void rx_credit_take(i2c_addr_t address) {
+    if (rx_credits[address & 0x7F] > 0) {
+        rx_credits[address & 0x7F]--;
+    }
+}
+
+/**
+ * @brief Count the RECEIVE banks a component has free
+ * 
+ * @param done: int, RECEIVE_DONE value
+ * 
+ * @return int: free banks, from the ring size the component advertises
+*/
+static int rx_credits_free(int done) {
+    int banks = I2C_DONE_RX_BANKS(done);
+    int free = banks;
+    for (int bank = 0; bank < banks; bank++) {
+        if (done & I2C_DONE_BANK(bank)) {
+            free--;
+        }
+    }
+    return free;
+}
+
+#ifdef LINK_STATS
+/**
+ * @brief Frames exchanged with a component since reset
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param sent: uint32_t*, frames sent to it
+ * @param recv: uint32_t*, frames received from it
+*/
+void board_link_frames(i2c_addr_t address, uint32_t* sent, uint32_t* recv) {
+    *sent = link_frames_sent[address & 0x7F];
+    *recv = link_frames_recv[address & 0x7F];
+}
+#endif
+
+/**
+ * @brief Check whether a component has run out of time to answer
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param waited: uint32_t, microseconds spent waiting on it so far
+ * 
+ * @return bool: true once waited reaches the component's poll deadline,
+ * which also counts as a strike against it
+ * 
+ * The deadline is POLL_TIMEOUT_US, or LINK_DEAD_TIMEOUT_US once the
+ * component has failed LINK_DEAD_STRIKES times in a row
+*/
+bool link_expired(i2c_addr_t address, uint32_t waited) {
+    // 0 waits forever, whatever the component's record
+    if (!POLL_TIMEOUT_US) {
+        return false;
+    }
+    uint32_t deadline = POLL_TIMEOUT_US;
+    if (link_strikes[address & 0x7F] >= LINK_DEAD_STRIKES && LINK_DEAD_TIMEOUT_US < deadline) {
+        deadline = LINK_DEAD_TIMEOUT_US;
+    }
+    if (waited < deadline) {
+        return false;
+    }
+    link_record(address, ERROR_RETURN);
+    return true;
+}
+
+/**
+ * @brief Check the shared ready line
+ * 
+ * @return bool: true if some component may have a packet waiting
+*/
+static bool ready_line_asserted(void) {
+#ifdef BOARD_LINK_READY_GPIO
+    return MXC_GPIO_InGet(READY_GPIO_PORT, READY_GPIO_PIN) == 0;
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief Delay between polls, doing a piece of background work first
+ * 
+ * @param delay_us: uint32_t, time to wait
+*/
+HOT static void poll_delay(uint32_t delay_us) {
+    if (idle_work != NULL) {
+        idle_work();
+    }
+    MXC_Delay(delay_us);
+}
+
+/**
+ * @brief Wait before the next poll
+ * 
+ * @param delay_us: uint32_t, longest time to wait
+ * 
+ * @return uint32_t: time actually waited in microseconds
+ * 
+ * Without a ready line this is a plain delay. With one, the wait ends as
+ * soon as a component asserts the line, and no bus traffic is generated.
+*/
+HOT static uint32_t ready_wait(uint32_t delay_us) {
+#ifdef BOARD_LINK_READY_GPIO
+    uint32_t waited = 0;
+    while (waited < delay_us && !ready_line_asserted()) {
+        poll_delay(POLL_READY_SLICE_US);
+        waited += POLL_READY_SLICE_US;
+    }
+    return waited;
+#else
+    poll_delay(delay_us);
+    return delay_us;
+#endif
+}
+
+/**
+ * @brief Check whether a component takes compound register transactions
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return bool: true if it advertised I2C_CAP_COMPOUND during negotiation
+*/
+static bool compound_regs(i2c_addr_t address) {
+    return (i2c_simple_capabilities(address) & I2C_CAP_COMPOUND) != 0;
+}
+
+/**
+ * @brief Read TRANSMIT_DONE, and TRANSMIT_LEN if it comes along
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param len: int*, set to TRANSMIT_LEN, or -1 if it still has to be read
+ * 
+ * @return int: TRANSMIT_DONE value, negative if error
+*/
+static int read_transmit_done(i2c_addr_t address, int* len) {
+    *len = -1;
+    if (!compound_regs(address)) {
+        return i2c_simple_read_transmit_done(address);
+    }
+    uint8_t status_len;
+    int result = i2c_simple_read_transmit_status(address, &status_len);
+    if (result >= SUCCESS_RETURN) {
+        *len = status_len;
+    }
+    return result;
+}
+
 /**
  * @brief Initialize the board link connection
  * 
@@ -25,7 +242,141 @@
 */
 void board_link_init(void) {
     i2c_simple_controller_init();
+#ifdef LINK_SPI
+    spi_simple_controller_init();
+#endif
+
+#ifdef BOARD_LINK_READY_GPIO
+    // Components only ever pull the ready line low, so hold it idle high
+    mxc_gpio_cfg_t ready_cfg;
+    ready_cfg.port = READY_GPIO_PORT;
+    ready_cfg.mask = READY_GPIO_PIN;
+    ready_cfg.func = MXC_GPIO_FUNC_IN;
+    ready_cfg.pad = MXC_GPIO_PAD_PULL_UP;
+    ready_cfg.vssel = MXC_GPIO_VSSEL_VDDIO;
+    ready_cfg.drvstr = MXC_GPIO_DRVSTR_0;
+    MXC_GPIO_Config(&ready_cfg);
+#endif
+}
+
+/**
+ * @brief Set the background work polls run while waiting on a component
+ * 
+ * @param idle: board_link_idle_t, one piece of it is run per poll delay,
+ *     NULL for none
+*/
+void board_link_set_idle(board_link_idle_t idle) {
+    idle_work = idle;
+}
+
+/**
+ * @brief Assign a component to one of the I2C buses
+ * 
+ * @param component_id: uint32_t, ID of the component
+ * @param bus: uint8_t, I2C controller index the component is wired to
+ * 
+ * Components without a bus are found by probing every bus in use
+*/
+void board_link_set_bus(uint32_t component_id, uint8_t bus) {
+    i2c_simple_set_bus(component_id_to_i2c_addr(component_id), bus);
+}
+
+#ifdef I2C_MUX
+/**
+ * @brief Assign a component to one of the mux channels
+ * 
+ * @param component_id: uint32_t, ID of the component
+ * @param channel: uint8_t, mux channel the component is wired to
+ * 
+ * Components without a channel are found by probing every channel
+*/
+void board_link_set_channel(uint32_t component_id, uint8_t channel) {
+    i2c_simple_set_channel(component_id_to_i2c_addr(component_id), channel);
+}
+
+/**
+ * @brief Get the bus segment a component was found on
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * 
+ * @return uint8_t: segment, 0xFF while not known
+*/
+uint8_t board_link_segment(i2c_addr_t address) {
+    return i2c_simple_segment(address);
+}
+#endif
+
+/**
+ * @brief Negotiate the bus speed with the provisioned components
+ * 
+ * @param addrs: i2c_addr_t*, I2C addresses of the provisioned components
+ * @param count: int, number of addresses
+ * 
+ * @return int: bus frequency selected in Hz
+ * 
+ * Raises the I2C bus to the fastest rate every provisioned component
+ * advertises, falling back to slower rates if a rate shows errors
+*/
+int board_link_negotiate_speed(const i2c_addr_t* addrs, int count) {
+    return i2c_simple_negotiate_frequency(addrs, count);
+}
+
+#ifdef LINK_META
+/**
+ * @brief Take a component's capabilities from an earlier negotiation
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * @param caps: uint8_t, I2C_CAP_* bits it advertised then
+*/
+void board_link_preset_caps(i2c_addr_t address, uint8_t caps) {
+    i2c_simple_preset_capabilities(address, caps);
+}
+
+/**
+ * @brief Get the capabilities a component advertised
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * 
+ * @return uint8_t: I2C_CAP_* bits, 0 if it did not answer
+*/
+uint8_t board_link_caps(i2c_addr_t address) {
+    return i2c_simple_capabilities(address);
+}
+#endif
+
+#ifdef I2C_CALIBRATE
+/**
+ * @brief Take the bus timings of an earlier calibration
+ * 
+ * @param timings: uint32_t*, I2C_BUS_COUNT timings, 0 for buses to calibrate
+*/
+void board_link_preset_timings(const uint32_t* timings) {
+    i2c_simple_preset_timings(timings);
+}
+
+/**
+ * @brief Get the bus timings of the last negotiation
+ * 
+ * @param timings: uint32_t*, filled with I2C_BUS_COUNT timings
+*/
+void board_link_timings(uint32_t* timings) {
+    i2c_simple_timings(timings);
+}
+#endif
+
+#ifdef COMP_READY
+/**
+ * @brief Check whether a component finished starting up
+ * 
+ * @param address: i2c_addr_t, I2C address of the component
+ * 
+ * @return bool: true if it answers and is not I2C_CAP_STARTING
+*/
+bool board_link_component_ready(i2c_addr_t address) {
+    int caps = i2c_simple_read_status_generic(address, CAPABILITY);
+    return caps >= 0 && (caps & I2C_CAP_MAGIC_MASK) != I2C_CAP_STARTING;
 }
+#endif
 
 /**
  * @brief Convert 4-byte component ID to I2C address
@@ -38,6 +389,20 @@ i2c_addr_t component_id_to_i2c_addr(uint32_t component_id) {
     return (uint8_t) component_id & COMPONENT_ADDR_MASK;
 }
 
+/**
+ * @brief Check whether anything answers at an I2C address
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return status: SUCCESS_RETURN if the address was acknowledged, ERROR_RETURN otherwise
+*/
+int probe_address(i2c_addr_t address) {
+    if (i2c_simple_probe(address) < SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
+    return SUCCESS_RETURN;
+}
+
 /**
  * @brief Send an arbitrary packet over I2C
  * 
@@ -50,69 +415,1113 @@ i2c_addr_t component_id_to_i2c_addr(uint32_t component_id) {
  * Function sends an arbitrary packet over i2c to a specified component
 */
 int send_packet(i2c_addr_t address, uint8_t len, uint8_t* packet) {
-   // print_debug("send_packet: address: %d, len: %d, packet: %p\n", address, len, packet);
-    int result;
-    //print_debug("send_packet 1\n");
-    result = i2c_simple_write_receive_len(address, len);
-    if (result < SUCCESS_RETURN) {
-        //print_debug("send packet 1a\n");
-        return ERROR_RETURN;
+    uint8_t frame[I2C_FRAME_HEADROOM + MAX_I2C_MESSAGE_LEN];
+    memcpy(&frame[I2C_FRAME_HEADROOM], packet, len);
+    return send_frame(address, len, frame);
+}
+
+/**
+ * @brief Write a packet and hand it over
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+*/
+static int write_packet(i2c_addr_t address, uint8_t len, uint8_t* frame) {
+    if (compound_regs(address)) {
+        // Length, packet and done flag in a single write
+        int result = i2c_simple_write_frame(address, RECEIVE_FRAME, len, frame);
+        return (result < SUCCESS_RETURN) ? ERROR_RETURN : SUCCESS_RETURN;
     }
-    //print_debug("send_packet 2\n");
-    result = i2c_simple_write_data_generic(address, RECEIVE, len, packet);
-    if (result < SUCCESS_RETURN) {
-       // print_debug("send packet 2a\n");
+
+    if (i2c_simple_write_receive_len(address, len) < SUCCESS_RETURN ||
+        i2c_simple_write_frame(address, RECEIVE, len, frame) < SUCCESS_RETURN ||
+        i2c_simple_write_receive_done(address, true) < SUCCESS_RETURN) {
         return ERROR_RETURN;
     }
-    //print_debug("send_packet 3\n");
-    result = i2c_simple_write_receive_done(address, true);
-    if (result < SUCCESS_RETURN) {
-        //print_debug("send packet 3a\n");
-        return ERROR_RETURN;
+    return SUCCESS_RETURN;
+}
+
+#ifdef LINK_CRC
+/**
+ * @brief Write a packet behind its CRC until the component takes it
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error or still
+ * corrupted after LINK_CRC_RETRIES more tries
+ * 
+ * The component checks the CRC as the packet is handed over, so reading
+ * RECEIVE_DONE right after tells whether it has to go again
+*/
+static int write_checked_packet(i2c_addr_t address, uint8_t len, uint8_t* frame) {
+    uint32_t value = i2c_simple_crc(&frame[I2C_FRAME_HEADROOM], len);
+    uint8_t crc[LINK_CRC_LEN];
+    memcpy(crc, &value, LINK_CRC_LEN);
+
+    for (int attempt = 0; attempt <= LINK_CRC_RETRIES; attempt++) {
+        if (i2c_simple_write_data_generic(address, RECEIVE_CRC, LINK_CRC_LEN, crc) < SUCCESS_RETURN ||
+            write_packet(address, len, frame) != SUCCESS_RETURN) {
+            return ERROR_RETURN;
+        }
+        int done = i2c_simple_read_receive_done(address);
+        if (done < SUCCESS_RETURN) {
+            return ERROR_RETURN;
+        }
+        if (!(done & I2C_DONE_CRC_ERROR)) {
+            return SUCCESS_RETURN;
+        }
+        STATS_INC(retransmits);
     }
+    return ERROR_RETURN;
+}
 
-    return SUCCESS_RETURN;
+/**
+ * @brief Check a packet read from TRANSMIT against TRANSMIT_CRC
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, packet read
+ * @param len: int, length of the packet
+ * 
+ * @return bool: true if the CRC could be read and matches
+*/
+static bool packet_crc_ok(i2c_addr_t address, uint8_t* packet, int len) {
+    uint8_t crc[LINK_CRC_LEN];
+    if (i2c_simple_read_data_generic(address, TRANSMIT_CRC, LINK_CRC_LEN, crc) < SUCCESS_RETURN) {
+        return false;
+    }
+    uint32_t value = i2c_simple_crc(packet, (uint8_t)len);
+    return memcmp(crc, &value, LINK_CRC_LEN) == 0;
 }
+#endif
 
 /**
- * @brief Poll a component and receive a packet
+ * @brief Send a packet over I2C straight from a frame buffer, send of link_i2c
  * 
  * @param address: i2c_addr_t, i2c address
- * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
  * 
- * @return int: size of data received, ERROR_RETURN if error
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
 */
-int poll_and_receive_packet(i2c_addr_t address, uint8_t* packet) {
-    //print_debug("poll_and_receive_packet: addr = %d, packet = %p\n", address, packet);
-    int result = SUCCESS_RETURN;
+HOT static int i2c_send_frame(i2c_addr_t address, uint8_t len, uint8_t* frame) {
+#ifdef LINK_CRC
+    int result = write_checked_packet(address, len, frame);
+#else
+    int result = write_packet(address, len, frame);
+#endif
+    if (result == SUCCESS_RETURN) {
+        link_count(address, true);
+        rx_credit_take(address);
+    }
+    return link_record(address, result);
+}
+
+/**
+ * @brief Wait until a component has taken the last packet sent to it, wait_free of link_i2c
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return status: SUCCESS_RETURN once RECEIVE is free, ERROR_RETURN if error or
+ * still busy when link_expired
+ * 
+ * Components clear a RECEIVE bank as soon as they have copied its packet
+ * out, and with a ring of banks the next packets can go out before that,
+ * while the component is still working on the previous ones. Every free bank
+ * RECEIVE_DONE shows is a credit, and only once they are used up does the
+ * bus get polled again, so a stream goes out back to back
+*/
+static int i2c_poll_receive_free(i2c_addr_t address) {
+    if (rx_credits[address & 0x7F] > 0) {
+        return SUCCESS_RETURN;
+    }
+
+    uint32_t delay = POLL_READY_SLICE_US;
+    uint32_t waited = 0;
     while (true) {
-        result = i2c_simple_read_transmit_done(address);
+        int result = i2c_simple_read_receive_done(address);
         if (result < SUCCESS_RETURN) {
-            return ERROR_RETURN;
+            return link_record(address, ERROR_RETURN);
         }
-        else if (result == SUCCESS_RETURN) {
-            break;
+        int credits = rx_credits_free(result);
+        if (credits > 0) {
+            rx_credits[address & 0x7F] = credits;
+            return SUCCESS_RETURN;
+        }
+
+        if (link_expired(address, waited)) {
+            return ERROR_RETURN;
         }
-        MXC_Delay(50);
+        poll_delay(delay);
+        waited += delay;
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+}
+
+/**
+ * @brief Read the packet in the TRANSMIT bank
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * @param len: int, TRANSMIT_LEN if already known, negative to read it first
+ * 
+ * @return int: size of data received, ERROR_RETURN if error
+*/
+HOT static int read_packet(i2c_addr_t address, uint8_t* packet, int len) {
+    if (len < 0) {
+        len = i2c_simple_read_transmit_len(address);
     }
-    //print_debug("poll_and_receive_packet 1\n");
-    int len = i2c_simple_read_transmit_len(address);
     if (len < SUCCESS_RETURN) {
         return ERROR_RETURN;
     }
 
-    //print_debug("poll_and_receive_packet 2\n");
-    result = i2c_simple_read_data_generic(address, TRANSMIT, (uint8_t)len, packet);
+    int result = i2c_simple_read_data_generic(address, TRANSMIT, (uint8_t)len, packet);
     if (result < SUCCESS_RETURN) {
         return ERROR_RETURN;
     }
+    return len;
+}
+
+/**
+ * @brief Read a packet a component has marked ready
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * @param len: int, TRANSMIT_LEN if already known, negative to read it first
+ * 
+ * @return int: size of data received, ERROR_RETURN if error
+*/
+static int receive_ready_packet(i2c_addr_t address, uint8_t* packet, int len) {
+    len = read_packet(address, packet, len);
+#ifdef LINK_CRC
+    // The component holds the packet until TRANSMIT_DONE, so a corrupted
+    // one is simply read again, length included
+    for (int retry = 0; len >= SUCCESS_RETURN && !packet_crc_ok(address, packet, len); retry++) {
+        STATS_INC(retransmits);
+        len = (retry < LINK_CRC_RETRIES) ? read_packet(address, packet, -1) : ERROR_RETURN;
+    }
+#endif
+    if (len < SUCCESS_RETURN) {
+        return ERROR_RETURN;
+    }
 
-    //print_debug("poll_and_receive_packet 3\n");
-    result = i2c_simple_write_transmit_done(address, true);
+    int result = i2c_simple_write_transmit_done(address, true);
     if (result < SUCCESS_RETURN) {
         return ERROR_RETURN;
     }
 
-    //print_debug("poll_and_receive_packet returning %d\n", len);
     return len;
 }
+
+/**
+ * @brief Read a packet a component has marked ready, and record the outcome
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * @param len: int, TRANSMIT_LEN if already known, negative to read it first
+ * 
+ * @return int: size of data received, ERROR_RETURN if error
+*/
+static int receive_recorded_packet(i2c_addr_t address, uint8_t* packet, int len) {
+    len = receive_ready_packet(address, packet, len);
+    if (len >= SUCCESS_RETURN) {
+        link_count(address, false);
+    }
+    return link_record(address, len);
+}
+
+#ifdef LINK_STRETCH
+/**
+ * @brief Receive a packet through stretched TRANSMIT_WAIT reads
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * 
+ * @return int: size of data received, ERROR_RETURN if error
+ * 
+ * The component holds each read until its packet is ready, so the packet
+ * is read as soon as it is published and nothing polls in between. A read
+ * the component lets go empty counts LINK_STRETCH_MAX_US towards the deadline
+*/
+HOT static int i2c_stretch_receive(i2c_addr_t address, uint8_t* packet) {
+    uint32_t waited = 0;
+    uint32_t loops = 0;
+    uint8_t len;
+    while (true) {
+        loops++;
+        int result = i2c_simple_read_transmit_wait(address, &len);
+        if (result < SUCCESS_RETURN) {
+            return link_record(address, ERROR_RETURN);
+        }
+        else if (!I2C_DONE_SELECTED(result)) {
+            break;
+        }
+
+        waited += LINK_STRETCH_MAX_US;
+        if (link_expired(address, waited)) {
+            return ERROR_RETURN;
+        }
+    }
+    STATS_POLL(loops);
+
+    return receive_recorded_packet(address, packet, len);
+}
+#endif
+
+/**
+ * @brief Poll a component and receive a packet, recv of link_i2c
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * 
+ * @return int: size of data received, ERROR_RETURN if error
+ * 
+ * With LINK_STRETCH a component advertising I2C_CAP_STRETCH is not polled
+ * but read with i2c_stretch_receive
+*/
+HOT static int i2c_poll_and_receive(i2c_addr_t address, uint8_t* packet) {
+#ifdef LINK_STRETCH
+    if (i2c_simple_capabilities(address) & I2C_CAP_STRETCH) {
+        return i2c_stretch_receive(address, packet);
+    }
+#endif
+    int result = SUCCESS_RETURN;
+    uint32_t delay = POLL_INITIAL_DELAY_US;
+    uint32_t waited = 0;
+    uint32_t loops = 0;
+    int len = -1;
+    while (true) {
+        // Give the component time to finish before touching the bus
+        waited += ready_wait(delay);
+        loops++;
+
+        if (ready_line_asserted()) {
+            result = read_transmit_done(address, &len);
+            if (result < SUCCESS_RETURN) {
+                return link_record(address, ERROR_RETURN);
+            }
+            else if (!I2C_DONE_SELECTED(result)) {
+                break;
+            }
+        }
+
+        // Don't let a hung component freeze the AP
+        if (link_expired(address, waited)) {
+            return ERROR_RETURN;
+        }
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+    STATS_POLL(loops);
+
+    return receive_recorded_packet(address, packet, len);
+}
+
+/**
+ * @brief Receive a packet from a component if one is ready, try_recv of link_i2c
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * 
+ * @return int: size of data received, 0 if nothing is ready yet, ERROR_RETURN if error
+*/
+HOT static int i2c_try_receive(i2c_addr_t address, uint8_t* packet) {
+    // Nothing can be ready while the ready line is idle
+    if (!ready_line_asserted()) {
+        return 0;
+    }
+
+    int len;
+    int result = read_transmit_done(address, &len);
+    if (result < SUCCESS_RETURN) {
+        return link_record(address, ERROR_RETURN);
+    }
+    else if (I2C_DONE_SELECTED(result)) {
+        return 0;
+    }
+
+    return receive_recorded_packet(address, packet, len);
+}
+
+const link_backend_t link_i2c = {
+    .send = i2c_send_frame,
+    .recv = i2c_poll_and_receive,
+    .try_recv = i2c_try_receive,
+    .wait_free = i2c_poll_receive_free,
+};
+
+#ifdef LINK_SPI
+/**
+ * @brief Give up on SPI for a component after a failed exchange
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return status: ERROR_RETURN
+ * 
+ * The component answers on the link it last heard from, so the next frame
+ * over I2C brings it back in step
+*/
+static int spi_failed(i2c_addr_t address) {
+    link_backends[address & 0x7F] = &link_i2c;
+    return link_record(address, ERROR_RETURN);
+}
+
+/**
+ * @brief Send a packet over SPI, send of link_spi
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error or the
+ * component still held the last packet when link_expired
+*/
+static int spi_send_frame(i2c_addr_t address, uint8_t len, uint8_t* frame) {
+    uint32_t delay = POLL_READY_SLICE_US;
+    uint32_t waited = 0;
+    while (true) {
+        int result = spi_simple_write(address, len, &frame[I2C_FRAME_HEADROOM]);
+        if (result == E_NO_ERROR) {
+            link_count(address, true);
+            return link_record(address, SUCCESS_RETURN);
+        }
+        if (result != E_BUSY) {
+            return spi_failed(address);
+        }
+
+        if (link_expired(address, waited)) {
+            return ERROR_RETURN;
+        }
+        poll_delay(delay);
+        waited += delay;
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+}
+
+/**
+ * @brief Wait until a component has taken the last packet, wait_free of link_spi
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return status: SUCCESS_RETURN once it is free, ERROR_RETURN if error or
+ * still busy when link_expired
+*/
+static int spi_poll_receive_free(i2c_addr_t address) {
+    uint32_t delay = POLL_READY_SLICE_US;
+    uint32_t waited = 0;
+    while (true) {
+        int status = spi_simple_poll(address);
+        if (status < SUCCESS_RETURN) {
+            return spi_failed(address);
+        }
+        if (!(status & SPI_STATUS_RX_FULL)) {
+            return SUCCESS_RETURN;
+        }
+
+        if (link_expired(address, waited)) {
+            return ERROR_RETURN;
+        }
+        poll_delay(delay);
+        waited += delay;
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+}
+
+/**
+ * @brief Receive a packet from a component if one is ready, try_recv of link_spi
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * 
+ * @return int: size of data received, 0 if nothing is ready yet, ERROR_RETURN if error
+*/
+static int spi_try_receive(i2c_addr_t address, uint8_t* packet) {
+    if (!ready_line_asserted()) {
+        return 0;
+    }
+
+    int len = spi_simple_read(address, packet);
+    if (len < SUCCESS_RETURN) {
+        return spi_failed(address);
+    }
+    if (len > 0) {
+        link_count(address, false);
+        link_record(address, len);
+    }
+    return len;
+}
+
+/**
+ * @brief Poll a component and receive a packet, recv of link_spi
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * 
+ * @return int: size of data received, ERROR_RETURN if error
+ * 
+ * Same backoff and deadline as over I2C, every poll is a read that takes
+ * the packet in the same exchange if there is one
+*/
+static int spi_poll_and_receive(i2c_addr_t address, uint8_t* packet) {
+    uint32_t delay = POLL_INITIAL_DELAY_US;
+    uint32_t waited = 0;
+    uint32_t loops = 0;
+    while (true) {
+        waited += ready_wait(delay);
+        loops++;
+
+        int len = spi_try_receive(address, packet);
+        if (len != 0) {
+            STATS_POLL(loops);
+            return len;
+        }
+
+        if (link_expired(address, waited)) {
+            return ERROR_RETURN;
+        }
+        delay = (delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : delay * 2;
+    }
+}
+
+const link_backend_t link_spi = {
+    .send = spi_send_frame,
+    .recv = spi_poll_and_receive,
+    .try_recv = spi_try_receive,
+    .wait_free = spi_poll_receive_free,
+};
+
+/**
+ * @brief Give a component its SPI chip select
+ * 
+ * @param component_id: uint32_t, ID of the component
+ * @param pin: uint8_t, chip select pin, see SPI_CS_PORT
+ * 
+ * The component stays on I2C until board_link_spi_start
+*/
+void board_link_set_spi(uint32_t component_id, uint8_t pin) {
+    spi_simple_set_cs(component_id_to_i2c_addr(component_id), pin);
+}
+
+/**
+ * @brief Move every component with a chip select to link_spi
+*/
+void board_link_spi_start(void) {
+    for (i2c_addr_t address = 0; address < 128; address++) {
+        if (spi_simple_has_cs(address)) {
+            board_link_set_backend(address, &link_spi);
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Choose the backend frames to a component go over
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param backend: const link_backend_t*, backend, NULL for link_i2c
+*/
+void board_link_set_backend(i2c_addr_t address, const link_backend_t* backend) {
+    link_backends[address & 0x7F] = backend;
+}
+
+/**
+ * @brief Backend of a component
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return const link_backend_t*: backend frames to it go over
+*/
+static const link_backend_t* link_backend(i2c_addr_t address) {
+    const link_backend_t* backend = link_backends[address & 0x7F];
+    return (backend != NULL) ? backend : &link_i2c;
+}
+
+/**
+ * @brief Send a packet straight from a frame buffer
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+ *
+ * Same as send_packet, without copying the packet on the way to the bus
+*/
+HOT int send_frame(i2c_addr_t address, uint8_t len, uint8_t* frame) {
+    TRACE_ENTER(TRACE_SEND_PACKET);
+    int result = link_backend(address)->send(address, len, frame);
+    TRACE_EXIT(TRACE_SEND_PACKET);
+    return result;
+}
+
+/**
+ * @brief Wait until a component has taken the last packet sent to it
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return status: SUCCESS_RETURN once it can take another, ERROR_RETURN if error or
+ * still busy when link_expired
+*/
+int poll_receive_free(i2c_addr_t address) {
+    return link_backend(address)->wait_free(address);
+}
+
+/**
+ * @brief Poll a component and receive a packet
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * 
+ * @return int: size of data received, ERROR_RETURN if error
+*/
+HOT int poll_and_receive_packet(i2c_addr_t address, uint8_t* packet) {
+    TRACE_ENTER(TRACE_RECV_PACKET);
+    int len = link_backend(address)->recv(address, packet);
+    TRACE_EXIT(TRACE_RECV_PACKET);
+    return len;
+}
+
+/**
+ * @brief Receive a packet from a component if one is ready
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, pointer to a buffer where a packet will be received 
+ * 
+ * @return int: size of data received, 0 if nothing is ready yet, ERROR_RETURN if error
+ * 
+ * Non-blocking version of poll_and_receive_packet, lets the caller service
+ * several components round-robin
+*/
+HOT int try_receive_packet(i2c_addr_t address, uint8_t* packet) {
+    return link_backend(address)->try_recv(address, packet);
+}
+
+/**
+ * @brief Wait for a component to signal a packet
+ * 
+ * @param delay_us: uint32_t, longest time to wait
+ * 
+ * @return uint32_t: time actually waited in microseconds
+*/
+uint32_t board_link_wait_ready(uint32_t delay_us) {
+    return ready_wait(delay_us);
+}
+
+#ifdef COMPONENT_ENROLL
+/**
+ * @brief Read a component's enrollment certificate
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param cert: uint8_t*, buffer of I2C_ENROLL_CERT_LEN bytes
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+ * 
+ * Not covered by LINK_CRC, the signature of the certificate shows
+ * whether it arrived intact
+*/
+int read_enroll_cert(i2c_addr_t address, uint8_t* cert) {
+    int result = i2c_simple_read_data_generic(address, ENROLL_CERT, I2C_ENROLL_CERT_LEN, cert);
+    return link_record(address, result < SUCCESS_RETURN ? ERROR_RETURN : SUCCESS_RETURN);
+}
+#endif
+
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Write the boot release to every component at once
+ * 
+ * @param addrs: const i2c_addr_t*, components it must reach
+ * @param count: int, number of components
+ * @param len: uint8_t, length of the release
+ * @param release: uint8_t*, release, at most I2C_RELEASE_LEN bytes
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+ * 
+ * Not covered by LINK_CRC, a damaged entry only fails its tag check
+*/
+int broadcast_release(const i2c_addr_t* addrs, int count, uint8_t len, uint8_t* release) {
+    int result = i2c_simple_broadcast(addrs, count, BOOT_RELEASE, len, release);
+    return result < SUCCESS_RETURN ? ERROR_RETURN : SUCCESS_RETURN;
+}
+#endif
+
+#ifdef ADDR_ASSIGN
+/**
+ * @brief Write an address assignment to every component at once
+ * 
+ * @param addrs: const i2c_addr_t*, addresses being assigned
+ * @param count: int, number of components
+ * @param len: uint8_t, length of the assignment
+ * @param assign: uint8_t*, assignment, at most I2C_ASSIGN_LEN bytes
+ * 
+ * @return status: SUCCESS_RETURN if success, ERROR_RETURN if error
+*/
+int broadcast_assign(const i2c_addr_t* addrs, int count, uint8_t len, uint8_t* assign) {
+    int result = i2c_simple_broadcast(addrs, count, ASSIGN_ADDR, len, assign);
+    return result < SUCCESS_RETURN ? ERROR_RETURN : SUCCESS_RETURN;
+}
+#endif
+
+#ifdef LINK_ASYNC
+// With AP_RTOS the host task queues operations while the link task runs them
+#ifdef AP_RTOS
+#include "ap_rtos.h"
+#define LINK_LOCK() ap_rtos_link_lock()
+#define LINK_UNLOCK() ap_rtos_link_unlock()
+#else
+#define LINK_LOCK()
+#define LINK_UNLOCK()
+#endif
+
+// Steps of an asynchronous operation, each but LINK_RECV_WAIT is one transaction
+typedef enum {
+    LINK_SEND_CRC,      // Write RECEIVE_CRC
+    LINK_SEND_LEN,      // Write RECEIVE_LEN
+    LINK_SEND_DATA,     // Write RECEIVE, or RECEIVE_FRAME
+    LINK_SEND_DONE,     // Write RECEIVE_DONE
+    LINK_SEND_CHECK,    // Read RECEIVE_DONE for a CRC error
+    LINK_RECV_WAIT,     // Wait for the next poll, no transaction
+    LINK_RECV_STATUS,   // Read TRANSMIT_DONE, or TRANSMIT_STATUS
+    LINK_RECV_LEN,      // Read TRANSMIT_LEN
+    LINK_RECV_DATA,     // Read TRANSMIT
+    LINK_RECV_CRC,      // Read TRANSMIT_CRC
+    LINK_RECV_ACK,      // Write TRANSMIT_DONE
+} link_step_t;
+
+// Transaction state of an operation, set to LINK_XFER_DONE from the interrupt
+#define LINK_XFER_IDLE 0
+#define LINK_XFER_BUSY 1
+#define LINK_XFER_DONE 2
+
+// Queued operations, oldest first
+static link_op_t* link_queue;
+
+// Frames and operations of send_frame_async
+static link_op_t link_slots[LINK_ASYNC_SLOTS];
+static uint8_t link_slot_frames[LINK_ASYNC_SLOTS][I2C_FRAME_HEADROOM + MAX_I2C_MESSAGE_LEN];
+// Outcome of the last send_frame_async per address
+static int8_t link_sent[128];
+
+/**
+ * @brief Transaction completion, runs in the I2C interrupt
+ * 
+ * @param ctx: void*, operation
+ * @param result: int, result of the transaction
+*/
+static void link_xfer_done(void* ctx, int result) {
+    link_op_t* op = (link_op_t*)ctx;
+    op->xfer_result = result;
+    op->xfer = LINK_XFER_DONE;
+#ifdef AP_RTOS
+    ap_rtos_link_kick_from_isr();
+#endif
+}
+
+/**
+ * @brief Give the queue time to move on while waiting for it
+*/
+static void link_pause(void) {
+#ifdef AP_RTOS
+    // The link task runs it, unless this is the link task
+    if (ap_rtos_link_wait()) {
+        return;
+    }
+#endif
+    MXC_Delay(LINK_ASYNC_SLICE_US);
+    link_run(LINK_ASYNC_SLICE_US);
+}
+
+/**
+ * @brief Add an operation to the end of the queue
+ * 
+ * @param op: link_op_t*, operation with address, buf, len and step set
+ * @param callback: link_callback_t, called once it finishes
+ * @param ctx: void*, stored in op->ctx
+*/
+static void link_enqueue(link_op_t* op, link_callback_t callback, void* ctx) {
+    op->callback = callback;
+    op->ctx = ctx;
+    op->result = LINK_OP_PENDING;
+    op->tries = 0;
+    op->xfer = LINK_XFER_IDLE;
+    op->next = NULL;
+
+    LINK_LOCK();
+    link_op_t** tail = &link_queue;
+    while (*tail != NULL) {
+        tail = &(*tail)->next;
+    }
+    *tail = op;
+    LINK_UNLOCK();
+}
+
+/**
+ * @brief Queue a send
+ * 
+ * @param op: link_op_t*, operation, must stay valid until it has finished
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * @param callback: link_callback_t, called once the send finishes, may be NULL
+ * @param ctx: void*, stored in op->ctx
+*/
+void link_submit_send(link_op_t* op, i2c_addr_t address, uint8_t len, uint8_t* frame,
+                      link_callback_t callback, void* ctx) {
+    op->address = address;
+    op->len = len;
+    op->buf = frame;
+#ifdef LINK_CRC
+    uint32_t value = i2c_simple_crc(&frame[I2C_FRAME_HEADROOM], len);
+    memcpy(&op->crc[I2C_FRAME_HEADROOM], &value, LINK_CRC_LEN);
+    op->step = LINK_SEND_CRC;
+#else
+    op->step = compound_regs(address) ? LINK_SEND_DATA : LINK_SEND_LEN;
+#endif
+    // Taken up front, a later poll_receive_free must not count this bank free
+    rx_credit_take(address);
+    link_enqueue(op, callback, ctx);
+}
+
+/**
+ * @brief Queue a poll and receive
+ * 
+ * @param op: link_op_t*, operation, must stay valid until it has finished
+ * @param address: i2c_addr_t, i2c address
+ * @param packet: uint8_t*, buffer for the packet
+ * @param callback: link_callback_t, called once the receive finishes, may be NULL
+ * @param ctx: void*, stored in op->ctx
+ * 
+ * Polls with the same backoff and deadline as poll_and_receive_packet,
+ * the time passing being what link_run is told
+*/
+void link_submit_recv(link_op_t* op, i2c_addr_t address, uint8_t* packet,
+                      link_callback_t callback, void* ctx) {
+    op->address = address;
+    op->len = 0;
+    op->buf = packet;
+    op->step = LINK_RECV_WAIT;
+    op->waited = 0;
+    op->due = POLL_INITIAL_DELAY_US;
+    op->delay = POLL_INITIAL_DELAY_US;
+    link_enqueue(op, callback, ctx);
+}
+
+/**
+ * @brief Start the transaction of an operation's current step
+ * 
+ * @param op: link_op_t*, operation
+ * 
+ * @return int: 0 if started, E_BUSY while its bus is taken, negative if error
+*/
+static int link_op_start(link_op_t* op) {
+    i2c_addr_t address = op->address;
+    uint8_t* value = &op->small[I2C_FRAME_HEADROOM];
+    switch (op->step) {
+#ifdef LINK_CRC
+    case LINK_SEND_CRC:
+        return i2c_simple_write_async(address, RECEIVE_CRC, LINK_CRC_LEN, op->crc, link_xfer_done, op);
+    case LINK_SEND_CHECK:
+        return i2c_simple_read_async(address, RECEIVE_DONE, 1, op->small, link_xfer_done, op);
+    case LINK_RECV_CRC:
+        return i2c_simple_read_async(address, TRANSMIT_CRC, LINK_CRC_LEN, op->crc, link_xfer_done, op);
+#endif
+    case LINK_SEND_LEN:
+        value[0] = op->len;
+        return i2c_simple_write_async(address, RECEIVE_LEN, 1, op->small, link_xfer_done, op);
+    case LINK_SEND_DATA:
+        return i2c_simple_write_async(address, compound_regs(address) ? RECEIVE_FRAME : RECEIVE,
+                                      op->len, op->buf, link_xfer_done, op);
+    case LINK_SEND_DONE:
+        value[0] = true;
+        return i2c_simple_write_async(address, RECEIVE_DONE, 1, op->small, link_xfer_done, op);
+    case LINK_RECV_STATUS:
+        if (compound_regs(address)) {
+            return i2c_simple_read_async(address, TRANSMIT_STATUS, 2, op->small, link_xfer_done, op);
+        }
+        return i2c_simple_read_async(address, TRANSMIT_DONE, 1, op->small, link_xfer_done, op);
+    case LINK_RECV_LEN:
+        return i2c_simple_read_async(address, TRANSMIT_LEN, 1, op->small, link_xfer_done, op);
+    case LINK_RECV_DATA:
+        return i2c_simple_read_async(address, TRANSMIT, op->len, op->buf, link_xfer_done, op);
+    case LINK_RECV_ACK:
+        value[0] = true;
+        return i2c_simple_write_async(address, TRANSMIT_DONE, 1, op->small, link_xfer_done, op);
+    default:
+        return E_BAD_STATE;
+    }
+}
+
+/**
+ * @brief Finish an operation
+ * 
+ * @param op: link_op_t*, operation
+ * @param result: int, outcome
+ * @param record: bool, whether it still has to go into the link health
+*/
+static void link_op_finish(link_op_t* op, int result, bool record) {
+    if (result >= SUCCESS_RETURN) {
+        link_count(op->address, op->step != LINK_RECV_ACK);
+    }
+    op->result = record ? link_record(op->address, result) : result;
+}
+
+/**
+ * @brief Move an operation on after a completed transaction
+ * 
+ * @param op: link_op_t*, operation
+ * @param result: int, result of the transaction
+*/
+static void link_op_advance(link_op_t* op, int result) {
+    if (result < SUCCESS_RETURN) {
+        i2c_simple_recover(op->address);
+        link_op_finish(op, ERROR_RETURN, true);
+        return;
+    }
+
+    bool compound = compound_regs(op->address);
+    switch (op->step) {
+    case LINK_SEND_CRC:
+        op->step = compound ? LINK_SEND_DATA : LINK_SEND_LEN;
+        break;
+    case LINK_SEND_LEN:
+        op->step = LINK_SEND_DATA;
+        break;
+    case LINK_SEND_DATA:
+    case LINK_SEND_DONE:
+        if (op->step == LINK_SEND_DATA && !compound) {
+            op->step = LINK_SEND_DONE;
+            break;
+        }
+#ifdef LINK_CRC
+        op->step = LINK_SEND_CHECK;
+#else
+        link_op_finish(op, SUCCESS_RETURN, true);
+#endif
+        break;
+#ifdef LINK_CRC
+    case LINK_SEND_CHECK:
+        if (!(op->small[0] & I2C_DONE_CRC_ERROR)) {
+            link_op_finish(op, SUCCESS_RETURN, true);
+        } else if (op->tries++ < LINK_CRC_RETRIES) {
+            STATS_INC(retransmits);
+            op->step = LINK_SEND_CRC;
+        } else {
+            link_op_finish(op, ERROR_RETURN, true);
+        }
+        break;
+#endif
+    case LINK_RECV_STATUS:
+        if (I2C_DONE_SELECTED(op->small[0])) {
+            // Nothing yet, back off like poll_and_receive_packet
+            if (link_expired(op->address, op->waited)) {
+                link_op_finish(op, ERROR_RETURN, false);
+                break;
+            }
+            op->delay = (op->delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : op->delay * 2;
+            op->due = op->waited + op->delay;
+            op->step = LINK_RECV_WAIT;
+        } else if (compound) {
+            op->len = op->small[1];
+            op->step = LINK_RECV_DATA;
+        } else {
+            op->step = LINK_RECV_LEN;
+        }
+        break;
+    case LINK_RECV_LEN:
+        op->len = op->small[0];
+        op->step = LINK_RECV_DATA;
+        break;
+    case LINK_RECV_DATA:
+#ifdef LINK_CRC
+        op->step = LINK_RECV_CRC;
+#else
+        op->step = LINK_RECV_ACK;
+#endif
+        break;
+#ifdef LINK_CRC
+    case LINK_RECV_CRC: {
+        // A corrupted packet is still held, read it again length included
+        uint32_t value = i2c_simple_crc(op->buf, op->len);
+        if (memcmp(op->crc, &value, LINK_CRC_LEN) == 0) {
+            op->step = LINK_RECV_ACK;
+        } else if (op->tries++ < LINK_CRC_RETRIES) {
+            STATS_INC(retransmits);
+            op->step = LINK_RECV_LEN;
+        } else {
+            link_op_finish(op, ERROR_RETURN, true);
+        }
+        break;
+    }
+#endif
+    case LINK_RECV_ACK:
+        link_op_finish(op, op->len, true);
+        break;
+    default:
+        link_op_finish(op, ERROR_RETURN, true);
+        break;
+    }
+}
+
+/**
+ * @brief Let a waiting receive poll once its delay is up
+ * 
+ * @param op: link_op_t*, operation in LINK_RECV_WAIT
+ * @param elapsed_us: uint32_t, time since the last link_run
+*/
+static void link_op_wait(link_op_t* op, uint32_t elapsed_us) {
+    op->waited += elapsed_us;
+    if (op->waited < op->due) {
+        return;
+    }
+    if (ready_line_asserted()) {
+        op->step = LINK_RECV_STATUS;
+        return;
+    }
+    if (link_expired(op->address, op->waited)) {
+        link_op_finish(op, ERROR_RETURN, false);
+        return;
+    }
+    op->delay = (op->delay * 2 > POLL_MAX_DELAY_US) ? POLL_MAX_DELAY_US : op->delay * 2;
+    op->due = op->waited + op->delay;
+}
+
+/**
+ * @brief Check whether an earlier queued operation goes to the same address
+ * 
+ * @param op: link_op_t*, queued operation
+ * 
+ * @return bool: true if op has to wait its turn
+*/
+static bool link_op_blocked(link_op_t* op) {
+    for (link_op_t* prev = link_queue; prev != op; prev = prev->next) {
+        if (prev->address == op->address) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Move every queued operation on
+ * 
+ * @param elapsed_us: uint32_t, time since the last call, counts towards polls
+*/
+void link_run(uint32_t elapsed_us) {
+    LINK_LOCK();
+    link_op_t** link = &link_queue;
+    while (*link != NULL) {
+        link_op_t* op = *link;
+
+        if (op->xfer == LINK_XFER_DONE) {
+            op->xfer = LINK_XFER_IDLE;
+            link_op_advance(op, op->xfer_result);
+        } else if (op->xfer == LINK_XFER_IDLE && op->step == LINK_RECV_WAIT && !link_op_blocked(op)) {
+            link_op_wait(op, elapsed_us);
+        }
+
+        if (op->result == LINK_OP_PENDING && op->xfer == LINK_XFER_IDLE &&
+            op->step != LINK_RECV_WAIT && !link_op_blocked(op)) {
+            op->xfer = LINK_XFER_BUSY;
+            int result = link_op_start(op);
+            if (result != E_NO_ERROR) {
+                op->xfer = LINK_XFER_IDLE;
+                if (result != E_BUSY) {
+                    link_op_finish(op, ERROR_RETURN, true);
+                }
+            }
+        }
+
+        if (op->result != LINK_OP_PENDING) {
+            *link = op->next;
+            if (op->callback != NULL) {
+                op->callback(op);
+            }
+            continue;
+        }
+        link = &op->next;
+    }
+    LINK_UNLOCK();
+}
+
+/**
+ * @brief Run link_run until an operation has finished
+ * 
+ * @param op: link_op_t*, queued operation
+ * 
+ * @return int: result of the operation
+*/
+int link_wait(link_op_t* op) {
+    link_run(0);
+    while (op->result == LINK_OP_PENDING) {
+        link_pause();
+    }
+    return op->result;
+}
+
+/**
+ * @brief Check whether any operation is queued
+ * 
+ * @return bool: true if link_run has nothing left to do
+*/
+bool link_idle(void) {
+    return link_queue == NULL;
+}
+
+/**
+ * @brief Note the outcome of a pooled send
+ * 
+ * @param op: link_op_t*, finished operation from link_slots
+*/
+static void link_slot_done(link_op_t* op) {
+    link_sent[op->address & 0x7F] = (int8_t)op->result;
+}
+
+/**
+ * @brief Queue a copy of a frame for sending, as a send_frame replacement
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * @param len: uint8_t, length of the packet
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the packet
+ * 
+ * @return status: SUCCESS_RETURN once queued, see link_send_status for the outcome
+*/
+int send_frame_async(i2c_addr_t address, uint8_t len, uint8_t* frame) {
+    // The queue runs I2C transactions, other backends send right away
+    if (link_backend(address) != &link_i2c) {
+        link_sent[address & 0x7F] = (int8_t)send_frame(address, len, frame);
+        return SUCCESS_RETURN;
+    }
+
+    // Slots start out zeroed, which is a finished send
+    while (true) {
+        LINK_LOCK();
+        for (int i = 0; i < LINK_ASYNC_SLOTS; i++) {
+            if (link_slots[i].result == LINK_OP_PENDING) {
+                continue;
+            }
+            uint8_t* copy = link_slot_frames[i];
+            memcpy(&copy[I2C_FRAME_HEADROOM], &frame[I2C_FRAME_HEADROOM], len);
+            link_sent[address & 0x7F] = LINK_OP_PENDING;
+            link_submit_send(&link_slots[i], address, len, copy, link_slot_done, NULL);
+            link_run(0);
+            LINK_UNLOCK();
+            return SUCCESS_RETURN;
+        }
+        LINK_UNLOCK();
+        link_pause();
+    }
+}
+
+/**
+ * @brief Outcome of the last send_frame_async to a component
+ * 
+ * @param address: i2c_addr_t, i2c address
+ * 
+ * @return int: LINK_OP_PENDING while it is queued, then SUCCESS_RETURN or ERROR_RETURN
+*/
+int link_send_status(i2c_addr_t address) {
+    return link_sent[address & 0x7F];
+}
+#endif
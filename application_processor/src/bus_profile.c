@@ -0,0 +1,308 @@
+#include "bus_profile.h"
+
+#ifdef BUS_PROFILE
+
+#include <string.h>
+#include "mxc_device.h"
+#include "host_messaging.h"
+#include "simple_i2c_controller.h"
+
+typedef enum {
+    BUS_PAYLOAD,
+    BUS_POLL,
+    BUS_STATUS,
+    BUS_HANDSHAKE,
+    BUS_CLASS_CNT
+} bus_class_t;
+
+static const char *const class_names[BUS_CLASS_CNT] = {
+    "payload", "poll", "status", "handshake",
+};
+
+// Transactions of one address or command. Cycles are 64 bit, a long run of
+// boots adds up to more than the cycle counter holds
+typedef struct {
+    uint64_t cycles[BUS_CLASS_CNT];
+    uint32_t count[BUS_CLASS_CNT];
+    uint32_t bytes[BUS_CLASS_CNT];
+    uint64_t gap_cycles;
+    uint32_t gaps;
+    uint32_t gap_max;
+} bus_usage_t;
+
+// Per address, the last entry takes every address the others do not
+static struct {
+    uint8_t addr;
+    uint8_t used;
+    bus_usage_t use;
+} peers[BUS_PROFILE_PEERS + 1];
+
+// Per command, the last entry takes startup and commands the others do not
+static struct {
+    const char *name;
+    uint32_t runs;
+    uint64_t span;
+    bus_usage_t use;
+} cmds[BUS_PROFILE_CMDS + 1];
+
+// Command running, BUS_PROFILE_CMDS outside any, and when it started
+static unsigned cmd_cur = BUS_PROFILE_CMDS;
+static uint32_t cmd_start;
+// When the last transaction on each bus ended, gaps are only counted while
+// bus_idle_valid has the bus's bit
+static uint32_t bus_last_end[I2C_BUS_COUNT];
+static uint8_t bus_idle_valid;
+
+/**
+ * @brief Tells what a transaction was for from the register it addressed.
+ *
+ * @param req Completed request.
+ * @return Its class.
+ */
+static bus_class_t bus_classify(const mxc_i2c_req_t *req)
+{
+    if (req->tx_len == 0 || req->addr == I2C_GENERAL_CALL_ADDR) {
+        return BUS_HANDSHAKE;
+    }
+#ifdef I2C_MUX
+    if (req->addr == I2C_MUX_ADDR) {
+        return BUS_HANDSHAKE;
+    }
+#endif
+    bool read = req->tx_len == 1 && req->rx_len > 0;
+    switch (req->tx_buf[0]) {
+    case RECEIVE:
+    case TRANSMIT:
+    case RECEIVE_FRAME:
+        return BUS_PAYLOAD;
+    case TRANSMIT_DONE:
+    case TRANSMIT_STATUS:
+    case RECEIVE_DONE:
+#ifdef LINK_STRETCH
+    case TRANSMIT_WAIT:
+#endif
+        return read ? BUS_POLL : BUS_STATUS;
+    case RECEIVE_LEN:
+    case TRANSMIT_LEN:
+#ifdef LINK_CRC
+    case RECEIVE_CRC:
+    case TRANSMIT_CRC:
+#endif
+        return BUS_STATUS;
+    default:
+        return BUS_HANDSHAKE;
+    }
+}
+
+/**
+ * @brief Adds one transaction to a usage entry.
+ *
+ * @param use Entry to add it to.
+ * @param cls Class of the transaction.
+ * @param cycles Cycles it took.
+ * @param bytes Bytes it moved.
+ * @param gap Idle cycles on its bus before it, 0 if not known.
+ */
+static void bus_usage_add(bus_usage_t *use, bus_class_t cls, uint32_t cycles, uint32_t bytes,
+                          uint32_t gap)
+{
+    use->cycles[cls] += cycles;
+    use->count[cls]++;
+    use->bytes[cls] += bytes;
+    if (gap) {
+        use->gap_cycles += gap;
+        use->gaps++;
+        if (gap > use->gap_max) {
+            use->gap_max = gap;
+        }
+    }
+}
+
+/**
+ * @brief Adds a completed transaction to its address and command.
+ *
+ * Runs from the I2C interrupt for asynchronous transactions, so the profile
+ * is only touched with interrupts masked.
+ *
+ * @param start Cycle count when the transaction started.
+ * @param req Completed request.
+ * @param result Result of the transaction, failed ones count all the same.
+ */
+void bus_profile_record(uint32_t start, const mxc_i2c_req_t *req, int result)
+{
+    (void)result;
+    uint32_t end = trace_cycles();
+    bus_class_t cls = bus_classify(req);
+    uint8_t bus = MXC_I2C_GET_IDX(req->i2c);
+    uint32_t bytes = req->tx_len + req->rx_len;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t gap = 0;
+    if (bus_idle_valid & (1 << bus)) {
+        // An asynchronous transaction may have started before the last
+        // blocking one on the bus ended, that is no gap
+        int32_t idle = (int32_t)(start - bus_last_end[bus]);
+        gap = idle > 0 ? (uint32_t)idle : 0;
+    }
+    bus_last_end[bus] = end;
+    bus_idle_valid |= 1 << bus;
+
+    unsigned p = 0;
+    while (p < BUS_PROFILE_PEERS && peers[p].used && peers[p].addr != req->addr) {
+        p++;
+    }
+    if (p < BUS_PROFILE_PEERS) {
+        peers[p].addr = req->addr;
+        peers[p].used = 1;
+    }
+    bus_usage_add(&peers[p].use, cls, end - start, bytes, gap);
+    bus_usage_add(&cmds[cmd_cur].use, cls, end - start, bytes, gap);
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Starts a command, transactions from now on belong to it.
+ *
+ * Idle time before the first transaction on a bus counts from here.
+ *
+ * @param command Name of the command, compared by address.
+ */
+void bus_profile_begin(const char *command)
+{
+    unsigned c = 0;
+    while (c < BUS_PROFILE_CMDS && cmds[c].name != NULL && cmds[c].name != command) {
+        c++;
+    }
+    if (c < BUS_PROFILE_CMDS) {
+        cmds[c].name = command;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    cmd_cur = c;
+    cmd_start = trace_cycles();
+    for (int bus = 0; bus < I2C_BUS_COUNT; bus++) {
+        bus_last_end[bus] = cmd_start;
+    }
+    bus_idle_valid = (1 << I2C_BUS_COUNT) - 1;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Ends the command bus_profile_begin started.
+ *
+ * Time until the next command is nobody's, so the next gap is not counted.
+ */
+void bus_profile_end(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    cmds[cmd_cur].runs++;
+    cmds[cmd_cur].span += trace_cycles() - cmd_start;
+    cmd_cur = BUS_PROFILE_CMDS;
+    bus_idle_valid = 0;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Prints what an entry is for, at the start of a debug message.
+ *
+ * @param name Command of the entry, NULL for an address.
+ * @param key Runs of the command, or the address, -1 for the catch-all one.
+ */
+static void bus_label(const char *name, long key)
+{
+    if (name != NULL) {
+        host_print("B cmd %s x%ld", name, key);
+    } else if (key >= 0) {
+        host_print("B 0x%02lx", key);
+    } else {
+        host_print("B 0x??");
+    }
+}
+
+/**
+ * @brief Prints one entry as two debug messages.
+ *
+ * The first holds the busy time, its share of span if there is one, the
+ * poll share of the busy time and the idle gaps with their average and
+ * longest. The second holds count, bytes and time of every class.
+ *
+ * @param name Command of the entry, NULL for an address.
+ * @param key Runs of the command, or the address, -1 for the catch-all one.
+ * @param use The entry.
+ * @param span Cycles the command ran for, 0 for an address.
+ */
+static void bus_usage_print(const char *name, long key, const bus_usage_t *use, uint64_t span)
+{
+    uint32_t per_us = SystemCoreClock / 1000000;
+    uint64_t busy = 0;
+    for (int c = 0; c < BUS_CLASS_CNT; c++) {
+        busy += use->cycles[c];
+    }
+    if (busy == 0 && span == 0) {
+        return;
+    }
+
+    host_open(HOST_DEBUG, "debug");
+    bus_label(name, key);
+    host_print(" busy %lu us", (unsigned long) (busy / per_us));
+    if (span) {
+        host_print(" of %lu us (%lu%%)", (unsigned long) (span / per_us),
+                   (unsigned long) (busy * 100 / span));
+    }
+    if (busy) {
+        host_print(", poll %lu%%", (unsigned long) (use->cycles[BUS_POLL] * 100 / busy));
+    }
+    host_print(", gaps %lu avg %lu max %lu us", (unsigned long) use->gaps,
+               (unsigned long) (use->gaps ? use->gap_cycles / use->gaps / per_us : 0),
+               (unsigned long) (use->gap_max / per_us));
+    host_close(HOST_DEBUG, "debug");
+
+    host_open(HOST_DEBUG, "debug");
+    bus_label(name, key);
+    for (int c = 0; c < BUS_CLASS_CNT; c++) {
+        host_print(" %s %lu/%luB/%luus", class_names[c], (unsigned long) use->count[c],
+                   (unsigned long) use->bytes[c], (unsigned long) (use->cycles[c] / per_us));
+    }
+    host_close(HOST_DEBUG, "debug");
+}
+
+/**
+ * @brief Prints every command, then every address, then clears the profile.
+ *
+ * Startup and commands past BUS_PROFILE_CMDS show as command "other",
+ * addresses past BUS_PROFILE_PEERS as 0x??.
+ */
+void bus_profile_dump(void)
+{
+    for (int c = 0; c <= BUS_PROFILE_CMDS; c++) {
+        const char *name = (c < BUS_PROFILE_CMDS) ? cmds[c].name : "other";
+        if (name != NULL) {
+            bus_usage_print(name, (long) cmds[c].runs, &cmds[c].use, cmds[c].span);
+        }
+    }
+    for (int p = 0; p <= BUS_PROFILE_PEERS; p++) {
+        if (p == BUS_PROFILE_PEERS) {
+            bus_usage_print(NULL, -1, &peers[p].use, 0);
+        } else if (peers[p].used) {
+            bus_usage_print(NULL, peers[p].addr, &peers[p].use, 0);
+        }
+    }
+    host_flush();
+
+    // The command printing this is still running, it starts over empty
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    const char *running = (cmd_cur < BUS_PROFILE_CMDS) ? cmds[cmd_cur].name : NULL;
+    memset(peers, 0, sizeof(peers));
+    memset(cmds, 0, sizeof(cmds));
+    if (running != NULL) {
+        cmds[0].name = running;
+        cmd_cur = 0;
+    }
+    __set_PRIMASK(primask);
+}
+
+#endif
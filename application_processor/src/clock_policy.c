@@ -0,0 +1,73 @@
+/**
+ * @file "clock_policy.c"
+ * @brief Optional system clock scaling of the AP
+ * @date 2024
+ */
+
+#include "clock_policy.h"
+
+#ifdef CLOCK_SCALING
+
+#include <stdbool.h>
+#include "board.h"
+#include "mxc_device.h"
+#include "mxc_sys.h"
+#include "uart.h"
+
+/******************************** GLOBAL DEFINITIONS ********************************/
+// Clock the console UART runs from, see HOST_UART_CLOCK in host_messaging.c.
+// Only the peripheral clock follows SYSCLK
+#ifndef HOST_UART_CLOCK
+#define HOST_UART_CLOCK MXC_UART_IBRO_CLK
+#endif
+
+#define CLOCK_CONSOLE MXC_UART_GET_UART(CONSOLE_UART)
+
+// Divider register value of CLOCK_IDLE_DIV
+#define CLOCK_DIV_FIELD(div) \
+    ((div) == 1 ? MXC_SYS_CLOCK_DIV_1 : (div) == 2 ? MXC_SYS_CLOCK_DIV_2 : \
+     (div) == 4 ? MXC_SYS_CLOCK_DIV_4 : (div) == 8 ? MXC_SYS_CLOCK_DIV_8 : \
+     (div) == 16 ? MXC_SYS_CLOCK_DIV_16 : (div) == 32 ? MXC_SYS_CLOCK_DIV_32 : \
+     (div) == 64 ? MXC_SYS_CLOCK_DIV_64 : MXC_SYS_CLOCK_DIV_128)
+
+static bool clock_down;
+
+/******************************** FUNCTION DEFINITIONS ********************************/
+/**
+ * @brief Switch the SYSCLK divider, keeping the console baud rate
+ * 
+ * @param div: mxc_sys_system_clock_div_t, new divider
+*/
+static void clock_set_div(mxc_sys_system_clock_div_t div) {
+    // Nothing may be on the wire while the rate changes under it
+    while (MXC_UART_ReadyForSleep(CLOCK_CONSOLE) != E_NO_ERROR) {}
+
+    int baud = MXC_UART_GetFrequency(CLOCK_CONSOLE);
+    MXC_SYS_SetClockDiv(div);
+    SystemCoreClockUpdate();
+    if (HOST_UART_CLOCK == MXC_UART_APB_CLK && baud > 0) {
+        MXC_UART_SetFrequency(CLOCK_CONSOLE, baud, HOST_UART_CLOCK);
+    }
+}
+
+/**
+ * @brief Drop SYSCLK to IPO / CLOCK_IDLE_DIV before waiting for the host
+*/
+void clock_idle(void) {
+    if (!clock_down) {
+        clock_set_div(CLOCK_DIV_FIELD(CLOCK_IDLE_DIV));
+        clock_down = true;
+    }
+}
+
+/**
+ * @brief Bring SYSCLK back to the full IPO rate
+*/
+void clock_busy(void) {
+    if (clock_down) {
+        clock_set_div(MXC_SYS_CLOCK_DIV_1);
+        clock_down = false;
+    }
+}
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @file "firmware_measure.c"
+ * @brief Lazy measurement of the AP firmware image against its page digests
+ * @date 2024
+ */
+
+#include "firmware_measure.h"
+
+#ifdef FIRMWARE_MEASURE
+
+#include <string.h>
+#include "mxc_device.h"
+
+// First word of the table, "MEAS"
+#define MEASURE_MAGIC 0x4D454153
+
+// Table package_binary writes into the last page of the image, the
+// measurement follows the digests
+typedef struct {
+    uint32_t magic;
+    uint32_t page_cnt;
+    uint8_t digests[][HASH_LEN];
+} measure_table_t;
+
+// Start of the image and of its last page, from firmware.ld
+extern const uint8_t _text[];
+extern const uint8_t __measure_table[];
+
+#define MEASURE_TABLE ((const measure_table_t *)__measure_table)
+#define MEASURE_PAGES_MAX ((uint32_t)(__measure_table - _text) / MXC_FLASH_PAGE_SIZE)
+
+enum { MEASURE_TABLE_CHECK, MEASURE_PAGES, MEASURE_GOOD, MEASURE_BAD };
+
+static int measure_state = MEASURE_TABLE_CHECK;
+// Next page to check
+static uint32_t measure_page;
+static uint8_t measure_root[HASH_LEN];
+
+// Checks the table against the measurement stored after it, so the page
+// loop only reads digests that are really there
+static int measure_table_check(void) {
+    const measure_table_t *table = MEASURE_TABLE;
+    if (table->magic != MEASURE_MAGIC || table->page_cnt == 0 ||
+        table->page_cnt > MEASURE_PAGES_MAX) {
+        return -1;
+    }
+    size_t len = sizeof(measure_table_t) + table->page_cnt * HASH_LEN;
+    hash((uint8_t *)table, measure_root, len);
+    if (memcmp(measure_root, __measure_table + len, HASH_LEN) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Checks the table or the next page against its digest
+ * 
+ * @return bool: true once every page has been checked or one failed
+*/
+bool measure_step(void) {
+    const measure_table_t *table = MEASURE_TABLE;
+    uint8_t digest[HASH_LEN];
+
+    switch (measure_state) {
+    case MEASURE_TABLE_CHECK:
+        measure_state = measure_table_check() == 0 ? MEASURE_PAGES : MEASURE_BAD;
+        break;
+    case MEASURE_PAGES:
+        hash((uint8_t *)_text + measure_page * MXC_FLASH_PAGE_SIZE, digest, MXC_FLASH_PAGE_SIZE);
+        if (memcmp(digest, table->digests[measure_page], HASH_LEN) != 0) {
+            measure_state = MEASURE_BAD;
+        } else if (++measure_page == table->page_cnt) {
+            measure_state = MEASURE_GOOD;
+        }
+        break;
+    default:
+        break;
+    }
+    return measure_state == MEASURE_GOOD || measure_state == MEASURE_BAD;
+}
+
+/**
+ * @brief Checks every page left and hands out the measurement
+ * 
+ * @param out: uint8_t*, where the measurement goes, or NULL
+ * @return int: 0 if the image matched its table, -1 otherwise
+*/
+int measure_finish(uint8_t out[HASH_LEN]) {
+    while (!measure_step()) {
+    }
+    if (measure_state != MEASURE_GOOD) {
+        return -1;
+    }
+    if (out != NULL) {
+        memcpy(out, measure_root, HASH_LEN);
+    }
+    return 0;
+}
+
+#endif
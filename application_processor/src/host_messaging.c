@@ -12,25 +12,630 @@
  */
 
 #include "host_messaging.h"
+#include "clock_policy.h"
+#include "irq_events.h"
+#include "noinit.h"
+#include "tiny_printf.h"
+#include <stdarg.h>
+#include <stdbool.h>
 #include <string.h>
+#include "board.h"
+#include "uart.h"
+
+// Background work while waiting for the host, see host_set_idle
+static host_idle_t host_idle;
+
+#ifdef HOST_UART_STREAM
+#include "mxc_delay.h"
+#include "nvic_table.h"
+#ifdef HOST_SLEEP
+#include "tmr.h"
+#endif
+
+// Clock the MSDK console driver runs the UART from
+#ifndef HOST_UART_CLOCK
+#define HOST_UART_CLOCK MXC_UART_IBRO_CLK
+#endif
+
+#define HOST_UART MXC_UART_GET_UART(CONSOLE_UART)
+
+// Free running indices, the ISR only moves tx_tail and writers only tx_head
+static uint8_t tx_ring[HOST_TX_BUF_LEN] NOINIT;
+static volatile uint32_t tx_head;
+static volatile uint32_t tx_tail;
+static uint32_t host_baud = HOST_UART_BAUD_DEFAULT;
+
+#if defined(HOST_BINARY_CMD) || defined(HOST_RX_RING)
+#define HOST_RX_QUEUED
+#endif
+
+#ifdef HOST_RX_QUEUED
+// Input queues up here while the AP is busy, so the host can send several
+// lines or request frames back to back. Without HOST_RX_RING it is only
+// filled in binary mode, and text input is read by the MSDK console driver
+// straight from the UART.
+static uint8_t rx_ring[HOST_RX_BUF_LEN] NOINIT;
+static volatile uint32_t rx_head;
+static volatile uint32_t rx_tail;
+
+/**
+ * @brief Moves bytes from the UART RX FIFO into the ring, dropping them once
+ * the ring is full. The host sees the loss as a bad frame or command.
+ */
+static void host_uart_drain_rx(void) {
+    while (MXC_UART_GetRXFIFOAvailable(HOST_UART) > 0) {
+        uint8_t c = (uint8_t) MXC_UART_ReadCharacterRaw(HOST_UART);
+        if (rx_head - rx_tail < HOST_RX_BUF_LEN) {
+            rx_ring[rx_head & (HOST_RX_BUF_LEN - 1)] = c;
+            rx_head++;
+        } else {
+            irq_event_post(IRQ_EVENT_HOST_RX_FULL);
+        }
+    }
+}
+
+#ifdef HOST_SLEEP
+#ifndef HOST_SLEEP_TIMER
+#define HOST_SLEEP_TIMER MXC_TMR4 // Low-power timer, keeps running while the core sleeps
+#endif
+// Nominal rate of the internal 8 kHz oscillator the timer runs from
+#define HOST_SLEEP_TIMER_HZ 8000
+
+// Set by every tick of the timer pacing the idle hook
+static volatile bool host_tick;
+
+/**
+ * @brief ISR of the idle tick timer.
+ */
+static void host_tick_isr(void) {
+    MXC_TMR_ClearFlags(HOST_SLEEP_TIMER);
+    host_tick = true;
+}
+
+/**
+ * @brief Starts ticking every HOST_SLEEP_TICK_US.
+ */
+static void host_tick_start(void) {
+    mxc_tmr_cfg_t cfg;
+    cfg.pres = TMR_PRES_1;
+    cfg.mode = TMR_MODE_CONTINUOUS;
+    cfg.bitMode = MXC_TMR_BIT_32;
+    cfg.clock = MXC_TMR_8K_CLK;
+    cfg.cmp_cnt = (uint32_t) (((uint64_t) HOST_SLEEP_TICK_US * HOST_SLEEP_TIMER_HZ) / 1000000);
+    cfg.pol = 0;
+
+    host_tick = false;
+    MXC_NVIC_SetVector(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(HOST_SLEEP_TIMER)), host_tick_isr);
+    NVIC_SetPriority(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(HOST_SLEEP_TIMER)), IRQ_PRIO_HOST_TICK);
+    NVIC_EnableIRQ(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(HOST_SLEEP_TIMER)));
+    MXC_TMR_Shutdown(HOST_SLEEP_TIMER);
+    MXC_TMR_Init(HOST_SLEEP_TIMER, &cfg, false);
+    MXC_TMR_ClearFlags(HOST_SLEEP_TIMER);
+    MXC_TMR_EnableInt(HOST_SLEEP_TIMER);
+    MXC_TMR_Start(HOST_SLEEP_TIMER);
+}
+
+/**
+ * @brief Sleeps until the next interrupt, unless input or a tick came in.
+ *
+ * Checked with interrupts masked, so an RX byte or a tick arriving between
+ * the check and the WFI leaves the WFI pending and cannot be missed. The
+ * console UART keeps its clock in sleep, its RX interrupt wakes the core
+ * within a few cycles.
+ */
+static void host_sleep(void) {
+    __disable_irq();
+    if (rx_tail == rx_head && !host_tick) {
+        __WFI();
+    }
+    __enable_irq();
+}
+#endif
+
+/**
+ * @brief Runs the idle hook until the host sends something. With HOST_SLEEP
+ * it runs once a tick and the core sleeps in between.
+ */
+static void host_run_idle(void) {
+#ifdef HOST_SLEEP
+    if (host_idle == NULL) {
+        return;
+    }
+    host_tick_start();
+    while (host_idle != NULL && rx_tail == rx_head) {
+        host_tick = false;
+        host_idle();
+        while (host_idle != NULL && !host_tick && rx_tail == rx_head) {
+            host_sleep();
+        }
+    }
+    MXC_TMR_Stop(HOST_SLEEP_TIMER);
+#else
+    while (host_idle != NULL && rx_tail == rx_head) {
+        host_idle();
+    }
+#endif
+}
+
+/**
+ * @brief Blocking read of len bytes from the RX ring.
+ */
+static void host_rx(uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        while (rx_tail == rx_head) {
+#ifdef HOST_SLEEP
+            host_sleep();
+#endif
+        }
+        buf[i] = rx_ring[rx_tail & (HOST_RX_BUF_LEN - 1)];
+        rx_tail++;
+    }
+}
+
+/**
+ * @brief Starts queueing every received byte.
+ */
+static void host_rx_enable(void) {
+    MXC_UART_DisableInt(HOST_UART, MXC_F_UART_INT_EN_RX_THD);
+    rx_head = rx_tail = 0;
+    MXC_UART_SetRXThreshold(HOST_UART, 1);
+    MXC_UART_EnableInt(HOST_UART, MXC_F_UART_INT_EN_RX_THD);
+}
+#endif
+
+/**
+ * @brief Moves bytes from the ring into the UART TX FIFO until either is full
+ * or empty.
+ */
+static void host_uart_fill(void) {
+    uint32_t tail = tx_tail;
+    while (tail != tx_head && MXC_UART_GetTXFIFOAvailable(HOST_UART) > 0) {
+        MXC_UART_WriteCharacterRaw(HOST_UART, tx_ring[tail & (HOST_TX_BUF_LEN - 1)]);
+        tail++;
+    }
+    tx_tail = tail;
+}
+
+/**
+ * @brief Console UART interrupt, refills the TX FIFO each time it drains to
+ * half empty and masks itself once the ring is empty. With HOST_RX_RING or in
+ * binary mode it also queues every received byte.
+ */
+static void host_uart_handler(void) {
+    unsigned flags = MXC_UART_GetFlags(HOST_UART);
+    MXC_UART_ClearFlags(HOST_UART, flags);
+#ifdef HOST_RX_QUEUED
+    if (flags & MXC_F_UART_INT_FL_RX_THD) {
+        host_uart_drain_rx();
+    }
+#endif
+    host_uart_fill();
+    if (tx_tail == tx_head) {
+        MXC_UART_DisableInt(HOST_UART, MXC_F_UART_INT_EN_TX_HE);
+    }
+}
+
+/**
+ * @brief Starts draining whatever is queued in the ring.
+ */
+static void host_uart_kick(void) {
+    MXC_UART_DisableInt(HOST_UART, MXC_F_UART_INT_EN_TX_HE);
+    host_uart_fill();
+    if (tx_tail != tx_head) {
+        MXC_UART_EnableInt(HOST_UART, MXC_F_UART_INT_EN_TX_HE);
+    }
+}
+
+/**
+ * @brief Queues len bytes, kicking the UART and waiting whenever the ring
+ * fills up.
+ */
+static void host_tx(const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        while (tx_head - tx_tail == HOST_TX_BUF_LEN) {
+            host_uart_kick();
+        }
+        tx_ring[tx_head & (HOST_TX_BUF_LEN - 1)] = buf[i];
+        tx_head++;
+    }
+}
+
+#ifdef HOST_BINARY_CMD
+// Current request, its arguments are handed out by recv_input in order
+static uint8_t req[HOST_FRAME_MAX_LEN];
+static unsigned req_len;
+static unsigned req_pos;
+static uint8_t req_tag;
+
+// Reply being collected, sent by the first success or error message
+static uint8_t reply[HOST_REPLY_MAX_LEN];
+static unsigned reply_len;
+static uint8_t reply_flags;
+static unsigned rec_start;
+static bool rec_open;
+static bool reply_sent;
+static bool binary_active;
+
+/**
+ * @brief CRC-16/CCITT-FALSE, continued from crc.
+ */
+static uint16_t host_crc16(uint16_t crc, const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t) buf[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Frames and sends the collected records with the given status.
+ */
+static void host_binary_send(uint8_t status) {
+    uint8_t hdr[HOST_FRAME_HDR_LEN] = {HOST_FRAME_SYNC, status | reply_flags, req_tag,
+                                       reply_len & 0xFF, reply_len >> 8};
+    uint16_t crc = host_crc16(0xFFFF, &hdr[1], HOST_FRAME_HDR_LEN - 1);
+    crc = host_crc16(crc, reply, reply_len);
+    uint8_t trailer[2] = {crc & 0xFF, crc >> 8};
+
+    host_tx(hdr, HOST_FRAME_HDR_LEN);
+    host_tx(reply, reply_len);
+    host_tx(trailer, sizeof(trailer));
+    host_uart_flush();
+    reply_sent = true;
+}
+
+// Start queueing received bytes for binary requests
+void host_binary_start(void) {
+#ifndef HOST_RX_RING
+    host_rx_enable();
+#endif
+}
+
+// Hand the UART back to the text prompts
+void host_binary_stop(void) {
+#ifndef HOST_RX_RING
+    MXC_UART_DisableInt(HOST_UART, MXC_F_UART_INT_EN_RX_THD);
+#endif
+    binary_active = false;
+}
+
+/**
+ * @brief Copies the next request argument into buf as a string.
+ *
+ * @return 0 if a binary request is active, -1 to fall back to the text prompt.
+ */
+static int host_binary_arg(char *buf, size_t len) {
+    if (!binary_active) {
+        return -1;
+    }
+    buf[0] = '\0';
+    if (req_pos >= req_len || len == 0) {
+        return 0;
+    }
+    unsigned arg_len = req[req_pos++];
+    if (arg_len > req_len - req_pos) {
+        arg_len = req_len - req_pos;
+    }
+    unsigned copy = arg_len < len - 1 ? arg_len : len - 1;
+    memcpy(buf, &req[req_pos], copy);
+    buf[copy] = '\0';
+    req_pos += arg_len;
+    return 0;
+}
+
+// Wait for the next well formed request frame, answering any bad frame with
+// HOST_STATUS_BAD_FRAME. Returns the opcode and starts collecting the reply
+int host_binary_recv(void) {
+    binary_active = false;
+    while (1) {
+        uint8_t hdr[HOST_FRAME_HDR_LEN];
+        // Background work until the request starts
+        host_run_idle();
+        // The host may take its time, idle until the request starts
+        clock_idle();
+        do {
+            host_rx(&hdr[0], 1);
+        } while (hdr[0] != HOST_FRAME_SYNC);
+        clock_busy();
+        host_rx(&hdr[1], HOST_FRAME_HDR_LEN - 1);
+
+        req_tag = hdr[2];
+        reply_len = 0;
+        reply_flags = 0;
+        req_len = hdr[3] | (hdr[4] << 8);
+        if (req_len > HOST_FRAME_MAX_LEN) {
+            host_binary_send(HOST_STATUS_BAD_FRAME);
+            continue;
+        }
+
+        uint8_t trailer[2];
+        host_rx(req, req_len);
+        host_rx(trailer, sizeof(trailer));
+        uint16_t crc = host_crc16(0xFFFF, &hdr[1], HOST_FRAME_HDR_LEN - 1);
+        crc = host_crc16(crc, req, req_len);
+        if (crc != (trailer[0] | (trailer[1] << 8))) {
+            host_binary_send(HOST_STATUS_BAD_FRAME);
+            continue;
+        }
+
+        req_pos = 0;
+        rec_open = false;
+        reply_sent = false;
+        binary_active = true;
+        return hdr[1];
+    }
+}
+
+// Send the reply for the current request if no success or error sent it yet
+void host_binary_end(void) {
+    if (binary_active && !reply_sent) {
+        host_binary_send(HOST_STATUS_ERROR);
+    }
+    binary_active = false;
+}
+#endif
+
+/**
+ * @brief Queues message text, into the open reply record while a binary
+ * request is active.
+ */
+static void host_write(const uint8_t *buf, size_t len) {
+#ifdef HOST_BINARY_CMD
+    if (binary_active) {
+        if (!rec_open || reply_sent) {
+            return;
+        }
+        size_t room = HOST_REPLY_MAX_LEN - reply_len;
+        size_t rec_room = rec_start + 2 + UINT8_MAX - reply_len;
+        if (rec_room < room) {
+            room = rec_room;
+        }
+        if (len > room) {
+            len = room;
+            reply_flags |= HOST_STATUS_TRUNCATED;
+        }
+        memcpy(&reply[reply_len], buf, len);
+        reply_len += len;
+        return;
+    }
+#endif
+    host_tx(buf, len);
+}
+
+// Hook the console UART interrupt that drains the TX ring
+void host_uart_init(void) {
+    tx_head = tx_tail = 0;
+    MXC_UART_DisableInt(HOST_UART, MXC_F_UART_INT_EN_TX_HE);
+    MXC_NVIC_SetVector(MXC_UART_GET_IRQ(CONSOLE_UART), host_uart_handler);
+    NVIC_SetPriority(MXC_UART_GET_IRQ(CONSOLE_UART), IRQ_PRIO_HOST);
+    NVIC_EnableIRQ(MXC_UART_GET_IRQ(CONSOLE_UART));
+#ifdef HOST_RX_RING
+    // From here on nothing reads the UART but the interrupt
+    host_rx_enable();
+#endif
+}
+
+// Queue formatted output in the TX ring, blocks only while the ring is full
+int host_printf(const char *fmt, ...) {
+    char line[HOST_LINE_LEN];
+    va_list args;
+    va_start(args, fmt);
+#ifdef TINY_PRINTF
+    int len = tiny_vsnprintf(line, sizeof(line), fmt, args);
+#else
+    int len = vsnprintf(line, sizeof(line), fmt, args);
+#endif
+    va_end(args);
+    if (len < 0) {
+        return len;
+    }
+    if (len >= (int) sizeof(line)) {
+        len = sizeof(line) - 1;
+    }
+    host_write((uint8_t*) line, len);
+    return len;
+}
+
+// Open a message of the given level, prefix is its text mode marker
+void host_begin(host_level_t level, const char *prefix) {
+#ifdef HOST_BINARY_CMD
+    if (binary_active) {
+        if (reply_sent) {
+            return;
+        }
+        if (HOST_REPLY_MAX_LEN - reply_len < 2) {
+            reply_flags |= HOST_STATUS_TRUNCATED;
+            return;
+        }
+        rec_start = reply_len;
+        reply[reply_len++] = level;
+        reply[reply_len++] = 0;
+        rec_open = true;
+        return;
+    }
+#endif
+    host_write((const uint8_t*) prefix, strlen(prefix));
+}
+
+// Close a message, success and error also flush everything queued
+void host_end(host_level_t level) {
+    bool final = level == HOST_SUCCESS || level == HOST_ERROR;
+#ifdef HOST_BINARY_CMD
+    if (binary_active) {
+        if (rec_open) {
+            reply[rec_start + 1] = reply_len - rec_start - 2;
+            rec_open = false;
+        }
+        if (final && !reply_sent) {
+            host_binary_send(level == HOST_SUCCESS ? HOST_STATUS_SUCCESS : HOST_STATUS_ERROR);
+        }
+        return;
+    }
+#endif
+    host_write((const uint8_t*) "%", 1);
+    if (final) {
+        host_uart_flush();
+    }
+}
+
+// Tell the host the AP is waiting for input
+void host_ack(void) {
+#ifdef HOST_BINARY_CMD
+    if (binary_active) {
+        return;
+    }
+#endif
+    host_write((const uint8_t*) "%ack%\n", 6);
+    host_uart_flush();
+}
+
+// Send everything queued and wait until the UART is idle
+void host_uart_flush(void) {
+    host_uart_kick();
+    while (tx_tail != tx_head) {
+        host_uart_kick();
+    }
+    while (MXC_UART_ReadyForSleep(HOST_UART) != E_NO_ERROR) {}
+}
+
+// Flush, then switch the console UART to baud. Returns 0 on success
+int host_uart_set_baud(uint32_t baud) {
+    host_uart_flush();
+    if (MXC_UART_SetFrequency(HOST_UART, baud, HOST_UART_CLOCK) < 0) {
+        MXC_UART_SetFrequency(HOST_UART, host_baud, HOST_UART_CLOCK);
+        return -1;
+    }
+    host_baud = baud;
+    MXC_Delay(MXC_DELAY_MSEC(HOST_UART_SETTLE_MS));
+    return 0;
+}
+
+// Flush, then go back to HOST_UART_BAUD_DEFAULT if the rate was changed
+void host_uart_restore(void) {
+    if (host_baud != HOST_UART_BAUD_DEFAULT) {
+        host_uart_set_baud(HOST_UART_BAUD_DEFAULT);
+    } else {
+        host_uart_flush();
+    }
+}
+
+#ifdef HOST_RX_RING
+/**
+ * @brief Blocking read of one text line from the RX ring into buf, echoed as
+ * the MSDK console driver does. A line ends at CR or LF, an LF right after a
+ * CR is skipped, and whatever does not fit in buf is dropped with the rest of
+ * the line.
+ */
+static void host_rx_line(char *buf, size_t len) {
+    static bool after_cr;
+    size_t n = 0;
+    while (1) {
+        uint8_t c;
+        host_rx(&c, 1);
+        if (c == '\n' && after_cr) {
+            after_cr = false;
+            continue;
+        }
+        after_cr = c == '\r';
+        if (c == '\r' || c == '\n') {
+            break;
+        }
+        if (c == '\b' || c == 0x7f) {
+            if (n > 0) {
+                n--;
+                host_tx((const uint8_t*) "\b \b", 3);
+                host_uart_kick();
+            }
+            continue;
+        }
+        if (n + 1 < len) {
+            buf[n++] = c;
+            host_tx(&c, 1);
+            host_uart_kick();
+        }
+    }
+    if (len > 0) {
+        buf[n] = '\0';
+    }
+}
+#endif
+#endif
+
+// Run idle while waiting for the host, NULL for nothing
+void host_set_idle(host_idle_t idle) {
+    host_idle = idle;
+}
 
 // Print a message through USB UART and then receive a line over USB UART
 void recv_input(const char *msg, char *buf, size_t len) {
-    print_debug(msg);
-    fflush(0);
+#ifdef HOST_BINARY_CMD
+    // Binary requests carry their arguments, there is nothing to prompt for
+    if (host_binary_arg(buf, len) == 0) {
+        return;
+    }
+#endif
+    // The prompt stays text, the host may be reading it. Idle from here on,
+    // so the binary log goes out first
+    log_binary_drain();
+    host_open(HOST_DEBUG, "debug");
+    host_print("%s", msg);
+    host_close(HOST_DEBUG, "debug");
+    host_flush();
     print_ack();
+#ifdef HOST_RX_RING
+    // Lines the host typed ahead are already queued, idle only if there are none
+    host_run_idle();
+    clock_idle();
+    host_rx_line(buf, len);
+    clock_busy();
+#else
+    // Background work until the host starts the line
+    while (host_idle != NULL && MXC_UART_GetRXFIFOAvailable(MXC_UART_GET_UART(CONSOLE_UART)) == 0) {
+        host_idle();
+    }
     // Use fgets instead of gets(buf) to avoid buffer overflow
+    // The host may take its time, idle until the line is in
+    clock_idle();
     char *fgets_out = fgets(buf, len, stdin);
+    clock_busy();
     // fgets keeps the newline in, so manually remove it on successful read
     if (fgets_out != NULL) {
         buf[strlen(buf) - 1] = '\0';
     } 
-    puts("");
+#endif
+    host_print("\n");
+}
+
+// Splits line into words in place, ending each with a NUL. Fills words with
+// up to max of them and returns how many there were in all
+int host_split(char *line, char **words, int max) {
+    int count = 0;
+    char *p = line;
+    while (1) {
+        while (*p == ' ' || *p == '\t') {
+            p++;
+        }
+        if (*p == '\0') {
+            return count;
+        }
+        if (count < max) {
+            words[count] = p;
+        }
+        count++;
+        while (*p != '\0' && *p != ' ' && *p != '\t') {
+            p++;
+        }
+        if (*p != '\0') {
+            *p++ = '\0';
+        }
+    }
 }
 
 // Prints a buffer of bytes as a hex string
 void print_hex(uint8_t *buf, size_t len) {
     for (int i = 0; i < len; i++)
-    	printf("%02x", buf[i]);
-    printf("\n");
+    	host_print("%02x", buf[i]);
+    host_print("\n");
 }
@@ -0,0 +1,146 @@
+#include "i2c_capture.h"
+
+#ifdef I2C_CAPTURE
+
+#include <string.h>
+#include "mxc_device.h"
+#include "host_messaging.h"
+#include "noinit.h"
+
+typedef char i2c_capture_buf_pow2_t[(I2C_CAPTURE_BUF_LEN & (I2C_CAPTURE_BUF_LEN - 1)) == 0 ? 1 : -1];
+
+// Byte ring of transactions, each an i2c_capture_t followed by its bytes.
+// capture_head and capture_tail count bytes ever written and dropped, the
+// oldest transaction still in the ring starts at capture_tail
+static uint8_t capture_buf[I2C_CAPTURE_BUF_LEN] NOINIT;
+static uint32_t capture_head;
+static uint32_t capture_tail;
+// Set while the ring holds the transactions of a slow operation
+static volatile int capture_frozen;
+
+/**
+ * @brief Copies bytes into the ring, wrapping at its end.
+ *
+ * @param pos Ring position to write at, not yet masked.
+ * @param data Bytes to copy.
+ * @param len Number of bytes.
+ */
+static void capture_put(uint32_t pos, const void *data, uint32_t len)
+{
+    const uint8_t *bytes = data;
+    for (uint32_t i = 0; i < len; i++) {
+        capture_buf[(pos + i) & (I2C_CAPTURE_BUF_LEN - 1)] = bytes[i];
+    }
+}
+
+/**
+ * @brief Copies bytes out of the ring, wrapping at its end.
+ *
+ * @param pos Ring position to read at, not yet masked.
+ * @param data Buffer to copy into.
+ * @param len Number of bytes.
+ */
+static void capture_get(uint32_t pos, void *data, uint32_t len)
+{
+    uint8_t *bytes = data;
+    for (uint32_t i = 0; i < len; i++) {
+        bytes[i] = capture_buf[(pos + i) & (I2C_CAPTURE_BUF_LEN - 1)];
+    }
+}
+
+/**
+ * @brief Records one transaction, dropping the oldest ones to make room.
+ *
+ * Runs from the I2C interrupt for asynchronous transactions, so the ring
+ * is only touched with interrupts masked.
+ *
+ * @param start Cycle count when the transaction started.
+ * @param req Completed request, tx_buf and rx_buf still hold its bytes.
+ * @param result Result of the transaction.
+ */
+void i2c_capture_record(uint32_t start, const mxc_i2c_req_t *req, int result)
+{
+    i2c_capture_t record;
+    record.start = start;
+    record.cycles = trace_cycles() - start;
+    record.tx_len = req->tx_len;
+    record.rx_len = req->rx_len;
+    record.bus = MXC_I2C_GET_IDX(req->i2c);
+    record.addr = req->addr;
+    record.result = result < 0 ? result : E_NO_ERROR;
+
+    uint32_t size = sizeof(record) + record.tx_len + record.rx_len;
+    if (size > I2C_CAPTURE_BUF_LEN || capture_frozen) {
+        return;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    while (capture_head - capture_tail + size > I2C_CAPTURE_BUF_LEN) {
+        i2c_capture_t oldest;
+        capture_get(capture_tail, &oldest, sizeof(oldest));
+        capture_tail += sizeof(oldest) + oldest.tx_len + oldest.rx_len;
+    }
+    capture_put(capture_head, &record, sizeof(record));
+    capture_put(capture_head + sizeof(record), req->tx_buf, record.tx_len);
+    capture_put(capture_head + sizeof(record) + record.tx_len, req->rx_buf, record.rx_len);
+    capture_head += size;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Stops or resumes recording transactions.
+ *
+ * @param frozen Nonzero to keep the ring as it is.
+ */
+void i2c_capture_freeze(int frozen)
+{
+    capture_frozen = frozen;
+}
+
+/**
+ * @brief Prints bytes of the ring as hex, "-" if there are none.
+ *
+ * @param pos Ring position of the first byte, not yet masked.
+ * @param len Number of bytes.
+ */
+static void capture_print_hex(uint32_t pos, uint32_t len)
+{
+    if (len == 0) {
+        host_print(" -");
+        return;
+    }
+    host_print(" ");
+    for (uint32_t i = 0; i < len; i++) {
+        host_print("%02x", capture_buf[(pos + i) & (I2C_CAPTURE_BUF_LEN - 1)]);
+    }
+}
+
+/**
+ * @brief Prints the ring oldest first, then clears it.
+ *
+ * Each line holds the cycle count at the start of the transaction, the
+ * cycles it took, bus, address, result, then the bytes written and read.
+ */
+void i2c_capture_dump(void)
+{
+    uint32_t pos = capture_tail;
+    while (pos != capture_head) {
+        i2c_capture_t record;
+        capture_get(pos, &record, sizeof(record));
+        pos += sizeof(record);
+
+        host_open(HOST_DEBUG, "debug");
+        host_print("C %lu %lu %u %02x %d", (unsigned long) record.start,
+                   (unsigned long) record.cycles, record.bus, record.addr, record.result);
+        capture_print_hex(pos, record.tx_len);
+        capture_print_hex(pos + record.tx_len, record.rx_len);
+        host_close(HOST_DEBUG, "debug");
+        pos += record.tx_len + record.rx_len;
+    }
+    host_flush();
+    capture_head = 0;
+    capture_tail = 0;
+}
+
+#endif
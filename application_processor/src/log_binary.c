@@ -0,0 +1,81 @@
+#include "log_binary.h"
+
+#ifdef LOG_BINARY
+
+#include <stdarg.h>
+#include "mxc_device.h"
+#include "host_messaging.h"
+#include "noinit.h"
+
+typedef char log_binary_buf_pow2_t[(LOG_BINARY_BUF_LEN & (LOG_BINARY_BUF_LEN - 1)) == 0 ? 1 : -1];
+
+// Word ring of messages, each its format string address, its argument count
+// and its arguments. log_head and log_tail count words ever written and
+// drained, log_dropped the messages that found the ring full
+static uint32_t log_buf[LOG_BINARY_BUF_LEN] NOINIT;
+static uint32_t log_head;
+static uint32_t log_tail;
+static uint32_t log_dropped;
+
+/**
+ * @brief Records one message, dropping it if the ring is full.
+ *
+ * Nothing is formatted, the arguments are copied as they were passed. May
+ * run from interrupts, so the ring is only touched with interrupts masked.
+ *
+ * @param n Number of arguments, at most LOG_BINARY_MAX_ARGS.
+ * @param fmt Format string, its address is what the host looks up.
+ */
+void log_binary_record(int n, const char *fmt, ...)
+{
+    uint32_t args[LOG_BINARY_MAX_ARGS];
+    va_list ap;
+    va_start(ap, fmt);
+    for (int i = 0; i < n; i++) {
+        args[i] = va_arg(ap, uint32_t);
+    }
+    va_end(ap);
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (log_head - log_tail + 2 + n > LOG_BINARY_BUF_LEN) {
+        log_dropped++;
+    } else {
+        log_buf[log_head++ & (LOG_BINARY_BUF_LEN - 1)] = (uint32_t) (uintptr_t) fmt;
+        log_buf[log_head++ & (LOG_BINARY_BUF_LEN - 1)] = (uint32_t) n;
+        for (int i = 0; i < n; i++) {
+            log_buf[log_head++ & (LOG_BINARY_BUF_LEN - 1)] = args[i];
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Prints the ring oldest first, then clears it.
+ *
+ * Each line holds the format string address and the arguments, all in hex.
+ * A last line reports the messages dropped since the previous drain.
+ */
+void log_binary_drain(void)
+{
+    while (log_tail != log_head) {
+        uint32_t fmt = log_buf[log_tail++ & (LOG_BINARY_BUF_LEN - 1)];
+        uint32_t n = log_buf[log_tail++ & (LOG_BINARY_BUF_LEN - 1)];
+
+        host_open(HOST_DEBUG, "debug");
+        host_print("L %08lx", (unsigned long) fmt);
+        for (uint32_t i = 0; i < n; i++) {
+            host_print(" %lx", (unsigned long) log_buf[log_tail++ & (LOG_BINARY_BUF_LEN - 1)]);
+        }
+        host_close(HOST_DEBUG, "debug");
+    }
+    if (log_dropped > 0) {
+        host_open(HOST_DEBUG, "debug");
+        host_print("L dropped %lu", (unsigned long) log_dropped);
+        host_close(HOST_DEBUG, "debug");
+        log_dropped = 0;
+    }
+    host_flush();
+}
+
+#endif
@@ -12,6 +12,9 @@
  */
 
 #include "simple_flash.h"
+#include "trace.h"
+#include "link_stats.h"
+#include "irq_events.h"
 
 #include <stdio.h>
 
@@ -24,7 +27,8 @@
 /**
  * @brief ISR for the Flash Controller
  * 
- * This ISR allows for access to the flash through simple_flash to operate
+ * This ISR allows for access to the flash through simple_flash to operate.
+ * An access failure is only posted, the main loop reports it.
  */
 void flash_simple_irq(void) {
     uint32_t temp;
@@ -36,22 +40,44 @@ void flash_simple_irq(void) {
 
     if (temp & MXC_F_FLC_INTR_AF) {
         MXC_FLC0->intr &= ~MXC_F_FLC_INTR_AF;
-        printf(" -> Interrupt! (Flash access failure)\n\n");
+        irq_event_post(IRQ_EVENT_FLASH_AF);
     }
 }
 
+/**
+ * @brief Turns the instruction cache off for a flash erase or write.
+ *
+ * The cache may hold lines of the page being changed, so it stays off
+ * while the flash controller works and is invalidated when it comes back.
+ */
+static void flash_icc_pause(void) {
+    MXC_ICC_Disable(MXC_ICC0);
+}
+
+/**
+ * @brief Turns the instruction cache back on after a flash erase or write.
+ *
+ * Enabling the ICC invalidates it, so no stale line of the changed page
+ * survives.
+ */
+static void flash_icc_resume(void) {
+    MXC_ICC_Enable(MXC_ICC0);
+}
+
 /**
  * @brief Initialize the Simple Flash Interface
  * 
- * This function registers the interrupt for the flash system,
- * enables the interrupt, and disables ICC
+ * This function registers the interrupt for the flash system and
+ * enables the interrupt. The ICC stays on; it is only disabled for
+ * the duration of each erase and write.
 */
 void flash_simple_init(void) {
     // Setup Flash
     MXC_NVIC_SetVector(FLC0_IRQn, flash_simple_irq);
+    NVIC_SetPriority(FLC0_IRQn, IRQ_PRIO_FLASH);
     NVIC_EnableIRQ(FLC0_IRQn);
     MXC_FLC_EnableInt(MXC_F_FLC_INTR_DONEIE | MXC_F_FLC_INTR_AFIE);
-    MXC_ICC_Disable(MXC_ICC0);
+    MXC_ICC_Enable(MXC_ICC0);
 }
 
 /**
@@ -67,7 +93,13 @@ void flash_simple_init(void) {
  * In order to be re-written the entire page must be erased.
 */
 int flash_simple_erase_page(uint32_t address) {
-    return MXC_FLC_PageErase(address);
+    TRACE_ENTER(TRACE_FLASH_ERASE);
+    flash_icc_pause();
+    int result = MXC_FLC_PageErase(address);
+    flash_icc_resume();
+    TRACE_EXIT(TRACE_FLASH_ERASE);
+    STATS_INC(flash_erases);
+    return result;
 }
 
 /**
@@ -81,7 +113,24 @@ int flash_simple_erase_page(uint32_t address) {
  * with the specified amount of bytes
 */
 void flash_simple_read(uint32_t address, uint32_t* buffer, uint32_t size) {
+    TRACE_ENTER(TRACE_FLASH_READ);
     MXC_FLC_Read(address, buffer, size);
+    TRACE_EXIT(TRACE_FLASH_READ);
+}
+
+/**
+ * @brief Flash Simple Map
+ * 
+ * @param address: uint32_t, address in flash to read from
+ * 
+ * @return const void*: pointer to the flash contents at address
+ * 
+ * Flash is memory mapped, so data can be used where it is instead of
+ * being copied out with flash_simple_read first. What the pointer shows
+ * changes when the page is erased or written.
+*/
+const void* flash_simple_map(uint32_t address) {
+    return (const void*) address;
 }
 
 /**
@@ -99,5 +148,10 @@ void flash_simple_read(uint32_t address, uint32_t* buffer, uint32_t size) {
  * flash_simple_erase_page documentation.
 */
 int flash_simple_write(uint32_t address, uint32_t* buffer, uint32_t size) {
-    return MXC_FLC_Write(address, size, buffer);
+    TRACE_ENTER(TRACE_FLASH_WRITE);
+    flash_icc_pause();
+    int result = MXC_FLC_Write(address, size, buffer);
+    flash_icc_resume();
+    TRACE_EXIT(TRACE_FLASH_WRITE);
+    return result;
 }
@@ -12,17 +12,396 @@
  */
 
 
+// Bus map from build_ap.py, see I2C_BUS_MASK
+#include "ectf_params.h"
 #include "simple_i2c_controller.h"
 #include "host_messaging.h"
+#include "i2c_capture.h"
+#include "bus_profile.h"
+#include "irq_events.h"
+#include "hotcold.h"
+
+#ifdef I2C_USE_DMA
+#include "dma.h"
+#endif
+
+#ifdef LINK_CRC
+#include "crc.h"
+#endif
+
+#ifdef I2C_WATCHDOG
+#include "wdt.h"
+#endif
+
+#if defined(I2C_CAPTURE) || defined(BUS_PROFILE)
+// Transactions are timed for the capture and the bus profile
+#define I2C_TIMED
+#endif
 
 /******************************** FUNCTION PROTOTYPES ********************************/
 /**
- * @brief Built-In I2C Interrupt Handler
+ * @brief Built-In I2C Interrupt Handlers, one per controller
  *
  * Utilize the built-in I2C interrupt handler to allow for the use
  * of MXC_I2C_Master_Transaction() function calls
  */
-static void I2C_Handler(void) { MXC_I2C_AsyncHandler(I2C_INTERFACE); }
+static void I2C0_Handler(void) { MXC_I2C_AsyncHandler(MXC_I2C0); }
+static void I2C1_Handler(void) { MXC_I2C_AsyncHandler(MXC_I2C1); }
+static void I2C2_Handler(void) { MXC_I2C_AsyncHandler(MXC_I2C2); }
+
+static void (*const i2c_handlers[I2C_BUS_COUNT])(void) = {
+    I2C0_Handler, I2C1_Handler, I2C2_Handler,
+};
+
+#ifdef I2C_USE_DMA
+/**
+ * @brief Built-In DMA Interrupt Handler
+ *
+ * Completes MXC_I2C_MasterTransactionDMA() transfers, which pick their
+ * DMA channels internally
+ */
+static void DMA_Handler(void) { MXC_DMA_Handler(); }
+
+// Set by i2c_simple_dma_done once the current DMA transaction finishes
+static volatile bool dma_done;
+static volatile int dma_result;
+
+/**
+ * @brief DMA transaction completion callback
+ *
+ * @param req: mxc_i2c_req_t*, finished request
+ * @param result: int, result of the transaction
+ */
+static void i2c_simple_dma_done(mxc_i2c_req_t* req, int result) {
+    (void)req;
+    dma_result = result;
+    dma_done = true;
+}
+#endif
+
+/**
+ * @brief Run a blocking controller transaction
+ *
+ * @param req: mxc_i2c_req_t*, request to run
+ *
+ * @return int: negative if error, 0 if success
+ *
+ * With I2C_USE_DMA the FIFOs are serviced by DMA and the core sleeps
+ * until completion, otherwise (or if no DMA channel is available) this
+ * falls back to the interrupt driven MXC_I2C_MasterTransaction()
+ */
+HOT static int i2c_simple_dispatch(mxc_i2c_req_t* req) {
+#ifdef I2C_USE_DMA
+    dma_done = false;
+    req->callback = i2c_simple_dma_done;
+    if (MXC_I2C_MasterTransactionDMA(req) == E_NO_ERROR) {
+        while (!dma_done) {
+            __WFI();
+        }
+        return dma_result;
+    }
+    req->callback = NULL;
+#endif
+    return MXC_I2C_MasterTransaction(req);
+}
+
+#ifdef I2C_TIMED
+/**
+ * @brief Hand a completed transaction to the capture and the bus profile
+ *
+ * @param start: uint32_t, cycle count when the transaction started
+ * @param req: mxc_i2c_req_t*, completed request
+ * @param result: int, result of the transaction
+ */
+static void i2c_simple_observe(uint32_t start, const mxc_i2c_req_t* req, int result) {
+#ifdef I2C_CAPTURE
+    i2c_capture_record(start, req, result);
+#endif
+#ifdef BUS_PROFILE
+    bus_profile_record(start, req, result);
+#endif
+}
+#endif
+
+#ifdef LINK_ASYNC
+// Asynchronous transaction in flight on each bus, see i2c_simple_async_start
+typedef struct {
+    mxc_i2c_req_t req;
+    uint8_t reg;
+    i2c_simple_callback_t done;
+    void* ctx;
+    volatile bool busy;
+#ifdef I2C_TIMED
+    uint32_t start;
+#endif
+} i2c_async_t;
+
+static i2c_async_t async_xfer[I2C_BUS_COUNT];
+
+/**
+ * @brief Take a bus for one transaction
+ *
+ * @param xfer: i2c_async_t*, state of the bus
+ *
+ * @return bool: true if the bus was free and is now taken
+ *
+ * Blocking and asynchronous transactions can be started from different
+ * tasks with AP_RTOS, so the check and the claim are one step
+ */
+static bool i2c_simple_claim(i2c_async_t* xfer) {
+    __disable_irq();
+    bool free = !xfer->busy;
+    xfer->busy = true;
+    __enable_irq();
+    return free;
+}
+#endif
+
+#ifdef I2C_MUX
+// Mux channel of every address, I2C_CHANNEL_UNKNOWN until assigned or found
+static uint8_t device_chan[128];
+// Channels the mux of every bus was last set to, 0 while not known
+static uint8_t mux_selected[I2C_BUS_COUNT];
+
+/**
+ * @brief Connect the bus segment a request goes to
+ *
+ * @param req: mxc_i2c_req_t*, request about to run, its bus already taken
+ *
+ * @return int: negative if the mux could not be set, 0 otherwise
+ *
+ * A device with a known channel gets only that channel, general calls and
+ * devices on no known channel get all of them. The mux is only written when
+ * that changes, so a run of transactions on one segment costs nothing extra
+ */
+static int i2c_simple_mux_select(mxc_i2c_req_t* req) {
+    uint8_t idx = MXC_I2C_GET_IDX(req->i2c);
+    uint8_t chan = (req->addr == I2C_GENERAL_CALL_ADDR) ? I2C_CHANNEL_UNKNOWN : device_chan[req->addr & 0x7F];
+    uint8_t channels = (chan == I2C_CHANNEL_UNKNOWN) ? I2C_MUX_ALL : (uint8_t)(1 << chan);
+    if (req->addr == I2C_MUX_ADDR || mux_selected[idx] == channels) {
+        return E_NO_ERROR;
+    }
+
+    mxc_i2c_req_t select;
+    select.i2c = req->i2c;
+    select.addr = I2C_MUX_ADDR;
+    select.tx_len = 1;
+    select.tx_buf = &channels;
+    select.rx_len = 0;
+    select.rx_buf = 0;
+    select.restart = 0;
+    select.callback = NULL;
+#ifdef I2C_TIMED
+    uint32_t start = trace_cycles();
+#endif
+    int result = MXC_I2C_MasterTransaction(&select);
+#ifdef I2C_TIMED
+    i2c_simple_observe(start, &select, result);
+#endif
+    mux_selected[idx] = (result == E_NO_ERROR) ? channels : 0;
+    return result;
+}
+#else
+#define i2c_simple_mux_select(req) E_NO_ERROR
+#endif
+
+/**
+ * @brief Clear a bus left held by a failed transaction
+ *
+ * @param i2c: mxc_i2c_regs_t*, controller of the bus
+ */
+static void i2c_simple_clear(mxc_i2c_regs_t* i2c) {
+    if (!MXC_I2C_GetSCL(i2c) || !MXC_I2C_GetSDA(i2c)) {
+        MXC_I2C_Recover(i2c, I2C_RECOVER_TRIES);
+    }
+}
+
+/**
+ * @brief Run a transaction under the bus timeout and the watchdog
+ *
+ * @param req: mxc_i2c_req_t*, request to run
+ * @param run: function that runs the request
+ *
+ * @return int: negative if error, 0 if success
+ *
+ * A device stretching SCL past I2C_TIMEOUT_US fails the transaction. If a
+ * failed transaction leaves SCL or SDA held low, the bus is cleared with
+ * clock pulses and a STOP before the next device is addressed. With
+ * I2C_WATCHDOG the watchdog is armed while the transaction runs, so a
+ * controller that never completes resets the AP instead of hanging it
+ */
+static int i2c_simple_guard(mxc_i2c_req_t* req, int (*run)(mxc_i2c_req_t*)) {
+#ifdef LINK_ASYNC
+    // Let an asynchronous transaction on this bus finish first
+    i2c_async_t* xfer = &async_xfer[MXC_I2C_GET_IDX(req->i2c)];
+    while (!i2c_simple_claim(xfer)) {}
+#endif
+#ifdef I2C_WATCHDOG
+    MXC_WDT_ResetTimer(MXC_WDT0);
+    MXC_WDT_Enable(MXC_WDT0);
+#endif
+#ifdef I2C_TIMED
+    uint32_t start = trace_cycles();
+#endif
+    int result = i2c_simple_mux_select(req);
+    if (result == E_NO_ERROR) {
+        result = run(req);
+    }
+#ifdef I2C_TIMED
+    i2c_simple_observe(start, req, result);
+#endif
+#ifdef I2C_WATCHDOG
+    MXC_WDT_Disable(MXC_WDT0);
+#endif
+
+    if (result < 0) {
+        i2c_simple_clear(req->i2c);
+    }
+#ifdef LINK_ASYNC
+    xfer->busy = false;
+#endif
+    return result;
+}
+
+/**
+ * @brief Run a blocking controller transaction, see i2c_simple_guard
+ *
+ * @param req: mxc_i2c_req_t*, request to run
+ *
+ * @return int: negative if error, 0 if success
+ */
+HOT static int i2c_simple_transaction(mxc_i2c_req_t* req) {
+    return i2c_simple_guard(req, i2c_simple_dispatch);
+}
+
+// CAPABILITY of every address seen by the last negotiation
+static uint8_t device_caps[128];
+#ifdef LINK_META
+// CAPABILITY the next negotiation takes for an address instead of reading
+// it, 0 if none
+static uint8_t device_presets[128];
+#endif
+#ifdef I2C_CALIBRATE
+// SCL timing of every bus as CLKHI << 16 | CLKLO, 0 until calibrated
+static uint32_t bus_timings[I2C_BUS_COUNT];
+#endif
+// Bus of every address, I2C_BUS_UNKNOWN until assigned or found
+static uint8_t device_bus[128];
+
+/**
+ * @brief Issue an address-only write on one bus
+ *
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param bus: uint8_t, I2C controller index
+ *
+ * @return int: 0 if a device acknowledged the address, negative otherwise
+ */
+static int i2c_simple_probe_bus(i2c_addr_t addr, uint8_t bus) {
+    mxc_i2c_req_t request;
+    request.i2c = MXC_I2C_GET_I2C(bus);
+    request.addr = addr;
+    request.tx_len = 0;
+    request.tx_buf = 0;
+    request.rx_len = 0;
+    request.rx_buf = 0;
+    request.restart = 0;
+    request.callback = NULL;
+
+    return i2c_simple_guard(&request, MXC_I2C_MasterTransaction);
+}
+
+/**
+ * @brief Look for a device on every bus in use
+ *
+ * @param addr: i2c_addr_t, address of I2C device
+ *
+ * @return int: bus the device acknowledged on, negative if none did
+ *
+ * With I2C_MUX every channel of every bus is tried, unless the device
+ * already has a channel
+ */
+static int i2c_simple_locate(i2c_addr_t addr) {
+    for (uint8_t bus = 0; bus < I2C_BUS_COUNT; bus++) {
+        if (!(I2C_BUS_MASK & (1 << bus))) {
+            continue;
+        }
+#ifdef I2C_MUX
+        uint8_t assigned = device_chan[addr & 0x7F];
+        for (uint8_t chan = 0; chan < I2C_MUX_CHANNELS; chan++) {
+            if (assigned != I2C_CHANNEL_UNKNOWN && chan != assigned) {
+                continue;
+            }
+            device_chan[addr & 0x7F] = chan;
+            if (i2c_simple_probe_bus(addr, bus) == E_NO_ERROR) {
+                device_bus[addr & 0x7F] = bus;
+                return bus;
+            }
+        }
+        device_chan[addr & 0x7F] = assigned;
+#else
+        if (i2c_simple_probe_bus(addr, bus) == E_NO_ERROR) {
+            device_bus[addr & 0x7F] = bus;
+            return bus;
+        }
+#endif
+    }
+    return E_NO_DEVICE;
+}
+
+// Whether a device has to be looked for before it is addressed
+static bool i2c_simple_unplaced(i2c_addr_t addr) {
+#ifdef I2C_MUX
+    if (device_chan[addr & 0x7F] == I2C_CHANNEL_UNKNOWN) {
+        return true;
+    }
+#endif
+    return device_bus[addr & 0x7F] == I2C_BUS_UNKNOWN;
+}
+
+/**
+ * @brief Get the controller a device is reached through
+ *
+ * @param addr: i2c_addr_t, address of I2C device
+ *
+ * @return mxc_i2c_regs_t*: controller of the device's bus, found on first
+ * use with a single bus in use it is always that one
+ */
+static mxc_i2c_regs_t* i2c_simple_bus(i2c_addr_t addr) {
+    uint8_t bus = device_bus[addr & 0x7F];
+    if (i2c_simple_unplaced(addr)) {
+        // Nothing answering anywhere fails on its own bus, or the first
+        // one, like a NACK
+        int found = i2c_simple_locate(addr);
+        if (found >= 0) {
+            bus = (uint8_t) found;
+        } else if (bus == I2C_BUS_UNKNOWN) {
+            bus = __builtin_ctz(I2C_BUS_MASK);
+        }
+    }
+    return MXC_I2C_GET_I2C(bus);
+}
+
+/**
+ * @brief Fill in the header of a frame buffer
+ *
+ * @param reg: ECTF_I2C_REGS, register to write to
+ * @param len: uint8_t, length of data to write
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the data
+ * @param tx_len: unsigned*, set to the number of bytes to send
+ *
+ * @return uint8_t*: first byte to send
+ */
+static uint8_t* i2c_simple_frame_start(ECTF_I2C_REGS reg, uint8_t len, uint8_t* frame, unsigned* tx_len) {
+    // The register byte goes right in front of the data, or of the length
+    int header = (reg == RECEIVE_FRAME) ? 2 : 1;
+    uint8_t* start = &frame[I2C_FRAME_HEADROOM - header];
+    start[0] = reg;
+    if (reg == RECEIVE_FRAME) {
+        start[1] = len;
+    }
+    *tx_len = len + header;
+    return start;
+}
 
 /******************************** FUNCTION DEFINITIONS ********************************/
 /**
@@ -34,22 +413,439 @@ static void I2C_Handler(void) { MXC_I2C_AsyncHandler(I2C_INTERFACE); }
 int i2c_simple_controller_init(void) {
     int error;
 
-    // Initialize the I2C Interface
-    error = MXC_I2C_Init(I2C_INTERFACE, true, 0);
+    // With a single bus there is nothing to look for
+    memset(device_bus, (I2C_BUS_MASK == (1 << I2C_DEFAULT_BUS)) ? I2C_DEFAULT_BUS : I2C_BUS_UNKNOWN,
+        sizeof(device_bus));
+#ifdef I2C_MUX
+    memset(device_chan, I2C_CHANNEL_UNKNOWN, sizeof(device_chan));
+    memset(mux_selected, 0, sizeof(mux_selected));
+#endif
+
+    for (int bus = 0; bus < I2C_BUS_COUNT; bus++) {
+        if (!(I2C_BUS_MASK & (1 << bus))) {
+            continue;
+        }
+        mxc_i2c_regs_t* i2c = MXC_I2C_GET_I2C(bus);
+
+        // Initialize the I2C Interface
+        error = MXC_I2C_Init(i2c, true, 0);
+        if (error != E_NO_ERROR) {
+            printf("Failed to initialize I2C%d.\n", bus);
+            return error;
+        }
+        // Set frequency to frequency macro
+        MXC_I2C_SetFrequency(i2c, I2C_FREQ);
+        // Don't let a device holding SCL low stall a transaction forever
+        MXC_I2C_SetTimeout(i2c, I2C_TIMEOUT_US);
+        // A device reset mid transfer may still hold SDA from before our reset
+        MXC_I2C_Recover(i2c, I2C_RECOVER_TRIES);
+
+        // Set up interrupt
+        MXC_NVIC_SetVector(MXC_I2C_GET_IRQ(bus), i2c_handlers[bus]);
+        NVIC_SetPriority(MXC_I2C_GET_IRQ(bus), IRQ_PRIO_LINK);
+        NVIC_EnableIRQ(MXC_I2C_GET_IRQ(bus));
+    }
+
+#ifdef I2C_USE_DMA
+    // DMA mode, transfers fall back to the interrupt path if this fails
+    if (MXC_DMA_Init() == E_NO_ERROR) {
+        for (int ch = 0; ch < MXC_DMA_CHANNELS; ch++) {
+            MXC_NVIC_SetVector(MXC_DMA_CH_GET_IRQ(ch), DMA_Handler);
+            NVIC_SetPriority(MXC_DMA_CH_GET_IRQ(ch), IRQ_PRIO_LINK);
+            NVIC_EnableIRQ(MXC_DMA_CH_GET_IRQ(ch));
+        }
+    }
+#endif
+
+#ifdef I2C_WATCHDOG
+    // Reset the AP if a transaction outlives I2C_WATCHDOG_PERIOD, it is only
+    // armed while one runs, see i2c_simple_guard
+    mxc_wdt_cfg_t wdt_cfg;
+    wdt_cfg.mode = MXC_WDT_COMPATIBILITY;
+    wdt_cfg.upperResetPeriod = I2C_WATCHDOG_PERIOD;
+    MXC_WDT_Disable(MXC_WDT0);
+    error = MXC_WDT_Init(MXC_WDT0, &wdt_cfg);
     if (error != E_NO_ERROR) {
-        printf("Failed to initialize I2C.\n");
+        printf("Failed to initialize watchdog.\n");
         return error;
     }
-    // Set frequency to frequency macro
-    MXC_I2C_SetFrequency(I2C_INTERFACE, I2C_FREQ);
-    
-    // Set up interrupt
-    MXC_NVIC_SetVector(MXC_I2C_GET_IRQ(MXC_I2C_GET_IDX(I2C_INTERFACE)), I2C_Handler);
-    NVIC_EnableIRQ(MXC_I2C_GET_IRQ(MXC_I2C_GET_IDX(I2C_INTERFACE)));
+    MXC_WDT_SetResetPeriod(MXC_WDT0, &wdt_cfg);
+    MXC_WDT_EnableReset(MXC_WDT0);
+#endif
+
+#ifdef LINK_CRC
+    // CRC-32 for the packets in both directions
+    error = MXC_CRC_Init();
+    if (error != E_NO_ERROR) {
+        printf("Failed to initialize CRC.\n");
+        return error;
+    }
+    MXC_CRC_SetPoly(LINK_CRC_POLY);
+#endif
 
     return E_NO_ERROR;
 }
 
+/**
+ * @brief Check a candidate bus frequency
+ * 
+ * @param addrs: i2c_addr_t*, addresses of the devices expected on the bus
+ * @param count: int, number of addresses
+ * @param present: bool*, which of the addresses answered at I2C_FREQ
+ * 
+ * @return bool: true if every present device answered every check
+*/
+static bool i2c_simple_check_frequency(const i2c_addr_t* addrs, int count, const bool* present) {
+    for (int i = 0; i < count; i++) {
+        if (!present[i]) {
+            continue;
+        }
+        for (int j = 0; j < I2C_NEGOTIATE_CHECKS; j++) {
+            int value = i2c_simple_read_status_generic(addrs[i], CAPABILITY);
+            if (value < 0 || (value & I2C_CAP_MAGIC_MASK) != I2C_CAP_MAGIC) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+#ifdef I2C_CALIBRATE
+/**
+ * @brief Set a packed SCL timing
+ * 
+ * @param i2c: mxc_i2c_regs_t*, controller of the bus
+ * @param timing: uint32_t, CLKHI << 16 | CLKLO
+*/
+static void i2c_simple_set_timing(mxc_i2c_regs_t* i2c, uint32_t timing) {
+    i2c->clkhi = (timing >> 16) & MXC_F_I2C_CLKHI_HI;
+    i2c->clklo = timing & MXC_F_I2C_CLKLO_LO;
+}
+
+/**
+ * @brief Carry test patterns to the devices on a bus and back
+ * 
+ * @param addrs: i2c_addr_t*, addresses of the devices expected on the bus
+ * @param count: int, number of addresses
+ * @param present: bool*, which of the addresses answered at I2C_FREQ
+ * 
+ * @return bool: true if every present device returned all
+ * I2C_CALIBRATE_ROUNDS patterns intact
+*/
+static bool i2c_simple_check_pattern(const i2c_addr_t* addrs, int count, const bool* present) {
+    uint8_t pattern[I2C_CALIBRATE_LEN];
+    uint8_t readback[I2C_CALIBRATE_LEN];
+    for (int round = 0; round < I2C_CALIBRATE_ROUNDS; round++) {
+        // Alternating bits and runs of both levels, shifted every round
+        for (int k = 0; k < I2C_CALIBRATE_LEN; k++) {
+            pattern[k] = (uint8_t)(((k & 1) ? 0x55 : 0xAA) ^ (0xFF >> ((k + round) & 7)) ^ round);
+        }
+        for (int i = 0; i < count; i++) {
+            if (!present[i]) {
+                continue;
+            }
+            if (i2c_simple_write_data_generic(addrs[i], CALIBRATE_PATTERN, I2C_CALIBRATE_LEN, pattern) < 0 ||
+                i2c_simple_read_data_generic(addrs[i], CALIBRATE_PATTERN, I2C_CALIBRATE_LEN, readback) < 0 ||
+                memcmp(pattern, readback, I2C_CALIBRATE_LEN) != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Find the fastest SCL timing a bus carries without errors
+ * 
+ * @param i2c: mxc_i2c_regs_t*, controller of the bus
+ * @param addrs: i2c_addr_t*, addresses of the devices expected on the bus
+ * @param count: int, number of addresses
+ * @param present: bool*, which of the addresses answered at I2C_FREQ
+ * @param top: int, fastest rate the devices advertise in Hz
+ * 
+ * @return uint32_t: packed timing, 0 if nothing above I2C_FREQ passed
+ * 
+ * Steps down from top by I2C_CALIBRATE_STEP_HZ. Each rate is tried with the
+ * controller's own duty cycle and with an eighth of the period moved to
+ * either side of it. The first passing setting is backed off by
+ * I2C_CALIBRATE_MARGIN steps and checked again before it is taken
+*/
+static uint32_t i2c_simple_calibrate_bus(mxc_i2c_regs_t* i2c, const i2c_addr_t* addrs, int count,
+    const bool* present, int top) {
+    static const int8_t skews[] = { 0, 1, -1 };
+
+    for (int freq = top; freq > I2C_FREQ; freq -= I2C_CALIBRATE_STEP_HZ) {
+        for (unsigned s = 0; s < sizeof(skews) / sizeof(skews[0]); s++) {
+            if (MXC_I2C_SetFrequency(i2c, freq) < 0) {
+                break;
+            }
+            uint32_t hi = i2c->clkhi & MXC_F_I2C_CLKHI_HI;
+            uint32_t lo = i2c->clklo & MXC_F_I2C_CLKLO_LO;
+            uint32_t shift = (hi + lo) / 8;
+            if (skews[s] > 0 && hi + shift <= MXC_F_I2C_CLKHI_HI && lo > shift) {
+                hi += shift;
+                lo -= shift;
+            } else if (skews[s] < 0 && lo + shift <= MXC_F_I2C_CLKLO_LO && hi > shift) {
+                hi -= shift;
+                lo += shift;
+            } else if (skews[s] != 0) {
+                continue;
+            }
+            uint32_t timing = (hi << 16) | lo;
+            i2c_simple_set_timing(i2c, timing);
+            if (!i2c_simple_check_pattern(addrs, count, present)) {
+                continue;
+            }
+
+            // Leave room for temperature and supply drift
+            for (int m = 0; m < I2C_CALIBRATE_MARGIN; m++) {
+                int slower = freq - I2C_CALIBRATE_STEP_HZ;
+                if (slower <= I2C_FREQ) {
+                    return 0;
+                }
+                hi = (hi * freq) / slower;
+                lo = (lo * freq) / slower;
+                if (hi > MXC_F_I2C_CLKHI_HI || lo > MXC_F_I2C_CLKLO_LO) {
+                    return 0;
+                }
+                freq = slower;
+            }
+            timing = (hi << 16) | lo;
+            i2c_simple_set_timing(i2c, timing);
+            return i2c_simple_check_pattern(addrs, count, present) ? timing : 0;
+        }
+    }
+    return 0;
+}
+#endif
+
+/**
+ * @brief Negotiate the frequency of one bus
+ * 
+ * @param i2c: mxc_i2c_regs_t*, controller of the bus
+ * @param addrs: i2c_addr_t*, addresses of the devices expected on the bus
+ * @param count: int, number of addresses
+ * 
+ * @return int: bus frequency selected in Hz
+*/
+static int i2c_simple_negotiate_bus(mxc_i2c_regs_t* i2c, const i2c_addr_t* addrs, int count) {
+    static const struct {
+        uint8_t cap;
+        int freq;
+    } rates[] = {
+        { I2C_CAP_FAST_PLUS, I2C_FREQ_FAST_PLUS },
+        { I2C_CAP_FAST, I2C_FREQ_FAST },
+    };
+
+    // Probe at the base rate every device is guaranteed to handle
+    MXC_I2C_SetFrequency(i2c, I2C_FREQ);
+    if (count <= 0) {
+        return I2C_FREQ;
+    }
+
+    uint8_t caps = I2C_CAP_FAST | I2C_CAP_FAST_PLUS;
+    bool present[count];
+    bool any_present = false;
+    for (int i = 0; i < count; i++) {
+#ifdef LINK_META
+        // A preset saves the read, the rate checks still find a stale one
+        int value = device_presets[addrs[i] & 0x7F];
+        device_presets[addrs[i] & 0x7F] = 0;
+        if (value == 0) {
+            value = i2c_simple_read_status_generic(addrs[i], CAPABILITY);
+        }
+#else
+        int value = i2c_simple_read_status_generic(addrs[i], CAPABILITY);
+#endif
+        present[i] = (value >= 0);
+        device_caps[addrs[i] & 0x7F] = 0;
+        if (value < 0) {
+            // Missing devices fail validation anyway, do not let them hold the bus back
+            continue;
+        }
+        any_present = true;
+        if ((value & I2C_CAP_MAGIC_MASK) != I2C_CAP_MAGIC) {
+            caps = 0;
+        } else {
+            caps &= (uint8_t) value;
+            device_caps[addrs[i] & 0x7F] = (uint8_t) value & ~I2C_CAP_MAGIC_MASK;
+        }
+    }
+    if (!any_present) {
+        return I2C_FREQ;
+    }
+
+#ifdef I2C_CALIBRATE
+    int top = I2C_FREQ;
+    for (unsigned i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        if ((caps & rates[i].cap) && rates[i].freq <= I2C_MAX_FREQ) {
+            top = rates[i].freq;
+            break;
+        }
+    }
+
+    // A stored timing within what the devices advertise only has to pass
+    // once more, anything else is calibrated again
+    int bus = MXC_I2C_GET_IDX(i2c);
+    if (bus_timings[bus] != 0) {
+        i2c_simple_set_timing(i2c, bus_timings[bus]);
+        if ((int) MXC_I2C_GetFrequency(i2c) <= top && i2c_simple_check_pattern(addrs, count, present)) {
+            return MXC_I2C_GetFrequency(i2c);
+        }
+    }
+    bus_timings[bus] = (top > I2C_FREQ) ? i2c_simple_calibrate_bus(i2c, addrs, count, present, top) : 0;
+    if (bus_timings[bus] != 0) {
+        return MXC_I2C_GetFrequency(i2c);
+    }
+#else
+    for (unsigned i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        if (!(caps & rates[i].cap) || rates[i].freq > I2C_MAX_FREQ) {
+            continue;
+        }
+        MXC_I2C_SetFrequency(i2c, rates[i].freq);
+        if (i2c_simple_check_frequency(addrs, count, present)) {
+            return rates[i].freq;
+        }
+    }
+#endif
+
+    MXC_I2C_SetFrequency(i2c, I2C_FREQ);
+    return I2C_FREQ;
+}
+
+/**
+ * @brief Negotiate the I2C bus frequency
+ * 
+ * @param addrs: i2c_addr_t*, addresses of the devices expected on the bus
+ * @param count: int, number of addresses
+ * 
+ * @return int: bus frequency selected in Hz
+ * 
+ * Reads the CAPABILITY register of every device at I2C_FREQ and raises each
+ * bus to the fastest rate all responding devices on it support. Each candidate
+ * rate is checked with I2C_NEGOTIATE_CHECKS reads per device and the next
+ * slower rate is tried on any error, down to I2C_FREQ. Returns the slowest
+ * rate picked for any bus.
+ * 
+ * With I2C_CALIBRATE the SCL timing of each bus is calibrated on test
+ * patterns instead, see i2c_simple_preset_timings.
+*/
+int i2c_simple_negotiate_frequency(const i2c_addr_t* addrs, int count) {
+    int slowest = I2C_FREQ_FAST_PLUS;
+    for (int bus = 0; bus < I2C_BUS_COUNT; bus++) {
+        if (!(I2C_BUS_MASK & (1 << bus))) {
+            continue;
+        }
+        mxc_i2c_regs_t* i2c = MXC_I2C_GET_I2C(bus);
+
+        // Each bus only waits on its own devices
+        i2c_addr_t on_bus[count > 0 ? count : 1];
+        int on_bus_cnt = 0;
+        for (int i = 0; i < count; i++) {
+            if (i2c_simple_bus(addrs[i]) == i2c) {
+                on_bus[on_bus_cnt++] = addrs[i];
+            }
+        }
+
+        int freq = i2c_simple_negotiate_bus(i2c, on_bus, on_bus_cnt);
+        if (freq < slowest) {
+            slowest = freq;
+        }
+    }
+    return slowest;
+}
+
+/**
+ * @brief Set the bus a device sits on
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param bus: uint8_t, I2C controller index, must be in I2C_BUS_MASK
+ * 
+ * Devices that are never assigned a bus are looked for on every bus in
+ * I2C_BUS_MASK the first time they are addressed
+*/
+void i2c_simple_set_bus(i2c_addr_t addr, uint8_t bus) {
+    if (bus < I2C_BUS_COUNT && (I2C_BUS_MASK & (1 << bus))) {
+        device_bus[addr & 0x7F] = bus;
+    }
+}
+
+#ifdef I2C_MUX
+/**
+ * @brief Set the mux channel a device sits on
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param channel: uint8_t, mux channel, below I2C_MUX_CHANNELS
+ * 
+ * Devices that are never assigned a channel are looked for on every channel
+ * the first time they are addressed
+*/
+void i2c_simple_set_channel(i2c_addr_t addr, uint8_t channel) {
+    if (channel < I2C_MUX_CHANNELS) {
+        device_chan[addr & 0x7F] = channel;
+    }
+}
+
+/**
+ * @brief Get the bus segment of a device
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * 
+ * @return uint8_t: bus * I2C_MUX_CHANNELS + channel, 0xFF while either is
+ * not known yet. Nothing is probed
+*/
+uint8_t i2c_simple_segment(i2c_addr_t addr) {
+    if (i2c_simple_unplaced(addr)) {
+        return 0xFF;
+    }
+    return device_bus[addr & 0x7F] * I2C_MUX_CHANNELS + device_chan[addr & 0x7F];
+}
+#endif
+
+/**
+ * @brief Get the capabilities a device advertised
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * 
+ * @return uint8_t: I2C_CAP_* bits read during the last
+ * i2c_simple_negotiate_frequency, 0 for devices it did not see
+*/
+uint8_t i2c_simple_capabilities(i2c_addr_t addr) {
+    return device_caps[addr & 0x7F];
+}
+
+#ifdef LINK_META
+/**
+ * @brief Preset the capabilities of a device for the next negotiation
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param caps: uint8_t, I2C_CAP_* bits it advertised before
+*/
+void i2c_simple_preset_capabilities(i2c_addr_t addr, uint8_t caps) {
+    device_presets[addr & 0x7F] = I2C_CAP_MAGIC | (caps & ~I2C_CAP_MAGIC_MASK);
+}
+#endif
+
+#ifdef I2C_CALIBRATE
+/**
+ * @brief Take the SCL timings of an earlier calibration
+ * 
+ * @param timings: uint32_t*, I2C_BUS_COUNT timings, 0 for buses to calibrate
+*/
+void i2c_simple_preset_timings(const uint32_t* timings) {
+    memcpy(bus_timings, timings, sizeof(bus_timings));
+}
+
+/**
+ * @brief Get the SCL timings of the last negotiation
+ * 
+ * @param timings: uint32_t*, filled with I2C_BUS_COUNT timings
+*/
+void i2c_simple_timings(uint32_t* timings) {
+    memcpy(timings, bus_timings, sizeof(bus_timings));
+}
+#endif
+
 /**
  * @brief Read RECEIVE_DONE reg
  * 
@@ -106,6 +902,51 @@ int i2c_simple_read_transmit_len(i2c_addr_t addr) {
     return i2c_simple_read_status_generic(addr, TRANSMIT_LEN);
 }
 
+/**
+ * @brief Read TRANSMIT_STATUS reg
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param len: uint8_t*, set to TRANSMIT_LEN
+ * 
+ * @return int: TRANSMIT_DONE value, negative if error
+ *
+ * TRANSMIT_DONE and TRANSMIT_LEN in one transaction, only for devices
+ * advertising I2C_CAP_COMPOUND
+*/
+int i2c_simple_read_transmit_status(i2c_addr_t addr, uint8_t* len) {
+    uint8_t status[2];
+    int result = i2c_simple_read_data_generic(addr, TRANSMIT_STATUS, sizeof(status), status);
+    if (result < 0) {
+        return result;
+    }
+    *len = status[1];
+    return status[0];
+}
+
+#ifdef LINK_STRETCH
+/**
+ * @brief Read TRANSMIT_WAIT reg
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param len: uint8_t*, set to TRANSMIT_LEN
+ * 
+ * @return int: TRANSMIT_DONE value, negative if error
+ *
+ * Like i2c_simple_read_transmit_status, but the device stretches SCL until
+ * it has a packet or LINK_STRETCH_MAX_US have gone by. Only for devices
+ * advertising I2C_CAP_STRETCH
+*/
+int i2c_simple_read_transmit_wait(i2c_addr_t addr, uint8_t* len) {
+    uint8_t status[2];
+    int result = i2c_simple_read_data_generic(addr, TRANSMIT_WAIT, sizeof(status), status);
+    if (result < 0) {
+        return result;
+    }
+    *len = status[1];
+    return status[0];
+}
+#endif
+
 /**
  * @brief Write RECEIVE_DONE reg
  * 
@@ -166,6 +1007,33 @@ int i2c_simple_write_transmit_len(i2c_addr_t addr, uint8_t len) {
     return i2c_simple_write_status_generic(addr, TRANSMIT_LEN, len); 
 }
 
+#ifdef LINK_CRC
+/**
+ * @brief Compute the CRC of a packet
+ * 
+ * @param data: uint8_t*, packet
+ * @param len: uint8_t, length of the packet
+ * 
+ * @return uint32_t: CRC-32 of the length word followed by the packet
+ *
+ * The CRC block takes whole words, so the packet is copied behind its
+ * length and zero padded, the same way simple_i2c_peripheral.c does
+*/
+uint32_t i2c_simple_crc(const uint8_t* data, uint8_t len) {
+    uint32_t words[1 + MAX_I2C_MESSAGE_LEN / 4];
+    words[0] = len;
+    words[(len + 3) / 4] = 0;
+    memcpy(&words[1], data, len);
+
+    mxc_crc_req_t req;
+    req.dataBuffer = words;
+    req.dataLen = 1 + (len + 3) / 4;
+    req.resultCRC = 0;
+    MXC_CRC_Compute(&req);
+    return req.resultCRC;
+}
+#endif
+
 /**
  * @brief Read generic data reg
  * 
@@ -179,10 +1047,10 @@ int i2c_simple_write_transmit_len(i2c_addr_t addr, uint8_t len) {
  * Read any register larger than 1B in size
  * Can be used to read the PARAMS or RESULT register
 */
-int i2c_simple_read_data_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* buf)
+HOT int i2c_simple_read_data_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* buf)
 {
     mxc_i2c_req_t request;
-    request.i2c = I2C_INTERFACE;
+    request.i2c = i2c_simple_bus(addr);
     request.addr = addr;
     request.tx_len = 1;
     request.tx_buf = (uint8_t*)&reg;
@@ -191,7 +1059,7 @@ int i2c_simple_read_data_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len
     request.restart = 0;
     request.callback = NULL;
 
-    return MXC_I2C_MasterTransaction(&request);
+    return i2c_simple_transaction(&request);
 }
 
 /**
@@ -213,7 +1081,7 @@ int i2c_simple_write_data_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t le
     memcpy(&packet[1], buf, len);
     
     mxc_i2c_req_t request;
-    request.i2c = I2C_INTERFACE;
+    request.i2c = i2c_simple_bus(addr);
     request.addr = addr;
     request.tx_len = len+1;
     request.tx_buf = packet;
@@ -222,7 +1090,54 @@ int i2c_simple_write_data_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t le
     request.restart = 0;
     request.callback = NULL;
 
-    return MXC_I2C_MasterTransaction(&request);
+    return i2c_simple_transaction(&request);
+}
+
+/**
+ * @brief Write generic data reg from a frame buffer
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param reg: ECTF_I2C_REGS, register to write to
+ * @param len: uint8_t, length of data to write
+ * @param frame: uint8_t*, I2C_FRAME_HEADROOM reserved bytes followed by the data
+ * 
+ * @return int: negative if error, 0 if success
+ * 
+ * Same as i2c_simple_write_data_generic, but the register address is
+ * written into the reserved slot and the frame is sent as is, without copying
+*/
+HOT int i2c_simple_write_frame(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* frame) {
+    unsigned tx_len;
+    uint8_t* start = i2c_simple_frame_start(reg, len, frame, &tx_len);
+
+    mxc_i2c_req_t request;
+    request.i2c = i2c_simple_bus(addr);
+    request.addr = addr;
+    request.tx_len = tx_len;
+    request.tx_buf = start;
+    request.rx_len = 0;
+    request.rx_buf = 0;
+    request.restart = 0;
+    request.callback = NULL;
+
+    return i2c_simple_transaction(&request);
+}
+
+/**
+ * @brief Probe for a device
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ *
+ * @return int: 0 if a device acknowledged the address, negative otherwise
+ * 
+ * Issues a zero-length write, so only the address byte goes on the bus.
+ * A device on no known bus is looked for on every bus in I2C_BUS_MASK
+*/
+int i2c_simple_probe(i2c_addr_t addr) {
+    if (i2c_simple_unplaced(addr)) {
+        return (i2c_simple_locate(addr) < 0) ? E_NO_DEVICE : E_NO_ERROR;
+    }
+    return i2c_simple_probe_bus(addr, device_bus[addr & 0x7F]);
 }
 
 /**
@@ -235,11 +1150,11 @@ int i2c_simple_write_data_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t le
  * 
  * Read any register that is 1B in size
 */
-int i2c_simple_read_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg) {
+HOT int i2c_simple_read_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg) {
     uint8_t value = 0;
 
     mxc_i2c_req_t request;
-    request.i2c = I2C_INTERFACE;
+    request.i2c = i2c_simple_bus(addr);
     request.addr = addr;
     request.tx_len = 1;
     request.tx_buf = (uint8_t*)&reg;
@@ -248,7 +1163,7 @@ int i2c_simple_read_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg) {
     request.restart = 0;
     request.callback = NULL;
 
-    int result = MXC_I2C_MasterTransaction(&request);
+    int result = i2c_simple_transaction(&request);
     if (result < 0) {
         return result;
     }
@@ -266,13 +1181,13 @@ int i2c_simple_read_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg) {
  *
  * Write any register that is 1B in size
 */
-int i2c_simple_write_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t value) {
+HOT int i2c_simple_write_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t value) {
     uint8_t packet[2];
     packet[0] = (uint8_t) reg;
     packet[1] = value;
     
     mxc_i2c_req_t request;
-    request.i2c = I2C_INTERFACE;
+    request.i2c = i2c_simple_bus(addr);
     request.addr = addr;
     request.tx_len = 2;
     request.tx_buf = packet;
@@ -281,5 +1196,171 @@ int i2c_simple_write_status_generic(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t
     request.restart = 0;
     request.callback = NULL;
 
-    return MXC_I2C_MasterTransaction(&request);
+    return i2c_simple_transaction(&request);
+}
+
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Write a register of every device at once
+ *
+ * @param addrs: const i2c_addr_t*, devices that must get the write
+ * @param count: int, number of devices
+ * @param reg: ECTF_I2C_REGS, register to write to
+ * @param len: uint8_t, length of data to write
+ * @param buf: uint8_t*, buffer to write data from
+ *
+ * @return int: negative if error, 0 if success
+ *
+ * One write to I2C_GENERAL_CALL_ADDR on every bus one of the devices is on,
+ * so all devices on a bus see its STOP together. The bus of every device
+ * is looked up first, so no probing happens between the writes
+*/
+int i2c_simple_broadcast(const i2c_addr_t* addrs, int count, ECTF_I2C_REGS reg, uint8_t len, uint8_t* buf) {
+    uint8_t buses = 0;
+    for (int i = 0; i < count; i++) {
+        buses |= 1 << MXC_I2C_GET_IDX(i2c_simple_bus(addrs[i]));
+    }
+
+    uint8_t packet[257];
+    packet[0] = reg;
+    memcpy(&packet[1], buf, len);
+
+    for (uint8_t bus = 0; bus < I2C_BUS_COUNT; bus++) {
+        if (!(buses & (1 << bus))) {
+            continue;
+        }
+        mxc_i2c_req_t request;
+        request.i2c = MXC_I2C_GET_I2C(bus);
+        request.addr = I2C_GENERAL_CALL_ADDR;
+        request.tx_len = len+1;
+        request.tx_buf = packet;
+        request.rx_len = 0;
+        request.rx_buf = 0;
+        request.restart = 0;
+        request.callback = NULL;
+
+        int result = i2c_simple_transaction(&request);
+        if (result < 0) {
+            return result;
+        }
+    }
+    return E_NO_ERROR;
+}
+#endif
+
+#ifdef LINK_ASYNC
+/**
+ * @brief Asynchronous transaction completion callback
+ *
+ * @param req: mxc_i2c_req_t*, finished request
+ * @param result: int, result of the transaction
+ */
+static void i2c_simple_async_done(mxc_i2c_req_t* req, int result) {
+    i2c_async_t* xfer = &async_xfer[MXC_I2C_GET_IDX(req->i2c)];
+#ifdef I2C_TIMED
+    i2c_simple_observe(xfer->start, req, result);
+#endif
+    xfer->busy = false;
+    xfer->done(xfer->ctx, result);
+}
+
+/**
+ * @brief Start a transaction on the bus of a device without waiting for it
+ *
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param reg: int, register byte to send ahead of a read, negative for a write
+ * @param tx: uint8_t*, bytes to write, register included
+ * @param tx_len: unsigned, number of bytes to write
+ * @param rx: uint8_t*, buffer to read into
+ * @param rx_len: unsigned, number of bytes to read
+ * @param done: i2c_simple_callback_t, called once the transaction completes
+ * @param ctx: void*, passed to done
+ *
+ * @return int: 0 if started, E_BUSY while the bus is taken, negative if error
+ */
+static int i2c_simple_async_start(i2c_addr_t addr, int reg, uint8_t* tx, unsigned tx_len,
+                                  uint8_t* rx, unsigned rx_len, i2c_simple_callback_t done, void* ctx) {
+    mxc_i2c_regs_t* i2c = i2c_simple_bus(addr);
+    i2c_async_t* xfer = &async_xfer[MXC_I2C_GET_IDX(i2c)];
+    if (!i2c_simple_claim(xfer)) {
+        return E_BUSY;
+    }
+
+    if (reg >= 0) {
+        xfer->reg = (uint8_t)reg;
+        tx = &xfer->reg;
+        tx_len = 1;
+    }
+    xfer->done = done;
+    xfer->ctx = ctx;
+    xfer->req.i2c = i2c;
+    xfer->req.addr = addr;
+    xfer->req.tx_len = tx_len;
+    xfer->req.tx_buf = tx;
+    xfer->req.rx_len = rx_len;
+    xfer->req.rx_buf = rx;
+    xfer->req.restart = 0;
+    xfer->req.callback = i2c_simple_async_done;
+    int result = i2c_simple_mux_select(&xfer->req);
+    if (result != E_NO_ERROR) {
+        xfer->busy = false;
+        return result;
+    }
+#ifdef I2C_TIMED
+    xfer->start = trace_cycles();
+#endif
+
+    result = MXC_I2C_MasterTransactionAsync(&xfer->req);
+    if (result != E_NO_ERROR) {
+        xfer->busy = false;
+    }
+    return result;
+}
+
+/**
+ * @brief Start reading a register without waiting for it
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param reg: ECTF_I2C_REGS, register to read from
+ * @param len: uint8_t, length of data to read
+ * @param buf: uint8_t*, buffer to read data into, must stay valid until done
+ * @param done: i2c_simple_callback_t, called once the transaction completes
+ * @param ctx: void*, passed to done
+ * 
+ * @return int: 0 if started, E_BUSY while the device's bus has a transaction
+ * in flight, other negative values if it could not be started
+*/
+int i2c_simple_read_async(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* buf,
+                          i2c_simple_callback_t done, void* ctx) {
+    return i2c_simple_async_start(addr, reg, NULL, 0, buf, len, done, ctx);
+}
+
+/**
+ * @brief Start writing a register from a frame buffer without waiting for it
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+ * @param reg: ECTF_I2C_REGS, register to write to
+ * @param len: uint8_t, length of data to write
+ * @param frame: uint8_t*, as for i2c_simple_write_frame, must stay valid until done
+ * @param done: i2c_simple_callback_t, called once the transaction completes
+ * @param ctx: void*, passed to done
+ * 
+ * @return int: 0 if started, E_BUSY while the device's bus has a transaction
+ * in flight, other negative values if it could not be started
+*/
+int i2c_simple_write_async(i2c_addr_t addr, ECTF_I2C_REGS reg, uint8_t len, uint8_t* frame,
+                           i2c_simple_callback_t done, void* ctx) {
+    unsigned tx_len;
+    uint8_t* start = i2c_simple_frame_start(reg, len, frame, &tx_len);
+    return i2c_simple_async_start(addr, -1, start, tx_len, NULL, 0, done, ctx);
+}
+
+/**
+ * @brief Clear the bus of a device after a failed asynchronous transaction
+ * 
+ * @param addr: i2c_addr_t, address of I2C device
+*/
+void i2c_simple_recover(i2c_addr_t addr) {
+    i2c_simple_clear(i2c_simple_bus(addr));
 }
+#endif
@@ -0,0 +1,191 @@
+#include "simple_spi_controller.h"
+
+#ifdef LINK_SPI
+
+#include "mxc_delay.h"
+
+/******************************** GLOBAL DEFINITIONS ********************************/
+// Chip select pin per I2C address, SPI_CS_NONE without one
+static uint8_t device_cs[128];
+
+/******************************** FUNCTION DEFINITIONS ********************************/
+/**
+ * @brief Drive a component's chip select
+ *
+ * @param pin: uint8_t, pin of SPI_CS_PORT
+ * @param asserted: bool, true to select the component
+*/
+static void spi_simple_select(uint8_t pin, bool asserted) {
+    if (asserted) {
+        MXC_GPIO_OutClr(SPI_CS_PORT, 1U << pin);
+    } else {
+        MXC_GPIO_OutSet(SPI_CS_PORT, 1U << pin);
+    }
+}
+
+/**
+ * @brief Clock bytes through the controller while the chip select is held
+ *
+ * @param tx: uint8_t*, bytes to send, NULL to send the default value
+ * @param rx: uint8_t*, buffer for the bytes received, NULL to drop them
+ * @param len: int, number of bytes
+ *
+ * @return int: E_NO_ERROR if successful, negative if error
+*/
+static int spi_simple_transfer(uint8_t* tx, uint8_t* rx, int len) {
+    mxc_spi_req_t req;
+    req.spi = SPI_LINK_INST;
+    req.txData = tx;
+    req.rxData = rx;
+    req.txLen = (tx != NULL) ? len : 0;
+    req.rxLen = (rx != NULL) ? len : 0;
+    req.ssIdx = 0;
+    req.ssDeassert = 0;
+    req.txCnt = 0;
+    req.rxCnt = 0;
+    req.completeCB = NULL;
+    return MXC_SPI_MasterTransaction(&req);
+}
+
+/**
+ * @brief Run one exchange with a component
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ * @param cmd: uint8_t, SPI_CMD_* command
+ * @param len: uint8_t, length of the packet of a write
+ * @param body: uint8_t*, packet of a write, buffer of a read
+ *
+ * @return int: with SPI_CMD_READ the length read, otherwise the status of
+ * the header, negative if error
+*/
+static int spi_simple_exchange(i2c_addr_t addr, uint8_t cmd, uint8_t len, uint8_t* body) {
+    uint8_t pin = device_cs[addr & 0x7F];
+    if (pin == SPI_CS_NONE) {
+        return E_BAD_PARAM;
+    }
+
+    uint8_t header[SPI_HEADER_LEN] = {cmd, len};
+    uint8_t reply[SPI_HEADER_LEN];
+    spi_simple_select(pin, true);
+    int result = spi_simple_transfer(header, reply, SPI_HEADER_LEN);
+    if (result == E_NO_ERROR && (reply[0] & SPI_STATUS_MAGIC_MASK) != SPI_STATUS_MAGIC) {
+        // Nothing listening on that chip select
+        result = E_COMM_ERR;
+    }
+
+    // Both ends decide from the two headers whether a body follows
+    int status = reply[0];
+    if (result == E_NO_ERROR && cmd == SPI_CMD_WRITE && len > 0 && !(status & SPI_STATUS_RX_FULL)) {
+        MXC_Delay(SPI_TURNAROUND_US);
+        result = spi_simple_transfer(body, NULL, len);
+    } else if (result == E_NO_ERROR && cmd == SPI_CMD_READ && (status & SPI_STATUS_TX_READY)) {
+        MXC_Delay(SPI_TURNAROUND_US);
+        result = spi_simple_transfer(NULL, body, reply[1]);
+    }
+    spi_simple_select(pin, false);
+
+    if (result != E_NO_ERROR) {
+        return result;
+    }
+    if (cmd == SPI_CMD_READ) {
+        return (status & SPI_STATUS_TX_READY) ? reply[1] : 0;
+    }
+    return status;
+}
+
+/**
+ * @brief Initialize the SPI controller and the chip selects
+ *
+ * @return int: negative if error, 0 if successful
+*/
+int spi_simple_controller_init(void) {
+    memset(device_cs, SPI_CS_NONE, sizeof(device_cs));
+
+    // Chip selects are plain GPIOs, the controller's own slave select is unused
+    int result = MXC_SPI_Init(SPI_LINK_INST, 1, 0, 1, 0, LINK_SPI_HZ);
+    if (result != E_NO_ERROR) {
+        return result;
+    }
+    MXC_SPI_SetDataSize(SPI_LINK_INST, 8);
+    MXC_SPI_SetWidth(SPI_LINK_INST, SPI_WIDTH_STANDARD);
+    MXC_SPI_SetDefaultTXData(SPI_LINK_INST, 0xFF);
+    return E_NO_ERROR;
+}
+
+/**
+ * @brief Assign a component its chip select
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ * @param pin: uint8_t, pin of SPI_CS_PORT, SPI_CS_NONE for a component without SPI
+*/
+void spi_simple_set_cs(i2c_addr_t addr, uint8_t pin) {
+    device_cs[addr & 0x7F] = pin;
+    if (pin == SPI_CS_NONE) {
+        return;
+    }
+
+    // Deselected until the first exchange
+    mxc_gpio_cfg_t cs_cfg;
+    cs_cfg.port = SPI_CS_PORT;
+    cs_cfg.mask = 1U << pin;
+    cs_cfg.func = MXC_GPIO_FUNC_OUT;
+    cs_cfg.pad = MXC_GPIO_PAD_NONE;
+    cs_cfg.vssel = MXC_GPIO_VSSEL_VDDIO;
+    cs_cfg.drvstr = MXC_GPIO_DRVSTR_0;
+    MXC_GPIO_OutSet(SPI_CS_PORT, cs_cfg.mask);
+    MXC_GPIO_Config(&cs_cfg);
+}
+
+/**
+ * @brief Check whether a component has a chip select
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ *
+ * @return bool: true if it can be reached over SPI
+*/
+bool spi_simple_has_cs(i2c_addr_t addr) {
+    return device_cs[addr & 0x7F] != SPI_CS_NONE;
+}
+
+/**
+ * @brief Read a component's status
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ *
+ * @return int: SPI_STATUS_* bits, negative if error
+*/
+int spi_simple_poll(i2c_addr_t addr) {
+    return spi_simple_exchange(addr, SPI_CMD_POLL, 0, NULL);
+}
+
+/**
+ * @brief Write a packet to a component
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ * @param len: uint8_t, length of the packet
+ * @param packet: uint8_t*, packet
+ *
+ * @return int: E_NO_ERROR once written, E_BUSY while it still holds the
+ * last one, other negative values if error
+*/
+int spi_simple_write(i2c_addr_t addr, uint8_t len, uint8_t* packet) {
+    int status = spi_simple_exchange(addr, SPI_CMD_WRITE, len, packet);
+    if (status < E_NO_ERROR) {
+        return status;
+    }
+    return (status & SPI_STATUS_RX_FULL) ? E_BUSY : E_NO_ERROR;
+}
+
+/**
+ * @brief Read and take a component's packet
+ *
+ * @param addr: i2c_addr_t, I2C address of the component
+ * @param packet: uint8_t*, buffer of MAX_I2C_MESSAGE_LEN bytes
+ *
+ * @return int: length of the packet, 0 if it has none, negative if error
+*/
+int spi_simple_read(i2c_addr_t addr, uint8_t* packet) {
+    return spi_simple_exchange(addr, SPI_CMD_READ, 0, packet);
+}
+
+#endif
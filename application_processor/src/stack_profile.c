@@ -0,0 +1,70 @@
+#include "stack_profile.h"
+
+#ifdef STACK_PROFILE
+
+#include <stdio.h>
+#include "host_messaging.h"
+#include "ap_rtos.h"
+
+// Linker script symbols, see firmware.ld
+extern uint32_t __StackLimit[];
+extern uint32_t __StackTop[];
+extern uint32_t _data[];
+extern uint32_t _ebss[];
+
+/**
+ * @brief Size of the main stack.
+ *
+ * @return Bytes between __StackLimit and __StackTop.
+ */
+uint32_t stack_size(void)
+{
+    return (uint32_t) ((uintptr_t) __StackTop - (uintptr_t) __StackLimit);
+}
+
+/**
+ * @brief Finds the stack high-water mark.
+ *
+ * The stack grows down from __StackTop, so the lowest word that no longer
+ * holds STACK_PAINT is the deepest the stack has been since reset.
+ *
+ * @return Bytes of the main stack used at its deepest.
+ */
+uint32_t stack_used(void)
+{
+    uint32_t *word = __StackLimit;
+    while (word < __StackTop && *word == STACK_PAINT) {
+        word++;
+    }
+    return (uint32_t) ((uintptr_t) __StackTop - (uintptr_t) word);
+}
+
+/**
+ * @brief Size of the statically allocated RAM.
+ *
+ * @return Bytes of .data and .bss.
+ */
+uint32_t stack_static_ram(void)
+{
+    return (uint32_t) ((uintptr_t) _ebss - (uintptr_t) _data);
+}
+
+/**
+ * @brief Prints the stack high-water mark and the static RAM.
+ */
+void stack_report(void)
+{
+    uint32_t used = stack_used();
+    host_print("%%debug: stack %lu of %lu bytes used, %lu free%%\n", (unsigned long) used,
+               (unsigned long) stack_size(), (unsigned long) (stack_size() - used));
+    host_print("%%debug: static ram %lu bytes%%\n", (unsigned long) stack_static_ram());
+#ifdef AP_RTOS
+    // Commands run on the host task's stack, the main stack only takes
+    // main before the scheduler starts and the interrupt handlers
+    host_print("%%debug: host task stack %lu bytes never used%%\n",
+               (unsigned long) ap_rtos_host_stack_unused());
+#endif
+    host_flush();
+}
+
+#endif
@@ -0,0 +1,142 @@
+#include "trace.h"
+
+#ifdef TRACE_ENABLE
+
+#include <stdio.h>
+#include <string.h>
+#include "mxc_device.h"
+#include "noinit.h"
+#include "host_messaging.h"
+
+// Ring buffer of samples, trace_count is the total number ever recorded
+static trace_sample_t trace_buf[TRACE_BUF_LEN] NOINIT;
+static uint32_t trace_count;
+// Cycle count at the last entry of each point and cycles spent inside it
+static uint32_t trace_entered[TRACE_POINT_CNT];
+static uint32_t trace_totals[TRACE_POINT_CNT];
+#ifdef SLOW_CAPTURE
+// Set while the ring holds the trace of a slow operation
+static int trace_frozen;
+#endif
+
+static const char *trace_names[TRACE_POINT_CNT] = {
+    [TRACE_AES_ENCRYPT] = "aes_encrypt",
+    [TRACE_AES_DECRYPT] = "aes_decrypt",
+    [TRACE_HASH] = "hash",
+    [TRACE_RNG_GEN] = "rng_gen",
+    [TRACE_SEND_PACKET] = "send_packet",
+    [TRACE_RECV_PACKET] = "recv_packet",
+    [TRACE_FLASH_READ] = "flash_read",
+    [TRACE_FLASH_WRITE] = "flash_write",
+    [TRACE_FLASH_ERASE] = "flash_erase",
+};
+
+/**
+ * @brief Enables the DWT cycle counter and clears the ring buffer.
+ */
+void trace_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    trace_count = 0;
+    memset(trace_totals, 0, sizeof(trace_totals));
+}
+
+/**
+ * @brief Records one sample, overwriting the oldest once the buffer is full.
+ *
+ * @param point Code path being traced.
+ * @param exit 0 on entry to the code path, 1 on exit.
+ */
+void trace_record(trace_point_t point, int exit)
+{
+    uint32_t cycles = DWT->CYCCNT;
+    if (exit) {
+        trace_totals[point] += cycles - trace_entered[point];
+    } else {
+        trace_entered[point] = cycles;
+    }
+
+#ifdef SLOW_CAPTURE
+    if (trace_frozen) {
+        return;
+    }
+#endif
+    trace_sample_t *sample = &trace_buf[trace_count++ & (TRACE_BUF_LEN - 1)];
+    sample->cycles = cycles;
+    sample->point = (uint8_t) point;
+    sample->exit = (uint8_t) exit;
+}
+
+/**
+ * @brief Reads the cycle counter.
+ *
+ * @return Current DWT cycle count.
+ */
+uint32_t trace_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Sums the time spent inside the crypto points.
+ *
+ * @return Cycles between entry and exit of aes_encrypt, aes_decrypt and
+ * hash since trace_init.
+ */
+uint32_t trace_crypto_cycles(void)
+{
+    return trace_totals[TRACE_AES_ENCRYPT] + trace_totals[TRACE_AES_DECRYPT] +
+           trace_totals[TRACE_HASH];
+}
+
+/**
+ * @brief Time spent inside one code path.
+ *
+ * @param point Code path being traced.
+ * @return Cycles between entry and exit of point since trace_init.
+ */
+uint32_t trace_point_cycles(trace_point_t point)
+{
+    return trace_totals[point];
+}
+
+#ifdef SLOW_CAPTURE
+/**
+ * @brief Stops or resumes adding samples to the ring buffer.
+ *
+ * @param frozen Nonzero to keep the samples in the buffer as they are.
+ */
+void trace_freeze(int frozen)
+{
+    trace_frozen = frozen;
+}
+#endif
+
+/**
+ * @brief Prints the buffered samples oldest first, then clears the buffer.
+ *
+ * Each line holds the raw cycle count, the cycles since the previous
+ * sample, the code path and whether it was entered or exited.
+ */
+void trace_dump(void)
+{
+    uint32_t start = 0;
+    if (trace_count > TRACE_BUF_LEN) {
+        start = trace_count - TRACE_BUF_LEN;
+    }
+
+    uint32_t prev = trace_buf[start & (TRACE_BUF_LEN - 1)].cycles;
+    for (uint32_t i = start; i < trace_count; i++) {
+        trace_sample_t *sample = &trace_buf[i & (TRACE_BUF_LEN - 1)];
+        host_print("%%debug: T %lu +%lu %s %s%%\n", (unsigned long) sample->cycles,
+                   (unsigned long) (sample->cycles - prev), trace_names[sample->point],
+                   sample->exit ? "exit" : "enter");
+        prev = sample->cycles;
+    }
+    host_flush();
+    trace_count = 0;
+}
+
+#endif
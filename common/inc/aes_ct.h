@@ -0,0 +1,42 @@
+#ifndef AES_CT_H
+#define AES_CT_H
+
+/*
+Table-free, constant-time AES-128 built with AES_CT (see project.mk).
+
+wolfCrypt's software AES looks up T-tables indexed by key and data bytes, which leaks timing
+through flash wait states once the instruction cache is disabled and is slow there too. This
+implementation is bitsliced: the state of two blocks is held in eight 32-bit words, one per bit
+position of every byte, and the S-box is a fixed boolean circuit, so every block takes the same
+instructions and memory accesses whatever the key and data.
+
+The corresponding implementations are located in aes_ct.c.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AES_CT_BLOCK_SIZE 16
+#define AES_CT_ROUNDS 10
+
+// Bitsliced AES-128 round keys, eight words per round key
+typedef struct aes_ct_key_t {
+    uint32_t sk[(AES_CT_ROUNDS + 1) * 8];
+} aes_ct_key_t;
+
+// Expands a 16 byte key into ks. The same schedule serves encryption and decryption.
+void aes_ct_setkey(aes_ct_key_t *ks, const uint8_t key[16]);
+
+// Wipes an expanded key schedule
+void aes_ct_wipe(aes_ct_key_t *ks);
+
+// Encrypts or decrypts a single 16 byte block, in and out may overlap
+void aes_ct_encrypt_block(const aes_ct_key_t *ks, const uint8_t *in, uint8_t *out);
+void aes_ct_decrypt_block(const aes_ct_key_t *ks, const uint8_t *in, uint8_t *out);
+
+// CBC mode over len bytes, len must be a multiple of 16. iv is not modified.
+// Decryption works two blocks at a time, in and out may be the same buffer.
+void aes_ct_cbc_encrypt(const aes_ct_key_t *ks, const uint8_t iv[16], const uint8_t *in, uint8_t *out, size_t len);
+void aes_ct_cbc_decrypt(const aes_ct_key_t *ks, const uint8_t iv[16], const uint8_t *in, uint8_t *out, size_t len);
+
+#endif
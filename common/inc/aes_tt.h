@@ -0,0 +1,34 @@
+#ifndef AES_TT_H
+#define AES_TT_H
+
+/*
+Two-block T-table AES-128 CBC decryption built with AES_TT (see project.mk).
+
+CBC decryption has no dependency between blocks, every plaintext block is D(C_i) ^ C_{i-1}.
+wolfCrypt's wc_AesCbcDecrypt still runs one block through all ten rounds before it starts the
+next, so every table lookup waits on the one before. This kernel runs two blocks through each
+round together, so the lookups of one block fill the load latency of the other. It works on
+wolfCrypt's own decryption round keys, the Aes.key that wc_AesSetKey(AES_DECRYPTION) or the
+PRECOMPUTED_KEYS tables leave. Its single table and inverse S-box are built in SRAM by
+aes_tt_init, so the lookups do not pay flash wait states either.
+
+Like wolfCrypt's, the lookups are indexed by key and data bytes; AES_CT is the constant-time
+option and the two are exclusive.
+
+The corresponding implementations are located in aes_tt.c.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AES_TT_BLOCK_SIZE 16
+#define AES_TT_ROUNDS 10
+
+// Builds the decryption tables, before the first aes_tt_cbc_decrypt
+void aes_tt_init(void);
+
+// CBC decryption over len bytes, len must be a multiple of 16. rk are the 44 decryption round
+// key words as wolfCrypt lays them out, iv is not modified, in and out may be the same buffer.
+void aes_tt_cbc_decrypt(const uint32_t *rk, const uint8_t iv[16], const uint8_t *in, uint8_t *out, size_t len);
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef ASCON_H
+#define ASCON_H
+
+/*
+Ascon-128 authenticated encryption, the frame AEAD with MSG_AEAD=ASCON (see project.mk).
+
+Ascon is a 320-bit permutation made of 64-bit XORs, ANDs and rotations only, so it needs no
+tables, runs in the same time whatever the key and data, and has no key schedule to expand.
+A frame costs one 12 round permutation at each end and one 6 round permutation per 8 bytes in
+between, much less than AES-GCM's multiplications in GF(2^128) on a Cortex-M4 without GHASH
+hardware. This is Ascon-128 v1.2 as selected by the NIST lightweight cryptography process:
+128-bit key, nonce and tag, 64-bit rate, no associated data.
+
+The corresponding implementations are located in ascon.c.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ASCON_KEY_LEN 16
+#define ASCON_NONCE_LEN 16
+#define ASCON_TAG_LEN 16
+
+// The key as the two state words it is XORed in as
+typedef struct ascon_key_t {
+    uint64_t k0;
+    uint64_t k1;
+} ascon_key_t;
+
+// Loads a 16 byte key into ks
+void ascon_setkey(ascon_key_t *ks, const uint8_t key[ASCON_KEY_LEN]);
+
+// Wipes a loaded key
+void ascon_wipe(ascon_key_t *ks);
+
+// Encrypts len bytes of in into out and writes the tag, in and out may be the same buffer.
+// The nonce must never repeat under the same key.
+void ascon_encrypt(const ascon_key_t *ks, const uint8_t nonce[ASCON_NONCE_LEN],
+                   const uint8_t *in, uint8_t *out, size_t len, uint8_t tag[ASCON_TAG_LEN]);
+
+// Decrypts len bytes of in into out and checks tag, in and out may be the same buffer.
+// Returns 0 if the tag verifies, otherwise -1 with out wiped.
+int ascon_decrypt(const ascon_key_t *ks, const uint8_t nonce[ASCON_NONCE_LEN],
+                  const uint8_t *in, uint8_t *out, size_t len, const uint8_t tag[ASCON_TAG_LEN]);
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/*
+Benchmark firmware support, shared between the AP and Component.
+
+`make bench` builds an image with BENCH_ENABLE that times the crypto
+primitives and the board link with the DWT cycle counter and reports
+min/avg/max latency and throughput over UART as info messages. The AP also
+times the full protocol against the components on the bus, which run their
+normal command loop once their own benchmarks are done.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Iterations of every benchmark
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 100
+#endif
+
+// Latency statistics of one benchmark, in cycles
+typedef struct bench_stat_t {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} bench_stat_t;
+
+#ifdef BENCH_ENABLE
+
+#include "mxc_device.h"
+
+// Prints one line of the report as an info message
+typedef void (*bench_print_t)(const char *text);
+
+// Enables the DWT cycle counter, the report goes to print
+void bench_init(bench_print_t print);
+
+// Clears stat for a new benchmark
+void bench_reset(bench_stat_t *stat);
+
+// Adds one sample of cycles to stat
+void bench_add(bench_stat_t *stat, uint32_t cycles);
+
+// Prints stat as an info message. bytes is the amount of data processed per
+// iteration, 0 leaves out the throughput
+void bench_report(const char *name, const bench_stat_t *stat, size_t bytes);
+
+// Times aes_encrypt, aes_decrypt, hash, hash_many, hmac and rng_gen
+void bench_crypto(void);
+
+// Current cycle count
+#define bench_now() (DWT->CYCCNT)
+
+// Runs stmt BENCH_ITERATIONS times and reports it under name
+#define BENCH_RUN(name, bytes, stmt)                    \
+    do {                                                \
+        bench_stat_t _stat;                             \
+        bench_reset(&_stat);                            \
+        for (int _i = 0; _i < BENCH_ITERATIONS; _i++) { \
+            uint32_t _start = bench_now();              \
+            stmt;                                       \
+            bench_add(&_stat, bench_now() - _start);    \
+        }                                               \
+        bench_report((name), &_stat, (bytes));          \
+    } while (0)
+
+#endif
+
+#endif
@@ -0,0 +1,320 @@
+#ifndef CRYPTO_UTIL_H
+#define CRYPTO_UTIL_H
+
+/*
+A replacement for the simple_crypto library, utilizing WolfSSL for enhanced encryption and hashing algorithms.
+
+The corresponding implementations are located in crypto_util.c.
+
+For debug printing, this code utilizes the host_messaging library from 2024_MTU_eCTF/2024-ectf-insecure-example/application_processor/inc/host_messaging.h.
+*/
+
+#define HASH_LEN 32
+#define IV_SIZE 16
+// Frame AEAD (MSG_AEAD=1 for AES-GCM, MSG_AEAD=ASCON for Ascon-128 in project.mk)
+#ifdef MSG_AEAD_ASCON
+#define MSG_AEAD
+#define AEAD_NONCE_LEN 16
+#else
+#define AEAD_NONCE_LEN 12
+#endif
+#define AEAD_TAG_LEN 16
+#define CHANNEL_KEY_LEN 16
+
+// Keyed frame MAC (MSG_MAC=HMAC or MSG_MAC=CMAC in project.mk), MAC_LEN bytes
+#if defined(MSG_MAC_HMAC) && defined(MSG_MAC_CMAC)
+#error "Pick one of MSG_MAC_HMAC and MSG_MAC_CMAC"
+#endif
+#if defined(MSG_MAC_HMAC)
+#define MSG_MAC
+#define MAC_LEN HASH_LEN
+#elif defined(MSG_MAC_CMAC)
+#define MSG_MAC
+#define MAC_LEN 16
+#endif
+
+// Channel keys back the post-boot channel and message streams
+#if defined(POST_BOOT_SESSION) || defined(MSG_STREAM)
+#define MSG_CHANNEL
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "general_util.h"
+
+// WolfSSL includes requires the wolfssl library to be installed
+#include "wolfssl/wolfcrypt/sha256.h"
+#include "wolfssl/wolfcrypt/hmac.h"
+#include "wolfssl/wolfcrypt/aes.h"
+#include "wolfssl/wolfcrypt/wc_port.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#ifdef MSG_MAC_CMAC
+#include "wolfssl/wolfcrypt/cmac.h"
+#endif
+
+#ifdef AES_CT
+#include "aes_ct.h"
+#endif
+
+#ifdef AES_TT
+#ifdef AES_CT
+#error "AES_TT and AES_CT are exclusive, AES_CT already decrypts two blocks at a time"
+#endif
+#include "aes_tt.h"
+#endif
+
+#ifdef MSG_AEAD_ASCON
+#include "ascon.h"
+#endif
+
+#if defined(MSG_AEAD) && !defined(MSG_AEAD_ASCON) && !defined(HAVE_AESGCM)
+#error "MSG_AEAD framing requires HAVE_AESGCM"
+#endif
+#if defined(MSG_AEAD) && defined(MSG_MAC)
+#error "MSG_AEAD frames already carry a tag, MSG_MAC does not apply"
+#endif
+#if defined(MSG_MAC_CMAC) && !defined(WOLFSSL_CMAC)
+#error "MSG_MAC=CMAC requires WOLFSSL_CMAC"
+#endif
+#if defined(MSG_CTR) && !defined(WOLFSSL_AES_COUNTER)
+#error "MSG_CTR framing requires WOLFSSL_AES_COUNTER"
+#endif
+#if defined(MSG_CTR) && defined(MSG_AEAD)
+#error "MSG_AEAD frames are already encrypted by the AEAD"
+#endif
+#if defined(COMPONENT_KEYS) && !defined(HAVE_HKDF)
+#error "COMPONENT_KEYS requires HAVE_HKDF"
+#endif
+#if defined(COMPONENT_ENROLL) && (!defined(COMPONENT_KEYS) || !defined(HAVE_ECC))
+#error "COMPONENT_ENROLL requires COMPONENT_KEYS and HAVE_ECC"
+#endif
+#if defined(ENROLL_RESUME) && !defined(COMPONENT_ENROLL)
+#error "ENROLL_RESUME requires COMPONENT_ENROLL"
+#endif
+#if defined(MSG_CTR) && !defined(MSG_MAC)
+// Flipping ciphertext bits flips the same plaintext bits under CTR, so a known
+// frame could be altered and its unkeyed hash fixed up to match
+#error "MSG_CTR framing requires a keyed MSG_MAC"
+#endif
+
+// HMAC-SHA256 midstates of one key: SHA-256 contexts that have already absorbed
+// the key XOR ipad and key XOR opad blocks, copied for every MAC
+typedef struct crypto_mac_t {
+    wc_Sha256 inner;
+    wc_Sha256 outer;
+} crypto_mac_t;
+
+// Persistent crypto session. Holds the expanded AES key schedules so they are
+// only built once at startup instead of on every message.
+typedef struct crypto_session_t {
+    Aes enc;
+    Aes dec;
+    crypto_mac_t mac;
+#ifdef MSG_MAC_CMAC
+    Cmac cmac; // Keyed under a key derived from the session key, copied for every MAC
+#endif
+#ifdef HAVE_AESGCM
+    Aes gcm;
+#endif
+#ifdef MSG_AEAD_ASCON
+    ascon_key_t ascon; // Ascon has no schedule, the key as two state words
+#endif
+#ifdef AES_CT
+    aes_ct_key_t ct; // Software CBC and single block schedule, see aes_ct.h
+#endif
+    int devId; // WOLFSSL_MAX78000_DEVID when the AES engine is in use, else INVALID_DEVID
+    int ready;
+} crypto_session_t;
+
+// Heap hint every wolfCrypt context is created with. Points at a fixed arena with
+// CRYPTO_STATIC_MEMORY so crypto never touches the general heap, NULL otherwise.
+void *crypto_heap(void);
+
+// Initializes wolfCrypt and expands the key schedules, or loads the deployment's
+// precomputed ones with PRECOMPUTED_KEYS. Must be called once at startup
+// before any other crypto routine. Returns 0 on success.
+int crypto_init(void);
+
+// Frees the crypto session and wipes the expanded key schedules.
+void crypto_free(void);
+
+#ifdef MSG_CHANNEL
+// Derives the post-boot channel key from the device key and the last challenges
+// the AP and the component exchanged during boot.
+void crypto_derive_channel_key(uint32_t ap_chal, uint32_t comp_chal, uint8_t out[CHANNEL_KEY_LEN]);
+
+// Runs the AES routines under a channel key instead of the device key until
+// called again. NULL switches back to the device key. Returns 0 on success.
+int crypto_use_channel_key(const uint8_t *channel_key);
+
+// Changes whenever crypto_use_channel_key is called, lets work started under one
+// key notice that it has been switched since
+uint32_t crypto_key_epoch(void);
+
+// Runs the AES routines under the device key, or the component key in use,
+// until crypto_release_device_key puts the key before back. For work between
+// channel frames that is not traffic, e.g. records kept in flash. Not nested
+void crypto_hold_device_key(void);
+void crypto_release_device_key(void);
+#else
+#define crypto_hold_device_key() ((void)0)
+#define crypto_release_device_key() ((void)0)
+#endif
+
+#ifdef KEY_ROTATION
+#ifdef COMPONENT_KEYS
+#error "KEY_ROTATION rotates the device key, component keys would need rotating apart"
+#endif
+// Replaces the device key with new_key, see key_store.h. Before crypto_init
+// it only sets the key crypto_init expands, afterwards the session is expanded
+// again under it and the keystreams made under the old key are dropped.
+// Returns 0 on success.
+int crypto_rekey(const uint8_t new_key[16]);
+#endif
+
+#ifdef COMPONENT_KEYS
+// Expanded component keys kept at once, the least recently used is replaced
+#ifndef COMPONENT_KEY_SLOTS
+#define COMPONENT_KEY_SLOTS 4
+#endif
+
+// Runs the frame routines under the key of the component at I2C address addr,
+// HKDF-SHA256 of the device key (of the ECDH secret with COMPONENT_ENROLL,
+// which needs crypto_enroll first), until switched again. Keys come from a cache of
+// expanded schedules, so switching between components derives nothing. Channel
+// keys derived meanwhile come from the component key. Returns 0 on success.
+int crypto_use_component_key(uint8_t addr);
+
+// Runs the frame routines under the device key again
+void crypto_use_device_key(void);
+#endif
+
+#ifdef COMPONENT_ENROLL
+/*
+   Component enrollment (COMPONENT_ENROLL=1 in project.mk, must match on the
+   AP and every component). The component key is derived from the P-256 ECDH
+   secret of the AP's and the component's key pairs instead of the device
+   key. A component presents its public key in a certificate signed by the
+   deployment: component ID (u32) | public key | ECDSA signature r | s of
+   SHA-256 of the ID and the key. Keys and certificates come from
+   deployment/gen_enroll_keys.py, public keys are X | Y, all big endian.
+*/
+#define ENROLL_PRIV_LEN 32
+#define ENROLL_PUB_LEN 64
+#define ENROLL_SIG_LEN 64
+#define ENROLL_CERT_LEN (4 + ENROLL_PUB_LEN + ENROLL_SIG_LEN)
+// ECDH secret component keys are derived from, what ENROLL_RESUME keeps in flash
+#define ENROLL_SECRET_LEN 32
+// crypto_use_component_key's result for a component that has no key yet,
+// or whose slot was taken by another one since
+#define CRYPTO_ENROLL_NEEDED 1
+
+// Checks that cert was signed by the deployment key ca_pub. Returns 0 if it was
+int crypto_enroll_verify(const uint8_t ca_pub[ENROLL_PUB_LEN], const uint8_t cert[ENROLL_CERT_LEN]);
+
+// Derives the key of the component at I2C address addr from the ECDH secret of
+// our private key and the other end's public key, and selects it as
+// crypto_use_component_key would. Returns 0 on success.
+int crypto_enroll(uint8_t addr, const uint8_t priv[ENROLL_PRIV_LEN], const uint8_t peer_pub[ENROLL_PUB_LEN]);
+
+// The two halves of crypto_enroll. crypto_enroll_secret only runs the ECDH
+// and leaves the selected key alone, crypto_enroll_resume derives and selects
+// the component key from a secret it returned earlier, e.g. one kept in flash.
+// Both return 0 on success.
+int crypto_enroll_secret(const uint8_t priv[ENROLL_PRIV_LEN], const uint8_t peer_pub[ENROLL_PUB_LEN],
+                         uint8_t secret[ENROLL_SECRET_LEN]);
+int crypto_enroll_resume(uint8_t addr, const uint8_t secret[ENROLL_SECRET_LEN]);
+#endif
+
+// Encrypts the content pointed by *in up to len bytes and stores the output in *out. The IV is provided by the caller.
+// Only the IV is loaded per call, the key schedule comes from the crypto session.
+void aes_encrypt(uint8_t *in, uint8_t *out, uint8_t iv[IV_SIZE], size_t len);
+
+// Decrypts the content pointed by *in up to len bytes and stores the output in *out. The IV is provided by the caller.
+// Only the IV is loaded per call, the key schedule comes from the crypto session.
+void aes_decrypt(uint8_t *in, uint8_t *out, uint8_t IV[IV_SIZE], size_t len);
+
+// aes_encrypt and aes_decrypt without the length check, len must be a nonzero
+// multiple of IV_SIZE.
+void aes_encrypt_blocks(uint8_t *in, uint8_t *out, uint8_t iv[IV_SIZE], size_t len);
+void aes_decrypt_blocks(uint8_t *in, uint8_t *out, uint8_t iv[IV_SIZE], size_t len);
+
+// Calls whose length is a compile time constant, the IV_LEN block of the frame
+// IVs and the fixed size records, have the check folded away and go
+// straight to the _blocks entry points. Variable lengths keep the check.
+#define CBC_LEN_VALID(len) ((len) > 0 && (len) % IV_SIZE == 0)
+#define aes_encrypt(in, out, iv, len) \
+    ((__builtin_constant_p(len) && CBC_LEN_VALID(len)) ? aes_encrypt_blocks((in), (out), (iv), (len)) \
+                                                       : aes_encrypt((in), (out), (iv), (len)))
+#define aes_decrypt(in, out, iv, len) \
+    ((__builtin_constant_p(len) && CBC_LEN_VALID(len)) ? aes_decrypt_blocks((in), (out), (iv), (len)) \
+                                                       : aes_decrypt((in), (out), (iv), (len)))
+
+#ifdef MSG_CTR
+// Keystream made ahead of time per IV, enough for the largest frame. Slots in
+// the pool, each holding a fresh IV and its keystream under the key in use.
+#define CTR_KEYSTREAM_LEN 240
+#ifndef CTR_POOL_LEN
+#define CTR_POOL_LEN 2
+#endif
+
+// Encrypts or decrypts len bytes of *in into *out with AES-CTR, any length. The
+// counter starts at iv and counts up big endian per block. Returns 0 on success.
+int aes_ctr_crypt(const uint8_t *in, uint8_t *out, const uint8_t iv[IV_SIZE], size_t len);
+
+// Encrypts len bytes of buf in place with AES-CTR under a fresh IV, written to
+// iv. Takes a keystream from the pool if one is ready, which makes this a XOR,
+// otherwise encrypts on the spot. Returns 0 on success.
+int aes_ctr_seal(uint8_t *buf, size_t len, uint8_t iv[IV_SIZE]);
+
+// Fills one empty pool slot, bounded work meant for idle loops. Returns
+// nonzero if it filled one, 0 if the pool is full or a channel key is in use.
+// Slots made under another key than the one in use count as empty.
+int ctr_pool_fill(void);
+#endif
+
+// Decrypts one 16 byte block with the session key (ECB, no IV). Safe to call
+// from an ISR, used to decrypt CBC frames while they are still arriving.
+int aes_decrypt_block(const uint8_t *in, uint8_t *out);
+
+#if defined(HAVE_AESGCM) || defined(MSG_AEAD_ASCON)
+// Encrypts len bytes of *in into *out with AES-GCM, or Ascon-128 with MSG_AEAD_ASCON, under
+// the caller provided nonce and writes the authentication tag to tag. Returns 0 on success.
+int aead_encrypt(uint8_t *in, uint8_t *out, uint8_t nonce[AEAD_NONCE_LEN], uint8_t tag[AEAD_TAG_LEN], size_t len);
+
+// Decrypts len bytes of *in into *out with the same AEAD and checks tag. Returns 0 only if
+// the tag verifies, the contents of *out must not be used otherwise.
+int aead_decrypt(uint8_t *in, uint8_t *out, uint8_t nonce[AEAD_NONCE_LEN], uint8_t tag[AEAD_TAG_LEN], size_t len);
+#endif
+
+// Computes the SHA-256 hash of the bytes in *in and stores the result in *out.
+void hash(uint8_t *in, uint8_t out[HASH_LEN], size_t len);
+
+// Computes the SHA-256 hashes of count independent buffers, in[i] of len[i] bytes into
+// out[i], with the setup paid once for all of them.
+void hash_many(uint8_t *const in[], uint8_t out[][HASH_LEN], const size_t len[], size_t count);
+
+// Computes the HMAC-SHA256 of the bytes in *in under the device key and stores the
+// result in *out. Returns 0 on success.
+int hmac(uint8_t *in, uint8_t out[HASH_LEN], size_t len);
+
+// Computes the HMAC-SHA256 of the bytes in *in under the k_len byte key *k, for keys
+// the session does not hold. Returns 0 on success.
+int hmac_key(const uint8_t *k, size_t k_len, const uint8_t *in, uint8_t out[HASH_LEN], size_t len);
+
+#ifdef BOOT_BROADCAST
+// Computes the HMAC-SHA256 of the bytes in *in under the key in use (the device key,
+// a component key or the channel key) and stores the result in *out. Returns 0 on success.
+int hmac_active(uint8_t *in, uint8_t out[HASH_LEN], size_t len);
+#endif
+
+#ifdef MSG_MAC
+// Computes the frame MAC of the bytes in *in under the key in use (the device key or
+// the channel key) and stores MAC_LEN bytes in *out. HMAC-SHA256 with the session's
+// precomputed midstates, or AES-CMAC under a MAC key derived from the session key.
+// Returns 0 on success.
+int mac_compute(uint8_t *in, uint8_t out[MAC_LEN], size_t len);
+#endif
+
+#endif
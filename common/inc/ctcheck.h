@@ -0,0 +1,52 @@
+#ifndef CTCHECK_H
+#define CTCHECK_H
+
+/*
+On-target constant-time check, shared between the AP and Component.
+
+`make ctcheck` builds an image with CTCHECK_ENABLE that tests whether the
+secret dependent routines run in constant time, the way dudect does: every
+routine is run many times on inputs of two classes, one fixed and one
+random, interleaved in random order, and Welch's t-test compares the cycle
+counts of the two classes. Each routine is timed with interrupts masked, so
+no sample needs to be cropped. A |t| above CTCHECK_T_LIMIT means the time
+depends on the data and the routine leaks. Every test reports its t value
+over UART, then the image idles.
+
+Only once every routine a check relies on passes here can the random
+time_delay in front of it go.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef CTCHECK_ENABLE
+
+// Measurements per test, split between the two classes
+#ifndef CTCHECK_SAMPLES
+#define CTCHECK_SAMPLES 20000
+#endif
+
+// Largest input of a routine under test
+#define CTCHECK_MAX_INPUT 64
+
+// |t| above which a routine is reported as leaking, in hundredths
+#define CTCHECK_T_LIMIT 450
+
+// Runs the routine under test once on in, which holds its input
+typedef void (*ctcheck_fn_t)(const uint8_t *in);
+
+// Prints one line of the report, ok is 0 for a leaking routine
+typedef void (*ctcheck_print_t)(int ok, const char *text);
+
+// Tests fn on len byte inputs, fixed is the input of the fixed class. Returns
+// 1 if the routine leaks, 0 otherwise
+int ctcheck_test(const char *name, ctcheck_fn_t fn, const uint8_t *fixed, size_t len, ctcheck_print_t print);
+
+// Tests secure_memcmp, the frame check, AES and the HMAC after crypto_init,
+// returns the number of routines that leak
+int ctcheck_run(ctcheck_print_t print);
+
+#endif
+
+#endif
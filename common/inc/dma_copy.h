@@ -0,0 +1,64 @@
+#ifndef DMA_COPY_H
+#define DMA_COPY_H
+
+/*
+Memory to memory copies and fills on a DMA channel (DMA_COPY=1 in
+project.mk), for the frame copies in and out of the component's register
+banks and the bulk buffers of post-boot traffic.
+
+Buffers of at least DMA_COPY_MIN bytes are moved by the channel
+dma_copy_init acquires, shorter ones by the CPU, as are all of them if no
+channel could be had. Word aligned buffers of whole words move a word per
+beat, others a byte. There is one channel, so one transfer at a time:
+starting one waits for the one before. dma_copy_start and dma_fill_start
+return as soon as the channel runs and call cb from the DMA interrupt once
+the bytes have moved (right away for CPU copies), so the core can get on
+with the next frame's crypto meanwhile, e.g. while a secret buffer is being
+wiped. Nothing may touch the buffers of a transfer until it completes, which
+dma_copy_wait waits for. dma_copy and dma_fill are the blocking forms.
+
+Without DMA_COPY they are memcpy and memset.
+
+The corresponding implementations are located in dma_copy.c.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Shorter buffers are cheaper to move with the CPU than to set a channel up for
+#ifndef DMA_COPY_MIN
+#define DMA_COPY_MIN 128
+#endif
+
+// Runs from the DMA interrupt once a transfer has completed
+typedef void (*dma_copy_cb_t)(void *arg);
+
+#ifdef DMA_COPY
+
+// Acquires the channel. Returns 0 on success, copies stay on the CPU
+// otherwise. Call it after the I2C drivers have set up their own channels
+int dma_copy_init(void);
+
+// Starts copying len bytes from src to dst, or setting len bytes of dst to
+// value. cb, if not NULL, gets arg once done
+void dma_copy_start(void *dst, const void *src, size_t len, dma_copy_cb_t cb, void *arg);
+void dma_fill_start(void *dst, uint8_t value, size_t len, dma_copy_cb_t cb, void *arg);
+
+// Sleeps until the last transfer started has completed. Not from interrupts
+void dma_copy_wait(void);
+
+// Blocking copy and fill
+void dma_copy(void *dst, const void *src, size_t len);
+void dma_fill(void *dst, uint8_t value, size_t len);
+
+#else
+
+#define dma_copy_init() (0)
+#define dma_copy_wait() ((void)0)
+#define dma_copy(dst, src, len) ((void)memcpy((dst), (src), (len)))
+#define dma_fill(dst, value, len) ((void)memset((dst), (value), (len)))
+
+#endif
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef FASTCODE_H
+#define FASTCODE_H
+
+/*
+Marks hot functions to run from SRAM when SRAM_FASTCODE=1 is set in project.mk.
+
+FASTCODE puts a function in .fastcode, which firmware.ld places inside .data, so the startup code
+copies it from flash along with the initialized data and it executes with zero wait states. Calls
+between flash and SRAM are too far apart for a direct branch; the linker adds the veneers.
+Without SRAM_FASTCODE it expands to nothing.
+*/
+
+#ifdef SRAM_FASTCODE
+#define FASTCODE __attribute__((section(".fastcode")))
+#else
+#define FASTCODE
+#endif
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef GENERAL_UTIL_H
+#define GENERAL_UTIL_H
+
+/*
+True RNG, secure memcmp, time delay functions
+
+Hard part here is figuring out how to use the chip's built-in TRNG function.
+The docs are linked somewhere in the Discord, and there's example code sitting somewhere in the MSDK
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mxc_device.h"
+#include "nvic_table.h"
+#include "mxc_delay.h"
+#include "trng.h"
+
+// Brings up the TRNG and, with RNG_POOL, seeds the DRBG pool rng_gen draws from.
+void rng_init(void);
+
+// Generates a random 64-bit value from the DRBG pool, or the onboard TRNG
+// generator directly if the pool is disabled or failed to come up.
+uint64_t rng_gen();
+
+#ifdef RNG_POOL
+// Tops the pool up again if anything was drawn from it. Returns nonzero if it
+// did, so it can serve as background work while waiting.
+int rng_pool_fill(void);
+#else
+#define rng_pool_fill() 0
+#endif
+
+// Picks a random number of microseconds between low and high, and puts the chip to sleep
+// for that amount of time
+void time_delay(uint32_t low_us, uint32_t high_us);
+
+#ifdef DELAY_SLEEP
+// One bounded piece of background work for sleep_us, returns nonzero while
+// there is more to do
+typedef int (*sleep_work_t)(void);
+
+// Sets the background work sleep_us runs, NULL for none
+void sleep_set_work(sleep_work_t work);
+
+// Waits us microseconds on a low-power timer instead of spinning. The
+// background work runs first, then the core sleeps until each interrupt,
+// which keep being served throughout.
+void sleep_us(uint32_t us);
+#else
+#define sleep_set_work(work) ((void)0)
+#define sleep_us(us) MXC_Delay(us)
+#endif
+
+// Compare the contents of *a and *b up to len bytes in constant time, any alignment.
+// Return 0 if equal, returns 1 if unequal
+int secure_memcmp(const uint8_t *a, const uint8_t *b, size_t len);
+
+// Zero len bytes at p in a way the compiler cannot drop, even when p is a
+// local about to go out of scope
+void secure_zero(void *p, size_t len);
+
+#endif
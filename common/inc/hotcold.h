@@ -0,0 +1,29 @@
+#ifndef HOTCOLD_H
+#define HOTCOLD_H
+
+/*
+Groups hot and cold code in flash when HOT_COLD=1 is set in project.mk.
+
+HOT puts a function in .text.hot, which firmware.ld places first in .text,
+so the paths a boot or attestation spends its cycles in sit together and
+share ICC lines and prefetches. What is marked follows the trace's totals
+(TRACE=1, "trace" host command on the AP): the frame seal and open, the
+hash, MAC and AES calls and the board link's send and receive. Functions
+that are FASTCODE already run from SRAM and are left unmarked.
+
+COLD is for code that runs once or only when something went wrong, like
+init, the reprovisioning of a corrupted flash and the attempt lockout. It
+goes to .text.cold, placed right after the hot block so none of it lands
+between hot functions, is optimized for size and is never inlined into its
+callers. Without HOT_COLD both expand to nothing.
+*/
+
+#ifdef HOT_COLD
+#define HOT __attribute__((hot, section(".text.hot")))
+#define COLD __attribute__((cold, noinline, section(".text.cold")))
+#else
+#define HOT
+#define COLD
+#endif
+
+#endif
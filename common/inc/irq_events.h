@@ -0,0 +1,46 @@
+#ifndef IRQ_EVENTS_H
+#define IRQ_EVENTS_H
+
+/*
+Interrupt priorities and deferred interrupt events, shared between the AP and
+Component.
+
+Priorities are NVIC levels, lower preempts higher. The link comes first, as a
+late I2C or SPI service stretches or breaks a transfer the other side is
+timing. The host UART's TX ring is next, then the interrupts that only end a
+wait of our own, and the flash controller last. Level 0 is kept free, and with
+AP_RTOS every level here must be at or below
+configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY (checked in ap_rtos.c).
+
+Interrupts do no printing or other slow work. They post an event, which only
+counts it, and the main loop takes the counts when it is idle and reports
+them.
+*/
+
+#include <stdint.h>
+
+#define IRQ_PRIO_LINK 1         // I2C, SPI and the I2C DMA channels
+#define IRQ_PRIO_LINK_TIMER 2   // Component's board link timer
+#define IRQ_PRIO_HOST 3         // Console UART
+#define IRQ_PRIO_DELAY 4        // DELAY_SLEEP timer
+#define IRQ_PRIO_HOST_TICK 4    // HOST_SLEEP idle tick
+#define IRQ_PRIO_TIME 4         // MSG_TIMESYNC clock rollover
+#define IRQ_PRIO_COPY 4         // DMA_COPY channel
+#define IRQ_PRIO_RNG 5          // TRNG
+#define IRQ_PRIO_FLASH 6        // Flash controller
+
+typedef enum {
+    IRQ_EVENT_FLASH_AF,     // Flash access failure
+    IRQ_EVENT_RNG_HEALTH,   // TRNG block failed the RNG_POOL health tests
+    IRQ_EVENT_RNG_RESEED,   // RNG_POOL DRBG refused a background reseed
+    IRQ_EVENT_HOST_RX_FULL, // Host input dropped, the HOST_RX_RING was full
+    IRQ_EVENT_CNT
+} irq_event_t;
+
+// Counts one event, safe from any interrupt
+void irq_event_post(irq_event_t event);
+
+// Returns how many times event was posted since the last take, and clears it
+uint32_t irq_event_take(irq_event_t event);
+
+#endif
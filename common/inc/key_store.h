@@ -0,0 +1,54 @@
+#ifndef KEY_STORE_H
+#define KEY_STORE_H
+
+/*
+Device key store for online key rotation (KEY_ROTATION=1 in project.mk, must
+match on the AP and every component).
+
+The device key and its epoch live in two reserved flash pages, so a rotated
+key survives resets without a rebuild. Both keys of a record are wrapped
+under a pad derived from the deployment key compiled into the image and a
+random salt, and the record is checked by an HMAC under the deployment key.
+Each save goes into the page not holding the newest record, under the next
+sequence number, and the newest one is only superseded once the new one is
+written. An erased page, a torn write or a record someone else changed all
+fail the check, so the device comes back up under the last key that was
+stored, or the deployment key at epoch 0 if there is none.
+
+Components only keep the key they run under. The AP also keeps the key of a
+rotation in progress, until every component has confirmed it.
+*/
+
+#include <stdint.h>
+
+#ifdef KEY_ROTATION
+
+#define KEY_STORE_KEY_LEN 16
+// Flash pages the records alternate between, from the address passed in
+#define KEY_STORE_PAGES 2
+
+typedef struct key_store_t {
+    // Key the device runs under and its epoch, 0 for the deployment key
+    uint32_t epoch;
+    uint8_t key[KEY_STORE_KEY_LEN];
+    // AP only: key of the rotation in progress and its epoch, 0 if there is none
+    uint32_t next_epoch;
+    uint8_t next[KEY_STORE_KEY_LEN];
+} key_store_t;
+
+// Loads the newest record in the KEY_STORE_PAGES flash pages from addr into
+// store. If none validates, store holds the deployment key at epoch 0 and no
+// rotation. Returns 0 if a record validated
+int key_store_load(uint32_t addr, key_store_t *store);
+
+// Writes store under a fresh salt into the page from addr not holding the
+// newest record. Returns 0 on success
+int key_store_save(uint32_t addr, const key_store_t *store);
+
+// What a component answers REKEY with: SHA-256 of a label, epoch and key, so
+// the AP knows the component holds the key without it crossing the bus again
+void key_store_proof(uint32_t epoch, const uint8_t key[KEY_STORE_KEY_LEN], uint8_t out[32]);
+
+#endif
+
+#endif
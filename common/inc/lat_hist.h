@@ -0,0 +1,59 @@
+#ifndef LAT_HIST_H
+#define LAT_HIST_H
+
+/*
+Fixed bucket latency histograms, shared between the AP and Component.
+
+Each histogram counts durations in LAT_HIST_BUCKETS log2 buckets of
+microseconds: bucket 0 takes everything below 2^(LAT_HIST_MIN_LOG2 + 1) us,
+bucket b the durations from 2^(b + LAT_HIST_MIN_LOG2) up to twice that, and
+the last one everything longer. Counts saturate rather than wrap. Every
+histogram is a fixed array of counts, so memory stays the same however long
+the device runs, and a percentile is known to within a factor of two.
+
+The AP keeps one per host command and per link operation (issue_cmd,
+ap_transmit, ap_poll_recv), a component one per command it handles. The
+"stats" host command prints them along with LINK_STATS, fetching the
+components' with the HIST command. Durations are DWT cycles, so
+LAT_HIST=1 in project.mk needs LINK_STATS=1, which brings the tracer.
+Everything compiles out unless it is set.
+*/
+
+#include <stdint.h>
+
+#define LAT_HIST_BUCKETS 20
+#define LAT_HIST_MIN_LOG2 4
+
+typedef struct lat_hist_t {
+    uint16_t counts[LAT_HIST_BUCKETS];
+} lat_hist_t;
+
+#ifdef LAT_HIST
+
+#ifndef LINK_STATS
+#error "LAT_HIST needs LINK_STATS"
+#endif
+
+#include "trace.h"
+
+// Counts the time from start, a trace_cycles value, until now
+void lat_hist_add(lat_hist_t *hist, uint32_t start);
+
+// Samples counted in hist
+uint32_t lat_hist_total(const lat_hist_t *hist);
+
+// Upper bound in us of the bucket pct percent of the samples fall into or
+// below, UINT32_MAX for the last bucket, 0 if hist is empty
+uint32_t lat_hist_percentile(const lat_hist_t *hist, unsigned pct);
+
+#define LAT_START(var) uint32_t var = trace_cycles()
+#define LAT_ADD(hist, var) lat_hist_add((hist), (var))
+
+#else
+
+#define LAT_START(var) ((void)0)
+#define LAT_ADD(hist, var) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef LINK_STATS_H
+#define LINK_STATS_H
+
+/*
+Runtime counters of the link, the crypto and the flash, shared between the AP
+and Component.
+
+Every counter is a plain increment where the event happens, so keeping them
+costs next to nothing. The AP prints its own and every provisioned
+component's on the "stats" host command, fetching the components' with the
+STATS command. Cycle counts come from the DWT tracer, so LINK_STATS=1 in
+project.mk implies TRACE=1. Everything compiles out unless it is set.
+*/
+
+#include <stdint.h>
+
+// Counters since reset. All words, so the STATS reply carries it as is
+typedef struct link_stats_t {
+    uint32_t frames_sent;
+    uint32_t frames_recv;
+    uint32_t auth_failures;     // Frames refused by the hash, MAC or tag check, or malformed
+    uint32_t chal_mismatches;   // Frames that did not answer our last challenge
+    uint32_t retransmits;       // LINK_CRC resends and rereads
+    uint32_t polls;             // Waits for a frame
+    uint32_t poll_loops;        // Poll iterations (AP) or wakeups (component) of all waits
+    uint32_t poll_loops_max;    // Most of them in a single wait
+    uint32_t flash_erases;
+    uint32_t crypto_cycles;     // AES and hash, filled in by link_stats_snapshot
+    uint32_t rng_cycles;
+    uint32_t flash_cycles;      // Flash reads, writes and erases
+    uint32_t replays;           // Frames dropped by MSG_REPLAY_FILTER before decryption
+} link_stats_t;
+
+#ifdef LINK_STATS
+
+extern link_stats_t link_stats;
+
+// Counts one wait for a frame that took loops poll iterations
+void link_stats_poll(uint32_t loops);
+
+// Copies the counters into out, with the cycle counts as of now
+void link_stats_snapshot(link_stats_t *out);
+
+#define STATS_INC(field) (link_stats.field++)
+#define STATS_POLL(loops) link_stats_poll(loops)
+
+#else
+
+#define STATS_INC(field) ((void)0)
+#define STATS_POLL(loops) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,550 @@
+#ifndef MSG_CORE_H
+#define MSG_CORE_H
+
+/*
+  Messaging engine shared by the AP and the components. Seals and opens
+  msg_t frames and runs the challenge-response chain, post-boot channels and
+  message streams. How frames reach the other side is left to a
+  msg_transport_t, see ap_messaging.h and comp_messaging.h for the two ends.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include "crypto_util.h"
+#include "general_util.h"
+
+// Return values, ap_messaging.h and comp_messaging.h give them their own names
+#define MSG_SUCCESS 0
+#define MSG_FAILURE -1
+
+#define HASH_LEN 32
+#define IV_LEN 16
+#define CBC_BLOCK_LEN 16
+
+// rng_chal, rng_resp, opcode and len, sent in front of the used contents
+#define MSG_HEADER_LEN 10
+
+// Length of the largest frame on the bus (MSG_FRAME_LEN in project.mk, must
+// match on the AP and every component). Contents get whatever the header and
+// trailer leave, at most 255 so a frame fits into one I2C message.
+#ifndef MSG_FRAME_LEN
+#define MSG_FRAME_LEN 255
+#endif
+
+#ifdef MSG_REPLAY_FILTER
+// Frames that opened the replay filter remembers (MSG_REPLAY_WINDOW in
+// project.mk), see msg_core.c. Each side keeps its own, so it need not match.
+#ifndef MSG_REPLAY_WINDOW
+#define MSG_REPLAY_WINDOW 16
+#endif
+typedef char msg_replay_window_t[(MSG_REPLAY_WINDOW > 0 && MSG_REPLAY_WINDOW <= UINT8_MAX) ? 1 : -1];
+#endif
+
+#ifdef MSG_AEAD
+/*
+   AEAD framing (MSG_AEAD=1 or ASCON in project.mk, must match on the AP and
+   every component). AES-GCM or Ascon-128 authenticates and encrypts the
+   header and contents in one pass, so the 32 byte hash and 16 byte CBC IV
+   shrink to a 16 byte tag and a 12 byte (GCM) or 16 byte (Ascon) nonce and
+   the freed bytes go to contents.
+   On the wire: header | contents[len] (encrypted) | tag | nonce
+*/
+#define TAG_LEN AEAD_TAG_LEN
+#define NONCE_LEN AEAD_NONCE_LEN
+#define MSG_TRAILER_LEN (TAG_LEN + NONCE_LEN)
+#else
+/*
+   On the wire: header | contents[len] | check | iv
+   The check is the SHA-256 of the header and contents, or with MSG_MAC in
+   project.mk their keyed HMAC-SHA256 (32 bytes) or AES-CMAC (16 bytes, the
+   freed bytes go to contents). Everything up to the iv is encrypted except
+   for the tail of the check that does not fill a whole CBC block. With
+   MSG_CTR in project.mk (needs MSG_MAC) it is AES-CTR instead, counting up
+   from the iv, and the whole check is encrypted.
+*/
+#ifdef MSG_MAC
+#define MSG_CHECK_LEN MAC_LEN
+#else
+#define MSG_CHECK_LEN HASH_LEN
+#endif
+#define MSG_TRAILER_LEN (MSG_CHECK_LEN + IV_LEN)
+#endif
+
+#ifdef MSG_FORMAT_NEGOTIATE
+/*
+   Wire format negotiation (MSG_FORMAT_NEGOTIATE=1 in project.mk), for
+   moving a deployment onto a faster framing one device at a time. Besides
+   the framing it is built with, an image then speaks the original SHA-256
+   + AES-CBC framing, which every image understands. SCAN and VALIDATE
+   always start in it; the component's ID reply carries MSG_WIRE_VERSION
+   and the MSG_FORMAT_* bits it speaks, and the AP frames to that component
+   in its own framing from then on if the component speaks it too. A
+   component tries every frame in the framing of the last one that opened,
+   then in the other, and answers in whichever opened it. The bits are
+   inside an authenticated frame, so they cannot be forged, and the fallback
+   is the framing the deployment ran before. Contents are sized for the
+   longer trailer of the two.
+*/
+#if !defined(MSG_AEAD) && !defined(MSG_MAC)
+#error "MSG_FORMAT_NEGOTIATE needs MSG_AEAD or MSG_MAC, the legacy framing is all there is otherwise"
+#endif
+#ifdef MSG_CTR
+#error "MSG_FORMAT_NEGOTIATE does not cover MSG_CTR, its IVs come from the keystream pool"
+#endif
+#define MSG_WIRE_VERSION 1
+#define MSG_LEGACY_TRAILER_LEN (HASH_LEN + IV_LEN)
+
+// Framings, as advertised
+#define MSG_FORMAT_LEGACY 0x01
+#define MSG_FORMAT_HMAC 0x02
+#define MSG_FORMAT_CMAC 0x04
+#define MSG_FORMAT_GCM 0x08
+#define MSG_FORMAT_ASCON 0x10
+// The one this image is built with
+#if defined(MSG_AEAD_ASCON)
+#define MSG_FORMAT_FAST MSG_FORMAT_ASCON
+#elif defined(MSG_AEAD)
+#define MSG_FORMAT_FAST MSG_FORMAT_GCM
+#elif defined(MSG_MAC_CMAC)
+#define MSG_FORMAT_FAST MSG_FORMAT_CMAC
+#else
+#define MSG_FORMAT_FAST MSG_FORMAT_HMAC
+#endif
+#define MSG_FORMATS (MSG_FORMAT_LEGACY | MSG_FORMAT_FAST)
+
+#define MSG_TRAILER_ROOM \
+    (MSG_LEGACY_TRAILER_LEN > MSG_TRAILER_LEN ? MSG_LEGACY_TRAILER_LEN : MSG_TRAILER_LEN)
+
+// Seals frames in format, MSG_FORMAT_LEGACY or MSG_FORMAT_FAST, from now on.
+// Opening a frame switches to the format it came in
+void msg_use_format(uint8_t format);
+#else
+#define MSG_TRAILER_ROOM MSG_TRAILER_LEN
+#endif
+
+// Smallest and largest frames we will accept off the bus
+#define MAX_CONTENTS_LEN (MSG_FRAME_LEN - MSG_HEADER_LEN - MSG_TRAILER_ROOM)
+#define MIN_MSG_LEN (MSG_HEADER_LEN + MSG_TRAILER_LEN)
+#define MAX_MSG_LEN (MSG_HEADER_LEN + MAX_CONTENTS_LEN + MSG_TRAILER_ROOM)
+
+/* 
+   Plaintext view of a message. Only the header and the first len bytes of
+   contents are sent, followed by the hash / tag and IV / nonce. Not packed:
+   the challenges and contents sit on word boundaries, so MSG_BODY fields
+   are read with aligned loads. msg_seal serializes the header (the first
+   MSG_HEADER_LEN bytes on the wire) and contents into a word aligned frame
+   buffer and msg_open deserializes an opened frame back, so AES and SHA-256
+   always run on aligned frames.
+*/
+typedef struct msg_t {
+    // RNG challenge / response values for cryptographic handshake
+    uint32_t rng_chal;
+    uint32_t rng_resp;
+    // Reusing this field from reference design for simplicity
+    uint8_t opcode;
+    // Number of bytes of contents in use, only these are sent over I2C
+    uint8_t len;
+    // contents are always plaintext once a message has been opened
+    uint8_t contents[MAX_CONTENTS_LEN] __attribute__((aligned(4)));
+} msg_t;
+
+// Opcode of post-boot frames carrying several length prefixed records
+#define MSG_OPCODE_BATCH 0xB0
+// Largest single record, matches the cap on post-boot secure_receive
+#define MSG_RECORD_MAX_LEN 64
+
+// Every frame must hold a batch of one full record, which also covers a
+// post-boot message of MSG_RECORD_MAX_LEN bytes. msg_schema.h checks its bodies
+typedef char msg_frame_len_fits_t[
+    (MSG_FRAME_LEN <= UINT8_MAX &&
+     MAX_CONTENTS_LEN >= 2 + MSG_RECORD_MAX_LEN) ? 1 : -1];
+
+// One record of a batched post-boot message, see msg_pack_records
+typedef struct msg_record_t {
+    uint8_t *buf;
+    uint8_t len;
+} msg_record_t;
+
+#ifdef MSG_CHANNEL
+// Value of rng_resp on post-boot channel frames, tells the two directions apart
+#define MSG_CHANNEL_FROM_AP 0x41500000
+#define MSG_CHANNEL_FROM_COMP 0x434F0000
+
+/*
+   Post-boot secure channel (POST_BOOT_SESSION=1 in project.mk, must match on
+   the AP and every component). Opened from the final challenges of the boot
+   exchange, afterwards every message is a single frame under the derived
+   channel key. rng_chal carries a sequence number that must strictly
+   increase, which replaces the challenge-response handshake. Message streams
+   run over channels as well.
+*/
+typedef struct msg_channel_t {
+    uint8_t key[CHANNEL_KEY_LEN];
+    // Last sequence number sent / accepted
+    uint32_t tx_seq;
+    uint32_t rx_seq;
+    int ready;
+} msg_channel_t;
+#endif
+
+#if defined(MSG_STREAM_LZ) && !defined(MSG_STREAM)
+#error "MSG_STREAM_LZ needs MSG_STREAM"
+#endif
+
+#ifdef MSG_STREAM
+/*
+   Message streams (MSG_STREAM=1 in project.mk, must match on the AP and every
+   component). Carry a byte stream of any length in one direction as channel
+   frames. The AP always opens the stream, on the post-boot channel if there
+   is one, otherwise with a two frame handshake that derives a channel just
+   for the stream. The writer sends up to MSG_STREAM_WINDOW DATA frames before
+   it waits for the reader's ACK, the last frame is a FIN.
+   DATA / FIN contents: offset of the first byte (u32) | data
+   ACK contents: bytes accepted so far (u32)
+*/
+#define MSG_OPCODE_STREAM_OPEN 0xC0
+#define MSG_OPCODE_STREAM_DATA 0xC1
+#define MSG_OPCODE_STREAM_ACK 0xC2
+#define MSG_OPCODE_STREAM_FIN 0xC3
+#define MSG_STREAM_HDR_LEN 4
+#define MSG_STREAM_CHUNK_LEN (MAX_CONTENTS_LEN - MSG_STREAM_HDR_LEN)
+#ifndef MSG_STREAM_WINDOW
+#define MSG_STREAM_WINDOW 4
+#endif
+
+// Direction of a stream, as seen from the AP
+#define MSG_STREAM_AP_READS 0
+#define MSG_STREAM_AP_WRITES 1
+
+#ifdef MSG_STREAM_LZ
+/*
+   Compressed streams (MSG_STREAM_LZ=1 in project.mk, must match on the AP and
+   every component). A direction ORed with MSG_STREAM_COMPRESS, which the
+   OPEN frame carries along, makes the writer gather up to
+   MSG_STREAM_LZ_BLOCK bytes and send each block compressed with msg_lz.h,
+   or as it is if that is no shorter. The blocks travel as stream data,
+   each behind raw_len (u16) | stored_len (u16), and are compressed before
+   they are sealed. Only for data that is neither secret nor chosen by
+   anyone else: how well a frame compresses shows in its length, so mixing
+   the two would let an attacker guess at the secret one frame at a time.
+*/
+#define MSG_STREAM_COMPRESS 0x02
+#define MSG_STREAM_LZ_HDR_LEN 4
+#ifndef MSG_STREAM_LZ_BLOCK
+#define MSG_STREAM_LZ_BLOCK 1024
+#endif
+typedef char msg_stream_lz_block_t[(MSG_STREAM_LZ_BLOCK > 0 && MSG_STREAM_LZ_BLOCK <= 0xFFFF) ? 1 : -1];
+#endif
+
+#ifdef MSG_SCHED
+#ifndef POST_BOOT_SESSION
+#error "MSG_SCHED needs POST_BOOT_SESSION"
+#endif
+// Control frames the AP's link scheduler sends between the chunks of a stream
+// on the same channel. Contents: len (u8) | data
+#define MSG_OPCODE_CONTROL 0xC4
+#endif
+
+typedef struct msg_stream_t {
+    // Channel the frames go over, either a post-boot channel or own
+    msg_channel_t *channel;
+    msg_channel_t own;
+    int writer;
+    // Bytes sent / accepted so far, not counting pending
+    uint32_t offset;
+    // Frames since the last ACK
+    int unacked;
+    // Writer: data waiting for a full chunk. Reader: data not read yet.
+    uint8_t pending[MSG_STREAM_CHUNK_LEN];
+    int pending_len;
+    int pending_pos;
+    // Reader: FIN received
+    int fin;
+#ifdef MSG_SCHED
+    // Reader: optional, gets the control frames that arrive during the stream
+    void (*control)(const uint8_t *data, uint8_t len);
+#endif
+#ifdef MSG_STREAM_LZ
+    // Opened with MSG_STREAM_COMPRESS
+    int compress;
+    // Writer: data not compressed yet. Reader: the last block, decompressed
+    uint8_t block[MSG_STREAM_LZ_BLOCK];
+    int block_len;
+    int block_pos;
+#endif
+} msg_stream_t;
+#endif
+
+#ifdef MSG_JUMBO
+#ifndef POST_BOOT_SESSION
+#error "MSG_JUMBO needs POST_BOOT_SESSION"
+#endif
+/*
+   Jumbo frames (MSG_JUMBO=1 in project.mk, must match on the AP and every
+   component). One channel frame of up to MSG_JUMBO_MAX_LEN bytes, sealed
+   once, one IV / nonce and one hash / tag over all of it, that crosses the
+   bus as consecutive MAX_MSG_LEN packets through the receive banks. The
+   first two bytes on the bus give the length of the sealed frame.
+   Contents: len (u16) | data[len], rng_chal / rng_resp as on any channel frame
+*/
+#define MSG_OPCODE_JUMBO 0xC5
+#define MSG_JUMBO_HDR_LEN 2
+#ifndef MSG_JUMBO_MAX_LEN
+#define MSG_JUMBO_MAX_LEN 2048
+#endif
+#define MSG_JUMBO_WIRE_LEN (MSG_HEADER_LEN + MSG_JUMBO_HDR_LEN + MSG_JUMBO_MAX_LEN + MSG_TRAILER_ROOM)
+#endif
+
+#ifdef MSG_HEARTBEAT
+#ifndef POST_BOOT_SESSION
+#error "MSG_HEARTBEAT needs POST_BOOT_SESSION"
+#endif
+/*
+   Heartbeats (MSG_HEARTBEAT=1 in project.mk, must match on the AP and every
+   component). Every channel frame a component sends already proves it is
+   alive: it authenticates under the channel key and its sequence number is
+   new. Only a channel the AP heard nothing on for a while gets a HEARTBEAT
+   frame, which the component answers with one of its own from inside its
+   next channel receive. Neither ever reaches the post-boot code.
+   Contents: none
+*/
+#define MSG_OPCODE_HEARTBEAT 0xC6
+#endif
+
+#ifdef MSG_TIMESYNC
+#ifndef POST_BOOT_SESSION
+#error "MSG_TIMESYNC needs POST_BOOT_SESSION"
+#endif
+/*
+   Time sync (MSG_TIMESYNC=1 in project.mk, must match on the AP and every
+   component), see time_sync.h. The AP's PING and SET and the component's
+   PONG are answered and taken inside the channel receives and never reach
+   the post-boot code.
+   Contents: msg_timesync_t
+*/
+#define MSG_OPCODE_TIMESYNC 0xC7
+#endif
+
+#ifdef SCAN_LIGHT
+/*
+   Light scans (SCAN_LIGHT=1 in project.mk, must match on the AP and every
+   component). The AP lists components with a bare packet carrying a nonce,
+   drawn once per list, instead of a SCAN frame. The component answers with
+   its ID and a truncated HMAC-SHA256 under the device key over the nonce,
+   its address and its ID, see msg_scan_mac. Both packets are shorter than
+   any frame, so the transport tells them apart before msg_open.
+   Request: MSG_SCAN_TAG | nonce. Reply: component ID (u32) | mac
+*/
+#define MSG_SCAN_TAG 0x5C
+#define MSG_SCAN_NONCE_LEN 8
+#define MSG_SCAN_MAC_LEN 16
+#define MSG_SCAN_REQ_LEN (1 + MSG_SCAN_NONCE_LEN)
+#define MSG_SCAN_REPLY_LEN (4 + MSG_SCAN_MAC_LEN)
+typedef char msg_scan_short_t[(MSG_SCAN_REQ_LEN < MIN_MSG_LEN && MSG_SCAN_REPLY_LEN < MIN_MSG_LEN) ? 1 : -1];
+#endif
+
+// Challenge-response state of one conversation. Lets the AP interleave
+// handshakes with several components, see msg_session_save / msg_session_load.
+typedef struct msg_session_t {
+    // Challenge we sent last, the component must answer with prev_chal + 1
+    uint32_t prev_chal;
+    // Challenge the component sent last, our next message answers it
+    uint32_t peer_chal;
+} msg_session_t;
+
+// Which end of the link the engine runs on
+#define MSG_ROLE_AP 0
+#define MSG_ROLE_COMP 1
+
+// Largest headroom a transport may ask for in front of a frame
+#define MSG_MAX_HEADROOM 4
+
+/*
+   How the engine reaches the other end. peer is whatever the transport uses
+   to pick the other side, the I2C address on the AP and unused on a
+   component. Optional hooks may be NULL.
+*/
+typedef struct msg_transport_t {
+    // Send len bytes of frame after headroom reserved bytes, negative on error
+    int (*send)(uint8_t peer, uint8_t len, uint8_t *frame);
+    // Block until a frame arrives and read it into buf, returns its length or negative
+    int (*recv)(uint8_t peer, uint8_t *buf);
+    // Optional: wait until the peer can take another frame, negative on error
+    int (*wait_free)(uint8_t peer);
+    // Optional: finish CBC decryption of a received frame in place, in place of aes_decrypt
+    void (*decrypt)(uint8_t *wire, uint8_t *iv, int enc_len);
+    // Optional: hand the receive buffer back once a frame has been decrypted
+    void (*release)(void);
+    // Bytes the transport needs in front of every frame it sends
+    uint8_t headroom;
+    // MSG_ROLE_AP or MSG_ROLE_COMP
+    uint8_t role;
+} msg_transport_t;
+
+// The message being built and the message last received
+extern msg_t transmit;
+extern msg_t receive;
+
+// Word aligned buffer received frames are read into and opened from. Transports
+// that poll without blocking read a frame here before calling msg_accept
+extern uint8_t msg_rx_frame[MAX_MSG_LEN];
+
+// Serialize and send the global transmit msg_t as the next message of the
+// challenge-response chain. User must fill in opcode, len and contents before
+// calling. This function will handle encryption, RNG challenge management, and hashing
+int msg_transmit(const msg_transport_t *link, uint8_t peer);
+
+// Draw the challenge and IV / nonce of the next frame now, so sealing it on the
+// critical path needs no RNG. With MSG_CTR its keystream is made here too, so
+// sealing is a XOR. With MSG_NONCE_COUNTER both are counted from values drawn
+// once per boot instead. Meant for idle time, e.g. before waiting for the peer.
+void msg_prepare(void);
+
+// Receive and deserialize the global receive msg_t. Fully handles hash check,
+// RNG challenge check, and decryption. Returns success only if all checks pass.
+// Set first to nonzero if this is the first message in a sequence, so the RNG
+// response value is not checked (need to be able to initiate a chain somehow).
+int msg_recv(const msg_transport_t *link, uint8_t peer, int first);
+
+// Open and check a frame of len bytes the transport already read into
+// msg_rx_frame, for transports that poll without blocking
+int msg_accept(int len, int first);
+
+// Whether the message in receive answers the last challenge we sent. Tells a
+// message continuing the conversation from a new one once it was accepted with
+// first set. Never true before we have sent one
+int msg_answers_prev(void);
+
+// Save the challenge-response state of the current conversation into *session
+void msg_session_save(msg_session_t *session);
+
+// Resume the conversation held in *session, so the next msg_transmit / msg_recv
+// continue its challenge-response chain
+void msg_session_load(const msg_session_t *session);
+
+// Pack as many of the n records as fit into transmit.contents as
+// count | len0 | data0 | len1 | data1 ... and set opcode and len for a batch.
+// Returns the number of records packed, or failure if a record is too long.
+int msg_pack_records(const msg_record_t *records, int n);
+
+// Total length of n fragments, as msg_gather would gather them
+int msg_gather_len(const msg_record_t *frags, int n);
+
+// Gather n fragments, one after another, into transmit.contents as the body
+// of a post-boot message, len | data, and set len. Returns the number of bytes
+// gathered, or failure if they add up to more than MSG_RECORD_MAX_LEN, the
+// most a receiver takes.
+int msg_gather(const msg_record_t *frags, int n);
+
+// Unpack the batch held in receive into at most n records. Every records[i].buf
+// must hold MSG_RECORD_MAX_LEN bytes. Returns the number of records unpacked,
+// or failure if receive does not hold a well formed batch.
+int msg_unpack_records(msg_record_t *records, int n);
+
+#ifdef MSG_CHANNEL
+// Derive a channel from the conversation that just finished. Components keep
+// the channel key loaded from here on, the AP loads it for every frame.
+void msg_channel_derive(const msg_transport_t *link, msg_channel_t *channel);
+
+// Send the global transmit msg_t as a single channel frame. User must fill in
+// opcode, len and contents before calling.
+int msg_channel_transmit(const msg_transport_t *link, msg_channel_t *channel, uint8_t peer);
+
+// Receive a single channel frame into the global receive msg_t. Returns success
+// only if it authenticates under the channel key and its sequence number is new.
+int msg_channel_recv(const msg_transport_t *link, msg_channel_t *channel, uint8_t peer);
+
+// Open and check a channel frame of len bytes the transport already read into
+// msg_rx_frame, for transports that poll without blocking
+int msg_channel_accept(const msg_transport_t *link, msg_channel_t *channel, int len);
+
+// Wipe a channel and go back to the device key
+void msg_channel_close(msg_channel_t *channel);
+#endif
+
+#ifdef MSG_STREAM
+// Send transmit as the next frame of stream, once the peer has taken the previous one
+int msg_stream_send(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer);
+
+// Queue len bytes on a stream this end writes. Full chunks go out right away,
+// the rest waits for more data or msg_stream_close.
+int msg_stream_write(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer, const uint8_t *buf, int len);
+
+// Read up to len bytes from a stream this end reads. Returns the number of
+// bytes read, 0 once the whole stream has been read, failure on error.
+int msg_stream_read(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer, uint8_t *buf, int len);
+
+// Flush a written stream with a FIN and wait until the peer has accepted all
+// of it. Wipes the stream state in every case.
+// Errors abort a stream, close it and open a new one to start over.
+int msg_stream_close(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer);
+#endif
+
+#ifdef MSG_JUMBO
+// Send len bytes of buf, up to MSG_JUMBO_MAX_LEN, as one jumbo frame on channel
+int msg_jumbo_send(const msg_transport_t *link, msg_channel_t *channel, uint8_t peer, const uint8_t *buf, int len);
+
+// Receive one jumbo frame on channel into buf, which holds maxlen bytes.
+// Returns the number of bytes received, or failure if the frame does not
+// authenticate, its sequence number is old or it does not fit buf.
+int msg_jumbo_recv(const msg_transport_t *link, msg_channel_t *channel, uint8_t peer, uint8_t *buf, int maxlen);
+#endif
+
+#ifdef SCAN_LIGHT
+// MAC of the light scan reply of the component with ID id at addr to nonce
+int msg_scan_mac(const uint8_t nonce[MSG_SCAN_NONCE_LEN], uint8_t addr, uint32_t id, uint8_t mac[MSG_SCAN_MAC_LEN]);
+#endif
+
+#ifdef BOOT_BROADCAST
+// Length of a component's tag in the boot release, see msg_release_tag
+#define MSG_RELEASE_TAG_LEN 16
+
+// Tag that releases the component at addr from the boot exchange that just
+// finished, under the key in use. The AP answers the challenge of the
+// component's boot message, a component computes the answer it expects to
+// its own, so a release only ever counts for the boot it was made for.
+int msg_release_tag(const msg_transport_t *link, uint8_t addr, uint8_t tag[MSG_RELEASE_TAG_LEN]);
+#endif
+
+#ifdef ADDR_ASSIGN
+// Length of a component's tag in an address assignment, see msg_assign_tag
+#define MSG_ASSIGN_TAG_LEN 8
+
+// Tag that moves the component with ID id to the bus address addr in the
+// assignment numbered seq, a truncated HMAC-SHA256 under the device key. A
+// component only takes an assignment numbered above the last one it took,
+// so a replayed one is refused until the component resets.
+int msg_assign_tag(uint32_t seq, uint32_t id, uint8_t addr, uint8_t tag[MSG_ASSIGN_TAG_LEN]);
+#endif
+
+#ifdef ATTEST_SEALED
+#ifdef KEY_ROTATION
+#error "ATTEST_SEALED is not available with KEY_ROTATION"
+#endif
+/*
+   Sealed attestation data (ATTEST_SEALED=1 in project.mk, must match on the
+   AP and every component). build_comp.py seals a component's attestation
+   data into ATTEST_BLOB, which the component sends as it is:
+   nonce | data XOR keystream | tag
+   Keystream block j is HMAC-SHA256("ATSK" | id | nonce | j) and the tag is a
+   truncated HMAC-SHA256("ATST" | id | SHA-256(nonce | sealed data)), both
+   under the device key. The nonce is keyed too, so a build only repeats a
+   blob for the same ID and data.
+*/
+#define MSG_ATTEST_NONCE_LEN 16
+#define MSG_ATTEST_TAG_LEN 16
+#define MSG_ATTEST_SEAL_LEN (MSG_ATTEST_NONCE_LEN + MSG_ATTEST_TAG_LEN)
+
+// Check and open the len byte sealed attestation data of the component with
+// ID id in place. Returns the length of the data, which now starts at blob,
+// or MSG_FAILURE
+int msg_attest_open(uint32_t id, uint8_t *blob, int len);
+#endif
+
+// Zero out the global transmit, receive msg_t structs to get confidential data out of 
+// device memory. Certainly not strictly necessary, but can't hurt.
+void reset_msg();
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef MSG_LZ_H
+#define MSG_LZ_H
+
+/*
+Small window LZ77 for compressed message streams (MSG_STREAM_LZ=1 in
+project.mk, see msg_core.h).
+
+Each call works on one block of at most MSG_LZ_MAX_LEN bytes with nothing
+carried over from the last one, so a block decompresses on its own and
+the window is the block itself. The output is a sequence of tokens:
+
+    0lllllll                 literal run, the next l + 1 bytes as they are
+    1mmmmmmm oooooooo oooooooo  copy m + MSG_LZ_MIN_MATCH bytes from
+                             o + 1 bytes back in the output (o little endian)
+
+The compressor finds matches through a table of MSG_LZ_HASH_SIZE last
+positions, one probe per byte, which keeps it to 2 KB of state and a
+bounded amount of work per byte. The decompressor checks every token
+against both buffers, so no input can make it read or write out of
+bounds.
+
+The corresponding implementations are located in msg_lz.c.
+*/
+
+#include <stdint.h>
+
+#define MSG_LZ_MAX_LEN 65534
+#define MSG_LZ_MIN_MATCH 3
+#define MSG_LZ_MAX_MATCH (0x7F + MSG_LZ_MIN_MATCH)
+#define MSG_LZ_MAX_LITERALS 0x80
+#define MSG_LZ_HASH_BITS 10
+#define MSG_LZ_HASH_SIZE (1 << MSG_LZ_HASH_BITS)
+
+// Compresses len bytes of in into out, which has room for cap bytes.
+// Returns the compressed length, or -1 if it would not fit in cap.
+int msg_lz_compress(const uint8_t *in, int len, uint8_t *out, int cap);
+
+// Decompresses len bytes of in into out, which has room for cap bytes.
+// Returns the decompressed length, or -1 if in is malformed or its output
+// would not fit in cap.
+int msg_lz_decompress(const uint8_t *in, int len, uint8_t *out, int cap);
+
+#endif
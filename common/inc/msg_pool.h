@@ -0,0 +1,67 @@
+#ifndef MSG_POOL_H
+#define MSG_POOL_H
+
+/*
+Fixed block buffer pool for post-boot code (MSG_POOL=1 in project.mk).
+
+Two classes of blocks, carved from the .msg_pool section firmware.ld
+reserves after .bss:
+
+    MSG_POOL_FRAME    MSG_POOL_FRAMES blocks of MSG_POOL_FRAME_LEN bytes,
+                      enough for a whole frame as it goes on the bus
+    MSG_POOL_PAYLOAD  MSG_POOL_PAYLOADS blocks of MSG_POOL_PAYLOAD_LEN
+                      bytes, enough for one secure_send / secure_receive
+
+Each class keeps a free list threaded through its free blocks, so both
+msg_pool_alloc and msg_pool_free take a few instructions with interrupts
+masked and are safe from the main loop and from any interrupt alike. A
+block stays with whoever holds it until it is freed, so queues and
+batches can hand buffers along instead of copying them. Nothing is zeroed,
+on allocation or on free, so blocks holding secrets are wiped by their
+owner.
+
+The section is NOLOAD, so the pool costs nothing at boot. Its free lists
+are set up by the first call after a reset.
+
+The corresponding implementations are located in msg_pool.c.
+*/
+
+#include <stdint.h>
+
+#ifdef MSG_POOL
+
+#include "msg_core.h"
+
+#ifndef MSG_POOL_FRAMES
+#define MSG_POOL_FRAMES 4
+#endif
+#ifndef MSG_POOL_PAYLOADS
+#define MSG_POOL_PAYLOADS 8
+#endif
+
+// Block sizes, whole words so every block starts word aligned
+#define MSG_POOL_FRAME_LEN ((MAX_MSG_LEN + 3) & ~3)
+#define MSG_POOL_PAYLOAD_LEN ((MSG_RECORD_MAX_LEN + 3) & ~3)
+
+typedef enum {
+    MSG_POOL_FRAME,
+    MSG_POOL_PAYLOAD,
+    MSG_POOL_CLASSES
+} msg_pool_class_t;
+
+// Takes a free block of cls, NULL if all of them are held
+void *msg_pool_alloc(msg_pool_class_t cls);
+
+// Returns a block taken from either class. 0, or -1 if buf is not the start
+// of a pool block
+int msg_pool_free(void *buf);
+
+// Blocks of cls free right now
+uint32_t msg_pool_available(msg_pool_class_t cls);
+
+// Fewest blocks of cls that were ever free at once since reset
+uint32_t msg_pool_low_water(msg_pool_class_t cls);
+
+#endif
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef MSG_SCHEMA_H
+#define MSG_SCHEMA_H
+
+/*
+  Contents of the frames the AP and the components exchange, shared by both
+  so the two ends cannot disagree on a layout. Every body is a packed struct
+  read and written in place in msg_t.contents through MSG_BODY, and a frame
+  only carries as many contents bytes as its body needs.
+*/
+
+#include <stdint.h>
+#include "msg_core.h"
+#include "link_stats.h"
+#include "lat_hist.h"
+
+/******************************** COMMANDS ********************************/
+// Commands the AP sends components, in msg_t.opcode. X(name) per command,
+// used to generate component_cmd_t and the component's dispatch table.
+#define COMPONENT_CMDS(X) \
+    X(NONE)               \
+    X(SCAN)               \
+    X(VALIDATE)           \
+    X(BOOT)               \
+    X(ATTEST)             \
+    X(STATS)              \
+    X(REKEY)              \
+    X(HIST)
+
+#define COMPONENT_CMD_ENUM(name) COMPONENT_CMD_##name,
+typedef enum {
+    COMPONENT_CMDS(COMPONENT_CMD_ENUM)
+    COMPONENT_CMD_COUNT
+} component_cmd_t;
+#undef COMPONENT_CMD_ENUM
+
+/********************************* BODIES *********************************/
+// msg_boot_t.result that keeps a validated component waiting for the AP's
+// next boot attempt, only sent with VALIDATE_RESUME
+#define BOOT_RESULT_HOLD 2
+
+// Longest boot message, not counting the terminator
+#define MSG_TEXT_LEN 64
+
+/*
+   Attestation data is LOC, DATE and CUST, each as a length byte followed by
+   that many characters, no terminators. The component sends it in slices
+   of at most MSG_ATTEST_SLICE_LEN bytes. While a slice says more follows,
+   the AP answers it with another ATTEST frame to get the next one, so fields
+   longer than one frame holds (ATTEST_FIELD_MAX_LEN in project.mk, must
+   match on the AP and every component) still fit.
+*/
+#define ATTEST_FIELD_COUNT 3
+#ifndef ATTEST_FIELD_MAX_LEN
+#define ATTEST_FIELD_MAX_LEN MSG_TEXT_LEN
+#endif
+#define ATTEST_DATA_LEN (ATTEST_FIELD_COUNT * (1 + ATTEST_FIELD_MAX_LEN))
+// What the component sends of it, sealed with ATTEST_SEALED
+#ifdef ATTEST_SEALED
+#define ATTEST_WIRE_LEN (ATTEST_DATA_LEN + MSG_ATTEST_SEAL_LEN)
+#else
+#define ATTEST_WIRE_LEN ATTEST_DATA_LEN
+#endif
+#define MSG_ATTEST_SLICE_LEN (MAX_CONTENTS_LEN - 1)
+
+#pragma pack(push,1)
+// SCAN reply and the component's reply to the AP's VALIDATE proof
+typedef struct {
+    uint32_t component_id;
+#ifdef MSG_FORMAT_NEGOTIATE
+    // MSG_WIRE_VERSION and MSG_FORMATS of the component, see msg_core.h.
+    // Absent from the replies of components built without it
+    uint8_t wire_version;
+    uint8_t wire_formats;
+#endif
+} msg_id_t;
+
+// BOOT command, the reply echoes it
+typedef struct {
+    uint32_t result;    // 0 to boot, BOOT_RESULT_HOLD to wait, anything else aborts
+} msg_boot_t;
+
+// Reply to a BOOT command that boots the component
+typedef struct {
+    uint32_t result;
+    char message[MSG_TEXT_LEN + 1];
+} msg_boot_reply_t;
+
+// Reply to the AP's ATTEST proof, frames carrying it have len 1 + slice length
+typedef struct {
+    uint8_t more;       // Nonzero if another slice follows
+    uint8_t data[MSG_ATTEST_SLICE_LEN];
+} msg_attest_t;
+
+// Reply to STATS, the component's counters. Components built without
+// LINK_STATS answer it like any unknown command
+typedef link_stats_t msg_stats_t;
+
+// REKEY command, the device key to move to and its epoch, see key_store.h.
+// Components built without KEY_ROTATION answer it like any unknown command
+typedef struct {
+    uint32_t epoch;
+    uint8_t key[16];
+} msg_rekey_t;
+
+// Reply to REKEY, the epoch the component runs under from now on and the
+// proof it holds that epoch's key, see key_store_proof
+typedef struct {
+    uint32_t epoch;
+    uint8_t proof[HASH_LEN];
+} msg_rekey_reply_t;
+
+// HIST command, the opcode whose latency histogram the AP wants.
+// Components built without LAT_HIST answer it like any unknown command
+typedef struct {
+    uint8_t opcode;
+} msg_hist_req_t;
+
+// Reply to HIST, the component's histogram of time spent handling opcode
+typedef struct {
+    uint8_t opcode;
+    uint8_t pad;        // Keeps the counts halfword aligned
+    lat_hist_t hist;
+} msg_hist_t;
+
+// secure_send / secure_receive frames
+typedef struct {
+    uint8_t len;
+    uint8_t data[MAX_CONTENTS_LEN - 1];
+} msg_post_boot_t;
+
+// secure_send_to / secure_receive_from frames, relayed by the AP's
+// secure_relay. peer is the ID of the component the frame goes to on its way
+// to the AP, and of the one it came from on its way out
+typedef struct {
+    uint32_t peer;
+    uint8_t len;
+    uint8_t data[MAX_CONTENTS_LEN - 5];
+} msg_relay_t;
+
+// TIMESYNC frames, see time_sync.h. PING carries only the step. PONG
+// carries the component's receive and send times in a and b. SET carries
+// AP time minus component time in a and the component time it was measured at in b
+typedef struct {
+    uint8_t step;
+    uint64_t a;
+    uint64_t b;
+} msg_timesync_t;
+
+// Body of a frame a component publishes on a topic
+typedef struct msg_publish_t {
+    uint8_t topic;
+    uint8_t len;
+    uint8_t data[MAX_CONTENTS_LEN - 2];
+} msg_publish_t;
+#pragma pack(pop)
+
+#ifdef MSG_RELAY
+#ifndef POST_BOOT_SESSION
+#error "MSG_RELAY needs POST_BOOT_SESSION"
+#endif
+// Opcode of relayed frames, other post-boot frames carry 0
+#define MSG_OPCODE_RELAY 0xD0
+// Most data one relayed frame carries
+#define MSG_RELAY_MAX_LEN (MAX_CONTENTS_LEN - 5)
+#endif
+
+#ifdef MSG_PUBSUB
+#ifndef POST_BOOT_SESSION
+#error "MSG_PUBSUB needs POST_BOOT_SESSION"
+#endif
+// Opcode of published frames
+#define MSG_OPCODE_PUBLISH 0xD1
+// Most data one published frame carries
+#define MSG_PUBLISH_MAX_LEN (MAX_CONTENTS_LEN - 2)
+#endif
+
+// Checked when either end is compiled, a body larger than contents fails here
+typedef char msg_schema_fits_t[
+    (sizeof(msg_boot_reply_t) <= MAX_CONTENTS_LEN &&
+     sizeof(msg_attest_t) <= MAX_CONTENTS_LEN &&
+     sizeof(msg_stats_t) <= MAX_CONTENTS_LEN &&
+     sizeof(msg_rekey_t) <= MAX_CONTENTS_LEN &&
+     sizeof(msg_rekey_reply_t) <= MAX_CONTENTS_LEN &&
+     sizeof(msg_hist_t) <= MAX_CONTENTS_LEN &&
+     ATTEST_FIELD_MAX_LEN <= UINT8_MAX &&
+     sizeof(msg_post_boot_t) <= MAX_CONTENTS_LEN &&
+     sizeof(msg_relay_t) <= MAX_CONTENTS_LEN &&
+     sizeof(msg_publish_t) <= MAX_CONTENTS_LEN &&
+     sizeof(msg_timesync_t) <= MAX_CONTENTS_LEN) ? 1 : -1];
+
+// Body of msg (a msg_t) viewed as type, frames carrying it have len sizeof(type)
+#define MSG_BODY(msg, type) ((type *) (msg).contents)
+
+#endif
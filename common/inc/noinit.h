@@ -0,0 +1,17 @@
+#ifndef NOINIT_H
+#define NOINIT_H
+
+/*
+Keeps large buffers out of the startup code's .bss clear.
+
+NOINIT puts a variable in .noinit, which firmware.ld places after .bss as
+NOLOAD, so it holds whatever was in SRAM at reset and costs nothing to boot.
+Only for buffers that are never read before they are written, like rings
+read back only up to their write index. One that has to start zeroed must
+be wiped on its first use instead. Not for secrets, they would be left in
+SRAM across warm resets.
+*/
+
+#define NOINIT __attribute__((section(".noinit")))
+
+#endif
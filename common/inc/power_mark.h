@@ -0,0 +1,58 @@
+#ifndef POWER_MARK_H
+#define POWER_MARK_H
+
+/*
+Phase markers for an external power analyzer (POWER_MARKERS=1 in project.mk),
+shared between the AP and Component.
+
+Each phase drives its own GPIO pin high while the code is inside it, so the
+analyzer can record the pins on its digital inputs next to the current and
+ectf_tools/power_tool.py can cut its capture into boots, frames and crypto
+calls and add up the energy of each. A phase may be entered again while it
+is already active (a hash inside a MAC, a transmit inside a boot), the pin
+only drops once the outermost one exits. An edge is a single write to the
+port's set or clear register, a few cycles next to the microseconds a
+phase lasts.
+
+The corresponding implementations are located in power_mark.c.
+*/
+
+#include <stdint.h>
+
+// Marked phases, one pin each starting at POWER_MARK_PIN0
+typedef enum {
+    POWER_BOOT,         // AP: attempt_boot, validate and boot of every component
+    POWER_TRANSMIT,     // ap_transmit, comp_transmit_and_ack
+    POWER_RECV,         // AP: ap_poll_recv
+    POWER_CRYPTO,       // The AES and hash trace points
+    POWER_PHASE_CNT,
+} power_phase_t;
+
+#ifdef POWER_MARKERS
+
+// Pins the markers are on, POWER_PHASE_CNT of them from POWER_MARK_PIN0 up
+#ifndef POWER_MARK_PORT
+#define POWER_MARK_PORT MXC_GPIO2
+#endif
+#ifndef POWER_MARK_PIN0
+#define POWER_MARK_PIN0 3
+#endif
+
+// Configures the marker pins as outputs, all low
+void power_mark_init(void);
+
+// Enters phase if on is nonzero, otherwise exits it
+void power_mark(power_phase_t phase, int on);
+
+#define POWER_ENTER(phase) power_mark((phase), 1)
+#define POWER_EXIT(phase) power_mark((phase), 0)
+
+#else
+
+#define power_mark_init() ((void)0)
+#define POWER_ENTER(phase) ((void)0)
+#define POWER_EXIT(phase) ((void)0)
+
+#endif
+
+#endif
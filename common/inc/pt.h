@@ -0,0 +1,113 @@
+#ifndef PT_H
+#define PT_H
+
+/*
+Stackless coroutines (protothreads) for post-boot code (POST_BOOT_PT=1 in
+project.mk).
+
+A protothread is a function that returns whenever it has to wait and picks
+up where it left off the next time it is called: PT_BEGIN switches on the
+line of its last wait, which is all the state it keeps, two bytes in its
+pt_t. Any number of conversations then share the one stack.
+
+    static PT_THREAD(talk(pt_t *pt, void *ctx))
+    {
+        static uint8_t buf[64];
+        static int len;
+        PT_BEGIN(pt);
+        secure_send(addr, hello, sizeof(hello));
+        PT_SECURE_RECEIVE(pt, addr, buf, len);
+        ...
+        PT_END(pt);
+    }
+
+Locals are gone after a wait, keep what has to survive one in statics or in
+ctx. The waits are case labels of PT_BEGIN's switch numbered by __LINE__, so
+there is at most one wait per line and a switch of the thread's own may not
+hold one.
+
+The AP runs a set of threads with pt_run, which sleeps on the ready line
+while all of them wait on a component, see application_processor.c.
+*/
+
+#include <stdint.h>
+
+#ifdef POST_BOOT_PT
+
+typedef struct
+{
+    uint16_t lc; // Line of the last wait, 0 before PT_BEGIN
+} pt_t;
+
+// What a protothread returns
+#define PT_WAITING 0
+#define PT_YIELDED 1
+#define PT_EXITED 2
+#define PT_ENDED 3
+
+#define PT_THREAD(decl) int decl
+
+#define PT_INIT(pt) ((pt)->lc = 0)
+
+#define PT_BEGIN(pt)           \
+    {                          \
+        int pt_yielded = 1;    \
+        (void)pt_yielded;      \
+        switch ((pt)->lc) {    \
+        case 0:
+
+#define PT_END(pt)             \
+        }                      \
+        PT_INIT(pt);           \
+        return PT_ENDED;       \
+    }
+
+// Returns PT_WAITING until cond holds, evaluating it again on every call
+#define PT_WAIT_UNTIL(pt, cond)    \
+    do {                           \
+        (pt)->lc = __LINE__;       \
+    case __LINE__:                 \
+        if (!(cond)) {             \
+            return PT_WAITING;     \
+        }                          \
+    } while (0)
+
+#define PT_WAIT_WHILE(pt, cond) PT_WAIT_UNTIL(pt, !(cond))
+
+// Lets the other threads run once
+#define PT_YIELD(pt)               \
+    do {                           \
+        pt_yielded = 0;            \
+        (pt)->lc = __LINE__;       \
+    case __LINE__:                 \
+        if (!pt_yielded) {         \
+            return PT_YIELDED;     \
+        }                          \
+    } while (0)
+
+// Ends the thread early, pt_run counts it as failed
+#define PT_EXIT(pt)                \
+    do {                           \
+        PT_INIT(pt);               \
+        return PT_EXITED;          \
+    } while (0)
+
+// Runs a child thread until it ends or exits, its result goes to result
+#define PT_SPAWN(pt, child, thread, result)                    \
+    do {                                                       \
+        PT_INIT(child);                                        \
+        PT_WAIT_UNTIL(pt, ((result) = (thread)) >= PT_EXITED); \
+    } while (0)
+
+// A thread as pt_run takes it
+typedef struct
+{
+    pt_t pt;
+    PT_THREAD((*thread)(pt_t *pt, void *ctx));
+    void *ctx;
+    int state; // Last PT_* the thread returned
+} pt_task_t;
+
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef RV_KEYSTREAM_H
+#define RV_KEYSTREAM_H
+
+/*
+MSG_CTR keystreams made on the RISC-V core (RISCV_KEYSTREAM=1 in project.mk).
+
+The MAX78000's RV32 core runs a small program of its own (common/riscv) out of
+the top RV_SRAM_LEN bytes of SRAM, which firmware.ld keeps from the M4. Its
+first RV_MAILBOX_LEN bytes are the mailbox both cores share: the AES_CT key
+schedule the keystreams are made under and RV_KEYSTREAM_SLOTS slots, each
+holding an IV and the keystream it counts up to.
+
+The M4 asks for a keystream by writing a fresh IV into an empty slot and
+marking it REQUESTED. The RISC-V core, which does nothing else, runs the AES
+counter blocks and marks it READY. ctr_pool_fill then only copies a READY
+keystream into the ctr_pool and asks for the next one, so sealing a frame
+never waits on AES and the AES itself runs while the M4 handles the host,
+the link and the post-boot code. Until the RISC-V core is up, or if it never
+comes up, ctr_pool_fill makes the keystreams on the M4 as before.
+
+Only the keystreams move: framing, the frame MAC, the receive side and every
+channel or component key stay on the M4, whose frames are encrypted there on
+the spot as before. A slot belongs to the RISC-V core while it is REQUESTED.
+The M4 changes the key by counting up epoch before writing it, and drops a
+READY keystream whose epoch is not the current one, so one made while the
+key changed under it is never used.
+
+The corresponding implementations are located in rv_keystream.c (M4) and
+common/riscv/rv_main.c (RISC-V).
+*/
+
+#include <stdint.h>
+#include "aes_ct.h"
+
+// Region of the RISC-V core, must match --defsym=__rv_sram_len in project.mk
+// and common/riscv/rv_keystream.ld
+#define RV_SRAM_END 0x20020000
+#define RV_SRAM_LEN 0x4000
+// The simulator's harness (sim/src/sim_rv_keystream.c) puts it in host memory
+#ifndef RV_SRAM_BASE
+#define RV_SRAM_BASE (RV_SRAM_END - RV_SRAM_LEN)
+#endif
+#define RV_MAILBOX_LEN 0x800
+// The RISC-V program is copied here and starts at its first byte
+#define RV_IMAGE_BASE (RV_SRAM_BASE + RV_MAILBOX_LEN)
+#define RV_IMAGE_MAX (RV_SRAM_LEN - RV_MAILBOX_LEN)
+
+// Keystream per slot, the same as CTR_KEYSTREAM_LEN
+#define RV_KEYSTREAM_LEN 240
+#define RV_KEYSTREAM_SLOTS 4
+
+// Written by the RISC-V core once it runs
+#define RV_KEYSTREAM_MAGIC 0x5256434BU
+
+// Slot states
+#define RV_SLOT_EMPTY 0
+#define RV_SLOT_REQUESTED 1
+#define RV_SLOT_READY 2
+
+typedef struct {
+    volatile uint32_t state;
+    uint32_t epoch;             // Key epoch it was requested under
+    uint8_t iv[AES_CT_BLOCK_SIZE];
+    uint8_t keystream[RV_KEYSTREAM_LEN];
+} rv_slot_t;
+
+typedef struct {
+    volatile uint32_t magic;
+    volatile uint32_t epoch;
+    aes_ct_key_t key;
+    rv_slot_t slots[RV_KEYSTREAM_SLOTS];
+} rv_mailbox_t;
+
+typedef char rv_mailbox_fits_t[(sizeof(rv_mailbox_t) <= RV_MAILBOX_LEN) ? 1 : -1];
+
+#define RV_MAILBOX ((rv_mailbox_t *)RV_SRAM_BASE)
+
+#ifndef __riscv
+
+#ifdef RISCV_KEYSTREAM
+#if !defined(MSG_CTR) || !defined(AES_CT)
+#error "RISCV_KEYSTREAM needs MSG_CTR and AES_CT"
+#endif
+
+// Copies the RISC-V program into its SRAM and starts the core
+void rv_keystream_start(void);
+
+// Nonzero once the RISC-V core has come up
+int rv_keystream_running(void);
+
+// Loads key into the mailbox if it is not there yet, takes one READY
+// keystream made under it into iv and keystream, and asks for a new one in
+// every free slot with IVs from draw_iv. Returns 1 if it took a keystream.
+int rv_keystream_take(const aes_ct_key_t *key, void (*draw_iv)(uint8_t iv[AES_CT_BLOCK_SIZE]),
+                      uint8_t iv[AES_CT_BLOCK_SIZE], uint8_t keystream[RV_KEYSTREAM_LEN]);
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef SELFTEST_H
+#define SELFTEST_H
+
+/*
+On-target crypto self test, shared between the AP and Component.
+
+`make selftest` builds an image with SELFTEST_ENABLE that checks every fast
+crypto path the project.mk options switch on before it is trusted in
+production. SHA-256 (the Thumb-2 transform with SHA256_THUMB2) and
+HMAC-SHA256 run against published known answers. AES is checked against
+FIPS-197, and each fast path against wolfCrypt's software AES under the
+same key and data: the session's CBC, single block decryption and CTR as
+built (AES engine, AES_CT, AES_TT, precomputed tables), and AES_CT, AES_TT
+and the engine on their own. Every test reports pass or FAIL and its cycles
+over UART, then the image idles.
+*/
+
+#ifdef SELFTEST_ENABLE
+
+// Prints one line of the report, ok is 0 for a failed test
+typedef void (*selftest_print_t)(int ok, const char *text);
+
+// Runs every test that applies to this build after crypto_init, returns the
+// number that failed
+int selftest_run(selftest_print_t print);
+
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef STACK_PROFILE_H
+#define STACK_PROFILE_H
+
+/*
+Stack and RAM usage profiling, shared between the AP and Component.
+
+`make stack` builds an image with STACK_PROFILE in its own directory. The
+compiler writes the frame size of every function (-fstack-usage), which the
+target collects into build_stack/stack_usage.txt largest first, and the
+linker prints how full each memory region is. At boot the startup code
+paints the main stack with STACK_PAINT, so the deepest point the stack ever
+reached is the lowest word no longer holding the pattern, which the image
+reports over UART as debug messages.
+*/
+
+#include <stdint.h>
+
+// Word the startup code fills the stack with, must match startup_firmware.S
+#define STACK_PAINT 0xC5C5C5C5
+
+#ifdef STACK_PROFILE
+
+// Size of the main stack in bytes
+uint32_t stack_size(void);
+
+// Most bytes of the main stack in use at any point since reset
+uint32_t stack_used(void);
+
+// Bytes of SRAM taken by .data and .bss
+uint32_t stack_static_ram(void);
+
+// Prints the stack high-water mark and the static RAM as debug messages
+void stack_report(void);
+
+#else
+
+#define stack_report() ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+/*
+Shared time base for post-boot data (MSG_TIMESYNC=1 in project.mk, must match
+on the AP and every component).
+
+Each side runs a free-running microsecond clock on a timer clocked from the
+internal 7.3728 MHz oscillator, which CLOCK_SCALING leaves alone, extended
+to 64 bits by its rollover interrupt. The AP's clock is the reference. The
+AP's time_sync exchanges a few TIMESYNC frames with a component over the
+post-boot channel, PTP style:
+
+    AP t1 -- PING --> t2 component
+    AP t4 <-- PONG -- t3 component, carrying t2 and t3
+
+offset = ((t2 - t1) + (t3 - t4)) / 2 is how far the component's clock is
+ahead, assuming both ways take as long, and (t4 - t1) - (t3 - t2) is the
+round trip. The round with the shortest round trip had the least waiting in
+it and wins. Its offset goes back to the component in a SET frame. From two
+SETs at least TIME_SYNC_MIN_SPAN_US apart the component also learns how fast
+its oscillator drifts against the AP's, and keeps extrapolating with it.
+time_sync_now then gives AP time on either side.
+
+The component answers from inside its next channel receive, like
+heartbeats, so neither frame ever reaches the post-boot code.
+
+The corresponding implementations are located in time_sync.c.
+*/
+
+#include <stdint.h>
+
+#ifdef MSG_TIMESYNC
+
+// TIMESYNC frame steps, see msg_timesync_t
+#define TIME_SYNC_PING 0
+#define TIME_SYNC_PONG 1
+#define TIME_SYNC_SET 2
+
+// Shortest time between two SETs the drift is estimated over
+#define TIME_SYNC_MIN_SPAN_US 100000
+
+// Largest drift believed, in parts per billion, the oscillator is good to a few percent
+#define TIME_SYNC_MAX_DRIFT_PPB 50000000
+
+// Starts the clock, call once at startup
+void time_init(void);
+
+// Microseconds on our own clock since time_init
+uint64_t time_local_us(void);
+
+// Our clock in AP time, the AP's own clock on the AP
+uint64_t time_sync_now(void);
+
+// Component: nonzero once it has had a SET
+int time_sync_ready(void);
+
+// Component: takes the AP's offset from a SET, ap_minus_local measured at local time at
+void time_sync_apply(int64_t ap_minus_local, uint64_t at);
+
+// AP: offset of the component's clock against ours and the round trip of one exchange
+int64_t time_sync_offset(uint64_t t1, uint64_t t2, uint64_t t3, uint64_t t4, uint64_t *rtt);
+
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef TINY_PRINTF_H
+#define TINY_PRINTF_H
+
+/*
+Small printf for host output, shared between the AP and Component.
+
+With TINY_PRINTF=1 in project.mk it takes the place of newlib's printf, and
+the AP's host_printf formats with tiny_vsnprintf, so none of newlib's
+formatter is linked in. It handles only what the firmware prints: %d %i %u
+%x %X %c %s %p and %%, the flags - and 0, a field width and a precision,
+either of which may be *, and the length modifiers hh h l ll z. Precision
+and the length modifiers work as in C: the least number of digits for an
+integer, the most characters for %s, and hh and h print the argument as a
+char or short. Nothing is allocated: printf formats into a small stack
+buffer and writes it to the console UART every time it fills, so no line is
+ever cut short.
+
+Not supported: floating point (%f %e %g %a), %o, %n, the flags + space and
+#, the length modifiers j t and L, and %lc %ls. An unsupported conversion is
+printed as it stands, its argument is not taken.
+*/
+
+#include <stdarg.h>
+#include <stddef.h>
+
+// Bytes printf formats before writing them to the UART
+#ifndef TINY_PRINTF_CHUNK
+#define TINY_PRINTF_CHUNK 64
+#endif
+
+// Formats into buf, at most size bytes with the terminating NUL. Returns the
+// length the whole output would have, like vsnprintf
+int tiny_vsnprintf(char *buf, size_t size, const char *fmt, va_list ap);
+
+// tiny_vsnprintf with the arguments inline
+int tiny_snprintf(char *buf, size_t size, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+#endif
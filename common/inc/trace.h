@@ -0,0 +1,90 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+Cycle-accurate tracing of the hot paths, shared between the AP and Component.
+
+Timestamps come from the Cortex-M4 DWT cycle counter and go into a fixed ring
+buffer, so recording a sample costs a handful of cycles and never blocks.
+Everything compiles out unless TRACE=1 is set in project.mk. With
+POWER_MARKERS=1 the AES and hash points also drive the POWER_CRYPTO marker
+pin (see power_mark.h), with or without TRACE.
+*/
+
+#include <stdint.h>
+#include "power_mark.h"
+
+// Size of the sample ring buffer, must be a power of two
+#define TRACE_BUF_LEN 256
+
+// Instrumented code paths
+typedef enum {
+    TRACE_AES_ENCRYPT,
+    TRACE_AES_DECRYPT,
+    TRACE_HASH,
+    TRACE_RNG_GEN,
+    TRACE_SEND_PACKET,
+    TRACE_RECV_PACKET,
+    TRACE_FLASH_READ,
+    TRACE_FLASH_WRITE,
+    TRACE_FLASH_ERASE,
+    TRACE_POINT_CNT,
+} trace_point_t;
+
+// One timestamped sample
+typedef struct trace_sample_t {
+    uint32_t cycles;
+    uint8_t point;
+    uint8_t exit;
+} trace_sample_t;
+
+#ifdef TRACE_ENABLE
+
+// Enables and zeroes the DWT cycle counter, clears the ring buffer
+void trace_init(void);
+
+// Records the current cycle count for point. exit is 0 on entry, 1 on exit
+void trace_record(trace_point_t point, int exit);
+
+// Prints every sample still in the ring buffer as a debug message, oldest
+// first, then clears the buffer
+void trace_dump(void);
+
+// Current value of the cycle counter
+uint32_t trace_cycles(void);
+
+// Cycles spent between entry and exit of the AES and hash points since
+// trace_init, wraps like the cycle counter
+uint32_t trace_crypto_cycles(void);
+
+// Cycles spent between entry and exit of point since trace_init
+uint32_t trace_point_cycles(trace_point_t point);
+
+#ifdef SLOW_CAPTURE
+// Stops (frozen nonzero) or resumes adding samples to the ring buffer, the
+// cycles spent in every point are still counted. AP only, see SLOW_CAPTURE
+void trace_freeze(int frozen);
+#endif
+
+#define TRACE_RECORD(point, exit) trace_record((point), (exit))
+
+#else
+
+#define trace_init() ((void)0)
+#define trace_dump() ((void)0)
+#define TRACE_RECORD(point, exit) ((void)0)
+
+#endif
+
+#ifdef POWER_MARKERS
+// point is a constant at every call, so this folds to the mark or to nothing
+#define TRACE_POWER(point, on) \
+    ((point) <= TRACE_HASH ? power_mark(POWER_CRYPTO, (on)) : (void)0)
+#else
+#define TRACE_POWER(point, on) ((void)0)
+#endif
+
+#define TRACE_ENTER(point) (TRACE_RECORD((point), 0), TRACE_POWER((point), 1))
+#define TRACE_EXIT(point) (TRACE_RECORD((point), 1), TRACE_POWER((point), 0))
+
+#endif
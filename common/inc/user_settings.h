@@ -0,0 +1,89 @@
+#ifndef USER_SETTINGS_H
+#define USER_SETTINGS_H
+
+/*
+wolfSSL build profile for both firmware images, pulled in by wolfssl/wolfcrypt/settings.h
+when WOLFSSL_USER_SETTINGS is defined (see the Makefiles).
+
+The firmware only uses AES-128 (CBC, direct and optionally GCM), SHA-256, HMAC-SHA256,
+the Hash_DRBG and, with COMPONENT_ENROLL, P-256, so everything else is turned off. Feature
+flags that depend on project.mk options (HAVE_AESGCM, GCM_TABLE, GCM_TABLE_4BIT, WOLFSSL_CMAC,
+HAVE_ECC, WC_RNG_SEED_CB, WOLF_CRYPTO_CB, WOLFSSL_MAX78000_AES) are still set there.
+*/
+
+// Platform, bare metal with no OS, sockets or files
+#define SINGLE_THREADED
+#define NO_FILESYSTEM
+#define NO_WOLFSSL_DIR
+#define NO_WRITEV
+#define WOLFSSL_USER_IO
+#define WOLFSSL_NO_SOCK
+#define TIME_T_NOT_64BIT
+#define NO_ASN_TIME
+#define NO_ERROR_STRINGS
+
+// wolfCrypt only, no TLS stack
+#define WOLFCRYPT_ONLY
+#define NO_TLS
+#define NO_OLD_TLS
+
+// Symmetric crypto we use
+#define WOLFSSL_AES_DIRECT
+#define WOLFSSL_AES_128
+#define NO_AES_192
+#define NO_AES_256
+#define HAVE_AES_CBC
+#define HAVE_HASHDRBG
+
+// Everything else
+#define NO_RSA
+#define NO_DH
+#define NO_DSA
+#define NO_DES3
+#define NO_RC4
+#define NO_MD4
+#define NO_MD5
+#define NO_SHA
+#define NO_PWDBASED
+#define NO_CODING
+#define NO_ASN
+#define NO_CERTS
+#define NO_SIG_WRAPPER
+#define NO_PSK
+#define NO_SESSION_CACHE
+#define WOLFSSL_NO_SHAKE128
+#define WOLFSSL_NO_SHAKE256
+
+// SHA-256 blocks through the Cortex-M4 assembly in common/src/sha256_thumb2.S
+// instead of wolfCrypt's C transform (SHA256_THUMB2=1 in project.mk). Only
+// the generic sha256.c path calls XTRANSFORM, always on a word aligned block
+#ifdef WOLFSSL_SHA256_THUMB2
+int sha256_thumb2_transform(unsigned int *digest, const unsigned int *block);
+#define XTRANSFORM(S, D) sha256_thumb2_transform((S)->digest, (const unsigned int *)(D))
+#endif
+
+// P-256 for component enrollment (COMPONENT_ENROLL in project.mk, which sets
+// HAVE_ECC) on wolfSSL's single precision math only. The firmware adds
+// WOLFSSL_SP_ARM_CORTEX_M_ASM for the Cortex-M assembly in sp_cortexm.c, the
+// simulator runs the portable sp_c32.c / sp_c64.c. Certificates are raw r | s
+// read through the mp_ API, as there is no ASN.1
+#ifdef HAVE_ECC
+#define ECC_USER_CURVES
+#define WOLFSSL_HAVE_SP_ECC
+#define WOLFSSL_SP_MATH
+#define WOLFSSL_SP_NO_MALLOC
+#define WOLFSSL_PUBLIC_MP
+#define ECC_TIMING_RESISTANT
+#define NO_ECC_SIGN
+#endif
+
+// Fixed pools instead of malloc, see crypto_heap in crypto_util.c. Buckets fit
+// the Hash_DRBG state and the small scratch buffers AES-GCM and the DRBG take
+#ifdef CRYPTO_STATIC_MEMORY
+#define WOLFSSL_STATIC_MEMORY
+#define WOLFSSL_NO_MALLOC
+#define WOLFMEM_BUCKETS 16,32,64,96,128,160,256,512,1024
+#define WOLFMEM_DIST 4,4,4,2,2,2,1,1,0
+#endif
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * @file rv_main.c
+ * @brief RISC-V program making MSG_CTR keystreams for the M4
+ * @date 2024
+ *
+ * Runs on the MAX78000's RV32 core with RISCV_KEYSTREAM=1, see
+ * rv_keystream.h. Built with aes_ct.c and nothing else by
+ * ../riscv_keystream.mk; it touches no peripheral and takes no interrupt,
+ * only the mailbox.
+ */
+
+#include "rv_keystream.h"
+
+#include <string.h>
+
+/**
+ * @brief Runs the counter blocks of one slot.
+ *
+ * The counter starts at the slot's IV and counts up big endian, as
+ * aes_ctr_crypt does on the M4.
+ *
+ * @param mb Mailbox holding the key.
+ * @param slot Slot to fill.
+ */
+static void rv_fill(rv_mailbox_t *mb, rv_slot_t *slot)
+{
+    uint8_t ctr[AES_CT_BLOCK_SIZE];
+    memcpy(ctr, slot->iv, AES_CT_BLOCK_SIZE);
+    for (unsigned pos = 0; pos < RV_KEYSTREAM_LEN; pos += AES_CT_BLOCK_SIZE) {
+        aes_ct_encrypt_block(&mb->key, ctr, slot->keystream + pos);
+        for (int i = AES_CT_BLOCK_SIZE - 1; i >= 0; i--) {
+            if (++ctr[i] != 0) {
+                break;
+            }
+        }
+    }
+    memset(ctr, 0, sizeof(ctr));
+}
+
+/**
+ * @brief Serves the mailbox forever.
+ *
+ * Polls the slots in turn, there is nothing else for the core to do.
+ */
+int main(void)
+{
+    rv_mailbox_t *mb = RV_MAILBOX;
+    mb->magic = RV_KEYSTREAM_MAGIC;
+
+    while (1) {
+        for (unsigned i = 0; i < RV_KEYSTREAM_SLOTS; i++) {
+            rv_slot_t *slot = &mb->slots[i];
+            if (slot->state != RV_SLOT_REQUESTED) {
+                continue;
+            }
+            __sync_synchronize();
+            rv_fill(mb, slot);
+            __sync_synchronize();
+            slot->state = RV_SLOT_READY;
+        }
+    }
+}
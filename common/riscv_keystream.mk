@@ -0,0 +1,62 @@
+# Builds the RISC-V keystream program (RISCV_KEYSTREAM=1, see
+# inc/rv_keystream.h) and wraps it into an object the M4 image links.
+#
+# Called by the application_processor and component Makefiles. The program
+# is riscv/rv_main.c and src/aes_ct.c, freestanding, linked to run from the
+# RISC-V SRAM by riscv/rv_keystream.ld. Its flat binary becomes
+# rv_keystream_image.o with _binary_rv_keystream_bin_start/_end, which
+# rv_keystream_start copies into place.
+#
+#   make -f riscv_keystream.mk image BUILD_DIR=... OBJCOPY=...
+
+COMMON_DIR := $(patsubst %/,%,$(dir $(lastword $(MAKEFILE_LIST))))
+
+# The MSDK's own RISC-V toolchain is riscv-none-elf-, shell.nix brings riscv32-none-elf-
+RV_CROSS ?= riscv32-none-elf-
+RV_CC = $(RV_CROSS)gcc
+RV_OBJCOPY = $(RV_CROSS)objcopy
+RV_ARCH ?= -march=rv32imc_zicsr -mabi=ilp32
+
+RV_CFLAGS = $(RV_ARCH) -Os -ffreestanding -ffunction-sections -fdata-sections \
+	-msmall-data-limit=0 -Wall -I$(COMMON_DIR)/inc
+RV_LDFLAGS = $(RV_ARCH) -nostartfiles -Wl,--gc-sections -Wl,--no-relax \
+	-T $(COMMON_DIR)/riscv/rv_keystream.ld
+
+RV_OBJS = $(BUILD_DIR)/rv_start.o $(BUILD_DIR)/rv_main.o $(BUILD_DIR)/aes_ct.o
+
+ifeq "$(BUILD_DIR)" ""
+$(error BUILD_DIR must be set)
+endif
+
+.PHONY: image clean
+
+image: $(BUILD_DIR)/rv_keystream_image.o
+
+$(BUILD_DIR)/rv_start.o: $(COMMON_DIR)/riscv/rv_start.S
+	@mkdir -p $(@D)
+	$(RV_CC) $(RV_ARCH) -c $< -o $@
+
+$(BUILD_DIR)/rv_main.o: $(COMMON_DIR)/riscv/rv_main.c
+	@mkdir -p $(@D)
+	$(RV_CC) $(RV_CFLAGS) -MMD -MP -c $< -o $@
+
+$(BUILD_DIR)/aes_ct.o: $(COMMON_DIR)/src/aes_ct.c
+	@mkdir -p $(@D)
+	$(RV_CC) $(RV_CFLAGS) -MMD -MP -c $< -o $@
+
+$(BUILD_DIR)/rv_keystream.elf: $(RV_OBJS) $(COMMON_DIR)/riscv/rv_keystream.ld
+	$(RV_CC) $(RV_LDFLAGS) $(RV_OBJS) -lc -lgcc -o $@
+
+$(BUILD_DIR)/rv_keystream.bin: $(BUILD_DIR)/rv_keystream.elf
+	$(RV_OBJCOPY) -O binary $< $@
+
+# Run from the build directory, so the symbols are named after the file only
+$(BUILD_DIR)/rv_keystream_image.o: $(BUILD_DIR)/rv_keystream.bin
+	cd $(BUILD_DIR) && $(OBJCOPY) -I binary -O elf32-littlearm -B arm \
+		--rename-section .data=.rodata.rv_keystream,alloc,load,readonly,data,contents \
+		rv_keystream.bin rv_keystream_image.o
+
+clean:
+	rm -rf $(BUILD_DIR)
+
+-include $(RV_OBJS:.o=.d)
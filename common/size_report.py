@@ -0,0 +1,183 @@
+# @file size_report.py
+# @brief Section sizes of a firmware image per object, checked against the flash budget
+# @date 2024
+#
+# Reads the linker map of an image and breaks .text, .rodata, .data and .bss
+# down per object file. wolfCrypt modules are listed one by one, objects from
+# the other libraries are summed per archive. Every row is diffed against a
+# saved baseline when there is one.
+#
+# The image is the .bin package_binary pads to APP_PAGES * PAGE_SIZE bytes
+# (ectf_tools/utils.py). The report fails when it leaves less than the margin
+# of that budget free. Only uses the standard library.
+#
+# Usage: python3 size_report.py MAP BIN [--baseline FILE] [--save FILE]
+#                               [--pages N] [--page-size N] [--margin PERCENT]
+
+import argparse
+import json
+import os
+import re
+import sys
+
+# Must match ectf_tools/utils.py
+APP_PAGES = 28
+PAGE_SIZE = 8192
+
+KINDS = ("text", "rodata", "data", "bss")
+
+# Input section name prefixes, by what they cost. Anything else (debug info,
+# the ROM vectors, the COPY stack and heap) is not part of the image
+PREFIXES = (
+    (".rodata", "rodata"),
+    (".text", "text"),
+    (".isr_vector", "text"),
+    (".firmware_startup", "text"),
+    (".fastcode", "text"),
+    (".flashprog", "text"),
+    (".flash_code_section", "text"),
+    (".sram_code_section", "text"),
+    (".ARM.exidx", "text"),
+    (".ARM.extab", "text"),
+    (".init", "text"),
+    (".fini", "text"),
+    (".eh_frame", "text"),
+    (".data", "data"),
+    (".preinit_array", "data"),
+    (".init_array", "data"),
+    (".fini_array", "data"),
+    (".bss", "bss"),
+    ("COMMON", "bss"),
+    (".shared", "bss"),
+    (".mailbox", "bss"),
+    (".retained", "bss"),
+    (".crypto_heap", "bss"),
+)
+
+FULL_LINE = re.compile(r"^ (\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$")
+NAME_LINE = re.compile(r"^ (\S+)$")
+REST_LINE = re.compile(r"^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$")
+ARCHIVE = re.compile(r"^(.*?([^/]+)\.a)\((.+)\)$")
+
+
+def kind_of(section):
+    for prefix, kind in PREFIXES:
+        if section.startswith(prefix):
+            return kind
+    return None
+
+
+def module_of(path):
+    """Row an input file is counted under"""
+    match = ARCHIVE.match(path)
+    if not match:
+        return os.path.basename(path)
+    lib, member = match.group(2), match.group(3)
+    if "wolfcrypt" in lib:
+        return "wolfcrypt/" + member
+    return lib + ".a"
+
+
+def parse_map(path):
+    """Bytes of every kind per module, from the memory map part of a GNU ld map"""
+    sizes = {}
+    with open(path) as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        if line.startswith("Linker script and memory map"):
+            break
+
+    pending = None
+    for line in lines:
+        section = size = source = None
+        full = FULL_LINE.match(line)
+        if full:
+            section, size, source = full.group(1), full.group(3), full.group(4)
+        elif pending:
+            rest = REST_LINE.match(line)
+            if rest:
+                section, size, source = pending, rest.group(2), rest.group(3)
+        name = NAME_LINE.match(line)
+        pending = name.group(1) if name else None
+        if section is None or section.startswith("*"):
+            continue
+
+        kind = kind_of(section)
+        size = int(size, 16)
+        if kind is None or size == 0:
+            continue
+        row = sizes.setdefault(module_of(source.strip()), dict.fromkeys(KINDS, 0))
+        row[kind] += size
+    return sizes
+
+
+def delta(now, then):
+    if then is None or now == then:
+        return ""
+    return "%+d" % (now - then)
+
+
+def print_table(sizes, base):
+    header = "%-40s" % "module" + "".join("%10s %7s" % (k, "") for k in KINDS)
+    print(header)
+    rows = sorted(sizes, key=lambda m: -sum(sizes[m].values()))
+    gone = sorted(set(base) - set(sizes))
+    for module in rows + gone:
+        now = sizes.get(module, dict.fromkeys(KINDS, 0))
+        then = base.get(module, dict.fromkeys(KINDS, 0)) if base else None
+        cols = "".join("%10d %7s" % (now[k], delta(now[k], then and then[k]))
+                       for k in KINDS)
+        print("%-40s%s" % (module, cols))
+
+    total = {k: sum(row[k] for row in sizes.values()) for k in KINDS}
+    then = None
+    if base:
+        then = {k: sum(row[k] for row in base.values()) for k in KINDS}
+    cols = "".join("%10d %7s" % (total[k], delta(total[k], then and then[k]))
+                   for k in KINDS)
+    print("%-40s%s" % ("total", cols))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Per object section sizes of a firmware image")
+    parser.add_argument("map")
+    parser.add_argument("bin")
+    parser.add_argument("--baseline", help="Baseline to diff against, if it exists")
+    parser.add_argument("--save", help="Write this report as the new baseline")
+    parser.add_argument("--pages", type=int, default=APP_PAGES)
+    parser.add_argument("--page-size", type=int, default=PAGE_SIZE)
+    parser.add_argument("--margin", type=float, default=5,
+                        help="Percent of the budget that must stay free")
+    args = parser.parse_args()
+
+    sizes = parse_map(args.map)
+    image = os.path.getsize(args.bin)
+
+    base = {}
+    base_image = None
+    if args.baseline and os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            saved = json.load(f)
+        base, base_image = saved["modules"], saved["image"]
+
+    print_table(sizes, base)
+
+    budget = args.pages * args.page_size
+    limit = int(budget * (100 - args.margin) / 100)
+    print()
+    change = delta(image, base_image)
+    print("image %d bytes%s of %d (%.1f%%), limit %d with a %g%% margin" %
+          (image, " (%s)" % change if change else "", budget,
+           100.0 * image / budget, limit, args.margin))
+
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump({"image": image, "modules": sizes}, f, indent=1, sort_keys=True)
+        print("saved baseline %s" % args.save)
+
+    if image > limit:
+        sys.exit("image is %d bytes over the limit" % (image - limit))
+
+
+if __name__ == "__main__":
+    main()
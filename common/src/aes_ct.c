@@ -0,0 +1,559 @@
+/**
+ * @file aes_ct.c
+ * @brief Bitsliced constant-time AES-128
+ * @date 2024
+ *
+ * Two blocks are processed at once. After ortho, word q[i] holds bit i of
+ * every state byte, byte (row, col) of block blk sitting at bit
+ * 8 * row + 4 * blk + col. Rows then line up with the byte lanes of a word,
+ * so MixColumns is word rotations and ShiftRows rotates nibbles within a lane.
+ */
+
+#include "aes_ct.h"
+#include "fastcode.h"
+
+#include <string.h>
+
+static uint32_t dec32le(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void enc32le(uint8_t *p, uint32_t x)
+{
+    p[0] = (uint8_t)x;
+    p[1] = (uint8_t)(x >> 8);
+    p[2] = (uint8_t)(x >> 16);
+    p[3] = (uint8_t)(x >> 24);
+}
+
+static uint32_t rotr(uint32_t x, int n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+#define SWAPMOVE(a, b, mask, n)                      \
+    do {                                             \
+        uint32_t t_ = (((a) >> (n)) ^ (b)) & (mask); \
+        (b) ^= t_;                                   \
+        (a) ^= t_ << (n);                            \
+    } while (0)
+
+/**
+ * @brief Transposes eight words between byte order and bitsliced order.
+ *
+ * Transposes each 8x8 bit block, so it is its own inverse.
+ *
+ * @param q Eight words, two blocks in little endian order or eight slices.
+ */
+static void ortho(uint32_t *q)
+{
+    SWAPMOVE(q[0], q[1], 0x55555555, 1);
+    SWAPMOVE(q[2], q[3], 0x55555555, 1);
+    SWAPMOVE(q[4], q[5], 0x55555555, 1);
+    SWAPMOVE(q[6], q[7], 0x55555555, 1);
+
+    SWAPMOVE(q[0], q[2], 0x33333333, 2);
+    SWAPMOVE(q[1], q[3], 0x33333333, 2);
+    SWAPMOVE(q[4], q[6], 0x33333333, 2);
+    SWAPMOVE(q[5], q[7], 0x33333333, 2);
+
+    SWAPMOVE(q[0], q[4], 0x0F0F0F0F, 4);
+    SWAPMOVE(q[1], q[5], 0x0F0F0F0F, 4);
+    SWAPMOVE(q[2], q[6], 0x0F0F0F0F, 4);
+    SWAPMOVE(q[3], q[7], 0x0F0F0F0F, 4);
+}
+
+/**
+ * @brief Applies the AES S-box to every byte of the bitsliced state.
+ *
+ * Boyar and Peralta's 113 gate circuit: a linear layer, the GF(2^8)
+ * inversion and the output linear layer with the affine constant folded in.
+ *
+ * @param q Eight slices.
+ */
+FASTCODE static void sub_bytes(uint32_t *q)
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    // Top linear transformation
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    // Non-linear section
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    // Bottom linear transformation
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/**
+ * @brief Applies the inverse affine map of the S-box to every byte.
+ *
+ * Used on both sides of sub_bytes to get the inverse S-box, since
+ * InvSubBytes(x) = A^-1(SubBytes(A^-1(x))) where A^-1 includes the 0x63.
+ *
+ * @param q Eight slices.
+ */
+static void inv_affine(uint32_t *q)
+{
+    uint32_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+static void inv_sub_bytes(uint32_t *q)
+{
+    inv_affine(q);
+    sub_bytes(q);
+    inv_affine(q);
+}
+
+// Row r of each block rotates its four columns left by r
+static void shift_rows(uint32_t *q)
+{
+    for (int i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+        q[i] = (x & 0x000000FF)
+             | ((x >> 1) & 0x00007700) | ((x << 3) & 0x00008800)
+             | ((x >> 2) & 0x00330000) | ((x << 2) & 0x00CC0000)
+             | ((x >> 3) & 0x11000000) | ((x << 1) & 0xEE000000);
+    }
+}
+
+static void inv_shift_rows(uint32_t *q)
+{
+    for (int i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+        q[i] = (x & 0x000000FF)
+             | ((x >> 3) & 0x00001100) | ((x << 1) & 0x0000EE00)
+             | ((x >> 2) & 0x00330000) | ((x << 2) & 0x00CC0000)
+             | ((x >> 1) & 0x77000000) | ((x << 3) & 0x88000000);
+    }
+}
+
+/**
+ * @brief Multiplies every byte of the state by x in GF(2^8).
+ *
+ * @param q Eight slices, updated in place.
+ */
+static void xtime(uint32_t *q)
+{
+    uint32_t hi = q[7];
+
+    q[7] = q[6];
+    q[6] = q[5];
+    q[5] = q[4];
+    q[4] = q[3] ^ hi;
+    q[3] = q[2] ^ hi;
+    q[2] = q[1];
+    q[1] = q[0] ^ hi;
+    q[0] = hi;
+}
+
+// out[r] = 2 * a[r] ^ 3 * a[r + 1] ^ a[r + 2] ^ a[r + 3], rotating by 8 bits steps one row
+static void mix_columns(uint32_t *q)
+{
+    uint32_t r1[8], t[8];
+
+    for (int i = 0; i < 8; i++) {
+        r1[i] = rotr(q[i], 8);
+        t[i] = q[i] ^ r1[i];
+    }
+    for (int i = 0; i < 8; i++) {
+        q[i] = r1[i] ^ rotr(t[i], 16);
+    }
+    xtime(t);
+    for (int i = 0; i < 8; i++) {
+        q[i] ^= t[i];
+    }
+}
+
+// InvMixColumns is MixColumns after a[r] ^= 4 * (a[r] ^ a[r + 2])
+static void inv_mix_columns(uint32_t *q)
+{
+    uint32_t t[8];
+
+    for (int i = 0; i < 8; i++) {
+        t[i] = q[i] ^ rotr(q[i], 16);
+    }
+    xtime(t);
+    xtime(t);
+    for (int i = 0; i < 8; i++) {
+        q[i] ^= t[i];
+    }
+    mix_columns(q);
+}
+
+static void add_round_key(uint32_t *q, const uint32_t *sk)
+{
+    for (int i = 0; i < 8; i++) {
+        q[i] ^= sk[i];
+    }
+}
+
+/**
+ * @brief Runs the S-box over the four bytes of a word, for the key schedule.
+ *
+ * @param x Four bytes in little endian order.
+ *
+ * @return The substituted word.
+ */
+static uint32_t sub_word(uint32_t x)
+{
+    uint32_t q[8] = { x };
+
+    ortho(q);
+    sub_bytes(q);
+    ortho(q);
+    return q[0];
+}
+
+/**
+ * @brief Expands a key into bitsliced round keys.
+ *
+ * The schedule itself also goes through the S-box circuit, so setting the key
+ * leaks nothing through timing either. Each round key is duplicated into both
+ * block halves before being sliced.
+ *
+ * @param ks Key schedule to fill.
+ * @param key 16 byte AES key.
+ */
+void aes_ct_setkey(aes_ct_key_t *ks, const uint8_t key[16])
+{
+    uint32_t w[4 * (AES_CT_ROUNDS + 1)];
+    uint32_t rcon = 1;
+
+    for (int i = 0; i < 4; i++) {
+        w[i] = dec32le(key + 4 * i);
+    }
+    for (int i = 4; i < 4 * (AES_CT_ROUNDS + 1); i++) {
+        uint32_t tmp = w[i - 1];
+        if (i % 4 == 0) {
+            tmp = sub_word(rotr(tmp, 8)) ^ rcon;
+            rcon = (rcon << 1) ^ (0x11B & -(rcon >> 7));
+        }
+        w[i] = w[i - 4] ^ tmp;
+    }
+
+    for (int r = 0; r <= AES_CT_ROUNDS; r++) {
+        uint32_t *sk = ks->sk + 8 * r;
+        for (int i = 0; i < 4; i++) {
+            sk[i] = sk[i + 4] = w[4 * r + i];
+        }
+        ortho(sk);
+    }
+
+    memset(w, 0, sizeof(w));
+}
+
+/**
+ * @brief Wipes an expanded key schedule.
+ *
+ * @param ks Key schedule to clear.
+ */
+void aes_ct_wipe(aes_ct_key_t *ks)
+{
+    volatile uint32_t *p = ks->sk;
+
+    for (size_t i = 0; i < sizeof(ks->sk) / sizeof(ks->sk[0]); i++) {
+        p[i] = 0;
+    }
+}
+
+static void load_blocks(uint32_t *q, const uint8_t *b0, const uint8_t *b1)
+{
+    for (int i = 0; i < 4; i++) {
+        q[i] = dec32le(b0 + 4 * i);
+        q[i + 4] = dec32le(b1 + 4 * i);
+    }
+    ortho(q);
+}
+
+static void store_blocks(uint32_t *q, uint8_t *b0, uint8_t *b1)
+{
+    ortho(q);
+    for (int i = 0; i < 4; i++) {
+        enc32le(b0 + 4 * i, q[i]);
+        enc32le(b1 + 4 * i, q[i + 4]);
+    }
+}
+
+FASTCODE static void encrypt_slices(const aes_ct_key_t *ks, uint32_t *q)
+{
+    add_round_key(q, ks->sk);
+    for (int r = 1; r < AES_CT_ROUNDS; r++) {
+        sub_bytes(q);
+        shift_rows(q);
+        mix_columns(q);
+        add_round_key(q, ks->sk + 8 * r);
+    }
+    sub_bytes(q);
+    shift_rows(q);
+    add_round_key(q, ks->sk + 8 * AES_CT_ROUNDS);
+}
+
+FASTCODE static void decrypt_slices(const aes_ct_key_t *ks, uint32_t *q)
+{
+    add_round_key(q, ks->sk + 8 * AES_CT_ROUNDS);
+    for (int r = AES_CT_ROUNDS - 1; r > 0; r--) {
+        inv_shift_rows(q);
+        inv_sub_bytes(q);
+        add_round_key(q, ks->sk + 8 * r);
+        inv_mix_columns(q);
+    }
+    inv_shift_rows(q);
+    inv_sub_bytes(q);
+    add_round_key(q, ks->sk);
+}
+
+/**
+ * @brief Encrypts a single block.
+ *
+ * @param ks Expanded key.
+ * @param in 16 byte input block.
+ * @param out 16 byte output block.
+ */
+void aes_ct_encrypt_block(const aes_ct_key_t *ks, const uint8_t *in, uint8_t *out)
+{
+    uint32_t q[8];
+    uint8_t spare[AES_CT_BLOCK_SIZE];
+
+    load_blocks(q, in, in);
+    encrypt_slices(ks, q);
+    store_blocks(q, out, spare);
+}
+
+/**
+ * @brief Decrypts a single block.
+ *
+ * Only reads the key schedule, so it may run from an interrupt while a CBC
+ * operation with the same key is in progress.
+ *
+ * @param ks Expanded key.
+ * @param in 16 byte input block.
+ * @param out 16 byte output block.
+ */
+void aes_ct_decrypt_block(const aes_ct_key_t *ks, const uint8_t *in, uint8_t *out)
+{
+    uint32_t q[8];
+    uint8_t spare[AES_CT_BLOCK_SIZE];
+
+    load_blocks(q, in, in);
+    decrypt_slices(ks, q);
+    store_blocks(q, out, spare);
+}
+
+/**
+ * @brief Encrypts in CBC mode.
+ *
+ * Chaining makes every block depend on the one before, so only one of the
+ * two bitsliced lanes carries data.
+ *
+ * @param ks Expanded key.
+ * @param iv Initialization vector.
+ * @param in Input, len bytes.
+ * @param out Output, len bytes.
+ * @param len Multiple of 16.
+ */
+void aes_ct_cbc_encrypt(const aes_ct_key_t *ks, const uint8_t iv[16], const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint8_t chain[AES_CT_BLOCK_SIZE];
+
+    memcpy(chain, iv, AES_CT_BLOCK_SIZE);
+    for (size_t off = 0; off + AES_CT_BLOCK_SIZE <= len; off += AES_CT_BLOCK_SIZE) {
+        for (int i = 0; i < AES_CT_BLOCK_SIZE; i++) {
+            chain[i] ^= in[off + i];
+        }
+        aes_ct_encrypt_block(ks, chain, chain);
+        memcpy(out + off, chain, AES_CT_BLOCK_SIZE);
+    }
+}
+
+/**
+ * @brief Decrypts in CBC mode, two blocks per pass through the rounds.
+ *
+ * @param ks Expanded key.
+ * @param iv Initialization vector.
+ * @param in Input, len bytes.
+ * @param out Output, len bytes, may be the same buffer as in.
+ * @param len Multiple of 16.
+ */
+void aes_ct_cbc_decrypt(const aes_ct_key_t *ks, const uint8_t iv[16], const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint8_t chain[AES_CT_BLOCK_SIZE];
+    uint8_t ct[2 * AES_CT_BLOCK_SIZE];
+    uint32_t q[8];
+
+    memcpy(chain, iv, AES_CT_BLOCK_SIZE);
+    for (size_t off = 0; off + AES_CT_BLOCK_SIZE <= len; off += 2 * AES_CT_BLOCK_SIZE) {
+        size_t n = len - off >= 2 * AES_CT_BLOCK_SIZE ? 2 : 1;
+
+        memcpy(ct, in + off, n * AES_CT_BLOCK_SIZE);
+        load_blocks(q, ct, ct + (n - 1) * AES_CT_BLOCK_SIZE);
+        decrypt_slices(ks, q);
+        store_blocks(q, out + off, n == 2 ? out + off + AES_CT_BLOCK_SIZE : ct + AES_CT_BLOCK_SIZE);
+
+        for (int i = 0; i < AES_CT_BLOCK_SIZE; i++) {
+            out[off + i] ^= chain[i];
+        }
+        if (n == 2) {
+            for (int i = 0; i < AES_CT_BLOCK_SIZE; i++) {
+                out[off + AES_CT_BLOCK_SIZE + i] ^= ct[i];
+            }
+        }
+        memcpy(chain, ct + (n - 1) * AES_CT_BLOCK_SIZE, AES_CT_BLOCK_SIZE);
+    }
+}
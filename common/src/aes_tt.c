@@ -0,0 +1,190 @@
+/**
+ * @file aes_tt.c
+ * @brief Two-block T-table AES-128 CBC decryption
+ * @date 2024
+ *
+ * State words are big endian columns, as in wolfCrypt, so its decryption
+ * round keys apply as they are. A single table td holds InvMixColumns of
+ * InvSubBytes, the other three of the usual four are byte rotations of it,
+ * which the Cortex-M4 folds into the EOR for free.
+ */
+
+#include "aes_tt.h"
+#include "fastcode.h"
+
+#include <string.h>
+
+// td[x] = InvSubBytes(x) times (0e, 09, 0d, 0b), inv_sbox the inverse S-box
+static uint32_t td[256];
+static uint8_t inv_sbox[256];
+
+static uint32_t dec32be(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void enc32be(uint8_t *p, uint32_t x)
+{
+    p[0] = (uint8_t)(x >> 24);
+    p[1] = (uint8_t)(x >> 16);
+    p[2] = (uint8_t)(x >> 8);
+    p[3] = (uint8_t)x;
+}
+
+static uint32_t rotr(uint32_t x, int n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+static uint8_t xtime(uint8_t b)
+{
+    return (uint8_t)((b << 1) ^ ((b & 0x80) ? 0x1B : 0));
+}
+
+static uint8_t gmul(uint8_t a, uint8_t b)
+{
+    uint8_t r = 0;
+
+    while (b) {
+        if (b & 1) {
+            r ^= a;
+        }
+        a = xtime(a);
+        b >>= 1;
+    }
+    return r;
+}
+
+static uint8_t rotl8(uint8_t x, int n)
+{
+    return (uint8_t)((x << n) | (x >> (8 - n)));
+}
+
+/**
+ * @brief Builds td and inv_sbox.
+ *
+ * Walks the multiplicative group with generator 3, p running over its
+ * powers and q over their inverses, so the S-box of p is the affine map of q.
+ */
+void aes_tt_init(void)
+{
+    uint8_t p = 1;
+    uint8_t q = 1;
+
+    do {
+        p ^= xtime(p);
+        q ^= q << 1;
+        q ^= q << 2;
+        q ^= q << 4;
+        if (q & 0x80) {
+            q ^= 0x09;
+        }
+        inv_sbox[q ^ rotl8(q, 1) ^ rotl8(q, 2) ^ rotl8(q, 3) ^ rotl8(q, 4) ^ 0x63] = p;
+    } while (p != 1);
+    inv_sbox[0x63] = 0;
+
+    for (int x = 0; x < 256; x++) {
+        uint8_t s = inv_sbox[x];
+        td[x] = ((uint32_t)gmul(s, 0x0E) << 24) | ((uint32_t)gmul(s, 0x09) << 16) |
+                ((uint32_t)gmul(s, 0x0D) << 8) | gmul(s, 0x0B);
+    }
+}
+
+// One inner round of a block: InvShiftRows takes row r of column c from
+// column c - r, td and its rotations do InvSubBytes and InvMixColumns
+#define TD0(x) td[(x) >> 24]
+#define TD1(x) rotr(td[((x) >> 16) & 0xFF], 8)
+#define TD2(x) rotr(td[((x) >> 8) & 0xFF], 16)
+#define TD3(x) rotr(td[(x) & 0xFF], 24)
+#define INV_ROUND(t, s, k)                                                  \
+    do {                                                                    \
+        t##0 = TD0(s##0) ^ TD1(s##3) ^ TD2(s##2) ^ TD3(s##1) ^ (k)[0];      \
+        t##1 = TD0(s##1) ^ TD1(s##0) ^ TD2(s##3) ^ TD3(s##2) ^ (k)[1];      \
+        t##2 = TD0(s##2) ^ TD1(s##1) ^ TD2(s##0) ^ TD3(s##3) ^ (k)[2];      \
+        t##3 = TD0(s##3) ^ TD1(s##2) ^ TD2(s##1) ^ TD3(s##0) ^ (k)[3];      \
+    } while (0)
+
+// The last round, InvSubBytes without InvMixColumns
+#define SI(x, n) ((uint32_t)inv_sbox[((x) >> (n)) & 0xFF] << (n))
+#define INV_LAST(s, t, k)                                                   \
+    do {                                                                    \
+        s[0] = (SI(t##0, 24) | SI(t##3, 16) | SI(t##2, 8) | SI(t##1, 0)) ^ (k)[0]; \
+        s[1] = (SI(t##1, 24) | SI(t##0, 16) | SI(t##3, 8) | SI(t##2, 0)) ^ (k)[1]; \
+        s[2] = (SI(t##2, 24) | SI(t##1, 16) | SI(t##0, 8) | SI(t##3, 0)) ^ (k)[2]; \
+        s[3] = (SI(t##3, 24) | SI(t##2, 16) | SI(t##1, 8) | SI(t##0, 0)) ^ (k)[3]; \
+    } while (0)
+
+/**
+ * @brief Decrypts two blocks, their rounds interleaved.
+ *
+ * Neither block depends on the other, so the lookups of b issue while those
+ * of a are still loading. Rounds go in pairs, from s to t and back.
+ *
+ * @param rk Decryption round keys.
+ * @param a First block, in place.
+ * @param b Second block, in place.
+ */
+FASTCODE static void decrypt_pair(const uint32_t *rk, uint32_t *a, uint32_t *b)
+{
+    uint32_t as0 = a[0] ^ rk[0], as1 = a[1] ^ rk[1], as2 = a[2] ^ rk[2], as3 = a[3] ^ rk[3];
+    uint32_t bs0 = b[0] ^ rk[0], bs1 = b[1] ^ rk[1], bs2 = b[2] ^ rk[2], bs3 = b[3] ^ rk[3];
+    uint32_t at0, at1, at2, at3;
+    uint32_t bt0, bt1, bt2, bt3;
+
+    for (int r = 1;; r += 2) {
+        INV_ROUND(at, as, rk + 4 * r);
+        INV_ROUND(bt, bs, rk + 4 * r);
+        if (r + 1 == AES_TT_ROUNDS) {
+            break;
+        }
+        INV_ROUND(as, at, rk + 4 * (r + 1));
+        INV_ROUND(bs, bt, rk + 4 * (r + 1));
+    }
+    INV_LAST(a, at, rk + 4 * AES_TT_ROUNDS);
+    INV_LAST(b, bt, rk + 4 * AES_TT_ROUNDS);
+}
+
+/**
+ * @brief Decrypts in CBC mode, two blocks per pass through the rounds.
+ *
+ * An odd last block runs with a copy of itself as the second block.
+ *
+ * @param rk 44 decryption round key words, as wolfCrypt lays them out.
+ * @param iv Initialization vector.
+ * @param in Input, len bytes.
+ * @param out Output, len bytes, may be the same buffer as in.
+ * @param len Multiple of 16.
+ */
+void aes_tt_cbc_decrypt(const uint32_t *rk, const uint8_t iv[16], const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint32_t chain[4];
+    uint32_t ca[4];
+    uint32_t cb[4];
+    uint32_t a[4];
+    uint32_t b[4];
+
+    for (int i = 0; i < 4; i++) {
+        chain[i] = dec32be(iv + 4 * i);
+    }
+    for (size_t off = 0; off + AES_TT_BLOCK_SIZE <= len; off += 2 * AES_TT_BLOCK_SIZE) {
+        size_t n = len - off >= 2 * AES_TT_BLOCK_SIZE ? 2 : 1;
+
+        for (int i = 0; i < 4; i++) {
+            ca[i] = dec32be(in + off + 4 * i);
+            cb[i] = n == 2 ? dec32be(in + off + AES_TT_BLOCK_SIZE + 4 * i) : ca[i];
+        }
+        memcpy(a, ca, sizeof(a));
+        memcpy(b, cb, sizeof(b));
+        decrypt_pair(rk, a, b);
+
+        for (int i = 0; i < 4; i++) {
+            enc32be(out + off + 4 * i, a[i] ^ chain[i]);
+        }
+        if (n == 2) {
+            for (int i = 0; i < 4; i++) {
+                enc32be(out + off + AES_TT_BLOCK_SIZE + 4 * i, b[i] ^ ca[i]);
+            }
+        }
+        memcpy(chain, n == 2 ? cb : ca, sizeof(chain));
+    }
+}
@@ -0,0 +1,121 @@
+#include "bench.h"
+
+#ifdef BENCH_ENABLE
+
+#include <stdio.h>
+#include <string.h>
+#include "mxc_device.h"
+#include "crypto_util.h"
+#include "general_util.h"
+#include "tiny_printf.h"
+
+// Largest buffer the crypto benchmarks run over, a full message
+#define BENCH_BUF_LEN 256
+
+// Where bench_report sends its lines, from bench_init
+static bench_print_t bench_print;
+
+/**
+ * @brief Enables the DWT cycle counter.
+ *
+ * @param print Prints one line of the report.
+ */
+void bench_init(bench_print_t print)
+{
+    bench_print = print;
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief Clears a statistic for a new benchmark.
+ *
+ * @param stat Statistic to clear.
+ */
+void bench_reset(bench_stat_t *stat)
+{
+    stat->count = 0;
+    stat->min = UINT32_MAX;
+    stat->max = 0;
+    stat->total = 0;
+}
+
+/**
+ * @brief Adds one latency sample to a statistic.
+ *
+ * @param stat Statistic to update.
+ * @param cycles Cycles the sample took.
+ */
+void bench_add(bench_stat_t *stat, uint32_t cycles)
+{
+    stat->count++;
+    stat->total += cycles;
+    if (cycles < stat->min) {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max) {
+        stat->max = cycles;
+    }
+}
+
+/**
+ * @brief Prints a statistic as one info message.
+ *
+ * Each line holds the name, the iteration count, min/avg/max in cycles,
+ * the average in microseconds and, if bytes is not 0, the throughput in
+ * bytes per second at the average latency.
+ *
+ * @param name Name of the benchmark.
+ * @param stat Statistic to report.
+ * @param bytes Bytes processed per iteration.
+ */
+void bench_report(const char *name, const bench_stat_t *stat, size_t bytes)
+{
+    if (stat->count == 0) {
+        return;
+    }
+    uint32_t avg = stat->total / stat->count;
+    uint32_t us = (uint64_t) avg * 1000000 / SystemCoreClock;
+    uint32_t bps = avg ? (uint64_t) bytes * SystemCoreClock / avg : 0;
+    char line[128];
+#ifdef TINY_PRINTF
+    tiny_snprintf(line, sizeof(line), "B %s n=%lu min=%lu avg=%lu max=%lu us=%lu Bps=%lu", name,
+                  (unsigned long) stat->count, (unsigned long) stat->min, (unsigned long) avg,
+                  (unsigned long) stat->max, (unsigned long) us, (unsigned long) bps);
+#else
+    snprintf(line, sizeof(line), "B %s n=%lu min=%lu avg=%lu max=%lu us=%lu Bps=%lu", name,
+             (unsigned long) stat->count, (unsigned long) stat->min, (unsigned long) avg,
+             (unsigned long) stat->max, (unsigned long) us, (unsigned long) bps);
+#endif
+    bench_print(line);
+}
+
+/**
+ * @brief Times the crypto primitives over one block and over a full message.
+ */
+void bench_crypto(void)
+{
+    static uint8_t buf[BENCH_BUF_LEN];
+    uint8_t iv[IV_SIZE] = {0};
+    uint8_t digest[HASH_LEN];
+    uint8_t digests[4][HASH_LEN];
+    uint8_t *const parts[4] = { buf, buf + 64, buf + 128, buf + 192 };
+    const size_t part_lens[4] = { 64, 64, 64, 64 };
+    volatile uint64_t sink;
+
+    memset(buf, 0xA5, sizeof(buf));
+    BENCH_RUN("aes_encrypt_16", 16, aes_encrypt(buf, buf, iv, 16));
+    BENCH_RUN("aes_encrypt_256", BENCH_BUF_LEN, aes_encrypt(buf, buf, iv, BENCH_BUF_LEN));
+    BENCH_RUN("aes_decrypt_16", 16, aes_decrypt(buf, buf, iv, 16));
+    BENCH_RUN("aes_decrypt_256", BENCH_BUF_LEN, aes_decrypt(buf, buf, iv, BENCH_BUF_LEN));
+    BENCH_RUN("hash_32", 32, hash(buf, digest, 32));
+    BENCH_RUN("hash_256", BENCH_BUF_LEN, hash(buf, digest, BENCH_BUF_LEN));
+    BENCH_RUN("hash_64", 64, hash(buf, digest, 64));
+    BENCH_RUN("hash_many_4x64", BENCH_BUF_LEN, hash_many(parts, digests, part_lens, 4));
+    BENCH_RUN("hmac_32", 32, hmac(buf, digest, 32));
+    BENCH_RUN("rng_gen", sizeof(uint64_t), sink = rng_gen());
+    (void) sink;
+}
+
+#endif
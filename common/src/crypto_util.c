@@ -0,0 +1,1487 @@
+#include "crypto_util.h"
+#include "global_secrets.h"
+#include "trace.h"
+#include "fastcode.h"
+#include "hotcold.h"
+#include "rv_keystream.h"
+
+#ifdef WOLFSSL_MAX78000_AES
+#include "wolfssl/wolfcrypt/port/maxim/max78000.h"
+#endif
+
+#ifdef COMPONENT_ENROLL
+#include "wolfssl/wolfcrypt/ecc.h"
+#endif
+
+#ifdef CRYPTO_STATIC_MEMORY
+#include "wolfssl/wolfcrypt/memory.h"
+
+#if !defined(WOLFSSL_STATIC_MEMORY) || !defined(CRYPTO_HEAP_SIZE)
+#error "CRYPTO_STATIC_MEMORY needs WOLFSSL_STATIC_MEMORY and CRYPTO_HEAP_SIZE"
+#endif
+
+// Arena wolfCrypt's memory pools are carved from, firmware.ld keeps it out of .bss
+static uint8_t crypto_arena[CRYPTO_HEAP_SIZE]
+    __attribute__((section(".crypto_heap"), aligned(WOLFSSL_STATIC_ALIGN)));
+static WOLFSSL_HEAP_HINT *crypto_hint;
+#endif
+
+#define BLOCK_SIZE 16
+
+// AES key for encryption and decryption
+uint8_t key[16] = KEY;
+
+// Persistent crypto session, key schedules are expanded once in crypto_init
+static crypto_session_t session;
+
+#ifdef PRECOMPUTED_KEYS
+#ifndef KEY_CMAC_K2
+#error "PRECOMPUTED_KEYS needs a global_secrets.h from the current deployment Makefile"
+#endif
+
+// Device key tables generated with the deployment, see deployment/gen_key_tables.py
+#ifdef AES_CT
+static const uint32_t key_ct_schedule[(AES_CT_ROUNDS + 1) * 8] = KEY_CT_SCHEDULE;
+#else
+static const uint32_t key_schedule[44] = KEY_SCHEDULE;
+static const uint32_t key_dec_schedule[44] = KEY_DEC_SCHEDULE;
+#endif
+static const uint8_t key_check[BLOCK_SIZE] = KEY_CHECK;
+static const uint32_t key_hmac_inner[8] = KEY_HMAC_INNER;
+static const uint32_t key_hmac_outer[8] = KEY_HMAC_OUTER;
+#ifdef MSG_MAC_CMAC
+static const uint32_t key_cmac_schedule[44] = KEY_CMAC_SCHEDULE;
+static const uint8_t key_cmac_k1[BLOCK_SIZE] = KEY_CMAC_K1;
+static const uint8_t key_cmac_k2[BLOCK_SIZE] = KEY_CMAC_K2;
+#endif
+#endif
+
+#ifdef MSG_CHANNEL
+// Session for the post-boot channel key currently loaded, see crypto_use_channel_key
+static crypto_session_t channel;
+static uint8_t channel_key[CHANNEL_KEY_LEN];
+// Bumped whenever the AES routines switch keys, see crypto_key_epoch
+static volatile uint32_t key_epoch;
+// Session crypto_hold_device_key switched away from, NULL if not holding
+static crypto_session_t *held;
+#endif
+
+#ifdef COMPONENT_KEYS
+// Expanded component key, see crypto_use_component_key
+typedef struct {
+    crypto_session_t s;
+    uint8_t key[16];
+    uint8_t addr;
+    uint32_t used; // Selection count when last selected, the lowest is replaced
+} component_slot_t;
+
+static component_slot_t component_slots[COMPONENT_KEY_SLOTS];
+static uint32_t component_uses;
+#endif
+
+// Session and key the AES routines fall back to when no channel key is in use,
+// the device key unless a component key is selected
+static crypto_session_t *base = &session;
+static const uint8_t *base_key = key;
+
+// Session the AES routines run with, base unless a channel key is in use
+static crypto_session_t *active = &session;
+
+#ifdef MSG_CTR
+// Keystreams made while idle, see ctr_pool_fill. Only made under base, frames
+// sealed under a channel key are encrypted on the spot.
+typedef struct {
+    uint8_t iv[IV_SIZE];
+    uint8_t keystream[CTR_KEYSTREAM_LEN];
+    const crypto_session_t *owner; // Session the keystream was made under, NULL if empty
+} ctr_slot_t;
+
+static ctr_slot_t ctr_pool[CTR_POOL_LEN];
+static unsigned ctr_next; // Slot the next seal takes, the pool is used in order
+
+#ifdef RISCV_KEYSTREAM
+typedef char rv_keystream_len_t[(RV_KEYSTREAM_LEN == CTR_KEYSTREAM_LEN) ? 1 : -1];
+#endif
+#endif
+
+/**
+ * @brief Returns the heap hint every wolfCrypt context is created with.
+ *
+ * With CRYPTO_STATIC_MEMORY the arena is split into fixed size buckets on
+ * first use, which can be rng_init before crypto_init. wolfCrypt is built
+ * without malloc then, so if the arena can't be loaded the contexts that
+ * need memory fail to come up instead of falling back to the general heap.
+ *
+ * @return Heap hint, NULL for the general heap.
+ */
+void *crypto_heap(void)
+{
+#ifdef CRYPTO_STATIC_MEMORY
+    if (crypto_hint == NULL &&
+        wc_LoadStaticMemory(&crypto_hint, crypto_arena, sizeof(crypto_arena), WOLFMEM_GENERAL, 0) != 0) {
+        crypto_hint = NULL;
+    }
+    return crypto_hint;
+#else
+    return NULL;
+#endif
+}
+
+/**
+ * @brief Precomputes the HMAC-SHA256 midstates for a key.
+ *
+ * The key XOR ipad and key XOR opad blocks are compressed once here, so each
+ * MAC only compresses the message and the final outer block.
+ *
+ * @param m MAC state to fill.
+ * @param k Key, at most one SHA-256 block long.
+ * @param len Length of the key.
+ * @param devId Device id the SHA-256 contexts are created with.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int crypto_mac_setkey(crypto_mac_t *m, const uint8_t *k, size_t len, int devId)
+{
+    uint8_t pad[WC_SHA256_BLOCK_SIZE];
+    if (len > sizeof(pad)) {
+        return BAD_FUNC_ARG;
+    }
+
+    memset(pad, 0x36, sizeof(pad));
+    for (size_t i = 0; i < len; i++) {
+        pad[i] ^= k[i];
+    }
+    int ret = wc_InitSha256_ex(&m->inner, crypto_heap(), devId);
+    if (ret == 0) {
+        ret = wc_Sha256Update(&m->inner, pad, sizeof(pad));
+    }
+
+    memset(pad, 0x5c, sizeof(pad));
+    for (size_t i = 0; i < len; i++) {
+        pad[i] ^= k[i];
+    }
+    if (ret == 0) {
+        ret = wc_InitSha256_ex(&m->outer, crypto_heap(), devId);
+    }
+    if (ret == 0) {
+        ret = wc_Sha256Update(&m->outer, pad, sizeof(pad));
+    }
+
+    memset(pad, 0, sizeof(pad));
+    return ret;
+}
+
+/**
+ * @brief Computes an HMAC-SHA256 from precomputed midstates.
+ *
+ * Works on copies of the midstates, so m can be reused for the next MAC.
+ *
+ * @param m MAC state from crypto_mac_setkey.
+ * @param in Pointer to the input data.
+ * @param len Length of the input data.
+ * @param out Buffer where the MAC will be stored.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+HOT static int crypto_mac(crypto_mac_t *m, const uint8_t *in, size_t len, uint8_t out[HASH_LEN])
+{
+    wc_Sha256 ctx;
+    uint8_t inner[HASH_LEN];
+
+    int ret = wc_Sha256Copy(&m->inner, &ctx);
+    if (ret == 0) {
+        ret = wc_Sha256Update(&ctx, in, len);
+    }
+    if (ret == 0) {
+        ret = wc_Sha256Final(&ctx, inner);
+    }
+    wc_Sha256Free(&ctx);
+
+    if (ret == 0) {
+        ret = wc_Sha256Copy(&m->outer, &ctx);
+    }
+    if (ret == 0) {
+        ret = wc_Sha256Update(&ctx, inner, sizeof(inner));
+    }
+    if (ret == 0) {
+        ret = wc_Sha256Final(&ctx, out);
+    }
+    wc_Sha256Free(&ctx);
+
+    memset(inner, 0, sizeof(inner));
+    return ret;
+}
+
+#ifdef MSG_MAC_CMAC
+/**
+ * @brief Keys the session's AES-CMAC template.
+ *
+ * CBC-MAC under the key that also CBC encrypts the frame is unsafe, so the
+ * CMAC key is the first 16 bytes of SHA-256(session key | label). The key
+ * schedule and the CMAC subkeys are computed once here.
+ *
+ * @param s Session to set up.
+ * @param k 16 byte session key.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int crypto_cmac_setkey(crypto_session_t *s, const uint8_t *k)
+{
+    static const char label[] = "ectf-frame-cmac";
+    uint8_t material[16 + sizeof(label)];
+    uint8_t digest[HASH_LEN];
+
+    memcpy(material, k, 16);
+    memcpy(material + 16, label, sizeof(label));
+    hash(material, digest, sizeof(material));
+    int ret = wc_InitCmac_ex(&s->cmac, digest, 16, WC_CMAC_AES, NULL, crypto_heap(), s->devId);
+
+    memset(material, 0, sizeof(material));
+    memset(digest, 0, sizeof(digest));
+    return ret;
+}
+#endif
+
+/**
+ * @brief Expands the wolfCrypt AES-CBC key schedules of a crypto session.
+ *
+ * @param s Session to set up, s->devId selects software or hardware AES.
+ * @param k 16 byte AES key.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int crypto_session_cbc_setkey(crypto_session_t *s, const uint8_t *k)
+{
+    int ret = wc_AesInit(&s->enc, crypto_heap(), s->devId);
+    if (ret == 0) {
+        ret = wc_AesSetKey(&s->enc, k, 16, NULL, AES_ENCRYPTION);
+    }
+    if (ret == 0) {
+        ret = wc_AesInit(&s->dec, crypto_heap(), s->devId);
+    }
+    if (ret == 0) {
+        ret = wc_AesSetKey(&s->dec, k, 16, NULL, AES_DECRYPTION);
+    }
+    return ret;
+}
+
+/**
+ * @brief Expands the key schedules of a crypto session.
+ *
+ * With AES_CT, software CBC runs on the bitsliced aes_ct schedule and the
+ * wolfCrypt CBC contexts are only set up for the AES engine.
+ *
+ * @param s Session to set up, s->devId selects software or hardware AES.
+ * @param k 16 byte AES key.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int crypto_session_setkey(crypto_session_t *s, const uint8_t *k)
+{
+#ifdef AES_CT
+    aes_ct_setkey(&s->ct, k);
+    int ret = (s->devId == INVALID_DEVID) ? 0 : crypto_session_cbc_setkey(s, k);
+#else
+    int ret = crypto_session_cbc_setkey(s, k);
+#endif
+    if (ret == 0) {
+        ret = crypto_mac_setkey(&s->mac, k, 16, s->devId);
+    }
+#ifdef MSG_MAC_CMAC
+    if (ret == 0) {
+        ret = crypto_cmac_setkey(s, k);
+    }
+#endif
+#ifdef HAVE_AESGCM
+    if (ret == 0) {
+        ret = wc_AesInit(&s->gcm, crypto_heap(), s->devId);
+    }
+    if (ret == 0) {
+        ret = wc_AesGcmSetKey(&s->gcm, k, 16);
+    }
+#endif
+#ifdef MSG_AEAD_ASCON
+    ascon_setkey(&s->ascon, k);
+#endif
+    return ret;
+}
+
+/**
+ * @brief Frees the wolfCrypt contexts of a crypto session and wipes it.
+ *
+ * Safe on a session that was never set up or only partly, every context
+ * is either initialized or all zero.
+ *
+ * @param s Session to release.
+ */
+static void crypto_session_release(crypto_session_t *s)
+{
+    wc_AesFree(&s->enc);
+    wc_AesFree(&s->dec);
+#ifdef HAVE_AESGCM
+    wc_AesFree(&s->gcm);
+#endif
+    wc_Sha256Free(&s->mac.inner);
+    wc_Sha256Free(&s->mac.outer);
+#ifdef MSG_MAC_CMAC
+    wc_AesFree(&s->cmac.aes);
+#endif
+    memset(s, 0, sizeof(*s));
+}
+
+#ifdef PRECOMPUTED_KEYS
+/**
+ * @brief Loads an expanded AES-128 schedule into a software wolfCrypt context.
+ *
+ * Leaves the context the way wc_AesSetKey does, without running the key
+ * expansion. Only valid for software AES with the full T-tables, the
+ * caller checks the result against KEY_CHECK.
+ *
+ * @param aes Context to set up.
+ * @param rk 44 round key words, as wc_AesSetKey lays them out.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int crypto_aes_load(Aes *aes, const uint32_t rk[44])
+{
+    int ret = wc_AesInit(aes, crypto_heap(), INVALID_DEVID);
+    if (ret == 0) {
+        memcpy(aes->key, rk, 44 * sizeof(uint32_t));
+        aes->keylen = 16;
+        aes->rounds = 10;
+#ifdef WOLFSSL_AES_COUNTER
+        aes->left = 0;
+#endif
+        ret = wc_AesSetIV(aes, NULL);
+    }
+    return ret;
+}
+
+/**
+ * @brief Sets up a crypto session under the device key from the deployment tables.
+ *
+ * Nothing is expanded or hashed: the AES round keys, HMAC midstates and
+ * CMAC subkeys are copied out of flash. GCM still computes its hash key
+ * here. The AES schedules are checked by encrypting the zero block, and if
+ * that does not give KEY_CHECK, or the AES engine is in use (it takes the
+ * raw key), the key is expanded as usual instead.
+ *
+ * @param s Session to set up, s->devId selects software or hardware AES.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int crypto_session_load(crypto_session_t *s)
+{
+    uint8_t block[BLOCK_SIZE] = {0};
+    uint8_t diff = 0;
+    int ret = (s->devId == INVALID_DEVID) ? 0 : BAD_STATE_E;
+#ifdef KEY_ROTATION
+    // The tables belong to the deployment key, not a rotated one
+    static const uint8_t deploy_key[16] = KEY;
+    if (secure_memcmp(key, deploy_key, sizeof(key)) != 0) {
+        ret = BAD_STATE_E;
+    }
+#endif
+
+#ifdef AES_CT
+    if (ret == 0) {
+        memcpy(s->ct.sk, key_ct_schedule, sizeof(s->ct.sk));
+        aes_ct_encrypt_block(&s->ct, block, block);
+        ret = secure_memcmp(block, key_check, BLOCK_SIZE) == 0 ? 0 : BAD_STATE_E;
+        aes_ct_decrypt_block(&s->ct, block, block);
+    }
+#else
+    if (ret == 0) {
+        ret = crypto_aes_load(&s->enc, key_schedule);
+    }
+    if (ret == 0) {
+        ret = crypto_aes_load(&s->dec, key_dec_schedule);
+    }
+    if (ret == 0) {
+        ret = wc_AesEncryptDirect(&s->enc, block, block);
+    }
+    if (ret == 0 && secure_memcmp(block, key_check, BLOCK_SIZE) != 0) {
+        ret = BAD_STATE_E;
+    }
+    if (ret == 0) {
+        ret = wc_AesDecryptDirect(&s->dec, block, block);
+    }
+#endif
+    // Decrypting KEY_CHECK must give the zero block back
+    for (size_t i = 0; i < BLOCK_SIZE; i++) {
+        diff |= block[i];
+    }
+    if (ret == 0 && diff != 0) {
+        ret = BAD_STATE_E;
+    }
+    memset(block, 0, sizeof(block));
+
+    if (ret == 0) {
+        ret = wc_InitSha256_ex(&s->mac.inner, crypto_heap(), INVALID_DEVID);
+    }
+    if (ret == 0) {
+        ret = wc_InitSha256_ex(&s->mac.outer, crypto_heap(), INVALID_DEVID);
+    }
+    if (ret == 0) {
+        // Each midstate has absorbed exactly one padded key block
+        memcpy(s->mac.inner.digest, key_hmac_inner, sizeof(s->mac.inner.digest));
+        memcpy(s->mac.outer.digest, key_hmac_outer, sizeof(s->mac.outer.digest));
+        s->mac.inner.loLen = WC_SHA256_BLOCK_SIZE;
+        s->mac.outer.loLen = WC_SHA256_BLOCK_SIZE;
+    }
+#ifdef MSG_MAC_CMAC
+    if (ret == 0) {
+        // What wc_InitCmac_ex leaves behind for the derived CMAC key
+        memset(&s->cmac, 0, sizeof(s->cmac));
+        ret = crypto_aes_load(&s->cmac.aes, key_cmac_schedule);
+        memcpy(s->cmac.k1, key_cmac_k1, BLOCK_SIZE);
+        memcpy(s->cmac.k2, key_cmac_k2, BLOCK_SIZE);
+    }
+#endif
+#ifdef HAVE_AESGCM
+    if (ret == 0) {
+        ret = wc_AesInit(&s->gcm, crypto_heap(), s->devId);
+    }
+    if (ret == 0) {
+        ret = wc_AesGcmSetKey(&s->gcm, key, 16);
+    }
+#endif
+#ifdef MSG_AEAD_ASCON
+    ascon_setkey(&s->ascon, key);
+#endif
+
+    if (ret != 0) {
+        int devId = s->devId;
+        crypto_session_release(s);
+        s->devId = devId;
+        ret = crypto_session_setkey(s, key);
+    }
+    return ret;
+}
+#endif
+
+/**
+ * @brief Initializes wolfCrypt and the persistent crypto session.
+ *
+ * Expands the encryption and decryption key schedules once so that each
+ * message only needs to load a fresh IV. When built with the MAX78000 AES
+ * offload, the hardware engine is used if it passes its self test, otherwise
+ * the session silently stays on software AES.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+int crypto_init(void)
+{
+    if (session.ready) {
+        return 0;
+    }
+
+    int ret = wolfCrypt_Init(); // Initialize wolfSSL
+    if (ret != 0) {
+        return ret;
+    }
+
+    session.devId = INVALID_DEVID;
+#ifdef WOLFSSL_MAX78000_AES
+    if (wc_MAX78000_Init() == 0) {
+        session.devId = WOLFSSL_MAX78000_DEVID;
+    }
+#endif
+
+#ifdef AES_TT
+    aes_tt_init();
+#endif
+
+#ifdef PRECOMPUTED_KEYS
+    ret = crypto_session_load(&session);
+#else
+    ret = crypto_session_setkey(&session, key);
+#endif
+    if (ret != 0) {
+        crypto_free();
+        return ret;
+    }
+
+    session.ready = 1;
+    return 0;
+}
+
+/**
+ * @brief Releases the persistent crypto session and wipes the key schedules.
+ */
+void crypto_free(void)
+{
+    crypto_session_release(&session);
+#ifdef MSG_CHANNEL
+    crypto_session_release(&channel);
+    memset(channel_key, 0, sizeof(channel_key));
+#endif
+#ifdef COMPONENT_KEYS
+    for (unsigned i = 0; i < COMPONENT_KEY_SLOTS; i++) {
+        crypto_session_release(&component_slots[i].s);
+    }
+    memset(component_slots, 0, sizeof(component_slots));
+    component_uses = 0;
+#endif
+    base = &session;
+    base_key = key;
+    active = &session;
+#ifdef MSG_CTR
+    memset(ctr_pool, 0, sizeof(ctr_pool));
+    ctr_next = 0;
+#endif
+#ifdef WOLFSSL_MAX78000_AES
+    wc_MAX78000_Cleanup();
+#endif
+    wolfCrypt_Cleanup(); // Clean up wolfSSL
+}
+
+#ifdef KEY_ROTATION
+/**
+ * @brief Replaces the device key.
+ *
+ * Channel keys derived from now on come from the new key, the channel in
+ * use is left alone.
+ *
+ * @param new_key 16 byte device key.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure, in which
+ *         case the session is gone until crypto_init runs again.
+ */
+int crypto_rekey(const uint8_t new_key[16])
+{
+    memcpy(key, new_key, sizeof(key));
+    if (!session.ready) {
+        return 0;
+    }
+
+    int devId = session.devId;
+    crypto_session_release(&session);
+    session.devId = devId;
+    int ret = crypto_session_setkey(&session, key);
+    if (ret != 0) {
+        crypto_free();
+        return ret;
+    }
+    session.ready = 1;
+#ifdef MSG_CTR
+    memset(ctr_pool, 0, sizeof(ctr_pool));
+    ctr_next = 0;
+#endif
+#ifdef MSG_CHANNEL
+    key_epoch++;
+    if (active != &channel) {
+        active = &session;
+    }
+#endif
+    return 0;
+}
+#endif
+
+#ifdef MSG_CHANNEL
+/**
+ * @brief Derives a post-boot channel key.
+ *
+ * The key is the first 16 bytes of SHA-256(base key | label | ap_chal | comp_chal),
+ * the base key being the device key or the component key in use. Both
+ * challenges travelled encrypted under it during boot, so only the two ends
+ * of the boot exchange can compute it.
+ *
+ * @param ap_chal Last challenge the AP sent during boot.
+ * @param comp_chal Last challenge the component sent during boot.
+ * @param out Buffer where the channel key will be stored.
+ */
+void crypto_derive_channel_key(uint32_t ap_chal, uint32_t comp_chal, uint8_t out[CHANNEL_KEY_LEN])
+{
+    static const char label[] = "post-boot channel";
+    uint8_t material[sizeof(key) + sizeof(label) + 2 * sizeof(uint32_t)];
+    uint8_t digest[HASH_LEN];
+
+    memcpy(material, base_key, sizeof(key));
+    memcpy(material + sizeof(key), label, sizeof(label));
+    memcpy(material + sizeof(key) + sizeof(label), &ap_chal, sizeof(ap_chal));
+    memcpy(material + sizeof(key) + sizeof(label) + sizeof(ap_chal), &comp_chal, sizeof(comp_chal));
+    hash(material, digest, sizeof(material));
+    memcpy(out, digest, CHANNEL_KEY_LEN);
+
+    memset(material, 0, sizeof(material));
+    memset(digest, 0, sizeof(digest));
+}
+
+/**
+ * @brief Switches the AES routines to a post-boot channel key.
+ *
+ * The key schedules of the last channel key are kept, so switching back
+ * and forth between the device key and one channel costs nothing.
+ *
+ * @param k 16 byte channel key, or NULL to go back to the device key or
+ *          the component key in use.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+int crypto_use_channel_key(const uint8_t *k)
+{
+    key_epoch++;
+    if (k == NULL) {
+        active = base;
+        return 0;
+    }
+    if (!session.ready) {
+        return BAD_STATE_E;
+    }
+
+    if (!channel.ready || secure_memcmp(channel_key, k, CHANNEL_KEY_LEN) != 0) {
+        crypto_session_release(&channel);
+        channel.devId = session.devId;
+        int ret = crypto_session_setkey(&channel, k);
+        if (ret != 0) {
+            memset(&channel, 0, sizeof(channel));
+            active = base;
+            return ret;
+        }
+        memcpy(channel_key, k, CHANNEL_KEY_LEN);
+        channel.ready = 1;
+    }
+
+    active = &channel;
+    return 0;
+}
+
+/**
+ * @brief Tells whether the key in use changed.
+ *
+ * @return Counter that changes every time crypto_use_channel_key is called.
+ */
+uint32_t crypto_key_epoch(void)
+{
+    return key_epoch;
+}
+
+/**
+ * @brief Switches to the device key for a while, keeping the key in use.
+ */
+void crypto_hold_device_key(void)
+{
+    held = active;
+    if (active != base) {
+        key_epoch++;
+        active = base;
+    }
+}
+
+/**
+ * @brief Goes back to the key crypto_hold_device_key found in use.
+ */
+void crypto_release_device_key(void)
+{
+    if (held != NULL && active != held) {
+        key_epoch++;
+        active = held;
+    }
+    held = NULL;
+}
+#endif
+
+#ifdef COMPONENT_KEYS
+/**
+ * @brief Makes a session the one the AES routines fall back to.
+ *
+ * @param s Session to switch to.
+ * @param k Its raw key, channel keys are derived from it.
+ */
+static void crypto_use_base(crypto_session_t *s, const uint8_t *k)
+{
+#ifdef MSG_CHANNEL
+    key_epoch++;
+#endif
+    base = s;
+    base_key = k;
+    active = s;
+}
+
+/**
+ * @brief Finds the slot of a component, or the one its key would go to.
+ *
+ * @param addr I2C address of the component.
+ *
+ * @return Its slot if it is cached, else the free or least recently used one.
+ */
+static component_slot_t *component_slot_find(uint8_t addr)
+{
+    component_slot_t *slot = &component_slots[0];
+    for (unsigned i = 0; i < COMPONENT_KEY_SLOTS; i++) {
+        component_slot_t *s = &component_slots[i];
+        if (s->s.ready && s->addr == addr) {
+            return s;
+        }
+        if (!s->s.ready || (slot->s.ready && s->used < slot->used)) {
+            slot = s;
+        }
+    }
+    return slot;
+}
+
+/**
+ * @brief Loads a component key into a slot and selects it.
+ *
+ * The key is HKDF-SHA256(ikm, info = label | addr).
+ *
+ * @param slot Slot to take over, from component_slot_find.
+ * @param addr I2C address of the component.
+ * @param ikm Input keying material.
+ * @param ikm_len Its length.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int component_slot_load(component_slot_t *slot, uint8_t addr, const uint8_t *ikm, size_t ikm_len)
+{
+    static const char label[] = "ectf-component-key";
+#ifdef MSG_CTR
+    for (unsigned i = 0; i < CTR_POOL_LEN; i++) {
+        if (ctr_pool[i].owner == &slot->s) {
+            memset(&ctr_pool[i], 0, sizeof(ctr_pool[i]));
+        }
+    }
+#endif
+    if (active == &slot->s || base == &slot->s) {
+        crypto_use_base(&session, key);
+    }
+    crypto_session_release(&slot->s);
+
+    uint8_t info[sizeof(label) + 1];
+    memcpy(info, label, sizeof(label));
+    info[sizeof(label)] = addr;
+    int ret = wc_HKDF(WC_SHA256, ikm, ikm_len, NULL, 0, info, sizeof(info),
+                      slot->key, sizeof(slot->key));
+    if (ret == 0) {
+        slot->s.devId = session.devId;
+        ret = crypto_session_setkey(&slot->s, slot->key);
+    }
+    if (ret != 0) {
+        crypto_session_release(&slot->s);
+        memset(slot, 0, sizeof(*slot));
+        return ret;
+    }
+
+    slot->s.ready = 1;
+    slot->addr = addr;
+    slot->used = ++component_uses;
+    crypto_use_base(&slot->s, slot->key);
+    return 0;
+}
+
+/**
+ * @brief Switches the AES routines to the key of one component.
+ *
+ * The key is HKDF-SHA256(device key, info = label | addr). It is only
+ * derived and expanded the first time the component is selected or after
+ * its slot was reused, later selections just find the slot. With
+ * COMPONENT_ENROLL the key comes from crypto_enroll instead.
+ *
+ * @param addr I2C address of the component.
+ *
+ * @return 0 on success, CRYPTO_ENROLL_NEEDED if the component has to be
+ *         enrolled first, negative wolfCrypt error code on failure.
+ */
+int crypto_use_component_key(uint8_t addr)
+{
+    if (!session.ready) {
+        int ret = crypto_init();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    component_slot_t *slot = component_slot_find(addr);
+    if (slot->s.ready && slot->addr == addr) {
+        slot->used = ++component_uses;
+        crypto_use_base(&slot->s, slot->key);
+        return 0;
+    }
+#ifdef COMPONENT_ENROLL
+    return CRYPTO_ENROLL_NEEDED;
+#else
+    return component_slot_load(slot, addr, key, sizeof(key));
+#endif
+}
+
+#ifdef COMPONENT_ENROLL
+/**
+ * @brief Checks a component's enrollment certificate.
+ *
+ * @param ca_pub Deployment public key the certificate must be signed with.
+ * @param cert Certificate, see ENROLL_CERT_LEN.
+ *
+ * @return 0 if the signature is good, negative wolfCrypt error code otherwise.
+ */
+int crypto_enroll_verify(const uint8_t ca_pub[ENROLL_PUB_LEN], const uint8_t cert[ENROLL_CERT_LEN])
+{
+    const uint8_t *sig = cert + 4 + ENROLL_PUB_LEN;
+    uint8_t digest[HASH_LEN];
+    ecc_key ca;
+    mp_int r, s;
+    int valid = 0;
+
+    hash((uint8_t *)cert, digest, 4 + ENROLL_PUB_LEN);
+
+    int ret = wc_ecc_init_ex(&ca, crypto_heap(), INVALID_DEVID);
+    if (ret != 0) {
+        return ret;
+    }
+    ret = wc_ecc_import_unsigned(&ca, ca_pub, ca_pub + ENROLL_PUB_LEN / 2, NULL, ECC_SECP256R1);
+    if (ret == 0) {
+        ret = mp_init_multi(&r, &s, NULL, NULL, NULL, NULL);
+    }
+    if (ret == 0) {
+        ret = mp_read_unsigned_bin(&r, sig, ENROLL_SIG_LEN / 2);
+    }
+    if (ret == 0) {
+        ret = mp_read_unsigned_bin(&s, sig + ENROLL_SIG_LEN / 2, ENROLL_SIG_LEN / 2);
+    }
+    if (ret == 0) {
+        ret = wc_ecc_verify_hash_ex(&r, &s, digest, HASH_LEN, &valid, &ca);
+    }
+    mp_clear(&r);
+    mp_clear(&s);
+    wc_ecc_free(&ca);
+
+    if (ret == 0 && valid != 1) {
+        ret = SIG_VERIFY_E;
+    }
+    return ret;
+}
+
+/**
+ * @brief Runs our ECDH with the other end of a component link.
+ *
+ * The peer's public key is not checked here: the AP only passes keys from
+ * certificates that passed crypto_enroll_verify, a component the AP key it
+ * was built with. The selected key is left alone.
+ *
+ * @param priv Our private scalar.
+ * @param peer_pub Public key of the other end.
+ * @param secret Receives the shared secret.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+int crypto_enroll_secret(const uint8_t priv[ENROLL_PRIV_LEN], const uint8_t peer_pub[ENROLL_PUB_LEN],
+                         uint8_t secret[ENROLL_SECRET_LEN])
+{
+    word32 secret_len = ENROLL_SECRET_LEN;
+    ecc_key own, peer;
+
+    int ret = wc_ecc_init_ex(&own, crypto_heap(), INVALID_DEVID);
+    if (ret != 0) {
+        return ret;
+    }
+    ret = wc_ecc_init_ex(&peer, crypto_heap(), INVALID_DEVID);
+    if (ret != 0) {
+        wc_ecc_free(&own);
+        return ret;
+    }
+
+    ret = wc_ecc_import_private_key_ex(priv, ENROLL_PRIV_LEN, NULL, 0, &own, ECC_SECP256R1);
+    if (ret == 0) {
+        ret = wc_ecc_import_unsigned(&peer, peer_pub, peer_pub + ENROLL_PUB_LEN / 2, NULL, ECC_SECP256R1);
+    }
+    if (ret == 0) {
+        ret = wc_ecc_shared_secret(&own, &peer, secret, &secret_len);
+    }
+    if (ret == 0 && secret_len != ENROLL_SECRET_LEN) {
+        ret = ECC_BAD_ARG_E;
+    }
+
+    wc_ecc_free(&own);
+    wc_ecc_free(&peer);
+    if (ret != 0) {
+        memset(secret, 0, ENROLL_SECRET_LEN);
+    }
+    return ret;
+}
+
+/**
+ * @brief Loads and selects a component key from an ECDH secret.
+ *
+ * The key is HKDF-SHA256(ECDH secret, info = label | addr), the same label
+ * as device key derived component keys.
+ *
+ * @param addr I2C address of the component.
+ * @param secret Secret from crypto_enroll_secret.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+int crypto_enroll_resume(uint8_t addr, const uint8_t secret[ENROLL_SECRET_LEN])
+{
+    if (!session.ready) {
+        int ret = crypto_init();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    return component_slot_load(component_slot_find(addr), addr, secret, ENROLL_SECRET_LEN);
+}
+
+/**
+ * @brief Enrolls a component, loading the key derived from our ECDH secret.
+ *
+ * @param addr I2C address of the component.
+ * @param priv Our private scalar.
+ * @param peer_pub Public key of the other end.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+int crypto_enroll(uint8_t addr, const uint8_t priv[ENROLL_PRIV_LEN], const uint8_t peer_pub[ENROLL_PUB_LEN])
+{
+    uint8_t secret[ENROLL_SECRET_LEN];
+
+    int ret = crypto_enroll_secret(priv, peer_pub, secret);
+    if (ret == 0) {
+        ret = crypto_enroll_resume(addr, secret);
+    }
+    memset(secret, 0, sizeof(secret));
+    return ret;
+}
+#endif
+
+/**
+ * @brief Switches the AES routines back to the device key.
+ */
+void crypto_use_device_key(void)
+{
+    crypto_use_base(&session, key);
+}
+#endif
+
+/**
+ * @brief Encrypts the input using AES in CBC mode.
+ *
+ * The name is parenthesized so the dispatching macro of crypto_util.h does
+ * not expand here.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the output buffer where the encrypted data will be stored.
+ * @param iv Initialization vector.
+ * @param len Length of the input data.
+ */
+HOT void (aes_encrypt)(uint8_t *in, uint8_t *out, uint8_t iv[IV_SIZE], size_t len) 
+{
+    // Ensure valid length
+    if (len <= 0 || len % BLOCK_SIZE) {
+        return; //Invalid length
+    }
+    aes_encrypt_blocks(in, out, iv, len);
+}
+
+/**
+ * @brief Encrypts whole blocks using AES in CBC mode, length unchecked.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the output buffer where the encrypted data will be stored.
+ * @param iv Initialization vector.
+ * @param len Length of the input data, a nonzero multiple of BLOCK_SIZE.
+ */
+HOT void aes_encrypt_blocks(uint8_t *in, uint8_t *out, uint8_t iv[IV_SIZE], size_t len)
+{
+    if (!session.ready && crypto_init() != 0) {
+        return;
+    }
+
+    TRACE_ENTER(TRACE_AES_ENCRYPT);
+#ifdef AES_CT
+    if (active->devId == INVALID_DEVID) {
+        aes_ct_cbc_encrypt(&active->ct, iv, in, out, len);
+    } else
+#endif
+    {
+        wc_AesSetIV(&active->enc, iv); // Only the IV changes per message
+        wc_AesCbcEncrypt(&active->enc, out, in, len); // Encrypt the input
+    }
+    TRACE_EXIT(TRACE_AES_ENCRYPT);
+}
+
+/**
+ * @brief Decrypts the input using AES in CBC mode.
+ *
+ * @param in Pointer to the input data.
+ * @param iv Initialization vector.
+ * @param out Pointer to the output buffer where the decrypted data will be stored.
+ * @param len Length of the input data.
+ */
+HOT void (aes_decrypt)(uint8_t *in, uint8_t *out, uint8_t iv[IV_SIZE], size_t len)
+{
+    // Ensure valid length
+    if (len <= 0 || len % BLOCK_SIZE) {
+        return; //Invalid length
+    }
+    aes_decrypt_blocks(in, out, iv, len);
+}
+
+/**
+ * @brief Decrypts whole blocks using AES in CBC mode, length unchecked.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the output buffer where the decrypted data will be stored.
+ * @param iv Initialization vector.
+ * @param len Length of the input data, a nonzero multiple of BLOCK_SIZE.
+ */
+HOT void aes_decrypt_blocks(uint8_t *in, uint8_t *out, uint8_t iv[IV_SIZE], size_t len)
+{
+    if (!session.ready && crypto_init() != 0) {
+        return;
+    }
+
+    TRACE_ENTER(TRACE_AES_DECRYPT);
+#ifdef AES_CT
+    if (active->devId == INVALID_DEVID) {
+        aes_ct_cbc_decrypt(&active->ct, iv, in, out, len);
+    } else
+#elif defined(AES_TT)
+    if (active->devId == INVALID_DEVID) {
+        aes_tt_cbc_decrypt((const uint32_t *)active->dec.key, iv, in, out, len);
+    } else
+#endif
+    {
+        wc_AesSetIV(&active->dec, iv); // Only the IV changes per message
+        wc_AesCbcDecrypt(&active->dec, out, in, len); // Decrypt the input
+    }
+    TRACE_EXIT(TRACE_AES_DECRYPT);
+}
+
+#ifdef MSG_CTR
+/**
+ * @brief Encrypts or decrypts the input using AES in CTR mode.
+ *
+ * Only the encryption key schedule is used, both directions are the same
+ * keystream XOR, so the length does not need to be a multiple of a block.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the output buffer, may be the same as in.
+ * @param iv Initial counter block.
+ * @param len Length of the input data.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+HOT int aes_ctr_crypt(const uint8_t *in, uint8_t *out, const uint8_t iv[IV_SIZE], size_t len)
+{
+    if (!session.ready) {
+        int ret = crypto_init();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    TRACE_ENTER(TRACE_AES_ENCRYPT);
+#ifdef AES_CT
+    if (active->devId == INVALID_DEVID) {
+        // The wolfCrypt contexts are only set up for the AES engine
+        uint8_t ctr[BLOCK_SIZE];
+        uint8_t ks[BLOCK_SIZE];
+        memcpy(ctr, iv, BLOCK_SIZE);
+        for (size_t pos = 0; pos < len; pos += BLOCK_SIZE) {
+            aes_ct_encrypt_block(&active->ct, ctr, ks);
+            size_t n = (len - pos < BLOCK_SIZE) ? len - pos : BLOCK_SIZE;
+            for (size_t i = 0; i < n; i++) {
+                out[pos + i] = in[pos + i] ^ ks[i];
+            }
+            // Count up big endian
+            for (int i = BLOCK_SIZE - 1; i >= 0; i--) {
+                if (++ctr[i] != 0) {
+                    break;
+                }
+            }
+        }
+        memset(ks, 0, sizeof(ks));
+        TRACE_EXIT(TRACE_AES_ENCRYPT);
+        return 0;
+    }
+#endif
+    wc_AesSetIV(&active->enc, iv); // Also drops keystream left from the last call
+    int ret = wc_AesCtrEncrypt(&active->enc, out, in, len);
+    TRACE_EXIT(TRACE_AES_ENCRYPT);
+    return ret;
+}
+
+/**
+ * @brief Draws a fresh random IV.
+ *
+ * @param iv Buffer for the IV.
+ */
+static void ctr_draw_iv(uint8_t iv[IV_SIZE])
+{
+    uint64_t randValue = rng_gen();
+    memcpy(&iv[0], &randValue, sizeof(randValue));
+    randValue = rng_gen();
+    memcpy(&iv[8], &randValue, sizeof(randValue));
+}
+
+/**
+ * @brief Fills one empty slot of the keystream pool.
+ *
+ * Costs one IV and CTR_KEYSTREAM_LEN bytes of AES, so idle loops can call it
+ * repeatedly and still react quickly once they have something to do. With
+ * RISCV_KEYSTREAM and the RISC-V core running, the AES runs there and this
+ * only copies a finished keystream over.
+ *
+ * @return Nonzero if a slot was filled, 0 if there was nothing to do.
+ */
+int ctr_pool_fill(void)
+{
+    if (active != base || (!session.ready && crypto_init() != 0)) {
+        return 0;
+    }
+    for (unsigned i = 0; i < CTR_POOL_LEN; i++) {
+        ctr_slot_t *slot = &ctr_pool[(ctr_next + i) % CTR_POOL_LEN];
+        if (slot->owner == active) {
+            continue;
+        }
+#ifdef RISCV_KEYSTREAM
+        if (rv_keystream_running()) {
+            // The RISC-V core makes the keystreams, this only collects them
+            if (!rv_keystream_take(&active->ct, ctr_draw_iv, slot->iv, slot->keystream)) {
+                return 0;
+            }
+            slot->owner = active;
+            return 1;
+        }
+#endif
+        ctr_draw_iv(slot->iv);
+        memset(slot->keystream, 0, CTR_KEYSTREAM_LEN);
+        if (aes_ctr_crypt(slot->keystream, slot->keystream, slot->iv, CTR_KEYSTREAM_LEN) != 0) {
+            memset(slot, 0, sizeof(*slot));
+            return 0;
+        }
+        slot->owner = active;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Encrypts in place with AES-CTR under a fresh IV.
+ *
+ * Uses the oldest pooled keystream when it was made under the key in use.
+ * The slot is wiped right after, no keystream is ever used twice.
+ *
+ * @param buf Data to encrypt in place.
+ * @param len Length of the data.
+ * @param iv Buffer for the IV the data was encrypted under.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+HOT int aes_ctr_seal(uint8_t *buf, size_t len, uint8_t iv[IV_SIZE])
+{
+    ctr_slot_t *slot = &ctr_pool[ctr_next];
+    if (slot->owner == active && len <= CTR_KEYSTREAM_LEN) {
+        memcpy(iv, slot->iv, IV_SIZE);
+        for (size_t i = 0; i < len; i++) {
+            buf[i] ^= slot->keystream[i];
+        }
+        memset(slot, 0, sizeof(*slot));
+        ctr_next = (ctr_next + 1) % CTR_POOL_LEN;
+        return 0;
+    }
+
+    ctr_draw_iv(iv);
+    return aes_ctr_crypt(buf, buf, iv, len);
+}
+#endif
+
+/**
+ * @brief Decrypts a single block with the session key, without chaining.
+ *
+ * Only reads the expanded key schedule, so it may run from an interrupt
+ * while a CBC operation is in progress.
+ *
+ * @param in Pointer to the 16 byte input block.
+ * @param out Pointer to the 16 byte output block.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+FASTCODE int aes_decrypt_block(const uint8_t *in, uint8_t *out)
+{
+    if (!session.ready) {
+        return BAD_STATE_E;
+    }
+#ifdef AES_CT
+    if (active->devId == INVALID_DEVID) {
+        aes_ct_decrypt_block(&active->ct, in, out);
+        return 0;
+    }
+#endif
+    return wc_AesDecryptDirect(&active->dec, out, in);
+}
+
+#ifdef MSG_AEAD_ASCON
+/**
+ * @brief Encrypts and authenticates the input using Ascon-128.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the output buffer where the encrypted data will be stored.
+ * @param nonce Nonce, must never repeat under the same key.
+ * @param tag Buffer where the authentication tag will be stored.
+ * @param len Length of the input data.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+HOT int aead_encrypt(uint8_t *in, uint8_t *out, uint8_t nonce[AEAD_NONCE_LEN], uint8_t tag[AEAD_TAG_LEN], size_t len)
+{
+    if (!session.ready) {
+        int ret = crypto_init();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    TRACE_ENTER(TRACE_AES_ENCRYPT);
+    ascon_encrypt(&active->ascon, nonce, in, out, len, tag);
+    TRACE_EXIT(TRACE_AES_ENCRYPT);
+    return 0;
+}
+
+/**
+ * @brief Decrypts the input using Ascon-128 and verifies its authentication tag.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the output buffer where the decrypted data will be stored.
+ * @param nonce Nonce the data was encrypted with.
+ * @param tag Authentication tag received with the data.
+ * @param len Length of the input data.
+ *
+ * @return 0 if the tag verifies, negative wolfCrypt error code otherwise.
+ */
+HOT int aead_decrypt(uint8_t *in, uint8_t *out, uint8_t nonce[AEAD_NONCE_LEN], uint8_t tag[AEAD_TAG_LEN], size_t len)
+{
+    if (!session.ready) {
+        int ret = crypto_init();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    TRACE_ENTER(TRACE_AES_DECRYPT);
+    int ret = ascon_decrypt(&active->ascon, nonce, in, out, len, tag) == 0 ? 0 : MAC_CMP_FAILED_E;
+    TRACE_EXIT(TRACE_AES_DECRYPT);
+    return ret;
+}
+#elif defined(HAVE_AESGCM)
+/**
+ * @brief Encrypts and authenticates the input using AES-GCM.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the output buffer where the encrypted data will be stored.
+ * @param nonce Nonce, must never repeat under the same key.
+ * @param tag Buffer where the authentication tag will be stored.
+ * @param len Length of the input data.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+HOT int aead_encrypt(uint8_t *in, uint8_t *out, uint8_t nonce[AEAD_NONCE_LEN], uint8_t tag[AEAD_TAG_LEN], size_t len)
+{
+    if (!session.ready) {
+        int ret = crypto_init();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    TRACE_ENTER(TRACE_AES_ENCRYPT);
+    int ret = wc_AesGcmEncrypt(&active->gcm, out, in, len, nonce, AEAD_NONCE_LEN,
+                               tag, AEAD_TAG_LEN, NULL, 0);
+    TRACE_EXIT(TRACE_AES_ENCRYPT);
+    return ret;
+}
+
+/**
+ * @brief Decrypts the input using AES-GCM and verifies its authentication tag.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the output buffer where the decrypted data will be stored.
+ * @param nonce Nonce the data was encrypted with.
+ * @param tag Authentication tag received with the data.
+ * @param len Length of the input data.
+ *
+ * @return 0 if the tag verifies, negative wolfCrypt error code otherwise.
+ */
+HOT int aead_decrypt(uint8_t *in, uint8_t *out, uint8_t nonce[AEAD_NONCE_LEN], uint8_t tag[AEAD_TAG_LEN], size_t len)
+{
+    if (!session.ready) {
+        int ret = crypto_init();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    TRACE_ENTER(TRACE_AES_DECRYPT);
+    int ret = wc_AesGcmDecrypt(&active->gcm, out, in, len, nonce, AEAD_NONCE_LEN,
+                               tag, AEAD_TAG_LEN, NULL, 0);
+    TRACE_EXIT(TRACE_AES_DECRYPT);
+    return ret;
+}
+#endif
+
+/**
+ * @brief Computes the SHA-256 hash of the input data.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the buffer where the hash will be stored.
+ * @param len Length of the input data.
+ */
+HOT void hash(uint8_t *in, uint8_t out[HASH_LEN], size_t len)
+{
+   TRACE_ENTER(TRACE_HASH);
+   Sha256 sha256[1]; // Context for SHA-256
+   wc_InitSha256_ex(sha256, crypto_heap(), session.ready ? session.devId : INVALID_DEVID); // Initialize the SHA-256 context
+   wc_Sha256Update(sha256, in, len); // Hash the input
+   wc_Sha256Final(sha256, out); // Store the hash in out
+   TRACE_EXIT(TRACE_HASH);
+}
+
+/**
+ * @brief Computes the SHA-256 hashes of several independent buffers.
+ *
+ * For the AP verifying the replies a pipelined exchange collected. One
+ * context serves every buffer, wc_Sha256Final leaves it ready for the
+ * next, so the context setup and the trace region are paid once per batch.
+ * The blocks themselves still go through the transform one buffer at a
+ * time: the M4 has no SIMD lanes to run several message schedules in, and
+ * the transform already holds its eight working variables in r4-r11.
+ *
+ * @param in Inputs.
+ * @param out Buffers the hashes are stored in, out[i] for in[i].
+ * @param len Lengths of the inputs.
+ * @param count Number of inputs.
+ */
+void hash_many(uint8_t *const in[], uint8_t out[][HASH_LEN], const size_t len[], size_t count)
+{
+    TRACE_ENTER(TRACE_HASH);
+    Sha256 sha256[1];
+    wc_InitSha256_ex(sha256, crypto_heap(), session.ready ? session.devId : INVALID_DEVID);
+    for (size_t i = 0; i < count; i++) {
+        wc_Sha256Update(sha256, in[i], len[i]);
+        wc_Sha256Final(sha256, out[i]);
+    }
+    wc_Sha256Free(sha256);
+    TRACE_EXIT(TRACE_HASH);
+}
+
+/**
+ * @brief Computes the HMAC-SHA256 of the input data under the device key.
+ *
+ * Runs from the midstates crypto_init precomputed for the device key.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the buffer where the MAC will be stored.
+ * @param len Length of the input data.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+HOT int hmac(uint8_t *in, uint8_t out[HASH_LEN], size_t len)
+{
+    int ret = session.ready ? 0 : crypto_init();
+    if (ret != 0) {
+        return ret;
+    }
+
+    TRACE_ENTER(TRACE_HASH);
+    ret = crypto_mac(&session.mac, in, len, out);
+    TRACE_EXIT(TRACE_HASH);
+    return ret;
+}
+
+/**
+ * @brief Computes the HMAC-SHA256 of the input data under a given key.
+ *
+ * Expands the key on every call, for the rare MACs under a key no session
+ * holds, e.g. the key store's under the deployment key.
+ *
+ * @param k Pointer to the key.
+ * @param k_len Length of the key.
+ * @param in Pointer to the input data.
+ * @param out Pointer to the buffer where the MAC will be stored.
+ * @param len Length of the input data.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+int hmac_key(const uint8_t *k, size_t k_len, const uint8_t *in, uint8_t out[HASH_LEN], size_t len)
+{
+    Hmac h;
+    int ret = wc_HmacInit(&h, crypto_heap(), INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_HmacSetKey(&h, WC_SHA256, k, k_len);
+    }
+    if (ret == 0) {
+        ret = wc_HmacUpdate(&h, in, len);
+    }
+    if (ret == 0) {
+        ret = wc_HmacFinal(&h, out);
+    }
+    wc_HmacFree(&h);
+    secure_zero(&h, sizeof(h));
+    return ret;
+}
+
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Computes the HMAC-SHA256 of the input data under the key in use.
+ *
+ * Every session precomputes its HMAC midstates when its key is set, so this
+ * costs no more than hmac whichever key is selected.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the buffer where the MAC will be stored.
+ * @param len Length of the input data.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+HOT int hmac_active(uint8_t *in, uint8_t out[HASH_LEN], size_t len)
+{
+    int ret = session.ready ? 0 : crypto_init();
+    if (ret != 0) {
+        return ret;
+    }
+
+    TRACE_ENTER(TRACE_HASH);
+    ret = crypto_mac(&active->mac, in, len, out);
+    TRACE_EXIT(TRACE_HASH);
+    return ret;
+}
+#endif
+
+#ifdef MSG_MAC
+/**
+ * @brief Computes the frame MAC under the key in use.
+ *
+ * HMAC runs from the session's midstates. CMAC works on a copy of the keyed
+ * template, since wolfCrypt wipes a Cmac when it is finalized, so neither
+ * mode expands a key per frame.
+ *
+ * @param in Pointer to the input data.
+ * @param out Pointer to the buffer where the MAC_LEN byte MAC will be stored.
+ * @param len Length of the input data.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+HOT int mac_compute(uint8_t *in, uint8_t out[MAC_LEN], size_t len)
+{
+    int ret = session.ready ? 0 : crypto_init();
+    if (ret != 0) {
+        return ret;
+    }
+
+    TRACE_ENTER(TRACE_HASH);
+#ifdef MSG_MAC_CMAC
+    Cmac ctx;
+    word32 out_len = MAC_LEN;
+    memcpy(&ctx, &active->cmac, sizeof(ctx));
+    ret = wc_CmacUpdate(&ctx, in, len);
+    if (ret == 0) {
+        ret = wc_CmacFinal(&ctx, out, &out_len);
+    }
+    memset(&ctx, 0, sizeof(ctx));
+#else
+    ret = crypto_mac(&active->mac, in, len, out);
+#endif
+    TRACE_EXIT(TRACE_HASH);
+    return ret;
+}
+#endif
@@ -0,0 +1,273 @@
+#include "ctcheck.h"
+
+#ifdef CTCHECK_ENABLE
+
+#include <stdio.h>
+#include <string.h>
+#include "mxc_device.h"
+#include "crypto_util.h"
+#include "general_util.h"
+#include "tiny_printf.h"
+
+// Inputs are drawn a batch at a time, so no RNG runs between measurements
+#define CTCHECK_BATCH 64
+
+// Running mean and variance of one class, Welford's method
+typedef struct {
+    uint32_t n;
+    double mean;
+    double m2;
+} ctcheck_class_t;
+
+static uint8_t batch_in[CTCHECK_BATCH][CTCHECK_MAX_INPUT];
+static uint8_t batch_class[CTCHECK_BATCH];
+
+// Secret the compares run against and the results nothing reads, so the
+// routines under test are not optimized away
+static uint8_t ct_secret[HASH_LEN];
+static uint8_t ct_out[CTCHECK_MAX_INPUT];
+static volatile int ct_sink;
+
+static const uint8_t ct_iv[IV_SIZE] = {
+    0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78,
+    0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1, 0xf0
+};
+
+/**
+ * @brief Fills buf with random bytes.
+ *
+ * @param buf Buffer to fill.
+ * @param len Bytes to fill.
+ */
+static void ct_random(uint8_t *buf, size_t len)
+{
+    while (len > 0) {
+        uint64_t r = rng_gen();
+        size_t n = len < sizeof(r) ? len : sizeof(r);
+        memcpy(buf, &r, n);
+        buf += n;
+        len -= n;
+    }
+}
+
+/**
+ * @brief Adds one measurement to a class.
+ *
+ * @param c Class the measurement belongs to.
+ * @param x Cycles measured.
+ */
+static void ct_add(ctcheck_class_t *c, double x)
+{
+    c->n++;
+    double delta = x - c->mean;
+    c->mean += delta / c->n;
+    c->m2 += delta * (x - c->mean);
+}
+
+/**
+ * @brief Integer square root.
+ *
+ * @param x Value to take the root of.
+ * @return Largest r with r * r <= x.
+ */
+static uint32_t ct_isqrt(uint64_t x)
+{
+    uint64_t r = 0;
+    for (uint64_t bit = 1ull << 62; bit != 0; bit >>= 2) {
+        if (x >= r + bit) {
+            x -= r + bit;
+            r = (r >> 1) + bit;
+        }
+        else {
+            r >>= 1;
+        }
+    }
+    return (uint32_t) r;
+}
+
+/**
+ * @brief Welch's t statistic of the two classes, in hundredths.
+ *
+ * Computed from t squared, so no square root of a double is needed.
+ *
+ * @param a First class.
+ * @param b Second class.
+ * @return t * 100, 0 if either class has fewer than two measurements.
+ */
+static int32_t ct_welch(const ctcheck_class_t *a, const ctcheck_class_t *b)
+{
+    if (a->n < 2 || b->n < 2) {
+        return 0;
+    }
+    double diff = a->mean - b->mean;
+    double se2 = a->m2 / (a->n - 1) / a->n + b->m2 / (b->n - 1) / b->n;
+    if (se2 <= 0) {
+        // No spread at all, equal means are exactly constant time
+        return (diff == 0) ? 0 : (diff > 0 ? INT32_MAX : -INT32_MAX);
+    }
+    double t2 = diff * diff / se2 * 10000.0;
+    int32_t t = (t2 >= (double) INT32_MAX * INT32_MAX) ? INT32_MAX : (int32_t) ct_isqrt((uint64_t) t2);
+    return (diff < 0) ? -t : t;
+}
+
+/**
+ * @brief Tests one routine for data dependent timing.
+ *
+ * Each batch draws the class of every measurement and the random inputs
+ * first, then times the routine on every input of the batch with
+ * interrupts masked.
+ *
+ * @param name Name the routine is reported under.
+ * @param fn Runs the routine once.
+ * @param fixed Input of the fixed class.
+ * @param len Bytes of every input, at most CTCHECK_MAX_INPUT.
+ * @param print Prints the report line.
+ * @return 1 if the routine leaks, 0 otherwise.
+ */
+int ctcheck_test(const char *name, ctcheck_fn_t fn, const uint8_t *fixed, size_t len, ctcheck_print_t print)
+{
+    ctcheck_class_t classes[2] = {0};
+    char line[96];
+
+    for (uint32_t done = 0; done < CTCHECK_SAMPLES; done += CTCHECK_BATCH) {
+        for (int i = 0; i < CTCHECK_BATCH; i++) {
+            batch_class[i] = rng_gen() & 1;
+            if (batch_class[i] == 0) {
+                memcpy(batch_in[i], fixed, len);
+            }
+            else {
+                ct_random(batch_in[i], len);
+            }
+        }
+        for (int i = 0; i < CTCHECK_BATCH; i++) {
+            uint32_t primask = __get_PRIMASK();
+            __disable_irq();
+            uint32_t start = DWT->CYCCNT;
+            fn(batch_in[i]);
+            uint32_t cycles = DWT->CYCCNT - start;
+            __set_PRIMASK(primask);
+            ct_add(&classes[batch_class[i]], cycles);
+        }
+    }
+
+    int32_t t = ct_welch(&classes[0], &classes[1]);
+    int leaks = (t > CTCHECK_T_LIMIT || t < -CTCHECK_T_LIMIT);
+    uint32_t t_abs = (t < 0) ? -t : t;
+#ifdef TINY_PRINTF
+    tiny_snprintf(line, sizeof(line), "C %s n=%lu fixed=%lu random=%lu t=%s%lu.%02lu %s", name,
+#else
+    snprintf(line, sizeof(line), "C %s n=%lu fixed=%lu random=%lu t=%s%lu.%02lu %s", name,
+#endif
+             (unsigned long) (classes[0].n + classes[1].n), (unsigned long) classes[0].mean,
+             (unsigned long) classes[1].mean, (t < 0) ? "-" : "", (unsigned long) (t_abs / 100),
+             (unsigned long) (t_abs % 100), leaks ? "LEAK" : "ok");
+    print(!leaks, line);
+    memset(batch_in, 0, sizeof(batch_in));
+    return leaks;
+}
+
+// Fixed class: equal to the secret, random class: almost never
+static void ct_secure_memcmp(const uint8_t *in)
+{
+    ct_sink = secure_memcmp(in, ct_secret, HASH_LEN);
+}
+
+// The check msg_open makes on a frame: recompute it, then compare in place
+static void ct_frame_check(const uint8_t *in)
+{
+    uint8_t check[HASH_LEN];
+#ifdef MSG_MAC
+    mac_compute(ct_out, check, CTCHECK_MAX_INPUT);
+    ct_sink = secure_memcmp(in, check, MAC_LEN);
+#else
+    hash(ct_out, check, CTCHECK_MAX_INPUT);
+    ct_sink = secure_memcmp(in, check, HASH_LEN);
+#endif
+}
+
+static void ct_hmac(const uint8_t *in)
+{
+    ct_sink = hmac((uint8_t *) in, ct_out, CTCHECK_MAX_INPUT);
+}
+
+static void ct_aes_encrypt(const uint8_t *in)
+{
+    uint8_t iv[IV_SIZE];
+    memcpy(iv, ct_iv, IV_SIZE);
+    aes_encrypt((uint8_t *) in, ct_out, iv, CTCHECK_MAX_INPUT);
+}
+
+static void ct_aes_decrypt(const uint8_t *in)
+{
+    uint8_t iv[IV_SIZE];
+    memcpy(iv, ct_iv, IV_SIZE);
+    aes_decrypt((uint8_t *) in, ct_out, iv, CTCHECK_MAX_INPUT);
+}
+
+static void ct_aes_decrypt_block(const uint8_t *in)
+{
+    ct_sink = aes_decrypt_block(in, ct_out);
+}
+
+#ifdef MSG_CTR
+static void ct_aes_ctr(const uint8_t *in)
+{
+    ct_sink = aes_ctr_crypt(in, ct_out, ct_iv, CTCHECK_MAX_INPUT);
+}
+#endif
+
+#ifdef MSG_AEAD
+// GCM or Ascon, whichever frames are sealed with
+static void ct_aead_encrypt(const uint8_t *in)
+{
+    uint8_t tag[AEAD_TAG_LEN];
+    ct_sink = aead_encrypt((uint8_t *) in, ct_out, (uint8_t *) ct_iv, tag, CTCHECK_MAX_INPUT);
+}
+#endif
+
+/**
+ * @brief Tests every shared routine a check or the secrets go through.
+ *
+ * @param print Prints one line of the report.
+ * @return Number of routines that leak.
+ */
+int ctcheck_run(ctcheck_print_t print)
+{
+    uint8_t fixed[CTCHECK_MAX_INPUT];
+    int leaks = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    ct_random(ct_secret, sizeof(ct_secret));
+    leaks += ctcheck_test("secure_memcmp", ct_secure_memcmp, ct_secret, HASH_LEN, print);
+
+    // The fixed tag is the right one for the message being checked
+    ct_random(ct_out, CTCHECK_MAX_INPUT);
+#ifdef MSG_MAC
+    mac_compute(ct_out, fixed, CTCHECK_MAX_INPUT);
+    leaks += ctcheck_test("frame_check", ct_frame_check, fixed, MAC_LEN, print);
+#else
+    hash(ct_out, fixed, CTCHECK_MAX_INPUT);
+    leaks += ctcheck_test("frame_check", ct_frame_check, fixed, HASH_LEN, print);
+#endif
+
+    // The rest run on a fixed input of zeros, the classic worst case
+    memset(fixed, 0, sizeof(fixed));
+    leaks += ctcheck_test("hmac", ct_hmac, fixed, CTCHECK_MAX_INPUT, print);
+    leaks += ctcheck_test("aes_encrypt", ct_aes_encrypt, fixed, CTCHECK_MAX_INPUT, print);
+    leaks += ctcheck_test("aes_decrypt", ct_aes_decrypt, fixed, CTCHECK_MAX_INPUT, print);
+    leaks += ctcheck_test("aes_decrypt_block", ct_aes_decrypt_block, fixed, IV_SIZE, print);
+#ifdef MSG_CTR
+    leaks += ctcheck_test("aes_ctr_crypt", ct_aes_ctr, fixed, CTCHECK_MAX_INPUT, print);
+#endif
+#ifdef MSG_AEAD
+    leaks += ctcheck_test("aead_encrypt", ct_aead_encrypt, fixed, CTCHECK_MAX_INPUT, print);
+#endif
+
+    memset(ct_secret, 0, sizeof(ct_secret));
+    memset(ct_out, 0, sizeof(ct_out));
+    return leaks;
+}
+
+#endif
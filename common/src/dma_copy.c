@@ -0,0 +1,212 @@
+/**
+ * @file dma_copy.c
+ * @brief Memory to memory copies and fills on a DMA channel
+ * @date 2024
+ *
+ * See dma_copy.h. The channel's completion interrupt goes through the MSDK's
+ * MXC_DMA_Handler, as the AP's I2C DMA channels do, which calls back
+ * dma_copy_done.
+ */
+
+#include "dma_copy.h"
+
+#ifdef DMA_COPY
+
+#include <stdbool.h>
+
+#include "mxc_device.h"
+#include "mxc_errors.h"
+#include "dma.h"
+#include "nvic_table.h"
+#include "irq_events.h"
+
+// Channel of the service, -1 until dma_copy_init acquired one
+static int copy_ch = -1;
+// Set while a transfer runs, cleared by its completion interrupt
+static volatile bool copy_busy;
+static dma_copy_cb_t copy_cb;
+static void *copy_arg;
+// Source of fills, the fill value in every byte
+static uint32_t fill_word;
+
+/**
+ * @brief DMA interrupt handler of the channel.
+ */
+static void dma_copy_irq(void)
+{
+    MXC_DMA_Handler();
+}
+
+/**
+ * @brief Completion callback of the channel, from MXC_DMA_Handler.
+ *
+ * @param ch Channel that completed.
+ * @param result Result of the transfer, the buffers are released either way.
+ */
+static void dma_copy_done(int ch, int result)
+{
+    (void)ch;
+    (void)result;
+    dma_copy_cb_t cb = copy_cb;
+    void *arg = copy_arg;
+    copy_cb = NULL;
+    copy_busy = false;
+    if (cb != NULL) {
+        cb(arg);
+    }
+}
+
+/**
+ * @brief Acquires the channel and routes its interrupt.
+ *
+ * @return 0 on success, -1 if transfers stay on the CPU.
+ */
+int dma_copy_init(void)
+{
+    // The I2C drivers may have initialized the controller already
+    int ret = MXC_DMA_Init();
+    if (ret != E_NO_ERROR && ret != E_BAD_STATE) {
+        return -1;
+    }
+    int ch = MXC_DMA_AcquireChannel();
+    if (ch < 0) {
+        return -1;
+    }
+    MXC_DMA_SetCallback(ch, dma_copy_done);
+    MXC_NVIC_SetVector(MXC_DMA_CH_GET_IRQ(ch), dma_copy_irq);
+    NVIC_SetPriority(MXC_DMA_CH_GET_IRQ(ch), IRQ_PRIO_COPY);
+    NVIC_EnableIRQ(MXC_DMA_CH_GET_IRQ(ch));
+    copy_ch = ch;
+    return 0;
+}
+
+/**
+ * @brief Runs one transfer on the channel, or on the CPU.
+ *
+ * @param dst Destination.
+ * @param src Source, NULL to fill.
+ * @param value Fill value, unused for copies.
+ * @param len Bytes to move.
+ * @param cb Completion callback or NULL.
+ * @param arg Argument of cb.
+ */
+static void dma_copy_run(void *dst, const void *src, uint8_t value, size_t len,
+                         dma_copy_cb_t cb, void *arg)
+{
+    dma_copy_wait();
+
+    bool fill = (src == NULL);
+    if (fill) {
+        fill_word = value * 0x01010101u;
+        src = &fill_word;
+    }
+
+    if (copy_ch >= 0 && len >= DMA_COPY_MIN) {
+        int width = (((uintptr_t)dst | (uintptr_t)src | len) % 4 == 0) ? MXC_DMA_WIDTH_WORD : MXC_DMA_WIDTH_BYTE;
+        mxc_dma_config_t config;
+        config.ch = copy_ch;
+        config.reqsel = MXC_DMA_REQUEST_MEMTOMEM;
+        config.srcwd = width;
+        config.dstwd = width;
+        config.srcinc_en = !fill;
+        config.dstinc_en = 1;
+
+        mxc_dma_srcdst_t srcdst;
+        srcdst.ch = copy_ch;
+        srcdst.source = (void *)src;
+        srcdst.dest = dst;
+        srcdst.len = len;
+
+        if (MXC_DMA_ConfigChannel(config, srcdst) == E_NO_ERROR) {
+            copy_cb = cb;
+            copy_arg = arg;
+            copy_busy = true;
+            MXC_DMA_ChannelEnableInt(copy_ch, MXC_F_DMA_CTRL_CTZ_IE);
+            MXC_DMA_EnableInt(copy_ch);
+            MXC_DMA_Start(copy_ch);
+            return;
+        }
+    }
+
+    if (fill) {
+        memset(dst, value, len);
+    } else {
+        memcpy(dst, src, len);
+    }
+    if (cb != NULL) {
+        cb(arg);
+    }
+}
+
+/**
+ * @brief Starts copying len bytes from src to dst.
+ *
+ * @param dst Destination, left alone until the copy completes.
+ * @param src Source, left alone until the copy completes.
+ * @param len Bytes to copy.
+ * @param cb Called once done, or NULL.
+ * @param arg Argument of cb.
+ */
+void dma_copy_start(void *dst, const void *src, size_t len, dma_copy_cb_t cb, void *arg)
+{
+    dma_copy_run(dst, src, 0, len, cb, arg);
+}
+
+/**
+ * @brief Starts setting len bytes of dst to value.
+ *
+ * @param dst Destination, left alone until the fill completes.
+ * @param value Byte to fill with.
+ * @param len Bytes to fill.
+ * @param cb Called once done, or NULL.
+ * @param arg Argument of cb.
+ */
+void dma_fill_start(void *dst, uint8_t value, size_t len, dma_copy_cb_t cb, void *arg)
+{
+    dma_copy_run(dst, NULL, value, len, cb, arg);
+}
+
+/**
+ * @brief Sleeps until the transfer running, if any, has completed.
+ *
+ * Checked with interrupts masked, so the completion cannot slip in between
+ * the check and the sleep. A pending interrupt still ends the sleep.
+ */
+void dma_copy_wait(void)
+{
+    while (copy_busy) {
+        __disable_irq();
+        if (copy_busy) {
+            __WFI();
+        }
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief Copies len bytes from src to dst and waits for it.
+ *
+ * @param dst Destination.
+ * @param src Source.
+ * @param len Bytes to copy.
+ */
+void dma_copy(void *dst, const void *src, size_t len)
+{
+    dma_copy_start(dst, src, len, NULL, NULL);
+    dma_copy_wait();
+}
+
+/**
+ * @brief Sets len bytes of dst to value and waits for it.
+ *
+ * @param dst Destination.
+ * @param value Byte to fill with.
+ * @param len Bytes to fill.
+ */
+void dma_fill(void *dst, uint8_t value, size_t len)
+{
+    dma_fill_start(dst, value, len, NULL, NULL);
+    dma_copy_wait();
+}
+
+#endif
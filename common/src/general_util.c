@@ -0,0 +1,485 @@
+#include "general_util.h"
+#include "crypto_util.h"
+#include "trace.h"
+#include "irq_events.h"
+
+#ifdef DELAY_SLEEP
+#include <stdbool.h>
+#include "tmr.h"
+
+#ifndef DELAY_TIMER
+#define DELAY_TIMER MXC_TMR5 // Low-power timer, keeps running while the core sleeps
+#endif
+// Nominal rate of the internal 8 kHz oscillator the timer runs from
+#define DELAY_TIMER_HZ 8000
+#endif
+
+#ifdef RNG_POOL
+#include "wolfssl/wolfcrypt/random.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+
+#ifndef WC_RNG_SEED_CB
+#error "RNG_POOL seeds the DRBG through WC_RNG_SEED_CB"
+#endif
+
+// Bytes of DRBG output handed out between refills (multiple of 8)
+#define RNG_POOL_LEN 64
+// Bytes of TRNG entropy collected in the background for each reseed
+#define RNG_ENTROPY_LEN 32
+
+/*
+   Continuous health tests of SP 800-90B 4.4 on every TRNG byte that goes
+   into the DRBG, with bytes as the samples and an assumed min-entropy of
+   RNG_HEALTH_H bits per byte, false alarms at alpha = 2^-20:
+   - Repetition count: RNG_RCT_CUTOFF = 1 + ceil(20 / H) equal bytes in a row
+   - Adaptive proportion: RNG_APT_CUTOFF or more copies of the first byte
+     of a RNG_APT_WINDOW byte window, the 90B table value for H
+   The background blocks are tested in the TRNG interrupt as they complete
+   and the seed reads where they are taken, never in rng_gen. A failed
+   block is dropped and collected again, RNG_HEALTH_MAX_FAILS of them in a
+   row take the source for broken and rng_gen stops.
+*/
+#define RNG_HEALTH_H 2
+#define RNG_RCT_CUTOFF 11
+#define RNG_APT_WINDOW 512
+#define RNG_APT_CUTOFF 177
+#define RNG_HEALTH_MAX_FAILS 4
+// Bytes run through the tests at startup before the first seed, 90B 4.3
+#define RNG_HEALTH_STARTUP_LEN 1024
+
+// State of the tests, carried from one block to the next
+typedef struct {
+    uint8_t rct_value;
+    uint8_t rct_run;
+    uint8_t apt_ref;
+    uint16_t apt_seen;
+    uint16_t apt_count;
+} rng_health_t;
+
+static WC_RNG drbg;
+static uint8_t pool[RNG_POOL_LEN];
+static size_t pool_pos = RNG_POOL_LEN;
+static int drbg_ready = 0;
+
+static uint8_t entropy[RNG_ENTROPY_LEN];
+static volatile int entropy_ready = 0;
+static volatile int entropy_failed = 0;
+
+// The seed reads run in thread mode and the background blocks in the TRNG
+// interrupt, each has its own test state so neither can break into the other
+static rng_health_t seed_health;
+static rng_health_t entropy_health;
+// Failed blocks in a row, and whether the source was given up on
+static volatile uint32_t health_fails = 0;
+static volatile int rng_broken = 0;
+
+/**
+ * @brief Runs the repetition count and adaptive proportion tests on the
+ * next bytes of the TRNG output
+ *
+ * A failure starts both tests over on the next byte.
+ *
+ * @param h test state of this stream of bytes
+ * @param buf bytes as they came from the TRNG
+ * @param len number of bytes
+ *
+ * @return 0 if every byte passed, -1 otherwise
+ */
+static int rng_health_test(rng_health_t *h, const uint8_t *buf, size_t len)
+{
+    int ok = 1;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = buf[i];
+
+        if (h->rct_run > 0 && b == h->rct_value) {
+            if (++h->rct_run >= RNG_RCT_CUTOFF) {
+                ok = 0;
+            }
+        } else {
+            h->rct_value = b;
+            h->rct_run = 1;
+        }
+
+        if (h->apt_seen == 0) {
+            h->apt_ref = b;
+            h->apt_count = 1;
+        } else if (b == h->apt_ref && ++h->apt_count >= RNG_APT_CUTOFF) {
+            ok = 0;
+        }
+        if (++h->apt_seen == RNG_APT_WINDOW) {
+            h->apt_seen = 0;
+        }
+
+        if (!ok) {
+            memset(h, 0, sizeof(*h));
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Counts a block's test result, giving up on the source after
+ * RNG_HEALTH_MAX_FAILS failures in a row
+ *
+ * @param result result of rng_health_test
+ */
+static void rng_health_count(int result)
+{
+    if (result == 0) {
+        health_fails = 0;
+        return;
+    }
+    irq_event_post(IRQ_EVENT_RNG_HEALTH);
+    if (++health_fails >= RNG_HEALTH_MAX_FAILS) {
+        rng_broken = 1;
+    }
+}
+
+/**
+ * @brief Seed callback for the wolfCrypt Hash_DRBG, reads the TRNG directly
+ *
+ * Bytes that fail the health tests are read again, as long as the source
+ * is not given up on.
+ *
+ * @param os unused
+ * @param output buffer to fill with entropy
+ * @param sz number of bytes to fill
+ *
+ * @return 0 on success
+ */
+static int rng_trng_seed(OS_Seed *os, byte *output, word32 sz)
+{
+    (void)os;
+    while (!rng_broken) {
+        if (MXC_TRNG_Random(output, sz) != E_NO_ERROR) {
+            return RNG_FAILURE_E;
+        }
+        int result = rng_health_test(&seed_health, output, sz);
+        rng_health_count(result);
+        if (result == 0) {
+            return 0;
+        }
+    }
+    return RNG_FAILURE_E;
+}
+
+/**
+ * @brief Called from the TRNG interrupt once a background entropy block is
+ * full, tests it before it can be used
+ */
+static void rng_entropy_done(void *req, int result)
+{
+    (void)req;
+    if (result != E_NO_ERROR) {
+        // Nothing usable arrived, rng_refill starts the block over
+        entropy_ready = 0;
+        entropy_failed = 1;
+        return;
+    }
+    int health = rng_health_test(&entropy_health, entropy, RNG_ENTROPY_LEN);
+    rng_health_count(health);
+    entropy_ready = (health == 0);
+    entropy_failed = (health != 0);
+}
+
+/**
+ * @brief Starts collecting the next reseed block from TRNG interrupts
+ */
+static void rng_entropy_start(void)
+{
+    entropy_ready = 0;
+    entropy_failed = 0;
+    MXC_TRNG_RandomAsync(entropy, RNG_ENTROPY_LEN, rng_entropy_done);
+}
+
+/**
+ * @brief Refills the pool from the DRBG, folding in background entropy
+ * first if a block has arrived since the last refill
+ *
+ * @return 0 on success
+ */
+static int rng_refill(void)
+{
+    if (entropy_ready) {
+        if (wc_RNG_DRBG_Reseed(&drbg, entropy, RNG_ENTROPY_LEN) == 0) {
+            memset(entropy, 0, RNG_ENTROPY_LEN);
+            rng_entropy_start();
+        } else {
+            // The block stays ready and is offered again on the next refill
+            irq_event_post(IRQ_EVENT_RNG_RESEED);
+        }
+    } else if (entropy_failed && !rng_broken) {
+        // Dropped by the health tests, collect the block again
+        memset(entropy, 0, RNG_ENTROPY_LEN);
+        rng_entropy_start();
+    }
+
+    if (wc_RNG_GenerateBlock(&drbg, pool, RNG_POOL_LEN) != 0) {
+        return -1;
+    }
+    pool_pos = 0;
+    return 0;
+}
+
+/**
+ * @brief Powers up the TRNG once and seeds the DRBG pool from it
+ *
+ * The health tests see RNG_HEALTH_STARTUP_LEN bytes first. If the DRBG
+ * can't be brought up otherwise, rng_gen falls back to reading the TRNG
+ * directly.
+ */
+void rng_init(void)
+{
+    MXC_TRNG_Init();
+    MXC_NVIC_SetVector(TRNG_IRQn, MXC_TRNG_Handler);
+    NVIC_SetPriority(TRNG_IRQn, IRQ_PRIO_RNG);
+    NVIC_EnableIRQ(TRNG_IRQn);
+
+    // The pool is refilled from the DRBG below, so it serves as scratch
+    for (int done = 0; done < RNG_HEALTH_STARTUP_LEN && !rng_broken; done += RNG_POOL_LEN) {
+        if (MXC_TRNG_Random(pool, RNG_POOL_LEN) != E_NO_ERROR) {
+            break;
+        }
+        rng_health_count(rng_health_test(&seed_health, pool, RNG_POOL_LEN));
+    }
+    memset(pool, 0, RNG_POOL_LEN);
+
+    wc_SetSeed_Cb(rng_trng_seed);
+    if (wc_InitRng_ex(&drbg, crypto_heap(), INVALID_DEVID) != 0) {
+        return;
+    }
+    drbg_ready = 1;
+
+    rng_entropy_start();
+    rng_refill();
+}
+
+/**
+ * @brief Refills the pool if anything was drawn from it since the last refill
+ *
+ * @return 1 if the pool was refilled, 0 if it was full or could not be
+ */
+int rng_pool_fill(void)
+{
+    if (!drbg_ready || pool_pos == 0 || rng_broken) {
+        return 0;
+    }
+    return rng_refill() == 0;
+}
+#else
+/**
+ * @brief No pool to set up, rng_gen powers the TRNG up on every call
+ */
+void rng_init(void)
+{
+}
+#endif
+
+/**
+ * @brief   TRNG Generates 64 bits random number
+ *
+ * @return  A random 64-bit number
+ */
+static uint64_t trng_gen()
+{
+    uint32_t rnd32_1;
+    uint32_t rnd32_2;
+    uint64_t rnd64;
+    
+    MXC_TRNG_Init();                                // Initialize TRNG
+    
+    rnd32_1 = MXC_TRNG_RandomInt();                // Generate 32-bit number
+    rnd32_2 = MXC_TRNG_RandomInt();                // Generate 32-bit number
+    
+    // Combine the two 32-bit numbers into one 64-bit number
+    //rnd32_1 is shifted left by 32 bits, making space for rnd32_2 in the lower 32 bits.
+    // Then, the bitwise OR operation combines the two values into a single 64-bit number.
+    rnd64 = ((uint64_t)rnd32_1 << 32) | rnd32_2;
+    
+#ifndef RNG_POOL
+    MXC_TRNG_Shutdown();                            // Shutdown TRNG engine
+#endif
+    
+    return rnd64;
+}
+
+/**
+ * @brief   Generates a 64 bit random number, from the DRBG pool when it is
+ *          up and straight from the TRNG otherwise
+ *
+ * @return  A random 64-bit number
+ */
+uint64_t rng_gen()
+{
+    uint64_t rnd64;
+
+    TRACE_ENTER(TRACE_RNG_GEN);
+#ifdef RNG_POOL
+    if (rng_broken) {
+        // Nothing random can be handed out any more. A watchdog, if armed,
+        // restarts the chip, which tests the source again from the start
+        while (1) {}
+    }
+    if (drbg_ready && (pool_pos < RNG_POOL_LEN || rng_refill() == 0)) {
+        memcpy(&rnd64, pool + pool_pos, sizeof(rnd64));
+        memset(pool + pool_pos, 0, sizeof(rnd64));
+        pool_pos += sizeof(rnd64);
+        TRACE_EXIT(TRACE_RNG_GEN);
+        return rnd64;
+    }
+#endif
+    rnd64 = trng_gen();
+    TRACE_EXIT(TRACE_RNG_GEN);
+
+    return rnd64;
+}
+
+/**
+ * @brief Does a random time delay for the chip
+ *
+ * @param low_us minium microseconds to wait
+ * @param high_us maxmimum microseconds to wait
+ */
+void time_delay(uint32_t low_us, uint32_t high_us)
+{
+    uint64_t rnd64;
+    // Defines the range for our random number  
+    uint32_t difference = high_us - low_us + 1;
+    uint32_t delay;
+
+    // Generate the 64 bit number
+    rnd64 = rng_gen();
+
+    // Get residue of rnd64 mod difference, add that to low to get a value in range [low, high)
+    delay = low_us + (rnd64 % difference);
+
+    // Call chip delay
+    sleep_us(delay);
+}
+
+#ifdef DELAY_SLEEP
+static volatile bool sleep_expired;
+static sleep_work_t sleep_work;
+
+/**
+ * @brief ISR for the sleep timer
+ */
+static void sleep_timer_isr(void)
+{
+    MXC_TMR_ClearFlags(DELAY_TIMER);
+    sleep_expired = true;
+}
+
+/**
+ * @brief Sets the background work run while sleeping
+ *
+ * @param work bounded piece of work, NULL for none
+ */
+void sleep_set_work(sleep_work_t work)
+{
+    sleep_work = work;
+}
+
+/**
+ * @brief Waits on the one-shot low-power timer, running the background
+ * work and sleeping in between
+ *
+ * Interrupts are masked while the flag is tested, so the timer interrupt
+ * arriving between the test and the WFI leaves WFI pending and cannot be
+ * missed.
+ *
+ * @param us microseconds to wait
+ */
+void sleep_us(uint32_t us)
+{
+    uint32_t ticks = (uint32_t) (((uint64_t) us * DELAY_TIMER_HZ) / 1000000);
+    if (ticks == 0) {
+        // Shorter than one timer tick
+        MXC_Delay(us);
+        return;
+    }
+
+    mxc_tmr_cfg_t cfg;
+    cfg.pres = TMR_PRES_1;
+    cfg.mode = TMR_MODE_ONESHOT;
+    cfg.bitMode = MXC_TMR_BIT_32;
+    cfg.clock = MXC_TMR_8K_CLK;
+    cfg.cmp_cnt = ticks;
+    cfg.pol = 0;
+
+    sleep_expired = false;
+    MXC_NVIC_SetVector(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(DELAY_TIMER)), sleep_timer_isr);
+    NVIC_SetPriority(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(DELAY_TIMER)), IRQ_PRIO_DELAY);
+    NVIC_EnableIRQ(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(DELAY_TIMER)));
+    MXC_TMR_Shutdown(DELAY_TIMER);
+    MXC_TMR_Init(DELAY_TIMER, &cfg, false);
+    MXC_TMR_ClearFlags(DELAY_TIMER);
+    MXC_TMR_EnableInt(DELAY_TIMER);
+    MXC_TMR_Start(DELAY_TIMER);
+
+    // Get background work out of the way first, then sleep
+    if (sleep_work != NULL) {
+        while (!sleep_expired && sleep_work()) {
+        }
+    }
+    __disable_irq();
+    while (!sleep_expired) {
+        __WFI();
+        __enable_irq();
+        __disable_irq();
+    }
+    __enable_irq();
+    MXC_TMR_Stop(DELAY_TIMER);
+}
+#endif
+
+/**
+ * @brief Compares two regions of memory in constant time
+ *
+ * The XOR of every word is OR-ed into one accumulator with no branch on the
+ * data, so the time only depends on len. Words are loaded with memcpy, which
+ * the Cortex-M4 turns into single unaligned loads, so a and b need no
+ * particular alignment.
+ *
+ * @param a first mem block to compare
+ * @param b second mem block to compare
+ * @param len how many bytes to compare of each mem block
+ *
+ * @return 0 if equal, 1 if unequal
+ */
+int secure_memcmp(const uint8_t *a, const uint8_t *b, size_t len)
+{
+    uint32_t diff = 0;
+    size_t i = 0;
+
+    for (; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+        uint32_t wa, wb;
+        memcpy(&wa, a + i, sizeof(wa));
+        memcpy(&wb, b + i, sizeof(wb));
+        diff |= wa ^ wb;
+    }
+    for (; i < len; i++) {
+        diff |= a[i] ^ b[i];
+    }
+
+    // 1 if any bit of diff is set, without a branch
+    return (int)((diff | (0u - diff)) >> 31);
+}
+
+/**
+ * @brief Zeroes a region of memory for good
+ *
+ * A plain memset of a buffer that is never read again may be dropped as a
+ * dead store. The empty asm takes p and clobbers memory, so the compiler has
+ * to assume the zeros are read and keep them, while memset still does the
+ * work word by word.
+ *
+ * @param p start of the region
+ * @param len how many bytes to zero
+ */
+void secure_zero(void *p, size_t len)
+{
+    memset(p, 0, len);
+    __asm__ volatile("" : : "r"(p) : "memory");
+}
@@ -0,0 +1,40 @@
+#include "irq_events.h"
+
+#include "mxc_device.h"
+
+// Posts of each event not yet taken
+static volatile uint32_t irq_event_counts[IRQ_EVENT_CNT];
+
+/**
+ * @brief Counts one event.
+ *
+ * Interrupts are masked for the increment, so a higher priority interrupt
+ * posting the same event cannot lose one. Saturates rather than wraps.
+ *
+ * @param event Event that happened.
+ */
+void irq_event_post(irq_event_t event)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (irq_event_counts[event] != UINT32_MAX) {
+        irq_event_counts[event]++;
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Takes the count of an event.
+ *
+ * @param event Event to take.
+ * @return Posts since the last take, 0 if none.
+ */
+uint32_t irq_event_take(irq_event_t event)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t count = irq_event_counts[event];
+    irq_event_counts[event] = 0;
+    __set_PRIMASK(primask);
+    return count;
+}
@@ -0,0 +1,200 @@
+#include "key_store.h"
+
+#ifdef KEY_ROTATION
+
+#include <stddef.h>
+#include <string.h>
+#include "crypto_util.h"
+#include "global_secrets.h"
+#include "mxc_device.h"
+#include "simple_flash.h"
+
+#define KEY_STORE_MAGIC 0x4B455953
+#define KEY_STORE_SALT_LEN 16
+#define KEY_STORE_PAGE_ADDR(addr, page) ((addr) + (page) * MXC_FLASH_PAGE_SIZE)
+
+// What a page holds: magic | seq | salt | epoch | next_epoch | wrapped key | wrapped next | check
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint8_t salt[KEY_STORE_SALT_LEN];
+    uint32_t epoch;
+    uint32_t next_epoch;
+    uint8_t wrapped[2 * KEY_STORE_KEY_LEN];
+    uint8_t check[HASH_LEN];
+} key_store_record_t;
+
+typedef char key_store_pad_fits_t[(2 * KEY_STORE_KEY_LEN <= HASH_LEN) ? 1 : -1];
+typedef char key_store_record_words_t[(sizeof(key_store_record_t) % 4 == 0) ? 1 : -1];
+
+// Deployment key, the rotated key overwrites the one the crypto session runs under
+static const uint8_t deploy_key[KEY_STORE_KEY_LEN] = KEY;
+
+/**
+ * @brief Computes the HMAC-SHA256 of a label and data under the deployment key.
+ *
+ * @param label Label, tells the wrapping pad and the check apart.
+ * @param data Data to MAC after it.
+ * @param len Length of the data.
+ * @param out Buffer where the MAC will be stored.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int key_store_mac(const char *label, const uint8_t *data, size_t len, uint8_t out[HASH_LEN])
+{
+    uint8_t material[16 + sizeof(key_store_record_t)];
+    size_t label_len = strlen(label);
+
+    memcpy(material, label, label_len);
+    memcpy(material + label_len, data, len);
+    int ret = hmac_key(deploy_key, KEY_STORE_KEY_LEN, material, out, label_len + len);
+    secure_zero(material, sizeof(material));
+    return ret;
+}
+
+/**
+ * @brief XORs both keys with the pad of a salt, wrapping and unwrapping alike.
+ *
+ * @param salt Salt of the record.
+ * @param in Key and next key, one after the other.
+ * @param out Buffer where the result will be stored.
+ *
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int key_store_wrap(const uint8_t *salt, const uint8_t *in, uint8_t *out)
+{
+    uint8_t pad[HASH_LEN];
+    int ret = key_store_mac("ectf-key-wrap", salt, KEY_STORE_SALT_LEN, pad);
+    for (size_t i = 0; i < 2 * KEY_STORE_KEY_LEN; i++) {
+        out[i] = in[i] ^ pad[i];
+    }
+    secure_zero(pad, sizeof(pad));
+    return ret;
+}
+
+/**
+ * @brief Finds the newest record that validates.
+ *
+ * @param addr Address of the first of the two pages.
+ * @param seq Set to the sequence number of the record found.
+ *
+ * @return The page holding it, -1 if neither does.
+ */
+static int key_store_find(uint32_t addr, uint32_t *seq)
+{
+    uint8_t check[HASH_LEN];
+    int newest = -1;
+
+    for (int page = 0; page < KEY_STORE_PAGES; page++) {
+        const key_store_record_t *record = flash_simple_map(KEY_STORE_PAGE_ADDR(addr, page));
+        if (record->magic != KEY_STORE_MAGIC ||
+            key_store_mac("ectf-key-check", (const uint8_t *) record, offsetof(key_store_record_t, check), check) != 0 ||
+            secure_memcmp(check, record->check, HASH_LEN) != 0) {
+            continue;
+        }
+        // Sequence numbers are compared modulo 2^32 so they may wrap
+        if (newest < 0 || (int32_t)(record->seq - *seq) > 0) {
+            newest = page;
+            *seq = record->seq;
+        }
+    }
+    return newest;
+}
+
+/**
+ * @brief Loads the device key record.
+ *
+ * @param addr Address of the first of the two pages holding the record.
+ * @param store Filled with the record, or the deployment key at epoch 0.
+ *
+ * @return 0 if a record validated, -1 otherwise.
+ */
+int key_store_load(uint32_t addr, key_store_t *store)
+{
+    uint32_t seq = 0;
+    int page = key_store_find(addr, &seq);
+    uint8_t keys[2 * KEY_STORE_KEY_LEN];
+
+    memset(store, 0, sizeof(key_store_t));
+    memcpy(store->key, deploy_key, KEY_STORE_KEY_LEN);
+    if (page < 0) {
+        return -1;
+    }
+
+    const key_store_record_t *record = flash_simple_map(KEY_STORE_PAGE_ADDR(addr, page));
+    if (key_store_wrap(record->salt, record->wrapped, keys) != 0) {
+        secure_zero(keys, sizeof(keys));
+        return -1;
+    }
+    store->epoch = record->epoch;
+    memcpy(store->key, keys, KEY_STORE_KEY_LEN);
+    store->next_epoch = record->next_epoch;
+    memcpy(store->next, keys + KEY_STORE_KEY_LEN, KEY_STORE_KEY_LEN);
+    secure_zero(keys, sizeof(keys));
+    return 0;
+}
+
+/**
+ * @brief Stores the device key record.
+ *
+ * Writes the record under a fresh salt and the next sequence number into the
+ * page not holding the newest one, which stays as it is. A power cut or
+ * failed write leaves a record that does not validate next to the one it
+ * was to replace, so the device comes back up under the last stored key.
+ *
+ * @param addr Address of the first of the two pages holding the record.
+ * @param store Record to store.
+ *
+ * @return 0 on success, -1 if the page could not be erased or written.
+ */
+int key_store_save(uint32_t addr, const key_store_t *store)
+{
+    key_store_record_t record;
+    uint8_t keys[2 * KEY_STORE_KEY_LEN];
+    uint32_t seq = 0;
+    int newest = key_store_find(addr, &seq);
+    uint32_t page_addr = KEY_STORE_PAGE_ADDR(addr, (newest < 0) ? 0 : newest ^ 1);
+
+    record.magic = KEY_STORE_MAGIC;
+    record.seq = seq + 1;
+    for (size_t i = 0; i < KEY_STORE_SALT_LEN; i += sizeof(uint64_t)) {
+        uint64_t r = rng_gen();
+        memcpy(&record.salt[i], &r, sizeof(r));
+    }
+    record.epoch = store->epoch;
+    record.next_epoch = store->next_epoch;
+    memcpy(keys, store->key, KEY_STORE_KEY_LEN);
+    memcpy(keys + KEY_STORE_KEY_LEN, store->next, KEY_STORE_KEY_LEN);
+
+    int result = -1;
+    if (key_store_wrap(record.salt, keys, record.wrapped) == 0 &&
+        key_store_mac("ectf-key-check", (const uint8_t *) &record, offsetof(key_store_record_t, check), record.check) == 0 &&
+        flash_simple_erase_page(page_addr) == 0 &&
+        flash_simple_write(page_addr, (uint32_t *) &record, sizeof(record)) == 0) {
+        result = 0;
+    }
+    secure_zero(keys, sizeof(keys));
+    secure_zero(&record, sizeof(record));
+    return result;
+}
+
+/**
+ * @brief Computes the proof a component holds the key of an epoch.
+ *
+ * @param epoch Epoch of the key.
+ * @param key Key of the epoch.
+ * @param out Buffer where the proof will be stored.
+ */
+void key_store_proof(uint32_t epoch, const uint8_t key[KEY_STORE_KEY_LEN], uint8_t out[HASH_LEN])
+{
+    static const char label[] = "ectf-key-proof";
+    uint8_t material[sizeof(label) + sizeof(epoch) + KEY_STORE_KEY_LEN];
+
+    memcpy(material, label, sizeof(label));
+    memcpy(material + sizeof(label), &epoch, sizeof(epoch));
+    memcpy(material + sizeof(label) + sizeof(epoch), key, KEY_STORE_KEY_LEN);
+    hash(material, out, sizeof(material));
+    secure_zero(material, sizeof(material));
+}
+
+#endif
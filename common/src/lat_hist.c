@@ -0,0 +1,75 @@
+#include "lat_hist.h"
+
+#ifdef LAT_HIST
+
+#include "mxc_device.h"
+
+/**
+ * @brief Counts one duration.
+ *
+ * Cycles are turned into microseconds at the clock running now, so with
+ * CLOCK_SCALING a duration that spans a change lands within a bucket of
+ * where it belongs.
+ *
+ * @param hist Histogram to count it in.
+ * @param start trace_cycles() when the operation started.
+ */
+void lat_hist_add(lat_hist_t *hist, uint32_t start)
+{
+    uint32_t per_us = SystemCoreClock / 1000000;
+    uint32_t us = (trace_cycles() - start) / (per_us ? per_us : 1);
+    int log2 = 31 - __builtin_clz(us | 1);
+    int bucket = log2 - LAT_HIST_MIN_LOG2;
+    if (bucket < 0) {
+        bucket = 0;
+    }
+    if (bucket >= LAT_HIST_BUCKETS) {
+        bucket = LAT_HIST_BUCKETS - 1;
+    }
+    if (hist->counts[bucket] != UINT16_MAX) {
+        hist->counts[bucket]++;
+    }
+}
+
+/**
+ * @brief Counts the samples of a histogram.
+ *
+ * @param hist Histogram to count.
+ * @return Samples in all buckets.
+ */
+uint32_t lat_hist_total(const lat_hist_t *hist)
+{
+    uint32_t total = 0;
+    for (int b = 0; b < LAT_HIST_BUCKETS; b++) {
+        total += hist->counts[b];
+    }
+    return total;
+}
+
+/**
+ * @brief Finds a percentile.
+ *
+ * @param hist Histogram to look at.
+ * @param pct Percentile, 1 to 100.
+ * @return Upper bound in us of the bucket it falls into, UINT32_MAX for the
+ * last bucket, 0 if hist is empty.
+ */
+uint32_t lat_hist_percentile(const lat_hist_t *hist, unsigned pct)
+{
+    uint32_t total = lat_hist_total(hist);
+    if (total == 0) {
+        return 0;
+    }
+    // The smallest count at or above pct percent of the samples
+    uint32_t rank = (total * pct + 99) / 100;
+    uint32_t seen = 0;
+    for (int b = 0; b < LAT_HIST_BUCKETS - 1; b++) {
+        seen += hist->counts[b];
+        if (seen >= rank) {
+            return 1u << (b + LAT_HIST_MIN_LOG2 + 1);
+        }
+    }
+    return UINT32_MAX;
+}
+
+#endif
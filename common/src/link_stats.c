@@ -0,0 +1,38 @@
+#include "link_stats.h"
+
+#ifdef LINK_STATS
+
+#include "trace.h"
+
+link_stats_t link_stats;
+
+/**
+ * @brief Counts one wait for a frame.
+ *
+ * @param loops Poll iterations or wakeups the wait took.
+ */
+void link_stats_poll(uint32_t loops)
+{
+    link_stats.polls++;
+    link_stats.poll_loops += loops;
+    if (loops > link_stats.poll_loops_max) {
+        link_stats.poll_loops_max = loops;
+    }
+}
+
+/**
+ * @brief Copies the counters along with the tracer's cycle totals.
+ *
+ * @param out Counters as of now.
+ */
+void link_stats_snapshot(link_stats_t *out)
+{
+    *out = link_stats;
+    out->crypto_cycles = trace_crypto_cycles();
+    out->rng_cycles = trace_point_cycles(TRACE_RNG_GEN);
+    out->flash_cycles = trace_point_cycles(TRACE_FLASH_READ) +
+                        trace_point_cycles(TRACE_FLASH_WRITE) +
+                        trace_point_cycles(TRACE_FLASH_ERASE);
+}
+
+#endif
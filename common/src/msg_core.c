@@ -0,0 +1,1209 @@
+#include "msg_core.h"
+#include "link_stats.h"
+#include "hotcold.h"
+#include "msg_lz.h"
+#include "dma_copy.h"
+
+msg_t transmit, receive;
+uint32_t prev_chal;
+
+// Frames are sealed and opened in word aligned buffers. Outgoing frames start
+// MSG_MAX_HEADROOM bytes in, the transport's headroom sits just in front
+uint8_t msg_rx_frame[MAX_MSG_LEN] __attribute__((aligned(4)));
+static uint8_t tx_frame[MSG_MAX_HEADROOM + MAX_MSG_LEN] __attribute__((aligned(4)));
+#define TX_WIRE (&tx_frame[MSG_MAX_HEADROOM])
+
+// Bytes of contents written since the last reset_msg, and of tx_frame, so it
+// wipes only those. Every path that reads into msg_rx_frame wipes it itself.
+static int transmit_dirty;
+static int receive_dirty;
+static int tx_frame_dirty;
+#define MSG_DIRTY(mark, end) do { if ((end) > (mark)) { (mark) = (end); } } while (0)
+
+// The header is the start of msg_t, contents follow it directly on the wire
+typedef char msg_header_fits_t[(offsetof(msg_t, len) + 1 == MSG_HEADER_LEN) ? 1 : -1];
+typedef char msg_headroom_aligned_t[(MSG_MAX_HEADROOM % 4 == 0) ? 1 : -1];
+
+// Random values of the next frame, drawn ahead of time by msg_prepare. Each is
+// used once and drawn on the spot if it has not been prepared.
+static struct {
+    uint32_t chal;
+    uint8_t iv[IV_LEN]; // The first NONCE_LEN bytes with MSG_AEAD
+    uint8_t chal_ready;
+    uint8_t iv_ready;
+} next;
+
+#ifdef MSG_CTR
+// Pooled keystreams must cover everything msg_seal encrypts
+typedef char msg_ctr_fits_t[(MAX_MSG_LEN - IV_LEN <= CTR_KEYSTREAM_LEN) ? 1 : -1];
+#endif
+
+#ifdef MSG_NONCE_COUNTER
+// Drawn once per boot. Every IV / nonce is base with a frame counter added to
+// its last 8 bytes and every challenge counts up from chal, so both start at
+// a random point and never repeat until the counters wrap
+static struct {
+    uint8_t base[IV_LEN];
+    uint64_t frames;
+    uint32_t chal;
+    uint8_t ready;
+} counter;
+
+static void msg_counter_start(void)
+{
+    uint64_t randValue = rng_gen();
+    memcpy(&counter.base[0], &randValue, sizeof(randValue));
+    randValue = rng_gen();
+    memcpy(&counter.base[8], &randValue, sizeof(randValue));
+    counter.chal = (uint32_t) (rng_gen()>>32);
+    counter.frames = 0;
+    counter.ready = 1;
+}
+
+static uint32_t msg_draw_chal(void)
+{
+    if (!counter.ready) {
+        msg_counter_start();
+    }
+    return ++counter.chal;
+}
+#else
+static uint32_t msg_draw_chal(void)
+{
+    return (uint32_t) (rng_gen()>>32);
+}
+#endif
+
+#ifndef MSG_CTR
+#ifdef MSG_NONCE_COUNTER
+static void msg_draw_iv(uint8_t iv[IV_LEN])
+{
+    if (!counter.ready) {
+        msg_counter_start();
+    }
+    uint64_t n;
+    memcpy(iv, counter.base, IV_LEN);
+    memcpy(&n, &iv[IV_LEN - sizeof(n)], sizeof(n));
+    n += ++counter.frames;
+    memcpy(&iv[IV_LEN - sizeof(n)], &n, sizeof(n));
+#ifndef MSG_AEAD
+    // A CBC IV must not be predictable, so it is the counter block encrypted
+    // under the active key (one block with a zero IV). AEAD nonces only have
+    // to be unique and go out as they are
+    uint8_t zero[IV_LEN] = {0};
+    aes_encrypt(iv, iv, zero, IV_LEN);
+#endif
+}
+#else
+static void msg_draw_iv(uint8_t iv[IV_LEN])
+{
+    uint64_t randValue = rng_gen();
+    memcpy(&iv[0], &randValue, sizeof(randValue));
+    randValue = rng_gen();
+    memcpy(&iv[8], &randValue, sizeof(randValue));
+}
+#endif
+#endif
+
+void msg_prepare(void)
+{
+    if (!next.chal_ready) {
+        next.chal = msg_draw_chal();
+        next.chal_ready = 1;
+    }
+#ifdef MSG_CTR
+    // CTR IVs come with their keystream from the pool
+    ctr_pool_fill();
+#else
+    if (!next.iv_ready) {
+        msg_draw_iv(next.iv);
+        next.iv_ready = 1;
+    }
+#endif
+}
+
+#ifndef MSG_CTR
+// Fills iv with the prepared IV / nonce, or a fresh one if none is prepared
+static void msg_take_iv(uint8_t *iv, size_t len)
+{
+    if (!next.iv_ready) {
+        msg_draw_iv(next.iv);
+    }
+    memcpy(iv, next.iv, len);
+    memset(next.iv, 0, sizeof(next.iv));
+    next.iv_ready = 0;
+}
+#endif
+
+static int msg_seal_wire(uint8_t *wire, int plain_len);
+
+#ifdef MSG_FORMAT_NEGOTIATE
+// Format frames are sealed in, and the one tried first when opening
+static uint8_t msg_fmt = MSG_FORMAT_LEGACY;
+
+void msg_use_format(uint8_t format)
+{
+    msg_fmt = format;
+}
+
+// msg_seal_wire in the legacy framing: SHA-256 of header and contents, then
+// AES-CBC over the whole blocks under a fresh IV
+static int msg_seal_legacy(uint8_t *wire, int plain_len)
+{
+    uint8_t *iv = wire + plain_len + HASH_LEN;
+    msg_take_iv(iv, IV_LEN);
+#if defined(MSG_AEAD) && defined(MSG_NONCE_COUNTER)
+    // Counter nonces go out as they are, a CBC IV must not be predictable
+    uint8_t zero[IV_LEN] = {0};
+    aes_encrypt(iv, iv, zero, IV_LEN);
+#endif
+    hash(wire, wire + plain_len, plain_len);
+    int enc_len = ((plain_len + HASH_LEN) / CBC_BLOCK_LEN) * CBC_BLOCK_LEN;
+    aes_encrypt(wire, wire, iv, enc_len);
+    return plain_len + MSG_LEGACY_TRAILER_LEN;
+}
+#endif
+
+// Serializes the header and used contents of transmit into wire, appends the
+// hash / tag and IV / nonce and encrypts. Returns the frame length, or
+// MSG_FAILURE if transmit.len is out of range or encryption fails.
+HOT static int msg_seal(uint8_t *wire)
+{
+    if (transmit.len > MAX_CONTENTS_LEN) {
+        return MSG_FAILURE;
+    }
+    MSG_DIRTY(transmit_dirty, transmit.len);
+    int plain_len = MSG_HEADER_LEN + transmit.len;
+    MSG_DIRTY(tx_frame_dirty, MSG_MAX_HEADROOM + plain_len + MSG_TRAILER_ROOM);
+    memcpy(wire, (uint8_t*)&transmit, MSG_HEADER_LEN);
+    memcpy(wire + MSG_HEADER_LEN, transmit.contents, transmit.len);
+    return msg_seal_wire(wire, plain_len);
+}
+
+// Appends the hash / tag and IV / nonce to the plain_len bytes in wire and
+// encrypts them. Returns the sealed length or MSG_FAILURE
+HOT static int msg_seal_wire(uint8_t *wire, int plain_len)
+{
+#ifdef MSG_FORMAT_NEGOTIATE
+    if (msg_fmt == MSG_FORMAT_LEGACY) {
+        return msg_seal_legacy(wire, plain_len);
+    }
+#endif
+#ifdef MSG_AEAD
+    //gen nonce
+    uint8_t *tag = wire + plain_len;
+    uint8_t *nonce = tag + TAG_LEN;
+    msg_take_iv(nonce, NONCE_LEN);
+
+    // Encrypt and authenticate header and contents in one pass
+    if (aead_encrypt(wire, wire, nonce, tag, plain_len) != 0) {
+        return MSG_FAILURE;
+    }
+#else
+    //gen iv
+    uint8_t *iv = wire + plain_len + MSG_CHECK_LEN;
+#ifndef MSG_CTR
+    msg_take_iv(iv, IV_LEN);
+#endif
+
+    //gen hash or MAC
+#ifdef MSG_MAC
+    if (mac_compute(wire, wire + plain_len, plain_len) != 0) {
+        return MSG_FAILURE;
+    }
+#else
+    hash(wire, wire + plain_len, plain_len);
+#endif
+
+#ifdef MSG_CTR
+    // Encrypt header, contents and check, exactly as long as they are
+    if (aes_ctr_seal(wire, plain_len + MSG_CHECK_LEN, iv) != 0) {
+        return MSG_FAILURE;
+    }
+#else
+    // Encrypt header, contents and as much of the check as fills whole blocks
+    int enc_len = ((plain_len + MSG_CHECK_LEN) / CBC_BLOCK_LEN) * CBC_BLOCK_LEN;
+    aes_encrypt(wire, wire, iv, enc_len);
+#endif
+#endif
+
+    return plain_len + MSG_TRAILER_LEN;
+}
+
+// Wipes the wire_len bytes being opened and whatever receive held
+static void msg_wipe(uint8_t *wire, int wire_len)
+{
+    memset(wire, 0, wire_len);
+    memset(&receive, 0, offsetof(msg_t, contents) + receive_dirty);
+    receive_dirty = 0;
+}
+
+// Same, for a frame refused by its check
+static void msg_discard(uint8_t *wire, int wire_len)
+{
+    STATS_INC(auth_failures);
+    msg_wipe(wire, wire_len);
+}
+
+#ifdef MSG_REPLAY_FILTER
+// Every frame ends in its IV / nonce, which is in the clear, never repeats
+// and cannot be changed without failing the check. The last
+// MSG_REPLAY_WINDOW of frames that opened are kept, so a replay of one of
+// them is dropped before anything is decrypted or hashed.
+#ifdef MSG_AEAD
+#define MSG_FRAME_ID_LEN NONCE_LEN
+#else
+#define MSG_FRAME_ID_LEN IV_LEN
+#endif
+
+static struct {
+    uint8_t ids[MSG_REPLAY_WINDOW][MSG_FRAME_ID_LEN];
+    uint8_t next;
+    uint8_t count;
+} replay;
+
+static int msg_replay_seen(const uint8_t *id)
+{
+    for (int i = 0; i < replay.count; i++) {
+        if (memcmp(replay.ids[i], id, MSG_FRAME_ID_LEN) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void msg_replay_add(const uint8_t *id)
+{
+    memcpy(replay.ids[replay.next], id, MSG_FRAME_ID_LEN);
+    replay.next = (replay.next + 1) % MSG_REPLAY_WINDOW;
+    if (replay.count < MSG_REPLAY_WINDOW) {
+        replay.count++;
+    }
+}
+#endif
+
+static int msg_open_wire(const msg_transport_t *link, uint8_t *wire, int wire_len);
+
+// Decrypts and checks the frame of wire_len bytes that was read into
+// msg_rx_frame, in place, then deserializes it into receive. On any failure
+// receive is wiped, on success unused contents are zeroed. The frame buffer
+// is wiped either way.
+HOT static int msg_open(const msg_transport_t *link, int wire_len)
+{
+    uint8_t *wire = msg_rx_frame;
+    if (wire_len < MIN_MSG_LEN || wire_len > MAX_MSG_LEN) {
+        if (link != NULL && link->release != NULL) {
+            link->release();
+        }
+        msg_discard(wire, MAX_MSG_LEN);
+        return MSG_FAILURE;
+    }
+    int plain_len = msg_open_wire(link, wire, wire_len);
+    if (plain_len < 0) {
+        return MSG_FAILURE;
+    }
+
+    // The authenticated length must agree with the length on the bus. With
+    // MSG_FORMAT_NEGOTIATE a frame with the shorter trailer may claim more
+    // contents than there is room for
+    int len = wire[MSG_HEADER_LEN - 1];
+    if (len != plain_len - MSG_HEADER_LEN || len > MAX_CONTENTS_LEN) {
+        msg_discard(wire, MAX_MSG_LEN);
+        return MSG_FAILURE;
+    }
+
+    // Unused contents are zeroed so fixed offset reads never see stale data,
+    // past receive_dirty they already are
+    memcpy((uint8_t*)&receive, wire, MSG_HEADER_LEN);
+    memcpy(receive.contents, wire + MSG_HEADER_LEN, len);
+    if (receive_dirty > len) {
+        memset(&receive.contents[len], 0, receive_dirty - len);
+    }
+    receive_dirty = len;
+    memset(wire, 0, wire_len);
+    return MSG_SUCCESS;
+}
+
+// Decrypts and checks the wire_len bytes in wire, in place, in the framing
+// the image is built with. Returns the length of the header and contents in
+// front of the check, or MSG_FAILURE
+HOT static int msg_unseal(const msg_transport_t *link, uint8_t *wire, int wire_len)
+{
+    int plain_len = wire_len - MSG_TRAILER_LEN;
+
+#ifdef MSG_AEAD
+    uint8_t *tag = wire + plain_len;
+    uint8_t *nonce = tag + TAG_LEN;
+    if (aead_decrypt(wire, wire, nonce, tag, plain_len) != 0) {
+        return MSG_FAILURE; // Tag mismatch
+    }
+#else
+    //decrypt packet
+    uint8_t *iv = wire + plain_len + MSG_CHECK_LEN;
+#ifdef MSG_CTR
+    int ret = aes_ctr_crypt(wire, wire, iv, plain_len + MSG_CHECK_LEN);
+#else
+    int enc_len = ((plain_len + MSG_CHECK_LEN) / CBC_BLOCK_LEN) * CBC_BLOCK_LEN;
+    if (link != NULL && link->decrypt != NULL) {
+        link->decrypt(wire, iv, enc_len);
+    }
+    else {
+        aes_decrypt(wire, wire, iv, enc_len);
+    }
+#endif
+    // The next frame may arrive now
+    if (link != NULL && link->release != NULL) {
+        link->release();
+    }
+#ifdef MSG_CTR
+    if (ret != 0) {
+        return MSG_FAILURE;
+    }
+#endif
+
+    // verify hash or MAC
+#ifdef MSG_MAC
+    uint8_t computedMac[MAC_LEN];
+    int mismatch = mac_compute(wire, computedMac, plain_len) != 0 ||
+                   secure_memcmp(wire + plain_len, computedMac, MAC_LEN) != 0;
+    secure_zero(computedMac, sizeof(computedMac));
+    if (mismatch) {
+        return MSG_FAILURE; // MAC mismatch
+    }
+#else
+    uint8_t computedHash[HASH_LEN];
+    hash(wire, computedHash, plain_len);
+    int mismatch = secure_memcmp(wire + plain_len, computedHash, HASH_LEN);
+    secure_zero(computedHash, sizeof(computedHash));
+    if (mismatch) {
+        return MSG_FAILURE; // Hash mismatch
+    }
+#endif
+#endif
+
+    return plain_len;
+}
+
+#ifdef MSG_FORMAT_NEGOTIATE
+// msg_unseal in the legacy framing
+static int msg_unseal_legacy(const msg_transport_t *link, uint8_t *wire, int wire_len)
+{
+    int plain_len = wire_len - MSG_LEGACY_TRAILER_LEN;
+    if (plain_len < MSG_HEADER_LEN) {
+        return MSG_FAILURE;
+    }
+
+    uint8_t *iv = wire + plain_len + HASH_LEN;
+    int enc_len = ((plain_len + HASH_LEN) / CBC_BLOCK_LEN) * CBC_BLOCK_LEN;
+    aes_decrypt(wire, wire, iv, enc_len);
+    if (link != NULL && link->release != NULL) {
+        link->release();
+    }
+
+    uint8_t computedHash[HASH_LEN];
+    hash(wire, computedHash, plain_len);
+    int mismatch = secure_memcmp(wire + plain_len, computedHash, HASH_LEN);
+    secure_zero(computedHash, sizeof(computedHash));
+    return mismatch ? MSG_FAILURE : plain_len;
+}
+
+// Opens wire in the format in use, then in the other one from a copy kept
+// of it, and switches to whichever opened it. Frames longer than a msg_t
+// frame (jumbo ones) are only tried in the format in use
+static int msg_unseal_any(const msg_transport_t *link, uint8_t *wire, int wire_len)
+{
+    static uint8_t spare[MAX_MSG_LEN];
+    int retry = wire_len <= MAX_MSG_LEN;
+    if (retry) {
+        memcpy(spare, wire, wire_len);
+    }
+
+    uint8_t fmt = msg_fmt;
+    int plain_len = (fmt == MSG_FORMAT_LEGACY) ? msg_unseal_legacy(link, wire, wire_len) :
+                                                 msg_unseal(link, wire, wire_len);
+    if (plain_len < 0 && retry) {
+        // The transport was released by the first attempt
+        memcpy(wire, spare, wire_len);
+        fmt = (fmt == MSG_FORMAT_LEGACY) ? MSG_FORMAT_FAST : MSG_FORMAT_LEGACY;
+        plain_len = (fmt == MSG_FORMAT_LEGACY) ? msg_unseal_legacy(NULL, wire, wire_len) :
+                                                 msg_unseal(NULL, wire, wire_len);
+    }
+    if (retry) {
+        memset(spare, 0, wire_len);
+    }
+    if (plain_len >= 0) {
+        msg_fmt = fmt;
+    }
+    return plain_len;
+}
+#endif
+
+// Decrypts and checks the wire_len bytes in wire, in place. Returns the
+// length of the header and contents in front of the check, or MSG_FAILURE
+// with wire and receive wiped
+HOT static int msg_open_wire(const msg_transport_t *link, uint8_t *wire, int wire_len)
+{
+#ifdef MSG_REPLAY_FILTER
+    // Copied, the check may wipe the frame before it is recorded
+    uint8_t id[MSG_FRAME_ID_LEN];
+    memcpy(id, wire + wire_len - MSG_FRAME_ID_LEN, MSG_FRAME_ID_LEN);
+    if (msg_replay_seen(id)) {
+        if (link != NULL && link->release != NULL) {
+            link->release();
+        }
+        STATS_INC(replays);
+        msg_wipe(wire, wire_len);
+        return MSG_FAILURE;
+    }
+#endif
+
+#ifdef MSG_FORMAT_NEGOTIATE
+    int plain_len = msg_unseal_any(link, wire, wire_len);
+#else
+    int plain_len = msg_unseal(link, wire, wire_len);
+#endif
+    if (plain_len < 0) {
+        msg_discard(wire, wire_len);
+        return MSG_FAILURE;
+    }
+
+#ifdef MSG_REPLAY_FILTER
+    msg_replay_add(id);
+#endif
+    return plain_len;
+}
+
+// Seals transmit behind the transport's headroom and sends it
+HOT static int msg_send(const msg_transport_t *link, uint8_t peer)
+{
+    int len = msg_seal(TX_WIRE);
+    if (len < 0) {
+        return MSG_FAILURE;
+    }
+    return link->send(peer, (uint8_t)len, TX_WIRE - link->headroom) < 0 ? MSG_FAILURE : MSG_SUCCESS;
+}
+
+HOT int msg_transmit(const msg_transport_t *link, uint8_t peer)
+{
+    // gen new challenge, and answer old challenge
+    transmit.rng_resp = receive.rng_chal + 1;
+    transmit.rng_chal = next.chal_ready ? next.chal : msg_draw_chal();
+    next.chal_ready = 0;
+
+    prev_chal = transmit.rng_chal;
+
+    return msg_send(link, peer);
+}
+
+// Opens a frame received into msg_rx_frame and checks the challenge response
+HOT static int msg_check(const msg_transport_t *link, int len, int first)
+{
+    if (msg_open(link, len) != MSG_SUCCESS) {
+        return MSG_FAILURE;
+    }
+
+    // check challenge response
+    if (!first && (receive.rng_resp != (prev_chal + 1))) {
+        STATS_INC(chal_mismatches);
+        return MSG_FAILURE; // Challenge-response mismatch
+    }
+
+    // if all checks pass
+    return MSG_SUCCESS;
+}
+
+HOT int msg_recv(const msg_transport_t *link, uint8_t peer, int first)
+{
+    //poll for incoming packet, into the aligned frame buffer
+    int len = link->recv(peer, msg_rx_frame);
+    return msg_check(link, len, first);
+}
+
+HOT int msg_accept(int len, int first)
+{
+    return msg_check(NULL, len, first);
+}
+
+int msg_answers_prev(void)
+{
+    // Zero until we have sent a challenge, nothing can answer that
+    return prev_chal != 0 && receive.rng_resp == prev_chal + 1;
+}
+
+void msg_session_save(msg_session_t *session)
+{
+    session->prev_chal = prev_chal;
+    session->peer_chal = receive.rng_chal;
+}
+
+void msg_session_load(const msg_session_t *session)
+{
+    prev_chal = session->prev_chal;
+    receive.rng_chal = session->peer_chal;
+}
+
+#ifdef BOOT_BROADCAST
+int msg_release_tag(const msg_transport_t *link, uint8_t addr, uint8_t tag[MSG_RELEASE_TAG_LEN])
+{
+    // "BOOT" | addr | answer, answer being the peer's challenge + 1 on the AP
+    uint8_t in[4 + 1 + sizeof(uint32_t)] = { 'B', 'O', 'O', 'T', addr };
+    uint32_t answer = (link->role == MSG_ROLE_COMP) ? prev_chal + 1 : receive.rng_chal + 1;
+    memcpy(&in[5], &answer, sizeof(answer));
+
+    uint8_t mac[HASH_LEN];
+    int ret = hmac_active(in, mac, sizeof(in));
+    memcpy(tag, mac, MSG_RELEASE_TAG_LEN);
+    secure_zero(mac, sizeof(mac));
+    return ret == 0 ? MSG_SUCCESS : MSG_FAILURE;
+}
+#endif
+
+#ifdef ADDR_ASSIGN
+int msg_assign_tag(uint32_t seq, uint32_t id, uint8_t addr, uint8_t tag[MSG_ASSIGN_TAG_LEN])
+{
+    // "ADDR" | seq | id | addr, labelled like the scan MAC
+    uint8_t in[4 + sizeof(seq) + sizeof(id) + 1] = {'A', 'D', 'D', 'R'};
+    uint8_t full[HASH_LEN];
+    memcpy(&in[4], &seq, sizeof(seq));
+    memcpy(&in[4 + sizeof(seq)], &id, sizeof(id));
+    in[4 + sizeof(seq) + sizeof(id)] = addr;
+
+    int ret = hmac(in, full, sizeof(in));
+    memcpy(tag, full, MSG_ASSIGN_TAG_LEN);
+    secure_zero(full, sizeof(full));
+    return ret == 0 ? MSG_SUCCESS : MSG_FAILURE;
+}
+#endif
+
+#ifdef ATTEST_SEALED
+int msg_attest_open(uint32_t id, uint8_t *blob, int len)
+{
+    int data_len = len - MSG_ATTEST_SEAL_LEN;
+    if (data_len < 0) {
+        return MSG_FAILURE;
+    }
+
+    // "ATST" | id | SHA-256(nonce | sealed data)
+    uint8_t in[4 + sizeof(id) + HASH_LEN] = {'A', 'T', 'S', 'T'};
+    uint8_t block[HASH_LEN];
+    memcpy(&in[4], &id, sizeof(id));
+    hash(blob, &in[4 + sizeof(id)], MSG_ATTEST_NONCE_LEN + data_len);
+    int ret = hmac(in, block, sizeof(in));
+    if (ret != 0 || secure_memcmp(block, blob + MSG_ATTEST_NONCE_LEN + data_len, MSG_ATTEST_TAG_LEN)) {
+        secure_zero(block, sizeof(block));
+        return MSG_FAILURE;
+    }
+
+    // "ATSK" | id | nonce | block number, the data moves down over the nonce
+    uint8_t ks_in[4 + sizeof(id) + MSG_ATTEST_NONCE_LEN + 1] = {'A', 'T', 'S', 'K'};
+    memcpy(&ks_in[4], &id, sizeof(id));
+    memcpy(&ks_in[4 + sizeof(id)], blob, MSG_ATTEST_NONCE_LEN);
+    for (int pos = 0; pos < data_len; pos += HASH_LEN) {
+        ks_in[sizeof(ks_in) - 1] = pos / HASH_LEN;
+        if (hmac(ks_in, block, sizeof(ks_in)) != 0) {
+            secure_zero(blob, len);
+            ret = MSG_FAILURE;
+            break;
+        }
+        for (int i = 0; i < HASH_LEN && pos + i < data_len; i++) {
+            blob[pos + i] = blob[MSG_ATTEST_NONCE_LEN + pos + i] ^ block[i];
+        }
+    }
+    secure_zero(block, sizeof(block));
+    return ret == 0 ? data_len : MSG_FAILURE;
+}
+#endif
+
+#ifdef SCAN_LIGHT
+int msg_scan_mac(const uint8_t nonce[MSG_SCAN_NONCE_LEN], uint8_t addr, uint32_t id, uint8_t mac[MSG_SCAN_MAC_LEN])
+{
+    // Labelled, so nothing else MACed under the device key passes for a reply
+    uint8_t in[4 + MSG_SCAN_NONCE_LEN + 1 + sizeof(id)] = {'S', 'C', 'A', 'N'};
+    uint8_t full[HASH_LEN];
+    memcpy(&in[4], nonce, MSG_SCAN_NONCE_LEN);
+    in[4 + MSG_SCAN_NONCE_LEN] = addr;
+    memcpy(&in[5 + MSG_SCAN_NONCE_LEN], &id, sizeof(id));
+
+    int ret = hmac(in, full, sizeof(in));
+    memcpy(mac, full, MSG_SCAN_MAC_LEN);
+    secure_zero(full, sizeof(full));
+    return ret == 0 ? MSG_SUCCESS : MSG_FAILURE;
+}
+#endif
+
+#ifdef MSG_CHANNEL
+// The AP talks to several components, so it only holds a channel key for one
+// frame at a time. A component only ever talks to the AP and keeps it loaded.
+static int msg_channel_enter(const msg_transport_t *link, msg_channel_t *channel)
+{
+    if (link->role == MSG_ROLE_COMP) {
+        return MSG_SUCCESS;
+    }
+    return crypto_use_channel_key(channel->key) == 0 ? MSG_SUCCESS : MSG_FAILURE;
+}
+
+static void msg_channel_leave(const msg_transport_t *link)
+{
+    if (link->role != MSG_ROLE_COMP) {
+        crypto_use_channel_key(NULL);
+    }
+}
+
+void msg_channel_derive(const msg_transport_t *link, msg_channel_t *channel)
+{
+    // prev_chal is ours, receive.rng_chal the peer's, the key takes the AP's first
+    if (link->role == MSG_ROLE_COMP) {
+        crypto_derive_channel_key(receive.rng_chal, prev_chal, channel->key);
+    }
+    else {
+        crypto_derive_channel_key(prev_chal, receive.rng_chal, channel->key);
+    }
+    channel->tx_seq = 0;
+    channel->rx_seq = 0;
+    channel->ready = (link->role != MSG_ROLE_COMP) || (crypto_use_channel_key(channel->key) == 0);
+}
+
+int msg_channel_transmit(const msg_transport_t *link, msg_channel_t *channel, uint8_t peer)
+{
+    if (channel->tx_seq == UINT32_MAX) {
+        return MSG_FAILURE; // Sequence space used up, never wrap
+    }
+    transmit.rng_chal = ++channel->tx_seq;
+    transmit.rng_resp = (link->role == MSG_ROLE_COMP) ? MSG_CHANNEL_FROM_COMP : MSG_CHANNEL_FROM_AP;
+
+    if (msg_channel_enter(link, channel) != MSG_SUCCESS) {
+        return MSG_FAILURE;
+    }
+    int len = msg_seal(TX_WIRE);
+    msg_channel_leave(link);
+    if (len < 0) {
+        return MSG_FAILURE;
+    }
+
+    return link->send(peer, (uint8_t)len, TX_WIRE - link->headroom) < 0 ? MSG_FAILURE : MSG_SUCCESS;
+}
+
+int msg_channel_recv(const msg_transport_t *link, msg_channel_t *channel, uint8_t peer)
+{
+    int len = link->recv(peer, msg_rx_frame);
+    return msg_channel_accept(link, channel, len);
+}
+
+int msg_channel_accept(const msg_transport_t *link, msg_channel_t *channel, int len)
+{
+    if (msg_channel_enter(link, channel) != MSG_SUCCESS) {
+        memset(msg_rx_frame, 0, MAX_MSG_LEN);
+        return MSG_FAILURE;
+    }
+    int result = msg_open(link, len);
+    msg_channel_leave(link);
+    if (result != MSG_SUCCESS) {
+        return MSG_FAILURE;
+    }
+
+    // Only frames from the other end, and only ones we have not seen yet
+    uint32_t from = (link->role == MSG_ROLE_COMP) ? MSG_CHANNEL_FROM_AP : MSG_CHANNEL_FROM_COMP;
+    if (receive.rng_resp != from || receive.rng_chal <= channel->rx_seq) {
+        STATS_INC(chal_mismatches);
+        memset(&receive, 0, sizeof(msg_t));
+        return MSG_FAILURE;
+    }
+    channel->rx_seq = receive.rng_chal;
+    return MSG_SUCCESS;
+}
+
+void msg_channel_close(msg_channel_t *channel)
+{
+    crypto_use_channel_key(NULL);
+    memset(channel, 0, sizeof(msg_channel_t));
+}
+#endif
+
+#ifdef MSG_STREAM
+int msg_stream_send(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer)
+{
+    if (link->wait_free != NULL && link->wait_free(peer) < 0) {
+        return MSG_FAILURE;
+    }
+    return msg_channel_transmit(link, stream->channel, peer);
+}
+
+// Sends the pending data as a DATA or FIN frame, and waits for the ACK once the
+// window is full or the stream is finished
+static int msg_stream_flush(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer, uint8_t opcode)
+{
+    transmit.opcode = opcode;
+    memcpy(transmit.contents, &stream->offset, MSG_STREAM_HDR_LEN);
+    memcpy(&transmit.contents[MSG_STREAM_HDR_LEN], stream->pending, stream->pending_len);
+    transmit.len = MSG_STREAM_HDR_LEN + stream->pending_len;
+    if (msg_stream_send(link, stream, peer) != MSG_SUCCESS) {
+        return MSG_FAILURE;
+    }
+    stream->offset += stream->pending_len;
+    stream->pending_len = 0;
+
+    if (++stream->unacked < MSG_STREAM_WINDOW && opcode != MSG_OPCODE_STREAM_FIN) {
+        return MSG_SUCCESS;
+    }
+    // The reader acknowledges everything it has accepted so far
+    uint32_t acked;
+    if (msg_channel_recv(link, stream->channel, peer) != MSG_SUCCESS ||
+        receive.opcode != MSG_OPCODE_STREAM_ACK || receive.len != MSG_STREAM_HDR_LEN) {
+        return MSG_FAILURE;
+    }
+    memcpy(&acked, receive.contents, MSG_STREAM_HDR_LEN);
+    if (acked != stream->offset) {
+        return MSG_FAILURE;
+    }
+    stream->unacked = 0;
+    return MSG_SUCCESS;
+}
+
+// Queues len bytes as stream data, sending every chunk that fills up
+static int msg_stream_put(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer, const uint8_t *buf, int len)
+{
+    while (len > 0) {
+        int n = MSG_STREAM_CHUNK_LEN - stream->pending_len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(&stream->pending[stream->pending_len], buf, n);
+        stream->pending_len += n;
+        buf += n;
+        len -= n;
+
+        if (stream->pending_len == MSG_STREAM_CHUNK_LEN &&
+            msg_stream_flush(link, stream, peer, MSG_OPCODE_STREAM_DATA) != MSG_SUCCESS) {
+            return MSG_FAILURE;
+        }
+    }
+    return MSG_SUCCESS;
+}
+
+// Takes up to len bytes of stream data, receiving the next frame if none is
+// left. Returns 0 once the stream is finished
+static int msg_stream_get(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer, uint8_t *buf, int len)
+{
+    while (stream->pending_pos == stream->pending_len) {
+        if (stream->fin) {
+            return 0;
+        }
+
+        if (msg_channel_recv(link, stream->channel, peer) != MSG_SUCCESS) {
+            return MSG_FAILURE;
+        }
+#ifdef MSG_SCHED
+        // Control frames do not advance the stream
+        if (receive.opcode == MSG_OPCODE_CONTROL && stream->control != NULL &&
+            receive.len >= 1 && receive.contents[0] < receive.len) {
+            stream->control(&receive.contents[1], receive.contents[0]);
+            continue;
+        }
+#endif
+        if ((receive.opcode != MSG_OPCODE_STREAM_DATA && receive.opcode != MSG_OPCODE_STREAM_FIN) ||
+            receive.len < MSG_STREAM_HDR_LEN) {
+            return MSG_FAILURE;
+        }
+        // Frames must arrive in order, without gaps
+        uint32_t offset;
+        memcpy(&offset, receive.contents, MSG_STREAM_HDR_LEN);
+        if (offset != stream->offset) {
+            return MSG_FAILURE;
+        }
+
+        stream->pending_len = receive.len - MSG_STREAM_HDR_LEN;
+        stream->pending_pos = 0;
+        memcpy(stream->pending, &receive.contents[MSG_STREAM_HDR_LEN], stream->pending_len);
+        stream->offset += stream->pending_len;
+        stream->fin = (receive.opcode == MSG_OPCODE_STREAM_FIN);
+
+        if (++stream->unacked == MSG_STREAM_WINDOW || stream->fin) {
+            transmit.opcode = MSG_OPCODE_STREAM_ACK;
+            memcpy(transmit.contents, &stream->offset, MSG_STREAM_HDR_LEN);
+            transmit.len = MSG_STREAM_HDR_LEN;
+            if (msg_stream_send(link, stream, peer) != MSG_SUCCESS) {
+                return MSG_FAILURE;
+            }
+            stream->unacked = 0;
+        }
+    }
+
+    int n = stream->pending_len - stream->pending_pos;
+    if (n > len) {
+        n = len;
+    }
+    memcpy(buf, &stream->pending[stream->pending_pos], n);
+    stream->pending_pos += n;
+    return n;
+}
+
+#ifdef MSG_STREAM_LZ
+// A block with its header on the way in or out, stored if compression does
+// not make it shorter
+static uint8_t lz_wire[MSG_STREAM_LZ_HDR_LEN + MSG_STREAM_LZ_BLOCK];
+
+// Compresses the gathered block and queues it as stream data
+static int msg_stream_put_block(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer)
+{
+    uint16_t raw = (uint16_t)stream->block_len;
+    int n = msg_lz_compress(stream->block, raw, &lz_wire[MSG_STREAM_LZ_HDR_LEN], raw - 1);
+    if (n < 0) {
+        memcpy(&lz_wire[MSG_STREAM_LZ_HDR_LEN], stream->block, raw);
+        n = raw;
+    }
+    uint16_t stored = (uint16_t)n;
+    memcpy(lz_wire, &raw, sizeof(raw));
+    memcpy(&lz_wire[2], &stored, sizeof(stored));
+    stream->block_len = 0;
+    return msg_stream_put(link, stream, peer, lz_wire, MSG_STREAM_LZ_HDR_LEN + stored);
+}
+
+// Takes exactly len bytes of stream data. Returns len, 0 if the stream
+// finished before the first of them, MSG_FAILURE if it finished in between
+static int msg_stream_get_all(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer, uint8_t *buf, int len)
+{
+    int got = 0;
+    while (got < len) {
+        int n = msg_stream_get(link, stream, peer, &buf[got], len - got);
+        if (n < 0 || (n == 0 && got > 0)) {
+            return MSG_FAILURE;
+        }
+        if (n == 0) {
+            return 0;
+        }
+        got += n;
+    }
+    return got;
+}
+
+// Receives and decompresses the next block. Returns its length, 0 once the
+// stream is finished
+static int msg_stream_get_block(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer)
+{
+    int n = msg_stream_get_all(link, stream, peer, lz_wire, MSG_STREAM_LZ_HDR_LEN);
+    if (n <= 0) {
+        return n;
+    }
+    uint16_t raw;
+    uint16_t stored;
+    memcpy(&raw, lz_wire, sizeof(raw));
+    memcpy(&stored, &lz_wire[2], sizeof(stored));
+    if (raw == 0 || raw > MSG_STREAM_LZ_BLOCK || stored == 0 || stored > raw ||
+        msg_stream_get_all(link, stream, peer, lz_wire, stored) != stored) {
+        return MSG_FAILURE;
+    }
+    if (stored == raw) {
+        memcpy(stream->block, lz_wire, raw);
+    }
+    else if (msg_lz_decompress(lz_wire, stored, stream->block, MSG_STREAM_LZ_BLOCK) != raw) {
+        return MSG_FAILURE;
+    }
+    stream->block_len = raw;
+    stream->block_pos = 0;
+    return raw;
+}
+#endif
+
+int msg_stream_write(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer, const uint8_t *buf, int len)
+{
+    if (stream->channel == NULL || !stream->writer || len < 0) {
+        return MSG_FAILURE;
+    }
+#ifdef MSG_STREAM_LZ
+    if (stream->compress) {
+        while (len > 0) {
+            int n = MSG_STREAM_LZ_BLOCK - stream->block_len;
+            if (n > len) {
+                n = len;
+            }
+            memcpy(&stream->block[stream->block_len], buf, n);
+            stream->block_len += n;
+            buf += n;
+            len -= n;
+
+            if (stream->block_len == MSG_STREAM_LZ_BLOCK &&
+                msg_stream_put_block(link, stream, peer) != MSG_SUCCESS) {
+                return MSG_FAILURE;
+            }
+        }
+        return MSG_SUCCESS;
+    }
+#endif
+    return msg_stream_put(link, stream, peer, buf, len);
+}
+
+int msg_stream_read(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer, uint8_t *buf, int len)
+{
+    if (stream->channel == NULL || stream->writer || len < 0) {
+        return MSG_FAILURE;
+    }
+#ifdef MSG_STREAM_LZ
+    if (stream->compress) {
+        if (stream->block_pos == stream->block_len) {
+            int result = msg_stream_get_block(link, stream, peer);
+            if (result <= 0) {
+                return result;
+            }
+        }
+        int n = stream->block_len - stream->block_pos;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(buf, &stream->block[stream->block_pos], n);
+        stream->block_pos += n;
+        return n;
+    }
+#endif
+    return msg_stream_get(link, stream, peer, buf, len);
+}
+
+int msg_stream_close(const msg_transport_t *link, msg_stream_t *stream, uint8_t peer)
+{
+    int result = MSG_SUCCESS;
+#ifdef MSG_STREAM_LZ
+    if (stream->channel != NULL && stream->writer && stream->compress && stream->block_len > 0) {
+        result = msg_stream_put_block(link, stream, peer);
+    }
+#endif
+    if (stream->channel != NULL && stream->writer && result == MSG_SUCCESS) {
+        result = msg_stream_flush(link, stream, peer, MSG_OPCODE_STREAM_FIN);
+    }
+    if (stream->channel == &stream->own) {
+        msg_channel_close(&stream->own);
+    }
+    memset(stream, 0, sizeof(msg_stream_t));
+    return result;
+}
+#endif
+
+#ifdef MSG_JUMBO
+// Jumbo frames are sealed and opened here, MSG_JUMBO_HDR_LEN bytes in front
+// of the frame hold its length on the bus and keep the frame word aligned
+static uint8_t jumbo_frame[4 + MSG_JUMBO_WIRE_LEN] __attribute__((aligned(4)));
+#define JUMBO_WIRE (&jumbo_frame[4])
+#define JUMBO_BUS (&jumbo_frame[4 - MSG_JUMBO_HDR_LEN])
+typedef char msg_jumbo_fits_t[(MSG_JUMBO_HDR_LEN + MSG_JUMBO_WIRE_LEN <= UINT16_MAX) ? 1 : -1];
+
+// Wipes jumbo_frame once a jumbo frame is done with. With DMA_COPY the wipe
+// runs on while the caller goes on, the next jumbo frame waits for it
+static void msg_jumbo_wipe(void)
+{
+#ifdef DMA_COPY
+    dma_fill_start(jumbo_frame, 0, sizeof(jumbo_frame), NULL, NULL);
+#else
+    memset(jumbo_frame, 0, sizeof(jumbo_frame));
+#endif
+}
+
+int msg_jumbo_send(const msg_transport_t *link, msg_channel_t *channel, uint8_t peer, const uint8_t *buf, int len)
+{
+    if (len < 0 || len > MSG_JUMBO_MAX_LEN || channel->tx_seq == UINT32_MAX) {
+        return MSG_FAILURE;
+    }
+    dma_copy_wait();
+    transmit.rng_chal = ++channel->tx_seq;
+    transmit.rng_resp = (link->role == MSG_ROLE_COMP) ? MSG_CHANNEL_FROM_COMP : MSG_CHANNEL_FROM_AP;
+    transmit.opcode = MSG_OPCODE_JUMBO;
+    transmit.len = 0;
+
+    uint16_t data_len = (uint16_t)len;
+    memcpy(JUMBO_WIRE, (uint8_t*)&transmit, MSG_HEADER_LEN);
+    memcpy(JUMBO_WIRE + MSG_HEADER_LEN, &data_len, MSG_JUMBO_HDR_LEN);
+    dma_copy(JUMBO_WIRE + MSG_HEADER_LEN + MSG_JUMBO_HDR_LEN, buf, len);
+
+    if (msg_channel_enter(link, channel) != MSG_SUCCESS) {
+        msg_jumbo_wipe();
+        return MSG_FAILURE;
+    }
+    int wire_len = msg_seal_wire(JUMBO_WIRE, MSG_HEADER_LEN + MSG_JUMBO_HDR_LEN + len);
+    msg_channel_leave(link);
+    if (wire_len < 0) {
+        msg_jumbo_wipe();
+        return MSG_FAILURE;
+    }
+
+    // Full packets, then the rest, each once the peer has a bank free for it
+    uint16_t bus_len = (uint16_t)(MSG_JUMBO_HDR_LEN + wire_len);
+    memcpy(JUMBO_BUS, &bus_len, MSG_JUMBO_HDR_LEN);
+    int result = MSG_SUCCESS;
+    for (int sent = 0; sent < bus_len && result == MSG_SUCCESS; ) {
+        int n = bus_len - sent;
+        if (n > MAX_MSG_LEN) {
+            n = MAX_MSG_LEN;
+        }
+        MSG_DIRTY(tx_frame_dirty, MSG_MAX_HEADROOM + n);
+        memcpy(TX_WIRE, JUMBO_BUS + sent, n);
+        if ((link->wait_free != NULL && link->wait_free(peer) < 0) ||
+            link->send(peer, (uint8_t)n, TX_WIRE - link->headroom) < 0) {
+            result = MSG_FAILURE;
+        }
+        sent += n;
+    }
+    msg_jumbo_wipe();
+    return result;
+}
+
+int msg_jumbo_recv(const msg_transport_t *link, msg_channel_t *channel, uint8_t peer, uint8_t *buf, int maxlen)
+{
+    // Every packet but the last is full, the first says how many follow
+    dma_copy_wait();
+    int bus_len = 0;
+    int got = 0;
+    do {
+        int n = link->recv(peer, msg_rx_frame);
+        if (n < 0) {
+            break;
+        }
+        if (got == 0 && n >= MSG_JUMBO_HDR_LEN) {
+            uint16_t total;
+            memcpy(&total, msg_rx_frame, MSG_JUMBO_HDR_LEN);
+            bus_len = total;
+        }
+        int expect = bus_len - got;
+        if (expect > MAX_MSG_LEN) {
+            expect = MAX_MSG_LEN;
+        }
+        if (bus_len < MSG_JUMBO_HDR_LEN + MIN_MSG_LEN || bus_len > MSG_JUMBO_HDR_LEN + MSG_JUMBO_WIRE_LEN ||
+            n != expect) {
+            memset(msg_rx_frame, 0, n);
+            bus_len = -1;
+            break;
+        }
+        dma_copy(JUMBO_BUS + got, msg_rx_frame, n);
+        memset(msg_rx_frame, 0, n);
+        got += n;
+    } while (got < bus_len);
+    if (bus_len < 0 || got != bus_len) {
+        STATS_INC(auth_failures);
+        msg_jumbo_wipe();
+        return MSG_FAILURE;
+    }
+
+    // No transport hooks, the packets were all released as they were copied
+    int wire_len = bus_len - MSG_JUMBO_HDR_LEN;
+    if (msg_channel_enter(link, channel) != MSG_SUCCESS) {
+        msg_jumbo_wipe();
+        return MSG_FAILURE;
+    }
+    int plain_len = msg_open_wire(NULL, JUMBO_WIRE, wire_len);
+    msg_channel_leave(link);
+
+    // Only jumbo frames from the other end, and only ones we have not seen yet
+    int result = MSG_FAILURE;
+    if (plain_len >= MSG_HEADER_LEN + MSG_JUMBO_HDR_LEN) {
+        msg_t header;
+        uint16_t data_len;
+        uint32_t from = (link->role == MSG_ROLE_COMP) ? MSG_CHANNEL_FROM_AP : MSG_CHANNEL_FROM_COMP;
+        memcpy((uint8_t*)&header, JUMBO_WIRE, MSG_HEADER_LEN);
+        memcpy(&data_len, JUMBO_WIRE + MSG_HEADER_LEN, MSG_JUMBO_HDR_LEN);
+        if (header.opcode != MSG_OPCODE_JUMBO || header.len != 0 || header.rng_resp != from ||
+            data_len != plain_len - MSG_HEADER_LEN - MSG_JUMBO_HDR_LEN) {
+            STATS_INC(auth_failures);
+        }
+        else if (header.rng_chal <= channel->rx_seq) {
+            STATS_INC(chal_mismatches);
+        }
+        else if (data_len <= maxlen) {
+            channel->rx_seq = header.rng_chal;
+            dma_copy(buf, JUMBO_WIRE + MSG_HEADER_LEN + MSG_JUMBO_HDR_LEN, data_len);
+            result = data_len;
+        }
+    }
+    msg_jumbo_wipe();
+    return result;
+}
+#endif
+
+int msg_pack_records(const msg_record_t *records, int n)
+{
+    int pos = 1;
+    int count = 0;
+    while (count < n && count < UINT8_MAX) {
+        uint8_t len = records[count].len;
+        if (len > MSG_RECORD_MAX_LEN) {
+            MSG_DIRTY(transmit_dirty, pos);
+            return MSG_FAILURE;
+        }
+        if (pos + 1 + len > MAX_CONTENTS_LEN) {
+            break;
+        }
+        transmit.contents[pos] = len;
+        memcpy(&transmit.contents[pos + 1], records[count].buf, len);
+        pos += 1 + len;
+        count++;
+    }
+
+    transmit.opcode = MSG_OPCODE_BATCH;
+    transmit.contents[0] = (uint8_t)count;
+    transmit.len = (uint8_t)pos;
+    return count;
+}
+
+int msg_gather_len(const msg_record_t *frags, int n)
+{
+    int len = 0;
+    for (int i = 0; i < n; i++) {
+        len += frags[i].len;
+    }
+    return len;
+}
+
+int msg_gather(const msg_record_t *frags, int n)
+{
+    if (msg_gather_len(frags, n) > MSG_RECORD_MAX_LEN) {
+        return MSG_FAILURE;
+    }
+
+    int pos = 1;
+    for (int i = 0; i < n; i++) {
+        memcpy(&transmit.contents[pos], frags[i].buf, frags[i].len);
+        pos += frags[i].len;
+    }
+
+    transmit.contents[0] = (uint8_t)(pos - 1);
+    transmit.len = (uint8_t)pos;
+    return pos - 1;
+}
+
+int msg_unpack_records(msg_record_t *records, int n)
+{
+    if (receive.opcode != MSG_OPCODE_BATCH || receive.len < 1) {
+        return MSG_FAILURE;
+    }
+
+    int count = receive.contents[0];
+    int pos = 1;
+    for (int i = 0; i < count; i++) {
+        if (pos >= receive.len) {
+            return MSG_FAILURE;
+        }
+        uint8_t len = receive.contents[pos];
+        if (len > MSG_RECORD_MAX_LEN || pos + 1 + len > receive.len) {
+            return MSG_FAILURE;
+        }
+        if (i < n) {
+            memcpy(records[i].buf, &receive.contents[pos + 1], len);
+            records[i].len = len;
+        }
+        pos += 1 + len;
+    }
+
+    return count < n ? count : n;
+}
+
+void reset_msg()
+{
+    // transmit is filled in by callers, who set len to cover what they wrote
+    if (transmit.len <= MAX_CONTENTS_LEN) {
+        MSG_DIRTY(transmit_dirty, transmit.len);
+    } else {
+        transmit_dirty = MAX_CONTENTS_LEN;
+    }
+    secure_zero(&transmit, offsetof(msg_t, contents) + transmit_dirty);
+    secure_zero(&receive, offsetof(msg_t, contents) + receive_dirty);
+    secure_zero(tx_frame, tx_frame_dirty);
+    transmit_dirty = 0;
+    receive_dirty = 0;
+    tx_frame_dirty = 0;
+    prev_chal = 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file msg_lz.c
+ * @brief Small window LZ77 for compressed message streams
+ * @date 2024
+ *
+ * See msg_lz.h for the token format. Literals are gathered until the next
+ * match or until a run is full, so incompressible data grows by one byte
+ * in MSG_LZ_MAX_LITERALS.
+ */
+
+#include "msg_lz.h"
+
+#ifdef MSG_STREAM_LZ
+
+#include <string.h>
+
+// Last position each 3 byte prefix hash was seen at, plus one, 0 if never
+static uint16_t lz_table[MSG_LZ_HASH_SIZE];
+
+static uint32_t lz_hash(const uint8_t *p)
+{
+    uint32_t v = p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+    return (v * 2654435761u) >> (32 - MSG_LZ_HASH_BITS);
+}
+
+// Writes a literal run of lit bytes, returns the new output length or -1
+static int lz_literals(const uint8_t *lit, int n, uint8_t *out, int pos, int cap)
+{
+    while (n > 0) {
+        int run = (n > MSG_LZ_MAX_LITERALS) ? MSG_LZ_MAX_LITERALS : n;
+        if (pos + 1 + run > cap) {
+            return -1;
+        }
+        out[pos++] = (uint8_t)(run - 1);
+        memcpy(&out[pos], lit, run);
+        pos += run;
+        lit += run;
+        n -= run;
+    }
+    return pos;
+}
+
+int msg_lz_compress(const uint8_t *in, int len, uint8_t *out, int cap)
+{
+    if (len < 0 || len > MSG_LZ_MAX_LEN) {
+        return -1;
+    }
+    memset(lz_table, 0, sizeof(lz_table));
+
+    int pos = 0;
+    int lit = 0;
+    int i = 0;
+    while (i + MSG_LZ_MIN_MATCH <= len) {
+        uint32_t h = lz_hash(&in[i]);
+        int cand = (int)lz_table[h] - 1;
+        lz_table[h] = (uint16_t)(i + 1);
+
+        int m = 0;
+        if (cand >= 0) {
+            int limit = len - i;
+            if (limit > MSG_LZ_MAX_MATCH) {
+                limit = MSG_LZ_MAX_MATCH;
+            }
+            while (m < limit && in[cand + m] == in[i + m]) {
+                m++;
+            }
+        }
+        if (m < MSG_LZ_MIN_MATCH) {
+            i++;
+            continue;
+        }
+
+        pos = lz_literals(&in[lit], i - lit, out, pos, cap);
+        if (pos < 0 || pos + 3 > cap) {
+            return -1;
+        }
+        uint16_t offset = (uint16_t)(i - cand - 1);
+        out[pos++] = (uint8_t)(0x80 | (m - MSG_LZ_MIN_MATCH));
+        out[pos++] = (uint8_t)offset;
+        out[pos++] = (uint8_t)(offset >> 8);
+
+        // Only the start of the match goes into the table, the rest of it
+        // is skipped to keep the work per byte bounded
+        i += m;
+        lit = i;
+    }
+    return lz_literals(&in[lit], len - lit, out, pos, cap);
+}
+
+int msg_lz_decompress(const uint8_t *in, int len, uint8_t *out, int cap)
+{
+    int pos = 0;
+    int i = 0;
+    while (i < len) {
+        uint8_t token = in[i++];
+        if (!(token & 0x80)) {
+            int run = token + 1;
+            if (run > len - i || run > cap - pos) {
+                return -1;
+            }
+            memcpy(&out[pos], &in[i], run);
+            pos += run;
+            i += run;
+            continue;
+        }
+
+        if (len - i < 2) {
+            return -1;
+        }
+        int m = (token & 0x7F) + MSG_LZ_MIN_MATCH;
+        int offset = (in[i] | (in[i + 1] << 8)) + 1;
+        i += 2;
+        if (offset > pos || m > cap - pos) {
+            return -1;
+        }
+        // Byte by byte, a match may overlap what it produces
+        for (int k = 0; k < m; k++, pos++) {
+            out[pos] = out[pos - offset];
+        }
+    }
+    return pos;
+}
+
+#endif
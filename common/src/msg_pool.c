@@ -0,0 +1,153 @@
+/**
+ * @file msg_pool.c
+ * @brief Fixed block buffer pool for post-boot code
+ * @date 2024
+ *
+ * See msg_pool.h. The blocks live in .msg_pool, the free lists and counts
+ * in .bss, so a reset forgets every block held and the first call rebuilds
+ * the lists.
+ */
+
+#include "msg_pool.h"
+
+#ifdef MSG_POOL
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "mxc_device.h"
+
+typedef char msg_pool_frames_t[(MSG_POOL_FRAMES > 0) ? 1 : -1];
+typedef char msg_pool_payloads_t[(MSG_POOL_PAYLOADS > 0) ? 1 : -1];
+
+// A free block holds the next free block of its class in its first word
+typedef struct msg_pool_block {
+    struct msg_pool_block *next;
+} msg_pool_block_t;
+
+static uint8_t pool_frames[MSG_POOL_FRAMES][MSG_POOL_FRAME_LEN]
+    __attribute__((section(".msg_pool"), aligned(4)));
+static uint8_t pool_payloads[MSG_POOL_PAYLOADS][MSG_POOL_PAYLOAD_LEN]
+    __attribute__((section(".msg_pool"), aligned(4)));
+
+static const struct {
+    uint8_t *base;
+    uint32_t len;
+    uint32_t count;
+} pool_classes[MSG_POOL_CLASSES] = {
+    [MSG_POOL_FRAME] = { &pool_frames[0][0], MSG_POOL_FRAME_LEN, MSG_POOL_FRAMES },
+    [MSG_POOL_PAYLOAD] = { &pool_payloads[0][0], MSG_POOL_PAYLOAD_LEN, MSG_POOL_PAYLOADS },
+};
+
+static msg_pool_block_t *pool_free[MSG_POOL_CLASSES];
+static uint32_t pool_avail[MSG_POOL_CLASSES];
+static uint32_t pool_low[MSG_POOL_CLASSES];
+static bool pool_ready;
+
+/**
+ * @brief Threads every block onto its free list.
+ *
+ * Called with interrupts masked, the first time the pool is used.
+ */
+static void pool_init(void)
+{
+    for (int cls = 0; cls < MSG_POOL_CLASSES; cls++) {
+        pool_free[cls] = NULL;
+        for (uint32_t i = pool_classes[cls].count; i-- > 0;) {
+            msg_pool_block_t *block = (msg_pool_block_t *)(pool_classes[cls].base + i * pool_classes[cls].len);
+            block->next = pool_free[cls];
+            pool_free[cls] = block;
+        }
+        pool_avail[cls] = pool_classes[cls].count;
+        pool_low[cls] = pool_classes[cls].count;
+    }
+    pool_ready = true;
+}
+
+/**
+ * @brief Takes a free block.
+ *
+ * @param cls Class of the block.
+ * @return The block, NULL if every block of cls is held or cls is invalid.
+ */
+void *msg_pool_alloc(msg_pool_class_t cls)
+{
+    if ((unsigned)cls >= MSG_POOL_CLASSES) {
+        return NULL;
+    }
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (!pool_ready) {
+        pool_init();
+    }
+    msg_pool_block_t *block = pool_free[cls];
+    if (block != NULL) {
+        pool_free[cls] = block->next;
+        if (--pool_avail[cls] < pool_low[cls]) {
+            pool_low[cls] = pool_avail[cls];
+        }
+    }
+    __set_PRIMASK(primask);
+    return block;
+}
+
+/**
+ * @brief Returns a block to its class.
+ *
+ * The class is found from the address, so any block can be freed where it
+ * ends up, including from an interrupt.
+ *
+ * @param buf Block from msg_pool_alloc.
+ * @return 0, or -1 if buf is not the start of a pool block.
+ */
+int msg_pool_free(void *buf)
+{
+    for (int cls = 0; cls < MSG_POOL_CLASSES; cls++) {
+        uintptr_t offset = (uintptr_t)buf - (uintptr_t)pool_classes[cls].base;
+        if (offset >= (uintptr_t)pool_classes[cls].len * pool_classes[cls].count) {
+            continue;
+        }
+        if (offset % pool_classes[cls].len != 0) {
+            return -1;
+        }
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        msg_pool_block_t *block = buf;
+        block->next = pool_free[cls];
+        pool_free[cls] = block;
+        pool_avail[cls]++;
+        __set_PRIMASK(primask);
+        return 0;
+    }
+    return -1;
+}
+
+/**
+ * @brief Counts the free blocks of a class.
+ *
+ * @param cls Class to count.
+ * @return Blocks free right now.
+ */
+uint32_t msg_pool_available(msg_pool_class_t cls)
+{
+    if ((unsigned)cls >= MSG_POOL_CLASSES) {
+        return 0;
+    }
+    return pool_ready ? pool_avail[cls] : pool_classes[cls].count;
+}
+
+/**
+ * @brief Gives the low water mark of a class, for sizing the pool.
+ *
+ * @param cls Class to look at.
+ * @return Fewest blocks that were free at once since reset.
+ */
+uint32_t msg_pool_low_water(msg_pool_class_t cls)
+{
+    if ((unsigned)cls >= MSG_POOL_CLASSES) {
+        return 0;
+    }
+    return pool_ready ? pool_low[cls] : pool_classes[cls].count;
+}
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @file power_mark.c
+ * @brief GPIO phase markers for an external power analyzer
+ * @date 2024
+ *
+ * See power_mark.h. The pins go through the port's set and clear
+ * registers, so an interrupt marking another phase between the read and
+ * the write of a phase's depth cannot undo its edge.
+ */
+
+#include "power_mark.h"
+
+#ifdef POWER_MARKERS
+
+#include "mxc_device.h"
+#include "gpio.h"
+
+typedef char power_mark_pins_fit_t[(POWER_MARK_PIN0 + POWER_PHASE_CNT <= 32) ? 1 : -1];
+
+// How many times each phase is entered without having been exited
+static volatile uint8_t power_depth[POWER_PHASE_CNT];
+
+/**
+ * @brief Configures the marker pins as outputs and drives them low.
+ */
+void power_mark_init(void)
+{
+    mxc_gpio_cfg_t cfg;
+    cfg.port = POWER_MARK_PORT;
+    cfg.mask = ((1U << POWER_PHASE_CNT) - 1) << POWER_MARK_PIN0;
+    cfg.func = MXC_GPIO_FUNC_OUT;
+    cfg.pad = MXC_GPIO_PAD_NONE;
+    cfg.vssel = MXC_GPIO_VSSEL_VDDIO;
+    cfg.drvstr = MXC_GPIO_DRVSTR_0;
+    MXC_GPIO_OutClr(POWER_MARK_PORT, cfg.mask);
+    MXC_GPIO_Config(&cfg);
+
+    for (int i = 0; i < POWER_PHASE_CNT; i++) {
+        power_depth[i] = 0;
+    }
+}
+
+/**
+ * @brief Enters or exits a phase.
+ *
+ * The pin rises on the outermost entry and falls on the matching exit. An
+ * exit of a phase that was never entered is ignored.
+ *
+ * @param phase Phase being marked.
+ * @param on Nonzero on entry, 0 on exit.
+ */
+void power_mark(power_phase_t phase, int on)
+{
+    uint32_t mask = 1U << (POWER_MARK_PIN0 + phase);
+    if (on) {
+        if (power_depth[phase]++ == 0) {
+            POWER_MARK_PORT->out_set = mask;
+        }
+    } else if (power_depth[phase] > 0 && --power_depth[phase] == 0) {
+        POWER_MARK_PORT->out_clr = mask;
+    }
+}
+
+#endif
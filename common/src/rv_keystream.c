@@ -0,0 +1,113 @@
+/**
+ * @file rv_keystream.c
+ * @brief M4 side of the RISC-V keystream mailbox
+ * @date 2024
+ *
+ * See rv_keystream.h. The RISC-V program is linked into the M4 image as a
+ * binary blob by ../common/riscv_keystream.mk, copied into the top of SRAM
+ * here and started from there.
+ */
+
+#include "rv_keystream.h"
+
+#ifdef RISCV_KEYSTREAM
+
+#include <string.h>
+#include "mxc_device.h"
+#include "mxc_sys.h"
+#include "general_util.h"
+
+// Bounds of the RISC-V program, from objcopy's binary input
+extern const uint8_t _binary_rv_keystream_bin_start[];
+extern const uint8_t _binary_rv_keystream_bin_end[];
+
+static int rv_running;
+
+/**
+ * @brief Copies the RISC-V program into its SRAM and starts the core.
+ *
+ * The mailbox is cleared first, so the core finds no requests and the M4
+ * makes keystreams itself until the core has written its magic.
+ */
+void rv_keystream_start(void)
+{
+    size_t len = (size_t) (_binary_rv_keystream_bin_end - _binary_rv_keystream_bin_start);
+    if (len > RV_IMAGE_MAX) {
+        return;
+    }
+
+    memset(RV_MAILBOX, 0, sizeof(rv_mailbox_t));
+    memcpy((void *) RV_IMAGE_BASE, _binary_rv_keystream_bin_start, len);
+    __sync_synchronize();
+
+    MXC_FCR->urvbootaddr = RV_IMAGE_BASE;
+    MXC_SYS_RISCVRun();
+}
+
+/**
+ * @brief Tells whether the RISC-V core has come up.
+ *
+ * @return Nonzero once it has written its magic.
+ */
+int rv_keystream_running(void)
+{
+    if (!rv_running) {
+        rv_running = (RV_MAILBOX->magic == RV_KEYSTREAM_MAGIC);
+    }
+    return rv_running;
+}
+
+/**
+ * @brief Collects a keystream and hands the free slots back.
+ *
+ * A key schedule other than the mailbox's counts the epoch up before it is
+ * written, so everything made under the old one is dropped. Slots the core
+ * is working on are left alone.
+ *
+ * @param key Schedule of the key in use.
+ * @param draw_iv Draws the IV of a new request.
+ * @param iv Set to the IV of the keystream taken.
+ * @param keystream Set to the keystream taken.
+ *
+ * @return 1 if a keystream was taken, 0 if none was ready.
+ */
+int rv_keystream_take(const aes_ct_key_t *key, void (*draw_iv)(uint8_t iv[AES_CT_BLOCK_SIZE]),
+                      uint8_t iv[AES_CT_BLOCK_SIZE], uint8_t keystream[RV_KEYSTREAM_LEN])
+{
+    rv_mailbox_t *mb = RV_MAILBOX;
+    if (secure_memcmp((const uint8_t *) mb->key.sk, (const uint8_t *) key->sk, sizeof(key->sk))) {
+        mb->epoch++;
+        __sync_synchronize();
+        memcpy(&mb->key, key, sizeof(*key));
+        __sync_synchronize();
+    }
+
+    int took = 0;
+    for (unsigned i = 0; i < RV_KEYSTREAM_SLOTS; i++) {
+        rv_slot_t *slot = &mb->slots[i];
+        uint32_t state = slot->state;
+        if (state == RV_SLOT_REQUESTED) {
+            continue;
+        }
+        __sync_synchronize();
+        if (state == RV_SLOT_READY && slot->epoch == mb->epoch) {
+            if (took) {
+                // Kept for the next call
+                continue;
+            }
+            memcpy(iv, slot->iv, AES_CT_BLOCK_SIZE);
+            memcpy(keystream, slot->keystream, RV_KEYSTREAM_LEN);
+            took = 1;
+        }
+
+        // Empty, just taken or made under an old key
+        memset(slot->keystream, 0, RV_KEYSTREAM_LEN);
+        draw_iv(slot->iv);
+        slot->epoch = mb->epoch;
+        __sync_synchronize();
+        slot->state = RV_SLOT_REQUESTED;
+    }
+    return took;
+}
+
+#endif
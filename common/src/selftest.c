@@ -0,0 +1,497 @@
+#include "selftest.h"
+
+#ifdef SELFTEST_ENABLE
+
+#include <stdio.h>
+#include <string.h>
+#include "mxc_device.h"
+#include "crypto_util.h"
+#include "general_util.h"
+#include "tiny_printf.h"
+#include "wolfssl/wolfcrypt/aes.h"
+#include "wolfssl/wolfcrypt/hmac.h"
+#include "wolfssl/wolfcrypt/sha256.h"
+
+#ifdef AES_CT
+#include "aes_ct.h"
+#endif
+#ifdef AES_TT
+#include "aes_tt.h"
+#endif
+#ifdef WOLFSSL_MAX78000_AES
+#include "wolfssl/wolfcrypt/port/maxim/max78000.h"
+#endif
+#ifdef MSG_AEAD_ASCON
+#include "ascon.h"
+#endif
+
+// Data the cross-checks run over, a few CBC blocks more than a full message
+#define SELFTEST_BUF_LEN 256
+
+// Device key, defined in crypto_util.c, the reference AES and HMAC run under it
+extern uint8_t key[16];
+
+// FIPS-197 appendix C.1
+static const uint8_t kat_aes_key[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t kat_aes_pt[16] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+static const uint8_t kat_aes_ct[16] = {
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+};
+
+// FIPS 180-2 appendix B, one block, nothing and two blocks
+typedef struct {
+    const char *msg;
+    uint8_t digest[HASH_LEN];
+} kat_sha256_t;
+
+static const kat_sha256_t kat_sha256[] = {
+    { "abc", {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad } },
+    { "", {
+        0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+        0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55 } },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", {
+        0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+        0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1 } },
+};
+
+// RFC 4231 test case 2
+static const char kat_hmac_key[] = "Jefe";
+static const char kat_hmac_msg[] = "what do ya want for nothing?";
+static const uint8_t kat_hmac_mac[HASH_LEN] = {
+    0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+    0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43
+};
+
+#ifdef MSG_AEAD_ASCON
+// Ascon-128 v1.2 KAT 1 and 2: key and nonce 00..0f, no associated data, an
+// empty plaintext and the single byte 00. Ciphertext then tag
+static const uint8_t kat_ascon_empty[16] = {
+    0xe3, 0x55, 0x15, 0x9f, 0x29, 0x29, 0x11, 0xf7, 0x94, 0xcb, 0x14, 0x32, 0xa0, 0x10, 0x3a, 0x8a
+};
+static const uint8_t kat_ascon_byte[17] = {
+    0xbc, 0x18, 0xc3, 0xf4, 0xe3, 0x9e, 0xca, 0x72, 0x22, 0x49, 0x0d, 0x96, 0x7c, 0x79, 0xbf, 0xfc,
+    0x92
+};
+#endif
+
+static const uint8_t test_iv[IV_SIZE] = {
+    0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87,
+    0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f
+};
+
+// Inputs, reference results and fast path results of the cross-checks
+static uint8_t test_in[SELFTEST_BUF_LEN];
+static uint8_t test_ref[SELFTEST_BUF_LEN];
+static uint8_t test_out[SELFTEST_BUF_LEN];
+
+/**
+ * @brief Encrypts or decrypts with wolfCrypt's software AES-CBC.
+ *
+ * The reference the fast paths are checked against, the context is never
+ * handed to the AES engine.
+ *
+ * @param k 16 byte key.
+ * @param dir AES_ENCRYPTION or AES_DECRYPTION.
+ * @param in Input.
+ * @param out Output.
+ * @param len Length, a multiple of the block size.
+ * @return 0 on success, negative wolfCrypt error code on failure.
+ */
+static int ref_cbc(const uint8_t *k, int dir, const uint8_t *in, uint8_t *out, size_t len)
+{
+    Aes aes;
+    int ret = wc_AesInit(&aes, crypto_heap(), INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_AesSetKey(&aes, k, 16, test_iv, dir);
+    }
+    if (ret == 0) {
+        ret = (dir == AES_ENCRYPTION) ? wc_AesCbcEncrypt(&aes, out, in, len)
+                                      : wc_AesCbcDecrypt(&aes, out, in, len);
+    }
+    wc_AesFree(&aes);
+    return ret;
+}
+
+/**
+ * @brief SHA-256 of the FIPS 180-2 messages, through hash.
+ */
+static int test_sha256_kat(void)
+{
+    uint8_t digest[HASH_LEN];
+    int fails = 0;
+    for (size_t i = 0; i < sizeof(kat_sha256) / sizeof(kat_sha256[0]); i++) {
+        hash((uint8_t *) kat_sha256[i].msg, digest, strlen(kat_sha256[i].msg));
+        fails += memcmp(digest, kat_sha256[i].digest, HASH_LEN) != 0;
+    }
+    return fails;
+}
+
+/**
+ * @brief hash_many over buffers of odd lengths against hash of each.
+ */
+static int test_hash_many(void)
+{
+    uint8_t *const parts[4] = { test_in, test_in + 1, test_in + 64, test_in + 100 };
+    const size_t lens[4] = { 0, 55, 64, 156 };
+    uint8_t many[4][HASH_LEN];
+    uint8_t one[HASH_LEN];
+    int fails = 0;
+
+    hash_many(parts, many, lens, 4);
+    for (int i = 0; i < 4; i++) {
+        hash(parts[i], one, lens[i]);
+        fails += memcmp(one, many[i], HASH_LEN) != 0;
+    }
+    return fails;
+}
+
+/**
+ * @brief wolfCrypt's HMAC-SHA256 against RFC 4231.
+ */
+static int test_hmac_kat(void)
+{
+    Hmac h;
+    uint8_t mac[HASH_LEN];
+    int ret = wc_HmacInit(&h, crypto_heap(), INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_HmacSetKey(&h, WC_SHA256, (const uint8_t *) kat_hmac_key, strlen(kat_hmac_key));
+    }
+    if (ret == 0) {
+        ret = wc_HmacUpdate(&h, (const uint8_t *) kat_hmac_msg, strlen(kat_hmac_msg));
+    }
+    if (ret == 0) {
+        ret = wc_HmacFinal(&h, mac);
+    }
+    wc_HmacFree(&h);
+    return ret != 0 || memcmp(mac, kat_hmac_mac, HASH_LEN) != 0;
+}
+
+/**
+ * @brief hmac, from the session's midstates, against wolfCrypt's HMAC.
+ */
+static int test_hmac_session(void)
+{
+    Hmac h;
+    uint8_t ref[HASH_LEN];
+    uint8_t mac[HASH_LEN];
+    int ret = wc_HmacInit(&h, crypto_heap(), INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_HmacSetKey(&h, WC_SHA256, key, sizeof(key));
+    }
+    if (ret == 0) {
+        ret = wc_HmacUpdate(&h, test_in, SELFTEST_BUF_LEN);
+    }
+    if (ret == 0) {
+        ret = wc_HmacFinal(&h, ref);
+    }
+    wc_HmacFree(&h);
+    if (ret == 0) {
+        ret = hmac(test_in, mac, SELFTEST_BUF_LEN);
+    }
+    return ret != 0 || memcmp(mac, ref, HASH_LEN) != 0;
+}
+
+/**
+ * @brief wolfCrypt's software AES against FIPS-197, the reference itself.
+ */
+static int test_aes_kat(void)
+{
+    Aes aes;
+    uint8_t block[16];
+    int fails = 0;
+    int ret = wc_AesInit(&aes, crypto_heap(), INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_AesSetKey(&aes, kat_aes_key, 16, NULL, AES_ENCRYPTION);
+    }
+    if (ret == 0) {
+        ret = wc_AesEncryptDirect(&aes, block, kat_aes_pt);
+        fails += memcmp(block, kat_aes_ct, 16) != 0;
+    }
+    if (ret == 0) {
+        ret = wc_AesSetKey(&aes, kat_aes_key, 16, NULL, AES_DECRYPTION);
+    }
+    if (ret == 0) {
+        ret = wc_AesDecryptDirect(&aes, block, kat_aes_ct);
+        fails += memcmp(block, kat_aes_pt, 16) != 0;
+    }
+    wc_AesFree(&aes);
+    return ret != 0 || fails;
+}
+
+/**
+ * @brief The session's AES-CBC, whichever backend it runs on, against the
+ * software reference under the device key.
+ */
+static int test_aes_cbc_session(void)
+{
+    uint8_t iv[IV_SIZE];
+    int fails = 0;
+
+    int ret = ref_cbc(key, AES_ENCRYPTION, test_in, test_ref, SELFTEST_BUF_LEN);
+    memcpy(iv, test_iv, IV_SIZE);
+    aes_encrypt(test_in, test_out, iv, SELFTEST_BUF_LEN);
+    fails += memcmp(test_out, test_ref, SELFTEST_BUF_LEN) != 0;
+
+    memcpy(iv, test_iv, IV_SIZE);
+    aes_decrypt(test_ref, test_out, iv, SELFTEST_BUF_LEN);
+    fails += memcmp(test_out, test_in, SELFTEST_BUF_LEN) != 0;
+    return ret != 0 || fails;
+}
+
+/**
+ * @brief aes_decrypt_block, the one frames are decrypted with as they
+ * arrive, against the software reference.
+ */
+static int test_aes_decrypt_block(void)
+{
+    uint8_t block[16];
+    int fails = 0;
+    int ret = ref_cbc(key, AES_ENCRYPTION, test_in, test_ref, SELFTEST_BUF_LEN);
+    for (size_t pos = 0; ret == 0 && pos < SELFTEST_BUF_LEN; pos += 16) {
+        ret = aes_decrypt_block(&test_ref[pos], block);
+        // Undo the chaining, the block was encrypted CBC
+        const uint8_t *prev = (pos == 0) ? test_iv : &test_ref[pos - 16];
+        for (int i = 0; i < 16; i++) {
+            block[i] ^= prev[i];
+        }
+        fails += memcmp(block, &test_in[pos], 16) != 0;
+    }
+    return ret != 0 || fails;
+}
+
+#ifdef MSG_CTR
+/**
+ * @brief The session's AES-CTR against wolfCrypt's software CTR, over a
+ * length that ends mid block.
+ */
+static int test_aes_ctr_session(void)
+{
+    const size_t len = SELFTEST_BUF_LEN - 5;
+    Aes aes;
+    int ret = wc_AesInit(&aes, crypto_heap(), INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_AesSetKey(&aes, key, 16, test_iv, AES_ENCRYPTION);
+    }
+    if (ret == 0) {
+        ret = wc_AesCtrEncrypt(&aes, test_ref, test_in, len);
+    }
+    wc_AesFree(&aes);
+    if (ret == 0) {
+        ret = aes_ctr_crypt(test_in, test_out, test_iv, len);
+    }
+    return ret != 0 || memcmp(test_out, test_ref, len) != 0;
+}
+#endif
+
+#ifdef AES_CT
+/**
+ * @brief The bitsliced AES against FIPS-197 and its CBC against the
+ * software reference.
+ */
+static int test_aes_ct(void)
+{
+    aes_ct_key_t ks;
+    uint8_t block[16];
+    int fails = 0;
+
+    aes_ct_setkey(&ks, kat_aes_key);
+    aes_ct_encrypt_block(&ks, kat_aes_pt, block);
+    fails += memcmp(block, kat_aes_ct, 16) != 0;
+    aes_ct_decrypt_block(&ks, kat_aes_ct, block);
+    fails += memcmp(block, kat_aes_pt, 16) != 0;
+
+    int ret = ref_cbc(kat_aes_key, AES_ENCRYPTION, test_in, test_ref, SELFTEST_BUF_LEN);
+    aes_ct_cbc_encrypt(&ks, test_iv, test_in, test_out, SELFTEST_BUF_LEN);
+    fails += memcmp(test_out, test_ref, SELFTEST_BUF_LEN) != 0;
+    aes_ct_cbc_decrypt(&ks, test_iv, test_ref, test_out, SELFTEST_BUF_LEN);
+    fails += memcmp(test_out, test_in, SELFTEST_BUF_LEN) != 0;
+    aes_ct_wipe(&ks);
+    return ret != 0 || fails;
+}
+#endif
+
+#ifdef AES_TT
+/**
+ * @brief The two-block CBC decryption against wc_AesCbcDecrypt, with the
+ * same round keys.
+ */
+static int test_aes_tt(void)
+{
+    Aes aes;
+    int ret = ref_cbc(kat_aes_key, AES_ENCRYPTION, test_in, test_ref, SELFTEST_BUF_LEN);
+    if (ret == 0) {
+        ret = wc_AesInit(&aes, crypto_heap(), INVALID_DEVID);
+    }
+    if (ret == 0) {
+        ret = wc_AesSetKey(&aes, kat_aes_key, 16, NULL, AES_DECRYPTION);
+    }
+    if (ret == 0) {
+        aes_tt_cbc_decrypt((const uint32_t *) aes.key, test_iv, test_ref, test_out, SELFTEST_BUF_LEN);
+    }
+    wc_AesFree(&aes);
+    return ret != 0 || memcmp(test_out, test_in, SELFTEST_BUF_LEN) != 0;
+}
+#endif
+
+#ifdef WOLFSSL_MAX78000_AES
+/**
+ * @brief The AES engine against FIPS-197 and the software reference.
+ */
+static int test_aes_engine(void)
+{
+    Aes aes;
+    uint8_t zero[IV_SIZE] = {0};
+    uint8_t block[16];
+    int fails = 0;
+
+    int ret = wc_AesInit(&aes, crypto_heap(), WOLFSSL_MAX78000_DEVID);
+    if (ret == 0) {
+        ret = wc_AesSetKey(&aes, kat_aes_key, 16, zero, AES_ENCRYPTION);
+    }
+    if (ret == 0) {
+        // One block under a zero IV is the bare cipher
+        ret = wc_AesCbcEncrypt(&aes, block, kat_aes_pt, 16);
+        fails += memcmp(block, kat_aes_ct, 16) != 0;
+    }
+    if (ret == 0) {
+        ret = ref_cbc(kat_aes_key, AES_ENCRYPTION, test_in, test_ref, SELFTEST_BUF_LEN);
+    }
+    if (ret == 0) {
+        ret = wc_AesSetIV(&aes, test_iv);
+    }
+    if (ret == 0) {
+        ret = wc_AesCbcEncrypt(&aes, test_out, test_in, SELFTEST_BUF_LEN);
+        fails += memcmp(test_out, test_ref, SELFTEST_BUF_LEN) != 0;
+    }
+    if (ret == 0) {
+        ret = wc_AesSetKey(&aes, kat_aes_key, 16, test_iv, AES_DECRYPTION);
+    }
+    if (ret == 0) {
+        ret = wc_AesCbcDecrypt(&aes, test_out, test_ref, SELFTEST_BUF_LEN);
+        fails += memcmp(test_out, test_in, SELFTEST_BUF_LEN) != 0;
+    }
+    wc_AesFree(&aes);
+    return ret != 0 || fails;
+}
+#endif
+
+#ifdef MSG_AEAD_ASCON
+/**
+ * @brief Ascon-128 against its KATs, and the session's aead_encrypt and
+ * aead_decrypt against it under the device key, a forged tag included.
+ */
+static int test_ascon(void)
+{
+    ascon_key_t ks;
+    uint8_t out[1];
+    uint8_t tag[ASCON_TAG_LEN];
+    uint8_t zero = 0;
+    int fails = 0;
+
+    // The FIPS-197 key is 00..0f as well, and doubles as the nonce
+    ascon_setkey(&ks, kat_aes_key);
+    ascon_encrypt(&ks, kat_aes_key, NULL, NULL, 0, tag);
+    fails += memcmp(tag, kat_ascon_empty, ASCON_TAG_LEN) != 0;
+    ascon_encrypt(&ks, kat_aes_key, &zero, out, 1, tag);
+    fails += out[0] != kat_ascon_byte[0] || memcmp(tag, &kat_ascon_byte[1], ASCON_TAG_LEN) != 0;
+
+    // A length that ends mid block
+    const size_t len = SELFTEST_BUF_LEN - 5;
+    ascon_setkey(&ks, key);
+    ascon_encrypt(&ks, test_iv, test_in, test_ref, len, tag);
+    int ret = aead_encrypt(test_in, test_out, (uint8_t *) test_iv, tag, len);
+    fails += memcmp(test_out, test_ref, len) != 0;
+    if (ret == 0) {
+        ret = aead_decrypt(test_ref, test_out, (uint8_t *) test_iv, tag, len);
+        fails += memcmp(test_out, test_in, len) != 0;
+    }
+    tag[0] ^= 1;
+    fails += aead_decrypt(test_ref, test_out, (uint8_t *) test_iv, tag, len) == 0;
+    ascon_wipe(&ks);
+    return ret != 0 || fails;
+}
+#endif
+
+typedef struct {
+    const char *name;
+    int (*run)(void);
+} selftest_case_t;
+
+static const selftest_case_t selftest_cases[] = {
+    { "sha256_kat", test_sha256_kat },
+    { "hash_many", test_hash_many },
+    { "hmac_kat", test_hmac_kat },
+    { "hmac_session", test_hmac_session },
+    { "aes_kat", test_aes_kat },
+    { "aes_cbc_session", test_aes_cbc_session },
+    { "aes_decrypt_block", test_aes_decrypt_block },
+#ifdef MSG_CTR
+    { "aes_ctr_session", test_aes_ctr_session },
+#endif
+#ifdef AES_CT
+    { "aes_ct", test_aes_ct },
+#endif
+#ifdef AES_TT
+    { "aes_tt", test_aes_tt },
+#endif
+#ifdef WOLFSSL_MAX78000_AES
+    { "aes_engine", test_aes_engine },
+#endif
+#ifdef MSG_AEAD_ASCON
+    { "ascon", test_ascon },
+#endif
+};
+
+/**
+ * @brief Runs every test of this build and reports each.
+ *
+ * Each line holds the test name, pass or FAIL and the cycles the test took
+ * on the DWT counter, reference computations included.
+ *
+ * @param print Prints one line of the report.
+ * @return Number of tests that failed.
+ */
+int selftest_run(selftest_print_t print)
+{
+    char line[80];
+    int failed = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (size_t i = 0; i < SELFTEST_BUF_LEN; i++) {
+        test_in[i] = (uint8_t) (i * 7 + 3);
+    }
+
+    for (size_t i = 0; i < sizeof(selftest_cases) / sizeof(selftest_cases[0]); i++) {
+        uint32_t start = DWT->CYCCNT;
+        int ok = selftest_cases[i].run() == 0;
+        uint32_t cycles = DWT->CYCCNT - start;
+        uint32_t us = (uint64_t) cycles * 1000000 / SystemCoreClock;
+
+#ifdef TINY_PRINTF
+        tiny_snprintf(line, sizeof(line), "T %s %s cycles=%lu us=%lu", selftest_cases[i].name,
+                      ok ? "pass" : "FAIL", (unsigned long) cycles, (unsigned long) us);
+#else
+        snprintf(line, sizeof(line), "T %s %s cycles=%lu us=%lu", selftest_cases[i].name,
+                 ok ? "pass" : "FAIL", (unsigned long) cycles, (unsigned long) us);
+#endif
+        print(ok, line);
+        failed += !ok;
+    }
+
+    memset(test_ref, 0, sizeof(test_ref));
+    memset(test_out, 0, sizeof(test_out));
+    return failed;
+}
+
+#endif
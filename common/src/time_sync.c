@@ -0,0 +1,162 @@
+/**
+ * @file time_sync.c
+ * @brief Shared time base between the AP and the components
+ * @date 2024
+ *
+ * See time_sync.h for the exchange. Only the clock and the arithmetic live
+ * here, the frames are sent and answered by the AP's time_sync and the
+ * component's channel receive.
+ */
+
+#include "time_sync.h"
+
+#ifdef MSG_TIMESYNC
+
+#include "mxc_device.h"
+#include "nvic_table.h"
+#include "tmr.h"
+#include "irq_events.h"
+
+#ifndef TIME_TIMER
+#define TIME_TIMER MXC_TMR3
+#endif
+// The timer counts from 1 up to its compare value, then starts over
+#define TIME_TIMER_PERIOD 0xFFFFFFFFu
+// 7.3728 MHz = 4608 ticks every 625 us
+#define TIME_TICKS 4608u
+#define TIME_TICKS_US 625u
+
+// Rollovers of the timer since time_init, about one every ten minutes
+static volatile uint32_t time_wraps;
+
+// Component: the last SET, and how fast the offset moves per local microsecond
+static struct {
+    uint64_t at;
+    int64_t offset;
+    int32_t drift_ppb;
+    int ready;
+} sync;
+
+/**
+ * @brief ISR for the rollover of the clock timer
+ */
+static void time_timer_isr(void)
+{
+    MXC_TMR_ClearFlags(TIME_TIMER);
+    time_wraps++;
+}
+
+/**
+ * @brief Starts the clock timer in continuous mode with its rollover interrupt.
+ */
+void time_init(void)
+{
+    mxc_tmr_cfg_t cfg;
+    cfg.pres = TMR_PRES_1;
+    cfg.mode = TMR_MODE_CONTINUOUS;
+    cfg.bitMode = MXC_TMR_BIT_32;
+    cfg.clock = MXC_TMR_8M_CLK;
+    cfg.cmp_cnt = TIME_TIMER_PERIOD;
+    cfg.pol = 0;
+
+    time_wraps = 0;
+    MXC_NVIC_SetVector(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(TIME_TIMER)), time_timer_isr);
+    NVIC_SetPriority(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(TIME_TIMER)), IRQ_PRIO_TIME);
+    NVIC_EnableIRQ(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(TIME_TIMER)));
+    MXC_TMR_Shutdown(TIME_TIMER);
+    MXC_TMR_Init(TIME_TIMER, &cfg, false);
+    MXC_TMR_ClearFlags(TIME_TIMER);
+    MXC_TMR_EnableInt(TIME_TIMER);
+    MXC_TMR_Start(TIME_TIMER);
+}
+
+/**
+ * @brief Reads the clock.
+ *
+ * A rollover whose interrupt has not been served yet, because interrupts
+ * are masked or a higher priority one is running, is counted from the flag.
+ *
+ * @return Microseconds since time_init.
+ */
+uint64_t time_local_us(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t count = MXC_TMR_GetCount(TIME_TIMER);
+    uint64_t wraps = time_wraps;
+    if (MXC_TMR_GetFlags(TIME_TIMER) && count < TIME_TIMER_PERIOD / 2) {
+        wraps++;
+    }
+    __set_PRIMASK(primask);
+
+    uint64_t ticks = wraps * TIME_TIMER_PERIOD + count;
+    return ticks / TIME_TICKS * TIME_TICKS_US + (ticks % TIME_TICKS) * TIME_TICKS_US / TIME_TICKS;
+}
+
+/**
+ * @brief Reads the clock in AP time.
+ *
+ * @return The local clock moved by the last SET's offset and the drift
+ * since, the local clock itself on the AP or before any SET.
+ */
+uint64_t time_sync_now(void)
+{
+    uint64_t local = time_local_us();
+    if (!sync.ready) {
+        return local;
+    }
+    int64_t elapsed = (int64_t) (local - sync.at);
+    return local + sync.offset + elapsed * sync.drift_ppb / 1000000000;
+}
+
+/**
+ * @brief Tells whether the component's clock follows the AP's.
+ *
+ * @return Nonzero once a SET was taken.
+ */
+int time_sync_ready(void)
+{
+    return sync.ready;
+}
+
+/**
+ * @brief Takes the offset the AP measured.
+ *
+ * A SET far enough after the last one also gives the drift, the change in
+ * offset over the local time between them. One that would put it beyond
+ * what the oscillator can do keeps the old drift.
+ *
+ * @param ap_minus_local AP time minus local time.
+ * @param at Local time it was measured at.
+ */
+void time_sync_apply(int64_t ap_minus_local, uint64_t at)
+{
+    if (sync.ready && at > sync.at && at - sync.at >= TIME_SYNC_MIN_SPAN_US) {
+        int64_t drift = (ap_minus_local - sync.offset) * 1000000000 / (int64_t) (at - sync.at);
+        if (drift >= -TIME_SYNC_MAX_DRIFT_PPB && drift <= TIME_SYNC_MAX_DRIFT_PPB) {
+            sync.drift_ppb = (int32_t) drift;
+        }
+    }
+    sync.at = at;
+    sync.offset = ap_minus_local;
+    sync.ready = 1;
+}
+
+/**
+ * @brief Works out one exchange.
+ *
+ * @param t1 AP time the PING went out.
+ * @param t2 Component time it came in.
+ * @param t3 Component time the PONG went out.
+ * @param t4 AP time it came in.
+ * @param rtt Set to the round trip without the component's turnaround.
+ *
+ * @return How far the component's clock is ahead of the AP's.
+ */
+int64_t time_sync_offset(uint64_t t1, uint64_t t2, uint64_t t3, uint64_t t4, uint64_t *rtt)
+{
+    *rtt = (t4 - t1) - (t3 - t2);
+    return ((int64_t) (t2 - t1) + (int64_t) (t3 - t4)) / 2;
+}
+
+#endif
@@ -0,0 +1,338 @@
+#include "tiny_printf.h"
+
+#ifdef TINY_PRINTF
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Where formatted output goes, either a bounded buffer or the UART
+typedef struct tiny_out_t {
+    char *buf;
+    size_t size;
+    size_t pos;
+    // Flushes buf once it is full, NULL to drop what does not fit
+    void (*flush)(struct tiny_out_t *out);
+    int total;
+} tiny_out_t;
+
+// Console write of the MSDK's newlib syscalls
+int _write(int file, char *ptr, int len);
+
+/**
+ * @brief Appends one character.
+ *
+ * @param out Output to append to.
+ * @param c Character.
+ */
+static void tiny_put(tiny_out_t *out, char c)
+{
+    if (out->pos == out->size && out->flush != NULL) {
+        out->flush(out);
+    }
+    if (out->pos < out->size) {
+        out->buf[out->pos++] = c;
+    }
+    out->total++;
+}
+
+/**
+ * @brief Appends a character n times.
+ *
+ * @param out Output to append to.
+ * @param c Character.
+ * @param n Number of times, nothing if not positive.
+ */
+static void tiny_pad(tiny_out_t *out, char c, int n)
+{
+    while (n-- > 0) {
+        tiny_put(out, c);
+    }
+}
+
+/**
+ * @brief Appends one conversion.
+ *
+ * @param out Output to append to.
+ * @param body Digits or text of the conversion.
+ * @param len Length of body.
+ * @param sign Sign to put in front, 0 for none.
+ * @param lead Zeros in front of body, the digits a precision asks for.
+ * @param width Field width.
+ * @param left Pad on the right instead of the left.
+ * @param zero Pad with zeros, between the sign and the digits.
+ */
+static void tiny_field(tiny_out_t *out, const char *body, int len, char sign,
+                       int lead, int width, int left, int zero)
+{
+    int pad = width - len - (sign != 0) - lead;
+    if (!left && !zero) {
+        tiny_pad(out, ' ', pad);
+    }
+    if (sign != 0) {
+        tiny_put(out, sign);
+    }
+    if (!left && zero) {
+        tiny_pad(out, '0', pad);
+    }
+    tiny_pad(out, '0', lead);
+    for (int i = 0; i < len; i++) {
+        tiny_put(out, body[i]);
+    }
+    if (left) {
+        tiny_pad(out, ' ', pad);
+    }
+}
+
+/**
+ * @brief Formats fmt into out.
+ *
+ * Integers are converted with 32 bit arithmetic unless ll asks for 64, so
+ * no 64 bit division is pulled in for the common case. hh and h cut the
+ * argument down to char and short, as the caller's promotion widened it.
+ *
+ * @param out Output to append to.
+ * @param fmt Format string.
+ * @param ap Arguments.
+ */
+static void tiny_format(tiny_out_t *out, const char *fmt, va_list ap)
+{
+    static const char lower[] = "0123456789abcdef";
+    static const char upper[] = "0123456789ABCDEF";
+
+    for (; *fmt != '\0'; fmt++) {
+        if (*fmt != '%') {
+            tiny_put(out, *fmt);
+            continue;
+        }
+        fmt++;
+
+        int left = 0;
+        int zero = 0;
+        for (;; fmt++) {
+            if (*fmt == '-') {
+                left = 1;
+            } else if (*fmt == '0') {
+                zero = 1;
+            } else {
+                break;
+            }
+        }
+
+        int width = 0;
+        if (*fmt == '*') {
+            width = va_arg(ap, int);
+            if (width < 0) {
+                left = 1;
+                width = -width;
+            }
+            fmt++;
+        } else {
+            while (*fmt >= '0' && *fmt <= '9') {
+                width = width * 10 + (*fmt++ - '0');
+            }
+        }
+
+        int precision = -1;
+        if (*fmt == '.') {
+            fmt++;
+            precision = 0;
+            if (*fmt == '*') {
+                precision = va_arg(ap, int);
+                fmt++;
+            } else {
+                while (*fmt >= '0' && *fmt <= '9') {
+                    precision = precision * 10 + (*fmt++ - '0');
+                }
+            }
+        }
+
+        // Bits of the argument: 8 for hh, 16 for h, 64 for ll, l and z are
+        // the same as none on this target
+        int bits = 32;
+        if (fmt[0] == 'h' && fmt[1] == 'h') {
+            bits = 8;
+            fmt += 2;
+        } else if (fmt[0] == 'h') {
+            bits = 16;
+            fmt++;
+        } else if (fmt[0] == 'l' && fmt[1] == 'l') {
+            bits = 64;
+            fmt += 2;
+        } else if (fmt[0] == 'l' || fmt[0] == 'z') {
+            fmt++;
+        }
+
+        char digits[24];
+        int len = 0;
+        char sign = 0;
+        switch (*fmt) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'p': {
+            unsigned base = (*fmt == 'd' || *fmt == 'i' || *fmt == 'u') ? 10 : 16;
+            const char *set = (*fmt == 'X') ? upper : lower;
+            if (bits == 64) {
+                uint64_t v;
+                if (*fmt == 'd' || *fmt == 'i') {
+                    int64_t s = va_arg(ap, long long);
+                    sign = (s < 0) ? '-' : 0;
+                    v = (s < 0) ? -(uint64_t) s : (uint64_t) s;
+                } else {
+                    v = va_arg(ap, unsigned long long);
+                }
+                do {
+                    digits[len++] = set[v % base];
+                    v /= base;
+                } while (v != 0);
+            } else {
+                uint32_t v;
+                if (*fmt == 'd' || *fmt == 'i') {
+                    int32_t s = va_arg(ap, int);
+                    if (bits == 8) {
+                        s = (int8_t) s;
+                    } else if (bits == 16) {
+                        s = (int16_t) s;
+                    }
+                    sign = (s < 0) ? '-' : 0;
+                    v = (s < 0) ? -(uint32_t) s : (uint32_t) s;
+                } else if (*fmt == 'p') {
+                    v = (uint32_t) (uintptr_t) va_arg(ap, void *);
+                    zero = 1;
+                    width = 8;
+                    tiny_put(out, '0');
+                    tiny_put(out, 'x');
+                } else {
+                    v = va_arg(ap, unsigned int);
+                    if (bits == 8) {
+                        v = (uint8_t) v;
+                    } else if (bits == 16) {
+                        v = (uint16_t) v;
+                    }
+                }
+                do {
+                    digits[len++] = set[v % base];
+                    v /= base;
+                } while (v != 0);
+            }
+            // Digits came out least significant first
+            for (int i = 0; i < len / 2; i++) {
+                char t = digits[i];
+                digits[i] = digits[len - 1 - i];
+                digits[len - 1 - i] = t;
+            }
+            // A precision is the least number of digits, a zero value with
+            // precision 0 has none, and the 0 flag no longer applies
+            int lead = 0;
+            if (precision >= 0) {
+                if (precision == 0 && len == 1 && digits[0] == '0') {
+                    len = 0;
+                }
+                lead = precision - len;
+                zero = 0;
+            }
+            tiny_field(out, digits, len, sign, lead, width, left, zero);
+            break;
+        }
+        case 'c':
+            digits[0] = (char) va_arg(ap, int);
+            tiny_field(out, digits, 1, 0, 0, width, left, 0);
+            break;
+        case 's': {
+            const char *s = va_arg(ap, const char *);
+            if (s == NULL) {
+                s = "(null)";
+            }
+            while ((precision < 0 || len < precision) && s[len] != '\0') {
+                len++;
+            }
+            tiny_field(out, s, len, 0, 0, width, left, 0);
+            break;
+        }
+        case '%':
+            tiny_put(out, '%');
+            break;
+        case '\0':
+            return;
+        default:
+            // Not supported, printed as it stands
+            tiny_put(out, '%');
+            tiny_put(out, *fmt);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Formats into a buffer.
+ *
+ * @param buf Buffer to format into.
+ * @param size Size of buf, the output is always NUL terminated if not 0.
+ * @param fmt Format string.
+ * @param ap Arguments.
+ * @return Length of the whole output, even the part that did not fit.
+ */
+int tiny_vsnprintf(char *buf, size_t size, const char *fmt, va_list ap)
+{
+    tiny_out_t out = { buf, (size > 0) ? size - 1 : 0, 0, NULL, 0 };
+    tiny_format(&out, fmt, ap);
+    if (size > 0) {
+        buf[out.pos] = '\0';
+    }
+    return out.total;
+}
+
+/**
+ * @brief Formats into a buffer, arguments inline.
+ *
+ * @param buf Buffer to format into.
+ * @param size Size of buf.
+ * @param fmt Format string.
+ * @return Length of the whole output.
+ */
+int tiny_snprintf(char *buf, size_t size, const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    int len = tiny_vsnprintf(buf, size, fmt, ap);
+    va_end(ap);
+    return len;
+}
+
+/**
+ * @brief Writes a full printf chunk to the console and starts over.
+ *
+ * @param out Output of printf.
+ */
+static void tiny_flush_uart(tiny_out_t *out)
+{
+    if (out->pos > 0) {
+        _write(1, out->buf, (int) out->pos);
+    }
+    out->pos = 0;
+}
+
+/**
+ * @brief printf without newlib's formatter.
+ *
+ * Output goes to the console straight through the syscall, stdout's
+ * buffering is bypassed, so fflush(stdout) has nothing left to do.
+ *
+ * @param fmt Format string.
+ * @return Number of characters printed.
+ */
+int printf(const char *fmt, ...)
+{
+    char chunk[TINY_PRINTF_CHUNK];
+    tiny_out_t out = { chunk, sizeof(chunk), 0, tiny_flush_uart, 0 };
+    va_list ap;
+    va_start(ap, fmt);
+    tiny_format(&out, fmt, ap);
+    va_end(ap);
+    tiny_flush_uart(&out);
+    return out.total;
+}
+
+#endif
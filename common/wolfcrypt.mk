@@ -0,0 +1,55 @@
+# Builds the wolfCrypt modules the firmware uses into one static archive.
+#
+# Called by the application_processor and component Makefiles, which pass the
+# compiler, the flags and a BUILD_DIR keyed by those flags, so every AP and
+# component image built from this tree with the same configuration links the
+# same archive instead of compiling wolfCrypt again.
+#
+#   make -f wolfcrypt.mk BUILD_DIR=... CC=... AR=... OBJCOPY=... CFLAGS="..."
+
+COMMON_DIR := $(patsubst %/,%,$(dir $(lastword $(MAKEFILE_LIST))))
+WOLFCRYPT_SRC_DIR = $(COMMON_DIR)/wolfssl/wolfcrypt/src
+
+WOLFCRYPT_SRCS = aes.c cmac.c sha256.c hmac.c hash.c random.c cryptocb.c
+WOLFCRYPT_SRCS += wc_port.c memory.c logging.c error.c
+
+# P-256 for COMPONENT_ENROLL, on sp_cortexm.c's assembly
+ifneq ($(filter -DHAVE_ECC,$(CFLAGS)),)
+WOLFCRYPT_SRCS += ecc.c sp_int.c sp_cortexm.c wolfmath.c
+endif
+
+# wolfCrypt's hot transforms, moved into .fastcode when built with
+# SRAM_FASTCODE (see fastcode.h). Relies on -ffunction-sections; objects
+# without one of these sections are left as they are
+FASTCODE_FUNCS = wc_AesEncrypt wc_AesDecrypt wc_AesCbcEncrypt wc_AesCbcDecrypt Transform_Sha256
+FASTCODE_FUNCS += GHASH GMULT
+
+WOLFCRYPT_OBJS = $(addprefix $(BUILD_DIR)/,$(WOLFCRYPT_SRCS:.c=.o))
+WOLFCRYPT_INC = -I$(COMMON_DIR)/inc -I$(COMMON_DIR)/wolfssl
+
+ifeq "$(BUILD_DIR)" ""
+$(error BUILD_DIR must be set)
+endif
+
+.PHONY: lib clean
+
+lib: $(BUILD_DIR)/libwolfcrypt.a
+
+# Written under a temporary name so an interrupted build never leaves a
+# half written archive behind for the next image to link
+$(BUILD_DIR)/libwolfcrypt.a: $(WOLFCRYPT_OBJS)
+	@rm -f $@.tmp
+	$(AR) rcs $@.tmp $^
+	@mv $@.tmp $@
+
+$(BUILD_DIR)/%.o: $(WOLFCRYPT_SRC_DIR)/%.c
+	@mkdir -p $(@D)
+	$(CC) $(CFLAGS) $(WOLFCRYPT_INC) -MMD -MP -c $< -o $@
+ifneq ($(filter -DSRAM_FASTCODE,$(CFLAGS)),)
+	$(OBJCOPY) $(foreach f,$(FASTCODE_FUNCS),--rename-section .text.$(f)=.fastcode.$(f)) $@
+endif
+
+clean:
+	rm -rf $(BUILD_DIR)
+
+-include $(WOLFCRYPT_OBJS:.o=.d)
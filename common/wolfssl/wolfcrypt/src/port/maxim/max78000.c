@@ -0,0 +1,225 @@
+/* max78000.c
+ *
+ * Copyright (C) 2006-2023 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+/* MAX78000 AES engine support through the wolfCrypt crypto callback
+ * interface. The engine only implements single-block ECB, so CBC chaining
+ * is done here around one hardware block operation at a time. */
+
+#ifdef HAVE_CONFIG_H
+    #include <config.h>
+#endif
+
+#include <wolfssl/wolfcrypt/settings.h>
+
+#if defined(WOLFSSL_MAX78000_AES)
+
+#include <wolfssl/wolfcrypt/port/maxim/max78000.h>
+
+#ifdef NO_INLINE
+    #include <wolfssl/wolfcrypt/misc.h>
+#else
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+#endif
+
+#include <stdint.h>
+#include <wolfssl/wolfcrypt/aes.h>
+#include <wolfssl/wolfcrypt/cryptocb.h>
+#include <wolfssl/wolfcrypt/error-crypt.h>
+#include <wolfssl/wolfcrypt/logging.h>
+
+/* MSDK AES driver */
+#include "aes.h"
+
+#define MAX78000_AES_BLOCK_WORDS (AES_BLOCK_SIZE / sizeof(uint32_t))
+
+static int max78000_registered = 0;
+
+/* Runs one 16-byte block through the engine. The TRNG and AES engine share a
+ * clock gate on this part, so the engine is re-initialized and the key is
+ * reloaded before every operation in case rng code powered it down. */
+static int max78000_aes_block(const Aes* aes, const byte* in, byte* out,
+                              int enc)
+{
+    uint32_t inWords[MAX78000_AES_BLOCK_WORDS];
+    uint32_t outWords[MAX78000_AES_BLOCK_WORDS];
+    mxc_aes_req_t req;
+    int ret;
+
+    XMEMCPY(inWords, in, AES_BLOCK_SIZE);
+
+    if (MXC_AES_Init() != E_NO_ERROR) {
+        return WC_HW_E;
+    }
+    MXC_AES_SetExtKey(aes->devKey, MXC_AES_128BITS);
+
+    req.length = MAX78000_AES_BLOCK_WORDS;
+    req.inputData = inWords;
+    req.resultData = outWords;
+    req.keySize = MXC_AES_128BITS;
+    req.encryption = enc ? MXC_AES_ENCRYPT_EXT_KEY : MXC_AES_DECRYPT_EXT_KEY;
+    req.callback = NULL;
+
+    ret = enc ? MXC_AES_Encrypt(&req) : MXC_AES_Decrypt(&req);
+    if (ret != E_NO_ERROR) {
+        ForceZero(outWords, sizeof(outWords));
+        return WC_HW_E;
+    }
+
+    XMEMCPY(out, outWords, AES_BLOCK_SIZE);
+    ForceZero(inWords, sizeof(inWords));
+    ForceZero(outWords, sizeof(outWords));
+    return 0;
+}
+
+static int max78000_aes_cbc(Aes* aes, byte* out, const byte* in, word32 sz,
+                            int enc)
+{
+    byte block[AES_BLOCK_SIZE];
+    byte prev[AES_BLOCK_SIZE];
+    word32 i;
+    int ret = 0;
+
+    if (aes == NULL || out == NULL || in == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    /* Engine is only wired up for the 128-bit key this firmware uses */
+    if (aes->keylen != 16) {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+    if (sz % AES_BLOCK_SIZE != 0) {
+        return BAD_FUNC_ARG;
+    }
+
+    for (i = 0; i < sz && ret == 0; i += AES_BLOCK_SIZE) {
+        if (enc) {
+            xorbufout(block, in + i, aes->reg, AES_BLOCK_SIZE);
+            ret = max78000_aes_block(aes, block, out + i, 1);
+            if (ret == 0) {
+                XMEMCPY(aes->reg, out + i, AES_BLOCK_SIZE);
+            }
+        }
+        else {
+            /* Save the ciphertext first so in-place decryption works */
+            XMEMCPY(prev, in + i, AES_BLOCK_SIZE);
+            ret = max78000_aes_block(aes, prev, block, 0);
+            if (ret == 0) {
+                xorbufout(out + i, block, aes->reg, AES_BLOCK_SIZE);
+                XMEMCPY(aes->reg, prev, AES_BLOCK_SIZE);
+            }
+        }
+    }
+
+    ForceZero(block, sizeof(block));
+    ForceZero(prev, sizeof(prev));
+    return ret;
+}
+
+int wc_MAX78000_CryptoCb(int devId, wc_CryptoInfo* info, void* ctx)
+{
+    (void)devId;
+    (void)ctx;
+
+    if (info == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+#ifdef HAVE_AES_CBC
+    if (info->algo_type == WC_ALGO_TYPE_CIPHER &&
+            info->cipher.type == WC_CIPHER_AES_CBC) {
+        return max78000_aes_cbc(info->cipher.aescbc.aes,
+                                info->cipher.aescbc.out,
+                                info->cipher.aescbc.in,
+                                info->cipher.aescbc.sz,
+                                info->cipher.enc);
+    }
+#endif
+
+    return CRYPTOCB_UNAVAILABLE;
+}
+
+/* FIPS-197 Appendix C.1 AES-128 known answer */
+static const byte max78000_kat_key[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const byte max78000_kat_pt[16] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+static const byte max78000_kat_ct[16] = {
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+};
+
+int wc_MAX78000_Init(void)
+{
+    Aes aes;
+    byte out[AES_BLOCK_SIZE];
+    int ret;
+
+    if (max78000_registered) {
+        return 0;
+    }
+
+    /* Only the raw key in devKey is needed by the engine */
+    XMEMSET(&aes, 0, sizeof(aes));
+    XMEMCPY(aes.devKey, max78000_kat_key, sizeof(max78000_kat_key));
+    aes.keylen = sizeof(max78000_kat_key);
+
+    /* Refuse to register if the engine does not reproduce FIPS-197, so a
+     * byte-order or clocking problem leaves us on the software path */
+    ret = max78000_aes_block(&aes, max78000_kat_pt, out, 1);
+    if (ret == 0 && ConstantCompare(out, max78000_kat_ct, AES_BLOCK_SIZE) != 0) {
+        ret = WC_HW_E;
+    }
+    if (ret == 0) {
+        ret = max78000_aes_block(&aes, max78000_kat_ct, out, 0);
+    }
+    if (ret == 0 && ConstantCompare(out, max78000_kat_pt, AES_BLOCK_SIZE) != 0) {
+        ret = WC_HW_E;
+    }
+    if (ret == 0) {
+        ret = wc_CryptoCb_RegisterDevice(WOLFSSL_MAX78000_DEVID,
+                                         wc_MAX78000_CryptoCb, NULL);
+    }
+    if (ret == 0) {
+        max78000_registered = 1;
+    }
+    else {
+        WOLFSSL_MSG("MAX78000 AES engine unavailable, using software AES");
+        MXC_AES_Shutdown();
+    }
+
+    ForceZero(&aes, sizeof(aes));
+    return ret;
+}
+
+void wc_MAX78000_Cleanup(void)
+{
+    if (max78000_registered) {
+        wc_CryptoCb_UnRegisterDevice(WOLFSSL_MAX78000_DEVID);
+        max78000_registered = 0;
+    }
+    MXC_AES_Shutdown();
+}
+
+#endif /* WOLFSSL_MAX78000_AES */
@@ -0,0 +1,54 @@
+/* max78000.h
+ *
+ * Copyright (C) 2006-2023 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+#ifndef _WOLFPORT_MAX78000_H_
+#define _WOLFPORT_MAX78000_H_
+
+#if defined(WOLFSSL_MAX78000_AES)
+
+#include <wolfssl/wolfcrypt/types.h>
+
+#ifndef WOLF_CRYPTO_CB
+    #error WOLFSSL_MAX78000_AES requires WOLF_CRYPTO_CB
+#endif
+
+/* Device ID the MAX78000 AES engine is registered under with cryptocb.c */
+#ifndef WOLFSSL_MAX78000_DEVID
+    #define WOLFSSL_MAX78000_DEVID 0x78000
+#endif
+
+typedef struct wc_CryptoInfo wc_CryptoInfo;
+
+/* Powers up the AES engine, runs a known-answer check against the software
+ * implementation and registers the crypto callback on success. Returns 0 if
+ * the hardware path is usable, otherwise callers should keep INVALID_DEVID. */
+WOLFSSL_API int wc_MAX78000_Init(void);
+
+/* Unregisters the crypto callback and powers down the AES engine */
+WOLFSSL_API void wc_MAX78000_Cleanup(void);
+
+/* Crypto callback. Handles AES-CBC with 128-bit keys, everything else
+ * (including SHA-256, which the MAX78000 has no engine for) returns
+ * CRYPTOCB_UNAVAILABLE so wolfCrypt falls back to software. */
+WOLFSSL_API int wc_MAX78000_CryptoCb(int devId, wc_CryptoInfo* info, void* ctx);
+
+#endif /* WOLFSSL_MAX78000_AES */
+#endif /* _WOLFPORT_MAX78000_H_ */
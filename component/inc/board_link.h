@@ -16,12 +16,78 @@
 
 #include "simple_i2c_peripheral.h"
 
+#ifdef BOARD_LINK_READY_GPIO
+#include "gpio.h"
+#endif
+
+#ifdef LINK_SPI
+#include "simple_spi_peripheral.h"
+#if defined(STREAM_DECRYPT)
+#error "LINK_SPI packets do not arrive through the I2C banks STREAM_DECRYPT works on"
+#endif
+#endif
+
+// The timer ends waits after BOARD_LINK_TIMEOUT_MS, and receive waits after
+// whatever board_link_set_recv_timeout last set (see COMP_SESSION_TIMEOUT_MS)
+#if BOARD_LINK_TIMEOUT_MS || COMP_SESSION_TIMEOUT_MS
+#define BOARD_LINK_TIMED 1
+#include "tmr.h"
+#else
+#define BOARD_LINK_TIMED 0
+#endif
+
 /******************************** MACRO DEFINITIONS ********************************/
 // Last byte of the component ID is the I2C address
 #define COMPONENT_ADDR_MASK 0x000000FF             
 #define SUCCESS_RETURN 0
 #define ERROR_RETURN -1
 
+// Optional shared "data ready" line to the AP (BOARD_LINK_READY_GPIO=1 in
+// project.mk, must match the AP). Pulled low while a packet is waiting to be
+// read and released otherwise, so several components can share it.
+#ifndef READY_GPIO_PORT
+#define READY_GPIO_PORT MXC_GPIO1
+#endif
+#ifndef READY_GPIO_PIN
+#define READY_GPIO_PIN MXC_GPIO_PIN_6
+#endif
+
+// While waiting for the AP the core sleeps until an interrupt, the I2C STOP
+// interrupt updates the bank state waited on. With BOARD_LINK_TIMEOUT_MS set in project.mk a
+// low-power timer ends a wait after that long, 0 waits forever.
+#ifndef BOARD_LINK_TIMEOUT_MS
+#define BOARD_LINK_TIMEOUT_MS 0
+#endif
+#ifndef BOARD_LINK_TIMER
+#define BOARD_LINK_TIMER MXC_TMR4 // Low-power timer, keeps running while the core sleeps
+#endif
+// Nominal rate of the internal 8 kHz oscillator the timer runs from
+#define BOARD_LINK_TIMER_HZ 8000
+
+// One bounded piece of background work, run while waiting for the AP before
+// the core goes to sleep. Returns nonzero while there is more to do.
+typedef int (*board_link_idle_t)(void);
+
+#ifdef ADDR_ASSIGN
+// Takes an address assignment of len bytes the AP broadcast while a receive
+// was waiting, see board_link_set_assign
+typedef void (*board_link_assign_t)(const uint8_t* assign, int len);
+#endif
+
+// Link backend under send_packet_and_ack and wait_and_receive_packet. Packets
+// are taken from whichever backend has one, and answers go back over the one
+// the last packet came from, so the AP alone decides which link is used.
+// LINK_SPI=1 in project.mk adds SPI next to I2C
+typedef struct link_backend_t {
+    bool (*tx_free)(void);      // Another packet can be published
+    bool (*tx_idle)(void);      // The AP has read every published packet
+    void (*tx_publish)(uint8_t len, uint8_t* packet);
+    void (*tx_withdraw)(void);  // Take back the last one unread
+    bool (*rx_ready)(void);
+    uint8_t (*rx_take)(uint8_t* packet);
+    void (*rx_release)(void);   // See release_receive_packet
+} link_backend_t;
+
 /******************************** FUNCTION PROTOTYPES ********************************/
 
 /**
@@ -35,6 +101,16 @@
 */
 int board_link_init(i2c_addr_t addr);
 
+#ifdef COMP_READY
+/**
+ * @brief Tell the AP we finished starting up
+ *
+ * Until then our CAPABILITY register reads I2C_CAP_STARTING, which the AP
+ * waits on before it talks to us
+*/
+void board_link_ready(void);
+#endif
+
 /**
  * @brief Convert 4-byte component ID to I2C address
  * 
@@ -49,21 +125,113 @@ i2c_addr_t component_id_to_i2c_addr(uint32_t component_id);
  * 
  * @param message: uint8_t*, message to be sent
  * 
+ * @return int: SUCCESS_RETURN once the AP has read it, ERROR_RETURN if
+ * BOARD_LINK_TIMEOUT_MS passed first
+ *
  * This function utilizes the simple_i2c_peripheral library to
  * send a packet to the AP and wait for the message to be received
 */
-void send_packet_and_ack(uint8_t len, uint8_t* packet);
+int send_packet_and_ack(uint8_t len, uint8_t* packet);
+
+#ifdef MSG_PUBSUB
+/**
+ * @brief Hand a packet to the AP without waiting for it to be read
+ * 
+ * @param len: uint8_t, length of the packet
+ * @param packet: uint8_t*, packet to be sent
+ * 
+ * @return int: SUCCESS_RETURN once it is published, ERROR_RETURN if both
+ * TRANSMIT banks still hold unread packets
+*/
+int send_packet_queued(uint8_t len, uint8_t* packet);
+
+/**
+ * @brief Wait until send_packet_queued can take another packet
+ * 
+ * @return int: SUCCESS_RETURN once a bank is free, ERROR_RETURN if
+ * BOARD_LINK_TIMEOUT_MS passed first
+*/
+int send_queue_wait_free(void);
+
+/**
+ * @brief Check whether the AP has read every queued packet
+ * 
+ * @return bool: true once both TRANSMIT banks are read, the ready line is
+ * released then
+*/
+bool send_queue_idle(void);
+#endif
 
 /**
  * @brief Wait for a new message from AP and process the message
  * 
  * @param packet: uint8_t*, message received
  * 
- * @return uint8_t: length of message received
+ * @return uint8_t: length of message received, 0 if BOARD_LINK_TIMEOUT_MS passed first
  *
  * This function waits for a new message to be available from the AP,
  * once the message is available it is returned in the buffer pointer to by packet 
 */
 uint8_t wait_and_receive_packet(uint8_t* packet);
 
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Wait for the AP's boot release
+ * 
+ * @param release: uint8_t*, buffer of I2C_RELEASE_LEN bytes
+ * 
+ * @return uint8_t: length of the release, 0 if a packet arrived first or the
+ * receive timeout passed
+ * 
+ * Waits as long as wait_and_receive_packet would. A packet is left for
+ * wait_and_receive_packet, it means the AP has moved on
+*/
+uint8_t wait_and_receive_release(uint8_t* release);
+#endif
+
+/**
+ * @brief Limit how long wait_and_receive_packet waits
+ * 
+ * @param timeout_ms: uint32_t, milliseconds, 0 for BOARD_LINK_TIMEOUT_MS
+ * 
+ * Only has an effect in builds with the timer, see BOARD_LINK_TIMED
+*/
+void board_link_set_recv_timeout(uint32_t timeout_ms);
+
+/**
+ * @brief Set the background work waits run before sleeping
+ * 
+ * @param idle: board_link_idle_t, called until it returns 0 or the wait is
+ *     over, NULL for none
+*/
+void board_link_set_idle(board_link_idle_t idle);
+
+#ifdef ADDR_ASSIGN
+/**
+ * @brief Set the handler of address assignments
+ * 
+ * @param assign: board_link_assign_t, called from wait_and_receive_packet
+ *     with every assignment written while it waits, NULL to drop them
+ * 
+ * The wait goes on afterwards, an assignment only moves the component to
+ * another address
+*/
+void board_link_set_assign(board_link_assign_t assign);
+#endif
+
+/**
+ * @brief Check why the last wait_and_receive_packet returned nothing
+ * 
+ * @return bool: true if it ran out of time, false if a packet arrived
+*/
+bool board_link_recv_timed_out(void);
+
+/**
+ * @brief Tell the AP the last packet has been taken
+ * 
+ * Called by wait_and_receive_packet, except with STREAM_DECRYPT where the
+ * messaging layer calls it once the streamed blocks have been used
+*/
+void release_receive_packet(void);
+
 #endif
@@ -2,50 +2,18 @@
 #define COMP_MESSAGING_H
 
 /*
-  Define our messaging struct and routines to send/receive the struct over I2C.
-  Depends on our crypto and TRNG utilities in crypto_util / general_util.h
-  Also utilizes the I2C send/receive functions defined by board_link.h
+  Component end of the messaging engine in msg_core.h. Sends and receives
+  msg_t frames to and from the AP through board_link.h.
 */
 
-#include <stdint.h>
-#include <stdlib.h>
-#include <string.h>
-#include "crypto_util.h"
+#include "msg_core.h"
 
 // Return values -- match success / failure values from reference design
-#define COMP_MESSAGE_ERROR -1
-#define COMP_MESSAGE_SUCCESS 0
-
-#define MAX_CONTENTS_LEN 198
-#define HASH_LEN 32
-#define IV_LEN 16
-// Amount of struct, starting from byte 0, that is encrypted
-// This means we encrypt from rng_chal up through byte 17 of hash
-#define ENC_LEN 224
-
-/* 
-   The total size of this struct must be exactly 255 bytes to fit into one
-   I2C message. Use the pragma pack compiler directive so that the compiler 
-   does not insert padding between fields, which would mess up serialization
-*/
-#pragma pack(push,1)
-typedef struct msg_t {
-    // RNG challenge / response values for cryptographic handshake
-    uint32_t rng_chal;
-    uint32_t rng_resp;
-    // Reusing this field from reference design for simplicity
-    uint8_t opcode;
-    // contents are unencrypted when set by user, encrypted when sent to I2C
-    uint8_t contents[MAX_CONTENTS_LEN];
-    // Hash of rng_chal through contents, partially encrypted
-    uint8_t hash[HASH_LEN];
-    // IV used for encryption, always in plaintext
-    uint8_t iv[IV_LEN];
-} msg_t;
-#pragma pack(pop)
+#define COMP_MESSAGE_ERROR MSG_FAILURE
+#define COMP_MESSAGE_SUCCESS MSG_SUCCESS
 
 // Serialize and send the global transmit msg_t over I2C to the I2C master (AP)
-// User must fill in opcode and contents before calling. This function will handle
+// User must fill in opcode, len and contents before calling. This function will handle
 // encryption, RNG challenge management, and hashing
 void comp_transmit_and_ack();
 
@@ -56,8 +24,90 @@ void comp_transmit_and_ack();
 // value is not checked (need to be able to initiate a chain somehow).
 int comp_wait_recv(int first);
 
-// Zero out the global transmit, receive msg_t structs to get confidential data out of 
-// device memory. Certainly not strictly necessary, but can't hurt.
-void reset_msg();
+// Whether the frame just received is a BOOT answering our last frame, the
+// only frame that may boot a component waiting with its ID sent or on a hold.
+// Anything else answering it, a VALIDATE refreshing a hold, starts over.
+int comp_answers_boot();
+
+// Set up the messaging layer, call once after board_link_init. With
+// STREAM_DECRYPT this hooks frame decryption into the I2C receive ISR, with
+// COMPONENT_KEYS it selects this component's own key for every frame.
+void comp_messaging_init();
+
+#ifdef ENROLL_RESUME
+// Resumption secret kept by component.c in its own flash page, so the ECDH
+// with the AP only runs on the first boot of an image. comp_resume_load
+// copies the secret stored for cert_hash, the hash of our certificate, and
+// returns COMP_MESSAGE_SUCCESS if there is one. comp_resume_save stores it,
+// it needs the device key selected.
+int comp_resume_load(const uint8_t *cert_hash, uint8_t *secret);
+void comp_resume_save(const uint8_t *cert_hash, const uint8_t *secret);
+#endif
+
+#ifdef BOOT_BROADCAST
+// Wait for the AP's boot release after sending the final boot message, see
+// msg_release_tag. Returns success once a release carries our tag, failure if
+// the wait times out or a new frame from the AP arrives first.
+int comp_wait_release();
+#endif
+
+#ifdef MSG_CHANNEL
+// Open the post-boot channel from the conversation that just finished, call
+// right after sending the final boot message. The component only talks to the
+// AP after boot, so the channel key stays loaded from here on.
+void msg_channel_open(msg_channel_t *channel);
+
+// Send the global transmit msg_t as a single channel frame. User must fill in
+// opcode, len and contents before calling.
+int comp_channel_transmit_and_ack(msg_channel_t *channel);
+
+// Receive a single channel frame into the global receive msg_t. Returns success
+// only if it authenticates under the channel key and its sequence number is new.
+int comp_channel_wait_recv(msg_channel_t *channel);
+#endif
+
+#ifdef MSG_PUBSUB
+// Seal the global transmit msg_t as a channel frame into the outbox and hand
+// it on as soon as a TRANSMIT bank is free, without waiting for the AP.
+// Fails without using a sequence number if COMP_OUTBOX_LEN frames are queued.
+int comp_channel_queue(msg_channel_t *channel);
+
+// Move queued frames into free TRANSMIT banks, in order. With wait nonzero
+// keeps waiting for the AP until the outbox is empty or the wait times out.
+// Returns the number of frames still queued. Every other send flushes first.
+int comp_outbox_flush(int wait);
+#endif
+
+#ifdef MSG_STREAM
+// Wait for the AP to open a stream. Uses channel if it is open, otherwise sets up
+// a channel just for the stream. stream->writer tells which way the data flows.
+int comp_stream_accept(msg_stream_t *stream, msg_channel_t *channel);
+
+// Queue len bytes on a stream the AP reads. Full chunks go out right away, the
+// rest waits for more data or comp_stream_close.
+int comp_stream_write(msg_stream_t *stream, const uint8_t *buf, int len);
+
+// Read up to len bytes from a stream the AP writes. Returns the number of bytes
+// read, 0 once the whole stream has been read, failure on error.
+int comp_stream_read(msg_stream_t *stream, uint8_t *buf, int len);
+
+// Flush a written stream with a FIN and wait until the AP has accepted all of it.
+// Wipes the stream state in every case.
+// Errors abort a stream, close it and open a new one to start over.
+int comp_stream_close(msg_stream_t *stream);
+#endif
+
+#ifdef MSG_JUMBO
+#ifdef STREAM_DECRYPT
+#error "MSG_JUMBO packets are not frames of their own, STREAM_DECRYPT cannot decrypt them"
+#endif
+// Send len bytes, up to MSG_JUMBO_MAX_LEN, to the AP as one jumbo frame on
+// channel. Returns once the AP has read every packet of it.
+int comp_jumbo_send(msg_channel_t *channel, const uint8_t *buf, int len);
+
+// Wait for a jumbo frame on channel from the AP. Returns the number of bytes
+// read into buf, or COMP_MESSAGE_ERROR
+int comp_jumbo_recv(msg_channel_t *channel, uint8_t *buf, int maxlen);
+#endif
 
 #endif
@@ -0,0 +1,74 @@
+#ifndef FLASH_LOG_H
+#define FLASH_LOG_H
+
+/*
+Encrypted append-only log in flash for post-boot data (FLASH_LOG=1 in
+project.mk), so a component can keep sensor readings while the AP is busy
+and hand them over in bulk later.
+
+The log takes FLASH_LOG_PAGES pages at the bottom of the RESERVED region of
+firmware.ld. Records are appended back to back, a page at a time and the
+pages in turn, so every page is erased as often as the others and only once
+the log wraps around onto it; the oldest data then makes room. Each record:
+   iv | magic | seq | len | kind | data[len] | pad | hash
+Everything after the iv is encrypted under the device key, the data zero
+padded to a whole CBC block and the hash over the plain header and data.
+Records left half written by a power cut, and everything after them in the
+page, fail the checks and are skipped.
+
+Every record takes the next seq, across pages and resets, so the page
+holding the highest one is the page appended to. flash_log_trim appends a TRIM
+record holding the seq of the first record still wanted, and the newest TRIM
+is copied to the start of every page the log moves on to, so erasing a page
+never forgets what was already handed over.
+
+The corresponding implementations are located in flash_log.c.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef FLASH_LOG
+
+#ifndef FLASH_LOG_PAGES
+#define FLASH_LOG_PAGES 4
+#endif
+#if FLASH_LOG_PAGES < 2
+#error "FLASH_LOG needs FLASH_LOG_PAGES of at least 2, one is erased when the log wraps"
+#endif
+
+// Largest record
+#ifndef FLASH_LOG_MAX_LEN
+#define FLASH_LOG_MAX_LEN 256
+#endif
+
+// Where a reader is in the log, see flash_log_next
+typedef struct flash_log_cursor_t {
+    // Pages walked from the oldest, and offset in the current one
+    uint32_t page;
+    uint32_t offset;
+} flash_log_cursor_t;
+
+// Finds the end of the log and the newest TRIM. Call it once after
+// flash_simple_init and crypto_init
+void flash_log_init(void);
+
+// Appends len bytes as a record. Returns 0 on success,
+// -1 if len is 0 or larger than FLASH_LOG_MAX_LEN or flash failed
+int flash_log_append(const uint8_t *data, size_t len);
+
+// Starts cursor at the oldest record not trimmed yet
+void flash_log_rewind(flash_log_cursor_t *cursor);
+
+// Copies the record at cursor into buf, at least FLASH_LOG_MAX_LEN bytes,
+// stores its seq and moves cursor past it. Records trimmed or failing their
+// check are skipped. Returns its length, 0 at the end of the log
+int flash_log_next(flash_log_cursor_t *cursor, uint8_t *buf, uint32_t *seq);
+
+// Drops every record before seq from what the next flash_log_rewind shows.
+// Returns 0 on success
+int flash_log_trim(uint32_t seq);
+
+#endif
+
+#endif
@@ -26,15 +26,134 @@
 
 /******************************** MACRO DEFINITIONS ********************************/
 #define I2C_FREQ 100000
+// I2C controller the component is wired to (I2C_BUS in project.mk), must
+// match the AP's COMPONENT_BUSES entry for this component
+#ifndef I2C_BUS
+#define I2C_BUS 1
+#endif
+// I2C_INTERFACE and its DMA request lines, used when built with I2C_USE_DMA
+#if I2C_BUS == 0
+#define I2C_INTERFACE MXC_I2C0
+#define I2C_DMA_RX_REQSEL MXC_DMA_REQUEST_I2C0RX
+#define I2C_DMA_TX_REQSEL MXC_DMA_REQUEST_I2C0TX
+#elif I2C_BUS == 2
+#define I2C_INTERFACE MXC_I2C2
+#define I2C_DMA_RX_REQSEL MXC_DMA_REQUEST_I2C2RX
+#define I2C_DMA_TX_REQSEL MXC_DMA_REQUEST_I2C2TX
+#else
 #define I2C_INTERFACE MXC_I2C1
-#define MAX_REG TRANSMIT_LEN
+#define I2C_DMA_RX_REQSEL MXC_DMA_REQUEST_I2C1RX
+#define I2C_DMA_TX_REQSEL MXC_DMA_REQUEST_I2C1TX
+#endif
+#if defined(I2C_CALIBRATE)
+#define MAX_REG CALIBRATE_PATTERN
+#elif defined(ADDR_ASSIGN)
+#define MAX_REG ASSIGN_ADDR
+#elif defined(LINK_STRETCH)
+#define MAX_REG TRANSMIT_WAIT
+#elif defined(BOOT_BROADCAST)
+#define MAX_REG BOOT_RELEASE
+#elif defined(COMPONENT_ENROLL)
+#define MAX_REG ENROLL_CERT
+#elif defined(LINK_CRC)
+#define MAX_REG TRANSMIT_CRC
+#else
+#define MAX_REG TRANSMIT_STATUS
+#endif
+#define I2C_REG_COUNT (MAX_REG + 1)
 #define MAX_I2C_MESSAGE_LEN 256
 
-/******************************** EXTERN DEFINITIONS ********************************/
-// Extern definition to make I2C_REGS and I2C_REGS_LEN 
-// accessible outside of the implementation
-extern volatile uint8_t* I2C_REGS[6];
-extern int I2C_REGS_LEN[6];
+// CAPABILITY register layout, must match simple_i2c_controller.h
+#define I2C_CAP_MAGIC 0xA0
+#define I2C_CAP_FAST 0x01
+#define I2C_CAP_FAST_PLUS 0x02
+#define I2C_CAP_COMPOUND 0x04
+#define I2C_CAP_STRETCH 0x08
+// CAPABILITY until i2c_simple_set_ready with COMP_READY
+#define I2C_CAP_STARTING 0x50
+// Bus rates and register formats advertised to the AP, can be lowered from project.mk
+#ifndef I2C_CAPABILITIES
+#ifdef LINK_STRETCH
+#define I2C_CAPABILITIES (I2C_CAP_FAST | I2C_CAP_FAST_PLUS | I2C_CAP_COMPOUND | I2C_CAP_STRETCH)
+#else
+#define I2C_CAPABILITIES (I2C_CAP_FAST | I2C_CAP_FAST_PLUS | I2C_CAP_COMPOUND)
+#endif
+#endif
+
+// RECEIVE and TRANSMIT (with their LEN registers) are double buffered, so the
+// controller can fill one bank while the component still works on the other.
+// RECEIVE_DONE reads back a bit per bank holding a packet not yet taken,
+// TRANSMIT_DONE a bit per bank holding no packet for the controller. Both have
+// I2C_DONE_SELECT set while the controller's accesses go to bank 1. Writing
+// either with a non-zero value hands the selected bank over and moves on.
+// Must match simple_i2c_controller.h
+#define I2C_BANKS 2
+#define I2C_DONE_BANK(bank) (1 << (bank))
+#define I2C_DONE_BANKS (I2C_DONE_BANK(0) | I2C_DONE_BANK(1))
+#define I2C_DONE_SELECT 0x10
+
+// RECEIVE banks form a ring of I2C_RX_BANKS (LINK_RX_BANKS in project.mk),
+// filled and taken in order. RECEIVE_DONE carries I2C_RX_BANKS - 1 in its top
+// bits, so the controller knows how many packets it may write before it has
+// to check again (its credits). I2C_DONE_SELECT only tells two banks apart
+#ifndef I2C_RX_BANKS
+#define I2C_RX_BANKS I2C_BANKS
+#endif
+#if I2C_RX_BANKS < 2 || I2C_RX_BANKS > 4
+#error "I2C_RX_BANKS must be 2 to 4"
+#endif
+#define I2C_RX_NEXT(bank) ((bank) + 1 == I2C_RX_BANKS ? 0 : (bank) + 1)
+#define I2C_DONE_CREDITS_SHIFT 6
+
+// Optional CRC-32 over every packet (LINK_CRC=1 in project.mk, must match
+// simple_i2c_controller.h), computed by the CRC block over the length as one
+// word followed by the packet padded to whole words. The controller writes
+// it to RECEIVE_CRC ahead of the packet and reads TRANSMIT_CRC after it. A
+// packet that does not match its CRC is dropped instead of handed over, and
+// RECEIVE_DONE reads back I2C_DONE_CRC_ERROR until a packet is taken again
+#define I2C_DONE_CRC_ERROR 0x20
+#ifdef LINK_CRC
+#define LINK_CRC_LEN 4
+#define LINK_CRC_POLY 0xEDB88320
+#endif
+
+// Length of the ENROLL_CERT register with COMPONENT_ENROLL, must match
+// ENROLL_CERT_LEN in crypto_util.h and simple_i2c_controller.h
+#define I2C_ENROLL_CERT_LEN 132
+
+// BOOT_RELEASE with BOOT_BROADCAST, written by the AP to every component at
+// once through the general call address. Entries of a component address
+// followed by its tag, must match simple_i2c_controller.h
+#define I2C_RELEASE_TAG_LEN 16
+#define I2C_RELEASE_ENTRY_LEN (1 + I2C_RELEASE_TAG_LEN)
+#define I2C_RELEASE_ENTRIES 15
+#define I2C_RELEASE_LEN (I2C_RELEASE_ENTRY_LEN * I2C_RELEASE_ENTRIES)
+// ASSIGN_ADDR with dynamic addresses (ADDR_ASSIGN=1 in project.mk), written
+// by the AP to every component at once through the general call address. Its sequence number, then entries of a
+// component ID, the address it moves to and its tag, must match simple_i2c_controller.h
+#define I2C_ASSIGN_SEQ_LEN 4
+#define I2C_ASSIGN_TAG_LEN 8
+#define I2C_ASSIGN_ENTRY_LEN (4 + 1 + I2C_ASSIGN_TAG_LEN)
+#define I2C_ASSIGN_ENTRIES 19
+#define I2C_ASSIGN_LEN (I2C_ASSIGN_SEQ_LEN + I2C_ASSIGN_ENTRY_LEN * I2C_ASSIGN_ENTRIES)
+#if defined(ADDR_ASSIGN) && !defined(BOOT_BROADCAST)
+#error "ADDR_ASSIGN=1 needs BOOT_BROADCAST=1 for the general call address"
+#endif
+// CALIBRATE_PATTERN with I2C_CALIBRATE, must match simple_i2c_controller.h
+#define I2C_CALIBRATE_LEN 32
+
+// TRANSMIT_WAIT with LINK_STRETCH: a read of it finding no packet holds SCL
+// low until one is published, or until LINK_STRETCH_MAX_US have gone by and
+// it reads back TRANSMIT_STATUS as it is. Must match simple_i2c_controller.h,
+// which keeps it below the AP's bus timeout
+#ifdef LINK_STRETCH
+#ifndef LINK_STRETCH_MAX_US
+#define LINK_STRETCH_MAX_US 4000
+#endif
+#ifndef I2C_STRETCH_TIMER
+#define I2C_STRETCH_TIMER MXC_TMR2
+#endif
+#endif
 
 /******************************** TYPE DEFINITIONS ********************************/
 // Enumeration with registers on the peripheral device
@@ -45,10 +164,69 @@ typedef enum {
     TRANSMIT,
     TRANSMIT_DONE,
     TRANSMIT_LEN,
+    CAPABILITY,
+    // Compound registers, see I2C_CAP_COMPOUND. A write to RECEIVE_FRAME is
+    // the length byte followed by the packet and hands the bank over at STOP
+    // like a RECEIVE_DONE write. TRANSMIT_STATUS reads back TRANSMIT_DONE
+    // followed by TRANSMIT_LEN
+    RECEIVE_FRAME,
+    TRANSMIT_STATUS,
+#ifdef LINK_CRC
+    // CRC of the packet in the bank selected for RECEIVE and TRANSMIT
+    RECEIVE_CRC,
+    TRANSMIT_CRC,
+#endif
+#ifdef COMPONENT_ENROLL
+    // Enrollment certificate of the component, read only
+    ENROLL_CERT,
+#endif
+#ifdef BOOT_BROADCAST
+    // Boot release, only taken from general call writes and general call
+    // writes only go here
+    BOOT_RELEASE,
+#endif
+#ifdef LINK_STRETCH
+    // TRANSMIT_STATUS, answered only once a packet is ready, read only
+    TRANSMIT_WAIT,
+#endif
+#ifdef ADDR_ASSIGN
+    // Address assignment, only taken from general call writes like BOOT_RELEASE
+    ASSIGN_ADDR,
+#endif
+#ifdef I2C_CALIBRATE
+    // Scratch for the AP's SCL timing calibration, reads back what was written
+    CALIBRATE_PATTERN,
+#endif
 } ECTF_I2C_REGS;
 
+// One bank of RECEIVE or TRANSMIT, the length register right in front of the
+// data so RECEIVE_FRAME writes both in one burst
+typedef struct {
+    uint8_t len;
+    uint8_t data[MAX_I2C_MESSAGE_LEN];
+#ifdef LINK_CRC
+    uint8_t crc[LINK_CRC_LEN];
+#endif
+} i2c_bank_t;
+
 typedef uint8_t i2c_addr_t;
 
+// Called from the ISR while the controller writes RECEIVE or RECEIVE_FRAME: once with 0 when
+// the write starts, then with the number of bytes of RECEIVE written so far.
+// bank is the RECEIVE bank being written
+typedef void (*i2c_simple_rx_cb_t)(int bank, int written);
+
+/******************************** EXTERN DEFINITIONS ********************************/
+// Extern definition to make I2C_REGS and I2C_REGS_LEN 
+// accessible outside of the implementation
+extern volatile uint8_t* I2C_REGS[I2C_REG_COUNT];
+extern int I2C_REGS_LEN[I2C_REG_COUNT];
+
+// Banks behind the data registers, I2C_REGS points at the ones the controller
+// currently accesses
+extern volatile i2c_bank_t RECEIVE_BANK[I2C_RX_BANKS];
+extern volatile i2c_bank_t TRANSMIT_BANK[I2C_BANKS];
+
 /******************************** FUNCTION PROTOTYPES ********************************/
 /**
  * @brief Initialize the I2C Connection
@@ -62,4 +240,133 @@ typedef uint8_t i2c_addr_t;
 */
 int i2c_simple_peripheral_init(i2c_addr_t addr);
 
+/**
+ * @brief Register a callback for RECEIVE write progress
+ * 
+ * @param cb: i2c_simple_rx_cb_t, callback to run from the ISR, NULL to disable
+ *
+ * Lets the caller start working on a message before the write completes.
+ * While DMA owns the RX FIFO the callback only runs again at STOP.
+*/
+void i2c_simple_set_rx_callback(i2c_simple_rx_cb_t cb);
+
+#ifdef COMPONENT_ENROLL
+/**
+ * @brief Publish the enrollment certificate in the ENROLL_CERT register
+ * 
+ * @param cert: const uint8_t*, I2C_ENROLL_CERT_LEN bytes, copied
+*/
+void i2c_simple_set_enroll_cert(const uint8_t* cert);
+#endif
+
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Check for a boot release from the controller
+ * 
+ * @return bool: true if BOOT_RELEASE was written since it was last taken
+*/
+bool i2c_simple_release_ready(void);
+
+/**
+ * @brief Take the last boot release written
+ * 
+ * @param buf: uint8_t*, buffer of I2C_RELEASE_LEN bytes
+ * 
+ * @return int: number of bytes written to BOOT_RELEASE, 0 if there was no
+ * new release
+*/
+int i2c_simple_take_release(uint8_t* buf);
+#endif
+
+#ifdef ADDR_ASSIGN
+/**
+ * @brief Check for an address assignment from the controller
+ * 
+ * @return bool: true if ASSIGN_ADDR was written since it was last taken
+*/
+bool i2c_simple_assign_ready(void);
+
+/**
+ * @brief Take the last address assignment written
+ * 
+ * @param buf: uint8_t*, buffer of I2C_ASSIGN_LEN bytes
+ * 
+ * @return int: number of bytes written to ASSIGN_ADDR, 0 if there was no
+ * new assignment
+*/
+int i2c_simple_take_assign(uint8_t* buf);
+
+/**
+ * @brief Answer the controller on another address from now on
+ * 
+ * @param addr: uint8_t, new 7 bit address
+*/
+void i2c_simple_set_addr(uint8_t addr);
+#endif
+
+#ifdef COMP_READY
+/**
+ * @brief Advertise our capabilities, CAPABILITY reads I2C_CAP_STARTING
+ * until then so the controller knows to wait for us
+*/
+void i2c_simple_set_ready(void);
+#endif
+
+/**
+ * @brief Check for a packet from the controller
+ * 
+ * @return bool: true if a RECEIVE bank holds a packet not yet released
+*/
+bool i2c_simple_rx_ready(void);
+
+/**
+ * @brief Get the RECEIVE bank holding the oldest packet
+ * 
+ * @return int: bank index into RECEIVE_BANK
+*/
+int i2c_simple_rx_bank(void);
+
+/**
+ * @brief Release the oldest RECEIVE bank
+ *
+ * Hands the bank back to the controller for a later packet. Does nothing
+ * if no packet is waiting
+*/
+void i2c_simple_rx_release(void);
+
+/**
+ * @brief Get the TRANSMIT bank the next packet goes in
+ * 
+ * @return int: bank index into TRANSMIT_BANK
+ *
+ * Only ever the bank the controller is not reading from
+*/
+int i2c_simple_tx_bank(void);
+
+/**
+ * @brief Hand the bank from i2c_simple_tx_bank to the controller
+ *
+ * With LINK_CRC the bank's CRC is filled in first
+*/
+void i2c_simple_tx_publish(void);
+
+/**
+ * @brief Check whether the controller has read every published packet
+ * 
+ * @return bool: true once all TRANSMIT banks have been acknowledged
+*/
+bool i2c_simple_tx_idle(void);
+
+/**
+ * @brief Check whether the bank from i2c_simple_tx_bank can be filled
+ * 
+ * @return bool: true unless both TRANSMIT banks hold unread packets
+*/
+bool i2c_simple_tx_free(void);
+
+/**
+ * @brief Take back the last published packet if it has not been read
+*/
+void i2c_simple_tx_withdraw(void);
+
 #endif
@@ -0,0 +1,95 @@
+#ifndef __SPI_SIMPLE_PERIPHERAL__
+#define __SPI_SIMPLE_PERIPHERAL__
+
+/*
+SPI peripheral end of the AP's bulk link (LINK_SPI=1 in project.mk), see
+simple_spi_controller.h on the AP for the exchanges. The AP selects this
+component with its own chip select, wired to the slave select of
+SPI_LINK_INST.
+
+One packet can be held each way. A received packet stays until
+spi_simple_rx_take copies it out, a published one until the AP has read it.
+Every transfer is armed from the completion interrupt of the one before, the
+header with the status of that moment.
+*/
+
+#include "stdbool.h"
+#include "stdint.h"
+#include "mxc_errors.h"
+#include "nvic_table.h"
+#include "spi.h"
+
+/******************************** MACRO DEFINITIONS ********************************/
+// SPI interface wired to the AP, and the clock the AP runs it at
+#ifndef SPI_LINK_INST
+#define SPI_LINK_INST MXC_SPI1
+#endif
+#ifndef LINK_SPI_HZ
+#define LINK_SPI_HZ 12000000
+#endif
+#define SPI_MAX_PACKET_LEN 256
+
+// Header of an exchange, must match simple_spi_controller.h
+#define SPI_HEADER_LEN 2
+#define SPI_CMD_MAGIC 0x50
+#define SPI_CMD_POLL (SPI_CMD_MAGIC | 0x00)
+#define SPI_CMD_WRITE (SPI_CMD_MAGIC | 0x01)
+#define SPI_CMD_READ (SPI_CMD_MAGIC | 0x02)
+#define SPI_STATUS_MAGIC 0xA0
+#define SPI_STATUS_RX_FULL 0x01
+#define SPI_STATUS_TX_READY 0x02
+
+/******************************** FUNCTION PROTOTYPES ********************************/
+/**
+ * @brief Initialize the SPI peripheral and arm the first header
+ *
+ * @return int: negative if error, zero if successful
+*/
+int spi_simple_peripheral_init(void);
+
+/**
+ * @brief Check for a packet from the AP
+ *
+ * @return bool: true while one is held
+*/
+bool spi_simple_rx_ready(void);
+
+/**
+ * @brief Copy out the packet from the AP and free its buffer
+ *
+ * @param packet: uint8_t*, buffer of SPI_MAX_PACKET_LEN bytes
+ *
+ * @return uint8_t: length of the packet, 0 if there was none
+*/
+uint8_t spi_simple_rx_take(uint8_t* packet);
+
+/**
+ * @brief Check whether the AP has read the last published packet
+ *
+ * @return bool: true if another one can be published
+*/
+bool spi_simple_tx_idle(void);
+
+/**
+ * @brief Hand a packet to the AP
+ *
+ * @param len: uint8_t, length of the packet
+ * @param packet: uint8_t*, packet
+ *
+ * Only call while spi_simple_tx_idle
+*/
+void spi_simple_tx_publish(uint8_t len, uint8_t* packet);
+
+/**
+ * @brief Take back a published packet the AP has not read
+*/
+void spi_simple_tx_withdraw(void);
+
+/**
+ * @brief Drop a half done exchange and arm a fresh header
+ *
+ * For when the AP has fallen back to I2C after a failed exchange
+*/
+void spi_simple_resync(void);
+
+#endif
@@ -18,9 +18,18 @@
 override BOARD=FTHR_RevA
 
 IPATH+=../deployment
+# Builds running side by side from one tree each pass their own directory
+# holding ectf_params.h, searched ahead of inc/
+ifneq ($(PARAMS_DIR),)
+IPATH+=$(PARAMS_DIR)
+endif
 IPATH+=inc/
 VPATH+=src/
 
+# Messaging engine, crypto utilities and wolfSSL shared with the other side
+IPATH+=../common/inc/
+VPATH+=../common/src/
+
 # ****************** eCTF Bootloader *******************
 # DO NOT REMOVE
 LINKERFILE=firmware.ld
@@ -30,7 +39,7 @@ ENTRY=firmware_startup
 # ****************** eCTF Crypto Example *******************
 # Uncomment the commented lines below and comment the disable
 # lines to enable the eCTF Crypto Example.
-# WolfSSL must be included in this directory as wolfssl/
+# WolfSSL must be included in ../common as wolfssl/
 # WolfSSL can be downloaded from: https://www.wolfssl.com/download/
 # There is no additional functionality as in the application_processor
 # but this will set up compilation and linking for WolfSSL
@@ -40,3 +49,775 @@ CRYPTO_EXAMPLE=1
 
 # Enable Crypto Example
 #CRYPTO_EXAMPLE=1
+
+# ****************** MAX78000 AES Offload *******************
+# Uncomment to run AES-CBC on the on-chip AES engine through the
+# wolfCrypt crypto callback interface. The engine is self tested at
+# boot and the firmware falls back to software AES if it fails.
+# SHA-256 always stays in software, the MAX78000 has no hash engine.
+#MAX78000_HW_CRYPTO=1
+
+ifeq ($(MAX78000_HW_CRYPTO), 1)
+WOLFCRYPT_CFLAGS += -DWOLF_CRYPTO_CB
+WOLFCRYPT_CFLAGS += -DWOLFSSL_MAX78000_AES
+SRCS += ../common/wolfssl/wolfcrypt/src/port/maxim/max78000.c
+endif
+
+# ****************** Constant-Time AES *******************
+# Uncomment to run software AES-CBC and the single block decrypt on the
+# table-free bitsliced AES in common/src/aes_ct.c instead of wolfCrypt's
+# T-tables. Every block then takes the same time whatever the key and data,
+# including with the instruction cache off. The AES engine still takes
+# precedence when MAX78000_HW_CRYPTO is on; AES-GCM stays in wolfCrypt.
+#AES_CT=1
+
+ifeq ($(AES_CT), 1)
+PROJ_CFLAGS += -DAES_CT
+endif
+
+# ****************** Interleaved CBC Decryption *******************
+# Uncomment to run software AES-CBC decryption through the two-block kernel
+# in common/src/aes_tt.c instead of wc_AesCbcDecrypt. It uses wolfCrypt's
+# round keys and T-table layout but runs two blocks through every round
+# together, from a table it builds in SRAM at crypto_init (1.25 KB). Not
+# constant-time, exclusive with AES_CT. The AES engine still takes
+# precedence when MAX78000_HW_CRYPTO is on.
+#AES_TT=1
+
+ifeq ($(AES_TT), 1)
+PROJ_CFLAGS += -DAES_TT
+endif
+
+# ****************** Precomputed Key Tables *******************
+# Uncomment to load the device key's AES round keys, HMAC midstates and
+# CMAC subkeys from tables the deployment generates into global_secrets.h
+# (deployment/gen_key_tables.py), so nothing is expanded at boot. The AES
+# tables are checked against a known answer and the key is expanded as
+# usual if they do not fit, or if the AES engine is in use.
+#PRECOMPUTED_KEYS=1
+
+ifeq ($(PRECOMPUTED_KEYS), 1)
+PROJ_CFLAGS += -DPRECOMPUTED_KEYS
+endif
+
+# ****************** SRAM Fast Code *******************
+# Uncomment to run the hot paths from zero wait state SRAM: functions
+# marked FASTCODE (the component's I2C ISR, the single block decrypt and
+# the AES_CT rounds) and wolfCrypt's AES block, AES-CBC and SHA-256
+# transforms. They are copied from flash at startup with .data and take
+# that much SRAM. MSDK driver code such as MXC_I2C_AsyncHandler stays in
+# flash. Has no effect on wolfCrypt with LTO=1.
+#SRAM_FASTCODE=1
+
+ifeq ($(SRAM_FASTCODE), 1)
+WOLFCRYPT_CFLAGS += -DSRAM_FASTCODE
+endif
+
+# ****************** Hot/Cold Code *******************
+# Uncomment to group the functions marked HOT in hotcold.h (frame seal and
+# open, hash, MAC and AES calls, the board link's send and receive) at the
+# start of .text, and those marked COLD (the post boot loop) right after
+# them, so the hot loops share instruction cache lines and flash prefetches.
+#HOT_COLD=1
+
+ifeq ($(HOT_COLD), 1)
+PROJ_CFLAGS += -DHOT_COLD
+endif
+
+# ****************** Thumb-2 SHA-256 *******************
+# Uncomment to run wolfCrypt's SHA-256 compression function on the
+# Cortex-M4 assembly in common/src/sha256_thumb2.S, which keeps the state
+# in registers and folds every rotation into the barrel shifter. Speeds up
+# the flash integrity check and every frame hash. Goes to SRAM along with
+# the other transforms with SRAM_FASTCODE.
+#SHA256_THUMB2=1
+
+ifeq ($(SHA256_THUMB2), 1)
+WOLFCRYPT_CFLAGS += -DWOLFSSL_SHA256_THUMB2
+SRCS += ../common/src/sha256_thumb2.S
+ifeq ($(SRAM_FASTCODE), 1)
+PROJ_AFLAGS += -DSRAM_FASTCODE
+endif
+endif
+
+# ****************** AEAD Message Framing *******************
+# Uncomment one to frame msg_t with an AEAD instead of SHA-256 + AES-CBC:
+# AES-GCM (12 byte nonce, 16 byte tag) or Ascon-128 (16 byte nonce, 16
+# byte tag) from common/src/ascon.c. Ascon needs no tables or GHASH
+# multiplications and costs a few permutations per frame, the cheapest
+# framing for chatty post-boot traffic. This changes the wire format, so it
+# must be set the same way for the AP and every component.
+#MSG_AEAD=1
+#MSG_AEAD=ASCON
+
+ifeq ($(MSG_AEAD), 1)
+PROJ_CFLAGS += -DMSG_AEAD
+WOLFCRYPT_CFLAGS += -DHAVE_AESGCM
+endif
+ifeq ($(MSG_AEAD), ASCON)
+PROJ_CFLAGS += -DMSG_AEAD_ASCON
+endif
+
+# ****************** GHASH Tables *******************
+# Uncomment one to run MSG_AEAD=1's multiplications in GF(2^128) from a
+# table made from the hash key instead of bit by bit. The table is built
+# when a key is loaded (crypto_init, a channel open, a component key slot)
+# and never on the per-frame path. wolfCrypt keeps it in every AES context,
+# three per loaded key, so 4BIT costs 1.5 KB of SRAM per key and 8BIT, the
+# faster of the two, 12 KB per key. Does not change the wire format.
+#GCM_GHASH=4BIT
+#GCM_GHASH=8BIT
+
+ifeq ($(GCM_GHASH), 4BIT)
+WOLFCRYPT_CFLAGS += -DGCM_TABLE_4BIT
+endif
+ifeq ($(GCM_GHASH), 8BIT)
+WOLFCRYPT_CFLAGS += -DGCM_TABLE
+endif
+
+# ****************** Keyed Frame MAC *******************
+# Uncomment one to protect SHA-256 + AES-CBC frames with a keyed MAC
+# instead of the unkeyed SHA-256. HMAC-SHA256 runs from midstates
+# precomputed per key; AES-CMAC (16 byte tag, 16 more bytes of contents)
+# uses a key schedule expanded once and takes SHA-256 off the per-frame
+# path. This changes the wire format, so it must be set the same way for
+# the AP and every component. Not available with MSG_AEAD.
+#MSG_MAC=HMAC
+#MSG_MAC=CMAC
+
+ifeq ($(MSG_MAC), HMAC)
+PROJ_CFLAGS += -DMSG_MAC_HMAC
+endif
+ifeq ($(MSG_MAC), CMAC)
+PROJ_CFLAGS += -DMSG_MAC_CMAC
+WOLFCRYPT_CFLAGS += -DWOLFSSL_CMAC
+endif
+
+# ****************** CTR Frame Encryption *******************
+# Uncomment to encrypt MSG_MAC frames with AES-CTR instead of AES-CBC.
+# Frames are encrypted exactly as long as they are, check included, and
+# the keystream of the next frame is made ahead of time so sealing is a
+# single XOR. Needs MSG_MAC, not available with MSG_AEAD or
+# STREAM_DECRYPT. This changes the wire format, so it must be set the
+# same way for the AP and every component.
+#MSG_CTR=1
+
+ifeq ($(MSG_CTR), 1)
+PROJ_CFLAGS += -DMSG_CTR
+WOLFCRYPT_CFLAGS += -DWOLFSSL_AES_COUNTER
+endif
+
+# ****************** RISC-V Keystream *******************
+# Uncomment to make the MSG_CTR keystreams on the RISC-V core instead of
+# the M4: a small program of its own (common/riscv) runs the AES counter
+# blocks out of the top 16 KB of SRAM, which the M4 then goes without, and
+# ctr_pool_fill only collects them, so the AES runs alongside the link and post-boot code.
+# The framing, the MAC, the receive side and channel or component keys stay
+# on the M4. Needs MSG_CTR=1, AES_CT=1 and a RISC-V toolchain (RV_CROSS in
+# ../common/riscv_keystream.mk).
+#RISCV_KEYSTREAM=1
+
+ifeq ($(RISCV_KEYSTREAM), 1)
+PROJ_CFLAGS += -DRISCV_KEYSTREAM
+PROJ_LDFLAGS += -Wl,--defsym=__rv_sram_len=0x4000
+endif
+
+# ****************** Counter Nonces *******************
+# Uncomment to count every frame's challenge and IV / nonce up from values
+# drawn once per boot instead of drawing them from the RNG per frame. AEAD
+# nonces are the boot value plus a frame counter. CBC IVs are that block
+# encrypted under the frame key, which keeps them unpredictable. MSG_CTR
+# keeps its pooled IVs and only counts challenges. Does not change the wire
+# format and need not match between the AP and the components.
+#MSG_NONCE_COUNTER=1
+
+ifeq ($(MSG_NONCE_COUNTER), 1)
+PROJ_CFLAGS += -DMSG_NONCE_COUNTER
+endif
+
+# ****************** Replay Filter *******************
+# Uncomment to drop a received frame whose IV / nonce matches one of the
+# last MSG_REPLAY_WINDOW frames that opened, before it is decrypted or
+# checked. A flood of replayed frames then costs a few compares each
+# instead of the full crypto. The IV / nonce is in the clear at the end of
+# every frame and cannot be changed without failing the check. With
+# STREAM_DECRYPT the receive ISR has already decrypted most of the frame,
+# so only the check is saved. Does not change the wire format.
+# MSG_REPLAY_WINDOW (up to 255) costs its IV / nonce length in RAM per frame.
+#MSG_REPLAY_FILTER=1
+MSG_REPLAY_WINDOW=16
+
+ifeq ($(MSG_REPLAY_FILTER), 1)
+PROJ_CFLAGS += -DMSG_REPLAY_FILTER -DMSG_REPLAY_WINDOW=$(MSG_REPLAY_WINDOW)
+endif
+
+# ****************** Wire Format Negotiation *******************
+# Uncomment to speak the original SHA-256 + AES-CBC framing besides the one
+# MSG_AEAD or MSG_MAC selects, so a deployment can move to the faster
+# framing one device at a time. SCAN and VALIDATE start in the original
+# framing, the component's ID reply says which framings it speaks and the
+# AP uses the faster one with it from then on. Components answer in
+# whichever framing the AP's frame came in. Contents are sized for the
+# original framing's longer trailer. Needs MSG_AEAD or MSG_MAC, not
+# available with MSG_CTR.
+#MSG_FORMAT_NEGOTIATE=1
+
+ifeq ($(MSG_FORMAT_NEGOTIATE), 1)
+PROJ_CFLAGS += -DMSG_FORMAT_NEGOTIATE
+endif
+
+# ****************** Component Keys *******************
+# Uncomment to run every frame under this component's own key, HKDF-SHA256
+# of the device key and its I2C address, instead of the shared device key.
+# Must be set the same way for the AP and every component.
+#COMPONENT_KEYS=1
+
+ifeq ($(COMPONENT_KEYS), 1)
+PROJ_CFLAGS += -DCOMPONENT_KEYS -DCOMPONENT_KEY_SLOTS=1
+WOLFCRYPT_CFLAGS += -DHAVE_HKDF
+endif
+
+# ****************** Component Enrollment *******************
+# Uncomment (with COMPONENT_KEYS) to derive this component's key from the
+# P-256 ECDH of its own and the AP's key pairs instead of the device key.
+# The AP checks the certificate the build tools issued with our key pair
+# (deployment/gen_enroll_keys.py), read from the ENROLL_CERT register.
+# P-256 runs on the Cortex-M assembly in wolfCrypt's sp_cortexm.c.
+# Must be set the same way for the AP and every component.
+#COMPONENT_ENROLL=1
+
+ifeq ($(COMPONENT_ENROLL), 1)
+PROJ_CFLAGS += -DCOMPONENT_ENROLL
+WOLFCRYPT_CFLAGS += -DHAVE_ECC -DWOLFSSL_SP_ARM_CORTEX_M_ASM
+endif
+
+# ****************** Enrollment Resumption *******************
+# Uncomment (with COMPONENT_ENROLL) to keep the ECDH secret with the AP in
+# the top page of RESERVED, encrypted under the device key, so it is only
+# computed on the first boot of an image. The AP need not set it the same way.
+#ENROLL_RESUME=1
+
+ifeq ($(ENROLL_RESUME), 1)
+PROJ_CFLAGS += -DENROLL_RESUME
+endif
+
+# ****************** I2C DMA Transfers *******************
+# Uncomment to service the I2C FIFOs with DMA instead of per-byte
+# interrupts. Falls back to the interrupt driven path at runtime if
+# no DMA channel can be acquired.
+#I2C_USE_DMA=1
+
+ifeq ($(I2C_USE_DMA), 1)
+PROJ_CFLAGS += -DI2C_USE_DMA
+endif
+
+# ****************** DMA Copies *******************
+# Uncomment to move buffers of DMA_COPY_MIN bytes or more with a memory to
+# memory DMA channel instead of the CPU (common/src/dma_copy.c): frames in
+# and out of the component's register banks and the bulk copies of jumbo
+# frames. The wipe of the jumbo buffer runs on in the background while the
+# caller goes on. Falls back to the CPU at runtime if no DMA channel can be
+# acquired.
+#DMA_COPY=1
+DMA_COPY_MIN=128
+
+ifeq ($(DMA_COPY), 1)
+PROJ_CFLAGS += -DDMA_COPY -DDMA_COPY_MIN=$(DMA_COPY_MIN)
+endif
+
+# ****************** I2C Ready Line *******************
+# Uncomment to use a shared open-drain "data ready" GPIO between the
+# components and the AP (P1.6 by default, see board_link.h). Must be
+# set the same way for the AP and every component.
+#BOARD_LINK_READY_GPIO=1
+
+ifeq ($(BOARD_LINK_READY_GPIO), 1)
+PROJ_CFLAGS += -DBOARD_LINK_READY_GPIO
+endif
+
+# ****************** I2C Link CRC *******************
+# Uncomment to protect every packet on the bus with a CRC-32 from the
+# MAX78000 CRC block. Corrupted packets are refused at the link, before any
+# crypto runs, and sent or read again up to LINK_CRC_RETRIES times (see
+# simple_i2c_controller.h). Must be set the same way for the AP and every
+# component.
+#LINK_CRC=1
+
+ifeq ($(LINK_CRC), 1)
+PROJ_CFLAGS += -DLINK_CRC
+endif
+
+# ****************** I2C Clock Stretched Replies *******************
+# Uncomment to answer TRANSMIT_WAIT reads only once a reply is published,
+# stretching SCL for up to LINK_STRETCH_MAX_US meanwhile (timed with TMR2),
+# so the AP reads each reply with one transaction instead of polling
+# TRANSMIT_DONE. Must be set the same way for the AP and every component.
+#LINK_STRETCH=1
+LINK_STRETCH_MAX_US=4000
+
+ifeq ($(LINK_STRETCH), 1)
+PROJ_CFLAGS += -DLINK_STRETCH
+PROJ_CFLAGS += -DLINK_STRETCH_MAX_US=$(LINK_STRETCH_MAX_US)
+endif
+
+# ****************** I2C Timing Calibration *******************
+# Uncomment to offer the CALIBRATE_PATTERN scratch register the AP tunes the
+# bus timing with. Must be set the same way for the AP and every component.
+#I2C_CALIBRATE=1
+
+ifeq ($(I2C_CALIBRATE), 1)
+PROJ_CFLAGS += -DI2C_CALIBRATE
+endif
+
+# ****************** Component Ready *******************
+# Uncomment to read back I2C_CAP_STARTING in the CAPABILITY register until
+# startup is done and the main loop is about to take commands, so an AP
+# built with COMP_READY=1 waits for us instead of failing a boot sent too
+# early.
+#COMP_READY=1
+
+ifeq ($(COMP_READY), 1)
+PROJ_CFLAGS += -DCOMP_READY
+endif
+
+# ****************** I2C Bus *******************
+# I2C controller (0, 1 or 2) the component is wired to. Must match the bus
+# given for it in build_ap.py --component-buses. Can also be set from the
+# environment for builds of several components with different buses.
+I2C_BUS ?= 1
+PROJ_CFLAGS += -DI2C_BUS=$(I2C_BUS)
+
+# ****************** SPI Bulk Link *******************
+# Uncomment on components that also have SPI wired to the AP, as SPI1
+# peripheral with the AP's chip select on its slave select. Packets are taken
+# from I2C or SPI, whichever has one, and answers go back the same way, so
+# the AP decides when to move over (after boot, see LINK_SPI in the AP's
+# project.mk). LINK_SPI_HZ must match the AP. Not available with
+# STREAM_DECRYPT.
+#LINK_SPI=1
+LINK_SPI_HZ=12000000
+
+ifeq ($(LINK_SPI), 1)
+PROJ_CFLAGS += -DLINK_SPI -DLINK_SPI_HZ=$(LINK_SPI_HZ)
+endif
+
+# ****************** I2C Receive Banks *******************
+# Number of RECEIVE banks (2 to 4) the AP may fill ahead of the component.
+# Advertised in RECEIVE_DONE, so the AP needs no setting of its own: it
+# sends as many packets as there are free banks before it polls again,
+# which keeps streams going at the bus rate. Every bank takes about 260
+# bytes of RAM.
+LINK_RX_BANKS=2
+
+PROJ_CFLAGS += -DI2C_RX_BANKS=$(LINK_RX_BANKS)
+
+# ****************** Idle Wait Timeout *******************
+# The component sleeps with WFI while it waits for the AP and wakes on
+# the I2C STOP interrupt. Set to a number of milliseconds to also give
+# up a wait after that long, timed by a low-power timer (TMR4) that
+# keeps running while the core sleeps. 0 waits forever.
+BOARD_LINK_TIMEOUT_MS=0
+
+ifneq ($(BOARD_LINK_TIMEOUT_MS), 0)
+PROJ_CFLAGS += -DBOARD_LINK_TIMEOUT_MS=$(BOARD_LINK_TIMEOUT_MS)
+endif
+
+# ****************** Session Timeout *******************
+# Set to a number of milliseconds to drop a validate or attest exchange
+# when the AP takes longer than that to send its next frame. Any frame
+# that is not the next step of an exchange starts a new command either
+# way. 0 waits for the AP forever.
+COMP_SESSION_TIMEOUT_MS=0
+
+ifneq ($(COMP_SESSION_TIMEOUT_MS), 0)
+PROJ_CFLAGS += -DCOMP_SESSION_TIMEOUT_MS=$(COMP_SESSION_TIMEOUT_MS)
+endif
+
+# ****************** Invalid Frame Backoff *******************
+# Set to a number of frames to stop answering after that many invalid
+# frames in a row. Until the next valid frame, an invalid one gets no
+# reply, so no frame is sealed for it, and is followed by
+# COMP_REJECT_BACKOFF_MS milliseconds of sleep before the bus is read
+# again. A flood of bad frames then costs one open per backoff instead of
+# an open and a sealed reply each. 0 answers every invalid frame.
+COMP_REJECT_AFTER=0
+COMP_REJECT_BACKOFF_MS=20
+
+ifneq ($(COMP_REJECT_AFTER), 0)
+PROJ_CFLAGS += -DCOMP_REJECT_AFTER=$(COMP_REJECT_AFTER) -DCOMP_REJECT_BACKOFF_MS=$(COMP_REJECT_BACKOFF_MS)
+endif
+
+# ****************** Light Scan *******************
+# Uncomment to list components with a short nonce packet, which the
+# component answers with its ID and a 16 byte HMAC-SHA256 under the device
+# key, instead of a full SCAN exchange. Neither side draws an IV or runs
+# AES for a list. Must be set the same way for the AP and every component.
+#SCAN_LIGHT=1
+
+ifeq ($(SCAN_LIGHT), 1)
+PROJ_CFLAGS += -DSCAN_LIGHT
+endif
+
+# ****************** Resumable Validation *******************
+# Uncomment to keep components that validated during a failed boot attempt
+# waiting for the next attempt, which then only validates the components
+# that failed and sends the others their boot frame straight away, still
+# answering their latest challenge. The AP reuses a validation for at most
+# VALIDATE_RESUME_MAX_AGE attempts and forgets them on list, attest and
+# replace. Must be set the same way for the AP and every component.
+#VALIDATE_RESUME=1
+
+ifeq ($(VALIDATE_RESUME), 1)
+PROJ_CFLAGS += -DVALIDATE_RESUME
+endif
+
+# ****************** Two Round Trip Boot *******************
+# Uncomment to validate and boot a component in two exchanges instead of
+# three. The component's answer to VALIDATE already carries its ID, and the
+# AP's proof travels in the BOOT frame, which the component only acts on if
+# it answers the challenge of that answer. Must be set the same way for the
+# AP and every component.
+#BOOT_TWO_TRIP=1
+
+ifeq ($(BOOT_TWO_TRIP), 1)
+PROJ_CFLAGS += -DBOOT_TWO_TRIP
+endif
+
+# ****************** One Round Trip Attest *******************
+# Uncomment to attest in one exchange. The AP's ATTEST frame answers the
+# challenge of the component's last frame, saved when the previous attest
+# of that component ended, and the component answers it with the data right
+# away, bound to the AP's new challenge. If the component has sent another
+# frame since, it asks for the AP's proof as before. Must be set the same
+# way for the AP and every component.
+#ATTEST_ONE_TRIP=1
+
+ifeq ($(ATTEST_ONE_TRIP), 1)
+PROJ_CFLAGS += -DATTEST_ONE_TRIP
+endif
+
+# ****************** Broadcast Boot Release *******************
+# Uncomment to have components hold their boot after the boot message until
+# the AP has every boot message, then release them all with one write to the
+# I2C general call address carrying a tag per component, so they all boot
+# at the same STOP or none of them does. A component gives up after
+# COMP_SESSION_TIMEOUT_MS or on the AP's next frame. Must be set the same
+# way for the AP and every component.
+#BOOT_BROADCAST=1
+
+ifeq ($(BOOT_BROADCAST), 1)
+PROJ_CFLAGS += -DBOOT_BROADCAST
+endif
+
+# ****************** Dynamic I2C Addresses *******************
+# Uncomment to have the AP move every provisioned component from the address
+# its ID maps to onto a dense range, with one general call write of an entry
+# per component: its ID, the new address and a tag under the device key. The
+# write is numbered, and a component refuses any numbered at or below the
+# last one it took, so an old assignment cannot be replayed.
+# Entries go by the whole ID, so components whose IDs map to the same
+# address can both be provisioned. The slots are kept in the flash record
+# and a replacement takes over the slot of the component it replaces. Keys
+# and MACs stay bound to the address the ID maps to. Needs BOOT_BROADCAST=1
+# and must be set the same way for the AP and every component.
+#ADDR_ASSIGN=1
+
+ifeq ($(ADDR_ASSIGN), 1)
+PROJ_CFLAGS += -DADDR_ASSIGN
+endif
+
+# ****************** Post-Boot Channel *******************
+# Uncomment to open a secure channel with every component at boot. Post-boot
+# secure_send / secure_receive then use one frame under a derived channel
+# key with a sequence number for replay protection, instead of the three
+# frame handshake. Must be set the same way for the AP and every component.
+#POST_BOOT_SESSION=1
+
+ifeq ($(POST_BOOT_SESSION), 1)
+PROJ_CFLAGS += -DPOST_BOOT_SESSION
+endif
+
+# ****************** Message Streams *******************
+# Uncomment to build the post-boot stream API for bulk transfers. Streams
+# fragment any amount of data into channel frames and keep up to
+# MSG_STREAM_WINDOW frames in flight per acknowledgement. Must be set the
+# same way for the AP and every component.
+#MSG_STREAM=1
+
+ifeq ($(MSG_STREAM), 1)
+PROJ_CFLAGS += -DMSG_STREAM
+endif
+
+# ****************** Stream Compression *******************
+# Uncomment to let the AP open a stream with MSG_STREAM_COMPRESS, whose data
+# is then compressed in blocks of MSG_STREAM_LZ_BLOCK bytes with a small
+# window LZ77 (msg_lz.h) before it is sealed. Logs and config blobs shrink
+# several times, so bulk transfers take that much less bus time. Costs
+# MSG_STREAM_LZ_BLOCK bytes in every msg_stream_t. Only for data that is
+# neither secret nor attacker influenced, as compressed lengths leak what
+# the data has in common. Needs MSG_STREAM=1. Must be set the same way for
+# the AP and every component.
+#MSG_STREAM_LZ=1
+MSG_STREAM_LZ_BLOCK=1024
+
+ifeq ($(MSG_STREAM_LZ), 1)
+PROJ_CFLAGS += -DMSG_STREAM_LZ -DMSG_STREAM_LZ_BLOCK=$(MSG_STREAM_LZ_BLOCK)
+endif
+
+# ****************** Component Relay *******************
+# Uncomment to let components send each other data through the AP:
+# secure_send_to and secure_receive_from on the components, secure_relay
+# forwarding frames from one post-boot channel to another on the AP. Needs
+# POST_BOOT_SESSION=1. Must be set the same way for the AP and every component.
+#MSG_RELAY=1
+
+ifeq ($(MSG_RELAY), 1)
+PROJ_CFLAGS += -DMSG_RELAY
+endif
+
+# ****************** Publish / Subscribe *******************
+# Uncomment to let components publish data on topics without the AP asking:
+# secure_publish queues frames in a small outbox on the component, which
+# hands them to both TRANSMIT banks as they free up. pubsub_poll on the AP
+# drains every component in turn, a few frames each, and calls the callbacks
+# registered with pubsub_subscribe, so one slow component holds up no other.
+# Needs POST_BOOT_SESSION=1, works best with BOARD_LINK_READY_GPIO=1. Must be
+# set the same way for the AP and every component.
+#MSG_PUBSUB=1
+
+ifeq ($(MSG_PUBSUB), 1)
+PROJ_CFLAGS += -DMSG_PUBSUB
+endif
+
+# ****************** Link Scheduler *******************
+# Uncomment to give the AP's post-boot traffic two priority classes:
+# sched_send_control queues short control messages, sched_send_bulk starts a
+# stream, and sched_run sends every queued control message before each bulk
+# chunk. Components take control messages with secure_receive, or through
+# stream->control while reading a stream. Needs POST_BOOT_SESSION=1 and
+# MSG_STREAM=1. Must be set the same way for the AP and every component.
+#MSG_SCHED=1
+
+ifeq ($(MSG_SCHED), 1)
+PROJ_CFLAGS += -DMSG_SCHED
+endif
+
+# ****************** Jumbo Frames *******************
+# Uncomment to add secure_send_jumbo / secure_receive_jumbo, which carry up
+# to MSG_JUMBO_MAX_LEN bytes (2048 by default) as one frame with a single
+# IV and check, sent as consecutive packets through the receive banks.
+# Needs POST_BOOT_SESSION=1, not available with STREAM_DECRYPT. Must be set
+# the same way for the AP and every component.
+#MSG_JUMBO=1
+
+ifeq ($(MSG_JUMBO), 1)
+PROJ_CFLAGS += -DMSG_JUMBO
+endif
+
+# ****************** Heartbeats *******************
+# Uncomment to answer the AP's heartbeats, which it only sends once the
+# post-boot channel has been silent for a while. They are answered from
+# inside secure_receive and never reach the post-boot code. Needs
+# POST_BOOT_SESSION=1. Must be set the same way for the AP and every component.
+#MSG_HEARTBEAT=1
+
+ifeq ($(MSG_HEARTBEAT), 1)
+PROJ_CFLAGS += -DMSG_HEARTBEAT
+endif
+
+# ****************** Time Sync *******************
+# Uncomment to answer the AP's time_sync. PINGs are answered and SETs taken
+# from inside secure_receive, after which time_sync_now gives the AP's
+# microsecond clock (see time_sync.h). Uses TMR3. Needs POST_BOOT_SESSION=1.
+# Must be set the same way for the AP and every component.
+#MSG_TIMESYNC=1
+
+ifeq ($(MSG_TIMESYNC), 1)
+PROJ_CFLAGS += -DMSG_TIMESYNC
+endif
+
+# ****************** Buffer Pool *******************
+# Uncomment to add msg_pool_alloc / msg_pool_free for post-boot code: fixed
+# blocks for whole frames and for secure_send / secure_receive payloads,
+# taken from a NOLOAD linker section and usable from interrupts (see
+# msg_pool.h). Only this side's post-boot code uses it.
+#MSG_POOL=1
+MSG_POOL_FRAMES=4
+MSG_POOL_PAYLOADS=8
+
+ifeq ($(MSG_POOL), 1)
+PROJ_CFLAGS += -DMSG_POOL
+PROJ_CFLAGS += -DMSG_POOL_FRAMES=$(MSG_POOL_FRAMES) -DMSG_POOL_PAYLOADS=$(MSG_POOL_PAYLOADS)
+endif
+
+# ****************** Streaming Decrypt *******************
+# Uncomment to block decrypt incoming SHA-256 + AES-CBC frames from the
+# I2C ISR while they are still arriving, leaving only the CBC XOR and the
+# hash check for after STOP. Not available with MSG_AEAD or MSG_CTR. Component only,
+# the wire format does not change.
+#STREAM_DECRYPT=1
+
+ifeq ($(STREAM_DECRYPT), 1)
+PROJ_CFLAGS += -DSTREAM_DECRYPT
+endif
+
+# ****************** Frame Length *******************
+# Longest frame on the bus, header, contents and check included, up to 255.
+# Contents get what the framing leaves, so shorter frames mean shorter bus
+# transactions and more frames for the same data. The build fails if the
+# largest message body does not fit, below 127 bytes with the default
+# SHA-256 framing. Must be set the same way for the AP and every component.
+MSG_FRAME_LEN=255
+
+ifneq ($(MSG_FRAME_LEN), 255)
+PROJ_CFLAGS += -DMSG_FRAME_LEN=$(MSG_FRAME_LEN)
+endif
+
+# ****************** Attestation Field Length *******************
+# Longest LOC, DATE and CUST attestation field sent, up to 255 characters.
+# Data longer than one frame holds goes over several frames. Must be set
+# the same way for the AP and every component.
+ATTEST_FIELD_MAX_LEN=64
+
+ifneq ($(ATTEST_FIELD_MAX_LEN), 64)
+PROJ_CFLAGS += -DATTEST_FIELD_MAX_LEN=$(ATTEST_FIELD_MAX_LEN)
+endif
+
+# ****************** Sealed Attestation Data *******************
+# Uncomment to have build_comp.py seal the attestation data under the
+# deployment key into the component's ectf_params.h. The component sends the
+# sealed blob from flash as it is and only the AP opens it, so the plain
+# fields stay out of the component image. Needs the deployment built first.
+# Not available with KEY_ROTATION. Must be set the same way for the AP and
+# every component.
+#ATTEST_SEALED=1
+
+ifeq ($(ATTEST_SEALED), 1)
+PROJ_CFLAGS += -DATTEST_SEALED
+endif
+
+# ****************** Random Pool *******************
+# Draw rng_gen() values from a wolfCrypt Hash_DRBG pool seeded from the
+# TRNG, which stays powered and reseeds the pool in the background from
+# interrupts. Every TRNG byte that goes into it passes the SP 800-90B
+# repetition count and adaptive proportion tests first, off the rng_gen
+# path. Comment out to read the TRNG directly on every call, untested.
+RNG_POOL=1
+
+ifeq ($(RNG_POOL), 1)
+PROJ_CFLAGS += -DRNG_POOL
+WOLFCRYPT_CFLAGS += -DWC_RNG_SEED_CB
+endif
+
+# ****************** Hot Path Tracing *******************
+# Uncomment to timestamp the crypto, RNG, board link and flash hot paths
+# with the DWT cycle counter. The AP dumps the trace on the "trace" host
+# command; the component dumps it over UART after every AP command.
+#TRACE=1
+
+ifeq ($(TRACE), 1)
+PROJ_CFLAGS += -DTRACE_ENABLE
+endif
+
+# ****************** Power Markers *******************
+# Uncomment to drive one GPIO per protocol phase high while the firmware is
+# in it: comp_transmit_and_ack, and the AES and hash calls. Record them on a power
+# analyzer's digital inputs and ectf_tools/power_tool.py reports the energy
+# of every phase from its CSV export. POWER_MARK_PIN0 to POWER_MARK_PIN0 + 3
+# of POWER_MARK_PORT (P2.3 to P2.6 by default) must be free on the board.
+#POWER_MARKERS=1
+
+ifeq ($(POWER_MARKERS), 1)
+PROJ_CFLAGS += -DPOWER_MARKERS
+endif
+
+# ****************** Runtime Statistics *******************
+# Uncomment to count frames, refused frames, challenge mismatches, wakeups
+# per wait and flash erases, along with the crypto, RNG and flash cycles,
+# and answer the AP's STATS command with them (see the AP's "stats" host
+# command). Runs on the DWT tracer, so implies TRACE=1.
+#LINK_STATS=1
+
+ifeq ($(LINK_STATS), 1)
+PROJ_CFLAGS += -DLINK_STATS
+ifneq ($(TRACE), 1)
+PROJ_CFLAGS += -DTRACE_ENABLE
+endif
+endif
+
+# ****************** Latency Histograms *******************
+# Uncomment to keep a log2 bucket latency histogram, in microseconds, of the
+# handler of every opcode. The AP's "stats" host command fetches them with
+# the HIST command. Every histogram is a fixed array of counts. Needs
+# LINK_STATS=1.
+#LAT_HIST=1
+
+ifeq ($(LAT_HIST), 1)
+PROJ_CFLAGS += -DLAT_HIST
+endif
+
+# ****************** Small printf *******************
+# Uncomment to replace newlib's printf with the small formatter in
+# common/src/tiny_printf.c, which knows only the conversions the firmware
+# uses and allocates nothing. Smaller code, and formatting time that only
+# depends on the output length.
+#TINY_PRINTF=1
+
+ifeq ($(TINY_PRINTF), 1)
+PROJ_CFLAGS += -DTINY_PRINTF
+# Keep gcc from turning printf calls into puts and putchar
+PROJ_CFLAGS += -fno-builtin-printf
+endif
+
+# ****************** Static Crypto Heap *******************
+# Uncomment to build wolfCrypt without malloc. Every allocation it makes
+# (the DRBG state, AES-GCM scratch) then comes from fixed size pools in
+# a CRYPTO_HEAP_SIZE byte arena that firmware.ld keeps in its own SRAM
+# section, so crypto latency never depends on the general heap.
+#CRYPTO_STATIC_MEMORY=1
+CRYPTO_HEAP_SIZE=4096
+
+ifeq ($(CRYPTO_STATIC_MEMORY), 1)
+PROJ_CFLAGS += -DCRYPTO_STATIC_MEMORY
+PROJ_CFLAGS += -DCRYPTO_HEAP_SIZE=$(CRYPTO_HEAP_SIZE)
+WOLFCRYPT_CFLAGS += -DCRYPTO_STATIC_MEMORY
+endif
+
+# ****************** Link Time Optimization *******************
+# Uncomment to build and link with LTO, which lets gcc inline across
+# the messaging, crypto and wolfCrypt objects and drop more dead code.
+# Leave off when stepping through the firmware in a debugger.
+#LTO=1
+
+ifeq ($(LTO), 1)
+PROJ_CFLAGS += -flto
+PROJ_LDFLAGS += -flto
+endif
+
+# ****************** Key Rotation *******************
+# Uncomment to keep the device key in two flash pages instead of only in the
+# image, and answer the AP's REKEY command. The new key is stored before the
+# reply goes out under the old one, and a key of an older epoch is refused.
+# Not available with COMPONENT_KEYS. Must be set the same way for the AP and
+# every component.
+#KEY_ROTATION=1
+
+ifeq ($(KEY_ROTATION), 1)
+PROJ_CFLAGS += -DKEY_ROTATION
+endif
+
+# ****************** Flash Log *******************
+# Uncomment to keep post-boot data in an encrypted append-only log in flash
+# (flash_log.h), FLASH_LOG_PAGES pages at the bottom of the RESERVED region
+# of firmware.ld, written in turn so they wear evenly. secure_log_append
+# stores a record of up to FLASH_LOG_MAX_LEN bytes without touching the bus,
+# and with MSG_STREAM=1 secure_log_upload hands every record not taken yet to
+# the AP on a stream it reads.
+#FLASH_LOG=1
+FLASH_LOG_PAGES=4
+FLASH_LOG_MAX_LEN=256
+
+ifeq ($(FLASH_LOG), 1)
+PROJ_CFLAGS += -DFLASH_LOG -DFLASH_LOG_PAGES=$(FLASH_LOG_PAGES) -DFLASH_LOG_MAX_LEN=$(FLASH_LOG_MAX_LEN)
+PROJ_LDFLAGS += -Wl,--defsym=__flash_log_len=$(shell echo $$(($(FLASH_LOG_PAGES) * 0x2000)))
+endif
@@ -14,6 +14,198 @@
 #include <string.h>
 
 #include "board_link.h"
+#include "trace.h"
+#include "link_stats.h"
+#include "irq_events.h"
+#include "hotcold.h"
+#include "dma_copy.h"
+
+#ifdef BOARD_LINK_READY_GPIO
+/**
+ * @brief Drive the shared ready line
+ * 
+ * @param asserted: bool, true to pull the line low, false to release it
+ * 
+ * The line is open-drain: it is only ever driven low, and released by
+ * switching the pin back to an input so other components can still assert it
+*/
+static void ready_line_set(bool asserted) {
+    mxc_gpio_cfg_t ready_cfg;
+    ready_cfg.port = READY_GPIO_PORT;
+    ready_cfg.mask = READY_GPIO_PIN;
+    ready_cfg.pad = MXC_GPIO_PAD_NONE;
+    ready_cfg.vssel = MXC_GPIO_VSSEL_VDDIO;
+    ready_cfg.drvstr = MXC_GPIO_DRVSTR_0;
+    if (asserted) {
+        MXC_GPIO_OutClr(READY_GPIO_PORT, READY_GPIO_PIN);
+        ready_cfg.func = MXC_GPIO_FUNC_OUT;
+    } else {
+        ready_cfg.func = MXC_GPIO_FUNC_IN;
+    }
+    MXC_GPIO_Config(&ready_cfg);
+}
+#endif
+
+/**
+ * @brief Copy a packet into a free TRANSMIT bank and publish it, tx_publish of link_i2c
+ * 
+ * @param len: uint8_t, length of the packet
+ * @param packet: uint8_t*, packet to be sent
+*/
+HOT static void i2c_tx_publish(uint8_t len, uint8_t* packet) {
+    // Never the bank the AP may still be reading
+    int bank = i2c_simple_tx_bank();
+    TRANSMIT_BANK[bank].len = len;
+    dma_copy((void*)TRANSMIT_BANK[bank].data, (void*)packet, len);
+    i2c_simple_tx_publish();
+}
+
+/**
+ * @brief Copy out the packet in the RECEIVE bank, rx_take of link_i2c
+ * 
+ * @param packet: uint8_t*, buffer for the packet
+ * 
+ * @return uint8_t: length of the packet
+ * 
+ * The AP may already be writing the next packet into the other bank
+*/
+HOT static uint8_t i2c_rx_take(uint8_t* packet) {
+    int bank = i2c_simple_rx_bank();
+    uint8_t len = RECEIVE_BANK[bank].len;
+    dma_copy(packet, (void*)RECEIVE_BANK[bank].data, len);
+#ifndef STREAM_DECRYPT
+    // The messaging layer still needs what the ISR decrypted, it releases RECEIVE itself
+    i2c_simple_rx_release();
+#endif
+    return len;
+}
+
+// The register banks of simple_i2c_peripheral.h
+static const link_backend_t link_i2c = {
+    .tx_free = i2c_simple_tx_free,
+    .tx_idle = i2c_simple_tx_idle,
+    .tx_publish = i2c_tx_publish,
+    .tx_withdraw = i2c_simple_tx_withdraw,
+    .rx_ready = i2c_simple_rx_ready,
+    .rx_take = i2c_rx_take,
+    .rx_release = i2c_simple_rx_release,
+};
+
+#ifdef LINK_SPI
+/**
+ * @brief Nothing to release, spi_simple_rx_take frees the buffer
+*/
+static void spi_rx_release(void) {
+}
+
+// The exchanges of simple_spi_peripheral.h. A single buffer each way, so
+// free and idle are the same
+static const link_backend_t link_spi = {
+    .tx_free = spi_simple_tx_idle,
+    .tx_idle = spi_simple_tx_idle,
+    .tx_publish = spi_simple_tx_publish,
+    .tx_withdraw = spi_simple_tx_withdraw,
+    .rx_ready = spi_simple_rx_ready,
+    .rx_take = spi_simple_rx_take,
+    .rx_release = spi_rx_release,
+};
+#endif
+
+// Backend the last packet came from, answers go back over it
+static const link_backend_t* reply_link = &link_i2c;
+
+// Background work of waits, see board_link_set_idle
+static board_link_idle_t idle_work;
+#ifdef ADDR_ASSIGN
+// Handler of address assignments, see board_link_set_assign
+static board_link_assign_t assign_handler;
+#endif
+// Times the last wait_for woke up before its test passed, see link_stats.h
+static uint32_t wait_wakeups;
+
+#if BOARD_LINK_TIMED
+static volatile bool wait_expired;
+// Limit of receive waits, see board_link_set_recv_timeout
+static uint32_t recv_timeout_ms = BOARD_LINK_TIMEOUT_MS;
+
+/**
+ * @brief ISR for the wait timeout timer
+*/
+static void board_link_timer_isr(void) {
+    MXC_TMR_ClearFlags(BOARD_LINK_TIMER);
+    wait_expired = true;
+}
+
+/**
+ * @brief Arm the one-shot wait timeout
+ *
+ * @param timeout_ms: uint32_t, milliseconds until the wait ends
+*/
+static void wait_timer_start(uint32_t timeout_ms) {
+    mxc_tmr_cfg_t cfg;
+    cfg.pres = TMR_PRES_1;
+    cfg.mode = TMR_MODE_ONESHOT;
+    cfg.bitMode = MXC_TMR_BIT_32;
+    cfg.clock = MXC_TMR_8K_CLK;
+    cfg.cmp_cnt = (uint32_t) (((uint64_t) timeout_ms * BOARD_LINK_TIMER_HZ) / 1000);
+    cfg.pol = 0;
+
+    wait_expired = false;
+    MXC_TMR_Shutdown(BOARD_LINK_TIMER);
+    MXC_TMR_Init(BOARD_LINK_TIMER, &cfg, false);
+    MXC_TMR_ClearFlags(BOARD_LINK_TIMER);
+    MXC_TMR_EnableInt(BOARD_LINK_TIMER);
+    MXC_TMR_Start(BOARD_LINK_TIMER);
+}
+#endif
+
+/**
+ * @brief Sleep until bank state changed by the I2C ISR satisfies a test
+ *
+ * @param done: bool (*)(void), test on the bank state
+ * @param timeout_ms: uint32_t, longest wait in milliseconds, 0 waits forever
+ *
+ * @return bool: true if the test passed, false if the wait timed out
+ *
+ * Interrupts are masked while the state is tested, so one arriving between
+ * the test and the WFI leaves WFI pending and cannot be missed; it is
+ * serviced as soon as they are unmasked again.
+*/
+HOT static bool wait_for(bool (*done)(void), uint32_t timeout_ms) {
+#if BOARD_LINK_TIMED
+    wait_expired = false;
+    if (timeout_ms) {
+        wait_timer_start(timeout_ms);
+    }
+#else
+    (void)timeout_ms;
+#endif
+    // Get background work out of the way first, then sleep
+    if (idle_work != NULL) {
+        while (!done() && idle_work()) {
+        }
+    }
+    wait_wakeups = 0;
+    __disable_irq();
+    while (!done()) {
+#if BOARD_LINK_TIMED
+        if (wait_expired) {
+            break;
+        }
+#endif
+        __WFI();
+        __enable_irq();
+        __disable_irq();
+        wait_wakeups++;
+    }
+    __enable_irq();
+#if BOARD_LINK_TIMED
+    if (timeout_ms) {
+        MXC_TMR_Stop(BOARD_LINK_TIMER);
+    }
+#endif
+    return done();
+}
 
 /**
  * @brief Initialize the board link interface
@@ -25,9 +217,33 @@
  * Initialized the underlying i2c_simple interface
 */
 int board_link_init(i2c_addr_t addr) {
+#ifdef BOARD_LINK_READY_GPIO
+    // Start with the ready line released
+    ready_line_set(false);
+#endif
+#if BOARD_LINK_TIMED
+    MXC_NVIC_SetVector(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(BOARD_LINK_TIMER)), board_link_timer_isr);
+    NVIC_SetPriority(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(BOARD_LINK_TIMER)), IRQ_PRIO_LINK_TIMER);
+    NVIC_EnableIRQ(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(BOARD_LINK_TIMER)));
+#endif
+#ifdef LINK_SPI
+    int result = spi_simple_peripheral_init();
+    if (result != E_NO_ERROR) {
+        return result;
+    }
+#endif
     return i2c_simple_peripheral_init(addr);
 }
 
+#ifdef COMP_READY
+/**
+ * @brief Tell the AP we finished starting up
+*/
+void board_link_ready(void) {
+    i2c_simple_set_ready();
+}
+#endif
+
 /**
  * @brief Convert 4-byte component ID to I2C address
  * 
@@ -44,32 +260,260 @@ i2c_addr_t component_id_to_i2c_addr(uint32_t component_id) {
  * 
  * @param message: uint8_t*, message to be sent
  * 
- * This function utilizes the simple_i2c_peripheral library to
- * send a packet to the AP and wait for the message to be received
+ * @return int: SUCCESS_RETURN once the AP has read it, ERROR_RETURN if
+ * BOARD_LINK_TIMEOUT_MS passed first
+ *
+ * Goes out over the backend the last packet came from, and waits for the
+ * AP to read it there
 */
-void send_packet_and_ack(uint8_t len, uint8_t* packet) {
-    I2C_REGS[TRANSMIT_LEN][0] = len;
-    memcpy((void*)I2C_REGS[TRANSMIT], (void*)packet, len);
-    I2C_REGS[TRANSMIT_DONE][0] = false;
+HOT int send_packet_and_ack(uint8_t len, uint8_t* packet) {
+    TRACE_ENTER(TRACE_SEND_PACKET);
+    const link_backend_t* link = reply_link;
+    link->tx_publish(len, packet);
+
+#ifdef BOARD_LINK_READY_GPIO
+    // Tell the AP a packet is waiting
+    ready_line_set(true);
+#endif
 
     // Wait for ack from AP
-    while(!I2C_REGS[TRANSMIT_DONE][0]);
-    I2C_REGS[RECEIVE_DONE][0] = false;
+    int result = SUCCESS_RETURN;
+    if (!wait_for(link->tx_idle, BOARD_LINK_TIMEOUT_MS)) {
+        // Withdraw the packet so a late read finds nothing
+        link->tx_withdraw();
+        result = ERROR_RETURN;
+    } else {
+        STATS_INC(frames_sent);
+    }
+
+#ifdef BOARD_LINK_READY_GPIO
+    ready_line_set(false);
+#endif
+    TRACE_EXIT(TRACE_SEND_PACKET);
+    return result;
+}
+
+#ifdef MSG_PUBSUB
+/**
+ * @brief Hand a packet to the AP without waiting for it to be read
+ * 
+ * @param len: uint8_t, length of the packet
+ * @param packet: uint8_t*, packet to be sent
+ * 
+ * @return int: SUCCESS_RETURN once it is published, ERROR_RETURN if both
+ * TRANSMIT banks still hold unread packets
+ *
+ * The ready line stays asserted until send_queue_idle sees both banks read
+*/
+int send_packet_queued(uint8_t len, uint8_t* packet) {
+    if (!reply_link->tx_free()) {
+        return ERROR_RETURN;
+    }
+    reply_link->tx_publish(len, packet);
+    STATS_INC(frames_sent);
+
+#ifdef BOARD_LINK_READY_GPIO
+    ready_line_set(true);
+#endif
+    return SUCCESS_RETURN;
+}
+
+/**
+ * @brief Wait until send_packet_queued can take another packet
+ * 
+ * @return int: SUCCESS_RETURN once a bank is free, ERROR_RETURN if
+ * BOARD_LINK_TIMEOUT_MS passed first
+*/
+int send_queue_wait_free(void) {
+    return wait_for(reply_link->tx_free, BOARD_LINK_TIMEOUT_MS) ? SUCCESS_RETURN : ERROR_RETURN;
+}
+
+/**
+ * @brief Check whether the AP has read every queued packet
+ * 
+ * @return bool: true once both TRANSMIT banks are read, the ready line is
+ * released then
+*/
+bool send_queue_idle(void) {
+    if (!reply_link->tx_idle()) {
+        return false;
+    }
+#ifdef BOARD_LINK_READY_GPIO
+    ready_line_set(false);
+#endif
+    return true;
+}
+#endif
+
+/**
+ * @brief Check for a packet on any backend
+ * 
+ * @return bool: true once wait_and_receive_packet has one to take
+*/
+static bool rx_any_ready(void) {
+#ifdef LINK_SPI
+    if (spi_simple_rx_ready()) {
+        return true;
+    }
+#endif
+    return i2c_simple_rx_ready();
 }
 
+#ifdef ADDR_ASSIGN
+/**
+ * @brief Check for either an address assignment or a packet
+ * 
+ * @return bool: true once wait_and_receive_packet has something to take
+*/
+static bool rx_or_assign_ready(void) {
+    return i2c_simple_assign_ready() || rx_any_ready();
+}
+
+/**
+ * @brief Hand a pending address assignment to the handler
+ * 
+ * @return bool: true if the receive wait has to go on for its packet
+*/
+static bool assign_take(void) {
+    if (!i2c_simple_assign_ready()) {
+        return false;
+    }
+    uint8_t assign[I2C_ASSIGN_LEN];
+    int len = i2c_simple_take_assign(assign);
+    if (assign_handler != NULL) {
+        assign_handler(assign, len);
+    }
+    return !rx_any_ready();
+}
+#else
+#define rx_or_assign_ready rx_any_ready
+#define assign_take() false
+#endif
+
 /**
  * @brief Wait for a new message from AP and process the message
  * 
  * @param packet: uint8_t*, message received
  * 
+ * @return uint8_t: length of message received, 0 if BOARD_LINK_TIMEOUT_MS passed first
+ *
  * This function waits for a new message to be available from the AP,
  * once the message is available it is returned in the buffer pointer to by packet 
 */
-uint8_t wait_and_receive_packet(uint8_t* packet) {
-    while(!I2C_REGS[RECEIVE_DONE][0]);
+HOT uint8_t wait_and_receive_packet(uint8_t* packet) {
+    bool ready;
+    do {
+#if BOARD_LINK_TIMED
+        ready = wait_for(rx_or_assign_ready, recv_timeout_ms);
+#else
+        ready = wait_for(rx_or_assign_ready, 0);
+#endif
+    } while (ready && assign_take());
+    STATS_POLL(wait_wakeups);
+    if (!ready) {
+        return 0;
+    }
 
-    uint8_t len = I2C_REGS[RECEIVE_LEN][0];
-    memcpy(packet, (void*)I2C_REGS[RECEIVE], len);
+    // Only the copy out is traced, the wait above is idle time
+    TRACE_ENTER(TRACE_RECV_PACKET);
+#ifdef LINK_SPI
+    if (!i2c_simple_rx_ready()) {
+        reply_link = &link_spi;
+    } else if (reply_link == &link_spi) {
+        // Back on I2C, the AP gave up on whatever SPI exchange was under way
+        spi_simple_resync();
+        reply_link = &link_i2c;
+    }
+#endif
+    uint8_t len = reply_link->rx_take(packet);
+    TRACE_EXIT(TRACE_RECV_PACKET);
+    STATS_INC(frames_recv);
 
     return len;
 }
+
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Check for either a boot release or a packet
+ * 
+ * @return bool: true once there is something for wait_and_receive_release
+*/
+static bool release_or_packet_ready(void) {
+    return i2c_simple_release_ready() || rx_any_ready();
+}
+
+/**
+ * @brief Wait for the AP's boot release
+ * 
+ * @param release: uint8_t*, buffer of I2C_RELEASE_LEN bytes
+ * 
+ * @return uint8_t: length of the release, 0 if a packet arrived first or the
+ * receive timeout passed
+*/
+uint8_t wait_and_receive_release(uint8_t* release) {
+#if BOARD_LINK_TIMED
+    wait_for(release_or_packet_ready, recv_timeout_ms);
+#else
+    wait_for(release_or_packet_ready, 0);
+#endif
+    return (uint8_t) i2c_simple_take_release(release);
+}
+#endif
+
+/**
+ * @brief Limit how long wait_and_receive_packet waits
+ * 
+ * @param timeout_ms: uint32_t, milliseconds, 0 for BOARD_LINK_TIMEOUT_MS
+*/
+void board_link_set_recv_timeout(uint32_t timeout_ms) {
+#if BOARD_LINK_TIMED
+    recv_timeout_ms = timeout_ms ? timeout_ms : BOARD_LINK_TIMEOUT_MS;
+#else
+    (void)timeout_ms;
+#endif
+}
+
+/**
+ * @brief Set the background work waits run before sleeping
+ * 
+ * @param idle: board_link_idle_t, called until it returns 0 or the wait is
+ *     over, NULL for none
+*/
+void board_link_set_idle(board_link_idle_t idle) {
+    idle_work = idle;
+}
+
+#ifdef ADDR_ASSIGN
+/**
+ * @brief Set the handler of address assignments
+ * 
+ * @param assign: board_link_assign_t, called from wait_and_receive_packet
+ *     with every assignment written while it waits, NULL to drop them
+*/
+void board_link_set_assign(board_link_assign_t assign) {
+    assign_handler = assign;
+}
+#endif
+
+/**
+ * @brief Check why the last wait_and_receive_packet returned nothing
+ * 
+ * @return bool: true if it ran out of time, false if a packet arrived
+*/
+bool board_link_recv_timed_out(void) {
+#if BOARD_LINK_TIMED
+    return wait_expired && !rx_any_ready();
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Tell the AP the last packet has been taken
+ * 
+ * Frees its RECEIVE bank. The AP only waits for this once both banks are
+ * full, so it may send while we still work on the previous packet
+*/
+void release_receive_packet(void) {
+    reply_link->rx_release();
+}
@@ -1,70 +1,519 @@
 #include "comp_messaging.h"
 #include "board_link.h"
+#include "hotcold.h"
+#include "rv_keystream.h"
+#include "power_mark.h"
+#include "msg_schema.h"
+#if defined(COMPONENT_KEYS) || defined(BOOT_BROADCAST) || defined(SCAN_LIGHT)
+#include "ectf_params.h"
+#endif
+#ifdef MSG_TIMESYNC
+#include "time_sync.h"
+#endif
 
-msg_t transmit, receive;
-uint32_t prev_chal;
+#if defined(STREAM_DECRYPT) && (defined(MSG_AEAD) || defined(MSG_CTR))
+#error "STREAM_DECRYPT only applies to the AES-CBC framing"
+#endif
 
-void comp_transmit_and_ack()
+#ifdef STREAM_DECRYPT
+// CBC frames are block decrypted from the ISR while they arrive. The IV is at
+// the end of the frame, so only the block cipher can run early; the XOR with
+// the previous ciphertext block and the hash check are left for msg_open.
+typedef struct {
+    // Encrypted bytes in the frame being received
+    int enc_len;
+    // Bytes of it already run through the block cipher into ecb
+    int done;
+#ifdef MSG_CHANNEL
+    // Key epoch the blocks were decrypted under
+    uint32_t epoch;
+#endif
+    uint8_t ecb[MAX_MSG_LEN];
+} stream_state_t;
+
+static stream_state_t stream[I2C_RX_BANKS];
+
+// RECEIVE progress callback, runs in the I2C ISR. Every RECEIVE bank has its
+// own state, the AP may be writing one while msg_open still finishes the other
+static void stream_rx_progress(int bank, int written)
+{
+    stream_state_t *state = &stream[bank];
+    if (written == 0) {
+        // The AP sets RECEIVE_LEN before it writes the frame
+        int wire_len = RECEIVE_BANK[bank].len;
+        int plain_len = wire_len - MSG_TRAILER_LEN;
+        state->done = 0;
+#ifdef MSG_CHANNEL
+        state->epoch = crypto_key_epoch();
+#endif
+        state->enc_len = (wire_len < MIN_MSG_LEN) ? 0 :
+            ((plain_len + MSG_CHECK_LEN) / CBC_BLOCK_LEN) * CBC_BLOCK_LEN;
+        return;
+    }
+
+    while (state->done + CBC_BLOCK_LEN <= written && state->done < state->enc_len) {
+        aes_decrypt_block((const uint8_t*)&RECEIVE_BANK[bank].data[state->done], &state->ecb[state->done]);
+        state->done += CBC_BLOCK_LEN;
+    }
+}
+
+// Finishes CBC decryption of enc_len bytes of wire in place, using the blocks
+// the ISR already decrypted. Falls back to a plain decrypt if the streamed
+// frame does not match the one being opened, or the key was switched since it
+// started arriving.
+static void stream_finish(uint8_t *wire, uint8_t *iv, int enc_len)
 {
-    //gen new challenge, and answer old challenge
-    transmit.rng_resp = receive.rng_chal + 1;
-    transmit.rng_chal= (uint32_t) (rng_gen() >> 32);
+    // The bank wire was copied from is only released after this
+    stream_state_t *state = &stream[i2c_simple_rx_bank()];
+    int stale = (state->enc_len != enc_len);
+#ifdef MSG_CHANNEL
+    stale |= (state->epoch != crypto_key_epoch());
+#endif
+    if (stale) {
+        aes_decrypt(wire, wire, iv, enc_len);
+        return;
+    }
 
-    prev_chal = transmit.rng_chal;
-    
-    //gen iv
-    uint64_t randValue;
-    randValue = rng_gen();
-    memcpy(&transmit.iv[0], &randValue, sizeof(randValue));
+    // Blocks that arrived in the last FIFO read or were moved by DMA
+    for (int i = state->done; i < enc_len; i += CBC_BLOCK_LEN) {
+        aes_decrypt_block(&wire[i], &state->ecb[i]);
+    }
 
-    randValue = rng_gen();
-    memcpy(&transmit.iv[8], &randValue, sizeof(randValue));
+    // Walk backwards so each block still sees the previous ciphertext block
+    for (int i = enc_len - CBC_BLOCK_LEN; i >= 0; i -= CBC_BLOCK_LEN) {
+        uint8_t *prev = (i == 0) ? iv : &wire[i - CBC_BLOCK_LEN];
+        for (int j = 0; j < CBC_BLOCK_LEN; j++) {
+            wire[i + j] = state->ecb[i + j] ^ prev[j];
+        }
+    }
 
-    //gen hash
-    hash((uint8_t*)&transmit, transmit.hash, ENC_LEN - 17);
+    memset(state->ecb, 0, enc_len);
+    state->enc_len = 0;
+    state->done = 0;
+}
+#endif
+
+#ifdef MSG_PUBSUB
+#ifndef COMP_OUTBOX_LEN
+#define COMP_OUTBOX_LEN 4
+#endif
 
-    // Encrypt from rng_chal to contents
-    uint8_t encryptedData[ENC_LEN];
-    aes_encrypt((uint8_t*)&transmit, encryptedData, transmit.iv, ENC_LEN);
-    // Assuming you want to overwrite the original with encrypted data
-    memcpy((uint8_t*)&transmit, encryptedData, ENC_LEN);
+// Sealed frames waiting for a free TRANSMIT bank, oldest at outbox_head
+static struct {
+    uint8_t len;
+    uint8_t frame[MAX_MSG_LEN];
+} outbox[COMP_OUTBOX_LEN];
+static unsigned outbox_head;
+static unsigned outbox_cnt;
 
-    //send packet
-    send_packet_and_ack(sizeof(msg_t), (uint8_t*)&transmit);
+int comp_outbox_flush(int wait)
+{
+    while (outbox_cnt > 0) {
+        if (send_packet_queued(outbox[outbox_head].len, outbox[outbox_head].frame) != SUCCESS_RETURN) {
+            if (!wait || send_queue_wait_free() != SUCCESS_RETURN) {
+                break;
+            }
+            continue;
+        }
+        outbox_head = (outbox_head + 1) % COMP_OUTBOX_LEN;
+        outbox_cnt--;
+    }
+    send_queue_idle();
+    return outbox_cnt;
 }
+#endif
 
-int comp_wait_recv(int first)
+// send_packet_and_ack waits until the AP has read the frame. Queued frames
+// carry older sequence numbers, so they go first
+HOT static int comp_send(uint8_t peer, uint8_t len, uint8_t *frame)
 {
-    //poll for incoming packet
-    int len = wait_and_receive_packet((uint8_t*)&receive);
-    if (len != sizeof(msg_t)) {
+    (void)peer;
+#ifdef MSG_PUBSUB
+    if (comp_outbox_flush(1) != 0) {
         return COMP_MESSAGE_ERROR;
     }
+#endif
+    return send_packet_and_ack(len, frame) == SUCCESS_RETURN ? COMP_MESSAGE_SUCCESS : COMP_MESSAGE_ERROR;
+}
 
-    // decrypt packet
-    uint8_t decryptedData[ENC_LEN];
-    aes_decrypt((uint8_t*)&receive, decryptedData, receive.iv, ENC_LEN);
-    memcpy((uint8_t*)&receive, decryptedData, ENC_LEN);
+#ifdef SCAN_LIGHT
+// Answers a light scan request, see msg_core.h. No frame is opened or sealed
+static void comp_scan_reply(const uint8_t *request)
+{
+    uint8_t reply[MSG_SCAN_REPLY_LEN];
+    uint32_t id = COMPONENT_ID;
+    memcpy(reply, &id, sizeof(id));
+    int result = msg_scan_mac(&request[1], component_id_to_i2c_addr(COMPONENT_ID), id, &reply[sizeof(id)]);
+#ifdef STREAM_DECRYPT
+    // The request is used up, RECEIVE can take the next packet
+    release_receive_packet();
+#endif
+    if (result == MSG_SUCCESS) {
+        comp_send(0, MSG_SCAN_REPLY_LEN, reply);
+    }
+}
+#endif
 
-    // verify hash
-    uint8_t computedHash[HASH_LEN];
-    hash((uint8_t*)&receive, computedHash, ENC_LEN - 17);
-    if (memcmp(receive.hash, computedHash, HASH_LEN) != 0) {
-        return COMP_MESSAGE_ERROR; // Hash mismatch
+HOT static int comp_recv(uint8_t peer, uint8_t *buf)
+{
+    (void)peer;
+#ifdef SCAN_LIGHT
+    // Light scans are answered here and never reach the messaging engine
+    int len;
+    while ((len = wait_and_receive_packet(buf)) == MSG_SCAN_REQ_LEN && buf[0] == MSG_SCAN_TAG) {
+        comp_scan_reply(buf);
     }
+    return len;
+#else
+    return wait_and_receive_packet(buf);
+#endif
+}
+
+// Frames only ever go to and come from the AP
+static const msg_transport_t comp_link = {
+    .send = comp_send,
+    .recv = comp_recv,
+    .wait_free = NULL,
+#ifdef STREAM_DECRYPT
+    // The ISR has done most of the decryption, RECEIVE is released once it is finished
+    .decrypt = stream_finish,
+    .release = release_receive_packet,
+#else
+    .decrypt = NULL,
+    .release = NULL,
+#endif
+    .headroom = 0,
+    .role = MSG_ROLE_COMP,
+};
+
+HOT void comp_transmit_and_ack()
+{
+    POWER_ENTER(POWER_TRANSMIT);
+    msg_transmit(&comp_link, 0);
+    POWER_EXIT(POWER_TRANSMIT);
+}
+
+// The reply's random values are drawn while the AP is still on its way
+HOT int comp_wait_recv(int first)
+{
+    msg_prepare();
+    return msg_recv(&comp_link, 0, first);
+}
 
-    // check challenge response
-    if (!first && (receive.rng_resp != (prev_chal + 1))) {
-        return COMP_MESSAGE_ERROR; // Challenge-response mismatch
+int comp_answers_boot()
+{
+    return receive.opcode == COMPONENT_CMD_BOOT && msg_answers_prev();
+}
+
+#ifdef BOOT_BROADCAST
+typedef char release_tag_fits_t[(I2C_RELEASE_TAG_LEN == MSG_RELEASE_TAG_LEN) ? 1 : -1];
+
+// The tag is ready before the wait, so taking the release is only a compare
+int comp_wait_release()
+{
+    uint8_t addr = component_id_to_i2c_addr(COMPONENT_ID);
+    uint8_t tag[MSG_RELEASE_TAG_LEN];
+    uint8_t release[I2C_RELEASE_LEN];
+    int result = COMP_MESSAGE_ERROR;
+
+    if (msg_release_tag(&comp_link, addr, tag) != MSG_SUCCESS) {
+        return COMP_MESSAGE_ERROR;
     }
+    // A release without our entry, e.g. a stale one, does not end the wait
+    while (result != COMP_MESSAGE_SUCCESS) {
+        int len = wait_and_receive_release(release);
+        if (len == 0) {
+            break;
+        }
+        for (int i = 0; i + I2C_RELEASE_ENTRY_LEN <= len; i += I2C_RELEASE_ENTRY_LEN) {
+            if (release[i] == addr && !secure_memcmp(&release[i + 1], tag, MSG_RELEASE_TAG_LEN)) {
+                result = COMP_MESSAGE_SUCCESS;
+            }
+        }
+    }
+    memset(tag, 0, sizeof(tag));
+    return result;
+}
+#endif
+
+#ifdef ADDR_ASSIGN
+typedef char assign_tag_fits_t[(I2C_ASSIGN_TAG_LEN == MSG_ASSIGN_TAG_LEN) ? 1 : -1];
+
+// Sequence number of the last assignment we took, 0 for none since reset
+static uint32_t assign_seq;
 
-    // if all checks pass
+// Moves us to the address of our entry in an assignment. Entries go by the
+// whole ID, so components sharing the address their ID maps to are told
+// apart. Keys and MACs stay bound to that home address. Only an assignment
+// numbered above the last one we took counts, so none can be replayed
+static void comp_addr_assign(const uint8_t *assign, int len)
+{
+    uint32_t id = COMPONENT_ID;
+    uint32_t seq;
+    uint8_t tag[MSG_ASSIGN_TAG_LEN];
+
+    if (len < I2C_ASSIGN_SEQ_LEN) {
+        return;
+    }
+    memcpy(&seq, assign, sizeof(seq));
+    if (seq <= assign_seq) {
+        return;
+    }
+
+    // Addresses the I2C spec reserves (below 0x08, from 0x78) are never taken
+    for (int i = I2C_ASSIGN_SEQ_LEN; i + I2C_ASSIGN_ENTRY_LEN <= len; i += I2C_ASSIGN_ENTRY_LEN) {
+        uint8_t addr = assign[i + sizeof(id)];
+        if (memcmp(&assign[i], &id, sizeof(id)) != 0 || addr < 0x08 || addr >= 0x78) {
+            continue;
+        }
+        if (msg_assign_tag(seq, id, addr, tag) == MSG_SUCCESS &&
+            !secure_memcmp(&assign[i + sizeof(id) + 1], tag, MSG_ASSIGN_TAG_LEN)) {
+            assign_seq = seq;
+            i2c_simple_set_addr(addr);
+        }
+        break;
+    }
+    memset(tag, 0, sizeof(tag));
+}
+#endif
+
+#ifdef MSG_CHANNEL
+void msg_channel_open(msg_channel_t *channel)
+{
+    msg_channel_derive(&comp_link, channel);
+}
+
+int comp_channel_transmit_and_ack(msg_channel_t *channel)
+{
+    return msg_channel_transmit(&comp_link, channel, 0);
+}
+
+#if defined(MSG_HEARTBEAT) || defined(MSG_TIMESYNC)
+// Whether receive is one of the frames answered from inside the channel receive
+static int comp_channel_service(void)
+{
+#ifdef MSG_HEARTBEAT
+    if (receive.opcode == MSG_OPCODE_HEARTBEAT) {
+        return 1;
+    }
+#endif
+#ifdef MSG_TIMESYNC
+    if (receive.opcode == MSG_OPCODE_TIMESYNC) {
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+// Answers the frame in receive, rx_at is when it came in on our clock
+static int comp_channel_answer(msg_channel_t *channel, uint64_t rx_at)
+{
+    (void)rx_at;
+#ifdef MSG_TIMESYNC
+    if (receive.opcode == MSG_OPCODE_TIMESYNC) {
+        msg_timesync_t sync;
+        if (receive.len != sizeof(sync)) {
+            return COMP_MESSAGE_SUCCESS;
+        }
+        memcpy(&sync, receive.contents, sizeof(sync));
+        if (sync.step == TIME_SYNC_SET) {
+            time_sync_apply((int64_t)sync.a, sync.b);
+            return COMP_MESSAGE_SUCCESS;
+        }
+        if (sync.step != TIME_SYNC_PING) {
+            return COMP_MESSAGE_SUCCESS;
+        }
+        sync.step = TIME_SYNC_PONG;
+        sync.a = rx_at;
+        transmit.opcode = MSG_OPCODE_TIMESYNC;
+        transmit.len = sizeof(sync);
+        // Taken as late as it can be, the sealing is on the AP's side of t3
+        sync.b = time_local_us();
+        memcpy(transmit.contents, &sync, sizeof(sync));
+        return comp_channel_transmit_and_ack(channel);
+    }
+#endif
+    transmit.opcode = receive.opcode;
+    transmit.len = 0;
+    return comp_channel_transmit_and_ack(channel);
+}
+#endif
+
+int comp_channel_wait_recv(msg_channel_t *channel)
+{
+    msg_prepare();
+#if defined(MSG_HEARTBEAT) || defined(MSG_TIMESYNC)
+    // Heartbeats and time sync are answered here and never reach the post-boot code
+    int result;
+    while ((result = msg_channel_recv(&comp_link, channel, 0)) == COMP_MESSAGE_SUCCESS &&
+           comp_channel_service()) {
+        uint64_t rx_at = 0;
+#ifdef MSG_TIMESYNC
+        rx_at = time_local_us();
+#endif
+        if (comp_channel_answer(channel, rx_at) != COMP_MESSAGE_SUCCESS) {
+            return COMP_MESSAGE_ERROR;
+        }
+        msg_prepare();
+    }
+    return result;
+#else
+    return msg_channel_recv(&comp_link, channel, 0);
+#endif
+}
+#endif
+
+#ifdef MSG_PUBSUB
+// Seals into the outbox instead of a TRANSMIT bank
+static int outbox_send(uint8_t peer, uint8_t len, uint8_t *frame)
+{
+    (void)peer;
+    unsigned slot = (outbox_head + outbox_cnt) % COMP_OUTBOX_LEN;
+    outbox[slot].len = len;
+    memcpy(outbox[slot].frame, frame, len);
+    outbox_cnt++;
+    return COMP_MESSAGE_SUCCESS;
+}
+
+static const msg_transport_t outbox_link = {
+    .send = outbox_send,
+    .recv = comp_recv,
+    .wait_free = NULL,
+    .decrypt = NULL,
+    .release = NULL,
+    .headroom = 0,
+    .role = MSG_ROLE_COMP,
+};
+
+int comp_channel_queue(msg_channel_t *channel)
+{
+    // Checked first so a full outbox does not use up a sequence number
+    if (outbox_cnt == COMP_OUTBOX_LEN) {
+        return COMP_MESSAGE_ERROR;
+    }
+    if (msg_channel_transmit(&outbox_link, channel, 0) != MSG_SUCCESS) {
+        return COMP_MESSAGE_ERROR;
+    }
+    comp_outbox_flush(0);
+    return COMP_MESSAGE_SUCCESS;
+}
+#endif
+
+#ifdef MSG_STREAM
+int comp_stream_accept(msg_stream_t *stream, msg_channel_t *channel)
+{
+    memset(stream, 0, sizeof(msg_stream_t));
+
+    if (channel != NULL && channel->ready) {
+        stream->channel = channel;
+        if (comp_channel_wait_recv(channel) != COMP_MESSAGE_SUCCESS) {
+            return COMP_MESSAGE_ERROR;
+        }
+    }
+    else if (comp_wait_recv(1) != COMP_MESSAGE_SUCCESS) {
+        return COMP_MESSAGE_ERROR;
+    }
+    if (receive.opcode != MSG_OPCODE_STREAM_OPEN || receive.len != 1) {
+        return COMP_MESSAGE_ERROR;
+    }
+    // The AP says which way it sends
+    uint8_t mode = receive.contents[0];
+#ifdef MSG_STREAM_LZ
+    stream->compress = (mode & MSG_STREAM_COMPRESS) != 0;
+    mode &= ~MSG_STREAM_COMPRESS;
+#endif
+    stream->writer = (mode == MSG_STREAM_AP_READS);
+
+    transmit.opcode = MSG_OPCODE_STREAM_ACK;
+    transmit.len = 0;
+    if (stream->channel != NULL) {
+        return comp_channel_transmit_and_ack(stream->channel);
+    }
+
+    // Answer the AP's challenge, both challenges key the stream
+    comp_transmit_and_ack();
+    msg_channel_open(&stream->own);
+    if (!stream->own.ready) {
+        msg_channel_close(&stream->own);
+        return COMP_MESSAGE_ERROR;
+    }
+    stream->channel = &stream->own;
     return COMP_MESSAGE_SUCCESS;
 }
 
-void reset_msg()
+int comp_stream_write(msg_stream_t *stream, const uint8_t *buf, int len)
 {
-    memset(&transmit, 0, sizeof(msg_t));
-    memset(&receive, 0, sizeof(msg_t));
-    prev_chal = 0;
+    return msg_stream_write(&comp_link, stream, 0, buf, len);
+}
+
+int comp_stream_read(msg_stream_t *stream, uint8_t *buf, int len)
+{
+    return msg_stream_read(&comp_link, stream, 0, buf, len);
+}
+
+int comp_stream_close(msg_stream_t *stream)
+{
+    return msg_stream_close(&comp_link, stream, 0);
+}
+#endif
+
+#ifdef MSG_JUMBO
+int comp_jumbo_send(msg_channel_t *channel, const uint8_t *buf, int len)
+{
+    return msg_jumbo_send(&comp_link, channel, 0, buf, len);
+}
+
+int comp_jumbo_recv(msg_channel_t *channel, uint8_t *buf, int maxlen)
+{
+    return msg_jumbo_recv(&comp_link, channel, 0, buf, maxlen);
+}
+#endif
+
+#ifdef COMPONENT_ENROLL
+// Our key pair half, certificate and the AP's public key from ectf_params.h,
+// see crypto_util.h
+static const uint8_t enroll_priv[ENROLL_PRIV_LEN] = ENROLL_PRIV;
+static const uint8_t enroll_peer_pub[ENROLL_PUB_LEN] = ENROLL_PEER_PUB;
+static const uint8_t enroll_cert[ENROLL_CERT_LEN] = ENROLL_CERT;
+
+typedef char enroll_cert_fits_t[(I2C_ENROLL_CERT_LEN == ENROLL_CERT_LEN) ? 1 : -1];
+#endif
+
+void comp_messaging_init()
+{
+#ifdef COMPONENT_ENROLL
+    // The AP reads the certificate and runs the same ECDH from its side
+    i2c_simple_set_enroll_cert(enroll_cert);
+#ifdef ENROLL_RESUME
+    // Our ECDH secret never changes, so it is only computed on the first boot
+    uint8_t cert_hash[HASH_LEN];
+    uint8_t secret[ENROLL_SECRET_LEN];
+    hash((uint8_t *)enroll_cert, cert_hash, ENROLL_CERT_LEN);
+    if (comp_resume_load(cert_hash, secret) != COMP_MESSAGE_SUCCESS &&
+        crypto_enroll_secret(enroll_priv, enroll_peer_pub, secret) == 0) {
+        comp_resume_save(cert_hash, secret);
+    }
+    crypto_enroll_resume(component_id_to_i2c_addr(COMPONENT_ID), secret);
+    memset(secret, 0, sizeof(secret));
+#else
+    crypto_enroll(component_id_to_i2c_addr(COMPONENT_ID), enroll_priv, enroll_peer_pub);
+#endif
+#elif defined(COMPONENT_KEYS)
+    // Derived once, the AP derives the same key from our address
+    crypto_use_component_key(component_id_to_i2c_addr(COMPONENT_ID));
+#endif
+#ifdef STREAM_DECRYPT
+    i2c_simple_set_rx_callback(stream_rx_progress);
+#endif
+#ifdef RISCV_KEYSTREAM
+    rv_keystream_start();
+#endif
+#ifdef MSG_CTR
+    // Keystream for the next reply is made while waiting for the AP
+    board_link_set_idle(ctr_pool_fill);
+#endif
+#ifdef ADDR_ASSIGN
+    // We start on our home address until the AP assigns us one
+    board_link_set_assign(comp_addr_assign);
+#endif
 }
@@ -29,6 +29,26 @@
 #include "global_secrets.h"
 
 #include "comp_messaging.h"
+#include "msg_schema.h"
+#include "time_sync.h"
+#include "msg_pool.h"
+#include "trace.h"
+#include "bench.h"
+#include "selftest.h"
+#include "ctcheck.h"
+#include "stack_profile.h"
+#include "irq_events.h"
+#include "hotcold.h"
+#include "dma_copy.h"
+#if defined(ENROLL_RESUME) || defined(KEY_ROTATION) || defined(FLASH_LOG)
+#include "simple_flash.h"
+#endif
+#ifdef FLASH_LOG
+#include "flash_log.h"
+#endif
+#ifdef KEY_ROTATION
+#include "key_store.h"
+#endif
 
 #ifdef POST_BOOT
 #include "led.h"
@@ -37,41 +57,150 @@
 #include <string.h>
 #endif
 
+/********************************* CONSTANTS **********************************/
+#ifdef ENROLL_RESUME
+// The top page of RESERVED, under ROM_BL_PAGE, holds the resumption
+// secret, see comp_resume_load:
+// iv | cert_hash | secret | hash, everything after the iv encrypted under
+// the device key
+#define RESUME_FLASH_ADDR ((MXC_FLASH_MEM_BASE + MXC_FLASH_MEM_SIZE) - 2 * MXC_FLASH_PAGE_SIZE)
+#define RESUME_DATA_LEN (HASH_LEN + ENROLL_SECRET_LEN)
+#define RESUME_RECORD_LEN (IV_LEN + RESUME_DATA_LEN + HASH_LEN)
+#endif
+#ifdef KEY_ROTATION
+// The pages below the resumption page hold the device key, see key_store.h
+#define KEY_STORE_ADDR ((MXC_FLASH_MEM_BASE + MXC_FLASH_MEM_SIZE) - (2 + KEY_STORE_PAGES) * MXC_FLASH_PAGE_SIZE)
+#endif
+
 /******************************** TYPE DEFINITIONS ********************************/
-// Commands received by Component using 32 bit integer
+// Where we are in a multi-frame exchange with the AP. Every frame is received
+// as a possible new command and only carries an exchange on if it answers
+// our last challenge, so the AP can abandon an exchange at any point and be
+// served right away, see component_process_frame
 typedef enum {
-    COMPONENT_CMD_NONE,
-    COMPONENT_CMD_SCAN,
-    COMPONENT_CMD_VALIDATE,
-    COMPONENT_CMD_BOOT,
-    COMPONENT_CMD_ATTEST
-} component_cmd_t;
+    COMP_STATE_IDLE,            // Waiting for a command
+    COMP_STATE_VALIDATE_PROOF,  // Answered VALIDATE, waiting for the AP's proof
+    COMP_STATE_VALIDATE_BOOT,   // Sent our ID, waiting for the boot result
+#ifdef VALIDATE_RESUME
+    COMP_STATE_HOLD,            // Validated, held for the AP's next boot attempt
+#endif
+    COMP_STATE_ATTEST_PROOF,    // Answered ATTEST, waiting for the AP's proof
+    COMP_STATE_ATTEST_MORE,     // Sent a slice of attestation data, more to go
+} comp_state_t;
 
 
 /********************************* FUNCTION DECLARATIONS **********************************/
 // Core function definitions
+void component_process_frame(int result);
 void component_process_cmd(void);
+static void put_id(uint32_t id);
 void process_scan(void);
 void process_validate(void);
+void process_validate_proof(void);
+void process_boot(void);
 void process_attest(void);
+void process_attest_proof(void);
+void process_attest_slice(void);
+#ifdef LINK_STATS
+void process_stats(void);
+#endif
+#ifdef LAT_HIST
+void process_hist(void);
+#endif
+#ifdef KEY_ROTATION
+void process_rekey(void);
+#endif
+
+// Optional limit on how long the AP may take between the frames of an
+// exchange (COMP_SESSION_TIMEOUT_MS in project.mk). An exchange left
+// waiting that long is dropped. Holds are kept until the next command.
+#ifndef COMP_SESSION_TIMEOUT_MS
+#define COMP_SESSION_TIMEOUT_MS 0
+#endif
+
+// Optional limit on invalid frames in a row before they go unanswered and
+// each is followed by a backoff (COMP_REJECT_AFTER and COMP_REJECT_BACKOFF_MS
+// in project.mk). The I2C target never learns who wrote a frame, so the
+// count is for the link as a whole.
+#ifndef COMP_REJECT_AFTER
+#define COMP_REJECT_AFTER 0
+#endif
 
 /********************************* GLOBAL VARIABLES **********************************/
 // Global messaging strucs from comp_messaging.c
 extern msg_t transmit;
 extern msg_t receive;
 
+// Exchange in progress, see comp_state_t
+static comp_state_t comp_state = COMP_STATE_IDLE;
+
+#ifdef LAT_HIST
+// Time spent in the handler of each opcode, see lat_hist.h
+static lat_hist_t cmd_hists[COMPONENT_CMD_COUNT];
+#endif
+
+#if COMP_REJECT_AFTER > 0
+// Invalid frames since the last valid one
+static uint32_t invalid_frames;
+#endif
+
+#ifdef ATTEST_SEALED
+#ifndef ATTEST_BLOB
+#error "ATTEST_SEALED needs ATTEST_BLOB in ectf_params.h, see build_comp.py"
+#endif
+// Attestation data sealed by build_comp.py, see msg_attest_open. Only the
+// AP opens it, the plain fields never make it into the image
+static const uint8_t attest_data[ATTEST_BLOB_LEN] = ATTEST_BLOB;
+static const unsigned attest_len = ATTEST_BLOB_LEN;
+typedef char attest_blob_len_t[(ATTEST_BLOB_LEN <= ATTEST_WIRE_LEN) ? 1 : -1];
+#else
+// Encoded attestation data, kept from the first attest on
+static uint8_t attest_data[ATTEST_DATA_LEN];
+static unsigned attest_len;
+#endif
+// How much of the attestation data the AP has, see msg_attest_t
+static unsigned attest_sent;
+
+#ifdef POST_BOOT_SESSION
+// Post-boot channel to the AP, opened once our boot message is sent
+msg_channel_t post_boot_channel;
+#endif
+
+#ifdef KEY_ROTATION
+// Device key we run under and its epoch, as kept in flash
+static key_store_t key_store;
+#endif
+
 /******************************* POST BOOT FUNCTIONALITY *********************************/
 /**
- * @brief Secure Send 
+ * @brief Secure Send Vector
  * 
- * @param buffer: uint8_t*, pointer to data to be send
- * @param len: uint8_t, size of data to be sent 
+ * @param frags: const msg_record_t*, fragments of the data, sent one after another
+ * @param n: int, number of fragments
  * 
- * Securely send data over I2C. This function is utilized in POST_BOOT functionality.
- * This function must be implemented by your team to align with the security requirements.
+ * @return int: 0 if the message was sent, negative if error or the fragments
+ * add up to more than MSG_RECORD_MAX_LEN bytes
+ * 
+ * Like secure_send, but gathers the fragments straight into the frame, so a
+ * header and a payload kept apart need no staging buffer
 */
-void secure_send(uint8_t* buffer, uint8_t len) {
+int secure_sendv(const msg_record_t* frags, int n) {
+    // The receiver drops longer bodies, so do not start a handshake for one
+    if (msg_gather_len(frags, n) > MSG_RECORD_MAX_LEN) {
+        return -1;
+    }
+
     reset_msg();
+
+#ifdef POST_BOOT_SESSION
+    // A single frame on the post-boot channel, no handshake
+    if (post_boot_channel.ready) {
+        if (msg_gather(frags, n) < 0) {
+            return -1;
+        }
+        return comp_channel_transmit_and_ack(&post_boot_channel) == COMP_MESSAGE_SUCCESS ? 0 : -1;
+    }
+#endif
     
     // Initiate handshake
     comp_transmit_and_ack();
@@ -79,16 +208,86 @@ void secure_send(uint8_t* buffer, uint8_t len) {
     // Receive next part of handshake
     int result = comp_wait_recv(0);
     if (result != COMP_MESSAGE_SUCCESS) {
-        return;
+        return -1;
     }
 
     // If everything passes up to this point, actually send the message
-    // First byte of transmit.contents is len, then transmit.contents[1..] holds
-    // the actual message
-    transmit.contents[0] = len;
-    memcpy(&(transmit.contents[1]), buffer, len);
+    if (msg_gather(frags, n) < 0) {
+        return -1;
+    }
 
     comp_transmit_and_ack();
+    return 0;
+}
+
+/**
+ * @brief Secure Send 
+ * 
+ * @param buffer: uint8_t*, pointer to data to be send
+ * @param len: uint8_t, size of data to be sent 
+ * 
+ * Securely send data over I2C. This function is utilized in POST_BOOT functionality.
+ * This function must be implemented by your team to align with the security requirements.
+*/
+void secure_send(uint8_t* buffer, uint8_t len) {
+    msg_record_t frag = { buffer, len };
+    secure_sendv(&frag, 1);
+}
+
+/**
+ * @brief Secure Receive View
+ * 
+ * @param data: const uint8_t**, set to the data inside the decrypted frame
+ * 
+ * @return int: number of bytes received, negative if error
+ * 
+ * Like secure_receive without the copy. The data stays valid until the next
+ * post-boot call or secure_receive_release, whichever comes first.
+*/
+int secure_receive_view(const uint8_t** data) {
+    reset_msg();
+
+    int result;
+#ifdef POST_BOOT_SESSION
+    // A single frame on the post-boot channel, no handshake
+    if (post_boot_channel.ready) {
+        result = comp_channel_wait_recv(&post_boot_channel);
+    } else
+#endif
+    {
+        // Receive first part, don't check rng challenge 
+        result = comp_wait_recv(1);
+        if (result != COMP_MESSAGE_SUCCESS) {
+            return -1;
+        }
+
+        // Send second half of handshake
+        comp_transmit_and_ack();
+
+        // Receive last part of handshake, which includes the message
+        result = comp_wait_recv(0);
+    }
+    if (result != COMP_MESSAGE_SUCCESS) {
+        return -1;
+    }
+    
+    msg_post_boot_t* post = MSG_BODY(receive, msg_post_boot_t);
+    // Cap length according to detailed specifications
+    if (post->len > 64) {
+        return -1;
+    }
+
+    *data = post->data;
+    return post->len;
+}
+
+/**
+ * @brief Secure Receive Release
+ * 
+ * Wipes the frame a secure_receive_view pointed into
+*/
+void secure_receive_release(void) {
+    reset_msg();
 }
 
 /**
@@ -102,39 +301,344 @@ void secure_send(uint8_t* buffer, uint8_t len) {
  * This function must be implemented by your team to align with the security requirements.
 */
 int secure_receive(uint8_t* buffer) {
+    const uint8_t* data;
+    int len = secure_receive_view(&data);
+    if (len < 0) {
+        return -1;
+    }
+
+    memcpy(buffer, data, len);
+    return len;
+}
+
+/**
+ * @brief Secure Send Batch
+ * 
+ * @param records: msg_record_t*, records to be sent, each at most MSG_RECORD_MAX_LEN bytes
+ * @param n: int, number of records
+ * 
+ * @return int: number of records sent, negative if error
+ * 
+ * Like secure_send, but packs as many records as fit into one frame so they
+ * share a single handshake. Send whatever is left over with another call.
+*/
+int secure_send_batch(const msg_record_t* records, int n) {
     reset_msg();
 
-    // Receive first part, don't check rng challenge 
-    int result = comp_wait_recv(1);
-    if (result != COMP_MESSAGE_SUCCESS) {
+#ifdef POST_BOOT_SESSION
+    // A single frame on the post-boot channel, no handshake
+    if (post_boot_channel.ready) {
+        int count = msg_pack_records(records, n);
+        if (count < 0 || comp_channel_transmit_and_ack(&post_boot_channel) != COMP_MESSAGE_SUCCESS) {
+            return -1;
+        }
+        return count;
+    }
+#endif
+
+    // Initiate handshake
+    comp_transmit_and_ack();
+
+    // Receive next part of handshake
+    if (comp_wait_recv(0) != COMP_MESSAGE_SUCCESS) {
+        return -1;
+    }
+
+    int count = msg_pack_records(records, n);
+    if (count < 0) {
+        return -1;
+    }
+
+    comp_transmit_and_ack();
+    return count;
+}
+
+/**
+ * @brief Secure Receive Batch
+ * 
+ * @param records: msg_record_t*, records to receive into, each buf holds MSG_RECORD_MAX_LEN bytes
+ * @param n: int, number of records available
+ * 
+ * @return int: number of records received, negative if error
+ * 
+ * Receives a frame sent with secure_send_batch
+*/
+int secure_receive_batch(msg_record_t* records, int n) {
+    reset_msg();
+
+#ifdef POST_BOOT_SESSION
+    // A single frame on the post-boot channel, no handshake
+    if (post_boot_channel.ready) {
+        if (comp_channel_wait_recv(&post_boot_channel) != COMP_MESSAGE_SUCCESS) {
+            return -1;
+        }
+        return msg_unpack_records(records, n);
+    }
+#endif
+
+    // Receive first part, don't check rng challenge
+    if (comp_wait_recv(1) != COMP_MESSAGE_SUCCESS) {
         return -1;
     }
 
     // Send second half of handshake
     comp_transmit_and_ack();
 
-    // Receive last part of handshake, which includes the message
-    result = comp_wait_recv(0);
-    if (result != COMP_MESSAGE_SUCCESS) {
+    // Receive last part of handshake, which includes the records
+    if (comp_wait_recv(0) != COMP_MESSAGE_SUCCESS) {
         return -1;
     }
-    
-    // Length is at first byte of contents
-    uint8_t len = receive.contents[0];
-    // Cap length according to detailed specifications
-    if (len > 64) {
+
+    return msg_unpack_records(records, n);
+}
+
+#ifdef MSG_JUMBO
+/**
+ * @brief Secure Send Jumbo
+ * 
+ * @param buffer: const uint8_t*, pointer to data to be sent
+ * @param len: int, size of data to be sent, at most MSG_JUMBO_MAX_LEN
+ * 
+ * @return int: 0 once the AP has read all of it, negative if error
+ * 
+ * Sends data larger than one frame holds as a single jumbo frame, one
+ * authentication over all of it. Needs the post-boot channel.
+*/
+int secure_send_jumbo(const uint8_t* buffer, int len) {
+    reset_msg();
+
+    if (!post_boot_channel.ready || comp_jumbo_send(&post_boot_channel, buffer, len) != COMP_MESSAGE_SUCCESS) {
         return -1;
     }
+    return 0;
+}
 
-    memcpy(buffer, &(receive.contents[1]), len);
-    return len;
+/**
+ * @brief Secure Receive Jumbo
+ * 
+ * @param buffer: uint8_t*, pointer to buffer to receive data to
+ * @param maxlen: int, size of buffer
+ * 
+ * @return int: number of bytes received, negative if error
+ * 
+ * Receives a jumbo frame sent with the AP's secure_send_jumbo. Needs the
+ * post-boot channel.
+*/
+int secure_receive_jumbo(uint8_t* buffer, int maxlen) {
+    reset_msg();
+
+    if (!post_boot_channel.ready) {
+        return -1;
+    }
+    return comp_jumbo_recv(&post_boot_channel, buffer, maxlen);
+}
+#endif
+
+#ifdef MSG_RELAY
+/**
+ * @brief Secure Send To
+ * 
+ * @param component_id: uint32_t, ID of the component to send to
+ * @param buffer: uint8_t*, pointer to data to be sent
+ * @param len: uint8_t, size of data to be sent, at most MSG_RELAY_MAX_LEN
+ * 
+ * @return int: 0 once the AP has taken the frame, negative if error
+ * 
+ * Sends data to another component, relayed by the AP's secure_relay. Needs
+ * the post-boot channel.
+*/
+int secure_send_to(uint32_t component_id, uint8_t* buffer, uint8_t len) {
+    reset_msg();
+    msg_relay_t* relay = MSG_BODY(transmit, msg_relay_t);
+
+    if (!post_boot_channel.ready || len > MSG_RELAY_MAX_LEN) {
+        return -1;
+    }
+    relay->peer = component_id;
+    relay->len = len;
+    memcpy(relay->data, buffer, len);
+    transmit.opcode = MSG_OPCODE_RELAY;
+    transmit.len = len + 5;
+    if (comp_channel_transmit_and_ack(&post_boot_channel) != COMP_MESSAGE_SUCCESS) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Secure Receive From
+ * 
+ * @param component_id: uint32_t*, receives the ID of the sending component
+ * @param buffer: uint8_t*, pointer to buffer of MSG_RELAY_MAX_LEN bytes to receive data to
+ * 
+ * @return int: number of bytes received, negative if error
+ * 
+ * Receives data another component sent with secure_send_to, once the AP
+ * relays it. Needs the post-boot channel.
+*/
+int secure_receive_from(uint32_t* component_id, uint8_t* buffer) {
+    reset_msg();
+
+    if (!post_boot_channel.ready ||
+        comp_channel_wait_recv(&post_boot_channel) != COMP_MESSAGE_SUCCESS) {
+        return -1;
+    }
+    msg_relay_t* relay = MSG_BODY(receive, msg_relay_t);
+    if (receive.opcode != MSG_OPCODE_RELAY || receive.len < 5 ||
+        relay->len > MSG_RELAY_MAX_LEN || receive.len != relay->len + 5) {
+        return -1;
+    }
+
+    *component_id = relay->peer;
+    memcpy(buffer, relay->data, relay->len);
+    return relay->len;
 }
+#endif
+
+#ifdef MSG_PUBSUB
+/**
+ * @brief Secure Publish
+ * 
+ * @param topic: uint8_t, topic the data is published on
+ * @param buffer: uint8_t*, pointer to data to be published
+ * @param len: uint8_t, size of data, at most MSG_PUBLISH_MAX_LEN
+ * 
+ * @return int: 0 once the frame is queued, negative if error or the outbox is full
+ * 
+ * Queues data for the AP's pubsub_poll without waiting for it to be read.
+ * Needs the post-boot channel. Every other post-boot send first waits for
+ * the queued frames to be read, see secure_publish_flush.
+*/
+int secure_publish(uint8_t topic, uint8_t* buffer, uint8_t len) {
+    reset_msg();
+    msg_publish_t* pub = MSG_BODY(transmit, msg_publish_t);
+
+    if (!post_boot_channel.ready || len > MSG_PUBLISH_MAX_LEN) {
+        return -1;
+    }
+    pub->topic = topic;
+    pub->len = len;
+    memcpy(pub->data, buffer, len);
+    transmit.opcode = MSG_OPCODE_PUBLISH;
+    transmit.len = len + 2;
+    if (comp_channel_queue(&post_boot_channel) != COMP_MESSAGE_SUCCESS) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Secure Publish Flush
+ * 
+ * @return int: number of published frames not yet handed to the AP
+ * 
+ * Moves queued frames into the TRANSMIT banks as they free up, without
+ * waiting. Call it from the main loop so the outbox drains between publishes.
+*/
+int secure_publish_flush(void) {
+    return comp_outbox_flush(0);
+}
+#endif
+
+#ifdef MSG_STREAM
+/**
+ * @brief Secure Stream Accept
+ * 
+ * @param stream: msg_stream_t*, stream state to set up
+ * 
+ * @return int: 0 once the AP has opened a stream, negative if error
+ * 
+ * Waits for the AP to open a stream for bulk transfers, stream->writer tells
+ * which way it goes and with MSG_STREAM_LZ stream->compress whether its
+ * data is compressed. Transfer with comp_stream_write / comp_stream_read,
+ * finish with comp_stream_close. With MSG_SCHED, set stream->control
+ * afterwards to take the AP's control messages while reading.
+*/
+int secure_stream_accept(msg_stream_t* stream) {
+    reset_msg();
+
+#ifdef POST_BOOT_SESSION
+    return comp_stream_accept(stream, &post_boot_channel);
+#else
+    return comp_stream_accept(stream, NULL);
+#endif
+}
+#endif
+
+#ifdef FLASH_LOG
+/**
+ * @brief Secure Log Append
+ * 
+ * @param buffer: const uint8_t*, data to keep
+ * @param len: size_t, size of the data, at most FLASH_LOG_MAX_LEN
+ * 
+ * @return int: 0 once the data is in flash, negative if error
+ * 
+ * Keeps the data in the encrypted flash log until the AP takes it, see
+ * secure_log_upload. No bus traffic, so it can be called while the AP is busy.
+*/
+int secure_log_append(const uint8_t* buffer, size_t len) {
+    return flash_log_append(buffer, len);
+}
+
+#ifdef MSG_STREAM
+/**
+ * @brief Secure Log Upload
+ * 
+ * @return int: number of records handed to the AP, negative if error
+ * 
+ * Waits for the AP to open a stream it reads and writes every record of the
+ * flash log not handed over yet as seq (u32) | len (u16) | data, so the AP
+ * drains the log in full frames. The records are trimmed only once the AP
+ * has accepted the whole stream; after an error they go out again next time,
+ * and seq tells the AP which ones it has already seen.
+*/
+int secure_log_upload(void) {
+    msg_stream_t stream;
+    flash_log_cursor_t cursor;
+    uint8_t record[6 + FLASH_LOG_MAX_LEN];
+    uint32_t seq = 0;
+    int count = 0;
+    int len;
+
+    if (secure_stream_accept(&stream) != 0) {
+        return -1;
+    }
+    if (!stream.writer) {
+        comp_stream_close(&stream);
+        return -1;
+    }
+
+    flash_log_rewind(&cursor);
+    while ((len = flash_log_next(&cursor, record + 6, &seq)) > 0) {
+        memcpy(record, &seq, sizeof(seq));
+        record[4] = (uint8_t)len;
+        record[5] = (uint8_t)(len >> 8);
+        if (comp_stream_write(&stream, record, 6 + len) < 0) {
+            comp_stream_close(&stream);
+            secure_zero(record, sizeof(record));
+            return -1;
+        }
+        count++;
+    }
+    secure_zero(record, sizeof(record));
+
+    if (comp_stream_close(&stream) != COMP_MESSAGE_SUCCESS) {
+        return -1;
+    }
+    if (count > 0 && flash_log_trim(seq + 1) != 0) {
+        return -1;
+    }
+    return count;
+}
+#endif
+#endif
 
 /******************************* FUNCTION DEFINITIONS *********************************/
 
 // Example boot sequence
 // Your design does not need to change this
-void boot() {
+COLD void boot() {
     // POST BOOT FUNCTIONALITY
     // DO NOT REMOVE IN YOUR DESIGN
     #ifdef POST_BOOT
@@ -163,102 +667,461 @@ void boot() {
     #endif
 }
 
-// Handle a transaction from the AP
+/**
+ * @brief Move to another step of an exchange
+ * 
+ * @param state: comp_state_t, step to wait in for the next frame
+ * 
+ * Steps in the middle of an exchange wait at most COMP_SESSION_TIMEOUT_MS
+*/
+static void component_enter(comp_state_t state) {
+    comp_state = state;
+    bool timed = (state != COMP_STATE_IDLE);
+#ifdef VALIDATE_RESUME
+    timed &= (state != COMP_STATE_HOLD);
+#endif
+    board_link_set_recv_timeout(timed ? COMP_SESSION_TIMEOUT_MS : 0);
+}
+
+/**
+ * @brief Handle the next frame, or the lack of one
+ * 
+ * @param result: int, result of comp_wait_recv(1) for it
+ * 
+ * A frame that answers our last challenge is the next step of the exchange
+ * in progress, anything else valid starts a new command
+*/
+void component_process_frame(int result) {
+    if (result != COMP_MESSAGE_SUCCESS && board_link_recv_timed_out()) {
+        // The AP gave up on the exchange, or there is nothing to do
+        if (comp_state != COMP_STATE_IDLE) {
+            printf("Exchange timed out in state %d\n", comp_state);
+        }
+#ifdef VALIDATE_RESUME
+        if (comp_state == COMP_STATE_HOLD) {
+            return;
+        }
+#endif
+        component_enter(COMP_STATE_IDLE);
+        return;
+    }
+
+    comp_state_t state = comp_state;
+    component_enter(COMP_STATE_IDLE);
+#if COMP_REJECT_AFTER > 0
+    if (result == COMP_MESSAGE_SUCCESS) {
+        invalid_frames = 0;
+    }
+    else if (++invalid_frames >= COMP_REJECT_AFTER) {
+        // Whoever sends these is not getting anything sealed for them, the
+        // exchange in progress is dropped as it would be on a new command
+        if (invalid_frames == COMP_REJECT_AFTER) {
+            printf("%lu invalid frames in a row, backing off\n", (unsigned long) invalid_frames);
+        }
+        sleep_us(COMP_REJECT_BACKOFF_MS * 1000);
+        return;
+    }
+#endif
+    if (result != COMP_MESSAGE_SUCCESS) {
+        // Send garbage back to AP to clean out i2c, in the shape the step expects
+        switch (state) {
+            case COMP_STATE_VALIDATE_PROOF:
+                put_id(0);
+                comp_transmit_and_ack();
+                return;
+            case COMP_STATE_VALIDATE_BOOT:
+                MSG_BODY(transmit, msg_boot_t)->result = 1;
+                transmit.len = sizeof(msg_boot_t);
+                comp_transmit_and_ack();
+                return;
+            case COMP_STATE_ATTEST_PROOF:
+            case COMP_STATE_ATTEST_MORE:
+                comp_transmit_and_ack();
+                return;
+            default:
+                // If this message is malformed somehow, ensure the opcode
+                // does not send us down some valid code path
+                receive.opcode = COMPONENT_CMD_NONE;
+                component_process_cmd();
+                return;
+        }
+    }
+
+    if (state != COMP_STATE_IDLE && msg_answers_prev()) {
+        switch (state) {
+            case COMP_STATE_VALIDATE_PROOF:
+                process_validate_proof();
+                return;
+            case COMP_STATE_VALIDATE_BOOT:
+#ifdef VALIDATE_RESUME
+            case COMP_STATE_HOLD:
+#endif
+                // Only a BOOT goes on, a VALIDATE refreshing a hold answers
+                // our last frame too and starts over
+                if (comp_answers_boot()) {
+                    process_boot();
+                    return;
+                }
+                break;
+            case COMP_STATE_ATTEST_PROOF:
+                process_attest_proof();
+                return;
+            case COMP_STATE_ATTEST_MORE:
+                // The AP asks for the next slice with another ATTEST
+                if (receive.opcode == COMPONENT_CMD_ATTEST) {
+                    process_attest_slice();
+                    return;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Anything else is a new command, whatever was in progress is dropped
+    component_process_cmd();
+}
+
+// Handle a new command from the AP
 void component_process_cmd() {
-    // Figure out which command we were sent
-    switch (receive.opcode) {
-        case COMPONENT_CMD_SCAN:
-            process_scan();
-            break;
+    // Commands without a handler only carry an exchange on, see component_process_frame
+    static void (* const handlers[COMPONENT_CMD_COUNT])(void) = {
+        [COMPONENT_CMD_SCAN] = process_scan,
         // Our design combines validate + boot into one continuous message sequence
         // between AP and Component, so VALIDATE here is essentially BOOT
-        case COMPONENT_CMD_VALIDATE:
-            process_validate();
-            break;
-        case COMPONENT_CMD_ATTEST:
-            process_attest();
-            break;
-        default:
-            printf("Error: Unrecognized command received %d\n", receive.opcode);
-            // The AP will still be expecting a response if this component is on the I2C bus, 
-            // so send them garbage to avoid the whole MISC freezing up
-            comp_transmit_and_ack();
-            break;
-    }
-}
-
-void process_scan() {    
-    // The AP requested a scan. Respond with the Component ID
-    *((uint32_t *) transmit.contents) = COMPONENT_ID;
+        [COMPONENT_CMD_VALIDATE] = process_validate,
+        [COMPONENT_CMD_ATTEST] = process_attest,
+#ifdef LINK_STATS
+        [COMPONENT_CMD_STATS] = process_stats,
+#endif
+#ifdef KEY_ROTATION
+        [COMPONENT_CMD_REKEY] = process_rekey,
+#endif
+#ifdef LAT_HIST
+        [COMPONENT_CMD_HIST] = process_hist,
+#endif
+    };
+
+    // Figure out which command we were sent
+    uint8_t opcode = receive.opcode;
+    if (opcode < COMPONENT_CMD_COUNT && handlers[opcode] != NULL) {
+        LAT_START(start);
+        handlers[opcode]();
+        LAT_ADD(&cmd_hists[opcode], start);
+        return;
+    }
+
+    printf("Error: Unrecognized command received %d\n", receive.opcode);
+    // The AP will still be expecting a response if this component is on the I2C bus, 
+    // so send them garbage to avoid the whole MISC freezing up
+    comp_transmit_and_ack();
+}
+
+/**
+ * @brief Fills transmit with an ID reply, and with MSG_FORMAT_NEGOTIATE the
+ * framings this component speaks.
+ *
+ * @param id: uint32_t, component ID to send
+*/
+static void put_id(uint32_t id) {
+    msg_id_t *reply = MSG_BODY(transmit, msg_id_t);
+    reply->component_id = id;
+#ifdef MSG_FORMAT_NEGOTIATE
+    reply->wire_version = MSG_WIRE_VERSION;
+    reply->wire_formats = MSG_FORMATS;
+#endif
+    transmit.len = sizeof(msg_id_t);
+}
+
+void process_scan() {
+    // The AP requested a scan. Respond with the Component ID. Unlike the
+    // attestation fields there is nothing worth keeping: the body is a few
+    // stores, and the sealed frame carries fresh challenges every time
+    put_id(COMPONENT_ID);
     
     comp_transmit_and_ack();
 }
 
 void process_validate() {
-    // Need to respond to show AP we are valid
+#ifdef BOOT_TWO_TRIP
+    // Show AP we are valid along with our ID. Its proof comes with the boot
+    // result, which process_boot only gets if it answers this frame
+    put_id(COMPONENT_ID);
+    comp_transmit_and_ack();
+    component_enter(COMP_STATE_VALIDATE_BOOT);
+#else
+    // Need to respond to show AP we are valid, then wait for its proof
     comp_transmit_and_ack();
+    component_enter(COMP_STATE_VALIDATE_PROOF);
+#endif
+}
 
-    // Now, wait for another message from the AP. Make sure to validate the challenge-response
-    int ret = comp_wait_recv(0);
-    if (ret != COMP_MESSAGE_SUCCESS) {
-        // Send garbage back to AP to clean out i2c, then return
-        *((uint32_t *) transmit.contents) = 0;
-        comp_transmit_and_ack();
-        return;
-    }
-    // Send back the component's ID
-    *((uint32_t *) transmit.contents) = COMPONENT_ID;
+void process_validate_proof() {
+    // The AP answered our challenge. Send back the component's ID, then
+    // wait for AP to tell us whether full boot is OK
+    put_id(COMPONENT_ID);
     comp_transmit_and_ack();
+    component_enter(COMP_STATE_VALIDATE_BOOT);
+}
 
-    // Now, wait for AP to tell us whether full boot is OK
-    ret = comp_wait_recv(0);
-    if (ret != COMP_MESSAGE_SUCCESS) {
-        // Send garbage back to AP to clean out i2c, then return
-        *((uint32_t *) transmit.contents) = 1;
+void process_boot() {
+    // Check whether boot is OK
+    uint32_t boot_res = MSG_BODY(receive, msg_boot_t)->result;
+#ifdef VALIDATE_RESUME
+    if (boot_res == BOOT_RESULT_HOLD) {
+        // The AP failed elsewhere but keeps our validation: stay in this
+        // exchange until its next boot attempt sends the real result
+        MSG_BODY(transmit, msg_boot_t)->result = boot_res;
+        transmit.len = sizeof(msg_boot_t);
         comp_transmit_and_ack();
+        component_enter(COMP_STATE_HOLD);
         return;
     }
-
-    // Check whether boot is OK
-    uint32_t boot_res = *((uint32_t *) receive.contents);
+#endif
     if (boot_res == 0) {
         // Echo boot success, send boot message, and actually boot
-        *((uint32_t *) transmit.contents) = boot_res;
-        strncpy((char*) &(transmit.contents[4]), COMPONENT_BOOT_MSG, 64);
-        transmit.contents[68] = '\0';
+        msg_boot_reply_t* reply = MSG_BODY(transmit, msg_boot_reply_t);
+        reply->result = boot_res;
+        strncpy(reply->message, COMPONENT_BOOT_MSG, MSG_TEXT_LEN);
+        reply->message[MSG_TEXT_LEN] = '\0';
+        transmit.len = sizeof(msg_boot_reply_t);
         comp_transmit_and_ack();
+#ifdef BOOT_BROADCAST
+        // The AP releases every component at once when all of them are
+        // ready, up to COMP_SESSION_TIMEOUT_MS from now
+        board_link_set_recv_timeout(COMP_SESSION_TIMEOUT_MS);
+        int released = comp_wait_release();
+        board_link_set_recv_timeout(0);
+        if (released != COMP_MESSAGE_SUCCESS) {
+            printf("Boot release not received\n");
+            return;
+        }
+#endif
+#ifdef POST_BOOT_SESSION
+        msg_channel_open(&post_boot_channel);
+#endif
+        // Debug builds only: the main loop never gets to dump this command
+        trace_dump();
         boot();
     } else {
         // Echo boot failure
-        *((uint32_t *) transmit.contents) = boot_res;
+        MSG_BODY(transmit, msg_boot_t)->result = boot_res;
+        transmit.len = sizeof(msg_boot_t);
         comp_transmit_and_ack();
     }
 }
 
 void process_attest() {
-    // Need to respond to show AP we are valid
+#ifdef ATTEST_ONE_TRIP
+    // The AP answered the challenge of our last frame, which proves it as
+    // our own challenge would: the data goes back at once, answering the AP's
+    if (msg_answers_prev()) {
+        process_attest_proof();
+        return;
+    }
+    // An empty reply tells the AP to prove itself the long way
+    transmit.len = 0;
+#endif
+    // Need to respond to show AP we are valid, then wait for its proof
     comp_transmit_and_ack();
+    component_enter(COMP_STATE_ATTEST_PROOF);
+}
 
-    // Now, wait for another message from the AP. Make sure to validate the challenge-response
-    int ret = comp_wait_recv(0);
-    if (ret != COMP_MESSAGE_SUCCESS) {
-        // Send garbage back to AP to clean out i2c, then return
-        comp_transmit_and_ack();
-        return;
+#ifndef ATTEST_SEALED
+/**
+ * @brief Append one length-prefixed attestation field to attest_data
+ * 
+ * @param field: const char*, the field, longer ones are cut at ATTEST_FIELD_MAX_LEN
+*/
+static void attest_put(const char* field) {
+    uint8_t len = strnlen(field, ATTEST_FIELD_MAX_LEN);
+    attest_data[attest_len++] = len;
+    memcpy(&attest_data[attest_len], field, len);
+    attest_len += len;
+}
+#endif
+
+void process_attest_proof() {
+    // If we get here, this is a valid AP requesting attestation, so respond with our actual data.
+#ifndef ATTEST_SEALED
+    // The fields never change while we run, so only the first attest encodes them
+    if (attest_len == 0) {
+        attest_put(ATTESTATION_LOC);
+        attest_put(ATTESTATION_DATE);
+        attest_put(ATTESTATION_CUSTOMER);
+    }
+#endif
+    attest_sent = 0;
+
+    process_attest_slice();
+}
+
+void process_attest_slice() {
+    // Send as much of what is left as fits into one frame
+    msg_attest_t* attest = MSG_BODY(transmit, msg_attest_t);
+    unsigned len = attest_len - attest_sent;
+    if (len > MSG_ATTEST_SLICE_LEN) {
+        len = MSG_ATTEST_SLICE_LEN;
+    }
+    memcpy(attest->data, &attest_data[attest_sent], len);
+    attest_sent += len;
+    bool more = (attest_sent < attest_len);
+    attest->more = more;
+    transmit.len = 1 + len;
+
+    comp_transmit_and_ack();
+    if (more) {
+        component_enter(COMP_STATE_ATTEST_MORE);
+    }
+}
+
+#ifdef LAT_HIST
+void process_hist() {
+    // Debug builds only: the histogram of one opcode, an unknown one is empty
+    uint8_t opcode = MSG_BODY(receive, msg_hist_req_t)->opcode;
+    msg_hist_t* reply = MSG_BODY(transmit, msg_hist_t);
+    reply->opcode = opcode;
+    reply->pad = 0;
+    if (receive.len == sizeof(msg_hist_req_t) && opcode < COMPONENT_CMD_COUNT) {
+        memcpy(&reply->hist, &cmd_hists[opcode], sizeof(lat_hist_t));
+    } else {
+        memset(&reply->hist, 0, sizeof(lat_hist_t));
     }
+    transmit.len = sizeof(msg_hist_t);
+
+    comp_transmit_and_ack();
+}
+#endif
 
-    // If we get here, this is a valid AP requesting attestation, so respond with our actual data
-    // Be careful on memory movement and null terminating
-    // These casts are fine, it just removes some warnings from compiler
-    strncpy((char*) &(transmit.contents[0]), ATTESTATION_LOC, 64);
-    transmit.contents[64] = 0;
-    strncpy((char*) &(transmit.contents[65]), ATTESTATION_DATE, 64);
-    transmit.contents[129] = 0;
-    strncpy((char*) &(transmit.contents[130]), ATTESTATION_CUSTOMER, 64);
-    transmit.contents[194] = 0;
+#ifdef LINK_STATS
+void process_stats() {
+    // Debug builds only: our counters, in one frame like a scan reply
+    link_stats_snapshot(MSG_BODY(transmit, msg_stats_t));
+    transmit.len = sizeof(msg_stats_t);
 
     comp_transmit_and_ack();
 }
+#endif
+
+#ifdef KEY_ROTATION
+void process_rekey() {
+    // The AP moves us to a newer device key. It is stored before we answer,
+    // so a power cut cannot lose a key the AP saw us take. A repeat of the
+    // rotation we already took, after the AP lost our reply, is confirmed
+    // again, anything older only gets told where we are
+    msg_rekey_t* rekey = MSG_BODY(receive, msg_rekey_t);
+    bool move = false;
+    if (receive.len == sizeof(msg_rekey_t) && rekey->epoch > key_store.epoch) {
+        key_store_t store = key_store;
+        store.epoch = rekey->epoch;
+        memcpy(store.key, rekey->key, KEY_STORE_KEY_LEN);
+        if (key_store_save(KEY_STORE_ADDR, &store) == 0) {
+            key_store = store;
+            move = true;
+        }
+        secure_zero(&store, sizeof(store));
+    }
+
+    // The reply still goes out under the key the AP sent the command under
+    msg_rekey_reply_t* reply = MSG_BODY(transmit, msg_rekey_reply_t);
+    reply->epoch = key_store.epoch;
+    key_store_proof(key_store.epoch, key_store.key, reply->proof);
+    transmit.len = sizeof(msg_rekey_reply_t);
+    comp_transmit_and_ack();
+
+    if (move) {
+        crypto_rekey(key_store.key);
+    }
+}
+#endif
+
+#ifdef ENROLL_RESUME
+/**
+ * @brief Load the resumption secret kept in flash
+ *
+ * @param cert_hash: const uint8_t*, hash of the certificate we present
+ * @param secret: uint8_t*, receives ENROLL_SECRET_LEN bytes
+ *
+ * @return int: COMP_MESSAGE_SUCCESS if a record that decrypts with a valid
+ * hash was stored for this certificate, COMP_MESSAGE_ERROR otherwise
+ *
+ * An erased page, a record of an earlier image or one changed by someone else
+ * all fail the check, and the caller runs the ECDH again.
+*/
+int comp_resume_load(const uint8_t* cert_hash, uint8_t* secret) {
+    uint32_t plain[(RESUME_RECORD_LEN - IV_LEN) / sizeof(uint32_t)];
+    uint8_t* bytes = (uint8_t*)plain;
+    const uint8_t* record = flash_simple_map(RESUME_FLASH_ADDR);
+    uint8_t check[HASH_LEN];
+    int result = COMP_MESSAGE_ERROR;
+
+    // Decrypt straight out of the mapped page
+    aes_decrypt((uint8_t*)record + IV_LEN, bytes, (uint8_t*)record, RESUME_RECORD_LEN - IV_LEN);
+    hash(bytes, check, RESUME_DATA_LEN);
+    if (!secure_memcmp(bytes + RESUME_DATA_LEN, check, HASH_LEN) &&
+        !secure_memcmp(bytes, cert_hash, HASH_LEN)) {
+        memcpy(secret, bytes + HASH_LEN, ENROLL_SECRET_LEN);
+        result = COMP_MESSAGE_SUCCESS;
+    }
+
+    memset(plain, 0, sizeof(plain));
+    return result;
+}
+
+/**
+ * @brief Keep the resumption secret in flash for the next boot
+ *
+ * @param cert_hash: const uint8_t*, hash of the certificate we present
+ * @param secret: const uint8_t*, ENROLL_SECRET_LEN bytes
+ *
+ * Rewrites the page under a fresh IV. A power cut or failed write leaves a
+ * record that does not validate, which only costs an ECDH next boot.
+*/
+void comp_resume_save(const uint8_t* cert_hash, const uint8_t* secret) {
+    uint32_t record[RESUME_RECORD_LEN / sizeof(uint32_t)];
+    uint8_t* bytes = (uint8_t*)record;
+
+    uint64_t randValue;
+    randValue = rng_gen();
+    memcpy(&bytes[0], &randValue, sizeof(randValue));
+    randValue = rng_gen();
+    memcpy(&bytes[8], &randValue, sizeof(randValue));
+
+    memcpy(bytes + IV_LEN, cert_hash, HASH_LEN);
+    memcpy(bytes + IV_LEN + HASH_LEN, secret, ENROLL_SECRET_LEN);
+    hash(bytes + IV_LEN, bytes + IV_LEN + RESUME_DATA_LEN, RESUME_DATA_LEN);
+    aes_encrypt(bytes + IV_LEN, bytes + IV_LEN, bytes, RESUME_RECORD_LEN - IV_LEN);
+
+    if (flash_simple_erase_page(RESUME_FLASH_ADDR) == 0) {
+        flash_simple_write(RESUME_FLASH_ADDR, record, RESUME_RECORD_LEN);
+    }
+    memset(record, 0, sizeof(record));
+}
+#endif
+
+#ifdef SELFTEST_ENABLE
+// One line of the self test report
+static void selftest_print(int ok, const char *text) {
+    printf(ok ? "%%info: %s%%\n" : "%%error: %s%%\n", text);
+    fflush(stdout);
+}
+#endif
+
+#ifdef BENCH_ENABLE
+// One line of the benchmark report
+static void bench_print(const char *text) {
+    printf("%%info: %s%%\n", text);
+    fflush(stdout);
+}
+#endif
+
+#ifdef CTCHECK_ENABLE
+// One line of the constant-time report
+static void ctcheck_print(int ok, const char *text) {
+    printf(ok ? "%%info: %s%%\n" : "%%error: %s%%\n", text);
+    fflush(stdout);
+}
+#endif
 
 /*********************************** MAIN *************************************/
 
@@ -268,25 +1131,109 @@ int main(void) {
     // Enable Global Interrupts
     __enable_irq();
     
+    // Start the cycle counter for hot-path tracing (no-op unless TRACE=1)
+    trace_init();
+    power_mark_init();
+
+    // Power up the TRNG and seed the random pool before anything draws on it
+    rng_init();
+
+#ifdef KEY_ROTATION
+    // Run under the key of the last rotation, the deployment key if there was none
+    key_store_load(KEY_STORE_ADDR, &key_store);
+    crypto_rekey(key_store.key);
+#endif
+
+    // Expand the AES key schedules once for the lifetime of the device
+    crypto_init();
+
+#ifdef BENCH_ENABLE
+    // Benchmark images time the crypto first, then serve the AP's benchmarks
+    bench_init(bench_print);
+    bench_crypto();
+#endif
+
+#ifdef SELFTEST_ENABLE
+    // Self test images only check the crypto, then idle
+    int failed = selftest_run(selftest_print);
+    printf(failed ? "%%error: Selftest %d failed%%\n" : "%%success: Selftest%%\n", failed);
+    fflush(stdout);
+    while (1) {}
+#endif
+
+#ifdef CTCHECK_ENABLE
+    // Constant-time check images only time the crypto and compares, then idle
+    int leaks = ctcheck_run(ctcheck_print);
+    printf(leaks ? "%%error: Ctcheck %d leaking%%\n" : "%%success: Ctcheck%%\n", leaks);
+    fflush(stdout);
+    while (1) {}
+#endif
+
+#if defined(ENROLL_RESUME) || defined(KEY_ROTATION) || defined(FLASH_LOG)
+    // The resumption secret is read from flash by comp_messaging_init, and
+    // rotated keys and post-boot data are written to it
+    flash_simple_init();
+#endif
+#ifdef FLASH_LOG
+    flash_log_init();
+#endif
+
+#ifdef MSG_TIMESYNC
+    time_init();
+#endif
+
     // Initialize Component
     i2c_addr_t addr = component_id_to_i2c_addr(COMPONENT_ID);
     board_link_init(addr);
-    
+#ifdef DMA_COPY
+    // After the I2C driver's own channels
+    if (dma_copy_init() != 0) {
+        printf("No DMA channel for copies, using the CPU\n");
+    }
+#endif
+    comp_messaging_init();
+#ifdef COMP_READY
+    // The AP waits for this before it sends us anything
+    board_link_ready();
+#endif
+
 
     LED_On(LED2);
     while (1) {
-        // Clear out any data that might still be in memory
+        // Clear out any data that might still be in memory, keeping our last
+        // challenge so the AP's answer to it can carry the exchange on
+        msg_session_t session;
+        msg_session_save(&session);
         reset_msg();
+        msg_session_load(&session);
 
-        // Wait for a message from the AP
+        // Wait for a message from the AP, which may start a new command
+        // or carry the exchange in progress on
         int res = comp_wait_recv(1);
-        if (res != COMP_MESSAGE_SUCCESS) {
-            // If this message is malformed somehow, ensure the opcode
-            // does not send us down some valid code path
-            receive.opcode = COMPONENT_CMD_NONE;
-        }
 
         // Process the AP's message
-        component_process_cmd();
+        component_process_frame(res);
+
+        // The interrupts only post their faults, report them now we are idle
+        uint32_t flash_faults = irq_event_take(IRQ_EVENT_FLASH_AF);
+        if (flash_faults > 0) {
+            printf("Flash access failure (%lu)\n", (unsigned long) flash_faults);
+        }
+        uint32_t rng_faults = irq_event_take(IRQ_EVENT_RNG_HEALTH);
+        if (rng_faults > 0) {
+            printf("TRNG health test failure (%lu)\n", (unsigned long) rng_faults);
+        }
+        uint32_t reseed_faults = irq_event_take(IRQ_EVENT_RNG_RESEED);
+        if (reseed_faults > 0) {
+            printf("DRBG reseed failure (%lu)\n", (unsigned long) reseed_faults);
+        }
+
+        // Debug builds only: the component has no host commands, so dump
+        // the trace of each command over UART once it is finished
+        trace_dump();
+
+        // Profiling builds only (make stack): the deepest the stack has
+        // been so far, a command at a time
+        stack_report();
     }
 }
@@ -0,0 +1,328 @@
+/**
+ * @file flash_log.c
+ * @brief Encrypted append-only log in flash for post-boot data
+ * @date 2024
+ *
+ * See flash_log.h. The pages come from firmware.ld, FLASH_LOG_PAGES of them
+ * from __flash_log_start on.
+ */
+
+#include "flash_log.h"
+
+#ifdef FLASH_LOG
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "mxc_device.h"
+#include "crypto_util.h"
+#include "msg_core.h"
+#include "simple_flash.h"
+
+#define FLASH_LOG_MAGIC 0x464C4F47
+
+// Kinds of records
+#define FLASH_LOG_DATA 1
+#define FLASH_LOG_TRIM 2
+
+// Plain header of a record, the first encrypted block holds it
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint16_t len;
+    uint16_t kind;
+} flash_log_head_t;
+
+#define FLASH_LOG_HEAD_LEN sizeof(flash_log_head_t)
+#define FLASH_LOG_PAD_LEN(len) \
+    (((FLASH_LOG_HEAD_LEN + (len) + CBC_BLOCK_LEN - 1) / CBC_BLOCK_LEN) * CBC_BLOCK_LEN)
+#define FLASH_LOG_REC_LEN(len) (IV_LEN + FLASH_LOG_PAD_LEN(len) + HASH_LEN)
+#define FLASH_LOG_REC_MAX_LEN FLASH_LOG_REC_LEN(FLASH_LOG_MAX_LEN)
+
+typedef char flash_log_head_fits_t[(FLASH_LOG_HEAD_LEN <= CBC_BLOCK_LEN) ? 1 : -1];
+typedef char flash_log_rec_fits_t[(FLASH_LOG_REC_LEN(sizeof(uint32_t)) + FLASH_LOG_REC_MAX_LEN <=
+                                   MXC_FLASH_PAGE_SIZE) ? 1 : -1];
+
+// Reserved by firmware.ld
+extern uint8_t __flash_log_start[];
+#define FLASH_LOG_PAGE_ADDR(page) ((uint32_t)__flash_log_start + (page) * MXC_FLASH_PAGE_SIZE)
+
+static struct {
+    // Page appended to, and where the next record goes in it
+    uint32_t page;
+    uint32_t next;
+    // seq of the next record
+    uint32_t seq;
+    // First seq still wanted, valid if trimmed
+    uint32_t trim;
+    bool trimmed;
+} flog;
+
+// Plain record being written or read
+static uint32_t flog_record[FLASH_LOG_REC_MAX_LEN / sizeof(uint32_t)];
+
+/**
+ * @brief Decrypts the header of the record at offset of a page.
+ *
+ * @param page Page of the record.
+ * @param offset Offset of the record in the page.
+ * @param head Receives the header.
+ *
+ * @return Length of the whole record, 0 if the page is blank from offset on,
+ * -1 if no valid record starts there.
+ */
+static int flash_log_head(uint32_t page, uint32_t offset, flash_log_head_t *head)
+{
+    uint32_t block[CBC_BLOCK_LEN / sizeof(uint32_t)];
+
+    if (offset + FLASH_LOG_REC_LEN(0) > MXC_FLASH_PAGE_SIZE) {
+        return -1;
+    }
+    const uint8_t *bytes = flash_simple_map(FLASH_LOG_PAGE_ADDR(page) + offset);
+
+    // The IV and first encrypted block tell whether anything has been appended here
+    unsigned i = 0;
+    while (i < IV_LEN + CBC_BLOCK_LEN && bytes[i] == 0xFF) {
+        i++;
+    }
+    if (i == IV_LEN + CBC_BLOCK_LEN) {
+        return 0;
+    }
+
+    aes_decrypt((uint8_t *)bytes + IV_LEN, (uint8_t *)block, (uint8_t *)bytes, CBC_BLOCK_LEN);
+    memcpy(head, block, sizeof(flash_log_head_t));
+    memset(block, 0, sizeof(block));
+    if (head->magic != FLASH_LOG_MAGIC || head->len > FLASH_LOG_MAX_LEN ||
+        offset + FLASH_LOG_REC_LEN(head->len) > MXC_FLASH_PAGE_SIZE) {
+        return -1;
+    }
+    return FLASH_LOG_REC_LEN(head->len);
+}
+
+/**
+ * @brief Decrypts and checks a whole record into flog_record.
+ *
+ * @param page Page of the record.
+ * @param offset Offset of the record in the page.
+ * @param len Length of its data, from its header.
+ *
+ * @return true if the hash holds.
+ */
+static bool flash_log_open(uint32_t page, uint32_t offset, unsigned len)
+{
+    const uint8_t *bytes = flash_simple_map(FLASH_LOG_PAGE_ADDR(page) + offset);
+    uint8_t *plain = (uint8_t *)flog_record;
+    uint8_t check[HASH_LEN];
+
+    aes_decrypt((uint8_t *)bytes + IV_LEN, plain, (uint8_t *)bytes, FLASH_LOG_PAD_LEN(len) + HASH_LEN);
+    hash(plain, check, FLASH_LOG_HEAD_LEN + len);
+    return !secure_memcmp(check, plain + FLASH_LOG_PAD_LEN(len), HASH_LEN);
+}
+
+/**
+ * @brief Encrypts and writes a record where the next one goes.
+ *
+ * The caller has made sure it fits into the page.
+ *
+ * @param kind FLASH_LOG_DATA or FLASH_LOG_TRIM.
+ * @param data Data of the record.
+ * @param len Length of the data.
+ *
+ * @return 0 on success, -1 if the write failed.
+ */
+static int flash_log_put(uint16_t kind, const uint8_t *data, size_t len)
+{
+    uint8_t *bytes = (uint8_t *)flog_record;
+    unsigned rec_len = FLASH_LOG_REC_LEN(len);
+    flash_log_head_t head = { FLASH_LOG_MAGIC, flog.seq, (uint16_t)len, kind };
+
+    memset(bytes, 0, rec_len);
+    uint64_t randValue;
+    randValue = rng_gen();
+    memcpy(&bytes[0], &randValue, sizeof(randValue));
+    randValue = rng_gen();
+    memcpy(&bytes[8], &randValue, sizeof(randValue));
+
+    // Hash after the zero pad, then encrypt the record in place
+    memcpy(bytes + IV_LEN, &head, FLASH_LOG_HEAD_LEN);
+    memcpy(bytes + IV_LEN + FLASH_LOG_HEAD_LEN, data, len);
+    hash(bytes + IV_LEN, bytes + IV_LEN + FLASH_LOG_PAD_LEN(len), FLASH_LOG_HEAD_LEN + len);
+    aes_encrypt(bytes + IV_LEN, bytes + IV_LEN, bytes, rec_len - IV_LEN);
+
+    int result = flash_simple_write(FLASH_LOG_PAGE_ADDR(flog.page) + flog.next, flog_record, rec_len);
+    // A failed write leaves a record that never validates, move past it either way
+    flog.next += rec_len;
+    flog.seq++;
+    memset(flog_record, 0, rec_len);
+    return result == 0 ? 0 : -1;
+}
+
+/**
+ * @brief Appends a record, moving on to the next page if it does not fit.
+ *
+ * Moving on erases the next page, the oldest, and starts it with a copy of
+ * the newest TRIM.
+ *
+ * @param kind FLASH_LOG_DATA or FLASH_LOG_TRIM.
+ * @param data Data of the record.
+ * @param len Length of the data.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+static int flash_log_add(uint16_t kind, const uint8_t *data, size_t len)
+{
+    if (flog.next + FLASH_LOG_REC_LEN(len) > MXC_FLASH_PAGE_SIZE) {
+        flog.page = (flog.page + 1) % FLASH_LOG_PAGES;
+        flog.next = 0;
+        if (flash_simple_erase_page(FLASH_LOG_PAGE_ADDR(flog.page)) != 0) {
+            // Try again on the next append, nothing has been lost yet
+            flog.next = MXC_FLASH_PAGE_SIZE;
+            return -1;
+        }
+        if (flog.trimmed && kind != FLASH_LOG_TRIM &&
+            flash_log_put(FLASH_LOG_TRIM, (const uint8_t *)&flog.trim, sizeof(flog.trim)) != 0) {
+            return -1;
+        }
+    }
+    return flash_log_put(kind, data, len);
+}
+
+/**
+ * @brief Finds the end of the log and the newest TRIM.
+ *
+ * Walks the headers of every page. The page holding the highest seq is the
+ * one appended to, and the TRIM with the highest seq tells what is wanted.
+ */
+void flash_log_init(void)
+{
+    bool found = false;
+    uint32_t last = 0;
+    uint32_t trim_seq = 0;
+
+    memset(&flog, 0, sizeof(flog));
+    crypto_hold_device_key();
+    for (uint32_t page = 0; page < FLASH_LOG_PAGES; page++) {
+        uint32_t offset = 0;
+        flash_log_head_t head;
+        int len;
+        while ((len = flash_log_head(page, offset, &head)) > 0) {
+            if (!found || (int32_t)(head.seq - last) > 0) {
+                found = true;
+                last = head.seq;
+                flog.page = page;
+            }
+            if (head.kind == FLASH_LOG_TRIM && head.len == sizeof(uint32_t) &&
+                (!flog.trimmed || (int32_t)(head.seq - trim_seq) > 0) &&
+                flash_log_open(page, offset, head.len)) {
+                memcpy(&flog.trim, (uint8_t *)flog_record + FLASH_LOG_HEAD_LEN, sizeof(flog.trim));
+                flog.trimmed = true;
+                trim_seq = head.seq;
+            }
+            offset += len;
+        }
+        memset(flog_record, 0, sizeof(flog_record));
+        if (found && flog.page == page) {
+            // Without a length the rest of the page cannot be walked, treat it as full
+            flog.next = (len == 0) ? offset : MXC_FLASH_PAGE_SIZE;
+        }
+    }
+    if (!found) {
+        // Nothing valid anywhere, start at the first page once it is erased
+        flog.page = FLASH_LOG_PAGES - 1;
+        flog.next = MXC_FLASH_PAGE_SIZE;
+    }
+    flog.seq = found ? last + 1 : 0;
+    crypto_release_device_key();
+}
+
+/**
+ * @brief Appends data to the log.
+ *
+ * @param data Data to keep.
+ * @param len Length of the data, 1 to FLASH_LOG_MAX_LEN.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int flash_log_append(const uint8_t *data, size_t len)
+{
+    if (len == 0 || len > FLASH_LOG_MAX_LEN) {
+        return -1;
+    }
+    crypto_hold_device_key();
+    int result = flash_log_add(FLASH_LOG_DATA, data, len);
+    crypto_release_device_key();
+    return result;
+}
+
+/**
+ * @brief Starts a cursor at the oldest page.
+ *
+ * @param cursor Cursor to start.
+ */
+void flash_log_rewind(flash_log_cursor_t *cursor)
+{
+    cursor->page = 0;
+    cursor->offset = 0;
+}
+
+/**
+ * @brief Reads the next record wanted.
+ *
+ * @param cursor Where to read from, moved past the record.
+ * @param buf Receives the data, FLASH_LOG_MAX_LEN bytes.
+ * @param seq Receives the seq of the record.
+ *
+ * @return Length of the data, 0 at the end of the log.
+ */
+int flash_log_next(flash_log_cursor_t *cursor, uint8_t *buf, uint32_t *seq)
+{
+    int result = 0;
+
+    crypto_hold_device_key();
+    // Pages from the one after the page appended to, the oldest, up to that one
+    while (cursor->page < FLASH_LOG_PAGES) {
+        uint32_t page = (flog.page + 1 + cursor->page) % FLASH_LOG_PAGES;
+        flash_log_head_t head;
+        int len = (page == flog.page && cursor->offset >= flog.next) ? 0 :
+                  flash_log_head(page, cursor->offset, &head);
+        if (len <= 0) {
+            cursor->page++;
+            cursor->offset = 0;
+            continue;
+        }
+
+        uint32_t offset = cursor->offset;
+        cursor->offset += len;
+        if (head.kind != FLASH_LOG_DATA ||
+            (flog.trimmed && (int32_t)(head.seq - flog.trim) < 0) ||
+            !flash_log_open(page, offset, head.len)) {
+            continue;
+        }
+        memcpy(buf, (uint8_t *)flog_record + FLASH_LOG_HEAD_LEN, head.len);
+        *seq = head.seq;
+        result = head.len;
+        break;
+    }
+    memset(flog_record, 0, sizeof(flog_record));
+    crypto_release_device_key();
+    return result;
+}
+
+/**
+ * @brief Drops the records before seq.
+ *
+ * @param seq First seq still wanted, usually one past the last record read.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int flash_log_trim(uint32_t seq)
+{
+    crypto_hold_device_key();
+    flog.trim = seq;
+    flog.trimmed = true;
+    int result = flash_log_add(FLASH_LOG_TRIM, (const uint8_t *)&seq, sizeof(seq));
+    crypto_release_device_key();
+    return result;
+}
+
+#endif
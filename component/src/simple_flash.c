@@ -0,0 +1,157 @@
+/**
+ * @file "simple_flash.c"
+ * @author Frederich Stine 
+ * @brief Simple Flash Interface Implementation 
+ * @date 2024
+ *
+ * This source file is part of an example system for MITRE's 2024 Embedded System CTF (eCTF).
+ * This code is being provided only for educational purposes for the 2024 MITRE eCTF competition,
+ * and may not meet MITRE standards for quality. Use this code at your own risk!
+ *
+ * @copyright Copyright (c) 2024 The MITRE Corporation
+ */
+
+#include "simple_flash.h"
+#include "trace.h"
+#include "link_stats.h"
+#include "irq_events.h"
+
+#include <stdio.h>
+
+#include "flc.h"
+#include "icc.h"
+#include "nvic_table.h"
+
+#include <stdio.h>
+
+/**
+ * @brief ISR for the Flash Controller
+ * 
+ * This ISR allows for access to the flash through simple_flash to operate.
+ * An access failure is only posted, the main loop reports it.
+ */
+void flash_simple_irq(void) {
+    uint32_t temp;
+    temp = MXC_FLC0->intr;
+
+    if (temp & MXC_F_FLC_INTR_DONE) {
+        MXC_FLC0->intr &= ~MXC_F_FLC_INTR_DONE;
+    }
+
+    if (temp & MXC_F_FLC_INTR_AF) {
+        MXC_FLC0->intr &= ~MXC_F_FLC_INTR_AF;
+        irq_event_post(IRQ_EVENT_FLASH_AF);
+    }
+}
+
+/**
+ * @brief Turns the instruction cache off for a flash erase or write.
+ *
+ * The cache may hold lines of the page being changed, so it stays off
+ * while the flash controller works and is invalidated when it comes back.
+ */
+static void flash_icc_pause(void) {
+    MXC_ICC_Disable(MXC_ICC0);
+}
+
+/**
+ * @brief Turns the instruction cache back on after a flash erase or write.
+ *
+ * Enabling the ICC invalidates it, so no stale line of the changed page
+ * survives.
+ */
+static void flash_icc_resume(void) {
+    MXC_ICC_Enable(MXC_ICC0);
+}
+
+/**
+ * @brief Initialize the Simple Flash Interface
+ * 
+ * This function registers the interrupt for the flash system and
+ * enables the interrupt. The ICC stays on; it is only disabled for
+ * the duration of each erase and write.
+*/
+void flash_simple_init(void) {
+    // Setup Flash
+    MXC_NVIC_SetVector(FLC0_IRQn, flash_simple_irq);
+    NVIC_SetPriority(FLC0_IRQn, IRQ_PRIO_FLASH);
+    NVIC_EnableIRQ(FLC0_IRQn);
+    MXC_FLC_EnableInt(MXC_F_FLC_INTR_DONEIE | MXC_F_FLC_INTR_AFIE);
+    MXC_ICC_Enable(MXC_ICC0);
+}
+
+/**
+ * @brief Flash Simple Erase Page
+ * 
+ * @param address: uint32_t, address of flash page to erase
+ * 
+ * @return int: return negative if failure, zero if success
+ * 
+ * This function erases a page of flash such that it can be updated.
+ * Flash memory can only be erased in a large block size called a page.
+ * Once erased, memory can only be written one way e.g. 1->0.
+ * In order to be re-written the entire page must be erased.
+*/
+int flash_simple_erase_page(uint32_t address) {
+    TRACE_ENTER(TRACE_FLASH_ERASE);
+    flash_icc_pause();
+    int result = MXC_FLC_PageErase(address);
+    flash_icc_resume();
+    TRACE_EXIT(TRACE_FLASH_ERASE);
+    STATS_INC(flash_erases);
+    return result;
+}
+
+/**
+ * @brief Flash Simple Read
+ * 
+ * @param address: uint32_t, address of flash page to read
+ * @param buffer: uint32_t*, pointer to buffer for data to be read into
+ * @param size: uint32_t, number of bytes to read from flash
+ * 
+ * This function reads data from the specified flash page into the buffer
+ * with the specified amount of bytes
+*/
+void flash_simple_read(uint32_t address, uint32_t* buffer, uint32_t size) {
+    TRACE_ENTER(TRACE_FLASH_READ);
+    MXC_FLC_Read(address, buffer, size);
+    TRACE_EXIT(TRACE_FLASH_READ);
+}
+
+/**
+ * @brief Flash Simple Map
+ * 
+ * @param address: uint32_t, address in flash to read from
+ * 
+ * @return const void*: pointer to the flash contents at address
+ * 
+ * Flash is memory mapped, so data can be used where it is instead of
+ * being copied out with flash_simple_read first. What the pointer shows
+ * changes when the page is erased or written.
+*/
+const void* flash_simple_map(uint32_t address) {
+    return (const void*) address;
+}
+
+/**
+ * @brief Flash Simple Write
+ * 
+ * @param address: uint32_t, address of flash page to write
+ * @param buffer: uint32_t*, pointer to buffer to write data from
+ * @param size: uint32_t, number of bytes to write from flash
+ *
+ * @return int: return negative if failure, zero if success
+ *
+ * This function writes data to the specified flash page from the buffer passed
+ * with the specified amount of bytes. Flash memory can only be written in one
+ * way e.g. 1->0. To rewrite previously written memory see the 
+ * flash_simple_erase_page documentation.
+*/
+int flash_simple_write(uint32_t address, uint32_t* buffer, uint32_t size) {
+    TRACE_ENTER(TRACE_FLASH_WRITE);
+    flash_icc_pause();
+    int result = MXC_FLC_Write(address, size, buffer);
+    flash_icc_resume();
+    TRACE_EXIT(TRACE_FLASH_WRITE);
+    return result;
+}
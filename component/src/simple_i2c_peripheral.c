@@ -12,38 +12,165 @@
  */
 
 #include "simple_i2c_peripheral.h"
+#include "fastcode.h"
+#include "irq_events.h"
+
+#ifdef I2C_USE_DMA
+#include "dma.h"
+#endif
+
+#if defined(LINK_CRC) || defined(COMPONENT_ENROLL) || defined(BOOT_BROADCAST)
+#include <string.h>
+#endif
+#ifdef LINK_CRC
+#include "crc.h"
+#endif
+#ifdef LINK_STRETCH
+#include "tmr.h"
+#endif
 
 /******************************** GLOBAL DEFINITIONS ********************************/
 // Data for all of the I2C registers
-volatile uint8_t RECEIVE_REG[MAX_I2C_MESSAGE_LEN];
+volatile i2c_bank_t RECEIVE_BANK[I2C_RX_BANKS];
 volatile uint8_t RECEIVE_DONE_REG[1];
-volatile uint8_t RECEIVE_LEN_REG[1];
-volatile uint8_t TRANSMIT_REG[MAX_I2C_MESSAGE_LEN];
+volatile i2c_bank_t TRANSMIT_BANK[I2C_BANKS];
 volatile uint8_t TRANSMIT_DONE_REG[1];
-volatile uint8_t TRANSMIT_LEN_REG[1];
+volatile uint8_t CAPABILITY_REG[1];
+volatile uint8_t TRANSMIT_STATUS_REG[2];
+#ifdef COMPONENT_ENROLL
+volatile uint8_t ENROLL_CERT_REG[I2C_ENROLL_CERT_LEN];
+#endif
+#ifdef BOOT_BROADCAST
+volatile uint8_t BOOT_RELEASE_REG[I2C_RELEASE_LEN];
+#endif
+#ifdef ADDR_ASSIGN
+volatile uint8_t ASSIGN_ADDR_REG[I2C_ASSIGN_LEN];
+#endif
+#ifdef I2C_CALIBRATE
+volatile uint8_t CALIBRATE_PATTERN_REG[I2C_CALIBRATE_LEN];
+#endif
 
 // Data structure to allow easy reference of I2C registers
-volatile uint8_t* I2C_REGS[6] = {
-    [RECEIVE] = RECEIVE_REG,
+volatile uint8_t* I2C_REGS[I2C_REG_COUNT] = {
+    [RECEIVE] = RECEIVE_BANK[0].data,
     [RECEIVE_DONE] = RECEIVE_DONE_REG,
-    [RECEIVE_LEN] = RECEIVE_LEN_REG,
-    [TRANSMIT] = TRANSMIT_REG,
+    [RECEIVE_LEN] = &RECEIVE_BANK[0].len,
+    [TRANSMIT] = TRANSMIT_BANK[0].data,
     [TRANSMIT_DONE] = TRANSMIT_DONE_REG,
-    [TRANSMIT_LEN] = TRANSMIT_LEN_REG,
+    [TRANSMIT_LEN] = &TRANSMIT_BANK[0].len,
+    [CAPABILITY] = CAPABILITY_REG,
+    [RECEIVE_FRAME] = &RECEIVE_BANK[0].len,
+    [TRANSMIT_STATUS] = TRANSMIT_STATUS_REG,
+#ifdef LINK_CRC
+    [RECEIVE_CRC] = RECEIVE_BANK[0].crc,
+    [TRANSMIT_CRC] = TRANSMIT_BANK[0].crc,
+#endif
+#ifdef COMPONENT_ENROLL
+    [ENROLL_CERT] = ENROLL_CERT_REG,
+#endif
+#ifdef BOOT_BROADCAST
+    [BOOT_RELEASE] = BOOT_RELEASE_REG,
+#endif
+#ifdef LINK_STRETCH
+    [TRANSMIT_WAIT] = TRANSMIT_STATUS_REG,
+#endif
+#ifdef ADDR_ASSIGN
+    [ASSIGN_ADDR] = ASSIGN_ADDR_REG,
+#endif
+#ifdef I2C_CALIBRATE
+    [CALIBRATE_PATTERN] = CALIBRATE_PATTERN_REG,
+#endif
 };
 
 // Data structure to allow easy reference to I2C register length
-int I2C_REGS_LEN[6] = {
+int I2C_REGS_LEN[I2C_REG_COUNT] = {
     [RECEIVE] = MAX_I2C_MESSAGE_LEN,
     [RECEIVE_DONE] = 1,
     [RECEIVE_LEN] = 1,
     [TRANSMIT] = MAX_I2C_MESSAGE_LEN,
     [TRANSMIT_DONE] = 1,
     [TRANSMIT_LEN] = 1,
+    [CAPABILITY] = 1,
+    [RECEIVE_FRAME] = 1 + MAX_I2C_MESSAGE_LEN,
+    [TRANSMIT_STATUS] = 2,
+#ifdef LINK_CRC
+    [RECEIVE_CRC] = LINK_CRC_LEN,
+    [TRANSMIT_CRC] = LINK_CRC_LEN,
+#endif
+#ifdef COMPONENT_ENROLL
+    [ENROLL_CERT] = I2C_ENROLL_CERT_LEN,
+#endif
+#ifdef BOOT_BROADCAST
+    [BOOT_RELEASE] = I2C_RELEASE_LEN,
+#endif
+#ifdef LINK_STRETCH
+    [TRANSMIT_WAIT] = 2,
+#endif
+#ifdef ADDR_ASSIGN
+    [ASSIGN_ADDR] = I2C_ASSIGN_LEN,
+#endif
+#ifdef I2C_CALIBRATE
+    [CALIBRATE_PATTERN] = I2C_CALIBRATE_LEN,
+#endif
 };
 
+// Bank state. The controller writes RECEIVE bank RX_FILL and reads TRANSMIT
+// bank TX_READ; the component takes RECEIVE bank RX_READ next and fills
+// TRANSMIT bank TX_FILL next. RX_FULL and TX_PENDING have a bit per bank
+// (I2C_DONE_BANK) holding a packet the other side has not finished with.
+// Changed by the ISR at STOP and by the component with interrupts masked
+static volatile int RX_FILL = 0;
+static volatile int RX_READ = 0;
+static volatile uint8_t RX_FULL = 0;
+static volatile int TX_READ = 0;
+static volatile int TX_FILL = 0;
+static volatile uint8_t TX_PENDING = 0;
+// I2C_DONE_CRC_ERROR while the last packet written was dropped for its CRC
+static volatile uint8_t RX_CRC_ERROR = 0;
+
+// DMA state for the RECEIVE and TRANSMIT registers, only ever set with I2C_USE_DMA
+static volatile bool RX_DMA_ACTIVE = false;
+static volatile bool TX_DMA_ACTIVE = false;
+#ifdef I2C_USE_DMA
+static int RX_DMA_CH = -1;
+static int TX_DMA_CH = -1;
+static int RX_DMA_LEN = 0;
+#endif
+
+#ifdef BOOT_BROADCAST
+// Bytes of the last BOOT_RELEASE write not yet taken, set by the ISR at STOP
+static volatile int RELEASE_LEN = 0;
+#endif
+#ifdef ADDR_ASSIGN
+// Bytes of the last ASSIGN_ADDR write not yet taken, set by the ISR at STOP
+static volatile int ASSIGN_LEN = 0;
+#endif
+
+// RECEIVE progress callback, see i2c_simple_set_rx_callback
+static i2c_simple_rx_cb_t RX_CALLBACK = NULL;
+
+#ifdef LINK_STRETCH
+// Set while a TRANSMIT_WAIT read holds SCL for a packet not yet published
+static volatile bool TX_STRETCHING = false;
+#endif
+
 /******************************** FUNCTION PROTOTYPES ********************************/
 static void i2c_simple_isr(void);
+static void i2c_simple_select_banks(void);
+static void i2c_simple_load_status(ECTF_I2C_REGS reg);
+static int i2c_simple_rx_offset(ECTF_I2C_REGS reg);
+static void i2c_simple_rx_notify(ECTF_I2C_REGS reg, int index, bool* started);
+static void i2c_simple_done_written(ECTF_I2C_REGS reg);
+static ECTF_I2C_REGS i2c_simple_write_reg(ECTF_I2C_REGS reg, bool general_call);
+static bool i2c_simple_rx_crc_ok(int bank);
+static void i2c_simple_dma_init(void);
+static bool i2c_simple_dma_start_rx(ECTF_I2C_REGS reg, int index);
+static int i2c_simple_dma_stop_rx(void);
+static bool i2c_simple_dma_start_tx(int index);
+static void i2c_simple_dma_stop_tx(void);
+static void i2c_simple_stretch_init(void);
+static void i2c_simple_stretch_start(void);
+static void i2c_simple_stretch_release(void);
 
 /******************************** FUNCTION DEFINITIONS ********************************/
 /**
@@ -73,26 +200,445 @@ int i2c_simple_peripheral_init(uint8_t addr) {
     MXC_I2C_EnableInt(I2C_INTERFACE, MXC_F_I2C_INTFL0_RD_ADDR_MATCH, 0);
     MXC_I2C_EnableInt(I2C_INTERFACE, MXC_F_I2C_INTFL0_WR_ADDR_MATCH, 0);
     MXC_I2C_EnableInt(I2C_INTERFACE, MXC_F_I2C_INTFL0_STOP, 0);
+#ifdef BOOT_BROADCAST
+    // Also answer the general call address, for the boot release
+    I2C_INTERFACE->ctrl |= MXC_F_I2C_CTRL_GC_ADDR_EN;
+    MXC_I2C_EnableInt(I2C_INTERFACE, MXC_F_I2C_INTFL0_GC_ADDR_MATCH, 0);
+#endif
     MXC_NVIC_SetVector(MXC_I2C_GET_IRQ(MXC_I2C_GET_IDX(I2C_INTERFACE)), i2c_simple_isr);
+    NVIC_SetPriority(MXC_I2C_GET_IRQ(MXC_I2C_GET_IDX(I2C_INTERFACE)), IRQ_PRIO_LINK);
     NVIC_EnableIRQ(MXC_I2C_GET_IRQ(MXC_I2C_GET_IDX(I2C_INTERFACE)));
     MXC_I2C_ClearFlags(I2C_INTERFACE, 0xFFFFFFFF, 0xFFFFFFFF);
 
-    // Prefix READY values for registers
-    I2C_REGS[RECEIVE_DONE][0] = false;
-    I2C_REGS[TRANSMIT_DONE][0] = true;
+    // Set up DMA for the long registers, the ISR path is used if unavailable
+    i2c_simple_dma_init();
+    // Timer bounding TRANSMIT_WAIT reads
+    i2c_simple_stretch_init();
+
+#ifdef LINK_CRC
+    // CRC-32 for the packets in both directions
+    error = MXC_CRC_Init();
+    if (error != E_NO_ERROR) {
+        printf("Failed to initialize CRC.\n");
+        return error;
+    }
+    MXC_CRC_SetPoly(LINK_CRC_POLY);
+#endif
+
+    // Prefix READY values for registers, every bank starts empty
+    i2c_simple_select_banks();
+    i2c_simple_load_status(RECEIVE_DONE);
+    i2c_simple_load_status(TRANSMIT_DONE);
+#ifdef COMP_READY
+    // Not yet, see i2c_simple_set_ready
+    I2C_REGS[CAPABILITY][0] = I2C_CAP_STARTING;
+#else
+    // Advertise the bus rates we can follow so the AP can negotiate up
+    I2C_REGS[CAPABILITY][0] = I2C_CAP_MAGIC | I2C_CAPABILITIES;
+#endif
 
     return E_NO_ERROR;
 }
 
+/**
+ * @brief Register a callback for RECEIVE write progress
+ * 
+ * @param cb: i2c_simple_rx_cb_t, callback to run from the ISR, NULL to disable
+ *
+ * Lets the caller start working on a message before the write completes.
+ * While DMA owns the RX FIFO the callback only runs again at STOP.
+*/
+void i2c_simple_set_rx_callback(i2c_simple_rx_cb_t cb) {
+    RX_CALLBACK = cb;
+}
+
+#ifdef COMPONENT_ENROLL
+/**
+ * @brief Publish the enrollment certificate in the ENROLL_CERT register
+ * 
+ * @param cert: const uint8_t*, I2C_ENROLL_CERT_LEN bytes, copied
+*/
+void i2c_simple_set_enroll_cert(const uint8_t* cert) {
+    memcpy((void*)ENROLL_CERT_REG, cert, I2C_ENROLL_CERT_LEN);
+}
+#endif
+
+/**
+ * @brief Point the data registers at the banks the controller accesses
+*/
+FASTCODE static void i2c_simple_select_banks(void) {
+    I2C_REGS[RECEIVE] = RECEIVE_BANK[RX_FILL].data;
+    I2C_REGS[RECEIVE_LEN] = &RECEIVE_BANK[RX_FILL].len;
+    I2C_REGS[RECEIVE_FRAME] = &RECEIVE_BANK[RX_FILL].len;
+    I2C_REGS[TRANSMIT] = TRANSMIT_BANK[TX_READ].data;
+    I2C_REGS[TRANSMIT_LEN] = &TRANSMIT_BANK[TX_READ].len;
+#ifdef LINK_CRC
+    I2C_REGS[RECEIVE_CRC] = RECEIVE_BANK[RX_FILL].crc;
+    I2C_REGS[TRANSMIT_CRC] = TRANSMIT_BANK[TX_READ].crc;
+#endif
+}
+
+/**
+ * @brief Load the bank state into a status register about to be read
+ * 
+ * @param reg: ECTF_I2C_REGS, register the controller reads
+ *
+ * Only done from the ISR: RECEIVE_DONE and TRANSMIT_DONE otherwise hold
+ * what the controller last wrote until STOP hands it to
+ * i2c_simple_done_written, and the component never touches them
+*/
+FASTCODE static void i2c_simple_load_status(ECTF_I2C_REGS reg) {
+    uint8_t tx_done = (~TX_PENDING & I2C_DONE_BANKS) | (TX_READ ? I2C_DONE_SELECT : 0);
+    if (reg == RECEIVE_DONE) {
+        RECEIVE_DONE_REG[0] = RX_FULL | RX_CRC_ERROR | (RX_FILL == 1 ? I2C_DONE_SELECT : 0) |
+                              ((I2C_RX_BANKS - 1) << I2C_DONE_CREDITS_SHIFT);
+    } else if (reg == TRANSMIT_DONE) {
+        TRANSMIT_DONE_REG[0] = tx_done;
+    } else if (reg == TRANSMIT_STATUS) {
+        TRANSMIT_STATUS_REG[0] = tx_done;
+        TRANSMIT_STATUS_REG[1] = TRANSMIT_BANK[TX_READ].len;
+    }
+#ifdef LINK_STRETCH
+    else if (reg == TRANSMIT_WAIT) {
+        i2c_simple_load_status(TRANSMIT_STATUS);
+    }
+#endif
+}
+
+/**
+ * @brief Act on a controller write to RECEIVE_DONE, TRANSMIT_DONE or RECEIVE_FRAME
+ * 
+ * @param reg: ECTF_I2C_REGS, register written this transaction
+ *
+ * A non-zero RECEIVE_DONE or any RECEIVE_FRAME write marks the bank just
+ * written full and moves the controller on to the next one, a non-zero
+ * TRANSMIT_DONE acknowledges the bank just read. A packet failing its
+ * CRC stays in the bank to be written again
+*/
+FASTCODE static void i2c_simple_done_written(ECTF_I2C_REGS reg) {
+    if (reg == RECEIVE_DONE || reg == RECEIVE_FRAME) {
+        if (reg == RECEIVE_FRAME || RECEIVE_DONE_REG[0]) {
+            if (i2c_simple_rx_crc_ok(RX_FILL)) {
+                RX_FULL |= I2C_DONE_BANK(RX_FILL);
+                RX_FILL = I2C_RX_NEXT(RX_FILL);
+                RX_CRC_ERROR = 0;
+            } else {
+                RX_CRC_ERROR = I2C_DONE_CRC_ERROR;
+            }
+        }
+    } else if (reg == TRANSMIT_DONE) {
+        if (TRANSMIT_DONE_REG[0] && (TX_PENDING & I2C_DONE_BANK(TX_READ))) {
+            TX_PENDING &= ~I2C_DONE_BANK(TX_READ);
+            TX_READ ^= 1;
+        }
+    }
+    i2c_simple_select_banks();
+}
+
+#ifdef LINK_CRC
+/**
+ * @brief Compute the CRC of a packet
+ * 
+ * @param data: uint8_t*, packet
+ * @param len: uint8_t, length of the packet
+ * 
+ * @return uint32_t: CRC-32 of the length word followed by the packet
+ *
+ * The CRC block takes whole words, so the packet is copied behind its
+ * length and zero padded. Uses the CRC block without masking interrupts,
+ * only call from the ISR or with interrupts masked
+*/
+FASTCODE static uint32_t i2c_simple_crc(const volatile uint8_t* data, uint8_t len) {
+    uint32_t words[1 + MAX_I2C_MESSAGE_LEN / 4];
+    words[0] = len;
+    words[(len + 3) / 4] = 0;
+    memcpy(&words[1], (const void*)data, len);
+
+    mxc_crc_req_t req;
+    req.dataBuffer = words;
+    req.dataLen = 1 + (len + 3) / 4;
+    req.resultCRC = 0;
+    MXC_CRC_Compute(&req);
+    return req.resultCRC;
+}
+
+/**
+ * @brief Check a written RECEIVE bank against its CRC
+ * 
+ * @param bank: int, RECEIVE bank the controller just wrote
+ * 
+ * @return bool: true if RECEIVE_CRC matches the packet
+*/
+FASTCODE static bool i2c_simple_rx_crc_ok(int bank) {
+    uint32_t crc = i2c_simple_crc(RECEIVE_BANK[bank].data, RECEIVE_BANK[bank].len);
+    uint32_t expected;
+    memcpy(&expected, (const void*)RECEIVE_BANK[bank].crc, LINK_CRC_LEN);
+    return crc == expected;
+}
+#else
+static bool i2c_simple_rx_crc_ok(int bank) { (void)bank; return true; }
+#endif
+
+#ifdef BOOT_BROADCAST
+/**
+ * @brief Check for a boot release from the controller
+ * 
+ * @return bool: true if BOOT_RELEASE was written since it was last taken
+*/
+bool i2c_simple_release_ready(void) {
+    return RELEASE_LEN != 0;
+}
+
+/**
+ * @brief Take the last boot release written
+ * 
+ * @param buf: uint8_t*, buffer of I2C_RELEASE_LEN bytes
+ * 
+ * @return int: number of bytes written to BOOT_RELEASE, 0 if there was no
+ * new release
+*/
+int i2c_simple_take_release(uint8_t* buf) {
+    __disable_irq();
+    int len = RELEASE_LEN;
+    memcpy(buf, (const void*)BOOT_RELEASE_REG, len);
+    RELEASE_LEN = 0;
+    __enable_irq();
+    return len;
+}
+#endif
+
+#ifdef ADDR_ASSIGN
+/**
+ * @brief Check for an address assignment from the controller
+ * 
+ * @return bool: true if ASSIGN_ADDR was written since it was last taken
+*/
+bool i2c_simple_assign_ready(void) {
+    return ASSIGN_LEN != 0;
+}
+
+/**
+ * @brief Take the last address assignment written
+ * 
+ * @param buf: uint8_t*, buffer of I2C_ASSIGN_LEN bytes
+ * 
+ * @return int: number of bytes written to ASSIGN_ADDR, 0 if there was no
+ * new assignment
+*/
+int i2c_simple_take_assign(uint8_t* buf) {
+    __disable_irq();
+    int len = ASSIGN_LEN;
+    memcpy(buf, (const void*)ASSIGN_ADDR_REG, len);
+    ASSIGN_LEN = 0;
+    __enable_irq();
+    return len;
+}
+
+/**
+ * @brief Answer the controller on another address from now on
+ * 
+ * @param addr: uint8_t, new 7 bit address
+ *
+ * Taken between transactions, the assignment that asked for it ended with
+ * its STOP
+*/
+void i2c_simple_set_addr(uint8_t addr) {
+    __disable_irq();
+    MXC_I2C_SetSlaveAddr(I2C_INTERFACE, addr, 0);
+    __enable_irq();
+}
+#endif
+
+#ifdef COMP_READY
+/**
+ * @brief Advertise our capabilities, CAPABILITY reads I2C_CAP_STARTING
+ * until then
+ *
+ * A single byte register, the controller reads either value whole
+*/
+void i2c_simple_set_ready(void) {
+    // Advertise the bus rates we can follow so the AP can negotiate up
+    I2C_REGS[CAPABILITY][0] = I2C_CAP_MAGIC | I2C_CAPABILITIES;
+}
+#endif
+
+/**
+ * @brief Check for a packet from the controller
+ * 
+ * @return bool: true if a RECEIVE bank holds a packet not yet released
+*/
+bool i2c_simple_rx_ready(void) {
+    return (RX_FULL & I2C_DONE_BANK(RX_READ)) != 0;
+}
+
+/**
+ * @brief Get the RECEIVE bank holding the oldest packet
+ * 
+ * @return int: bank index into RECEIVE_BANK
+*/
+int i2c_simple_rx_bank(void) {
+    return RX_READ;
+}
+
+/**
+ * @brief Release the oldest RECEIVE bank
+ *
+ * Hands the bank back to the controller for a later packet. Does nothing
+ * if no packet is waiting
+*/
+void i2c_simple_rx_release(void) {
+    __disable_irq();
+    if (RX_FULL & I2C_DONE_BANK(RX_READ)) {
+        RX_FULL &= ~I2C_DONE_BANK(RX_READ);
+        RX_READ = I2C_RX_NEXT(RX_READ);
+    }
+    __enable_irq();
+}
+
+/**
+ * @brief Get the TRANSMIT bank the next packet goes in
+ * 
+ * @return int: bank index into TRANSMIT_BANK
+ *
+ * Only ever the bank the controller is not reading from
+*/
+int i2c_simple_tx_bank(void) {
+    return TX_FILL;
+}
+
+/**
+ * @brief Hand the bank from i2c_simple_tx_bank to the controller
+*/
+void i2c_simple_tx_publish(void) {
+    __disable_irq();
+#ifdef LINK_CRC
+    // The ISR uses the CRC block too, so only with interrupts masked
+    uint32_t crc = i2c_simple_crc(TRANSMIT_BANK[TX_FILL].data, TRANSMIT_BANK[TX_FILL].len);
+    memcpy((void*)TRANSMIT_BANK[TX_FILL].crc, &crc, LINK_CRC_LEN);
+#endif
+    TX_PENDING |= I2C_DONE_BANK(TX_FILL);
+    TX_FILL ^= 1;
+    // Answer a TRANSMIT_WAIT read holding the bus for this packet
+    i2c_simple_stretch_release();
+    __enable_irq();
+}
+
+/**
+ * @brief Check whether the controller has read every published packet
+ * 
+ * @return bool: true once all TRANSMIT banks have been acknowledged
+*/
+bool i2c_simple_tx_idle(void) {
+    return TX_PENDING == 0;
+}
+
+/**
+ * @brief Check whether the bank from i2c_simple_tx_bank can be filled
+ * 
+ * @return bool: true unless both TRANSMIT banks hold unread packets
+*/
+bool i2c_simple_tx_free(void) {
+    return !(TX_PENDING & I2C_DONE_BANK(TX_FILL));
+}
+
+/**
+ * @brief Take back the last published packet if it has not been read
+ *
+ * The bank is emptied so a late read finds nothing
+*/
+void i2c_simple_tx_withdraw(void) {
+    __disable_irq();
+    int bank = TX_FILL ^ 1;
+    if (TX_PENDING & I2C_DONE_BANK(bank)) {
+        TX_PENDING &= ~I2C_DONE_BANK(bank);
+        TRANSMIT_BANK[bank].len = 0;
+        if (bank == TX_READ) {
+            TX_READ ^= 1;
+        } else {
+            TX_FILL = bank;
+        }
+        i2c_simple_select_banks();
+    }
+    __enable_irq();
+}
+
+/**
+ * @brief Find where the packet starts in a register the controller writes
+ * 
+ * @param reg: ECTF_I2C_REGS, register being written
+ * 
+ * @return int: offset of the RECEIVE data in reg, -1 if reg is not RECEIVE
+ * or RECEIVE_FRAME
+*/
+FASTCODE static int i2c_simple_rx_offset(ECTF_I2C_REGS reg) {
+    if (reg == RECEIVE) {
+        return 0;
+    } else if (reg == RECEIVE_FRAME) {
+        return 1;
+    }
+    return -1;
+}
+
+/**
+ * @brief Check the register a controller write starts with
+ * 
+ * @param reg: ECTF_I2C_REGS, register byte written
+ * @param general_call: bool, whether the write went to the general call address
+ * 
+ * @return ECTF_I2C_REGS: reg, or a register past MAX_REG so the write is
+ * dropped. With BOOT_BROADCAST a general call write may only go to
+ * BOOT_RELEASE or ASSIGN_ADDR, and those only take general call writes
+*/
+FASTCODE static ECTF_I2C_REGS i2c_simple_write_reg(ECTF_I2C_REGS reg, bool general_call) {
+#ifdef BOOT_BROADCAST
+    bool broadcast_reg = reg == BOOT_RELEASE;
+#ifdef ADDR_ASSIGN
+    broadcast_reg = broadcast_reg || reg == ASSIGN_ADDR;
+#endif
+    if (broadcast_reg != general_call) {
+        return (ECTF_I2C_REGS)(MAX_REG + 1);
+    }
+#else
+    (void)general_call;
+#endif
+    return reg;
+}
+
+/**
+ * @brief Report RECEIVE write progress to the callback
+ * 
+ * @param reg: ECTF_I2C_REGS, register being written
+ * @param index: int, bytes of reg written so far
+ * @param started: bool*, set once the callback has seen the start of the write
+ *
+ * A RECEIVE_FRAME write only counts as started once its length byte is in,
+ * so the callback always finds RECEIVE_LEN set
+*/
+FASTCODE static void i2c_simple_rx_notify(ECTF_I2C_REGS reg, int index, bool* started) {
+    int offset = i2c_simple_rx_offset(reg);
+    if (RX_CALLBACK == NULL || offset < 0 || index < offset) {
+        return;
+    }
+    if (!*started) {
+        RX_CALLBACK(RX_FILL, 0);
+        *started = true;
+    }
+    if (index > offset) {
+        RX_CALLBACK(RX_FILL, index - offset);
+    }
+}
+
 /**
  * @brief ISR for the I2C Peripheral
  * 
  * This ISR allows for a fully asynchronous interface between controller and peripheral
  * Transactions are able to begin immediately after a transaction ends
 */
-void i2c_simple_isr (void) {
+FASTCODE void i2c_simple_isr (void) {
     // Variables for state of ISR
     static bool WRITE_START = false;
+    static bool RX_STARTED = false;
+    static bool GENERAL_CALL = false;
     static int READ_INDEX = 0;
     static int WRITE_INDEX = 0;
     static ECTF_I2C_REGS ACTIVE_REG = RECEIVE;
@@ -102,10 +648,31 @@ void i2c_simple_isr (void) {
     
     // Transaction over interrupt
     if (Flags & MXC_F_I2C_INTFL0_STOP) {
+
+        // Stop any DMA transfer, the bytes it did not move are still in the FIFO
+        if (RX_DMA_ACTIVE) {
+            WRITE_INDEX += i2c_simple_dma_stop_rx();
+            MXC_I2C_ClearFlags(I2C_INTERFACE, MXC_F_I2C_INTFL0_RX_THD, 0);
+        }
+        if (TX_DMA_ACTIVE) {
+            i2c_simple_dma_stop_tx();
+        }
+#ifdef LINK_STRETCH
+        // The controller gave up on a TRANSMIT_WAIT read
+        if (TX_STRETCHING) {
+            TX_STRETCHING = false;
+            MXC_TMR_Stop(I2C_STRETCH_TIMER);
+        }
+#endif
         
         // Ready any remaining data
         if (WRITE_START == true) {
-            MXC_I2C_ReadRXFIFO(I2C_INTERFACE, (volatile unsigned char*) &ACTIVE_REG, 1);
+            if (MXC_I2C_ReadRXFIFO(I2C_INTERFACE, (volatile unsigned char*) &ACTIVE_REG, 1) == 1) {
+                ACTIVE_REG = i2c_simple_write_reg(ACTIVE_REG, GENERAL_CALL);
+                // Tell the callback a new RECEIVE write is starting
+                RX_STARTED = false;
+                i2c_simple_rx_notify(ACTIVE_REG, 0, &RX_STARTED);
+            }
             WRITE_START = false;
         }
         if (ACTIVE_REG <= MAX_REG) {
@@ -123,6 +690,23 @@ void i2c_simple_isr (void) {
         } else {
             MXC_I2C_ClearRXFIFO(I2C_INTERFACE);
         }
+        i2c_simple_rx_notify(ACTIVE_REG, WRITE_INDEX, &RX_STARTED);
+        RX_STARTED = false;
+
+        // A written status register hands a bank over
+        if (WRITE_INDEX > 0) {
+            i2c_simple_done_written(ACTIVE_REG);
+        }
+#ifdef BOOT_BROADCAST
+        if (ACTIVE_REG == BOOT_RELEASE && WRITE_INDEX > 0) {
+            RELEASE_LEN = WRITE_INDEX;
+        }
+#endif
+#ifdef ADDR_ASSIGN
+        if (ACTIVE_REG == ASSIGN_ADDR && WRITE_INDEX > 0) {
+            ASSIGN_LEN = WRITE_INDEX;
+        }
+#endif
 
         // Disable bulk send/receive interrupts
         MXC_I2C_DisableInt(I2C_INTERFACE, MXC_F_I2C_INTEN0_RX_THD, 0);
@@ -140,6 +724,7 @@ void i2c_simple_isr (void) {
         READ_INDEX = 0;
         WRITE_INDEX = 0;
         WRITE_START = false;
+        GENERAL_CALL = false;
 
         // Clear ISR flag
         MXC_I2C_ClearFlags(I2C_INTERFACE, MXC_F_I2C_INTFL0_STOP, 0);
@@ -178,12 +763,23 @@ void i2c_simple_isr (void) {
 
             // Select active register
             MXC_I2C_ReadRXFIFO(I2C_INTERFACE, (volatile unsigned char*) &ACTIVE_REG, 1);
+            i2c_simple_load_status(ACTIVE_REG);
             
             // Write data to TX Buf
+#ifdef LINK_STRETCH
+            if (ACTIVE_REG == TRANSMIT_WAIT && !(TX_PENDING & I2C_DONE_BANK(TX_READ))) {
+                // Nothing to read yet, the empty TX FIFO holds SCL until
+                // i2c_simple_stretch_release fills it
+                i2c_simple_stretch_start();
+            } else
+#endif
             if (ACTIVE_REG <= MAX_REG) {
                 READ_INDEX += MXC_I2C_WriteTXFIFO(I2C_INTERFACE, (volatile unsigned char*)I2C_REGS[ACTIVE_REG], I2C_REGS_LEN[ACTIVE_REG]);
                 if (READ_INDEX < I2C_REGS_LEN[ACTIVE_REG]) {
-                    MXC_I2C_EnableInt(I2C_INTERFACE, MXC_F_I2C_INTEN0_TX_THD, 0);
+                    // Let DMA keep the FIFO full for TRANSMIT, otherwise refill from the ISR
+                    if (!(ACTIVE_REG == TRANSMIT && i2c_simple_dma_start_tx(READ_INDEX))) {
+                        MXC_I2C_EnableInt(I2C_INTERFACE, MXC_F_I2C_INTEN0_TX_THD, 0);
+                    }
                 }
             }
         }
@@ -193,6 +789,7 @@ void i2c_simple_isr (void) {
     if (Flags & MXC_F_I2C_INTFL0_RD_ADDR_MATCH) {
         // Set write start variable
         WRITE_START = true;
+        GENERAL_CALL = false;
 
         // Enable bulk receive interrupt
         MXC_I2C_EnableInt(I2C_INTERFACE, MXC_F_I2C_INTEN0_RX_THD, 0);
@@ -201,11 +798,27 @@ void i2c_simple_isr (void) {
         MXC_I2C_ClearFlags(I2C_INTERFACE, MXC_F_I2C_INTFL0_RD_ADDR_MATCH, 0);
     }
 
-    // RX Fifo Threshold Met on Write
-    if (Flags & MXC_F_I2C_INTEN0_RX_THD) {
+#ifdef BOOT_BROADCAST
+    // Write to the general call address, taken like one to ours but only
+    // ever into BOOT_RELEASE or ASSIGN_ADDR
+    if (Flags & MXC_F_I2C_INTFL0_GC_ADDR_MATCH) {
+        WRITE_START = true;
+        GENERAL_CALL = true;
+        MXC_I2C_EnableInt(I2C_INTERFACE, MXC_F_I2C_INTEN0_RX_THD, 0);
+        MXC_I2C_ClearFlags(I2C_INTERFACE, MXC_F_I2C_INTFL0_GC_ADDR_MATCH, 0);
+    }
+#endif
+
+    // RX Fifo Threshold Met on Write, DMA owns the FIFO while it is active
+    if ((Flags & MXC_F_I2C_INTEN0_RX_THD) && !RX_DMA_ACTIVE) {
         // We always write a register before writing data so select register
         if (WRITE_START == true) {
-            MXC_I2C_ReadRXFIFO(I2C_INTERFACE, (volatile unsigned char*) &ACTIVE_REG, 1);
+            if (MXC_I2C_ReadRXFIFO(I2C_INTERFACE, (volatile unsigned char*) &ACTIVE_REG, 1) == 1) {
+                ACTIVE_REG = i2c_simple_write_reg(ACTIVE_REG, GENERAL_CALL);
+                // Tell the callback a new RECEIVE write is starting
+                RX_STARTED = false;
+                i2c_simple_rx_notify(ACTIVE_REG, 0, &RX_STARTED);
+            }
             WRITE_START = false;
         }
         // Read remaining data
@@ -225,8 +838,211 @@ void i2c_simple_isr (void) {
         } else {
             MXC_I2C_ClearRXFIFO(I2C_INTERFACE);
         }
+        i2c_simple_rx_notify(ACTIVE_REG, WRITE_INDEX, &RX_STARTED);
+
+        // Hand the rest of a RECEIVE or RECEIVE_FRAME write to DMA
+        if (i2c_simple_rx_offset(ACTIVE_REG) >= 0 && WRITE_INDEX < I2C_REGS_LEN[ACTIVE_REG]) {
+            if (i2c_simple_dma_start_rx(ACTIVE_REG, WRITE_INDEX)) {
+                MXC_I2C_DisableInt(I2C_INTERFACE, MXC_F_I2C_INTEN0_RX_THD, 0);
+            }
+        }
 
         // Clear ISR flag
         MXC_I2C_ClearFlags(I2C_INTERFACE, MXC_F_I2C_INTFL0_RX_THD, 0);
     }
 }
+
+#ifdef I2C_USE_DMA
+/**
+ * @brief Acquire DMA channels for the RECEIVE and TRANSMIT registers
+ *
+ * Leaves both channels unset if either cannot be acquired, in which
+ * case all transfers go through the ISR
+*/
+static void i2c_simple_dma_init(void) {
+    if (MXC_DMA_Init() != E_NO_ERROR) {
+        return;
+    }
+    RX_DMA_CH = MXC_DMA_AcquireChannel();
+    TX_DMA_CH = MXC_DMA_AcquireChannel();
+    if (RX_DMA_CH < 0 || TX_DMA_CH < 0) {
+        if (RX_DMA_CH >= 0) {
+            MXC_DMA_ReleaseChannel(RX_DMA_CH);
+        }
+        if (TX_DMA_CH >= 0) {
+            MXC_DMA_ReleaseChannel(TX_DMA_CH);
+        }
+        RX_DMA_CH = -1;
+        TX_DMA_CH = -1;
+    }
+}
+
+/**
+ * @brief Start a DMA transfer from the RX FIFO into RECEIVE or RECEIVE_FRAME
+ *
+ * @param reg: ECTF_I2C_REGS, register being written
+ * @param index: int, first byte of reg still to be written
+ *
+ * @return bool: true if DMA now owns the RX FIFO
+*/
+static bool i2c_simple_dma_start_rx(ECTF_I2C_REGS reg, int index) {
+    if (RX_DMA_CH < 0) {
+        return false;
+    }
+
+    mxc_dma_config_t config;
+    config.ch = RX_DMA_CH;
+    config.reqsel = I2C_DMA_RX_REQSEL;
+    config.srcwd = MXC_DMA_WIDTH_BYTE;
+    config.dstwd = MXC_DMA_WIDTH_BYTE;
+    config.srcinc_en = 0;
+    config.dstinc_en = 1;
+
+    mxc_dma_srcdst_t srcdst;
+    srcdst.ch = RX_DMA_CH;
+    srcdst.source = (void*)&I2C_INTERFACE->fifo;
+    srcdst.dest = (void*)&I2C_REGS[reg][index];
+    srcdst.len = I2C_REGS_LEN[reg] - index;
+
+    if (MXC_DMA_ConfigChannel(config, srcdst) != E_NO_ERROR) {
+        return false;
+    }
+    RX_DMA_LEN = srcdst.len;
+    RX_DMA_ACTIVE = true;
+    I2C_INTERFACE->dma |= MXC_F_I2C_DMA_RX_EN;
+    MXC_DMA_Start(RX_DMA_CH);
+    return true;
+}
+
+/**
+ * @brief Stop the RECEIVE DMA transfer
+ *
+ * @return int: number of bytes the DMA moved into RECEIVE or RECEIVE_FRAME
+*/
+static int i2c_simple_dma_stop_rx(void) {
+    I2C_INTERFACE->dma &= ~MXC_F_I2C_DMA_RX_EN;
+    MXC_DMA_Stop(RX_DMA_CH);
+    RX_DMA_ACTIVE = false;
+    return RX_DMA_LEN - (int)MXC_DMA->ch[RX_DMA_CH].cnt;
+}
+
+/**
+ * @brief Start a DMA transfer from TRANSMIT into the TX FIFO
+ *
+ * @param index: int, first byte of TRANSMIT not yet in the FIFO
+ *
+ * @return bool: true if DMA now feeds the TX FIFO
+*/
+static bool i2c_simple_dma_start_tx(int index) {
+    if (TX_DMA_CH < 0) {
+        return false;
+    }
+
+    mxc_dma_config_t config;
+    config.ch = TX_DMA_CH;
+    config.reqsel = I2C_DMA_TX_REQSEL;
+    config.srcwd = MXC_DMA_WIDTH_BYTE;
+    config.dstwd = MXC_DMA_WIDTH_BYTE;
+    config.srcinc_en = 1;
+    config.dstinc_en = 0;
+
+    mxc_dma_srcdst_t srcdst;
+    srcdst.ch = TX_DMA_CH;
+    srcdst.source = (void*)&I2C_REGS[TRANSMIT][index];
+    srcdst.dest = (void*)&I2C_INTERFACE->fifo;
+    srcdst.len = I2C_REGS_LEN[TRANSMIT] - index;
+
+    if (MXC_DMA_ConfigChannel(config, srcdst) != E_NO_ERROR) {
+        return false;
+    }
+    TX_DMA_ACTIVE = true;
+    I2C_INTERFACE->dma |= MXC_F_I2C_DMA_TX_EN;
+    MXC_DMA_Start(TX_DMA_CH);
+    return true;
+}
+
+/**
+ * @brief Stop the TRANSMIT DMA transfer
+ *
+ * The controller decides how much of TRANSMIT it reads, so whatever is
+ * left is simply dropped along with the TX FIFO
+*/
+static void i2c_simple_dma_stop_tx(void) {
+    I2C_INTERFACE->dma &= ~MXC_F_I2C_DMA_TX_EN;
+    MXC_DMA_Stop(TX_DMA_CH);
+    TX_DMA_ACTIVE = false;
+}
+#else
+static void i2c_simple_dma_init(void) {}
+static bool i2c_simple_dma_start_rx(ECTF_I2C_REGS reg, int index) { (void)reg; (void)index; return false; }
+static int i2c_simple_dma_stop_rx(void) { return 0; }
+static bool i2c_simple_dma_start_tx(int index) { (void)index; return false; }
+static void i2c_simple_dma_stop_tx(void) {}
+#endif
+
+#ifdef LINK_STRETCH
+/**
+ * @brief ISR for the TRANSMIT_WAIT timer, answers a read still held once
+ * LINK_STRETCH_MAX_US have gone by
+*/
+FASTCODE static void i2c_simple_stretch_isr(void) {
+    MXC_TMR_ClearFlags(I2C_STRETCH_TIMER);
+    i2c_simple_stretch_release();
+}
+
+/**
+ * @brief Set up the one-shot timer bounding TRANSMIT_WAIT reads
+ *
+ * At the I2C interrupt's priority, so the two never preempt each other
+*/
+static void i2c_simple_stretch_init(void) {
+    mxc_tmr_cfg_t cfg;
+    cfg.pres = TMR_PRES_1;
+    cfg.mode = TMR_MODE_ONESHOT;
+    cfg.bitMode = MXC_TMR_BIT_32;
+    cfg.clock = MXC_TMR_8M_CLK;
+    // 7.3728 MHz = 4608 ticks every 625 us
+    cfg.cmp_cnt = (uint32_t) (((uint64_t) LINK_STRETCH_MAX_US * 4608) / 625);
+    cfg.pol = 0;
+
+    MXC_TMR_Shutdown(I2C_STRETCH_TIMER);
+    MXC_TMR_Init(I2C_STRETCH_TIMER, &cfg, false);
+    MXC_TMR_ClearFlags(I2C_STRETCH_TIMER);
+    MXC_TMR_EnableInt(I2C_STRETCH_TIMER);
+    MXC_NVIC_SetVector(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(I2C_STRETCH_TIMER)), i2c_simple_stretch_isr);
+    NVIC_SetPriority(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(I2C_STRETCH_TIMER)), IRQ_PRIO_LINK);
+    NVIC_EnableIRQ(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(I2C_STRETCH_TIMER)));
+}
+
+/**
+ * @brief Hold a TRANSMIT_WAIT read until a packet is published or the timer
+ * runs out
+*/
+FASTCODE static void i2c_simple_stretch_start(void) {
+    TX_STRETCHING = true;
+    MXC_TMR_Stop(I2C_STRETCH_TIMER);
+    MXC_TMR_SetCount(I2C_STRETCH_TIMER, 1);
+    MXC_TMR_ClearFlags(I2C_STRETCH_TIMER);
+    MXC_TMR_Start(I2C_STRETCH_TIMER);
+}
+
+/**
+ * @brief Answer a held TRANSMIT_WAIT read with the bank state as it is now
+ *
+ * Only call from the ISRs or with interrupts masked
+*/
+FASTCODE static void i2c_simple_stretch_release(void) {
+    if (!TX_STRETCHING) {
+        return;
+    }
+    TX_STRETCHING = false;
+    MXC_TMR_Stop(I2C_STRETCH_TIMER);
+    i2c_simple_load_status(TRANSMIT_WAIT);
+    MXC_I2C_WriteTXFIFO(I2C_INTERFACE, (volatile unsigned char*)TRANSMIT_STATUS_REG,
+                        I2C_REGS_LEN[TRANSMIT_WAIT]);
+}
+#else
+static void i2c_simple_stretch_init(void) {}
+static void i2c_simple_stretch_start(void) {}
+static void i2c_simple_stretch_release(void) {}
+#endif
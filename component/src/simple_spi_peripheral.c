@@ -0,0 +1,205 @@
+#include "simple_spi_peripheral.h"
+
+#ifdef LINK_SPI
+
+#include <string.h>
+#include "irq_events.h"
+
+/******************************** TYPE DEFINITIONS ********************************/
+// Transfer armed on the interface
+typedef enum {
+    SPI_STATE_HEADER,   // Header of the next exchange
+    SPI_STATE_RX_BODY,  // Packet the AP writes
+    SPI_STATE_TX_BODY,  // Packet the AP reads
+} spi_state_t;
+
+/******************************** GLOBAL DEFINITIONS ********************************/
+static mxc_spi_req_t spi_req;
+static volatile spi_state_t spi_state;
+// Header armed for the AP and the one it sent with it
+static uint8_t header_out[SPI_HEADER_LEN];
+static uint8_t header_in[SPI_HEADER_LEN];
+
+static uint8_t rx_buf[SPI_MAX_PACKET_LEN];
+static volatile uint8_t rx_len;
+static volatile bool rx_full;
+static uint8_t tx_buf[SPI_MAX_PACKET_LEN];
+static volatile uint8_t tx_len;
+static volatile bool tx_ready;
+
+/******************************** FUNCTION DEFINITIONS ********************************/
+static void spi_simple_done(void* req, int result);
+
+/**
+ * @brief Arm the next transfer
+ *
+ * @param state: spi_state_t, what the transfer is
+ * @param tx: uint8_t*, bytes to send, NULL to send the default value
+ * @param rx: uint8_t*, buffer for the bytes received, NULL to drop them
+ * @param len: int, number of bytes
+*/
+static void spi_simple_arm(spi_state_t state, uint8_t* tx, uint8_t* rx, int len) {
+    spi_state = state;
+    spi_req.spi = SPI_LINK_INST;
+    spi_req.txData = tx;
+    spi_req.rxData = rx;
+    spi_req.txLen = (tx != NULL) ? len : 0;
+    spi_req.rxLen = (rx != NULL) ? len : 0;
+    spi_req.ssIdx = 0;
+    spi_req.ssDeassert = 0;
+    spi_req.txCnt = 0;
+    spi_req.rxCnt = 0;
+    spi_req.completeCB = spi_simple_done;
+    MXC_SPI_SlaveTransactionAsync(&spi_req);
+}
+
+/**
+ * @brief Arm a header with the current status
+*/
+static void spi_simple_arm_header(void) {
+    header_out[0] = SPI_STATUS_MAGIC | (rx_full ? SPI_STATUS_RX_FULL : 0) |
+                    (tx_ready ? SPI_STATUS_TX_READY : 0);
+    header_out[1] = tx_ready ? tx_len : 0;
+    spi_simple_arm(SPI_STATE_HEADER, header_out, header_in, SPI_HEADER_LEN);
+}
+
+/**
+ * @brief Transfer completion, runs in the SPI interrupt
+ *
+ * @param req: void*, request that completed
+ * @param result: int, result of the transfer
+ *
+ * Whether a body follows a header is decided on the status armed with it,
+ * not the current one, the AP only knows the former
+*/
+static void spi_simple_done(void* req, int result) {
+    (void)req;
+    if (result == E_NO_ERROR) {
+        switch (spi_state) {
+        case SPI_STATE_HEADER:
+            if (header_in[0] == SPI_CMD_WRITE && header_in[1] > 0 && !(header_out[0] & SPI_STATUS_RX_FULL)) {
+                spi_simple_arm(SPI_STATE_RX_BODY, NULL, rx_buf, header_in[1]);
+                return;
+            }
+            if (header_in[0] == SPI_CMD_READ && (header_out[0] & SPI_STATUS_TX_READY)) {
+                spi_simple_arm(SPI_STATE_TX_BODY, tx_buf, NULL, header_out[1]);
+                return;
+            }
+            break;
+        case SPI_STATE_RX_BODY:
+            rx_len = header_in[1];
+            rx_full = true;
+            break;
+        case SPI_STATE_TX_BODY:
+            tx_ready = false;
+            break;
+        }
+    }
+    spi_simple_arm_header();
+}
+
+/**
+ * @brief ISR for the SPI interface
+*/
+static void spi_simple_isr(void) {
+    MXC_SPI_AsyncHandler(SPI_LINK_INST);
+}
+
+/**
+ * @brief Initialize the SPI peripheral and arm the first header
+ *
+ * @return int: negative if error, zero if successful
+*/
+int spi_simple_peripheral_init(void) {
+    int result = MXC_SPI_Init(SPI_LINK_INST, 0, 0, 1, 0, LINK_SPI_HZ);
+    if (result != E_NO_ERROR) {
+        return result;
+    }
+    MXC_SPI_SetDataSize(SPI_LINK_INST, 8);
+    MXC_SPI_SetWidth(SPI_LINK_INST, SPI_WIDTH_STANDARD);
+    MXC_SPI_SetDefaultTXData(SPI_LINK_INST, 0xFF);
+
+    MXC_NVIC_SetVector(MXC_SPI_GET_IRQ(MXC_SPI_GET_IDX(SPI_LINK_INST)), spi_simple_isr);
+    NVIC_SetPriority(MXC_SPI_GET_IRQ(MXC_SPI_GET_IDX(SPI_LINK_INST)), IRQ_PRIO_LINK);
+    NVIC_EnableIRQ(MXC_SPI_GET_IRQ(MXC_SPI_GET_IDX(SPI_LINK_INST)));
+
+    spi_simple_arm_header();
+    return E_NO_ERROR;
+}
+
+/**
+ * @brief Check for a packet from the AP
+ *
+ * @return bool: true while one is held
+*/
+bool spi_simple_rx_ready(void) {
+    return rx_full;
+}
+
+/**
+ * @brief Copy out the packet from the AP and free its buffer
+ *
+ * @param packet: uint8_t*, buffer of SPI_MAX_PACKET_LEN bytes
+ *
+ * @return uint8_t: length of the packet, 0 if there was none
+ *
+ * The AP sees the buffer free from the header after the next one
+*/
+uint8_t spi_simple_rx_take(uint8_t* packet) {
+    if (!rx_full) {
+        return 0;
+    }
+    uint8_t len = rx_len;
+    memcpy(packet, rx_buf, len);
+    rx_full = false;
+    return len;
+}
+
+/**
+ * @brief Check whether the AP has read the last published packet
+ *
+ * @return bool: true if another one can be published
+ *
+ * A withdrawn packet the armed header still offers may yet be read, so
+ * tx_buf is only free again once no transfer can send it
+*/
+bool spi_simple_tx_idle(void) {
+    if (tx_ready || spi_state == SPI_STATE_TX_BODY) {
+        return false;
+    }
+    return !(spi_state == SPI_STATE_HEADER && (header_out[0] & SPI_STATUS_TX_READY));
+}
+
+/**
+ * @brief Hand a packet to the AP
+ *
+ * @param len: uint8_t, length of the packet
+ * @param packet: uint8_t*, packet
+*/
+void spi_simple_tx_publish(uint8_t len, uint8_t* packet) {
+    memcpy(tx_buf, packet, len);
+    tx_len = len;
+    tx_ready = true;
+}
+
+/**
+ * @brief Take back a published packet the AP has not read
+*/
+void spi_simple_tx_withdraw(void) {
+    tx_ready = false;
+}
+
+/**
+ * @brief Drop a half done exchange and arm a fresh header
+*/
+void spi_simple_resync(void) {
+    NVIC_DisableIRQ(MXC_SPI_GET_IRQ(MXC_SPI_GET_IDX(SPI_LINK_INST)));
+    // The aborted transfer must not arm anything itself
+    spi_req.completeCB = NULL;
+    MXC_SPI_AbortAsync(SPI_LINK_INST);
+    tx_ready = false;
+    spi_simple_arm_header();
+    NVIC_EnableIRQ(MXC_SPI_GET_IRQ(MXC_SPI_GET_IDX(SPI_LINK_INST)));
+}
+
+#endif
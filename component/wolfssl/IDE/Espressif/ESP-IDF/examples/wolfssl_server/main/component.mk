@@ -1,3 +0,0 @@
-#
-# Main Makefile. This is basically the same as a component makefile.
-#
\ No newline at end of file
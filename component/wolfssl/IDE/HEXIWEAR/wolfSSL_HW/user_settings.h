@@ -1,6 +0,0 @@
-#define FREESCALE_KSDK_BM
-#define FREESCALE_KSDK_1_3
-#define FSL_HW_CRYPTO_MANUAL_SELECTION
-#define NO_MAIN_DRIVER
-#define USE_CERT_BUFFERS_1024
-#define ECC_USER_CURVES
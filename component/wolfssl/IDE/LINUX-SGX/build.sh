@@ -1,9 +0,0 @@
-#!/bin/sh
-
-
-CFLAGS_NEW="-DDEBUG_WOLFSSL"
-export CFLAGS="${CFLAGS} ${CFLAGS_NEW}"
-echo ${CFLAGS}
-
-make -f sgx_t_static.mk HAVE_WOLFSSL_BENCHMARK=1 HAVE_WOLFSSL_TEST=1 HAVE_WOLFSSL_SP=1
-
@@ -1,3 +0,0 @@
-#!/bin/sh
-
-make -f sgx_t_static.mk clean
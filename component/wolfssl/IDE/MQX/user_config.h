@@ -1 +0,0 @@
-#define MQX_CPU                 PSP_CPU_MK60DN512Z
\ No newline at end of file
@@ -1,61 +0,0 @@
-
-/* wolfSSH */
-#define WOLFSSL_PUBLIC_MP
-
-/* TLS1.3 */
-#define WOLFSSL_TLS13
-#define HAVE_TLS_EXTENSIONS
-#define HAVE_SUPPORTED_CURVES
-#define HAVE_FFDHE_2048
-#define HAVE_THREAD_LS
-
-/* SP optimization */
-#define WOLFSSL_HAVE_SP_RSA
-#define WOLFSSL_HAVE_SP_DH
-#define WOLFSSL_SP_4096
-#define WOLFSSL_HAVE_SP_ECC
-#define HAVE_ECC384
-#define WOLFSSL_SP_384
-
-/* Hardening */
-#define TFM_TIMING_RESISTANT
-#define ECC_TIMING_RESISTANT
-#define WC_RSA_BLINDING
-
-/* Default Cyphers */
-#define HAVE_AESGCM
-#define WOLFSSL_SHA512
-#define WOLFSSL_SHA384
-#define HAVE_HKDF
-#define NO_DSA
-#define HAVE_ECC
-#define TFM_ECC256
-#define ECC_SHAMIR
-#define WC_RSA_PSS
-#define WOLFSSL_BASE64_ENCODE
-#define NO_RC4
-#define WOLFSSL_SHA224
-#define WOLFSSL_SHA3
-#define WOLFSSL_SHAKE256
-#define HAVE_POLY1305
-#define HAVE_ONE_TIME_AUTH
-#define HAVE_CHACHA
-#define HAVE_HASHDRBG
-#define HAVE_TLS_EXTENSIONS
-#define HAVE_SUPPORTED_CURVES
-#define HAVE_EXTENDED_MASTER
-#define NO_RC4
-#define HAVE_ENCRYPT_THEN_MAC
-#define NO_PSK
-#define NO_MD4
-#define NO_PWDBASED
-#define USE_FAST_MATH
-#define WC_NO_ASYNC_THREADING
-#define HAVE_DH_DEFAULT_PARAMS
-#define NO_DES3
-#define WOLFSSL_DH_CONST
-
-/* MQX */
-#define FREESCALE_MQX
-#define FREESCALE_NO_RNG
-
@@ -1,25 +0,0 @@
-﻿#pragma once
-
-/// <summary>
-/// This identifier should be defined before including any of the networking-related header files.
-/// It indicates which version of the Wi-Fi data structures the application uses.
-/// </summary>
-#define NETWORKING_STRUCTS_VERSION 1
-
-/// <summary>
-/// This identifier must be defined before including any of the Wi-Fi related header files.
-/// It indicates which version of the Wi-Fi data structures the application uses.
-/// </summary>
-#define WIFICONFIG_STRUCTS_VERSION 1
-
-/// <summary>
-/// This identifier must be defined before including any of the UART-related header files.
-/// It indicates which version of the UART data structures the application uses.
-/// </summary>
-#define UART_STRUCTS_VERSION 1
-
-/// <summary>
-/// This identifier must be defined before including any of the SPI-related header files.
-/// It indicates which version of the SPI data structures the application uses.
-/// </summary>
-#define SPI_STRUCTS_VERSION 1
@@ -1,32 +0,0 @@
-/* wolfssl_thread_entry.c
- *
- * Copyright (C) 2006-2023 wolfSSL Inc.
- *
- * This file is part of wolfSSL.
- *
- * wolfSSL is free software; you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation; either version 2 of the License, or
- * (at your option) any later version.
- *
- * wolfSSL is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program; if not, write to the Free Software
- * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
- */
-
-#include <wolfssl/wolfcrypt/settings.h>
-#include "wolfcrypt/test/test.h"
-
-void wolfssl_thread_entry(void* pvParameters)
-{
-    FSP_PARAMETER_NOT_USED (pvParameters);
-    /* Benchmark output is displayed to Renesas Debug Virtual Console */
-    initialise_monitor_handles();
-    wolfcrypt_test(0);
-    while(1);
-}
@@ -1,36 +0,0 @@
-/* myprintf.c
- *
- * Copyright (C) 2006-2023 wolfSSL Inc.
- *
- * This file is part of wolfSSL.
- *
- * wolfSSL is free software; you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation; either version 2 of the License, or
- * (at your option) any later version.
- *
- * wolfSSL is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program; if not, write to the Free Software
- * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
- */
-#include "SEGGER_RTT.h"
-
-#define SEGGER_INDEX            (0)
-
-int myprintf(const char * sFormat, ...);
-
-int myprintf(const char * sFormat, ...)
-{
-    int r;
-    va_list ParamList;
-
-    va_start(ParamList, sFormat);
-    r = SEGGER_RTT_vprintf(0, sFormat, &ParamList);
-    va_end(ParamList);
-    return r;
-}
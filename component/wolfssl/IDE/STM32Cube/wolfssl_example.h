@@ -1,52 +0,0 @@
-/* wolfssl_example.h
- *
- * Copyright (C) 2006-2023 wolfSSL Inc.
- *
- * This file is part of wolfSSL.
- *
- * wolfSSL is free software; you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation; either version 2 of the License, or
- * (at your option) any later version.
- *
- * wolfSSL is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program; if not, write to the Free Software
- * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
- */
-
-#ifndef WOLFSSL_EXAMPLE_H_
-#define WOLFSSL_EXAMPLE_H_
-
-#ifdef HAVE_CONFIG_H
-    #include <config.h>
-#endif
-
-#ifndef WOLFSSL_USER_SETTINGS
-	#include <wolfssl/options.h>
-#endif
-#include <wolfssl/wolfcrypt/settings.h>
-#include <wolfssl/ssl.h>
-#include <wolfssl/wolfcrypt/error-crypt.h>
-#include <wolfcrypt/test/test.h>
-#include <wolfcrypt/benchmark/benchmark.h>
-
-#ifndef SINGLE_THREADED
-#include <cmsis_os.h>
-#endif
-
-#ifndef WOLF_EXAMPLES_STACK
-#define WOLF_EXAMPLES_STACK  (30*1024)
-#endif
-
-#ifdef CMSIS_OS2_H_
-void wolfCryptDemo(void* argument);
-#else
-void wolfCryptDemo(void const * argument);
-#endif
-
-#endif /* WOLFSSL_EXAMPLE_H_ */
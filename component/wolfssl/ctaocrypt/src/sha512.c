@@ -1 +0,0 @@
-/* dummy file for autoconf */
@@ -1,3 +0,0 @@
-/* ec25519.h  */
-
-#include <wolfssl/openssl/ec25519.h>
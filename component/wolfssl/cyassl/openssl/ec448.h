@@ -1,3 +0,0 @@
-/* ec448.h  */
-
-#include <wolfssl/openssl/ec448.h>
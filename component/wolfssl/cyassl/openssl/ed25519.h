@@ -1,3 +0,0 @@
-/* ed25519.h  */
-
-#include <wolfssl/openssl/ed25519.h>
@@ -1,3 +0,0 @@
-/* ed448.h  */
-
-#include <wolfssl/openssl/ed448.h>
@@ -1,3 +0,0 @@
-/* test.h */
-
-#include <wolfssl/test.h>
@@ -1,30 +0,0 @@
-# ===========================================================================
-#     https://www.gnu.org/software/autoconf-archive/ax_file_escapes.html
-# ===========================================================================
-#
-# SYNOPSIS
-#
-#   AX_FILE_ESCAPES
-#
-# DESCRIPTION
-#
-#   Writes the specified data to the specified file.
-#
-# LICENSE
-#
-#   Copyright (c) 2008 Tom Howard <tomhoward@users.sf.net>
-#
-#   Copying and distribution of this file, with or without modification, are
-#   permitted in any medium without royalty provided the copyright notice
-#   and this notice are preserved. This file is offered as-is, without any
-#   warranty.
-
-#serial 8
-
-AC_DEFUN([AX_FILE_ESCAPES],[
-AX_DOLLAR="\$"
-AX_SRB="\\135"
-AX_SLB="\\133"
-AX_BS="\\\\"
-AX_DQ="\""
-])
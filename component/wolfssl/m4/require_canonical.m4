@@ -1,3 +0,0 @@
-AC_DEFUN([REQUIRE_CANONICAL], [
-    AC_REQUIRE(AC_CANONICAL_HOST)_LT_SET_OPTION([LT_INIT],[win32-dll])
-])dnl REQUIRE_CANONICAL
@@ -1 +0,0 @@
-/* dummy ecc_fp.c for dist */